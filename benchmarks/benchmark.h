@@ -0,0 +1,179 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <simd.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/vectorization.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * A minimal, self-contained micro-benchmark harness used by the drivers
+   * in the benchmarks/ directory.
+   *
+   * A kernel is a callable that processes a fixed number of "items"
+   * (edges, rows, lanes) per invocation. The kernel is repeated with a
+   * doubling number of repetitions until the accumulated wall time
+   * exceeds a minimal measurement time (0.2s, or the value of the
+   * environment variable RYUJIN_BENCHMARK_MIN_TIME), and the best of
+   * three such measurements is reported.
+   *
+   * The report consists of the time per item, the achieved GFLOP/s and
+   * GB/s based on the nominal flop and byte counts per item supplied by
+   * the driver.
+   */
+  namespace Benchmark
+  {
+    /**
+     * Prevent the compiler from optimizing away the computation of
+     * @p value.
+     */
+    template <typename T>
+    inline void do_not_optimize(const T &value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      asm volatile("" : : "r,m"(value) : "memory");
+#else
+      static volatile const T *sink;
+      sink = &value;
+#endif
+    }
+
+
+    /**
+     * Return a human readable name of the scalar or vectorized @p Number
+     * type, e.g., "double" or "VectorizedArray<double, 4>".
+     */
+    template <typename Number>
+    std::string type_name()
+    {
+      using ScalarNumber = typename get_value_type<Number>::type;
+      const std::string scalar =
+          std::is_same_v<ScalarNumber, float> ? "float" : "double";
+      if constexpr (std::is_arithmetic_v<Number>)
+        return scalar;
+      else
+        return "VectorizedArray<" + scalar + ", " +
+               std::to_string(Number::size()) + ">";
+    }
+
+
+    /**
+     * Set lane @p k of a scalar or vectorized @p number to @p value. For
+     * scalar types @p k is ignored.
+     */
+    template <typename Number>
+    inline void set_lane(Number &number,
+                         unsigned int k,
+                         typename get_value_type<Number>::type value)
+    {
+      if constexpr (std::is_arithmetic_v<Number>)
+        number = value;
+      else
+        number[k] = value;
+    }
+
+
+    /**
+     * Return a vector of @p n uniformly distributed random values in the
+     * interval [@p min, @p max] with a fixed seed.
+     */
+    inline std::vector<double>
+    random_values(unsigned int n, double min, double max, unsigned int seed)
+    {
+      std::mt19937 generator(seed);
+      std::uniform_real_distribution<double> distribution(min, max);
+      std::vector<double> result(n);
+      std::generate(result.begin(), result.end(), [&]() {
+        return distribution(generator);
+      });
+      return result;
+    }
+
+
+    /**
+     * Print the header of the result table.
+     */
+    inline void print_header(const std::string &title)
+    {
+      std::cout << "\n" << title << "\n\n";
+      std::cout << std::left << std::setw(52) << "benchmark" << std::right
+                << std::setw(12) << "ns/item" << std::setw(12) << "GFLOP/s"
+                << std::setw(12) << "GB/s" << std::setw(14) << "bytes/item"
+                << std::endl;
+    }
+
+
+    /**
+     * Run the @p kernel, which processes @p n_items items per call, and
+     * print a result line. The nominal work per item is given by @p
+     * flops_per_item and @p bytes_per_item.
+     *
+     * If the kernel contains collective MPI communication all ranks of
+     * @p mpi_communicator have to call this function. The decision on the
+     * number of repetitions is then based on the maximal time over all
+     * ranks and only rank 0 prints the result.
+     */
+    template <typename Callable>
+    void run(const std::string &name,
+             const Callable &kernel,
+             unsigned int n_items,
+             double flops_per_item,
+             double bytes_per_item,
+             const MPI_Comm &mpi_communicator = MPI_COMM_SELF)
+    {
+      double min_time = 0.2;
+      if (const char *env = std::getenv("RYUJIN_BENCHMARK_MIN_TIME"))
+        min_time = std::max(std::atof(env), 1.e-3);
+
+      using clock = std::chrono::steady_clock;
+
+      /* Warm up caches and branch predictors: */
+      kernel();
+
+      double best = std::numeric_limits<double>::max();
+      for (unsigned int sample = 0; sample < 3; ++sample) {
+        for (unsigned long repetitions = 1;; repetitions *= 2) {
+          const auto start = clock::now();
+          for (unsigned long r = 0; r < repetitions; ++r)
+            kernel();
+          const std::chrono::duration<double> duration =
+              clock::now() - start;
+          const auto elapsed =
+              dealii::Utilities::MPI::max(duration.count(), mpi_communicator);
+          if (elapsed >= min_time) {
+            best = std::min(best, elapsed / repetitions / n_items);
+            break;
+          }
+        }
+      }
+
+      if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) != 0)
+        return;
+
+      const auto gflops = flops_per_item / best * 1.e-9;
+      const auto gbytes = bytes_per_item / best * 1.e-9;
+      std::cout << std::left << std::setw(52) << name << std::right
+                << std::fixed << std::setprecision(3) << std::setw(12)
+                << best * 1.e9 << std::setw(12) << gflops << std::setw(12)
+                << gbytes << std::setw(14) << std::setprecision(1)
+                << bytes_per_item << std::endl;
+    }
+  } // namespace Benchmark
+} // namespace ryujin
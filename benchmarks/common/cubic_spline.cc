@@ -0,0 +1,80 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#include <benchmark.h>
+
+#include <cubic_spline.h>
+
+/*
+ * Benchmark CubicSpline::eval() for scalar, vectorized, and batched
+ * arguments on random points for a table of 256 equidistant and 256
+ * randomly spaced support points.
+ */
+
+using namespace ryujin;
+
+void benchmark(const bool uniform)
+{
+  constexpr unsigned int n = 4096;
+  constexpr unsigned int n_support = 256;
+
+  using VA = ryujin::VectorizedArray<double>;
+  constexpr unsigned int width = VA::size();
+
+  std::vector<double> xs(n_support);
+  if (uniform) {
+    for (unsigned int i = 0; i < n_support; ++i)
+      xs[i] = double(i) / (n_support - 1);
+  } else {
+    xs = Benchmark::random_values(n_support, 0., 1., 1);
+    std::sort(xs.begin(), xs.end());
+    xs.front() = 0.;
+    xs.back() = 1.;
+  }
+  const auto ys = Benchmark::random_values(n_support, -1., 1., 2);
+
+  const CubicSpline spline(xs, ys);
+
+  const auto points = Benchmark::random_values(n, 0., 1., 3);
+  std::vector<VA> x(n / width);
+  for (unsigned int i = 0; i < n; ++i)
+    x[i / width][i % width] = points[i];
+  std::vector<double> results(n);
+
+  const auto run = [&](const std::string &name, const auto &kernel) {
+    /*
+     * Nominal work per point: the interval lookup and a Horner scheme
+     * of degree three (7 flops). Every evaluation loads the point and
+     * the five coefficients of the interval and stores one value.
+     */
+    Benchmark::run(name, kernel, n, 7., 7. * sizeof(double));
+  };
+
+  const std::string suffix = uniform ? " (uniform)" : " (non-uniform)";
+
+  run("eval(double)" + suffix, [&]() {
+    for (unsigned int i = 0; i < n; ++i)
+      Benchmark::do_not_optimize(spline.eval(points[i]));
+  });
+
+  run("eval(" + Benchmark::type_name<VA>() + ")" + suffix, [&]() {
+    for (unsigned int i = 0; i < n / width; ++i)
+      Benchmark::do_not_optimize(spline.eval(x[i]));
+  });
+
+  run("eval(ArrayView)" + suffix, [&]() {
+    spline.eval(dealii::make_array_view(points),
+                dealii::make_array_view(results));
+    Benchmark::do_not_optimize(results[0]);
+  });
+}
+
+
+int main()
+{
+  Benchmark::print_header("CubicSpline::eval()");
+  benchmark(true);
+  benchmark(false);
+}
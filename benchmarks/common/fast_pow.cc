@@ -0,0 +1,76 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#include <benchmark.h>
+
+#include <simd.h>
+
+/*
+ * Benchmark ryujin::pow() and ryujin::fast_pow() for scalar and
+ * vectorized arguments on random inputs in the range typically
+ * encountered in the Riemann solvers (x in [0.1, 10], b in [0.1, 3]).
+ */
+
+using namespace ryujin;
+
+template <typename Number>
+void benchmark()
+{
+  constexpr unsigned int n = 4096;
+  constexpr unsigned int width = ryujin::VectorizedArray<Number>::size();
+
+  const auto xs = Benchmark::random_values(n, 0.1, 10., 1);
+  const auto bs = Benchmark::random_values(n, 0.1, 3., 2);
+
+  /* Pack inputs into SIMD registers (or plain scalars): */
+  using VA = ryujin::VectorizedArray<Number>;
+  std::vector<VA> x(n / width);
+  std::vector<VA> b(n / width);
+  for (unsigned int i = 0; i < n; ++i) {
+    x[i / width][i % width] = xs[i];
+    b[i / width][i % width] = bs[i];
+  }
+
+  const auto run = [&](const std::string &name, const auto &kernel) {
+    /*
+     * We count a pow() as log + mul + exp: roughly 40 floating point
+     * operations for the polynomial approximations. Every evaluation
+     * loads two and stores one value.
+     */
+    Benchmark::run(name, kernel, n, 40., 3. * sizeof(Number));
+  };
+
+  const auto scalar_name = Benchmark::type_name<Number>();
+  const auto vector_name = Benchmark::type_name<VA>();
+
+  run("pow<" + scalar_name + ">", [&]() {
+    for (unsigned int i = 0; i < n; ++i)
+      Benchmark::do_not_optimize(ryujin::pow(Number(xs[i]), Number(bs[i])));
+  });
+
+  run("fast_pow<" + scalar_name + ">", [&]() {
+    for (unsigned int i = 0; i < n; ++i)
+      Benchmark::do_not_optimize(
+          ryujin::fast_pow(Number(xs[i]), Number(bs[i]), Bias::none));
+  });
+
+  run("pow<" + vector_name + ">", [&]() {
+    for (unsigned int i = 0; i < n / width; ++i)
+      Benchmark::do_not_optimize(ryujin::pow(x[i], b[i]));
+  });
+
+  run("fast_pow<" + vector_name + ">", [&]() {
+    for (unsigned int i = 0; i < n / width; ++i)
+      Benchmark::do_not_optimize(ryujin::fast_pow(x[i], b[i], Bias::none));
+  });
+}
+
+
+int main()
+{
+  Benchmark::print_header("ryujin::pow() and ryujin::fast_pow()");
+  benchmark<double>();
+  benchmark<float>();
+}
@@ -0,0 +1,214 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#include <benchmark.h>
+
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+/*
+ * Benchmark the SIMD access functions SparseMatrixSIMD::get_tensor() and
+ * SparseMatrixSIMD::write_entry() (with and without software prefetching
+ * of upcoming SIMD row groups) as well as the ghost row exchange (with
+ * and without skipping of zero rows). The sparsity pattern is a
+ * banded matrix with a stencil of 9 entries per row, which resembles a
+ * Q1 discretization in 2D, distributed over all MPI ranks.
+ *
+ * The ghost exchange benchmarks are only run with more than one MPI
+ * rank.
+ */
+
+using namespace ryujin;
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  const auto mpi_rank =
+      dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const auto n_mpi_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  constexpr unsigned int n_owned = 1 << 16;
+  constexpr unsigned int half_stencil = 4;
+  constexpr unsigned int stencil = 2 * half_stencil + 1;
+  const unsigned int size = n_mpi_processes * n_owned;
+
+  const unsigned int first = mpi_rank * n_owned;
+  const unsigned int last = first + n_owned;
+
+  dealii::IndexSet locally_owned(size);
+  dealii::IndexSet locally_relevant(size);
+  locally_owned.add_range(first, last);
+  locally_relevant.add_range(first >= half_stencil ? first - half_stencil : 0,
+                             std::min(last + half_stencil, size));
+
+  const auto partitioner =
+      std::make_shared<dealii::Utilities::MPI::Partitioner>(
+          locally_owned, locally_relevant, MPI_COMM_WORLD);
+
+  dealii::DynamicSparsityPattern dsp(size, size, locally_relevant);
+  for (const auto i : locally_relevant) {
+    const unsigned int begin = i >= half_stencil ? i - half_stencil : 0;
+    const unsigned int end = std::min<unsigned int>(i + half_stencil + 1, size);
+    for (unsigned int j = begin; j < end; ++j)
+      if (locally_relevant.is_element(j))
+        dsp.add(i, j);
+  }
+  dsp.compress();
+
+  using VA = ryujin::VectorizedArray<double>;
+  constexpr auto simd_length = VA::size();
+  constexpr unsigned int n_internal = (n_owned / 2 / simd_length) * simd_length;
+
+  SparsityPatternSIMD<simd_length> sparsity(n_internal, dsp, partitioner);
+
+  constexpr int dim = 2;
+  SparseMatrixSIMD<double, dim, simd_length> matrix(sparsity);
+  SparseMatrixSIMD<double, 1, simd_length> scalar_matrix(sparsity);
+
+  const auto values = Benchmark::random_values(stencil, -1., 1., 1);
+
+  if (mpi_rank == 0)
+    Benchmark::print_header("SparseMatrixSIMD access and ghost exchange");
+
+  const auto row_length = [&](unsigned int i) {
+    return sparsity.row_length(i);
+  };
+
+  /* write_entry(): */
+
+  const auto write_serial = [&]() {
+    for (unsigned int i = n_internal; i < n_owned; ++i)
+      for (unsigned int col_idx = 0; col_idx < row_length(i); ++col_idx) {
+        dealii::Tensor<1, dim, double> entry;
+        entry[0] = values[col_idx % stencil];
+        entry[1] = -values[col_idx % stencil];
+        matrix.write_entry(entry, i, col_idx);
+      }
+  };
+
+  const auto write_simd = [&]() {
+    for (unsigned int i = 0; i < n_internal; i += simd_length)
+      for (unsigned int col_idx = 0; col_idx < row_length(i); ++col_idx) {
+        dealii::Tensor<1, dim, VA> entry;
+        entry[0] = values[col_idx % stencil];
+        entry[1] = -values[col_idx % stencil];
+        matrix.template write_entry<VA>(entry, i, col_idx);
+      }
+  };
+
+  if (mpi_rank == 0) {
+    Benchmark::run("write_entry<double>",
+                   write_serial,
+                   (n_owned - n_internal) * stencil,
+                   0.,
+                   dim * sizeof(double));
+    Benchmark::run("write_entry<" + Benchmark::type_name<VA>() + ">",
+                   write_simd,
+                   n_internal * stencil,
+                   0.,
+                   dim * sizeof(double));
+  }
+
+  /* get_tensor(): */
+
+  const auto read_serial = [&]() {
+    for (unsigned int i = n_internal; i < n_owned; ++i) {
+      dealii::Tensor<1, dim, double> sum;
+      for (unsigned int col_idx = 0; col_idx < row_length(i); ++col_idx)
+        sum += matrix.get_tensor(i, col_idx);
+      Benchmark::do_not_optimize(sum);
+    }
+  };
+
+  const auto read_simd = [&]() {
+    for (unsigned int i = 0; i < n_internal; i += simd_length) {
+      dealii::Tensor<1, dim, VA> sum;
+      for (unsigned int col_idx = 0; col_idx < row_length(i); ++col_idx)
+        sum += matrix.template get_tensor<VA>(i, col_idx);
+      Benchmark::do_not_optimize(sum);
+    }
+  };
+
+  if (mpi_rank == 0) {
+    Benchmark::run("get_tensor<double>",
+                   read_serial,
+                   (n_owned - n_internal) * stencil,
+                   dim,
+                   dim * sizeof(double));
+    Benchmark::run("get_tensor<" + Benchmark::type_name<VA>() + ">",
+                   read_simd,
+                   n_internal * stencil,
+                   dim,
+                   dim * sizeof(double));
+  }
+
+  /*
+   * get_tensor() with software prefetching of the column indices and
+   * entries of the SIMD row group a given number of strides ahead (see
+   * the PREFETCH_DISTANCE compile-time option):
+   */
+
+  for (const unsigned int distance : {1u, 2u, 4u, 8u}) {
+    const auto read_prefetch = [&]() {
+      for (unsigned int i = 0; i < n_internal; i += simd_length) {
+        const unsigned int next = i + distance * simd_length;
+        if (next < n_internal) {
+          sparsity.prefetch_row(next);
+          matrix.prefetch_row(next);
+        }
+        dealii::Tensor<1, dim, VA> sum;
+        const unsigned int *js = sparsity.columns(i);
+        for (unsigned int col_idx = 0; col_idx < row_length(i);
+             ++col_idx, js += simd_length) {
+          Benchmark::do_not_optimize(*js);
+          sum += matrix.template get_tensor<VA>(i, col_idx);
+        }
+        Benchmark::do_not_optimize(sum);
+      }
+    };
+
+    if (mpi_rank == 0)
+      Benchmark::run("get_tensor<" + Benchmark::type_name<VA>() +
+                         ">, prefetch distance " + std::to_string(distance),
+                     read_prefetch,
+                     n_internal * stencil,
+                     dim,
+                     dim * sizeof(double) + sizeof(unsigned int));
+  }
+
+  /* Ghost row exchange: */
+
+  if (n_mpi_processes > 1) {
+    const unsigned int n_ghost_rows = partitioner->n_ghost_indices();
+
+    for (unsigned int i = 0; i < n_owned; ++i)
+      for (unsigned int col_idx = 0; col_idx < row_length(i); ++col_idx)
+        scalar_matrix.write_entry(
+            (i % 8 == 0) ? values[col_idx % stencil] : 0., i, col_idx);
+
+    const auto exchange = [&](const bool skip_zero_rows) {
+      return [&, skip_zero_rows]() {
+        scalar_matrix.update_ghost_rows_start(0, skip_zero_rows);
+        scalar_matrix.update_ghost_rows_finish();
+      };
+    };
+
+    /* We count bytes per ghost entry sent and received: */
+    Benchmark::run("update_ghost_rows()",
+                   exchange(false),
+                   n_ghost_rows * stencil,
+                   0.,
+                   2. * sizeof(double),
+                   MPI_COMM_WORLD);
+    Benchmark::run("update_ghost_rows(skip zero rows)",
+                   exchange(true),
+                   n_ghost_rows * stencil,
+                   0.,
+                   2. * sizeof(double),
+                   MPI_COMM_WORLD);
+  }
+}
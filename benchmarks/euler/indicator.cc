@@ -0,0 +1,151 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#include <benchmark.h>
+
+#include <hyperbolic_system.h>
+#include <indicator.h>
+#include <multicomponent_vector.h>
+
+/*
+ * Benchmark the entropy viscosity commutator, Indicator::reset(),
+ * Indicator::accumulate() and Indicator::alpha(), on a synthetic stencil
+ * of 9 random neighbors per row with random admissible states.
+ */
+
+using namespace ryujin::Euler;
+using namespace ryujin;
+
+template <typename Number>
+void benchmark()
+{
+  constexpr int dim = 2;
+  constexpr unsigned int n = 4096;
+  constexpr unsigned int stencil = 9;
+  const unsigned int width = get_stride_size<Number>;
+
+  HyperbolicSystem hyperbolic_system;
+
+  using View = HyperbolicSystemView<dim, Number>;
+  using ScalarView = HyperbolicSystemView<dim, typename View::ScalarNumber>;
+  using state_type = typename View::state_type;
+  using scalar_state_type = typename ScalarView::state_type;
+
+  typename Indicator<dim, Number>::Parameters indicator_parameters;
+  dealii::ParameterAcceptor::initialize();
+
+  const auto view = hyperbolic_system.view<dim, Number>();
+  const auto scalar_view =
+      hyperbolic_system.view<dim, typename View::ScalarNumber>();
+
+  /* Set up precomputed values (specific entropy, Harten entropy): */
+
+  dealii::IndexSet locally_owned(n);
+  locally_owned.add_range(0, n);
+  const auto scalar_partitioner =
+      std::make_shared<dealii::Utilities::MPI::Partitioner>(
+          locally_owned, MPI_COMM_SELF);
+
+  typename View::PrecomputedVector precomputed;
+  precomputed.reinit_with_scalar_partitioner(scalar_partitioner);
+
+  const auto rho = Benchmark::random_values(n, 0.1, 10., 1);
+  const auto v_1 = Benchmark::random_values(n, -2., 2., 2);
+  const auto v_2 = Benchmark::random_values(n, -2., 2., 3);
+  const auto p = Benchmark::random_values(n, 0.01, 100., 4);
+
+  std::vector<scalar_state_type> U(n);
+  for (unsigned int i = 0; i < n; ++i) {
+    U[i] = scalar_view.from_primitive_state(
+        scalar_state_type{{rho[i], v_1[i], v_2[i], p[i]}});
+    const typename ScalarView::precomputed_type values{
+        scalar_view.specific_entropy(U[i]),
+        scalar_view.harten_entropy(U[i])};
+    precomputed.write_tensor(values, i);
+  }
+
+  /* A random stencil and random c_ij: */
+
+  std::vector<unsigned int> js(n * stencil);
+  {
+    const auto random = Benchmark::random_values(n * stencil, 0., n - 1, 6);
+    std::transform(random.begin(), random.end(), js.begin(), [](double x) {
+      return static_cast<unsigned int>(x);
+    });
+  }
+
+  const auto c_ij = Benchmark::random_values(dim * stencil, -0.5, 0.5, 7);
+
+  /* Gather all states once into the SIMD layout: */
+
+  std::vector<state_type> U_i(n / width);
+  std::vector<state_type> U_j(n / width * stencil);
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int c = 0; c < 4; ++c) {
+      Benchmark::set_lane(U_i[i / width][c], i % width, U[i][c]);
+      for (unsigned int col = 0; col < stencil; ++col)
+        Benchmark::set_lane(U_j[(i / width) * stencil + col][c],
+                            i % width,
+                            U[js[i * stencil + col]][c]);
+    }
+
+  /* Transpose the stencil such that js[..] holds width consecutive
+   * column indices: */
+  std::vector<unsigned int> js_simd(n * stencil);
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int col = 0; col < stencil; ++col)
+      js_simd[((i / width) * stencil + col) * width + i % width] =
+          js[i * stencil + col];
+
+  std::vector<dealii::Tensor<1, dim, Number>> c(stencil);
+  for (unsigned int col = 0; col < stencil; ++col)
+    for (unsigned int d = 0; d < dim; ++d)
+      c[col][d] = c_ij[col * dim + d];
+
+  Indicator<dim, Number> indicator(
+      hyperbolic_system, indicator_parameters, precomputed);
+
+  const auto kernel = [&]() {
+    for (unsigned int i = 0; i < n / width; ++i) {
+      indicator.reset(i * width, U_i[i]);
+      for (unsigned int col = 0; col < stencil; ++col)
+        indicator.accumulate(&js_simd[(i * stencil + col) * width],
+                             U_j[i * stencil + col],
+                             c[col]);
+      Benchmark::do_not_optimize(indicator.alpha(Number(0.01)));
+    }
+  };
+
+  /*
+   * Nominal work per row: the flux and entropy derivative of U_i
+   * (roughly 40 flops), 9 times the flux of U_j and the commutator
+   * contribution (roughly 50 flops each), and the final alpha (roughly
+   * 20 flops). Every row reads 10 states and 10 precomputed tuples.
+   */
+  const double flops = 60. + stencil * 50.;
+  const double bytes =
+      (stencil + 1.) * (sizeof(scalar_state_type) +
+                        sizeof(typename ScalarView::precomputed_type));
+
+  Benchmark::run("Indicator<" + Benchmark::type_name<Number>() + ">",
+                 kernel,
+                 n,
+                 flops,
+                 bytes);
+
+  dealii::ParameterAcceptor::clear();
+}
+
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  Benchmark::print_header("Euler: Indicator::reset/accumulate/alpha()");
+  benchmark<double>();
+  benchmark<ryujin::VectorizedArray<double>>();
+  benchmark<float>();
+  benchmark<ryujin::VectorizedArray<float>>();
+}
@@ -0,0 +1,104 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#include <benchmark.h>
+
+#include <hyperbolic_system.h>
+#include <limiter.h>
+#include <limiter.template.h>
+#include <multicomponent_vector.h>
+
+/*
+ * Benchmark the convex limiter, Limiter::limit(), for random admissible
+ * states U and random updates P, where the bounds are chosen such that
+ * roughly half of the updates have to be limited.
+ */
+
+using namespace ryujin::Euler;
+using namespace ryujin;
+
+template <typename Number>
+void benchmark()
+{
+  constexpr int dim = 2;
+  constexpr unsigned int n = 1024;
+  const unsigned int width = get_stride_size<Number>;
+
+  HyperbolicSystem hyperbolic_system;
+
+  using View = HyperbolicSystemView<dim, Number>;
+  using state_type = typename View::state_type;
+  using Bounds = typename Limiter<dim, Number>::Bounds;
+
+  typename Limiter<dim, Number>::Parameters limiter_parameters;
+  typename View::PrecomputedVector dummy;
+  dealii::ParameterAcceptor::initialize();
+
+  const auto view = hyperbolic_system.view<dim, Number>();
+
+  const auto rho = Benchmark::random_values(n, 0.1, 10., 1);
+  const auto v_1 = Benchmark::random_values(n, -2., 2., 2);
+  const auto v_2 = Benchmark::random_values(n, -2., 2., 3);
+  const auto p = Benchmark::random_values(n, 0.01, 100., 4);
+  const auto delta = Benchmark::random_values(4 * n, -0.2, 0.2, 5);
+
+  std::vector<state_type> U(n / width);
+  std::vector<state_type> P(n / width);
+  std::vector<Bounds> bounds(n / width);
+
+  for (unsigned int i = 0; i < n / width; ++i) {
+    state_type primitive;
+    for (unsigned int k = 0; k < width; ++k) {
+      const unsigned int j = i * width + k;
+      Benchmark::set_lane(primitive[0], k, rho[j]);
+      Benchmark::set_lane(primitive[1], k, v_1[j]);
+      Benchmark::set_lane(primitive[2], k, v_2[j]);
+      Benchmark::set_lane(primitive[3], k, p[j]);
+      for (unsigned int c = 0; c < 4; ++c)
+        Benchmark::set_lane(P[i][c], k, delta[4 * j + c] * rho[j]);
+    }
+    U[i] = view.from_primitive_state(primitive);
+
+    const auto rho_i = view.density(U[i]);
+    const auto s_i = view.specific_entropy(U[i]);
+    bounds[i] = {Number(0.9) * rho_i, Number(1.1) * rho_i, Number(0.95) * s_i};
+  }
+
+  Limiter<dim, Number> limiter(hyperbolic_system, limiter_parameters, dummy);
+
+  const auto kernel = [&]() {
+    for (unsigned int i = 0; i < n / width; ++i) {
+      const auto [l, success] = limiter.limit(bounds[i], U[i], P[i]);
+      Benchmark::do_not_optimize(l);
+    }
+  };
+
+  /*
+   * Nominal work per state: a quadratic solve for the density bounds
+   * and a small number of Newton iterations (default: 2) for the
+   * specific entropy involving a fast_pow evaluation each, roughly 200
+   * flops. Every call reads U, P, and the bounds.
+   */
+  const double flops = 200.;
+  const double bytes = (2. * sizeof(state_type) + sizeof(Bounds)) / width;
+
+  Benchmark::run("Limiter<" + Benchmark::type_name<Number>() + ">::limit()",
+                 kernel,
+                 n,
+                 flops,
+                 bytes);
+
+  dealii::ParameterAcceptor::clear();
+}
+
+
+int main()
+{
+  Benchmark::print_header("Euler: Limiter::limit()");
+  benchmark<double>();
+  benchmark<ryujin::VectorizedArray<double>>();
+  benchmark<float>();
+  benchmark<ryujin::VectorizedArray<float>>();
+}
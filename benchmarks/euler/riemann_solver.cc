@@ -0,0 +1,100 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#include <benchmark.h>
+
+#include <hyperbolic_system.h>
+#include <multicomponent_vector.h>
+#include <riemann_solver.h>
+#include <riemann_solver.template.h>
+
+/*
+ * Benchmark the computation of the maximal wavespeed of the 1D Riemann
+ * problem, RiemannSolver::compute(), for random (admissible) primitive
+ * states for scalar and vectorized arithmetic types with and without
+ * Newton iterations.
+ */
+
+using namespace ryujin::Euler;
+using namespace ryujin;
+
+template <typename Number>
+void benchmark(const unsigned int newton_iterations)
+{
+  constexpr int dim = 1;
+  constexpr unsigned int n = 1024;
+  const unsigned int width = get_stride_size<Number>;
+
+  HyperbolicSystem hyperbolic_system;
+
+  using View = HyperbolicSystemView<dim, Number>;
+  typename RiemannSolver<dim, Number>::Parameters riemann_solver_parameters;
+  typename View::PrecomputedVector dummy;
+
+  {
+    std::stringstream parameters;
+    parameters << "subsection RiemannSolver\n"
+               << "set newton max iterations = " << newton_iterations << "\n"
+               << "end" << std::endl;
+    dealii::ParameterAcceptor::initialize(parameters);
+  }
+
+  RiemannSolver<dim, Number> riemann_solver(
+      hyperbolic_system, riemann_solver_parameters, dummy);
+
+  using ScalarNumber = typename View::ScalarNumber;
+  const ScalarNumber gamma = hyperbolic_system.view<dim, Number>().gamma();
+
+  const auto rho = Benchmark::random_values(2 * n, 0.1, 10., 1);
+  const auto u = Benchmark::random_values(2 * n, -2., 2., 2);
+  const auto p = Benchmark::random_values(2 * n, 0.01, 100., 3);
+
+  using primitive_type = typename RiemannSolver<dim, Number>::primitive_type;
+  std::vector<primitive_type> riemann_data(2 * n / width);
+  for (unsigned int i = 0; i < 2 * n; ++i) {
+    auto &data = riemann_data[i / width];
+    Benchmark::set_lane(data[0], i % width, rho[i]);
+    Benchmark::set_lane(data[1], i % width, u[i]);
+    Benchmark::set_lane(data[2], i % width, p[i]);
+    Benchmark::set_lane(data[3], i % width, std::sqrt(gamma * p[i] / rho[i]));
+  }
+
+  const auto kernel = [&]() {
+    for (unsigned int e = 0; e < n / width; ++e)
+      Benchmark::do_not_optimize(riemann_solver.compute(
+          riemann_data[2 * e], riemann_data[2 * e + 1]));
+  };
+
+  /*
+   * Nominal work per edge: two p_star estimates based on fast_pow (4
+   * evaluations at roughly 40 flops each), the wavespeed computation
+   * and every Newton iteration thereafter (roughly 80 flops). Every edge
+   * reads two primitive states.
+   */
+  const double flops = 200. + 80. * newton_iterations;
+  const double bytes = 2. * sizeof(primitive_type) / width;
+
+  Benchmark::run("RiemannSolver<" + Benchmark::type_name<Number>() +
+                     ">::compute(), " + std::to_string(newton_iterations) +
+                     " newton iterations",
+                 kernel,
+                 n,
+                 flops,
+                 bytes);
+
+  dealii::ParameterAcceptor::clear();
+}
+
+
+int main()
+{
+  Benchmark::print_header("Euler: RiemannSolver::compute()");
+  for (const unsigned int newton_iterations : {0, 2}) {
+    benchmark<double>(newton_iterations);
+    benchmark<ryujin::VectorizedArray<double>>(newton_iterations);
+    benchmark<float>(newton_iterations);
+    benchmark<ryujin::VectorizedArray<float>>(newton_iterations);
+  }
+}
@@ -0,0 +1,91 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#include <benchmark.h>
+
+#include <hyperbolic_system.h>
+#include <multicomponent_vector.h>
+#include <riemann_solver.h>
+#include <riemann_solver.template.h>
+
+/*
+ * Benchmark the computation of the maximal wavespeed of the 1D Riemann
+ * problem, RiemannSolver::compute(), for random (admissible) primitive
+ * states with a random ratio of specific heats gamma in [1.1, 3].
+ */
+
+using namespace ryujin::EulerAEOS;
+using namespace ryujin;
+
+template <typename Number>
+void benchmark()
+{
+  constexpr int dim = 1;
+  constexpr unsigned int n = 1024;
+  const unsigned int width = get_stride_size<Number>;
+
+  HyperbolicSystem hyperbolic_system;
+
+  using View = HyperbolicSystemView<dim, Number>;
+  typename RiemannSolver<dim, Number>::Parameters riemann_solver_parameters;
+  typename View::PrecomputedVector dummy;
+  dealii::ParameterAcceptor::initialize();
+
+  RiemannSolver<dim, Number> riemann_solver(
+      hyperbolic_system, riemann_solver_parameters, dummy);
+
+  const double b = hyperbolic_system.view<dim, Number>().eos_interpolation_b();
+
+  const auto rho = Benchmark::random_values(2 * n, 0.1, 10., 1);
+  const auto u = Benchmark::random_values(2 * n, -2., 2., 2);
+  const auto p = Benchmark::random_values(2 * n, 0.01, 100., 3);
+  const auto gamma = Benchmark::random_values(2 * n, 1.1, 3., 4);
+
+  using primitive_type = typename RiemannSolver<dim, Number>::primitive_type;
+  std::vector<primitive_type> riemann_data(2 * n / width);
+  for (unsigned int i = 0; i < 2 * n; ++i) {
+    auto &data = riemann_data[i / width];
+    const auto a = std::sqrt(gamma[i] * p[i] / (rho[i] * (1. - b * rho[i])));
+    Benchmark::set_lane(data[0], i % width, rho[i]);
+    Benchmark::set_lane(data[1], i % width, u[i]);
+    Benchmark::set_lane(data[2], i % width, p[i]);
+    Benchmark::set_lane(data[3], i % width, gamma[i]);
+    Benchmark::set_lane(data[4], i % width, a);
+  }
+
+  const auto kernel = [&]() {
+    for (unsigned int e = 0; e < n / width; ++e)
+      Benchmark::do_not_optimize(riemann_solver.compute(
+          riemann_data[2 * e], riemann_data[2 * e + 1]));
+  };
+
+  /*
+   * Nominal work per edge: the pressure estimates involve up to six
+   * fast_pow evaluations (at roughly 40 flops each) and additional 60
+   * flops for the wave speed computation. Every edge reads two primitive
+   * states.
+   */
+  const double flops = 300.;
+  const double bytes = 2. * sizeof(primitive_type) / width;
+
+  Benchmark::run("RiemannSolver<" + Benchmark::type_name<Number>() +
+                     ">::compute()",
+                 kernel,
+                 n,
+                 flops,
+                 bytes);
+
+  dealii::ParameterAcceptor::clear();
+}
+
+
+int main()
+{
+  Benchmark::print_header("EulerAEOS: RiemannSolver::compute()");
+  benchmark<double>();
+  benchmark<ryujin::VectorizedArray<double>>();
+  benchmark<float>();
+  benchmark<ryujin::VectorizedArray<float>>();
+}
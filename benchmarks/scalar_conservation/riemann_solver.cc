@@ -0,0 +1,111 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#include <benchmark.h>
+
+#include <hyperbolic_system.h>
+#include <multicomponent_vector.h>
+#include <riemann_solver.h>
+#include <riemann_solver.template.h>
+
+/*
+ * Benchmark the computation of the maximal wavespeed,
+ * RiemannSolver::compute(), for the Burgers and KPP fluxes in 2D with
+ * random states and random directions.
+ */
+
+using namespace ryujin::ScalarConservation;
+using namespace ryujin;
+
+template <typename Number>
+void benchmark(const std::string &flux)
+{
+  constexpr int dim = 2;
+  constexpr unsigned int n = 1024;
+  const unsigned int width = get_stride_size<Number>;
+
+  HyperbolicSystem hyperbolic_system;
+
+  using View = HyperbolicSystemView<dim, Number>;
+  using precomputed_type = typename View::precomputed_type;
+  typename RiemannSolver<dim, Number>::Parameters riemann_solver_parameters;
+  typename View::PrecomputedVector dummy;
+
+  {
+    std::stringstream parameters;
+    parameters << "subsection HyperbolicSystem\n"
+               << "set flux = " << flux << "\n"
+               << "end" << std::endl;
+    dealii::ParameterAcceptor::initialize(parameters);
+  }
+
+  RiemannSolver<dim, Number> riemann_solver(
+      hyperbolic_system, riemann_solver_parameters, dummy);
+
+  const auto view = hyperbolic_system.view<dim, Number>();
+
+  const auto values = Benchmark::random_values(2 * n, -2., 2., 1);
+  const auto angles = Benchmark::random_values(n, 0., 2. * M_PI, 2);
+
+  std::vector<Number> u(2 * n / width);
+  std::vector<dealii::Tensor<1, dim, Number>> n_ij(n / width);
+  for (unsigned int i = 0; i < 2 * n; ++i)
+    Benchmark::set_lane(u[i / width], i % width, values[i]);
+  for (unsigned int i = 0; i < n; ++i) {
+    Benchmark::set_lane(n_ij[i / width][0], i % width, std::cos(angles[i]));
+    Benchmark::set_lane(n_ij[i / width][1], i % width, std::sin(angles[i]));
+  }
+
+  std::vector<precomputed_type> prec(2 * n / width);
+  for (unsigned int i = 0; i < 2 * n / width; ++i) {
+    const auto f = view.flux_function(u[i]);
+    const auto df = view.flux_gradient_function(u[i]);
+    for (unsigned int d = 0; d < dim; ++d) {
+      prec[i][d] = f[d];
+      prec[i][dim + d] = df[d];
+    }
+  }
+
+  const auto kernel = [&]() {
+    for (unsigned int e = 0; e < n / width; ++e)
+      Benchmark::do_not_optimize(riemann_solver.compute(u[2 * e],
+                                                        u[2 * e + 1],
+                                                        prec[2 * e],
+                                                        prec[2 * e + 1],
+                                                        n_ij[e]));
+  };
+
+  /*
+   * Nominal work per edge: projection of fluxes and gradients onto n_ij
+   * and the wavespeed estimate, roughly 30 flops. Every edge reads two
+   * states and two precomputed tuples and one direction.
+   */
+  const double flops = 30.;
+  const double bytes =
+      (2. * sizeof(Number) + 2. * sizeof(precomputed_type) +
+       sizeof(dealii::Tensor<1, dim, Number>)) /
+      width;
+
+  Benchmark::run("RiemannSolver<" + Benchmark::type_name<Number>() +
+                     ">::compute(), " + flux,
+                 kernel,
+                 n,
+                 flops,
+                 bytes);
+
+  dealii::ParameterAcceptor::clear();
+}
+
+
+int main()
+{
+  Benchmark::print_header("ScalarConservation: RiemannSolver::compute()");
+  for (const std::string flux : {"burgers", "kpp"}) {
+    benchmark<double>(flux);
+    benchmark<ryujin::VectorizedArray<double>>(flux);
+    benchmark<float>(flux);
+    benchmark<ryujin::VectorizedArray<float>>(flux);
+  }
+}
@@ -0,0 +1,23 @@
+##
+## SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+## Copyright (C) 2024 by the ryujin authors
+##
+
+find_path(ZSTD_INCLUDE_DIR zstd.h
+  PATH_SUFFIXES include
+  )
+
+find_library(ZSTD_LIBRARY
+  NAMES zstd
+  PATH_SUFFIXES lib${LIB_SUFFIX} lib64 lib
+  )
+
+find_package_handle_standard_args(ZSTD DEFAULT_MSG
+  ZSTD_LIBRARY ZSTD_INCLUDE_DIR
+  )
+
+if(ZSTD_FOUND AND NOT TARGET ZSTD::ZSTD)
+  add_library(ZSTD::ZSTD INTERFACE IMPORTED)
+  target_link_libraries(ZSTD::ZSTD INTERFACE ${ZSTD_LIBRARY})
+  target_include_directories(ZSTD::ZSTD SYSTEM INTERFACE ${ZSTD_INCLUDE_DIR})
+endif()
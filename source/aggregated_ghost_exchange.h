@@ -0,0 +1,274 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include "trace.h"
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ryujin
+{
+  namespace Vectors
+  {
+    /**
+     * A small aggregation layer over the MPI partitioners that updates the
+     * ghost values of several vectors with a single message per neighbor
+     * rank instead of one message per vector.
+     *
+     * All vectors have to be set up with partitioners that are derived
+     * from the same scalar partitioner (for example with
+     * create_vector_partitioner()), i.e., the partitioners have to
+     * exchange data with identical sets of MPI ranks. The number of
+     * components per vector can differ. The communication plan is
+     * computed on first use and reused as long as the partitioners of
+     * the vectors do not change.
+     *
+     * @note The class packs exported entries from, and unpacks ghost
+     * entries into, the interleaved storage of the vectors. It must thus
+     * not be used for vectors that exchange ghost values through a shared
+     * memory window (see MultiComponentVector::reinit()).
+     *
+     * @ingroup Miscellaneous
+     */
+    template <typename Number>
+    class AggregatedGhostExchange
+    {
+    public:
+      using ScalarVector = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+      /**
+       * Pack the exported entries of all @p vectors into one send buffer
+       * per neighbor rank and start the exchange.
+       *
+       * @note Locally owned values must not be modified until
+       * update_ghost_values_finish() returns.
+       */
+      void update_ghost_values_start(
+          const std::vector<const ScalarVector *> &vectors,
+          const unsigned int communication_channel = 0);
+
+      /**
+       * Wait for the exchange started by update_ghost_values_start() to
+       * complete and unpack the ghost values of all vectors.
+       */
+      void update_ghost_values_finish();
+
+    private:
+      /**
+       * Set up the communication plan for the partitioners of
+       * @p vectors.
+       */
+      void setup(const std::vector<const ScalarVector *> &vectors);
+
+      std::vector<std::shared_ptr<const dealii::Utilities::MPI::Partitioner>>
+          partitioners_;
+
+      /**
+       * Neighbor ranks and offsets of their data in the send (receive)
+       * buffer, and for every buffer position a tuple (vector, local
+       * storage index) of the exported (ghost) entry.
+       */
+      std::vector<int> send_ranks_;
+      std::vector<unsigned int> send_offsets_;
+      std::vector<std::pair<unsigned int, unsigned int>> send_entries_;
+
+      std::vector<int> receive_ranks_;
+      std::vector<unsigned int> receive_offsets_;
+      std::vector<std::pair<unsigned int, unsigned int>> receive_entries_;
+
+      std::vector<const ScalarVector *> vectors_;
+      std::vector<Number> send_buffer_;
+      std::vector<Number> receive_buffer_;
+
+#ifdef DEAL_II_WITH_MPI
+      std::vector<MPI_Request> requests_;
+#endif
+    };
+
+
+#ifndef DOXYGEN
+    /* Template definitions: */
+
+    template <typename Number>
+    void AggregatedGhostExchange<Number>::setup(
+        const std::vector<const ScalarVector *> &vectors)
+    {
+      partitioners_.clear();
+      for (const auto vector : vectors)
+        partitioners_.push_back(vector->get_partitioner());
+
+      const auto &first = *partitioners_.front();
+      const unsigned int n_send = first.import_targets().size();
+      const unsigned int n_receive = first.ghost_targets().size();
+
+      send_ranks_.clear();
+      for (const auto &[rank, n_entries] : first.import_targets())
+        send_ranks_.push_back(rank);
+
+      receive_ranks_.clear();
+      for (const auto &[rank, n_entries] : first.ghost_targets())
+        receive_ranks_.push_back(rank);
+
+      /*
+       * Exported entries: For every vector, flatten the import indices
+       * (half open ranges traversed in the order of the import targets).
+       * Then interleave the slices of all vectors target by target:
+       */
+
+      std::vector<std::vector<unsigned int>> export_indices(vectors.size());
+      for (unsigned int v = 0; v < vectors.size(); ++v) {
+        const auto &partitioner = *partitioners_[v];
+        AssertThrow(partitioner.import_targets().size() == n_send &&
+                        partitioner.ghost_targets().size() == n_receive,
+                    dealii::ExcMessage("The partitioners of an aggregated "
+                                       "ghost exchange have to communicate "
+                                       "with the same MPI ranks"));
+        for (const auto &[first_index, last_index] :
+             partitioner.import_indices())
+          for (unsigned int i = first_index; i < last_index; ++i)
+            export_indices[v].push_back(i);
+      }
+
+      send_offsets_.assign(1, 0);
+      send_entries_.clear();
+      std::vector<unsigned int> position(vectors.size(), 0);
+      for (unsigned int p = 0; p < n_send; ++p) {
+        for (unsigned int v = 0; v < vectors.size(); ++v) {
+          const auto &[rank, n_entries] = partitioners_[v]->import_targets()[p];
+          AssertThrow(rank == (unsigned int)send_ranks_[p],
+                      dealii::ExcMessage("Mismatching import targets"));
+          for (unsigned int k = 0; k < n_entries; ++k)
+            send_entries_.emplace_back(v, export_indices[v][position[v]++]);
+        }
+        send_offsets_.push_back(send_entries_.size());
+      }
+
+      /*
+       * Ghost entries: Stored contiguously after the locally owned range
+       * in the order of the ghost targets:
+       */
+
+      receive_offsets_.assign(1, 0);
+      receive_entries_.clear();
+      for (unsigned int v = 0; v < vectors.size(); ++v)
+        position[v] = partitioners_[v]->locally_owned_size();
+      for (unsigned int p = 0; p < n_receive; ++p) {
+        for (unsigned int v = 0; v < vectors.size(); ++v) {
+          const auto &[rank, n_entries] = partitioners_[v]->ghost_targets()[p];
+          AssertThrow(rank == (unsigned int)receive_ranks_[p],
+                      dealii::ExcMessage("Mismatching ghost targets"));
+          for (unsigned int k = 0; k < n_entries; ++k)
+            receive_entries_.emplace_back(v, position[v]++);
+        }
+        receive_offsets_.push_back(receive_entries_.size());
+      }
+
+      send_buffer_.resize(send_entries_.size());
+      receive_buffer_.resize(receive_entries_.size());
+    }
+
+
+    template <typename Number>
+    void AggregatedGhostExchange<Number>::update_ghost_values_start(
+        const std::vector<const ScalarVector *> &vectors,
+        const unsigned int communication_channel)
+    {
+      TraceScope trace("aggregated ghost exchange start");
+      Assert(!vectors.empty(), dealii::ExcMessage("No vectors given"));
+      Assert(vectors_.empty(),
+             dealii::ExcMessage("A ghost exchange is already in progress"));
+
+      bool plan_valid = partitioners_.size() == vectors.size();
+      for (unsigned int v = 0; plan_valid && v < vectors.size(); ++v)
+        plan_valid = partitioners_[v] == vectors[v]->get_partitioner();
+      if (!plan_valid)
+        setup(vectors);
+
+      vectors_ = vectors;
+
+#ifdef DEAL_II_WITH_MPI
+      AssertIndexRange(communication_channel, 200);
+      using dealii::Utilities::MPI::internal::Tags::partitioner_export_end;
+      using dealii::Utilities::MPI::internal::Tags::partitioner_export_start;
+      const int mpi_tag = partitioner_export_start + communication_channel;
+      Assert(mpi_tag <= partitioner_export_end, dealii::ExcInternalError());
+
+      const auto &mpi_communicator =
+          partitioners_.front()->get_mpi_communicator();
+      const auto mpi_type =
+          dealii::Utilities::MPI::mpi_type_id_for_type<Number>;
+
+      requests_.resize(receive_ranks_.size() + send_ranks_.size());
+
+      for (unsigned int p = 0; p < receive_ranks_.size(); ++p) {
+        const int ierr =
+            MPI_Irecv(receive_buffer_.data() + receive_offsets_[p],
+                      receive_offsets_[p + 1] - receive_offsets_[p],
+                      mpi_type,
+                      receive_ranks_[p],
+                      mpi_tag,
+                      mpi_communicator,
+                      &requests_[p]);
+        AssertThrowMPI(ierr);
+      }
+
+      for (unsigned int k = 0; k < send_entries_.size(); ++k) {
+        const auto &[v, i] = send_entries_[k];
+        send_buffer_[k] = vectors_[v]->begin()[i];
+      }
+
+      for (unsigned int p = 0; p < send_ranks_.size(); ++p) {
+        const int ierr =
+            MPI_Isend(send_buffer_.data() + send_offsets_[p],
+                      send_offsets_[p + 1] - send_offsets_[p],
+                      mpi_type,
+                      send_ranks_[p],
+                      mpi_tag,
+                      mpi_communicator,
+                      &requests_[receive_ranks_.size() + p]);
+        AssertThrowMPI(ierr);
+      }
+#else
+      (void)communication_channel;
+#endif
+    }
+
+
+    template <typename Number>
+    void AggregatedGhostExchange<Number>::update_ghost_values_finish()
+    {
+      TraceScope trace("aggregated ghost exchange wait");
+#ifdef DEAL_II_WITH_MPI
+      const int ierr =
+          MPI_Waitall(requests_.size(), requests_.data(), MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+      requests_.clear();
+
+      /*
+       * The const_cast is the usual idiom for updating (mutable) ghost
+       * values of a const vector:
+       */
+      for (unsigned int k = 0; k < receive_entries_.size(); ++k) {
+        const auto &[v, i] = receive_entries_[k];
+        const_cast<Number *>(vectors_[v]->begin())[i] = receive_buffer_[k];
+      }
+#endif
+
+      for (const auto vector : vectors_)
+        vector->set_ghost_state(true);
+      vectors_.clear();
+    }
+#endif
+  } // namespace Vectors
+} // namespace ryujin
@@ -0,0 +1,391 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include "offline_data.h"
+#include "openmp.h"
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * A thread-parallel contour (level set) extractor for scalar vectors,
+   * for example the density or a schlieren indicator.
+   *
+   * The class works directly on the degrees of freedom located at the
+   * vertices of all locally owned cells. Every cell is split into
+   * simplices (two triangles in 2D and six tetrahedra in 3D, following
+   * the Kuhn subdivision) and the linear interpolant of the vertex values
+   * is contoured on every simplex. The result is a "soup" of unconnected
+   * (dim - 1) dimensional simplices: points in 1D, line segments in 2D,
+   * and triangles in 3D. Curved cells are approximated by their vertices
+   * and, for higher order elements, only the vertex values are used.
+   *
+   * This is intended for quick-look output at high cadence: The
+   * extraction is a single pass over the locally owned cells and every
+   * rank writes only the (small) soup it produced.
+   *
+   * @ingroup TimeLoop
+   */
+  template <int dim, typename Number = double>
+  class ContourExtractor
+  {
+  public:
+    /**
+     * The number of vertices of a cell.
+     */
+    static constexpr unsigned int n_vertices =
+        dealii::GeometryInfo<dim>::vertices_per_cell;
+
+    /**
+     * A point of the contour (padded with zeros to three coordinates).
+     */
+    using Vertex = std::array<float, 3>;
+
+    /**
+     * A soup of (dim - 1) dimensional simplices. Simplex k consists of
+     * the points points[dim * k], ..., points[dim * k + dim - 1] and
+     * belongs to the level levels[k] of the quantity with index
+     * quantities[k].
+     */
+    struct Soup {
+      std::vector<Vertex> points;
+      std::vector<float> levels;
+      std::vector<int> quantities;
+
+      std::size_t size() const
+      {
+        return levels.size();
+      }
+    };
+
+    /**
+     * Store the coordinates and the local indices of the vertex degrees
+     * of freedom of all locally owned cells. prepare() has to be called
+     * again after the mesh has changed.
+     */
+    void prepare(const OfflineData<dim, Number> &offline_data)
+    {
+      const auto &dof_handler = offline_data.dof_handler();
+      const auto &finite_element = dof_handler.get_fe();
+      const auto &support_points = finite_element.get_unit_support_points();
+
+      AssertThrow(support_points.size() == finite_element.n_dofs_per_cell(),
+                  dealii::ExcMessage("The contour extractor requires a "
+                                     "finite element with support points"));
+
+      /* The local degree of freedom located at every vertex of a cell: */
+      std::array<unsigned int, n_vertices> vertex_dofs;
+      for (unsigned int v = 0; v < n_vertices; ++v) {
+        const auto vertex = dealii::GeometryInfo<dim>::unit_cell_vertex(v);
+        const auto it = std::find_if(
+            support_points.begin(),
+            support_points.end(),
+            [&](const auto &point) { return point.distance(vertex) < 1.e-8; });
+        AssertThrow(it != support_points.end(),
+                    dealii::ExcMessage("The contour extractor requires a "
+                                       "degree of freedom at every vertex"));
+        vertex_dofs[v] = std::distance(support_points.begin(), it);
+      }
+
+      const auto &partitioner = offline_data.scalar_partitioner();
+
+      indices_.clear();
+      vertices_.clear();
+
+      std::vector<dealii::types::global_dof_index> dof_indices(
+          finite_element.n_dofs_per_cell());
+
+      for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned())
+          continue;
+
+        cell->get_dof_indices(dof_indices);
+        for (unsigned int v = 0; v < n_vertices; ++v) {
+          indices_.push_back(
+              partitioner->global_to_local(dof_indices[vertex_dofs[v]]));
+
+          const auto point = cell->vertex(v);
+          Vertex vertex{};
+          for (unsigned int d = 0; d < dim; ++d)
+            vertex[d] = point[d];
+          vertices_.push_back(vertex);
+        }
+      }
+    }
+
+    /**
+     * Extract the contours of the (ghosted) scalar vector @p values for
+     * all given @p levels and append them to @p soup. The index @p
+     * quantity is recorded for every simplex. The order of the appended
+     * simplices is unspecified.
+     */
+    template <typename VectorType>
+    void extract(Soup &soup,
+                 const VectorType &values,
+                 const std::vector<double> &levels,
+                 const int quantity) const
+    {
+      const unsigned int n_cells = indices_.size() / n_vertices;
+
+      std::vector<Soup> thread_soups(max_threads());
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      auto &thread_soup = thread_soups[thread_number()];
+
+      RYUJIN_OMP_FOR
+      for (unsigned int cell = 0; cell < n_cells; ++cell) {
+        std::array<float, n_vertices> cell_values;
+        for (unsigned int v = 0; v < n_vertices; ++v)
+          cell_values[v] =
+              values.local_element(indices_[cell * n_vertices + v]);
+
+        const auto [min_value, max_value] =
+            std::minmax_element(cell_values.begin(), cell_values.end());
+
+        for (const auto level : levels) {
+          if (level < *min_value || level > *max_value)
+            continue;
+
+          for (const auto &simplex : simplices()) {
+            std::array<float, dim + 1> phi;
+            std::array<Vertex, dim + 1> x;
+            for (unsigned int k = 0; k < dim + 1; ++k) {
+              phi[k] = cell_values[simplex[k]] - level;
+              x[k] = vertices_[cell * n_vertices + simplex[k]];
+            }
+
+            const auto n_points = contour_simplex(thread_soup, phi, x);
+            for (unsigned int k = 0; k < n_points / dim; ++k) {
+              thread_soup.levels.push_back(level);
+              thread_soup.quantities.push_back(quantity);
+            }
+          }
+        }
+      }
+
+      RYUJIN_PARALLEL_REGION_END
+
+      const auto append = [](auto &target, const auto &source) {
+        target.insert(target.end(), source.begin(), source.end());
+      };
+
+      for (const auto &it : thread_soups) {
+        append(soup.points, it.points);
+        append(soup.levels, it.levels);
+        append(soup.quantities, it.quantities);
+      }
+    }
+
+    /**
+     * Write the rank-local @p soup into the file
+     * "<base>_<cycle>.<rank>.vtu" and (on rank 0) a pvtu record
+     * "<base>_<cycle>.pvtu" referencing the files of all ranks.
+     */
+    static void write_vtu(const Soup &soup,
+                          const std::string &base,
+                          const unsigned int cycle,
+                          const MPI_Comm &mpi_communicator)
+    {
+      using dealii::Utilities::to_string;
+
+      const auto rank =
+          dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+      const auto n_ranks =
+          dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+      const auto n_digits = dealii::Utilities::needed_digits(n_ranks);
+
+      const auto file_base = base + "_" + to_string(cycle, 6);
+      const auto piece_name = [&](const unsigned int k) {
+        return file_base + "." + to_string(k, n_digits) + ".vtu";
+      };
+
+      /* VTK_VERTEX, VTK_LINE, and VTK_TRIANGLE: */
+      constexpr int cell_type = dim == 1 ? 1 : (dim == 2 ? 3 : 5);
+
+      std::ofstream output(piece_name(rank));
+      output << "<?xml version=\"1.0\"?>\n"
+             << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" "
+             << "byte_order=\"LittleEndian\">\n"
+             << "<UnstructuredGrid>\n"
+             << "<Piece NumberOfPoints=\"" << soup.points.size()
+             << "\" NumberOfCells=\"" << soup.size() << "\">\n";
+
+      output << "<Points>\n<DataArray type=\"Float32\" "
+             << "NumberOfComponents=\"3\" format=\"ascii\">\n";
+      for (const auto &point : soup.points)
+        output << point[0] << " " << point[1] << " " << point[2] << "\n";
+      output << "</DataArray>\n</Points>\n";
+
+      output << "<Cells>\n"
+             << "<DataArray type=\"Int32\" Name=\"connectivity\" "
+             << "format=\"ascii\">\n";
+      for (std::size_t k = 0; k < soup.points.size(); ++k)
+        output << k << "\n";
+      output << "</DataArray>\n"
+             << "<DataArray type=\"Int32\" Name=\"offsets\" "
+             << "format=\"ascii\">\n";
+      for (std::size_t k = 0; k < soup.size(); ++k)
+        output << dim * (k + 1) << "\n";
+      output << "</DataArray>\n"
+             << "<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">\n";
+      for (std::size_t k = 0; k < soup.size(); ++k)
+        output << cell_type << "\n";
+      output << "</DataArray>\n</Cells>\n";
+
+      output << "<CellData Scalars=\"level\">\n"
+             << "<DataArray type=\"Float32\" Name=\"level\" "
+             << "format=\"ascii\">\n";
+      for (const auto level : soup.levels)
+        output << level << "\n";
+      output << "</DataArray>\n"
+             << "<DataArray type=\"Int32\" Name=\"quantity\" "
+             << "format=\"ascii\">\n";
+      for (const auto quantity : soup.quantities)
+        output << quantity << "\n";
+      output << "</DataArray>\n</CellData>\n"
+             << "</Piece>\n</UnstructuredGrid>\n</VTKFile>\n";
+
+      if (rank != 0)
+        return;
+
+      std::ofstream record(file_base + ".pvtu");
+      record << "<?xml version=\"1.0\"?>\n"
+             << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" "
+             << "byte_order=\"LittleEndian\">\n"
+             << "<PUnstructuredGrid GhostLevel=\"0\">\n"
+             << "<PCellData Scalars=\"level\">\n"
+             << "<PDataArray type=\"Float32\" Name=\"level\"/>\n"
+             << "<PDataArray type=\"Int32\" Name=\"quantity\"/>\n"
+             << "</PCellData>\n"
+             << "<PPoints>\n"
+             << "<PDataArray type=\"Float32\" NumberOfComponents=\"3\"/>\n"
+             << "</PPoints>\n";
+      for (unsigned int k = 0; k < n_ranks; ++k) {
+        /* Pieces are referenced relative to the pvtu record: */
+        const auto piece = piece_name(k);
+        const auto separator = piece.find_last_of('/');
+        record << "<Piece Source=\""
+               << (separator == std::string::npos ? piece
+                                                  : piece.substr(separator + 1))
+               << "\"/>\n";
+      }
+      record << "</PUnstructuredGrid>\n</VTKFile>\n";
+    }
+
+    /**
+     * Return an estimate of the memory consumption in bytes.
+     */
+    std::size_t memory_consumption() const
+    {
+      return indices_.capacity() * sizeof(unsigned int) +
+             vertices_.capacity() * sizeof(Vertex);
+    }
+
+  private:
+    /**
+     * The simplices of the subdivision of a cell given by their vertex
+     * indices in lexicographic (deal.II) vertex numbering.
+     */
+    static const auto &simplices()
+    {
+      if constexpr (dim == 1) {
+        static const std::array<std::array<unsigned int, 2>, 1> result{
+            {{0, 1}}};
+        return result;
+      } else if constexpr (dim == 2) {
+        static const std::array<std::array<unsigned int, 3>, 2> result{
+            {{0, 1, 3}, {0, 2, 3}}};
+        return result;
+      } else {
+        /* All monotone paths from vertex 0 to vertex 7: */
+        static const std::array<std::array<unsigned int, 4>, 6> result{
+            {{0, 1, 3, 7},
+             {0, 1, 5, 7},
+             {0, 2, 3, 7},
+             {0, 2, 6, 7},
+             {0, 4, 5, 7},
+             {0, 4, 6, 7}}};
+        return result;
+      }
+    }
+
+    /**
+     * Contour the linear interpolant of the (shifted) values @p phi on
+     * the simplex with vertices @p x and append the points to @p soup.
+     * The function returns the number of appended points, which is a
+     * multiple of dim.
+     */
+    static unsigned int contour_simplex(Soup &soup,
+                                        const std::array<float, dim + 1> &phi,
+                                        const std::array<Vertex, dim + 1> &x)
+    {
+      const auto crossing = [&](const unsigned int a, const unsigned int b) {
+        const float t = phi[a] / (phi[a] - phi[b]);
+        Vertex result;
+        for (unsigned int d = 0; d < 3; ++d)
+          result[d] = x[a][d] + t * (x[b][d] - x[a][d]);
+        return result;
+      };
+
+      /* Split the vertices by the sign of phi: */
+      std::array<unsigned int, dim + 1> above;
+      std::array<unsigned int, dim + 1> below;
+      unsigned int n_above = 0;
+      unsigned int n_below = 0;
+      for (unsigned int k = 0; k < dim + 1; ++k)
+        if (phi[k] >= 0.f)
+          above[n_above++] = k;
+        else
+          below[n_below++] = k;
+
+      if (n_above == 0 || n_below == 0)
+        return 0;
+
+      if constexpr (dim == 1 || dim == 2) {
+        /* A point (1D), or a line segment (2D): */
+        const auto &single = n_above == 1 ? above : below;
+        const auto &other = n_above == 1 ? below : above;
+        for (unsigned int k = 0; k < dim; ++k)
+          soup.points.push_back(crossing(single[0], other[k]));
+        return dim;
+
+      } else {
+        if (n_above == 1 || n_below == 1) {
+          /* A single triangle: */
+          const auto &single = n_above == 1 ? above : below;
+          const auto &other = n_above == 1 ? below : above;
+          for (unsigned int k = 0; k < 3; ++k)
+            soup.points.push_back(crossing(single[0], other[k]));
+          return 3;
+        }
+
+        /* A quadrilateral, split into two triangles: */
+        const auto p_00 = crossing(above[0], below[0]);
+        const auto p_01 = crossing(above[0], below[1]);
+        const auto p_11 = crossing(above[1], below[1]);
+        const auto p_10 = crossing(above[1], below[0]);
+        soup.points.insert(soup.points.end(), {p_00, p_01, p_11});
+        soup.points.insert(soup.points.end(), {p_00, p_11, p_10});
+        return 6;
+      }
+    }
+
+    std::vector<unsigned int> indices_;
+    std::vector<Vertex> vertices_;
+  };
+} // namespace ryujin
@@ -1,18 +1,35 @@
 //
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
-// Copyright (C) 2020 - 2021 by the ryujin authors
+// Copyright (C) 2020 - 2024 by the ryujin authors
 //
 
 #pragma once
 
-#ifdef DEAL_II_WITH_GSL
-#include <gsl/gsl_spline.h>
+#include "simd.h"
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/vectorization.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <vector>
 
 namespace ryujin
 {
   /**
-   * A cubic spline class implemented as a thin wrapper around the GSL
-   * spline library functions.
+   * A natural cubic spline (vanishing second derivative at both end
+   * points) through a given set of support points.
+   *
+   * The spline coefficients are computed once in the constructor. All
+   * evaluation functions are const and thread-safe and can be inlined.
+   * The interval containing an evaluation point is found in constant
+   * time if the support points are (up to roundoff) equidistant, and by
+   * a binary search otherwise. The spline can be evaluated for scalar
+   * and vectorized (dealii::VectorizedArray) arguments, as well as for a
+   * batch of points at once.
    *
    * Usage:
    * @code
@@ -32,63 +49,183 @@ namespace ryujin
      * Constructor.
      *
      * @pre The supplied vectors @p x and @p y must have the same size and
-     * must contain at least two elements. The vector @p x must be sorted
+     * must contain at least two elements. The vector @p x must be
+     * strictly increasing.
      */
-    CubicSpline(const std::vector<double> &x,
-                const std::vector<double> &y) noexcept
-        : x_(x)
-        , y_(y)
-    {
-      AssertNothrow(x_.size() == y_.size(), dealii::ExcInternalError());
-      AssertNothrow(x_.size() >= 2, dealii::ExcInternalError());
-      AssertNothrow(std::is_sorted(x_.begin(), x_.end()),
-                    dealii::ExcInternalError());
-
-      spline = gsl_spline_alloc(gsl_interp_cspline, x_.size());
-      gsl_spline_init(spline, x_.data(), y_.data(), x_.size());
-
-      accel = gsl_interp_accel_alloc();
-    }
+    CubicSpline(const std::vector<double> &x, const std::vector<double> &y);
 
     /**
-     * Copy constructor.
+     * Evaluate the cubic spline at a given point @p x.
+     *
+     * @pre The point @p x must lie within the interval described by the
+     * largest and smallest support point supplied to the constructor.
+     * Points outside are extrapolated with the polynomial of the first
+     * or last interval.
      */
-    CubicSpline(const CubicSpline &copy)
-        : CubicSpline(copy.x_, copy.y_)
-    {
-    }
+    double eval(const double x) const;
 
     /**
-     * The copy assignment operator is deleted.
+     * Evaluate the cubic spline for all lanes of a vectorized argument
+     * @p x. The interval lookup is performed lane by lane, the
+     * evaluation of the polynomial is vectorized.
      */
-    CubicSpline &operator=(const CubicSpline &) = delete;
+    template <typename Number>
+    VectorizedArray<Number> eval(const VectorizedArray<Number> &x) const;
 
     /**
-     * Destructor.
+     * Evaluate the cubic spline for all points in @p x and store the
+     * results in @p y.
+     *
+     * @pre @p x and @p y must have the same size.
      */
-    ~CubicSpline()
-    {
-      gsl_interp_accel_free(accel);
-      gsl_spline_free(spline);
-    }
+    void eval(const dealii::ArrayView<const double> &x,
+              const dealii::ArrayView<double> &y) const;
 
+  private:
     /**
-     * Evaluate the cubic spline at a given point @p x.
-     *
-     * @pre The point @p x must lie within the interval described by the
-     * largest and smallest support point supplied to the constructor.
+     * Return the index of the interval [x_i, x_{i+1}] containing @p x.
      */
-    inline double eval(double x) const
-    {
-      return gsl_spline_eval(spline, x, accel);
-    }
+    unsigned int interval(const double x) const;
 
-  private:
-    const std::vector<double> x_;
-    const std::vector<double> y_;
-    gsl_spline *spline;
-    mutable gsl_interp_accel *accel;
+    std::vector<double> x_;
+
+    /**
+     * The coefficients of the polynomial y_i + b_i t + c_i t^2 + d_i t^3
+     * (with t = x - x_i) on every interval.
+     */
+    std::vector<std::array<double, 4>> coefficients_;
+
+    bool uniform_;
+    double h_inverse_;
   };
-} // namespace ryujin
 
-#endif
+
+  // ------------------------------- inline functions --------------------------
+
+
+  inline CubicSpline::CubicSpline(const std::vector<double> &x,
+                                  const std::vector<double> &y)
+      : x_(x)
+  {
+    AssertThrow(x.size() == y.size(), dealii::ExcInternalError());
+    AssertThrow(x.size() >= 2, dealii::ExcInternalError());
+    AssertThrow(std::adjacent_find(
+                    x.begin(), x.end(), std::greater_equal<>()) == x.end(),
+                dealii::ExcMessage("CubicSpline: support points must be "
+                                   "strictly increasing"));
+
+    const auto n = x.size();
+
+    std::vector<double> h(n - 1);
+    for (std::size_t i = 0; i + 1 < n; ++i)
+      h[i] = x[i + 1] - x[i];
+
+    /*
+     * Solve the tridiagonal system for the coefficients c_i (half of the
+     * second derivative) with the Thomas algorithm. The natural boundary
+     * conditions set c_0 = c_{n-1} = 0:
+     */
+
+    std::vector<double> c(n, 0.);
+    if (n > 2) {
+      std::vector<double> diagonal(n - 2);
+      std::vector<double> rhs(n - 2);
+      for (std::size_t i = 1; i + 1 < n; ++i) {
+        diagonal[i - 1] = 2. * (h[i - 1] + h[i]);
+        rhs[i - 1] = 3. * ((y[i + 1] - y[i]) / h[i] -
+                           (y[i] - y[i - 1]) / h[i - 1]);
+      }
+
+      for (std::size_t k = 1; k < n - 2; ++k) {
+        const double factor = h[k] / diagonal[k - 1];
+        diagonal[k] -= factor * h[k];
+        rhs[k] -= factor * rhs[k - 1];
+      }
+
+      c[n - 2] = rhs[n - 3] / diagonal[n - 3];
+      for (std::size_t k = n - 3; k-- > 0;)
+        c[k + 1] = (rhs[k] - h[k + 1] * c[k + 2]) / diagonal[k];
+    }
+
+    coefficients_.resize(n - 1);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+      const double b =
+          (y[i + 1] - y[i]) / h[i] - h[i] * (c[i + 1] + 2. * c[i]) / 3.;
+      const double d = (c[i + 1] - c[i]) / (3. * h[i]);
+      coefficients_[i] = {y[i], b, c[i], d};
+    }
+
+    /* Check for equidistant support points: */
+    const double h_average = (x.back() - x.front()) / double(n - 1);
+    uniform_ = std::all_of(h.begin(), h.end(), [&](const double h_i) {
+      return std::abs(h_i - h_average) <= 1.e-12 * h_average;
+    });
+    h_inverse_ = 1. / h_average;
+  }
+
+
+  inline unsigned int CubicSpline::interval(const double x) const
+  {
+    const unsigned int n_intervals = coefficients_.size();
+
+    if (uniform_) {
+      const double position = (x - x_.front()) * h_inverse_;
+      if (!(position > 0.))
+        return 0;
+      return std::min(static_cast<unsigned int>(position), n_intervals - 1);
+    }
+
+    const auto it = std::upper_bound(x_.begin() + 1, x_.end() - 1, x);
+    return std::distance(x_.begin(), it) - 1;
+  }
+
+
+  inline double CubicSpline::eval(const double x) const
+  {
+    const auto i = interval(x);
+    const auto &[a, b, c, d] = coefficients_[i];
+    const double t = x - x_[i];
+    return a + t * (b + t * (c + t * d));
+  }
+
+
+  template <typename Number>
+  inline VectorizedArray<Number>
+  CubicSpline::eval(const VectorizedArray<Number> &x) const
+  {
+    using VA = VectorizedArray<Number>;
+
+    VA a, b, c, d, x_i;
+    for (unsigned int k = 0; k < VA::size(); ++k) {
+      const auto i = interval(x[k]);
+      const auto &coefficients = coefficients_[i];
+      a[k] = coefficients[0];
+      b[k] = coefficients[1];
+      c[k] = coefficients[2];
+      d[k] = coefficients[3];
+      x_i[k] = x_[i];
+    }
+
+    const VA t = x - x_i;
+    return a + t * (b + t * (c + t * d));
+  }
+
+
+  inline void CubicSpline::eval(const dealii::ArrayView<const double> &x,
+                                const dealii::ArrayView<double> &y) const
+  {
+    AssertDimension(x.size(), y.size());
+
+    using VA = VectorizedArray<double>;
+    constexpr unsigned int width = VA::size();
+
+    std::size_t i = 0;
+    for (; i + width <= x.size(); i += width) {
+      VA x_simd;
+      x_simd.load(x.data() + i);
+      eval(x_simd).store(y.data() + i);
+    }
+    for (; i < x.size(); ++i)
+      y[i] = eval(x[i]);
+  }
+} // namespace ryujin
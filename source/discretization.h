@@ -17,6 +17,7 @@
 #include <deal.II/distributed/tria.h>
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/mapping.h>
+#include <deal.II/fe/mapping_q_cache.h>
 
 #include <memory>
 #include <set>
@@ -230,6 +231,18 @@ namespace ryujin
      */
     void prepare(const std::string &base_name);
 
+    /**
+     * If the "mapping cache" option is set, (re)compute a
+     * dealii::MappingQCache of the mapping for all cells of the current
+     * triangulation. Afterwards, mapping() returns the cached mapping
+     * that evaluates the (possibly curved) manifolds only once per mesh.
+     *
+     * @note The function has to be called again after every change of the
+     * triangulation, for example after mesh adaptation. prepare() resets
+     * the cache.
+     */
+    void update_mapping_cache();
+
     /**
      * @name Accessors to data structures managed by this class.
      */
@@ -285,9 +298,15 @@ namespace ryujin
     ACCESSOR_READ_ONLY(triangulation)
 
     /**
-     * Return a read-only const reference to the mapping.
+     * Return a read-only const reference to the mapping. This is the
+     * cached mapping if update_mapping_cache() has been called.
      */
-    ACCESSOR_READ_ONLY(mapping)
+    const dealii::Mapping<dim> &mapping() const
+    {
+      if (mapping_cache_)
+        return *mapping_cache_;
+      return *mapping_;
+    }
 
     /**
      * Return a read-only const reference to the finite element.
@@ -320,6 +339,7 @@ namespace ryujin
 
     std::unique_ptr<Triangulation> triangulation_;
     std::unique_ptr<const dealii::Mapping<dim>> mapping_;
+    std::unique_ptr<dealii::MappingQCache<dim>> mapping_cache_;
     std::unique_ptr<const dealii::FiniteElement<dim>> finite_element_;
     std::unique_ptr<const dealii::Quadrature<dim>> quadrature_;
     std::unique_ptr<const dealii::Quadrature<1>> quadrature_1d_;
@@ -342,6 +362,10 @@ namespace ryujin
     bool mesh_writeout_;
     double mesh_distortion_;
 
+    std::string mesh_cache_;
+
+    bool use_mapping_cache_;
+
     //@}
     /**
      * @name Internal data:
@@ -16,6 +16,7 @@
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/grid/grid_out.h>
 
+#include <filesystem>
 #include <random>
 
 namespace ryujin
@@ -74,6 +75,22 @@ namespace ryujin
     add_parameter(
         "mesh distortion", mesh_distortion_, "Strength of mesh distortion");
 
+    mesh_cache_ = "";
+    add_parameter("mesh cache",
+                  mesh_cache_,
+                  "If set to a nonempty file name, store the globally refined "
+                  "mesh in this file and reuse it on subsequent runs instead "
+                  "of refining the coarse mesh again. The cache is not "
+                  "invalidated when geometry parameters change.");
+
+    use_mapping_cache_ = false;
+    add_parameter("mapping cache",
+                  use_mapping_cache_,
+                  "If set to true, the support points of the (higher order) "
+                  "mapping are computed once per mesh and stored in a "
+                  "MappingQCache. This avoids repeated queries of curved "
+                  "manifolds during assembly, postprocessing and output.");
+
     Geometries::populate_geometry_list<dim>(geometry_list_, subsection);
   }
 
@@ -85,6 +102,8 @@ namespace ryujin
     std::cout << "Discretization<dim>::prepare()" << std::endl;
 #endif
 
+    mapping_cache_.reset();
+
     auto &triangulation = *triangulation_;
     triangulation.clear();
 
@@ -117,7 +136,42 @@ namespace ryujin
 #endif
     }
 
-    triangulation.refine_global(refinement_);
+    /*
+     * Global refinement happens in the distributed triangulation, i.e.,
+     * every rank only refines (and places new vertices with the help of
+     * the attached manifolds for) its locally relevant cells. If a mesh
+     * cache is requested we store the refinement forest and recreate the
+     * final mesh in one go, instead of refining and repartitioning
+     * level by level.
+     */
+
+    if constexpr (have_distributed_triangulation<dim>) {
+      const unsigned int n_coarse_levels = triangulation.n_global_levels();
+      const std::string info_file_name = mesh_cache_ + ".info";
+
+      /* Only use the cache if it is available on all ranks: */
+      const unsigned int available =
+          !mesh_cache_.empty() && std::filesystem::exists(info_file_name);
+
+      if (Utilities::MPI::min(available, mpi_communicator_) != 0) {
+        triangulation.load(mesh_cache_);
+        AssertThrow(triangulation.n_global_levels() ==
+                        n_coarse_levels + refinement_,
+                    ExcMessage("Mesh cache file \"" + mesh_cache_ +
+                               "\" does not match the current mesh "
+                               "refinement"));
+      } else {
+        triangulation.refine_global(refinement_);
+        if (!mesh_cache_.empty())
+          triangulation.save(mesh_cache_);
+      }
+
+    } else {
+      AssertThrow(mesh_cache_.empty(),
+                  ExcMessage("A mesh cache is only supported for "
+                             "distributed triangulations (dim > 1)"));
+      triangulation.refine_global(refinement_);
+    }
 
     if (std::abs(mesh_distortion_) > 1.0e-10)
       GridTools::distort_random(
@@ -191,4 +245,23 @@ namespace ryujin
     }
   }
 
+
+  template <int dim>
+  void Discretization<dim>::update_mapping_cache()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "Discretization<dim>::update_mapping_cache()" << std::endl;
+#endif
+
+    if (!use_mapping_cache_)
+      return;
+
+    const auto &mapping = dynamic_cast<const MappingQ<dim> &>(*mapping_);
+    if (!mapping_cache_)
+      mapping_cache_ =
+          std::make_unique<MappingQCache<dim>>(mapping.get_degree());
+
+    mapping_cache_->initialize(mapping, *triangulation_);
+  }
+
 } /* namespace ryujin */
@@ -0,0 +1,184 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * Node energy counters read from the Linux sysfs interface.
+   *
+   * initialize() selects one MPI rank per node (the first rank of the
+   * node local communicator) that samples the energy counters of the
+   * node. Supported are the Cray PM counters (/sys/cray/pm_counters,
+   * which account for the whole node) and, as a fallback, the package
+   * domains of the Intel/AMD RAPL powercap interface
+   * (/sys/class/powercap/intel-rapl:N). The latter do not include DRAM
+   * and other node components. GPU counters (NVML) are not supported.
+   *
+   * energy() returns the energy in Joules consumed by the node since
+   * initialize() on the sampling rank, and zero on all other ranks, so
+   * that the sum over all ranks is the energy to solution of the job.
+   *
+   * @note RAPL counters wrap around (depending on the hardware after a
+   * couple of minutes at full load). A wrap around is detected by
+   * comparing with the previous sample, i.e., energy() has to be called
+   * at least once per wrap around interval.
+   *
+   * @ingroup Miscellaneous
+   */
+  class EnergyCounters
+  {
+  public:
+    /**
+     * Return a reference to the (sole) instance.
+     */
+    static EnergyCounters &instance()
+    {
+      static EnergyCounters energy_counters;
+      return energy_counters;
+    }
+
+    /**
+     * Select the sampling rank of every node and open the counters.
+     * This function is collective over @p mpi_communicator. Returns true
+     * if counters are available on all nodes.
+     */
+    bool initialize(const MPI_Comm &mpi_communicator)
+    {
+      domains_.clear();
+      energy_ = 0.;
+
+      bool sampling_rank = true;
+#ifdef DEAL_II_WITH_MPI
+      MPI_Comm comm_node;
+      int ierr = MPI_Comm_split_type(mpi_communicator,
+                                     MPI_COMM_TYPE_SHARED,
+                                     0,
+                                     MPI_INFO_NULL,
+                                     &comm_node);
+      AssertThrowMPI(ierr);
+      sampling_rank = dealii::Utilities::MPI::this_mpi_process(comm_node) == 0;
+      ierr = MPI_Comm_free(&comm_node);
+      AssertThrowMPI(ierr);
+#endif
+
+      if (sampling_rank)
+        find_domains();
+
+      const bool available = domains_.size() > 0 || !sampling_rank;
+      active_ = dealii::Utilities::MPI::min(available ? 1 : 0,
+                                            mpi_communicator) == 1;
+      if (!active_)
+        domains_.clear();
+
+      for (auto &domain : domains_)
+        domain.last_sample = read_counter(domain);
+
+      return active_;
+    }
+
+    /**
+     * Return true if energy is recorded.
+     */
+    bool active() const
+    {
+      return active_;
+    }
+
+    /**
+     * Sample the counters and return the energy (in Joules) consumed
+     * since initialize(). Returns zero on all but the sampling rank of
+     * every node.
+     */
+    double energy()
+    {
+      for (auto &domain : domains_) {
+        const auto sample = read_counter(domain);
+        std::uint64_t increment = sample - domain.last_sample;
+        if (sample < domain.last_sample)
+          increment = domain.range - domain.last_sample + sample;
+        domain.last_sample = sample;
+        energy_ += double(increment) * domain.unit;
+      }
+      return energy_;
+    }
+
+    EnergyCounters(const EnergyCounters &) = delete;
+    EnergyCounters &operator=(const EnergyCounters &) = delete;
+
+  private:
+    EnergyCounters() = default;
+
+    struct Domain {
+      std::string file;
+      double unit;         /* Joules per counter increment */
+      std::uint64_t range; /* wrap around value */
+      std::uint64_t last_sample;
+    };
+
+    void find_domains()
+    {
+      namespace fs = std::filesystem;
+      std::error_code ec;
+
+      /* Cray PM counters are given in Joules ("<value> J"): */
+      if (fs::exists("/sys/cray/pm_counters/energy", ec)) {
+        Domain domain{"/sys/cray/pm_counters/energy", 1., UINT64_MAX, 0};
+        if (readable(domain)) {
+          domains_.push_back(domain);
+          return;
+        }
+      }
+
+      /* Top-level RAPL package domains in microjoules: */
+      const fs::path powercap("/sys/class/powercap");
+      if (!fs::is_directory(powercap, ec))
+        return;
+
+      for (const auto &entry : fs::directory_iterator(powercap, ec)) {
+        const auto name = entry.path().filename().string();
+        if (name.rfind("intel-rapl:", 0) != 0 ||
+            name.find(':', 11) != std::string::npos)
+          continue;
+
+        Domain domain{(entry.path() / "energy_uj").string(), 1.e-6, 0, 0};
+        std::ifstream range_file(entry.path() / "max_energy_range_uj");
+        if (!(range_file >> domain.range) || !readable(domain))
+          continue;
+        domains_.push_back(domain);
+      }
+    }
+
+    static std::uint64_t read_counter(const Domain &domain)
+    {
+      std::ifstream file(domain.file);
+      std::uint64_t value = 0;
+      file >> value;
+      return value;
+    }
+
+    static bool readable(const Domain &domain)
+    {
+      std::ifstream file(domain.file);
+      std::uint64_t value;
+      return bool(file >> value);
+    }
+
+    bool active_ = false;
+    double energy_ = 0.;
+    std::vector<Domain> domains_;
+  };
+} // namespace ryujin
@@ -15,6 +15,7 @@
 #include <boost/signals2.hpp>
 
 #include <string>
+#include <type_traits>
 
 namespace ryujin
 {
@@ -24,6 +25,16 @@ namespace ryujin
   inline const std::string dave =
       "\nDave, this conversation can serve no purpose anymore. Goodbye.\n\n";
 
+  /**
+   * Return the name of the floating point type @p Number as used for the
+   * "precision" parameter of the EquationDispatch class.
+   */
+  template <typename Number>
+  inline std::string precision_name()
+  {
+    return std::is_same_v<Number, float> ? "float" : "double";
+  }
+
   /**
    * Dispatcher class that calls into the right TimeLoop for a configured
    * equation depending on what has been set in the parameter file.
@@ -40,6 +51,23 @@ namespace ryujin
       add_parameter("dimension", dimension_, "The spatial dimension");
       add_parameter("equation", equation_, "The PDE system");
 
+      precision_ = precision_name<NUMBER>();
+      add_parameter("precision",
+                    precision_,
+                    "The floating point type, either \"double\" or "
+                    "\"float\". Only the compile-time default (NUMBER) is "
+                    "available unless ryujin was configured with "
+                    "RUNTIME_PRECISION");
+
+      n_time_slices_ = 1;
+      add_parameter(
+          "parallel in time slices",
+          n_time_slices_,
+          "Experimental: If set to a value N larger than one, the MPI ranks "
+          "are split into N groups of equal size. Every group computes one "
+          "slice of the time interval [0, final time] and the slices are "
+          "coupled with the Parareal algorithm, see TimeLoop::run()");
+
       time_loop_executed_ = false;
     }
 
@@ -72,9 +100,12 @@ namespace ryujin
 
 
     /**
-     * Call dispatch() for all registered equations.
+     * Call dispatch() for all registered equations. If @p dry_run is set
+     * then TimeLoop::dry_run() is called instead of TimeLoop::run().
      */
-    void dispatch(const std::string &parameter_file, const MPI_Comm &mpi_comm)
+    void dispatch(const std::string &parameter_file,
+                  const MPI_Comm &mpi_comm,
+                  const bool dry_run = false)
     {
       ParameterAcceptor::prm.parse_input(parameter_file,
                                          "",
@@ -92,14 +123,58 @@ namespace ryujin
                       dave + "No equation has been registered. Consequently, "
                              "there is nothing for us to do.\n"));
 
-      signals->dispatch(
-          dimension_, equation_, parameter_file, mpi_comm, time_loop_executed_);
+      /*
+       * Parallel in time mode: Split the ranks into contiguous groups, one
+       * group per time slice. The time communicator connects the ranks
+       * with the same rank within their group; its rank is the index of
+       * the time slice.
+       */
+
+      const unsigned int n_ranks =
+          dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+      AssertThrow(n_time_slices_ >= 1 && n_ranks % n_time_slices_ == 0,
+                  dealii::ExcMessage(
+                      dave + "The number of MPI ranks must be a multiple of "
+                             "the number of parallel in time slices.\n"));
+
+      MPI_Comm space_comm = mpi_comm;
+      MPI_Comm time_comm = MPI_COMM_SELF;
+#ifdef DEAL_II_WITH_MPI
+      if (n_time_slices_ > 1) {
+        const int rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+        const int group_size = n_ranks / n_time_slices_;
+        int ierr =
+            MPI_Comm_split(mpi_comm, rank / group_size, rank, &space_comm);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Comm_split(mpi_comm, rank % group_size, rank, &time_comm);
+        AssertThrowMPI(ierr);
+      }
+#endif
+
+      signals->dispatch(dimension_,
+                        equation_,
+                        precision_,
+                        parameter_file,
+                        space_comm,
+                        time_comm,
+                        dry_run,
+                        time_loop_executed_);
+
+#ifdef DEAL_II_WITH_MPI
+      if (n_time_slices_ > 1) {
+        int ierr = MPI_Comm_free(&space_comm);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Comm_free(&time_comm);
+        AssertThrowMPI(ierr);
+      }
+#endif
 
       AssertThrow(time_loop_executed_ == true,
                   dealii::ExcMessage(dave +
                                      "No equation was dispatched "
                                      "with the chosen equation parameter »" +
-                                     equation_ + "«.\n"));
+                                     equation_ + "« and precision »" +
+                                     precision_ + "«.\n"));
     }
 
 
@@ -131,8 +206,11 @@ namespace ryujin
 
       boost::signals2::signal<void(int /*dimension*/,
                                    const std::string & /*equation*/,
+                                   const std::string & /*precision*/,
                                    const std::string & /*parameter file*/,
                                    const MPI_Comm & /*MPI communicator*/,
+                                   const MPI_Comm & /*time communicator*/,
+                                   bool /*dry run*/,
                                    bool & /*time loop executed*/)>
           dispatch;
     };
@@ -152,6 +230,8 @@ namespace ryujin
 
     int dimension_;
     std::string equation_;
+    std::string precision_;
+    unsigned int n_time_slices_;
 
     //@}
 
@@ -241,24 +321,34 @@ namespace ryujin
                 << "«" << std::endl;
 #endif
 
-      EquationDispatch::register_create_parameter_files([name]() {
-        create_prm_files<Description, 1, Number>(name, false);
-        create_prm_files<Description, 2, Number>(name, true);
-        create_prm_files<Description, 3, Number>(name, false);
-      });
+      /*
+       * Default parameter files are only written for the compile-time
+       * default floating point type:
+       */
+      if constexpr (std::is_same_v<Number, NUMBER>) {
+        EquationDispatch::register_create_parameter_files([name]() {
+          create_prm_files<Description, 1, Number>(name, false);
+          create_prm_files<Description, 2, Number>(name, true);
+          create_prm_files<Description, 3, Number>(name, false);
+        });
+      }
 
       EquationDispatch::register_dispatch(
           [name](const int dimension,
                  const std::string &equation,
+                 const std::string &precision,
                  const std::string &parameter_file,
                  const MPI_Comm &mpi_comm,
+                 const MPI_Comm &time_comm,
+                 const bool dry_run,
                  bool &time_loop_executed) {
-            if (equation != name)
+            if (equation != name || precision != precision_name<Number>())
               return;
 
             if (dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0) {
               std::cout << "[INFO] dispatching to driver »" << equation
-                        << "« with dim=" << dimension << std::endl;
+                        << "« with dim=" << dimension
+                        << " and precision=" << precision << std::endl;
             }
 
             AssertThrow(time_loop_executed == false,
@@ -269,19 +359,28 @@ namespace ryujin
                             equation + "«"));
 
             if (dimension == 1) {
-              TimeLoop<Description, 1, Number> time_loop(mpi_comm);
+              TimeLoop<Description, 1, Number> time_loop(mpi_comm, time_comm);
               dealii::ParameterAcceptor::initialize(parameter_file);
-              time_loop.run();
+              if (dry_run)
+                time_loop.dry_run();
+              else
+                time_loop.run();
               time_loop_executed = true;
             } else if (dimension == 2) {
-              TimeLoop<Description, 2, Number> time_loop(mpi_comm);
+              TimeLoop<Description, 2, Number> time_loop(mpi_comm, time_comm);
               dealii::ParameterAcceptor::initialize(parameter_file);
-              time_loop.run();
+              if (dry_run)
+                time_loop.dry_run();
+              else
+                time_loop.run();
               time_loop_executed = true;
             } else if (dimension == 3) {
-              TimeLoop<Description, 3, Number> time_loop(mpi_comm);
+              TimeLoop<Description, 3, Number> time_loop(mpi_comm, time_comm);
               dealii::ParameterAcceptor::initialize(parameter_file);
-              time_loop.run();
+              if (dry_run)
+                time_loop.dry_run();
+              else
+                time_loop.run();
               time_loop_executed = true;
             }
           });
@@ -13,5 +13,9 @@ namespace ryujin
   namespace Euler
   {
     Dispatch<Description, NUMBER> dispatch_instance("euler");
+#ifdef RUNTIME_PRECISION
+    Dispatch<Description, ALTERNATIVE_NUMBER>
+        alternative_dispatch_instance("euler");
+#endif
   } // namespace Euler
 } // namespace ryujin
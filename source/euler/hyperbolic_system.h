@@ -73,6 +73,10 @@ namespace ryujin
       double vacuum_state_relaxation_small_;
       double vacuum_state_relaxation_large_;
 
+      dealii::Tensor<1, 3, double> body_force_;
+      double heating_;
+      bool nodal_sources_enabled_;
+
       double gamma_inverse_;
       double gamma_minus_one_inverse_;
       double gamma_minus_one_over_gamma_plus_one_;
@@ -154,6 +158,25 @@ namespace ryujin
         return hyperbolic_system_.vacuum_state_relaxation_large_;
       }
 
+      DEAL_II_ALWAYS_INLINE inline ScalarNumber heating() const
+      {
+        return hyperbolic_system_.heating_;
+      }
+
+      DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, dim, ScalarNumber>
+      body_force() const
+      {
+        dealii::Tensor<1, dim, ScalarNumber> result;
+        for (unsigned int d = 0; d < dim; ++d)
+          result[d] = hyperbolic_system_.body_force_[d];
+        return result;
+      }
+
+      DEAL_II_ALWAYS_INLINE inline bool nodal_sources_enabled() const
+      {
+        return hyperbolic_system_.nodal_sources_enabled_;
+      }
+
       //@}
       /**
        * @name Access to cached inverses
@@ -333,6 +356,17 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 1;
 
+      /**
+       * Return true if the precomputed values of precomputation cycle
+       * @p cycle are a pointwise function of the state, so that they can
+       * be evaluated on ghost degrees of freedom instead of being
+       * exchanged. This holds for the specific and Harten entropies.
+       */
+      static constexpr bool pointwise_precomputation(const unsigned int cycle)
+      {
+        return cycle == 0;
+      }
+
       /**
        * Step 0: precompute values for hyperbolic update. This routine is
        * called within our usual loop() idiom in HyperbolicModule
@@ -438,6 +472,14 @@ namespace ryujin
        */
       state_type harten_entropy_derivative(const state_type &U) const;
 
+      /**
+       * Variant of above function that takes the (precomputed) Harten
+       * entropy @p eta of the state @p U as an additional argument. The
+       * derivative is then computed without evaluating a power function.
+       */
+      state_type harten_entropy_derivative(const state_type &U,
+                                           const Number &eta) const;
+
       /**
        * For a given (2+dim dimensional) state vector <code>U</code>, compute
        * and return the entropy \f$\eta = p^{1/\gamma}\f$.
@@ -583,18 +625,37 @@ namespace ryujin
        */
       //@{
 
-      /** We do not have source terms: */
-      static constexpr bool have_source_terms = false;
+      /**
+       * We have (optional) source terms: a constant body force
+       * \f$\mathbf g\f$ per unit mass and a constant volumetric heat
+       * source \f$q\f$, i.e.,
+       * \f{align}
+       *   \mathbf S(\mathbf U) = \big[0,\;\rho\,\mathbf g,\;
+       *   \mathbf m\cdot\mathbf g + q\big]^T.
+       * \f}
+       * The source terms are disabled at run time (see
+       * nodal_sources_enabled()) if both "body force" and "heating" are
+       * zero.
+       */
+      static constexpr bool have_source_terms = true;
+
+      /** We do not have source terms treated with an operator split */
+      static constexpr bool have_split_source_terms = false;
+
+      /**
+       * Evaluate the source term for the state @p U.
+       */
+      state_type constant_source(const state_type &U) const;
 
       state_type nodal_source(const PrecomputedVector &pv,
                               const unsigned int i,
                               const state_type &U_i,
-                              const ScalarNumber tau) const = delete;
+                              const ScalarNumber tau) const;
 
       state_type nodal_source(const PrecomputedVector &pv,
                               const unsigned int *js,
                               const state_type &U_j,
-                              const ScalarNumber tau) const = delete;
+                              const ScalarNumber tau) const;
 
       //@}
       /**
@@ -683,6 +744,27 @@ namespace ryujin
                     vacuum_state_relaxation_large_,
                     "Problem specific vacuum relaxation parameter");
 
+      body_force_ = dealii::Tensor<1, 3, double>();
+      add_parameter("body force",
+                    body_force_,
+                    "Constant body force per unit mass, for example "
+                    "gravitational acceleration. Only the first dim "
+                    "components are used");
+
+      heating_ = 0.;
+      add_parameter("heating",
+                    heating_,
+                    "Constant volumetric heat source (energy per unit volume "
+                    "and time)");
+
+      const auto check_nodal_sources = [this] {
+        nodal_sources_enabled_ = body_force_.norm() != 0. || heating_ != 0.;
+      };
+
+      check_nodal_sources();
+      ParameterAcceptor::parse_parameters_call_back.connect(
+          check_nodal_sources);
+
       /*
        * Precompute a number of derived gamma coefficients that contain
        * divisions:
@@ -902,6 +984,35 @@ namespace ryujin
     }
 
 
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::harten_entropy_derivative(
+        const state_type &U, const Number &eta) const -> state_type
+    {
+      /*
+       * Same as above, but we use that
+       *   (rho^2 e) ^ -gamma/(gamma+1) = eta / (rho^2 e)
+       */
+
+      const Number rho = density(U);
+      const auto m = momentum(U);
+      const Number E = total_energy(U);
+
+      const Number rho_rho_e = rho * E - ScalarNumber(0.5) * m.norm_square();
+
+      const auto factor = gamma_plus_one_inverse() * eta / rho_rho_e;
+
+      state_type result;
+
+      result[0] = factor * E;
+      for (unsigned int i = 0; i < dim; ++i)
+        result[1 + i] = -factor * m[i];
+      result[dim + 1] = factor * rho;
+
+      return result;
+    }
+
+
     template <int dim, typename Number>
     DEAL_II_ALWAYS_INLINE inline Number
     HyperbolicSystemView<dim, Number>::mathematical_entropy(
@@ -1304,5 +1415,49 @@ namespace ryujin
       return result;
     }
 
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::constant_source(
+        const state_type &U) const -> state_type
+    {
+      const auto rho = density(U);
+      const auto m = momentum(U);
+      const auto g = body_force();
+
+      state_type result;
+      for (unsigned int d = 0; d < dim; ++d) {
+        result[1 + d] = g[d] * rho;
+        result[dim + 1] += g[d] * m[d];
+      }
+      result[dim + 1] += Number(heating());
+
+      return result;
+    }
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::nodal_source(
+        const PrecomputedVector & /*pv*/,
+        const unsigned int /*i*/,
+        const state_type &U_i,
+        const ScalarNumber /*tau*/) const -> state_type
+    {
+      return constant_source(U_i);
+    }
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::nodal_source(
+        const PrecomputedVector & /*pv*/,
+        const unsigned int * /*js*/,
+        const state_type &U_j,
+        const ScalarNumber /*tau*/) const -> state_type
+    {
+      return constant_source(U_j);
+    }
   } // namespace Euler
 } // namespace ryujin
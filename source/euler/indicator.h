@@ -199,7 +199,7 @@ namespace ryujin
       rho_i_inverse = Number(1.) / rho_i;
       eta_i = new_eta_i;
 
-      d_eta_i = view.harten_entropy_derivative(U_i);
+      d_eta_i = view.harten_entropy_derivative(U_i, eta_i);
       d_eta_i[0] -= eta_i * rho_i_inverse;
       f_i = view.f(U_i);
 
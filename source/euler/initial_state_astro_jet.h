@@ -72,6 +72,11 @@ namespace ryujin
         convert_states();
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number /*t*/) final
       {
         return (point[0] < 1.e-12 && std::abs(point[1]) <= jet_width_
@@ -188,6 +188,11 @@ namespace ryujin
         });
       }
 
+      bool is_thread_safe() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number t) final
       {
         const auto view = hyperbolic_system_.template view<dim, Number>();
@@ -60,6 +60,11 @@ namespace ryujin
         convert_states();
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number /*t*/) final
       {
         return (point[0] > 0. ? state_right_ : state_left_);
@@ -91,6 +91,11 @@ namespace ryujin
         convert_states();
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number /*t*/) final
       {
         if constexpr (dim == 1) {
@@ -5,10 +5,9 @@
 
 #pragma once
 
+#include <expression_function.h>
 #include <initial_state_library.h>
 
-#include <deal.II/base/function_parser.h>
-
 namespace ryujin
 {
   namespace EulerInitialStates
@@ -65,28 +64,46 @@ namespace ryujin
                             pressure_expression_,
                             "A function expression describing the pressure");
 
+        time_independent_ = false;
+        this->add_parameter(
+            "time independent",
+            time_independent_,
+            "Set to true if the function expressions do not depend on time "
+            "t. This allows to cache Dirichlet boundary values.");
+
+        compile_expressions_ = false;
+        this->add_parameter(
+            "compile expressions",
+            compile_expressions_,
+            "Compile the function expressions to native code with SymEngine "
+            "instead of interpreting them with muparser. Requires deal.II to "
+            "be configured with SymEngine");
+
         /*
-         * Set up the muparser object with the final flux description from
-         * the parameter file:
+         * Set up the function object with the final description from the
+         * parameter file:
          */
-        const auto set_up_muparser = [this] {
-          using FP = dealii::FunctionParser<dim>;
-          /*
-           * This variant of the constructor initializes the function
-           * parser with support for a time-dependent description involving
-           * a variable »t«:
-           */
-          density_function_ = std::make_unique<FP>(density_expression_);
-          velocity_x_function_ = std::make_unique<FP>(velocity_x_expression_);
+        const auto set_up_function = [this] {
+          std::array<std::string, dim + 2> expressions;
+          expressions[0] = density_expression_;
+          expressions[1] = velocity_x_expression_;
           if constexpr (dim > 1)
-            velocity_y_function_ = std::make_unique<FP>(velocity_y_expression_);
+            expressions[2] = velocity_y_expression_;
           if constexpr (dim > 2)
-            velocity_z_function_ = std::make_unique<FP>(velocity_z_expression_);
-          pressure_function_ = std::make_unique<FP>(pressure_expression_);
+            expressions[3] = velocity_z_expression_;
+          expressions[1 + dim] = pressure_expression_;
+
+          function_ = std::make_unique<ExpressionFunction<dim, dim + 2>>(
+              expressions, compile_expressions_);
         };
 
-        set_up_muparser();
-        this->parse_parameters_call_back.connect(set_up_muparser);
+        set_up_function();
+        this->parse_parameters_call_back.connect(set_up_function);
+      }
+
+      bool is_time_independent() const final
+      {
+        return time_independent_;
       }
 
       state_type compute(const dealii::Point<dim> &point, Number t) final
@@ -94,23 +111,9 @@ namespace ryujin
         const auto view = hyperbolic_system_.template view<dim, Number>();
         state_type full_primitive_state;
 
-        density_function_->set_time(t);
-        full_primitive_state[0] = density_function_->value(point);
-
-        velocity_x_function_->set_time(t);
-        full_primitive_state[1] = velocity_x_function_->value(point);
-
-        if constexpr (dim > 1) {
-          velocity_y_function_->set_time(t);
-          full_primitive_state[2] = velocity_y_function_->value(point);
-        }
-        if constexpr (dim > 2) {
-          velocity_z_function_->set_time(t);
-          full_primitive_state[3] = velocity_z_function_->value(point);
-        }
-
-        pressure_function_->set_time(t);
-        full_primitive_state[1 + dim] = pressure_function_->value(point);
+        const auto values = function_->value(point, t);
+        for (unsigned int k = 0; k < dim + 2; ++k)
+          full_primitive_state[k] = values[k];
 
         return view.from_primitive_state(full_primitive_state);
       }
@@ -124,11 +127,10 @@ namespace ryujin
       std::string velocity_z_expression_;
       std::string pressure_expression_;
 
-      std::unique_ptr<dealii::FunctionParser<dim>> density_function_;
-      std::unique_ptr<dealii::FunctionParser<dim>> velocity_x_function_;
-      std::unique_ptr<dealii::FunctionParser<dim>> velocity_y_function_;
-      std::unique_ptr<dealii::FunctionParser<dim>> velocity_z_function_;
-      std::unique_ptr<dealii::FunctionParser<dim>> pressure_function_;
+      bool time_independent_;
+      bool compile_expressions_;
+
+      std::unique_ptr<ExpressionFunction<dim, dim + 2>> function_;
     };
   } // namespace EulerInitialStates
 } // namespace ryujin
\ No newline at end of file
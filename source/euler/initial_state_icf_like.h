@@ -90,6 +90,11 @@ namespace ryujin
         convert_states();
       };
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number) final
       {
         const auto view = hyperbolic_system_.template view<dim, Number>();
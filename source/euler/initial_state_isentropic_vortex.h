@@ -50,12 +50,18 @@ namespace ryujin
         this->add_parameter("beta", beta_, "vortex strength beta");
       }
 
+      bool is_thread_safe() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number t) final
       {
         const auto view = hyperbolic_system_.template view<dim, Number>();
 
+        Number gamma = gamma_;
         if constexpr (View::have_gamma) {
-          gamma_ = view.gamma();
+          gamma = view.gamma();
         }
 
         /* In 3D we simply project onto the 2d plane: */
@@ -68,17 +74,17 @@ namespace ryujin
         const Number factor = beta_ / Number(2. * M_PI) *
                               exp(Number(0.5) - Number(0.5) * r_square);
 
-        const Number T = Number(1.) - (gamma_ - Number(1.)) /
-                                          (Number(2.) * gamma_) * factor *
+        const Number T = Number(1.) - (gamma - Number(1.)) /
+                                          (Number(2.) * gamma) * factor *
                                           factor;
 
         const Number u = mach_number_ - factor * Number(point_bar[1]);
         const Number v = factor * Number(point_bar[0]);
 
-        const Number rho = ryujin::pow(T, Number(1.) / (Number(gamma_ - 1.)));
-        const Number p = ryujin::pow(rho, Number(gamma_));
+        const Number rho = ryujin::pow(T, Number(1.) / (Number(gamma - 1.)));
+        const Number p = ryujin::pow(rho, Number(gamma));
         const Number E =
-            p / (gamma_ - Number(1.)) + Number(0.5) * rho * (u * u + v * v);
+            p / (gamma - Number(1.)) + Number(0.5) * rho * (u * u + v * v);
 
         if constexpr (dim == 2)
           return state_type({rho, rho * u, rho * v, E});
@@ -84,6 +84,11 @@ namespace ryujin
         convert_states();
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number /*t*/) final
       {
         return point[0] >= left_length_ + middle_length_ ? state_right_
@@ -17,8 +17,18 @@ namespace ryujin
     template class Limiter<2, NUMBER>;
     template class Limiter<3, NUMBER>;
 
-    template class Limiter<1, dealii::VectorizedArray<NUMBER>>;
-    template class Limiter<2, dealii::VectorizedArray<NUMBER>>;
-    template class Limiter<3, dealii::VectorizedArray<NUMBER>>;
+    template class Limiter<1, VectorizedArray<NUMBER>>;
+    template class Limiter<2, VectorizedArray<NUMBER>>;
+    template class Limiter<3, VectorizedArray<NUMBER>>;
+
+#ifdef RUNTIME_PRECISION
+    template class Limiter<1, ALTERNATIVE_NUMBER>;
+    template class Limiter<2, ALTERNATIVE_NUMBER>;
+    template class Limiter<3, ALTERNATIVE_NUMBER>;
+
+    template class Limiter<1, VectorizedArray<ALTERNATIVE_NUMBER>>;
+    template class Limiter<2, VectorizedArray<ALTERNATIVE_NUMBER>>;
+    template class Limiter<3, VectorizedArray<ALTERNATIVE_NUMBER>>;
+#endif
   } // namespace Euler
 } // namespace ryujin
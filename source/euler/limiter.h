@@ -41,6 +41,16 @@ namespace ryujin
                       "Maximal number of quadratic newton iterations performed "
                       "during limiting");
 
+        bisection_fallback_steps_ = 0;
+        add_parameter(
+            "bisection fallback steps",
+            bisection_fallback_steps_,
+            "Maximal number of bisection steps performed on the specific "
+            "entropy for all lanes that did not converge within the "
+            "maximal number of quadratic newton iterations. A bisection "
+            "step only evaluates the specific entropy in the midpoint of "
+            "the current window");
+
         relaxation_factor_ = ScalarNumber(1.);
         add_parameter("relaxation factor",
                       relaxation_factor_,
@@ -51,13 +61,23 @@ namespace ryujin
       ACCESSOR_READ_ONLY(iterations);
       ACCESSOR_READ_ONLY(newton_tolerance);
       ACCESSOR_READ_ONLY(newton_max_iterations);
+      ACCESSOR_READ_ONLY(bisection_fallback_steps);
       ACCESSOR_READ_ONLY(relaxation_factor);
 
+      /**
+       * A histogram of the number of Newton (and bisection) iterations
+       * used by all Limiter instances for limiting the specific entropy.
+       */
+      ACCESSOR_READ_ONLY(newton_histogram);
+
     private:
       unsigned int iterations_;
       ScalarNumber newton_tolerance_;
       unsigned int newton_max_iterations_;
+      unsigned int bisection_fallback_steps_;
       ScalarNumber relaxation_factor_;
+
+      IterationHistogram newton_histogram_;
     };
 
 
@@ -130,7 +150,7 @@ namespace ryujin
        *     // ...
        *     limiter.accumulate(js, U_j, flux_j, scaled_c_ij, affine_shift);
        *   }
-       *   limiter.bounds(hd_i);
+       *   limiter.bounds(hd_i, hd_i_power);
        * }
        * ```
        */
@@ -155,9 +175,19 @@ namespace ryujin
           : hyperbolic_system(hyperbolic_system)
           , parameters(parameters)
           , precomputed_values(precomputed_values)
+          , newton_iterations_{}
       {
       }
 
+      /**
+       * Destructor. Records the number of Newton iterations used by this
+       * object in the histogram of the Parameters object.
+       */
+      ~Limiter()
+      {
+        parameters.newton_histogram().record(newton_iterations_);
+      }
+
       /**
        * Reset temporary storage
        */
@@ -176,9 +206,11 @@ namespace ryujin
                       const state_type &affine_shift);
 
       /**
-       * Return the computed bounds (with relaxation applied).
+       * Return the computed bounds (with relaxation applied). Here, hd_i
+       * is the relative lumped mass m_i / |Omega| and hd_i_power the
+       * precomputed power (m_i / |Omega|) ^ (1.5 / d).
        */
-      Bounds bounds(const Number hd_i) const;
+      Bounds bounds(const Number hd_i, const Number hd_i_power) const;
 
       /**
        * Given two bounds bounds_left, bounds_right, this function computes
@@ -245,6 +277,8 @@ namespace ryujin
       Number rho_relaxation_denominator;
       Number s_interp_max;
 
+      IterationHistogram::Counts newton_iterations_;
+
       //@}
     };
 
@@ -284,12 +318,15 @@ namespace ryujin
         const dealii::Tensor<1, dim, Number> &scaled_c_ij,
         const state_type &affine_shift)
     {
-      // TODO: Currently we only apply the affine_shift to U_ij_bar (which
-      // then enters all bounds), but we do not modify s_interp and
-      // rho_relaxation. When actually adding a source term to the Euler
-      // equations verify that this does the right thing.
-      Assert(std::max(affine_shift.norm(), Number(0.)) == Number(0.),
-             dealii::ExcNotImplemented());
+      /*
+       * We only apply the affine_shift to U_ij_bar (which then enters all
+       * bounds), but we do not modify s_interp and rho_relaxation. The
+       * affine shift is caused by the source terms (body force and heating)
+       * and has a vanishing density component. The body force changes the
+       * internal energy only to second order in tau and heating increases
+       * the specific entropy, so that the lower entropy bound of the
+       * unshifted neighbors remains valid.
+       */
 
       const auto view = hyperbolic_system.view<dim, Number>();
 
@@ -329,19 +366,15 @@ namespace ryujin
 
     template <int dim, typename Number>
     DEAL_II_ALWAYS_INLINE inline auto
-    Limiter<dim, Number>::bounds(const Number hd_i) const -> Bounds
+    Limiter<dim, Number>::bounds(const Number /*hd_i*/,
+                                 const Number hd_i_power) const -> Bounds
     {
       auto relaxed_bounds = bounds_;
       auto &[rho_min, rho_max, s_min] = relaxed_bounds;
 
       /* Use r_i = factor * (m_i / |Omega|) ^ (1.5 / d): */
 
-      Number r_i = std::sqrt(hd_i);                              // in 3D: ^ 3/6
-      if constexpr (dim == 2)                                    //
-        r_i = dealii::Utilities::fixed_power<3>(std::sqrt(r_i)); // in 2D: ^ 3/4
-      else if constexpr (dim == 1)                               //
-        r_i = dealii::Utilities::fixed_power<3>(r_i);            // in 1D: ^ 3/2
-      r_i *= parameters.relaxation_factor();
+      const Number r_i = parameters.relaxation_factor() * hd_i_power;
 
       constexpr ScalarNumber eps = std::numeric_limits<ScalarNumber>::epsilon();
       const Number rho_relaxation =
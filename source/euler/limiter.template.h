@@ -170,6 +170,10 @@ namespace ryujin
         std::cout << "t_r: (start) " << t_r << std::endl;
 #endif
 
+        const Number tolerance(parameters.newton_tolerance());
+        unsigned int n_iterations = parameters.newton_max_iterations();
+        bool converged = false;
+
         for (unsigned int n = 0; n < parameters.newton_max_iterations(); ++n) {
 
           const auto U_r = U + t_r * P;
@@ -212,6 +216,8 @@ namespace ryujin
             std::cout << "t_l: (  " << n << "  ) " << t_l << std::endl;
             std::cout << "t_r: (  " << n << "  ) " << t_r << std::endl;
 #endif
+            n_iterations = n;
+            converged = true;
             break;
           }
 #endif
@@ -255,8 +261,8 @@ namespace ryujin
            * Break if the window between t_l and t_r is within the prescribed
            * tolerance:
            */
-          const Number tolerance(parameters.newton_tolerance());
-          if (std::max(Number(0.), t_r - t_l - tolerance) == Number(0.)) {
+          const Number window = t_r - t_l;
+          if (std::max(Number(0.), window - tolerance) == Number(0.)) {
 #ifdef DEBUG_OUTPUT_LIMITER
             std::cout << "break: t_l and t_r within tolerance" << std::endl;
             std::cout << "psi_l:       " << psi_l << std::endl;
@@ -264,6 +270,8 @@ namespace ryujin
             std::cout << "t_l: (  " << n << "  ) " << t_l << std::endl;
             std::cout << "t_r: (  " << n << "  ) " << t_r << std::endl;
 #endif
+            n_iterations = n;
+            converged = true;
             break;
           }
 
@@ -277,9 +285,23 @@ namespace ryujin
           const auto dpsi_r =
               rho_r * drho_e_r + (rho_e_r - gp1 * s_min * rho_r_gamma) * drho;
 
+          const Number t_l_old = t_l;
+          const Number t_r_old = t_r;
+
           quadratic_newton_step(
               t_l, t_r, psi_l, psi_r, dpsi_l, dpsi_r, Number(-1.));
 
+          /*
+           * Freeze all lanes whose window is already within the
+           * tolerance. This way the result of a lane does not depend on
+           * the other lanes of the SIMD batch.
+           */
+          constexpr auto lte = dealii::SIMDComparison::less_than_or_equal;
+          t_l = dealii::compare_and_apply_mask<lte>(
+              window, tolerance, t_l_old, t_l);
+          t_r = dealii::compare_and_apply_mask<lte>(
+              window, tolerance, t_r_old, t_r);
+
 #ifdef DEBUG_OUTPUT_LIMITER
           std::cout << "psi_l:       " << psi_l << std::endl;
           std::cout << "psi_r:       " << psi_r << std::endl;
@@ -290,6 +312,47 @@ namespace ryujin
 #endif
         }
 
+        /*
+         * Bisection fallback: If the Newton iteration did not converge
+         * for all lanes, halve the window of all remaining lanes. A
+         * midpoint with psi > 0 is a good state and becomes the new t_l.
+         */
+
+        if (!converged) {
+          for (unsigned int k = 0; k < parameters.bisection_fallback_steps();
+               ++k) {
+            const Number window = t_r - t_l;
+            if (std::max(Number(0.), window - tolerance) == Number(0.))
+              break;
+
+            const Number t_m = ScalarNumber(0.5) * (t_l + t_r);
+            const auto U_m = U + t_m * P;
+            const auto rho_m = view.density(U_m);
+            const auto rho_m_gamma = ryujin::pow(rho_m, gamma);
+            const auto rho_e_m = view.internal_energy(U_m);
+
+            const auto psi_m =
+                relax_small * rho_m * rho_e_m - s_min * rho_m * rho_m_gamma;
+
+            constexpr auto gt = dealii::SIMDComparison::greater_than;
+            const Number t_l_new =
+                dealii::compare_and_apply_mask<gt>(psi_m, Number(0.), t_m, t_l);
+            const Number t_r_new =
+                dealii::compare_and_apply_mask<gt>(psi_m, Number(0.), t_r, t_m);
+
+            /* Only update lanes that have not converged: */
+            constexpr auto lte = dealii::SIMDComparison::less_than_or_equal;
+            t_l = dealii::compare_and_apply_mask<lte>(
+                window, tolerance, t_l, t_l_new);
+            t_r = dealii::compare_and_apply_mask<lte>(
+                window, tolerance, t_r, t_r_new);
+
+            n_iterations++;
+          }
+        }
+
+        newton_iterations_[IterationHistogram::bin(n_iterations)]++;
+
 #ifdef EXPENSIVE_BOUNDS_CHECK
         /*
          * Verify that the new state is within bounds:
@@ -12,6 +12,8 @@
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
 
+#include <atomic>
+
 namespace ryujin
 {
   namespace Euler
@@ -36,14 +38,64 @@ namespace ryujin
                       newton_max_iterations_,
                       "Maximal number of quadratic newton iterations performed "
                       "during limiting");
+
+        acoustic_shortcut_tolerance_ = ScalarNumber(0.);
+        add_parameter(
+            "acoustic shortcut tolerance",
+            acoustic_shortcut_tolerance_,
+            "If set to a positive value, edges whose relative jumps in "
+            "density, pressure, and normal velocity are below this "
+            "tolerance are treated as smooth and the wavespeed estimate is "
+            "replaced by the (safeguarded) acoustic bound |u| + a. A value "
+            "of zero disables the shortcut");
+
+        single_precision_pow_ = false;
+        add_parameter(
+            "single precision pow",
+            single_precision_pow_,
+            "Evaluate the power functions of the two-rarefaction pressure "
+            "estimate with the (single precision) fast_pow kernel. Both "
+            "powers are rounded outwards in order to retain a guaranteed "
+            "upper bound of the maximal wavespeed");
+
+        n_edges_ = 0;
+        n_acoustic_edges_ = 0;
       }
 
       ACCESSOR_READ_ONLY(newton_tolerance);
       ACCESSOR_READ_ONLY(newton_max_iterations);
+      ACCESSOR_READ_ONLY(acoustic_shortcut_tolerance);
+      ACCESSOR_READ_ONLY(single_precision_pow);
+
+      /**
+       * Accumulate edge statistics of a RiemannSolver instance.
+       */
+      void record_edges(unsigned long n_edges,
+                        unsigned long n_acoustic_edges) const
+      {
+        n_edges_ += n_edges;
+        n_acoustic_edges_ += n_acoustic_edges;
+      }
+
+      /**
+       * Return the fraction of (rank-local) edges for which the acoustic
+       * shortcut was taken, accumulated over the lifetime of the object.
+       * Returns a negative value if no statistics have been recorded.
+       */
+      double acoustic_edge_fraction() const
+      {
+        const double n_edges = n_edges_;
+        return n_edges == 0. ? -1. : n_acoustic_edges_ / n_edges;
+      }
 
     private:
       ScalarNumber newton_tolerance_;
       unsigned int newton_max_iterations_;
+      ScalarNumber acoustic_shortcut_tolerance_;
+      bool single_precision_pow_;
+
+      mutable std::atomic<unsigned long> n_edges_;
+      mutable std::atomic<unsigned long> n_acoustic_edges_;
     };
 
 
@@ -106,13 +158,32 @@ namespace ryujin
           : hyperbolic_system(hyperbolic_system)
           , parameters(parameters)
           , precomputed_values(precomputed_values)
+          , n_edges_(0)
+          , n_acoustic_edges_(0)
+      {
+      }
+
+      /**
+       * Destructor. Records the edge statistics gathered by this object
+       * in the Parameters object.
+       */
+      ~RiemannSolver()
       {
+        if (n_edges_ > 0)
+          parameters.record_edges(n_edges_, n_acoustic_edges_);
       }
 
       /**
        * For two given 1D primitive states riemann_data_i and riemann_data_j,
        * compute an estimation of an upper bound for the maximum wavespeed
        * lambda.
+       *
+       * If the "acoustic shortcut tolerance" is positive, edges with
+       * nearly identical states are classified as smooth first. For a
+       * SIMD batch consisting only of smooth edges the (much cheaper)
+       * acoustic bound is returned right away. Otherwise, the full
+       * estimate is computed and blended with the acoustic bound
+       * lane by lane.
        */
       Number compute(const primitive_type &riemann_data_i,
                      const primitive_type &riemann_data_j) const;
@@ -136,6 +207,14 @@ namespace ryujin
       /** @name Internal functions used in the Riemann solver */
       //@{
 
+      /**
+       * The guaranteed upper bound for the maximum wavespeed based on
+       * the two-rarefaction approximation and an optional quadratic
+       * Newton iteration, see @cite GuermondPopov2016b.
+       */
+      Number compute_guaranteed(const primitive_type &riemann_data_i,
+                                const primitive_type &riemann_data_j) const;
+
       /**
        * See @cite GuermondPopov2016b, page 912, (3.4).
        *
@@ -276,6 +355,9 @@ namespace ryujin
       const HyperbolicSystem &hyperbolic_system;
       const Parameters &parameters;
       const PrecomputedVector &precomputed_values;
+
+      mutable unsigned long n_edges_;
+      mutable unsigned long n_acoustic_edges_;
       //@}
     };
   } // namespace Euler
@@ -295,6 +295,22 @@ namespace ryujin
 
       const auto factor = (gamma - ScalarNumber(1.)) * ScalarNumber(0.5);
 
+      /*
+       * Optionally, evaluate both power functions in single precision. The
+       * two-rarefaction estimate is an upper bound for p_star and enters
+       * lambda_max monotonically. We thus round the outer power (with
+       * positive exponent) upwards and the power in the denominator
+       * downwards, which retains the upper bound. The outward rounding
+       * of fast_pow() scales with the exponent and thus remains valid
+       * for gamma close to one.
+       */
+      const bool single_precision = parameters.single_precision_pow();
+      const auto power = [single_precision](
+                             const Number &x, const auto &b, const Bias bias) {
+        return single_precision ? ryujin::fast_pow(x, b, bias)
+                                : ryujin::pow(x, b);
+      };
+
       /*
        * Nota bene (cf. [1, (3.6)]: The condition "numerator > 0" is the
        * well-known non-vacuum condition. In case we encounter numerator <= 0
@@ -305,12 +321,13 @@ namespace ryujin
 
       const Number numerator = positive_part(a_i + a_j - factor * (u_j - u_i));
       const Number denominator =
-          a_i * ryujin::pow(p_i * inv_p_j, -factor * gamma_inverse) + a_j;
+          a_i * power(p_i * inv_p_j, -factor * gamma_inverse, Bias::min) +
+          a_j;
 
       const auto exponent = ScalarNumber(2.0) * gamma * gamma_minus_one_inverse;
 
-      const auto p_1_tilde =
-          p_j * ryujin::pow(numerator / denominator, exponent);
+      const Number p_1_tilde =
+          p_j * power(numerator / denominator, exponent, Bias::max);
 
 #ifdef DEBUG_RIEMANN_SOLVER
       std::cout << "p_star_two_rarefaction = " << p_1_tilde << std::endl;
@@ -404,7 +421,7 @@ namespace ryujin
 
 
     template <int dim, typename Number>
-    Number RiemannSolver<dim, Number>::compute(
+    Number RiemannSolver<dim, Number>::compute_guaranteed(
         const primitive_type &riemann_data_i,
         const primitive_type &riemann_data_j) const
     {
@@ -582,6 +599,73 @@ namespace ryujin
     }
 
 
+    template <int dim, typename Number>
+    Number RiemannSolver<dim, Number>::compute(
+        const primitive_type &riemann_data_i,
+        const primitive_type &riemann_data_j) const
+    {
+      const auto tolerance = parameters.acoustic_shortcut_tolerance();
+      if (tolerance <= ScalarNumber(0.))
+        return compute_guaranteed(riemann_data_i, riemann_data_j);
+
+      const auto &[rho_i, u_i, p_i, a_i] = riemann_data_i;
+      const auto &[rho_j, u_j, p_j, a_j] = riemann_data_j;
+
+      /*
+       * Classify edges: An edge is smooth if the relative jumps in
+       * density, pressure and normal velocity (relative to the speed of
+       * sound) are below the tolerance.
+       */
+
+      Number jump = std::abs(rho_i - rho_j) / (rho_i + rho_j);
+      jump = std::max(jump, std::abs(p_i - p_j) / (p_i + p_j));
+      jump = std::max(jump, std::abs(u_i - u_j) / (a_i + a_j));
+
+      /*
+       * For such nearly identical states p_star exceeds p_max at most by
+       * a relative amount of (2 + gamma) * tolerance. Linearizing
+       * lambda1_minus and lambda3_plus in this relative pressure jump
+       * shows that the acoustic bound with a speed of sound enlarged by
+       * a factor (1 + 2 tolerance) is an upper bound to first order:
+       */
+
+      const Number acoustic =
+          std::max(std::abs(u_i), std::abs(u_j)) +
+          Number(ScalarNumber(1.) + ScalarNumber(2.) * tolerance) *
+              std::max(a_i, a_j);
+
+      constexpr auto lte = dealii::SIMDComparison::less_than_or_equal;
+      const Number smooth = dealii::compare_and_apply_mask<lte>(
+          jump, Number(tolerance), Number(1.), Number(0.));
+
+      unsigned int n_smooth = 0;
+      if constexpr (std::is_same_v<ScalarNumber, Number>) {
+        n_smooth = static_cast<unsigned int>(smooth);
+      } else {
+        for (unsigned int k = 0; k < Number::size(); ++k)
+          n_smooth += static_cast<unsigned int>(smooth[k]);
+      }
+
+      const unsigned int width = get_stride_size<Number>;
+      n_edges_ += width;
+      n_acoustic_edges_ += n_smooth;
+
+      if (n_smooth == width)
+        return acoustic;
+
+      /*
+       * Compute the full estimate for the whole batch and blend in the
+       * acoustic bound for smooth lanes. This keeps the result of an edge
+       * independent of the other edges in the SIMD batch:
+       */
+
+      const Number lambda_max =
+          compute_guaranteed(riemann_data_i, riemann_data_j);
+      return dealii::compare_and_apply_mask<lte>(
+          jump, Number(tolerance), acoustic, lambda_max);
+    }
+
+
     template <int dim, typename Number>
     DEAL_II_ALWAYS_INLINE inline Number RiemannSolver<dim, Number>::compute(
         const state_type &U_i,
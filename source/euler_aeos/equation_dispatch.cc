@@ -13,5 +13,9 @@ namespace ryujin
   namespace EulerAEOS
   {
     Dispatch<Description, NUMBER> dispatch_instance("euler aeos");
+#ifdef RUNTIME_PRECISION
+    Dispatch<Description, ALTERNATIVE_NUMBER>
+        alternative_dispatch_instance("euler aeos");
+#endif
   } // namespace EulerAEOS
 } // namespace ryujin
@@ -8,13 +8,19 @@
 #include <compile_time_options.h>
 
 #include "convenience_macros.h"
+#include "equation_of_state_table.h"
+#include "lazy.h"
+#include "simd.h"
 
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
 
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace ryujin
 {
@@ -62,6 +68,66 @@ namespace ryujin
          * function (etc.) should be preferred.
          */
         prefer_vector_interface_ = false;
+
+        /*
+         * If necessary derived EOS can override this boolean to indicate
+         * that the dealii::ArrayView<double> variants must not be called
+         * concurrently from several threads.
+         */
+        thread_safe_vector_interface_ = true;
+
+        /*
+         * Every equation of state can be tabulated. The exact equation of
+         * state remains the fall back outside of the tabulated range.
+         */
+        tabulate_pressure_ = false;
+        add_parameter("tabulate pressure",
+                      tabulate_pressure_,
+                      "Pre-sample the pressure on a bicubic table in "
+                      "(log rho, log e) and use the table as a fast path "
+                      "for all states inside the tabulated range");
+
+        table_resolution_ = 128;
+        add_parameter("table resolution",
+                      table_resolution_,
+                      "Number of sampling points per coordinate direction "
+                      "of the pressure table");
+
+        table_tolerance_ = 0.;
+        add_parameter("table tolerance",
+                      table_tolerance_,
+                      "If set to a positive value the table resolution is "
+                      "successively doubled until the maximal relative "
+                      "error of the table in all cell midpoints is below "
+                      "the given tolerance (or the maximal resolution is "
+                      "reached)");
+
+        table_max_resolution_ = 1024;
+        add_parameter("table max resolution",
+                      table_max_resolution_,
+                      "Maximal number of sampling points per coordinate "
+                      "direction of the error controlled pressure table");
+
+        table_density_range_ = {1.0e-3, 1.0e5};
+        add_parameter("table density range",
+                      table_density_range_,
+                      "Minimal and maximal density of the pressure table");
+
+        table_energy_range_ = {1.0e3, 1.0e9};
+        add_parameter("table specific internal energy range",
+                      table_energy_range_,
+                      "Minimal and maximal specific internal energy of the "
+                      "pressure table");
+
+        /*
+         * The table ranges (or the resolution) might have changed. We
+         * rebuild the table right away so that the setup does not end up
+         * in the first time step:
+         */
+        ParameterAcceptor::parse_parameters_call_back.connect([this]() {
+          table_guard_.reset();
+          pressure_table();
+        });
       }
 
       /**
@@ -189,6 +255,45 @@ namespace ryujin
             [&](double rho, double e) { return speed_of_sound(rho, e); });
       }
 
+      /**
+       * Return a pointer to a pre-sampled table of the pressure as a
+       * function of density and specific internal energy, or a nullptr
+       * if tabulation is disabled. If available the table is used as a
+       * (vectorized) fast path by the hyperbolic system for all arguments
+       * inside of the tabulated range. The table is (re)built whenever
+       * parameters are parsed.
+       */
+      virtual const EquationOfStateTable *pressure_table() const
+      {
+        if (!tabulate_pressure_)
+          return nullptr;
+
+        table_guard_.ensure_initialized([&]() {
+          set_up_pressure_table();
+          return true;
+        });
+
+        return &pressure_table_;
+      }
+
+      /**
+       * Return a one-line summary of the pressure table (resolution and
+       * maximal relative error against the exact equation of state), or
+       * an empty string if tabulation is disabled.
+       */
+      std::string pressure_table_report() const
+      {
+        const auto table = pressure_table();
+        if (table == nullptr)
+          return "";
+
+        std::ostringstream output;
+        output << name_ << ": tabulated pressure with " << table_n_points_
+               << "^2 sampling points, maximal relative error "
+               << table->max_relative_error();
+        return output.str();
+      }
+
       /**
        * Return the interpolation covolume constant (b).
        */
@@ -217,18 +322,105 @@ namespace ryujin
        */
       ACCESSOR_READ_ONLY(prefer_vector_interface)
 
+      /**
+       * Return a boolean indicating whether the dealii::ArrayView<double>
+       * variants for the pressure(), specific_internal_energy(), and
+       * speed_of_sound() functions can be called concurrently from
+       * several threads on independent blocks of data.
+       */
+      ACCESSOR_READ_ONLY(thread_safe_vector_interface)
+
       /**
        * Return the name of the EOS as (const reference) std::string
        */
       ACCESSOR_READ_ONLY(name)
 
     protected:
+      /**
+       * A helper function for implementing the vector interface natively
+       * with SIMD instructions: Evaluate @p function, a generic callable
+       * accepting scalar as well as dealii::VectorizedArray arguments,
+       * for all pairs of @p x and @p y and store the result in @p result.
+       */
+      template <typename Callable>
+      static void vectorized_transform(const dealii::ArrayView<double> &result,
+                                       const dealii::ArrayView<double> &x,
+                                       const dealii::ArrayView<double> &y,
+                                       const Callable &function)
+      {
+        Assert(result.size() == x.size() && x.size() == y.size(),
+               dealii::ExcMessage("vectors have different size"));
+
+        using VA = VectorizedArray<double>;
+        constexpr auto width = VA::size();
+        const auto size = result.size();
+
+        std::size_t i = 0;
+        for (; i + width <= size; i += width) {
+          VA x_i, y_i;
+          x_i.load(x.data() + i);
+          y_i.load(y.data() + i);
+          function(x_i, y_i).store(result.data() + i);
+        }
+
+        for (; i < size; ++i)
+          result[i] = function(x[i], y[i]);
+      }
+
       double interpolation_b_;
       double interpolation_pinfty_;
       double interpolation_q_;
       bool prefer_vector_interface_;
+      bool thread_safe_vector_interface_;
+
+      bool tabulate_pressure_;
+      unsigned int table_resolution_;
+      double table_tolerance_;
+      unsigned int table_max_resolution_;
+      std::vector<double> table_density_range_;
+      std::vector<double> table_energy_range_;
 
     private:
+      /**
+       * Sample the pressure (via the vector interface) on the chosen
+       * table range. With a positive table tolerance the resolution is
+       * doubled until the error estimate of the table drops below the
+       * tolerance.
+       */
+      void set_up_pressure_table() const
+      {
+        AssertThrow(table_density_range_.size() == 2 &&
+                        table_energy_range_.size() == 2,
+                    dealii::ExcMessage("The table ranges have to be given by "
+                                       "a minimal and maximal value"));
+
+        unsigned int n = table_resolution_;
+        while (true) {
+          pressure_table_.build(
+              [&](const auto &p, const auto &rho, const auto &e) {
+                this->pressure(p, rho, e);
+              },
+              table_density_range_[0],
+              table_density_range_[1],
+              table_energy_range_[0],
+              table_energy_range_[1],
+              n);
+
+          if (table_tolerance_ <= 0. ||
+              pressure_table_.max_relative_error() <= table_tolerance_ ||
+              n >= table_max_resolution_)
+            break;
+
+          n = std::min(2 * n - 1, table_max_resolution_);
+        }
+
+        table_n_points_ = n;
+      }
+
+      Lazy<bool> table_guard_;
+      mutable EquationOfStateTable pressure_table_;
+      mutable unsigned int table_n_points_ = 0;
+
       const std::string name_;
     };
 
@@ -54,6 +54,9 @@ namespace ryujin
         cv_ = 2487. / rho_0; // [J / (Kg * K)]
         this->add_parameter(
             "c_v", cv_, "The specific heat capacity at constant volume");
+
+        /* The vector interface is implemented natively with SIMD: */
+        this->prefer_vector_interface_ = true;
       }
 
       /**
@@ -66,15 +69,17 @@ namespace ryujin
        */
       double pressure(double rho, double e) const final
       {
+        return pressure_impl(rho, e);
+      }
 
-        const auto ratio = rho / rho_0;
 
-        const auto first_term =
-            capA * (1. - omega / R1 * ratio) * std::exp(-R1 * 1. / ratio);
-        const auto second_term =
-            capB * (1. - omega / R2 * ratio) * std::exp(-R2 * 1. / ratio);
-
-        return first_term + second_term + omega * rho * (e + q_0);
+      void pressure(const dealii::ArrayView<double> &p,
+                    const dealii::ArrayView<double> &rho,
+                    const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(p, rho, e, [&](const auto &x, const auto &y) {
+          return pressure_impl(x, y);
+        });
       }
 
       /**
@@ -87,14 +92,18 @@ namespace ryujin
        */
       double specific_internal_energy(double rho, double p) const final
       {
-        const auto ratio = rho / rho_0;
+        return specific_internal_energy_impl(rho, p);
+      }
 
-        const auto first_term =
-            capA * (1. - omega / R1 * ratio) * std::exp(-R1 * 1. / ratio);
-        const auto second_term =
-            capB * (1. - omega / R2 * ratio) * std::exp(-R2 * 1. / ratio);
 
-        return (p - first_term - second_term) / (rho * omega);
+      void
+      specific_internal_energy(const dealii::ArrayView<double> &e,
+                               const dealii::ArrayView<double> &rho,
+                               const dealii::ArrayView<double> &p) const final
+      {
+        vectorized_transform(e, rho, p, [&](const auto &x, const auto &y) {
+          return specific_internal_energy_impl(x, y);
+        });
       }
 
       /**
@@ -105,6 +114,77 @@ namespace ryujin
        * \f}
        */
       double temperature(double rho, double e) const final
+      {
+        return temperature_impl(rho, e);
+      }
+
+
+      void temperature(const dealii::ArrayView<double> &T,
+                       const dealii::ArrayView<double> &rho,
+                       const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(T, rho, e, [&](const auto &x, const auto &y) {
+          return temperature_impl(x, y);
+        });
+      }
+
+      /**
+       * The speed of sound is given by
+       */
+      double speed_of_sound(double rho, double e) const final
+      {
+        return speed_of_sound_impl(rho, e);
+      }
+
+
+      void speed_of_sound(const dealii::ArrayView<double> &c,
+                          const dealii::ArrayView<double> &rho,
+                          const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(c, rho, e, [&](const auto &x, const auto &y) {
+          return speed_of_sound_impl(x, y);
+        });
+      }
+
+    private:
+      /*
+       * Generic implementations for scalar and VectorizedArray arguments
+       * used by the single-valued and the vector interface:
+       */
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      pressure_impl(const Number &rho, const Number &e) const
+      {
+        const auto ratio = rho / rho_0;
+
+        const auto first_term =
+            capA * (1. - omega / R1 * ratio) * std::exp(-R1 * 1. / ratio);
+        const auto second_term =
+            capB * (1. - omega / R2 * ratio) * std::exp(-R2 * 1. / ratio);
+
+        return first_term + second_term + omega * rho * (e + q_0);
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy_impl(const Number &rho, const Number &p) const
+      {
+        const auto ratio = rho / rho_0;
+
+        const auto first_term =
+            capA * (1. - omega / R1 * ratio) * std::exp(-R1 * 1. / ratio);
+        const auto second_term =
+            capB * (1. - omega / R2 * ratio) * std::exp(-R2 * 1. / ratio);
+
+        return (p - first_term - second_term) / (rho * omega);
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      temperature_impl(const Number &rho, const Number &e) const
       {
         /* Using (16a) of LA-UR-15-29536 */
         const auto ratio = rho / rho_0;
@@ -115,10 +195,10 @@ namespace ryujin
         return (e + q_0 - 1. / rho_0 * (first_term + second_term)) / cv_;
       }
 
-      /**
-       * The speed of sound is given by
-       */
-      double speed_of_sound(double rho, double e) const final
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      speed_of_sound_impl(const Number &rho, const Number &e) const
       {
         /* FIXME: Need to cross reference with literature */
 
@@ -137,7 +217,6 @@ namespace ryujin
         return std::sqrt(first_term + second_term + third_term);
       }
 
-    private:
       double capA;
       double capB;
       double R1;
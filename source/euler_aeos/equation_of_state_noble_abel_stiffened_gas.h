@@ -60,6 +60,9 @@ namespace ryujin
           this->interpolation_pinfty_ = pinf_;
           this->interpolation_q_ = q_;
         });
+
+        /* The vector interface is implemented natively with SIMD: */
+        this->prefer_vector_interface_ = true;
       }
 
       /**
@@ -70,8 +73,17 @@ namespace ryujin
        */
       double pressure(double rho, double e) const final
       {
-        return (gamma_ - 1.) * rho * (e - q_) / (1. - b_ * rho) -
-               gamma_ * pinf_;
+        return pressure_impl(rho, e);
+      }
+
+
+      void pressure(const dealii::ArrayView<double> &p,
+                    const dealii::ArrayView<double> &rho,
+                    const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(p, rho, e, [&](const auto &x, const auto &y) {
+          return pressure_impl(x, y);
+        });
       }
 
 
@@ -83,9 +95,18 @@ namespace ryujin
        */
       double specific_internal_energy(double rho, double p) const final
       {
-        const auto numerator = (p + gamma_ * pinf_) * (1. - b_ * rho);
-        const auto denominator = rho * (gamma_ - 1.);
-        return q_ + numerator / denominator;
+        return specific_internal_energy_impl(rho, p);
+      }
+
+
+      void
+      specific_internal_energy(const dealii::ArrayView<double> &e,
+                               const dealii::ArrayView<double> &rho,
+                               const dealii::ArrayView<double> &p) const final
+      {
+        vectorized_transform(e, rho, p, [&](const auto &x, const auto &y) {
+          return specific_internal_energy_impl(x, y);
+        });
       }
 
       /**
@@ -96,7 +117,17 @@ namespace ryujin
        */
       double temperature(double rho, double e) const final
       {
-        return (e - q_ - pinf_ * (1. / rho - b_)) / cv_;
+        return temperature_impl(rho, e);
+      }
+
+
+      void temperature(const dealii::ArrayView<double> &T,
+                       const dealii::ArrayView<double> &rho,
+                       const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(T, rho, e, [&](const auto &x, const auto &y) {
+          return temperature_impl(x, y);
+        });
       }
 
       /**
@@ -107,14 +138,63 @@ namespace ryujin
        * \f}
        */
       double speed_of_sound(double rho, double e) const final
+      {
+        return speed_of_sound_impl(rho, e);
+      }
+
+
+      void speed_of_sound(const dealii::ArrayView<double> &c,
+                          const dealii::ArrayView<double> &rho,
+                          const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(c, rho, e, [&](const auto &x, const auto &y) {
+          return speed_of_sound_impl(x, y);
+        });
+      }
+
+    private:
+      /*
+       * Generic implementations for scalar and VectorizedArray arguments
+       * used by the single-valued and the vector interface:
+       */
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      pressure_impl(const Number &rho, const Number &e) const
+      {
+        return (gamma_ - 1.) * rho * (e - q_) / (1. - b_ * rho) -
+               gamma_ * pinf_;
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy_impl(const Number &rho, const Number &p) const
+      {
+        const auto numerator = (p + gamma_ * pinf_) * (1. - b_ * rho);
+        const auto denominator = rho * (gamma_ - 1.);
+        return q_ + numerator / denominator;
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      temperature_impl(const Number &rho, const Number &e) const
+      {
+        return (e - q_ - pinf_ * (1. / rho - b_)) / cv_;
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      speed_of_sound_impl(const Number &rho, const Number &e) const
       {
         const auto covolume = 1. - b_ * rho;
-        auto numerator = (rho * (e - q_) - pinf_ * covolume) / rho;
-        numerator *= gamma_ * (gamma_ - 1.);
+        const auto numerator = gamma_ * (gamma_ - 1.) *
+                               (rho * (e - q_) - pinf_ * covolume) / rho;
         return std::sqrt(numerator) / covolume;
       }
 
-    private:
       double gamma_;
       double R_;
       double cv_;
@@ -40,6 +40,9 @@ namespace ryujin
             "gas constant R", R_, "The specific gas constant R");
 
         cv_ = R_ / (gamma_ - 1.);
+
+        /* The vector interface is implemented natively with SIMD: */
+        this->prefer_vector_interface_ = true;
       }
 
       /**
@@ -50,7 +53,17 @@ namespace ryujin
        */
       double pressure(double rho, double e) const final
       {
-        return (gamma_ - 1.) * rho * e;
+        return pressure_impl(rho, e);
+      }
+
+
+      void pressure(const dealii::ArrayView<double> &p,
+                    const dealii::ArrayView<double> &rho,
+                    const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(p, rho, e, [&](const auto &x, const auto &y) {
+          return pressure_impl(x, y);
+        });
       }
 
       /**
@@ -61,7 +74,18 @@ namespace ryujin
        */
       double specific_internal_energy(double rho, double p) const final
       {
-        return p / (rho * (gamma_ - 1.));
+        return specific_internal_energy_impl(rho, p);
+      }
+
+
+      void
+      specific_internal_energy(const dealii::ArrayView<double> &e,
+                               const dealii::ArrayView<double> &rho,
+                               const dealii::ArrayView<double> &p) const final
+      {
+        vectorized_transform(e, rho, p, [&](const auto &x, const auto &y) {
+          return specific_internal_energy_impl(x, y);
+        });
       }
 
       /**
@@ -70,9 +94,19 @@ namespace ryujin
        *   T = e / c_v
        * \f}
        */
-      double temperature(double /*rho*/, double e) const final
+      double temperature(double rho, double e) const final
       {
-        return e / cv_;
+        return temperature_impl(rho, e);
+      }
+
+
+      void temperature(const dealii::ArrayView<double> &T,
+                       const dealii::ArrayView<double> &rho,
+                       const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(T, rho, e, [&](const auto &x, const auto &y) {
+          return temperature_impl(x, y);
+        });
       }
 
       /**
@@ -81,11 +115,63 @@ namespace ryujin
        *   c^2 = \gamma * (\gamma - 1) e
        * \f}
        */
-      double speed_of_sound(double /*rho*/, double e) const final
+      double speed_of_sound(double rho, double e) const final
+      {
+        return speed_of_sound_impl(rho, e);
+      }
+
+
+      void speed_of_sound(const dealii::ArrayView<double> &c,
+                          const dealii::ArrayView<double> &rho,
+                          const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(c, rho, e, [&](const auto &x, const auto &y) {
+          return speed_of_sound_impl(x, y);
+        });
+      }
+
+      /**
+       * @name Generic implementations for scalar and VectorizedArray
+       * arguments. These are used by the single-valued and the vector
+       * interface, and are called directly (bypassing the virtual
+       * interface) by the polytropic fast path of the EulerAEOS
+       * HyperbolicSystemView.
+       */
+      //@{
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      pressure_impl(const Number &rho, const Number &e) const
+      {
+        return Number(gamma_ - 1.) * rho * e;
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy_impl(const Number &rho, const Number &p) const
       {
-        return std::sqrt(gamma_ * (gamma_ - 1.) * e);
+        return p / (rho * Number(gamma_ - 1.));
       }
 
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      temperature_impl(const Number & /*rho*/, const Number &e) const
+      {
+        return e / Number(cv_);
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      speed_of_sound_impl(const Number & /*rho*/, const Number &e) const
+      {
+        return std::sqrt(Number(gamma_ * (gamma_ - 1.)) * e);
+      }
+
+      //@}
+
     private:
       double gamma_;
       double R_;
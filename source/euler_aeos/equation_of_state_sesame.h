@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <filesystem>
+#include <map>
+#include <mutex>
+#include <thread>
 
 #include <compile_time_options.h>
 
@@ -15,6 +19,7 @@
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/config.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/parameter_acceptor.h>
 
 #ifdef WITH_EOSPAC
@@ -52,6 +57,16 @@ namespace ryujin
       e_rho_p = EOS_Ut_DPt,
     };
 
+    /**
+     * A wrapper around a set of eospac6 tables.
+     *
+     * The eospac6 library stores interpolation state with every table
+     * handle, so that concurrent queries on the same handle are not
+     * permitted. We therefore hand out a separate interpolation context
+     * (consisting of its own set of table handles and scratch storage)
+     * to every thread that queries the interface. Contexts are created
+     * on first use and are cached in thread local storage.
+     */
     class Interface
     {
     public:
@@ -62,6 +77,7 @@ namespace ryujin
        * a corresponding TableType.
        */
       Interface(const std::vector<std::tuple<EOS_INTEGER, TableType>> &tables)
+          : id_(++next_id_)
       {
         n_tables_ = tables.size();
 
@@ -77,31 +93,11 @@ namespace ryujin
                          return static_cast<EOS_INTEGER>(std::get<1>(it));
                        });
 
-        table_handles_.resize(n_tables_);
-
-        /* create tables: */
-
-        EOS_INTEGER error_code;
-        eos_CreateTables(&n_tables_,
-                         table_types_.data(),
-                         material_ids_.data(),
-                         table_handles_.data(),
-                         &error_code);
-        check_tables("eos_CreateTables");
-
-        /* set table options: */
-
-        for (EOS_INTEGER i = 0; i < n_tables_; i++) {
-          // FIXME: refactor into options
-          eos_SetOption(
-              &table_handles_[i], &EOS_SMOOTH, EOS_NullPtr, &error_code);
-          check_error_code(error_code, "eos_SetOption", i);
-        }
-
-        /* load tables: */
-
-        eos_LoadTables(&n_tables_, table_handles_.data(), &error_code);
-        check_tables("eos_LoadTables");
+        /*
+         * Set up the context of the calling thread right away so that
+         * errors in the table setup are reported early:
+         */
+        context();
       }
 
       /**
@@ -109,8 +105,11 @@ namespace ryujin
        */
       ~Interface() noexcept
       {
-        EOS_INTEGER error_code;
-        eos_DestroyTables(&n_tables_, table_handles_.data(), &error_code);
+        for (auto &it : contexts_) {
+          EOS_INTEGER error_code;
+          eos_DestroyTables(
+              &n_tables_, it.second->table_handles.data(), &error_code);
+        }
       }
 
       /**
@@ -123,7 +122,7 @@ namespace ryujin
                          const dealii::ArrayView<EOS_REAL> &dFx,
                          const dealii::ArrayView<EOS_REAL> &dFy,
                          const dealii::ArrayView<const EOS_REAL> &X,
-                         const dealii::ArrayView<const EOS_REAL> &Y)
+                         const dealii::ArrayView<const EOS_REAL> &Y) const
       {
         Assert(index >= 0 && index < n_tables_,
                dealii::ExcMessage("Table index out of range"));
@@ -137,8 +136,10 @@ namespace ryujin
                dealii::ExcMessage("vector sizes do not match"));
 #endif
 
+        auto &context = this->context();
+
         EOS_INTEGER error_code;
-        eos_Interpolate(&table_handles_[index],
+        eos_Interpolate(&context.table_handles[index],
                         &n_queries,
                         const_cast<EOS_REAL *>(X.data()), /* sigh */
                         const_cast<EOS_REAL *>(Y.data()), /* sigh */
@@ -148,15 +149,133 @@ namespace ryujin
                         &error_code);
       }
 
+      /**
+       * Query the table with index @p index and discard the derivatives.
+       * The interpolation works on @p n tuples in parallel, which are
+       * handed to eospac6 in batches of at most batch_size tuples. This
+       * function can be called concurrently from several threads.
+       */
+      inline DEAL_II_ALWAYS_INLINE void
+      interpolate_values(const EOS_INTEGER &index,
+                         const dealii::ArrayView<EOS_REAL> &F,
+                         const dealii::ArrayView<const EOS_REAL> &X,
+                         const dealii::ArrayView<const EOS_REAL> &Y) const
+      {
+        Assert(index >= 0 && index < n_tables_,
+               dealii::ExcMessage("Table index out of range"));
+        Assert(X.size() == F.size() && Y.size() == F.size(),
+               dealii::ExcMessage("vector sizes do not match"));
+
+        auto &context = this->context();
+
+        const std::size_t size = F.size();
+        for (std::size_t i = 0; i < size; i += batch_size) {
+          EOS_INTEGER n_queries = std::min(batch_size, size - i);
+
+          EOS_INTEGER error_code;
+          eos_Interpolate(&context.table_handles[index],
+                          &n_queries,
+                          const_cast<EOS_REAL *>(X.data() + i), /* sigh */
+                          const_cast<EOS_REAL *>(Y.data() + i), /* sigh */
+                          F.data() + i,
+                          context.dFx.data(),
+                          context.dFy.data(),
+                          &error_code);
+        }
+      }
+
+      /**
+       * The maximal number of tuples handed to eospac6 in a single call
+       * by the interpolate_values() variant discarding derivatives.
+       */
+      static constexpr std::size_t batch_size = 8192;
+
     private:
       /**
-       * Parameters and handles for eos_createTables:
+       * Parameters for eos_createTables:
        */
       std::vector<EOS_INTEGER> material_ids_;
       std::vector<EOS_INTEGER> table_types_;
       EOS_INTEGER n_tables_;
-      /* Mutable so that we can call eospac functions from a const context. */
-      mutable std::vector<EOS_INTEGER> table_handles_;
+
+      /**
+       * An interpolation context: a set of table handles and scratch
+       * storage for the (discarded) derivatives.
+       */
+      struct Context {
+        std::vector<EOS_INTEGER> table_handles;
+        std::vector<EOS_REAL> dFx;
+        std::vector<EOS_REAL> dFy;
+      };
+
+      /**
+       * Return the interpolation context of the calling thread.
+       */
+      Context &context() const
+      {
+        /*
+         * Cache the context of the most recently used interface. The
+         * (unique) id_ guards against a stale cache entry of a destroyed
+         * interface:
+         */
+        thread_local static std::pair<std::size_t, Context *> cache{0,
+                                                                    nullptr};
+        if (cache.first == id_)
+          return *cache.second;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto &context = contexts_[std::this_thread::get_id()];
+        if (!context)
+          context = create_context();
+
+        cache = {id_, context.get()};
+        return *context;
+      }
+
+      /**
+       * Create and load a new set of tables. We are holding mutex_.
+       */
+      std::unique_ptr<Context> create_context() const
+      {
+        auto context = std::make_unique<Context>();
+        auto &table_handles = context->table_handles;
+        table_handles.resize(n_tables_);
+        context->dFx.resize(batch_size);
+        context->dFy.resize(batch_size);
+
+        /* create tables: */
+
+        EOS_INTEGER n_tables = n_tables_;
+        EOS_INTEGER error_code;
+        eos_CreateTables(&n_tables,
+                         const_cast<EOS_INTEGER *>(table_types_.data()),
+                         const_cast<EOS_INTEGER *>(material_ids_.data()),
+                         table_handles.data(),
+                         &error_code);
+        check_tables(table_handles, "eos_CreateTables");
+
+        /* set table options: */
+
+        for (EOS_INTEGER i = 0; i < n_tables_; i++) {
+          // FIXME: refactor into options
+          eos_SetOption(
+              &table_handles[i], &EOS_SMOOTH, EOS_NullPtr, &error_code);
+          check_error_code(error_code, "eos_SetOption", i);
+        }
+
+        /* load tables: */
+
+        eos_LoadTables(&n_tables, table_handles.data(), &error_code);
+        check_tables(table_handles, "eos_LoadTables");
+
+        return context;
+      }
+
+      const std::size_t id_;
+      static inline std::atomic<std::size_t> next_id_ = 0;
+
+      mutable std::mutex mutex_;
+      mutable std::map<std::thread::id, std::unique_ptr<Context>> contexts_;
 
       /**
        * Error handling:
@@ -181,11 +300,12 @@ namespace ryujin
         }
       }
 
-      void check_tables(const std::string &routine) const
+      void check_tables(std::vector<EOS_INTEGER> &table_handles,
+                        const std::string &routine) const
       {
         for (EOS_INTEGER i = 0; i < n_tables_; i++) {
           EOS_INTEGER table_error_code = EOS_OK;
-          eos_GetErrorCode(&table_handles_[i], &table_error_code);
+          eos_GetErrorCode(&table_handles[i], &table_error_code);
           if (table_error_code != EOS_OK) {
             std::array<EOS_CHAR, EOS_MaxErrMsgLen> error_message;
             eos_GetErrorMessage(&table_error_code, error_message.data());
@@ -233,6 +353,22 @@ namespace ryujin
             "material id", material_id_, "The Sesame Material ID");
 
         this->prefer_vector_interface_ = true;
+
+        thread_parallel_interpolation_ = true;
+        this->add_parameter(
+            "thread parallel interpolation",
+            thread_parallel_interpolation_,
+            "Query the sesame database concurrently from several threads. "
+            "Every thread loads its own copy of the tables");
+
+        /*
+         * With a table at hand it is more efficient to evaluate the
+         * pressure for every degree of freedom individually:
+         */
+        this->parse_parameters_call_back.connect([&]() {
+          this->prefer_vector_interface_ = !this->tabulate_pressure_;
+          this->thread_safe_vector_interface_ = thread_parallel_interpolation_;
+        });
       }
 
 
@@ -245,15 +381,13 @@ namespace ryujin
 
         EOS_INTEGER index = 0;
 
-        double p, p_drho, p_de;
+        double p;
         const double rho_scaled = rho / 1.0e3; // convert from Kg/m^3 to Mg/m^3
         const double e_scaled = e / 1.0e6;     // convert from J/kg to MJ/kg
 
         eospac_interface_->interpolate_values(
             index,
             dealii::ArrayView<double>(&p, 1),
-            dealii::ArrayView<double>(&p_drho, 1),
-            dealii::ArrayView<double>(&p_de, 1),
             dealii::ArrayView<const double>(&rho_scaled, 1),
             dealii::ArrayView<const double>(&e_scaled, 1));
 
@@ -275,12 +409,6 @@ namespace ryujin
 
         EOS_INTEGER index = 0;
 
-        /* FIXME: this is not reentrant... */
-        thread_local static std::vector<double> p_drho;
-        thread_local static std::vector<double> p_de;
-        p_drho.resize(p.size());
-        p_de.resize(p.size());
-
         // convert from Kg/m^3 to Mg/m^3
         std::transform(std::begin(rho),
                        std::end(rho),
@@ -293,12 +421,7 @@ namespace ryujin
                        std::begin(e),
                        [](auto e) { return e / 1.0e6; });
 
-        eospac_interface_->interpolate_values(index,
-                                              p,
-                                              dealii::ArrayView<double>(p_drho),
-                                              dealii::ArrayView<double>(p_de),
-                                              rho,
-                                              e);
+        eospac_interface_->interpolate_values(index, p, rho, e);
 
         // convert from GPa to Pa
         std::transform(std::begin(p), //
@@ -317,15 +440,13 @@ namespace ryujin
 
         EOS_INTEGER index = 1;
 
-        double e, e_drho, e_dp;
+        double e;
         const double rho_scaled = rho / 1.0e3; // convert from Kg/M^3 to Mg/M^3
         const double p_scaled = p / 1.0e9;     // convert from Pa to GPa
 
         eospac_interface_->interpolate_values(
             index,
             dealii::ArrayView<double>(&e, 1),
-            dealii::ArrayView<double>(&e_drho, 1),
-            dealii::ArrayView<double>(&e_dp, 1),
             dealii::ArrayView<const double>(&rho_scaled, 1),
             dealii::ArrayView<const double>(&p_scaled, 1));
 
@@ -348,12 +469,6 @@ namespace ryujin
 
         EOS_INTEGER index = 1;
 
-        /* FIXME: this is not reentrant... */
-        thread_local static std::vector<double> e_drho;
-        thread_local static std::vector<double> e_dp;
-        e_drho.resize(e.size());
-        e_dp.resize(e.size());
-
         // convert from Kg/m^3 to Mg/m^3
         std::transform(std::begin(rho),
                        std::end(rho),
@@ -366,12 +481,7 @@ namespace ryujin
                        std::begin(p),
                        [](auto it) { return it / 1.0e9; });
 
-        eospac_interface_->interpolate_values(index,
-                                              e,
-                                              dealii::ArrayView<double>(e_drho),
-                                              dealii::ArrayView<double>(e_dp),
-                                              rho,
-                                              p);
+        eospac_interface_->interpolate_values(index, e, rho, p);
 
         // convert from MJ/kg to J/kg
         std::transform(std::begin(e), //
@@ -469,6 +579,8 @@ namespace ryujin
 
       EOS_INTEGER material_id_;
 
+      bool thread_parallel_interpolation_;
+
       //@}
 
 #else /* WITHOUT_EOSPAC */
@@ -0,0 +1,347 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include "convenience_macros.h"
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/vectorization.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace ryujin
+{
+  namespace EquationOfStateLibrary
+  {
+    /**
+     * A pre-sampled bicubic table of a function f(rho, e) on a uniform
+     * grid in (log rho, log e) space. The table is used as a fast path
+     * for expensive (tabulated) equations of state, such as the Sesame
+     * database, where every call into the eos library is costly.
+     *
+     * The function is sampled once on a grid of \f$n\times n\f$ points.
+     * Derivatives in the grid nodes are approximated by finite
+     * differences and every cell stores the 16 coefficients of the
+     * resulting bicubic Hermite interpolant. This makes a lookup a
+     * gather of 16 coefficients followed by a Horner evaluation, both of
+     * which vectorize over dealii::VectorizedArray.
+     *
+     * @ingroup EulerEquations
+     */
+    class EquationOfStateTable
+    {
+    public:
+      /**
+       * Sample the function given by @p evaluate on the (logarithmic)
+       * box \f$[\rho_{\text{min}},\rho_{\text{max}}]\times
+       * [e_{\text{min}},e_{\text{max}}]\f$ with @p n points per
+       * coordinate direction. The callable is invoked with the signature
+       * of the vector interface of EquationOfState, i.e., as
+       * `evaluate(f, rho, e)`, but is allowed to modify @p rho and @p e.
+       *
+       * After setup the interpolant is compared against @p evaluate in
+       * all cell midpoints; the maximal relative deviation is available
+       * through max_relative_error().
+       */
+      template <typename Callable>
+      void build(const Callable &evaluate,
+                 double rho_min,
+                 double rho_max,
+                 double e_min,
+                 double e_max,
+                 unsigned int n)
+      {
+        AssertThrow(0. < rho_min && rho_min < rho_max && 0. < e_min &&
+                        e_min < e_max,
+                    dealii::ExcMessage("The table range has to be a "
+                                       "non-degenerate box of positive "
+                                       "densities and energies"));
+        AssertThrow(n >= 2,
+                    dealii::ExcMessage("The table needs at least two "
+                                       "sampling points per direction"));
+
+        n_ = n;
+        rho_min_ = rho_min;
+        rho_max_ = rho_max;
+        e_min_ = e_min;
+        e_max_ = e_max;
+        x_min_ = std::log(rho_min);
+        x_max_ = std::log(rho_max);
+        y_min_ = std::log(e_min);
+        y_max_ = std::log(e_max);
+        const double h_x = (x_max_ - x_min_) / (n - 1);
+        const double h_y = (y_max_ - y_min_) / (n - 1);
+        h_x_inverse_ = 1. / h_x;
+        h_y_inverse_ = 1. / h_y;
+
+        /* Sample f in all grid nodes (i, j), stored at i * n + j: */
+
+        std::vector<double> f(n * n);
+        {
+          std::vector<double> rho(n * n);
+          std::vector<double> e(n * n);
+          for (unsigned int i = 0; i < n; ++i)
+            for (unsigned int j = 0; j < n; ++j) {
+              rho[i * n + j] = std::exp(x_min_ + i * h_x);
+              e[i * n + j] = std::exp(y_min_ + j * h_y);
+            }
+          evaluate(dealii::ArrayView<double>(f),
+                   dealii::ArrayView<double>(rho),
+                   dealii::ArrayView<double>(e));
+        }
+
+        /* Derivatives with respect to the grid index (finite differences): */
+
+        const auto difference = [n](const std::vector<double> &g,
+                                    unsigned int i,
+                                    unsigned int j,
+                                    bool in_x) {
+          const unsigned int k = in_x ? i : j;
+          const unsigned int stride = in_x ? n : 1;
+          const unsigned int index = i * n + j;
+          if (k == 0)
+            return g[index + stride] - g[index];
+          if (k == n - 1)
+            return g[index] - g[index - stride];
+          return 0.5 * (g[index + stride] - g[index - stride]);
+        };
+
+        std::vector<double> f_x(n * n);
+        std::vector<double> f_y(n * n);
+        std::vector<double> f_xy(n * n);
+        for (unsigned int i = 0; i < n; ++i)
+          for (unsigned int j = 0; j < n; ++j) {
+            f_x[i * n + j] = difference(f, i, j, true);
+            f_y[i * n + j] = difference(f, i, j, false);
+          }
+        for (unsigned int i = 0; i < n; ++i)
+          for (unsigned int j = 0; j < n; ++j)
+            f_xy[i * n + j] = difference(f_y, i, j, true);
+
+        /*
+         * Compute the coefficients a_kl of the bicubic Hermite
+         * interpolant p(s, t) = sum_kl a_kl s^k t^l on every cell by
+         * A = M F M^T.
+         */
+
+        constexpr double M[4][4] = {
+            {1., 0., 0., 0.},
+            {0., 0., 1., 0.},
+            {-3., 3., -2., -1.},
+            {2., -2., 1., 1.},
+        };
+
+        coefficients_.resize((n - 1) * (n - 1) * 16);
+        for (unsigned int i = 0; i + 1 < n; ++i)
+          for (unsigned int j = 0; j + 1 < n; ++j) {
+            const auto node = [&](unsigned int a, unsigned int b) {
+              return (i + a) * n + (j + b);
+            };
+
+            const double F[4][4] = {
+                {f[node(0, 0)],
+                 f[node(0, 1)],
+                 f_y[node(0, 0)],
+                 f_y[node(0, 1)]},
+                {f[node(1, 0)],
+                 f[node(1, 1)],
+                 f_y[node(1, 0)],
+                 f_y[node(1, 1)]},
+                {f_x[node(0, 0)],
+                 f_x[node(0, 1)],
+                 f_xy[node(0, 0)],
+                 f_xy[node(0, 1)]},
+                {f_x[node(1, 0)],
+                 f_x[node(1, 1)],
+                 f_xy[node(1, 0)],
+                 f_xy[node(1, 1)]},
+            };
+
+            double MF[4][4];
+            for (unsigned int k = 0; k < 4; ++k)
+              for (unsigned int l = 0; l < 4; ++l) {
+                MF[k][l] = 0.;
+                for (unsigned int m = 0; m < 4; ++m)
+                  MF[k][l] += M[k][m] * F[m][l];
+              }
+
+            double *a = &coefficients_[(i * (n - 1) + j) * 16];
+            for (unsigned int k = 0; k < 4; ++k)
+              for (unsigned int l = 0; l < 4; ++l) {
+                a[4 * k + l] = 0.;
+                for (unsigned int m = 0; m < 4; ++m)
+                  a[4 * k + l] += MF[k][m] * M[l][m];
+              }
+          }
+
+        coefficients_float_.assign(coefficients_.begin(), coefficients_.end());
+
+        /* Error report against the original function in cell midpoints: */
+
+        const unsigned int n_cells = (n - 1) * (n - 1);
+        std::vector<double> rho(n_cells);
+        std::vector<double> e(n_cells);
+        std::vector<double> f_mid(n_cells);
+        for (unsigned int i = 0; i + 1 < n; ++i)
+          for (unsigned int j = 0; j + 1 < n; ++j) {
+            rho[i * (n - 1) + j] = std::exp(x_min_ + (i + 0.5) * h_x);
+            e[i * (n - 1) + j] = std::exp(y_min_ + (j + 0.5) * h_y);
+          }
+        const auto rho_copy = rho;
+        const auto e_copy = e;
+        evaluate(dealii::ArrayView<double>(f_mid),
+                 dealii::ArrayView<double>(rho),
+                 dealii::ArrayView<double>(e));
+
+        double f_max = 0.;
+        for (const auto it : f_mid)
+          f_max = std::max(f_max, std::abs(it));
+
+        max_relative_error_ = 0.;
+        for (unsigned int c = 0; c < n_cells; ++c) {
+          const auto value = this->evaluate(rho_copy[c], e_copy[c]);
+          const auto reference = std::max(std::abs(f_mid[c]), 1.e-8 * f_max);
+          max_relative_error_ = std::max(
+              max_relative_error_, std::abs(value - f_mid[c]) / reference);
+        }
+      }
+
+      /**
+       * Return true if the table has been set up and all (lanes of) @p
+       * rho and @p e lie inside the tabulated range.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline bool in_range(const Number &rho,
+                                                 const Number &e) const
+      {
+        if (coefficients_.empty())
+          return false;
+
+        const auto check = [&](double rho_k, double e_k) {
+          return rho_k >= rho_min_ && rho_k <= rho_max_ && e_k >= e_min_ &&
+                 e_k <= e_max_;
+        };
+
+        if constexpr (std::is_arithmetic_v<Number>) {
+          return check(rho, e);
+        } else {
+          for (unsigned int k = 0; k < Number::size(); ++k)
+            if (!check(rho[k], e[k]))
+              return false;
+          return true;
+        }
+      }
+
+      /**
+       * Evaluate the bicubic interpolant for given (lanes of) density @p
+       * rho and specific internal energy @p e.
+       *
+       * @pre in_range(rho, e) has to be true.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number evaluate(const Number &rho,
+                                                   const Number &e) const
+      {
+        using std::log;
+        const Number s_global =
+            (log(rho) - Number(x_min_)) * Number(h_x_inverse_);
+        const Number t_global =
+            (log(e) - Number(y_min_)) * Number(h_y_inverse_);
+
+        const auto cell_index = [&](double s) {
+          const int max_index = n_ - 2;
+          return std::clamp(static_cast<int>(s), 0, max_index);
+        };
+
+        if constexpr (std::is_arithmetic_v<Number>) {
+          const auto i = cell_index(s_global);
+          const auto j = cell_index(t_global);
+          const Number s = s_global - Number(i);
+          const Number t = t_global - Number(j);
+          const auto *a = &coefficients<Number>()[(i * (n_ - 1) + j) * 16];
+
+          Number result = Number(0.);
+          for (int k = 3; k >= 0; --k) {
+            Number row = a[4 * k + 3];
+            for (int l = 2; l >= 0; --l)
+              row = row * t + a[4 * k + l];
+            result = result * s + row;
+          }
+          return result;
+
+        } else {
+          using ScalarNumber = typename Number::value_type;
+
+          std::array<unsigned int, Number::size()> offsets;
+          Number s, t;
+          for (unsigned int k = 0; k < Number::size(); ++k) {
+            const auto i = cell_index(s_global[k]);
+            const auto j = cell_index(t_global[k]);
+            s[k] = s_global[k] - ScalarNumber(i);
+            t[k] = t_global[k] - ScalarNumber(j);
+            offsets[k] = (i * (n_ - 1) + j) * 16;
+          }
+
+          const auto *a = coefficients<ScalarNumber>().data();
+          const auto gather = [&](unsigned int m) {
+            Number result;
+            result.gather(a + m, offsets.data());
+            return result;
+          };
+
+          Number result = Number(0.);
+          for (int k = 3; k >= 0; --k) {
+            Number row = gather(4 * k + 3);
+            for (int l = 2; l >= 0; --l)
+              row = row * t + gather(4 * k + l);
+            result = result * s + row;
+          }
+          return result;
+        }
+      }
+
+      /**
+       * Return the maximal relative error of the interpolant in all cell
+       * midpoints determined during build().
+       */
+      ACCESSOR_READ_ONLY(max_relative_error)
+
+    private:
+      template <typename ScalarNumber>
+      DEAL_II_ALWAYS_INLINE inline const std::vector<ScalarNumber> &
+      coefficients() const
+      {
+        if constexpr (std::is_same_v<ScalarNumber, float>)
+          return coefficients_float_;
+        else
+          return coefficients_;
+      }
+
+      unsigned int n_ = 0;
+      double rho_min_ = 0.;
+      double rho_max_ = 0.;
+      double e_min_ = 0.;
+      double e_max_ = 0.;
+      double x_min_ = 0.;
+      double x_max_ = 0.;
+      double y_min_ = 0.;
+      double y_max_ = 0.;
+      double h_x_inverse_ = 0.;
+      double h_y_inverse_ = 0.;
+
+      std::vector<double> coefficients_;
+      std::vector<float> coefficients_float_;
+
+      double max_relative_error_ = 0.;
+    };
+  } // namespace EquationOfStateLibrary
+} // namespace ryujin
@@ -55,6 +55,9 @@ namespace ryujin
           if (b_ > 0.)
             this->interpolation_pinfty_ = a_ / (b_ * b_);
         });
+
+        /* The vector interface is implemented natively with SIMD: */
+        this->prefer_vector_interface_ = true;
       }
 
       /**
@@ -65,10 +68,17 @@ namespace ryujin
        */
       double pressure(double rho, double e) const final
       {
-        const auto intermolecular = a_ * rho * rho;
-        const auto numerator = rho * e + intermolecular;
-        const auto covolume = 1. - b_ * rho;
-        return (gamma_ - 1.) * numerator / covolume - intermolecular;
+        return pressure_impl(rho, e);
+      }
+
+
+      void pressure(const dealii::ArrayView<double> &p,
+                    const dealii::ArrayView<double> &rho,
+                    const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(p, rho, e, [&](const auto &x, const auto &y) {
+          return pressure_impl(x, y);
+        });
       }
 
       /**
@@ -80,11 +90,18 @@ namespace ryujin
        */
       double specific_internal_energy(double rho, double p) const final
       {
-        const auto intermolecular = a_ * rho * rho;
-        const auto covolume = 1. - b_ * rho;
-        const auto numerator = (p + intermolecular) * covolume;
-        const auto denominator = rho * (gamma_ - 1.);
-        return numerator / denominator - a_ * rho;
+        return specific_internal_energy_impl(rho, p);
+      }
+
+
+      void
+      specific_internal_energy(const dealii::ArrayView<double> &e,
+                               const dealii::ArrayView<double> &rho,
+                               const dealii::ArrayView<double> &p) const final
+      {
+        vectorized_transform(e, rho, p, [&](const auto &x, const auto &y) {
+          return specific_internal_energy_impl(x, y);
+        });
       }
 
       /**
@@ -95,7 +112,17 @@ namespace ryujin
        */
       double temperature(double rho, double e) const final
       {
-        return (e + a_ * rho) / cv_;
+        return temperature_impl(rho, e);
+      }
+
+
+      void temperature(const dealii::ArrayView<double> &T,
+                       const dealii::ArrayView<double> &rho,
+                       const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(T, rho, e, [&](const auto &x, const auto &y) {
+          return temperature_impl(x, y);
+        });
       }
 
       /**
@@ -106,13 +133,66 @@ namespace ryujin
        * \f}
        */
       double speed_of_sound(double rho, double e) const final
+      {
+        return speed_of_sound_impl(rho, e);
+      }
+
+
+      void speed_of_sound(const dealii::ArrayView<double> &c,
+                          const dealii::ArrayView<double> &rho,
+                          const dealii::ArrayView<double> &e) const final
+      {
+        vectorized_transform(c, rho, e, [&](const auto &x, const auto &y) {
+          return speed_of_sound_impl(x, y);
+        });
+      }
+
+    private:
+      /*
+       * Generic implementations for scalar and VectorizedArray arguments
+       * used by the single-valued and the vector interface:
+       */
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      pressure_impl(const Number &rho, const Number &e) const
+      {
+        const auto intermolecular = a_ * rho * rho;
+        const auto numerator = rho * e + intermolecular;
+        const auto covolume = 1. - b_ * rho;
+        return (gamma_ - 1.) * numerator / covolume - intermolecular;
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy_impl(const Number &rho, const Number &p) const
+      {
+        const auto intermolecular = a_ * rho * rho;
+        const auto covolume = 1. - b_ * rho;
+        const auto numerator = (p + intermolecular) * covolume;
+        const auto denominator = rho * (gamma_ - 1.);
+        return numerator / denominator - a_ * rho;
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      temperature_impl(const Number &rho, const Number &e) const
+      {
+        return (e + a_ * rho) / cv_;
+      }
+
+
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      speed_of_sound_impl(const Number &rho, const Number &e) const
       {
         const auto covolume = 1. - b_ * rho;
         const auto numerator = gamma_ * (gamma_ - 1.) * (e + a_ * rho);
         return std::sqrt(numerator / (covolume * covolume) - 2. * a_ * rho);
       }
 
-    private:
       double gamma_;
       double b_;
       double a_;
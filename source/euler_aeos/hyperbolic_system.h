@@ -6,6 +6,7 @@
 #pragma once
 
 #include "equation_of_state_library.h"
+#include "equation_of_state_polytropic_gas.h"
 
 #include <compile_time_options.h>
 #include <convenience_macros.h>
@@ -66,6 +67,15 @@ namespace ryujin
         return HyperbolicSystemView<dim, Number>{*this};
       }
 
+      /**
+       * Return a summary of the pressure table of the selected equation
+       * of state, or an empty string if tabulation is disabled.
+       */
+      std::string pressure_table_report() const
+      {
+        return selected_equation_of_state_->pressure_table_report();
+      }
+
     private:
       /**
        * @name Runtime parameters, internal fields, methods, and friends
@@ -78,12 +88,25 @@ namespace ryujin
       double vacuum_state_relaxation_large_;
       bool compute_strict_bounds_;
 
+      dealii::Tensor<1, 3, double> body_force_;
+      double heating_;
+      bool nodal_sources_enabled_;
+
       EquationOfStateLibrary::equation_of_state_list_type
           equation_of_state_list_;
 
       using EquationOfState = EquationOfStateLibrary::EquationOfState;
       std::shared_ptr<EquationOfState> selected_equation_of_state_;
 
+      /*
+       * Set to the selected equation of state if it is a polytropic gas.
+       * The HyperbolicSystemView then evaluates the closed-form
+       * expressions inline instead of calling through the virtual
+       * EquationOfState interface.
+       */
+      using PolytropicGas = EquationOfStateLibrary::PolytropicGas;
+      std::shared_ptr<const PolytropicGas> polytropic_gas_;
+
       template <int dim, typename Number>
       friend class HyperbolicSystemView;
       //@}
@@ -160,6 +183,25 @@ namespace ryujin
         return hyperbolic_system_.vacuum_state_relaxation_large_;
       }
 
+      DEAL_II_ALWAYS_INLINE inline ScalarNumber heating() const
+      {
+        return hyperbolic_system_.heating_;
+      }
+
+      DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, dim, ScalarNumber>
+      body_force() const
+      {
+        dealii::Tensor<1, dim, ScalarNumber> result;
+        for (unsigned int d = 0; d < dim; ++d)
+          result[d] = hyperbolic_system_.body_force_[d];
+        return result;
+      }
+
+      DEAL_II_ALWAYS_INLINE inline bool nodal_sources_enabled() const
+      {
+        return hyperbolic_system_.nodal_sources_enabled_;
+      }
+
       DEAL_II_ALWAYS_INLINE inline bool compute_strict_bounds() const
       {
         return hyperbolic_system_.compute_strict_bounds_;
@@ -178,11 +220,24 @@ namespace ryujin
       DEAL_II_ALWAYS_INLINE inline Number eos_pressure(const Number &rho,
                                                        const Number &e) const
       {
+        if (const auto &gas = hyperbolic_system_.polytropic_gas_; gas)
+          return gas->pressure_impl(rho, e);
+
         const auto &eos = hyperbolic_system_.selected_equation_of_state_;
 
+        const auto table = eos->pressure_table();
+        if (table != nullptr && table->in_range(rho, e))
+          return table->evaluate(rho, e);
+
         if constexpr (std::is_same_v<ScalarNumber, Number>) {
           return ScalarNumber(eos->pressure(rho, e));
         } else {
+          if (eos->prefer_vector_interface() &&
+              eos->thread_safe_vector_interface())
+            return batched_eos_call(rho, e, [&](auto &&...args) {
+              eos->pressure(args...);
+            });
+
           Number p;
           for (unsigned int k = 0; k < Number::size(); ++k) {
             p[k] = ScalarNumber(eos->pressure(rho[k], e[k]));
@@ -198,11 +253,20 @@ namespace ryujin
       DEAL_II_ALWAYS_INLINE inline Number
       eos_specific_internal_energy(const Number &rho, const Number &p) const
       {
+        if (const auto &gas = hyperbolic_system_.polytropic_gas_; gas)
+          return gas->specific_internal_energy_impl(rho, p);
+
         const auto &eos = hyperbolic_system_.selected_equation_of_state_;
 
         if constexpr (std::is_same_v<ScalarNumber, Number>) {
           return ScalarNumber(eos->specific_internal_energy(rho, p));
         } else {
+          if (eos->prefer_vector_interface() &&
+              eos->thread_safe_vector_interface())
+            return batched_eos_call(rho, p, [&](auto &&...args) {
+              eos->specific_internal_energy(args...);
+            });
+
           Number e;
           for (unsigned int k = 0; k < Number::size(); ++k) {
             e[k] = ScalarNumber(eos->specific_internal_energy(rho[k], p[k]));
@@ -218,11 +282,20 @@ namespace ryujin
       DEAL_II_ALWAYS_INLINE inline Number eos_temperature(const Number &rho,
                                                           const Number &e) const
       {
+        if (const auto &gas = hyperbolic_system_.polytropic_gas_; gas)
+          return gas->temperature_impl(rho, e);
+
         const auto &eos = hyperbolic_system_.selected_equation_of_state_;
 
         if constexpr (std::is_same_v<ScalarNumber, Number>) {
           return ScalarNumber(eos->temperature(rho, e));
         } else {
+          if (eos->prefer_vector_interface() &&
+              eos->thread_safe_vector_interface())
+            return batched_eos_call(rho, e, [&](auto &&...args) {
+              eos->temperature(args...);
+            });
+
           Number temp;
           for (unsigned int k = 0; k < Number::size(); ++k) {
             temp[k] = ScalarNumber(eos->temperature(rho[k], e[k]));
@@ -238,11 +311,20 @@ namespace ryujin
       DEAL_II_ALWAYS_INLINE inline Number
       eos_speed_of_sound(const Number &rho, const Number &e) const
       {
+        if (const auto &gas = hyperbolic_system_.polytropic_gas_; gas)
+          return gas->speed_of_sound_impl(rho, e);
+
         const auto &eos = hyperbolic_system_.selected_equation_of_state_;
 
         if constexpr (std::is_same_v<ScalarNumber, Number>) {
           return ScalarNumber(eos->speed_of_sound(rho, e));
         } else {
+          if (eos->prefer_vector_interface() &&
+              eos->thread_safe_vector_interface())
+            return batched_eos_call(rho, e, [&](auto &&...args) {
+              eos->speed_of_sound(args...);
+            });
+
           Number c;
           for (unsigned int k = 0; k < Number::size(); ++k) {
             c[k] = ScalarNumber(eos->speed_of_sound(rho[k], e[k]));
@@ -300,6 +382,31 @@ namespace ryujin
     private:
       const HyperbolicSystem &hyperbolic_system_;
 
+      /**
+       * Evaluate an equation of state function for all lanes of @p x and
+       * @p y with a single call into the vector interface @p batch.
+       */
+      template <typename Callable>
+      DEAL_II_ALWAYS_INLINE inline Number batched_eos_call(
+          const Number &x, const Number &y, const Callable &batch) const
+      {
+        constexpr auto width = Number::size();
+        std::array<double, width> result, x_copy, y_copy;
+        for (unsigned int k = 0; k < width; ++k) {
+          x_copy[k] = x[k];
+          y_copy[k] = y[k];
+        }
+
+        batch(dealii::ArrayView<double>(result.data(), width),
+              dealii::ArrayView<double>(x_copy.data(), width),
+              dealii::ArrayView<double>(y_copy.data(), width));
+
+        Number value;
+        for (unsigned int k = 0; k < width; ++k)
+          value[k] = ScalarNumber(result[k]);
+        return value;
+      }
+
     public:
       //@}
       /**
@@ -432,6 +539,32 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 2;
 
+      /**
+       * The components of the precomputed vector that have to be
+       * exchanged with neighboring MPI ranks after precomputation cycle
+       * @p cycle. Cycle 1 only reads the pressure of neighboring degrees
+       * of freedom and leaves the pressure unchanged, so that it suffices
+       * to exchange the pressure after cycle 0 and the remaining values
+       * after cycle 1.
+       */
+      static constexpr std::bitset<n_precomputed_values>
+      precomputed_ghost_components(const unsigned int cycle)
+      {
+        return cycle == 0 ? 0b0001 : 0b1110;
+      }
+
+      /**
+       * Return true if the precomputed values of precomputation cycle
+       * @p cycle are a pointwise function of the state. This is the case
+       * for the pressure and the surrogate gamma computed in cycle 0,
+       * but not for cycle 1 that takes the minimum of the surrogate gamma
+       * over the stencil.
+       */
+      static constexpr bool pointwise_precomputation(const unsigned int cycle)
+      {
+        return cycle == 0;
+      }
+
       /**
        * Step 0: precompute values for hyperbolic update. This routine is
        * called within our usual loop() idiom in HyperbolicModule
@@ -690,18 +823,37 @@ namespace ryujin
        */
       //@{
 
-      /** We do not have source terms */
-      static constexpr bool have_source_terms = false;
+      /**
+       * We have (optional) source terms: a constant body force
+       * \f$\mathbf g\f$ per unit mass and a constant volumetric heat
+       * source \f$q\f$, i.e.,
+       * \f{align}
+       *   \mathbf S(\mathbf U) = \big[0,\;\rho\,\mathbf g,\;
+       *   \mathbf m\cdot\mathbf g + q\big]^T.
+       * \f}
+       * The source terms are disabled at run time (see
+       * nodal_sources_enabled()) if both "body force" and "heating" are
+       * zero.
+       */
+      static constexpr bool have_source_terms = true;
+
+      /** We do not have source terms treated with an operator split */
+      static constexpr bool have_split_source_terms = false;
+
+      /**
+       * Evaluate the source term for the state @p U.
+       */
+      state_type constant_source(const state_type &U) const;
 
       state_type nodal_source(const PrecomputedVector &pv,
                               const unsigned int i,
                               const state_type &U_i,
-                              const ScalarNumber tau) const = delete;
+                              const ScalarNumber tau) const;
 
       state_type nodal_source(const PrecomputedVector &pv,
                               const unsigned int *js,
                               const state_type &U_j,
-                              const ScalarNumber tau) const = delete;
+                              const ScalarNumber tau) const;
 
       //@}
       /**
@@ -805,6 +957,27 @@ namespace ryujin
                     vacuum_state_relaxation_large_,
                     "Problem specific vacuum relaxation parameter");
 
+      body_force_ = dealii::Tensor<1, 3, double>();
+      add_parameter("body force",
+                    body_force_,
+                    "Constant body force per unit mass, for example "
+                    "gravitational acceleration. Only the first dim "
+                    "components are used");
+
+      heating_ = 0.;
+      add_parameter("heating",
+                    heating_,
+                    "Constant volumetric heat source (energy per unit volume "
+                    "and time)");
+
+      const auto check_nodal_sources = [this] {
+        nodal_sources_enabled_ = body_force_.norm() != 0. || heating_ != 0.;
+      };
+
+      check_nodal_sources();
+      ParameterAcceptor::parse_parameters_call_back.connect(
+          check_nodal_sources);
+
       /*
        * And finally populate the equation of state list with all equation of
        * state configurations defined in the EquationOfState namespace:
@@ -819,6 +992,7 @@ namespace ryujin
           /* Populate EOS-specific quantities and functions */
           if (it->name() == equation_of_state_) {
             selected_equation_of_state_ = it;
+            polytropic_gas_ = std::dynamic_pointer_cast<PolytropicGas>(it);
             problem_name =
                 "Compressible Euler equations (" + it->name() + " EOS)";
             initialized = true;
@@ -858,8 +1032,65 @@ namespace ryujin
       const auto &eos = hyperbolic_system_.selected_equation_of_state_;
       unsigned int stride_size = get_stride_size<Number>;
 
+      /* The polytropic fast path is best evaluated for every DoF: */
+      const bool use_vector_interface =
+          eos->prefer_vector_interface() && !hyperbolic_system_.polytropic_gas_;
+
       if (cycle == 0) {
-        if (eos->prefer_vector_interface()) {
+        if (use_vector_interface && eos->thread_safe_vector_interface()) {
+          /*
+           * Collect blocks of rho and e values in thread local storage and
+           * make a single call into the vector interface of the eos per
+           * block. The block size is chosen such that the three buffers
+           * stay resident in the L2 cache.
+           */
+          constexpr unsigned int block_size = 2048;
+          static_assert(block_size % get_stride_size<Number> == 0);
+
+          thread_local static std::vector<double> p(block_size);
+          thread_local static std::vector<double> rho(block_size);
+          thread_local static std::vector<double> e(block_size);
+
+          RYUJIN_OMP_FOR
+          for (unsigned int block = left; block < right; block += block_size) {
+            const auto size = std::min(block_size, right - block);
+
+            for (unsigned int i = 0; i < size; i += stride_size) {
+              const auto U_i = U.template get_tensor<Number>(block + i);
+              const auto rho_i = density(U_i);
+              const auto e_i = internal_energy(U_i) / rho_i;
+              /*
+               * Populate rho and e also for interpolated values from
+               * constrainted degrees of freedom so that the vectors
+               * contain physically admissible entries throughout.
+               */
+              write_entry<Number>(rho, rho_i, i);
+              write_entry<Number>(e, e_i, i);
+            }
+
+            eos->pressure(dealii::ArrayView<double>(p.data(), size),
+                          dealii::ArrayView<double>(rho.data(), size),
+                          dealii::ArrayView<double>(e.data(), size));
+
+            for (unsigned int i = 0; i < size; i += stride_size) {
+              /* Skip constrained degrees of freedom: */
+              const unsigned int row_length =
+                  sparsity_simd.row_length(block + i);
+              if (row_length == 1)
+                continue;
+
+              dispatch_check(block + i);
+
+              using PT = precomputed_type;
+              const auto U_i = U.template get_tensor<Number>(block + i);
+              const auto p_i = get_entry<Number>(p, i);
+              const auto gamma_i = surrogate_gamma(U_i, p_i);
+              const PT prec_i{p_i, gamma_i, Number(0.), Number(0.)};
+              precomputed.template write_tensor<Number>(prec_i, block + i);
+            }
+          }
+
+        } else if (use_vector_interface) {
           /*
            * Set up temporary storage for p, rho, e and make two calls into
            * the eos library.
@@ -900,11 +1131,12 @@ namespace ryujin
           RYUJIN_OMP_FOR
           for (unsigned int i = 0; i < size; i += stride_size) {
             /* Skip constrained degrees of freedom: */
-            const unsigned int row_length = sparsity_simd.row_length(i);
+            const unsigned int row_length =
+                sparsity_simd.row_length(offset + i);
             if (row_length == 1)
               continue;
 
-            dispatch_check(i);
+            dispatch_check(offset + i);
 
             using PT = precomputed_type;
             const auto U_i = U.template get_tensor<Number>(offset + i);
@@ -1524,5 +1756,49 @@ namespace ryujin
         result[1 + d] = M[d];
       return result;
     }
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::constant_source(
+        const state_type &U) const -> state_type
+    {
+      const auto rho = density(U);
+      const auto m = momentum(U);
+      const auto g = body_force();
+
+      state_type result;
+      for (unsigned int d = 0; d < dim; ++d) {
+        result[1 + d] = g[d] * rho;
+        result[dim + 1] += g[d] * m[d];
+      }
+      result[dim + 1] += Number(heating());
+
+      return result;
+    }
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::nodal_source(
+        const PrecomputedVector & /*pv*/,
+        const unsigned int /*i*/,
+        const state_type &U_i,
+        const ScalarNumber /*tau*/) const -> state_type
+    {
+      return constant_source(U_i);
+    }
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::nodal_source(
+        const PrecomputedVector & /*pv*/,
+        const unsigned int * /*js*/,
+        const state_type &U_j,
+        const ScalarNumber /*tau*/) const -> state_type
+    {
+      return constant_source(U_j);
+    }
   } // namespace EulerAEOS
 } // namespace ryujin
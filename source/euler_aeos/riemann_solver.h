@@ -12,6 +12,8 @@
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
 
+#include <atomic>
+
 namespace ryujin
 {
   namespace EulerAEOS
@@ -23,7 +25,52 @@ namespace ryujin
       RiemannSolverParameters(const std::string &subsection = "/RiemannSolver")
           : ParameterAcceptor(subsection)
       {
+        fast_gamma_tolerance_ = ScalarNumber(0.);
+        add_parameter(
+            "fast gamma tolerance",
+            fast_gamma_tolerance_,
+            "If set to a positive value, edges whose surrogate gamma values "
+            "differ by less than this relative tolerance use a cheaper "
+            "pressure bound that replaces the power of the pressure ratio "
+            "involving the difference of the gamma values by a lower bound "
+            "without a pow() call. The resulting wavespeed estimate is "
+            "still a guaranteed upper bound. The fast path is only used "
+            "if strict bounds are not enforced. A value of zero disables "
+            "the fast path");
+
+        n_edges_ = 0;
+        n_fast_edges_ = 0;
+      }
+
+      ACCESSOR_READ_ONLY(fast_gamma_tolerance);
+
+      /**
+       * Accumulate edge statistics of a RiemannSolver instance.
+       */
+      void record_edges(unsigned long n_edges,
+                        unsigned long n_fast_edges) const
+      {
+        n_edges_ += n_edges;
+        n_fast_edges_ += n_fast_edges;
       }
+
+      /**
+       * Return the fraction of (rank-local) edges for which the fast
+       * pressure bound was used, accumulated over the lifetime of the
+       * object. Returns a negative value if no statistics have been
+       * recorded.
+       */
+      double fast_edge_fraction() const
+      {
+        const double n_edges = n_edges_;
+        return n_edges == 0. ? -1. : n_fast_edges_ / n_edges;
+      }
+
+    private:
+      ScalarNumber fast_gamma_tolerance_;
+
+      mutable std::atomic<unsigned long> n_edges_;
+      mutable std::atomic<unsigned long> n_fast_edges_;
     };
 
 
@@ -86,7 +133,19 @@ namespace ryujin
           : hyperbolic_system(hyperbolic_system)
           , parameters(parameters)
           , precomputed_values(precomputed_values)
+          , n_edges_(0)
+          , n_fast_edges_(0)
+      {
+      }
+
+      /**
+       * Destructor. Records the edge statistics gathered by this object
+       * in the Parameters object.
+       */
+      ~RiemannSolver()
       {
+        if (n_edges_ > 0)
+          parameters.record_edges(n_edges_, n_fast_edges_);
       }
 
       /**
@@ -165,11 +224,29 @@ namespace ryujin
        *
        * Cost: 3x pow, 9x division, 2x sqrt
        *
+       * If the "fast gamma tolerance" is positive and the surrogate gamma
+       * values of all lanes differ by less than the tolerance, the power
+       * of the pressure ratio with the (small) r-exponent is replaced by
+       * a lower bound, reducing the cost to 2x pow, 10x division.
+       *
        * @todo improve documentation
        */
       Number p_star_interpolated(const primitive_type &riemann_data_i,
                                  const primitive_type &riemann_data_j) const;
 
+      /**
+       * Return the factor \f$(p_{\min}/p_{\max})^r\f$ used in
+       * p_star_interpolated(), or a lower bound of it if the relative
+       * difference @p gamma_difference of the surrogate gamma values is
+       * below the "fast gamma tolerance". Also records the edge
+       * statistics.
+       *
+       * Cost: 1x pow, 0x division (full), 0x pow, 1x division (fast)
+       */
+      Number pressure_ratio_r_factor(const Number &p_ratio,
+                                     const Number &r_exponent,
+                                     const Number &gamma_difference) const;
+
 
 #ifndef DOXYGEN
       /*
@@ -253,6 +330,9 @@ namespace ryujin
       const HyperbolicSystem &hyperbolic_system;
       const Parameters &parameters;
       const PrecomputedVector &precomputed_values;
+
+      mutable unsigned long n_edges_;
+      mutable unsigned long n_fast_edges_;
       //@}
     };
   } // namespace EulerAEOS
@@ -300,6 +300,66 @@ namespace ryujin
     }
 
 
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline Number
+    RiemannSolver<dim, Number>::pressure_ratio_r_factor(
+        const Number &p_ratio,
+        const Number &r_exponent,
+        const Number &gamma_difference) const
+    {
+      const auto tolerance = parameters.fast_gamma_tolerance();
+      if (tolerance <= ScalarNumber(0.))
+        return ryujin::pow(p_ratio, r_exponent);
+
+      /*
+       * For 0 < x <= 1 and r >= 0 we have
+       *
+       *   x^r = exp(r ln x) >= 1 + r ln x >= 1 - r (1 - x) / x,
+       *
+       * and the right hand side is close to x^r for a small r-exponent,
+       * i.e., for nearly identical surrogate gamma values. The factor
+       * enters the denominator of p_star_interpolated(), so the smaller
+       * value only increases the pressure estimate and the wavespeed
+       * estimate remains a guaranteed upper bound.
+       */
+
+      const Number lower_bound =
+          std::max(Number(0.),
+                   Number(1.) - r_exponent * (Number(1.) - p_ratio) / p_ratio);
+
+      constexpr auto lte = dealii::SIMDComparison::less_than_or_equal;
+      const Number fast = dealii::compare_and_apply_mask<lte>(
+          gamma_difference, Number(tolerance), Number(1.), Number(0.));
+
+      unsigned int n_fast = 0;
+      if constexpr (std::is_same_v<ScalarNumber, Number>) {
+        n_fast = static_cast<unsigned int>(fast);
+      } else {
+        for (unsigned int k = 0; k < Number::size(); ++k)
+          n_fast += static_cast<unsigned int>(fast[k]);
+      }
+
+      const unsigned int width = get_stride_size<Number>;
+      n_edges_ += width;
+      n_fast_edges_ += n_fast;
+
+      if (n_fast == width)
+        return lower_bound;
+
+      /*
+       * Compute the power for the whole batch and blend in the lower
+       * bound for fast lanes. This keeps the result of an edge
+       * independent of the other edges in the SIMD batch:
+       */
+
+      return dealii::compare_and_apply_mask<lte>(
+          gamma_difference,
+          Number(tolerance),
+          lower_bound,
+          ryujin::pow(p_ratio, r_exponent));
+    }
+
+
     template <int dim, typename Number>
     DEAL_II_ALWAYS_INLINE inline Number
     RiemannSolver<dim, Number>::p_star_interpolated(
@@ -373,8 +433,11 @@ namespace ryujin
       const Number numerator =
           positive_part(alpha_hat_min + /*SIC!*/ alpha_max - (u_j - u_i));
 
+      const Number r_factor = pressure_ratio_r_factor(
+          p_ratio, r_exponent, (gamma_M - gamma_m) / gamma_m);
+
       Number denominator = alpha_hat_min * ryujin::pow(p_ratio, -exponent) +
-                           alpha_hat_max * ryujin::pow(p_ratio, r_exponent);
+                           alpha_hat_max * r_factor;
 
       const Number p_tilde =
           p_max * ryujin::pow(numerator / denominator, exponent_inverse) - pinf;
@@ -0,0 +1,162 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 - 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/function_parser.h>
+#include <deal.II/base/point.h>
+
+#ifdef DEAL_II_WITH_SYMENGINE
+#include <deal.II/differentiation/sd.h>
+#endif
+
+#include <array>
+#include <memory>
+#include <string>
+
+namespace ryujin
+{
+  /**
+   * A small wrapper around a set of @p n_components scalar function
+   * expressions in the spatial coordinates "x", "y", "z" and time "t"
+   * that are evaluated together at a given point.
+   *
+   * By default, every expression is evaluated with a
+   * dealii::FunctionParser object (i.e., interpreted by muparser). If
+   * @p compile is set to true (and deal.II was configured with SymEngine)
+   * then all expressions are instead parsed by SymEngine, optimized
+   * (common subexpression elimination) as a batch, and compiled to
+   * native code, using the LLVM JIT if SymEngine was configured with LLVM
+   * support and a lambda-based evaluator otherwise. Note that SymEngine
+   * only accepts regular algebraic expressions and elementary functions,
+   * muparser specific syntax (such as the ternary "?:" operator) is not
+   * supported.
+   *
+   * Both variants store the current point and time internally, so that
+   * concurrent calls to value() on the same object are not permitted.
+   *
+   * @ingroup Miscellaneous
+   */
+  template <int dim, std::size_t n_components>
+  class ExpressionFunction
+  {
+  public:
+    /**
+     * Constructor.
+     */
+    ExpressionFunction(const std::array<std::string, n_components> &expressions,
+                       const bool compile = false);
+
+    /**
+     * Evaluate all expressions at point @p point and time @p t.
+     */
+    std::array<double, n_components> value(const dealii::Point<dim> &point,
+                                           const double t);
+
+  private:
+    std::array<std::unique_ptr<dealii::FunctionParser<dim>>, n_components>
+        parsers_;
+
+#ifdef DEAL_II_WITH_SYMENGINE
+    bool compiled_;
+    std::array<dealii::Differentiation::SD::Expression, dim + 1> symbols_;
+    std::array<dealii::Differentiation::SD::Expression, n_components>
+        functions_;
+    std::unique_ptr<dealii::Differentiation::SD::BatchOptimizer<double>>
+        optimizer_;
+#endif
+  };
+
+
+  // ------------------------------- inline functions --------------------------
+
+
+  template <int dim, std::size_t n_components>
+  inline ExpressionFunction<dim, n_components>::ExpressionFunction(
+      const std::array<std::string, n_components> &expressions,
+      const bool compile [[maybe_unused]])
+  {
+#ifdef DEAL_II_WITH_SYMENGINE
+    compiled_ = compile;
+    if (compiled_) {
+      namespace SD = dealii::Differentiation::SD;
+
+      static constexpr const char *names[] = {"x", "y", "z"};
+      for (int d = 0; d < dim; ++d)
+        symbols_[d] = SD::make_symbol(names[d]);
+      symbols_[dim] = SD::make_symbol("t");
+
+      for (std::size_t c = 0; c < n_components; ++c)
+        functions_[c] = SD::Expression(expressions[c],
+                                       /*parse_as_expression*/ true);
+
+#ifdef DEAL_II_SYMENGINE_WITH_LLVM
+      constexpr auto optimizer_type = SD::OptimizerType::llvm;
+#else
+      constexpr auto optimizer_type = SD::OptimizerType::lambda;
+#endif
+      optimizer_ = std::make_unique<SD::BatchOptimizer<double>>(
+          optimizer_type, SD::OptimizationFlags::optimize_all);
+
+      SD::types::substitution_map symbol_map;
+      for (const auto &symbol : symbols_)
+        SD::add_to_symbol_map(symbol_map, symbol);
+      optimizer_->register_symbols(symbol_map);
+      for (const auto &function : functions_)
+        optimizer_->register_function(function);
+      optimizer_->optimize();
+      return;
+    }
+#else
+    AssertThrow(!compile,
+                dealii::ExcMessage("Compiling function expressions requires "
+                                   "deal.II to be configured with SymEngine"));
+#endif
+
+    /*
+     * This variant of the constructor initializes the function parser
+     * with support for a time-dependent description involving a variable
+     * »t«:
+     */
+    using FP = dealii::FunctionParser<dim>;
+    for (std::size_t c = 0; c < n_components; ++c)
+      parsers_[c] = std::make_unique<FP>(expressions[c]);
+  }
+
+
+  template <int dim, std::size_t n_components>
+  inline std::array<double, n_components>
+  ExpressionFunction<dim, n_components>::value(const dealii::Point<dim> &point,
+                                               const double t)
+  {
+    std::array<double, n_components> result;
+
+#ifdef DEAL_II_WITH_SYMENGINE
+    if (compiled_) {
+      namespace SD = dealii::Differentiation::SD;
+
+      SD::types::substitution_map substitution_map;
+      for (int d = 0; d < dim; ++d)
+        SD::add_to_substitution_map(substitution_map, symbols_[d], point[d]);
+      SD::add_to_substitution_map(substitution_map, symbols_[dim], t);
+      optimizer_->substitute(substitution_map);
+
+      for (std::size_t c = 0; c < n_components; ++c)
+        result[c] = optimizer_->evaluate(functions_[c]);
+      return result;
+    }
+#endif
+
+    for (std::size_t c = 0; c < n_components; ++c) {
+      parsers_[c]->set_time(t);
+      result[c] = parsers_[c]->value(point);
+    }
+    return result;
+  }
+
+} // namespace ryujin
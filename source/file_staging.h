@@ -0,0 +1,163 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <deal.II/base/exceptions.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * A long-lived worker thread that drains files from a (fast, node
+   * local) staging directory to their final location on a (slow)
+   * parallel file system.
+   *
+   * Output is first written into a staging directory. Afterwards, drain()
+   * queues all complete files of the staging directory that start with a
+   * given prefix, and the files are moved in the order they were queued.
+   * Every file is copied to a temporary file next to its final location
+   * and then renamed, so a file either appears completely or not at all.
+   * The worker only performs file system operations and thus does not
+   * interfere with MPI communication. All queued files are drained before
+   * the program exits. A file that cannot be drained remains in the
+   * staging directory and an error is printed to std::cerr.
+   *
+   * @ingroup Miscellaneous
+   */
+  class FileStaging
+  {
+  public:
+    /**
+     * Return a reference to the (sole) drainer thread.
+     */
+    static FileStaging &instance()
+    {
+      static FileStaging file_staging;
+      return file_staging;
+    }
+
+    /**
+     * Move all regular files in @p staging_directory whose name starts
+     * with @p prefix into @p target_directory. The function returns
+     * immediately.
+     *
+     * @note The files must be complete and must not be modified after
+     * the call.
+     */
+    void drain(const std::string &staging_directory,
+               const std::string &prefix,
+               const std::string &target_directory)
+    {
+      std::vector<Job> jobs;
+      for (const auto &entry :
+           std::filesystem::directory_iterator(staging_directory)) {
+        const auto name = entry.path().filename().string();
+        if (entry.is_regular_file() && name.rfind(prefix, 0) == 0)
+          jobs.push_back({entry.path(),
+                          std::filesystem::path(target_directory) / name,
+                          entry.file_size()});
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &job : jobs) {
+          backlog_bytes_ += job.size;
+          queue_.push_back(std::move(job));
+        }
+      }
+      condition_.notify_one();
+    }
+
+    /**
+     * Return the number of bytes that have been queued but not yet been
+     * drained.
+     */
+    double backlog() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return backlog_bytes_;
+    }
+
+    FileStaging(const FileStaging &) = delete;
+    FileStaging &operator=(const FileStaging &) = delete;
+
+  private:
+    struct Job {
+      std::filesystem::path source;
+      std::filesystem::path target;
+      std::uintmax_t size;
+    };
+
+    FileStaging()
+        : backlog_bytes_(0.)
+        , stop_(false)
+        , thread_([this]() { run(); })
+    {
+    }
+
+    ~FileStaging()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      condition_.notify_one();
+      thread_.join();
+    }
+
+    void run()
+    {
+      while (true) {
+        Job job;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          condition_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+          if (queue_.empty())
+            return;
+          job = std::move(queue_.front());
+          queue_.pop_front();
+        }
+
+        /*
+         * On failure the file stays in the staging directory and we only
+         * report the error: the simulation itself must not be aborted.
+         */
+        try {
+          auto temporary = job.target;
+          temporary += ".part";
+          std::filesystem::copy_file(
+              job.source,
+              temporary,
+              std::filesystem::copy_options::overwrite_existing);
+          std::filesystem::rename(temporary, job.target);
+          std::filesystem::remove(job.source);
+        } catch (const std::filesystem::filesystem_error &error) {
+          std::cerr << "Could not drain staged file: " << error.what()
+                    << std::endl;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        backlog_bytes_ -= job.size;
+      }
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<Job> queue_;
+    double backlog_bytes_;
+    bool stop_;
+    std::thread thread_;
+  };
+} // namespace ryujin
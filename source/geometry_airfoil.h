@@ -670,7 +670,6 @@ namespace ryujin
 
       Assert(0. < x_center && x_center < 1., dealii::ExcInternalError());
 
-#ifdef DEAL_II_WITH_GSL
       CubicSpline upper_airfoil(x_upper, y_upper);
       auto psi_upper =
           [upper_airfoil, x_center, y_center, scaling](const double x_hat) {
@@ -766,12 +765,6 @@ namespace ryujin
       };
 
       return {{psi_front, psi_upper, psi_lower}};
-#else
-      AssertThrow(
-          false,
-          dealii::ExcNotImplemented("Airfoil grid needs deal.II with GSL"));
-      return {};
-#endif
     }
 
 
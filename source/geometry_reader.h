@@ -2,9 +2,12 @@
 
 #include "geometry_common_includes.h"
 
+#include <deal.II/base/mpi.h>
 #include <deal.II/grid/grid_in.h>
 
 #include <fstream>
+#include <tuple>
+#include <vector>
 
 namespace ryujin
 {
@@ -20,6 +23,14 @@ namespace ryujin
      * file. Supported boundary IDs and their meaning are collected in the
      * Boundary enum.
      *
+     * If "read on single rank" is set, the mesh file is parsed only by
+     * MPI rank 0 and the coarse mesh description (vertices, cells with
+     * their material ids, and boundary faces with their boundary ids) is
+     * broadcast to all other ranks. This avoids that every rank reads
+     * and parses a large mesh file concurrently. Note that the coarse
+     * mesh is nevertheless replicated on every rank by the distributed
+     * triangulation.
+     *
      * @ingroup Mesh
      */
     template <int dim>
@@ -35,18 +46,55 @@ namespace ryujin
                             "The mesh file to read in via dealii::GridIn. This "
                             "class supports, among others, reading in Gmsh "
                             "*.msh files, and the *.ucd file format.");
+
+        read_on_single_rank_ = false;
+        this->add_parameter("read on single rank",
+                            read_on_single_rank_,
+                            "If set to true the mesh file is only read by "
+                            "rank 0 and the coarse mesh is broadcast to all "
+                            "other MPI ranks");
       }
 
       void create_triangulation(
           typename Geometry<dim>::Triangulation &triangulation) final
       {
-        dealii::GridIn<dim> gridin;
-        gridin.attach_triangulation(triangulation);
-        gridin.read(filename_);
+        if (!read_on_single_rank_) {
+          dealii::GridIn<dim> gridin;
+          gridin.attach_triangulation(triangulation);
+          gridin.read(filename_);
+          return;
+        }
+
+        const auto &mpi_communicator = triangulation.get_mpi_communicator();
+
+        std::vector<dealii::Point<dim>> vertices;
+        std::vector<dealii::CellData<dim>> cells;
+        dealii::SubCellData subcell_data;
+
+        if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
+          dealii::Triangulation<dim> serial_triangulation;
+          dealii::GridIn<dim> gridin;
+          gridin.attach_triangulation(serial_triangulation);
+          gridin.read(filename_);
+          std::tie(vertices, cells, subcell_data) =
+              dealii::GridTools::get_coarse_mesh_description(
+                  serial_triangulation);
+        }
+
+        vertices = dealii::Utilities::MPI::broadcast(mpi_communicator,
+                                                     vertices);
+        cells = dealii::Utilities::MPI::broadcast(mpi_communicator, cells);
+        subcell_data.boundary_lines = dealii::Utilities::MPI::broadcast(
+            mpi_communicator, subcell_data.boundary_lines);
+        subcell_data.boundary_quads = dealii::Utilities::MPI::broadcast(
+            mpi_communicator, subcell_data.boundary_quads);
+
+        triangulation.create_triangulation(vertices, cells, subcell_data);
       }
 
     private:
       std::string filename_;
+      bool read_on_single_rank_;
     };
   } // namespace Geometries
 } // namespace ryujin
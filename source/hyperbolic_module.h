@@ -7,9 +7,12 @@
 
 #include <compile_time_options.h>
 
+#include "aggregated_ghost_exchange.h"
 #include "convenience_macros.h"
 #include "initial_values.h"
 #include "offline_data.h"
+#include "openmp.h"
+#include "scope.h"
 #include "sparse_matrix_simd.h"
 #include "state_vector.h"
 
@@ -19,7 +22,13 @@
 #include <deal.II/lac/sparse_matrix.templates.h>
 #include <deal.II/lac/vector.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <numeric>
 
 namespace ryujin
 {
@@ -67,6 +76,19 @@ namespace ryujin
    *
    * This module is described in detail in @cite ryujin-2021-1, Alg. 1.
    *
+   * All steps are implemented as row-wise loops over SparsityPatternSIMD
+   * that are parallelized with OpenMP (see RYUJIN_PARALLEL_REGION_BEGIN)
+   * and vectorized with dealii::VectorizedArray on the range of locally
+   * internal rows. The local index range is ordered as export indices,
+   * internal rows, and remaining owned rows; the ghost exchange of the
+   * export range is started from within the loops via a
+   * SynchronizationDispatch object. Every equation dependent computation
+   * is delegated to the (header only) classes of the @p Description,
+   * i.e., the HyperbolicSystemView, RiemannSolver, Indicator, and
+   * Limiter, with the row index and the gathered states as the only
+   * interface. An accelerator backend would have to retain this
+   * ordering and interface.
+   *
    * @ingroup HyperbolicModule
    */
   template <typename Description, int dim, typename Number = double>
@@ -109,7 +131,7 @@ namespace ryujin
      */
     HyperbolicModule(
         const MPI_Comm &mpi_communicator,
-        std::map<std::string, dealii::Timer> &computing_timer,
+        std::map<std::string, SectionTimer> &computing_timer,
         const OfflineData<dim, Number> &offline_data,
         const HyperbolicSystem &hyperbolic_system,
         const InitialValues<Description, dim, Number> &initial_values,
@@ -122,6 +144,20 @@ namespace ryujin
      */
     void prepare();
 
+    /**
+     * Return a mutable reference to the Dirichlet data used for every
+     * entry of OfflineData::boundary_table() when applying boundary
+     * conditions. If the data has not been precomputed by prepare()
+     * (because the initial state is time dependent) it is populated with
+     * the initial state at time @p t and kept fixed afterwards.
+     *
+     * Modifying the returned values between time steps allows to inject
+     * boundary data from an external solver without calling prepare()
+     * again. The reference remains valid until the next call to prepare(),
+     * which recomputes (or clears) the data.
+     */
+    std::vector<state_type> &dirichlet_data(const Number t);
+
     //@}
     /**
      * @name Functons for performing explicit time steps
@@ -222,6 +258,20 @@ namespace ryujin
         Number tau = Number(0.),
         std::atomic<Number> tau_max = std::numeric_limits<Number>::max()) const;
 
+    /**
+     * Apply the pointwise implicit update of all source terms that are
+     * treated with an operator split (see
+     * HyperbolicSystemView::have_split_source_terms) to the locally owned
+     * range of @p state_vector for a time step size @p tau. The function
+     * does nothing if the hyperbolic system has no such source terms or
+     * if the operator split is disabled.
+     *
+     * @note Similarly to step() the function does not update ghost ranges
+     * of the state vector. This is done by the subsequent call to
+     * HyperbolicModule::prepare_state_vector().
+     */
+    void apply_split_source_terms(StateVector &state_vector, Number tau) const;
+
     /**
      * Sets the relative CFL number used for computing an appropriate
      * time-step size to the given value. The CFL number must be a positive
@@ -268,12 +318,224 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(n_restarts)
 
+    /**
+     * Return the number of calls to step() since the last call to
+     * prepare().
+     */
+    ACCESSOR_READ_ONLY(n_steps)
+
     /**
      * The number of ID violation warnings encounterd in the step()
      * function.
      */
     ACCESSOR_READ_ONLY(n_warnings)
 
+    /**
+     * Returns an estimate of the number of bytes streamed from main
+     * memory per (locally owned) degree of freedom in Steps 2 - 4 of the
+     * step() function, averaged over all invocations of step() so far.
+     * The estimate is based on a simple traffic model taking into account
+     * column indices, matrix entries and state gathers for each sweep
+     * over the sparsity pattern.
+     */
+    double streamed_bytes_per_dof() const
+    {
+      return n_steps_ == 0 ? 0. : streamed_bytes_accumulated_ / n_steps_;
+    }
+
+    /**
+     * Returns the estimated total number of bytes streamed from main
+     * memory by the individual stages of the step() function, keyed by
+     * the name of the corresponding timer in the computing_timer_ map.
+     * The estimate uses the same per-nonzero traffic model as
+     * streamed_bytes_per_dof() and is accumulated over all invocations
+     * of step(). Dividing by the wall time of the corresponding timer
+     * gives the achieved memory bandwidth of a stage.
+     */
+    const std::map<std::string, double> &kernel_bytes_streamed() const
+    {
+      return kernel_bytes_streamed_;
+    }
+
+    /**
+     * Returns true if the fused low-order update mode is enabled.
+     */
+    ACCESSOR_READ_ONLY(fused_low_order_update)
+
+    /**
+     * Returns the ratio of the maximal and the average per-thread busy
+     * time spent in Step 2 (computation of d_ij and alpha_i) of the step()
+     * function, accumulated since the last call to prepare(). A value of
+     * 1 indicates perfect load balance between threads.
+     */
+    double thread_imbalance() const
+    {
+      if (thread_busy_time_.empty())
+        return 1.;
+      const auto max = *std::max_element(thread_busy_time_.begin(),
+                                         thread_busy_time_.end());
+      const auto sum = std::accumulate(
+          thread_busy_time_.begin(), thread_busy_time_.end(), 0.);
+      return sum == 0. ? 1. : max * thread_busy_time_.size() / sum;
+    }
+
+    /**
+     * Returns the per-thread busy time spent in Step 2 of the step()
+     * function, accumulated since the last call to prepare().
+     */
+    ACCESSOR_READ_ONLY(thread_busy_time)
+
+    /**
+     * Return the number of multirate levels used for classifying degrees
+     * of freedom by their locally admissible time-step size. A value of
+     * zero indicates that the classification is disabled.
+     */
+    ACCESSOR_READ_ONLY(multirate_levels)
+
+    /**
+     * Return the estimated speedup of a multirate (local time stepping)
+     * scheme over global time stepping. Every degree of freedom in level
+     * l could be advanced with a 2^l times larger step size, so that the
+     * estimate is given by the ratio of the number of degrees of freedom
+     * and the sum over n_l 2^(-l). The histogram is accumulated since the
+     * last call to prepare().
+     */
+    double multirate_speedup() const
+    {
+      double n_dofs = 0.;
+      double work = 0.;
+      for (unsigned int l = 0; l < multirate_histogram_.size(); ++l) {
+        n_dofs += multirate_histogram_[l];
+        work += multirate_histogram_[l] / double(1u << l);
+      }
+      return work == 0. ? 1. : n_dofs / work;
+    }
+
+    /**
+     * Return the fraction of (rank-local) upper triangular d_ij entries
+     * that were reused from a previous stage in the "frozen wave speed"
+     * mode, accumulated since the last call to prepare(). Returns a
+     * negative value if the mode is disabled.
+     */
+    double reused_wave_speed_fraction() const
+    {
+      if (frozen_wave_speed_tolerance_ <= Number(0.))
+        return -1.;
+      double n_reused = 0.;
+      double n_total = 0.;
+      for (const auto &[reused, computed] : frozen_edge_statistics_) {
+        n_reused += reused;
+        n_total += reused + computed;
+      }
+      return n_total == 0. ? 0. : n_reused / n_total;
+    }
+
+    /**
+     * Return the fraction of stage flux evaluations in Step 4 of the
+     * step() function that were served from the stage flux cache,
+     * accumulated since the last call to prepare(). Returns a negative
+     * value if the cache is disabled.
+     */
+    double cached_stage_flux_fraction() const
+    {
+      if (!cache_stage_fluxes_)
+        return -1.;
+      const double n_total =
+          n_cached_stage_fluxes_ + n_recomputed_stage_fluxes_;
+      return n_total == 0. ? 0. : n_cached_stage_fluxes_ / n_total;
+    }
+
+    /**
+     * Return the number of (rank-local) sampled bounds checks and the
+     * number of detected violations, accumulated since the last call to
+     * prepare(). Every check covers one row (or one SIMD stride of rows),
+     * see the "bounds check fraction" option. Both numbers are zero if
+     * sampled bounds checks are disabled.
+     */
+    std::array<double, 2> sampled_bounds_checks() const
+    {
+      return {n_bounds_checks_, n_bounds_violations_};
+    }
+
+    /**
+     * Return a mutable reference to the steady state monitor flag. If
+     * set to true, the last high-order pass of step() additionally
+     * computes the lumped mass weighted l1 norms of the rate of change
+     * (U^{n+1} - U^n) / tau and of the new state U^{n+1} as a fused
+     * reduction. The flag is meant to be toggled for the steps that
+     * should be monitored because the reduction reads the old state.
+     */
+    ACCESSOR(monitor_steady_state)
+
+    /**
+     * Return the (rank-local) norms of the rate of change and of the new
+     * state computed by the last monitored step, see
+     * monitor_steady_state().
+     */
+    std::array<double, 2> steady_state_residual() const
+    {
+      return {steady_state_change_, steady_state_norm_};
+    }
+
+    /**
+     * The fraction of rows verified by the sampled bounds check.
+     */
+    ACCESSOR_READ_ONLY(bounds_check_fraction)
+
+    /**
+     * Return an estimate of the (rank-local) memory consumption in bytes
+     * of all temporary vectors and matrices of the module, including the
+     * stage flux cache.
+     */
+    std::size_t memory_consumption() const;
+
+    /**
+     * Return the (rank-local) memory consumption in bytes of the stage
+     * flux cache.
+     */
+    std::size_t stage_flux_cache_memory_consumption() const
+    {
+      std::size_t result = 0;
+      for (const auto &entry : stage_flux_cache_)
+        result += entry.fluxes.memory_consumption();
+      return result;
+    }
+
+    /**
+     * Return the wall time (in seconds) spent per locally owned degree of
+     * freedom in Steps 2 and 4 of the step() function, accumulated since
+     * the last call to prepare(). The vector is empty if the "record dof
+     * cost" option is disabled.
+     */
+    ACCESSOR_READ_ONLY(dof_cost)
+
+    /**
+     * Return a reference to the parameters of the limiter.
+     */
+    ACCESSOR_READ_ONLY(limiter_parameters)
+
+    /**
+     * Return a reference to the parameters of the Riemann solver.
+     */
+    ACCESSOR_READ_ONLY(riemann_solver_parameters)
+
+    /**
+     * Return true if source terms are evaluated with nodal_source() in
+     * the low-order and high-order update. Hyperbolic systems can switch
+     * off their source terms at run time with nodal_sources_enabled().
+     */
+    bool have_nodal_sources() const
+    {
+      if constexpr (!View::have_source_terms) {
+        return false;
+      } else {
+        const auto view = hyperbolic_system_->template view<dim, Number>();
+        if constexpr (requires { view.nodal_sources_enabled(); })
+          return view.nodal_sources_enabled();
+        return true;
+      }
+    }
+
     // FIXME: refactor to function
     mutable IDViolationStrategy id_violation_strategy_;
 
@@ -292,6 +554,28 @@ namespace ryujin
     typename Description::template RiemannSolver<dim, Number>::Parameters
         riemann_solver_parameters_;
 
+    bool fused_low_order_update_;
+    bool overlap_tau_reduction_;
+    bool predictive_time_step_;
+    Number predictive_time_step_safety_;
+    bool vectorize_noninternal_rows_;
+    bool export_rows_first_;
+    bool quantize_limiter_exchange_;
+    unsigned int multirate_levels_;
+    bool local_time_stepping_;
+    Number frozen_wave_speed_tolerance_;
+    Number frozen_wave_speed_inflation_;
+    bool skip_dry_rows_;
+    bool record_dof_cost_;
+    bool cache_stage_fluxes_;
+    bool aggregate_ghost_exchanges_;
+    bool recompute_ghost_precomputed_values_;
+    bool compute_interface_edges_once_;
+    bool pipelined_symmetrization_;
+    std::vector<unsigned int> phase_threads_;
+    double bounds_check_fraction_;
+    double bounds_check_spike_threshold_;
+
     //@}
 
     //@}
@@ -301,7 +585,7 @@ namespace ryujin
     //@{
 
     const MPI_Comm &mpi_communicator_;
-    std::map<std::string, dealii::Timer> &computing_timer_;
+    std::map<std::string, SectionTimer> &computing_timer_;
 
     dealii::SmartPointer<const OfflineData<dim, Number>> offline_data_;
     dealii::SmartPointer<const HyperbolicSystem> hyperbolic_system_;
@@ -314,11 +598,128 @@ namespace ryujin
 
     mutable unsigned int n_warnings_;
 
+    double streamed_bytes_separate_;
+    double streamed_bytes_fused_;
+    mutable double streamed_bytes_accumulated_;
+    std::array<double, 6> sweep_bytes_;
+    mutable std::map<std::string, double> kernel_bytes_streamed_;
+
+    /**
+     * A registered timer slot of step(): the timer and the streamed
+     * bytes counter of a section, and the step number and label the slot
+     * was registered with. Slots are registered on first use, so that
+     * subsequent calls to step() neither construct the section name nor
+     * perform any map lookup.
+     */
+    struct TimerSlot {
+      int step_no = -1;
+      const char *label = nullptr;
+      SectionTimer *timer = nullptr;
+      double *bytes_streamed = nullptr;
+    };
+    mutable std::vector<TimerSlot> timer_slots_;
+
+    /**
+     * Return the registered timer slot @p slot for the section
+     * "time step [H] <step_no> - <label>" (or "time step [H] _ - <label>"
+     * if @p step_no is zero). The section name is only constructed, and
+     * looked up in the computing_timer_ map, when the slot is used for the
+     * first time or with a different step number or label. If
+     * @p track_bytes is set then the slot also refers to the
+     * corresponding entry of kernel_bytes_streamed_.
+     */
+    TimerSlot timer_slot(const unsigned int slot,
+                         const char *label,
+                         const int step_no,
+                         const bool track_bytes) const;
+
+    /**
+     * Return the team size for the parallel region of phase @p phase of
+     * the step() function, see the "phase threads" option.
+     */
+    unsigned int phase_threads(const unsigned int phase) const
+    {
+      const unsigned int n_threads = phase_threads_[phase];
+      return n_threads == 0 ? max_threads()
+                            : std::min(n_threads, max_threads());
+    }
+
+    mutable unsigned int n_steps_;
+
+    mutable std::vector<double> thread_busy_time_;
+
+    mutable std::vector<Number> local_tau_;
+    mutable std::vector<double> multirate_histogram_;
+
+    mutable std::vector<float> dof_cost_;
+
+    /*
+     * Dry row skipping: A flag for every locally relevant degree of
+     * freedom that is dry and at rest, and a flag for every locally owned
+     * row whose complete stencil is dry.
+     */
+    mutable std::vector<std::uint8_t> dry_states_;
+    mutable std::vector<std::uint8_t> dry_rows_;
+
     InitialPrecomputedVector initial_precomputed_;
 
+    /*
+     * Dirichlet boundary values for every entry of the boundary table.
+     * The cache is only populated in prepare() if the initial state is
+     * time independent and left empty otherwise.
+     */
+    std::vector<state_type> boundary_cache_;
+
+    /*
+     * Scratch storage for Dirichlet boundary values that are evaluated
+     * serially in prepare_state_vector() if the cache is empty and the
+     * initial state is not thread safe.
+     */
+    mutable std::vector<state_type> boundary_scratch_;
+
+    /*
+     * The subset of OfflineData::coupling_boundary_pairs() pointing to
+     * the upper triangular part of the d_ij matrix (i < j), sorted by
+     * row. Only these pairs are processed in Step 3.
+     */
+    std::vector<typename OfflineData<dim, Number>::CouplingDescription>
+        upper_coupling_boundary_pairs_;
+
+    /*
+     * One past the last (local) ghost index owned by an MPI rank with
+     * smaller global indices. If interface edges are only computed once,
+     * the d_ij entries of the ghost columns [n_owned, end) are received
+     * from the owning MPI rank. Otherwise, this is equal to n_owned.
+     */
+    unsigned int lower_ghost_range_end_;
+
+    /*
+     * Pipelined symmetrization: The locally owned rows are grouped into
+     * chunks of pipeline_chunk_size rows. For every chunk c we store (in
+     * CSR format) all other chunks holding a row j < i for some column j
+     * of a row i of chunk c, i.e., the chunks whose upper triangular
+     * d_ij entries are read when symmetrizing chunk c, and the range of
+     * upper_coupling_boundary_pairs_ with a row in chunk c. During
+     * Step 2 and 3 the number of rows of a chunk still pending in
+     * Step 2, and whether all d_ij entries of its upper triangular part
+     * are final, is tracked with atomic counters.
+     */
+    static constexpr unsigned int pipeline_chunk_size = 256;
+    std::vector<unsigned int> chunk_dependency_offsets_;
+    std::vector<unsigned int> chunk_dependencies_;
+    std::vector<unsigned int> chunk_pair_offsets_;
+    std::vector<std::atomic<unsigned int>> chunk_rows_pending_;
+    std::vector<std::atomic<bool>> chunk_upper_part_final_;
+
     using ScalarVector = typename Vectors::ScalarVector<Number>;
     mutable ScalarVector alpha_;
 
+    /**
+     * The mesh dependent power (m_i / |Omega|) ^ (1.5 / d) used for
+     * relaxing the limiter bounds, precomputed in prepare().
+     */
+    ScalarVector relaxation_powers_;
+
     static constexpr auto n_bounds =
         Description::template Limiter<dim, Number>::n_bounds;
     mutable Vectors::MultiComponentVector<Number, n_bounds> bounds_;
@@ -328,9 +729,86 @@ namespace ryujin
     mutable HyperbolicVector r_;
 
     mutable SparseMatrixSIMD<Number> dij_matrix_;
-    mutable SparseMatrixSIMD<Number> lij_matrix_;
+
+    /*
+     * Aggregated ghost exchanges of U and the precomputed values (in
+     * precomputation cycle 0), and of r_i and the limiter bounds (in
+     * Step 4 for discontinuous ansatz spaces):
+     */
+    mutable Vectors::AggregatedGhostExchange<Number> precompute_ghost_exchange_;
+    mutable Vectors::AggregatedGhostExchange<Number> bounds_ghost_exchange_;
+
+    /*
+     * Frozen wave speed mode: The states for which the upper triangular
+     * part of d_ij was last computed, the corresponding (uninflated)
+     * d_ij, and a flag for every locally relevant degree of freedom
+     * whose state moved by more than the tolerance.
+     */
+    mutable HyperbolicVector frozen_U_;
+    mutable SparseMatrixSIMD<Number> frozen_dij_matrix_;
+    mutable std::vector<std::uint8_t> state_changed_;
+    mutable bool frozen_valid_;
+    mutable std::vector<std::array<double, 2>> frozen_edge_statistics_;
+
+    /*
+     * Predictive time-step mode: The safety factor times the (global)
+     * tau_max of the first stage of the last step, or zero if no
+     * prediction is available.
+     */
+    mutable Number predicted_tau_;
+
+    /*
+     * The d_ij matrix is no longer needed after the low-order update
+     * (Step 4). We thus reuse its storage for the first set of limiter
+     * coefficients l_ij computed in Step 5. The matrix lij_matrix_next_
+     * is only allocated if two limiter iterations are performed.
+     */
+    SparseMatrixSIMD<Number> &lij_matrix_;
     mutable SparseMatrixSIMD<Number> lij_matrix_next_;
-    mutable SparseMatrixSIMD<Number, problem_dimension> pij_matrix_;
+
+    /*
+     * The antidiffusive fluxes p_ij are only applied scaled by the
+     * limiter coefficients l_ij. If the compile-time option
+     * SINGLE_PRECISION_ANTIDIFFUSIVE_FLUXES is set they are stored in
+     * single precision. The limiter then operates on the rounded values,
+     * so that the limited update remains within the bounds.
+     */
+#ifdef SINGLE_PRECISION_ANTIDIFFUSIVE_FLUXES
+    using PijNumber = float;
+#else
+    using PijNumber = Number;
+#endif
+    mutable SparseMatrixSIMD<PijNumber,
+                             problem_dimension,
+                             VectorizedArray<Number>::size()>
+        pij_matrix_;
+
+    /*
+     * Stage flux cache: The high-order flux contributions of the old
+     * state of every step, stored in single precision and keyed by the
+     * address of the U component of the old state vector. An entry with
+     * a vanishing key is unused.
+     */
+    using StageFluxMatrix =
+        SparseMatrixSIMD<float,
+                         problem_dimension,
+                         VectorizedArray<Number>::size()>;
+    struct StageFluxCacheEntry {
+      const void *key = nullptr;
+      StageFluxMatrix fluxes;
+    };
+    mutable std::vector<StageFluxCacheEntry> stage_flux_cache_;
+    mutable double n_cached_stage_fluxes_;
+    mutable double n_recomputed_stage_fluxes_;
+
+    mutable unsigned int bounds_check_offset_;
+    mutable bool full_bounds_check_;
+    mutable double n_bounds_checks_;
+    mutable double n_bounds_violations_;
+
+    bool monitor_steady_state_;
+    mutable double steady_state_change_;
+    mutable double steady_state_norm_;
 
     //@}
   };
@@ -14,9 +14,49 @@
 #include "sparse_matrix_simd.template.h"
 
 #include <atomic>
+#include <chrono>
 
 namespace ryujin
 {
+  namespace
+  {
+    /*
+     * A small RAII helper that adds the wall time spent in its scope
+     * evenly to the recorded cost of the degrees of freedom [i, i + n).
+     * Rows are distributed disjointly over threads, so no synchronization
+     * is necessary. The helper is a no-op if @p cost is a nullptr.
+     */
+    class CostScope
+    {
+    public:
+      CostScope(float *cost, const unsigned int i, const unsigned int n)
+          : cost_(cost)
+          , i_(i)
+          , n_(n)
+      {
+        if (cost_ != nullptr)
+          start_ = std::chrono::steady_clock::now();
+      }
+
+      ~CostScope()
+      {
+        if (cost_ == nullptr)
+          return;
+        const std::chrono::duration<float> elapsed =
+            std::chrono::steady_clock::now() - start_;
+        const float share = elapsed.count() / n_;
+        for (unsigned int k = 0; k < n_; ++k)
+          cost_[i_ + k] += share;
+      }
+
+    private:
+      float *cost_;
+      const unsigned int i_;
+      const unsigned int n_;
+      std::chrono::steady_clock::time_point start_;
+    };
+  } // namespace
+
   namespace ShallowWater
   {
     struct Description;
@@ -27,7 +67,7 @@ namespace ryujin
   template <typename Description, int dim, typename Number>
   HyperbolicModule<Description, dim, Number>::HyperbolicModule(
       const MPI_Comm &mpi_communicator,
-      std::map<std::string, dealii::Timer> &computing_timer,
+      std::map<std::string, SectionTimer> &computing_timer,
       const OfflineData<dim, Number> &offline_data,
       const HyperbolicSystem &hyperbolic_system,
       const InitialValues<Description, dim, Number> &initial_values,
@@ -45,7 +85,234 @@ namespace ryujin
       , cfl_(0.2)
       , n_restarts_(0)
       , n_warnings_(0)
+      , streamed_bytes_separate_(0.)
+      , streamed_bytes_fused_(0.)
+      , streamed_bytes_accumulated_(0.)
+      , sweep_bytes_{}
+      , n_steps_(0)
+      , lij_matrix_(dij_matrix_)
+      , monitor_steady_state_(false)
+      , steady_state_change_(0.)
+      , steady_state_norm_(0.)
   {
+    fused_low_order_update_ = false;
+    add_parameter(
+        "fused low order update",
+        fused_low_order_update_,
+        "Fuse the symmetrization of d_ij, the computation of the diagonal "
+        "d_ii and the low-order update into a single sweep over the "
+        "sparsity pattern. The fused sweep is only used if the time-step "
+        "size is prescribed (for example in later stages of a Runge-Kutta "
+        "scheme). Otherwise, tau_max has to be known before the low-order "
+        "update and the separate sweeps are used.");
+
+    overlap_tau_reduction_ = false;
+    add_parameter(
+        "overlap tau reduction",
+        overlap_tau_reduction_,
+        "Reduce tau_max over all MPI ranks with a non-blocking allreduce "
+        "that is overlapped with the low-order update in Step 4 instead "
+        "of a blocking collective. If the time-step size is not "
+        "prescribed, Step 4 then stores the low-order increment and the "
+        "scaling with tau is applied in a separate (cheap) sweep over all "
+        "locally owned states once the reduction has completed. Ignored "
+        "in the fused low order update mode and for hyperbolic systems "
+        "with source terms, or an affine shift (shallow water).");
+
+    predictive_time_step_ = false;
+    add_parameter(
+        "predictive time step",
+        predictive_time_step_,
+        "Predict the time-step size of the first stage of a step from the "
+        "tau_max computed in the first stage of the previous step "
+        "(multiplied by a safety factor) instead of waiting for the "
+        "global reduction of tau_max. A rank whose local tau_max is "
+        "smaller than the predicted step size signals a restart that is "
+        "handled by the usual CFL recovery strategy. The global tau_max "
+        "for the next prediction is reduced with a non-blocking allreduce "
+        "overlapping the remaining Steps 4 - 7. Only used if the CFL "
+        "recovery strategy permits restarts.");
+
+    predictive_time_step_safety_ = Number(0.95);
+    add_parameter("predictive time step safety",
+                  predictive_time_step_safety_,
+                  "Safety factor applied to the predicted time-step size in "
+                  "the predictive time step mode");
+
+    vectorize_noninternal_rows_ = false;
+    add_parameter(
+        "vectorize non-internal rows",
+        vectorize_noninternal_rows_,
+        "Compute d_ij and alpha_i for the non-internal rows [n_internal, "
+        "n_owned), whose stencil sizes differ within a SIMD stride, with a "
+        "masked, gather-based vectorized loop instead of the scalar loop. "
+        "Lanes that have exhausted their row are masked by a vanishing "
+        "c_ij.");
+
+    export_rows_first_ = false;
+    add_parameter(
+        "export rows first",
+        export_rows_first_,
+        "Split the vectorized loops over the internal rows that start an "
+        "asynchronous ghost exchange into two consecutive loops: All "
+        "threads first cooperatively process the export rows [0, "
+        "n_export_indices) and only then the remaining internal rows. The "
+        "exchange is thus started as early as possible and overlaps with "
+        "the bulk of the computation.");
+
+    quantize_limiter_exchange_ = false;
+    add_parameter(
+        "quantize limiter exchange",
+        quantize_limiter_exchange_,
+        "Exchange the ghost rows of the limiter coefficients l_ij as 16 "
+        "bit fixed point numbers rounded down, and mark rows with all "
+        "coefficients equal to one instead of sending them. Rounding "
+        "down is applied on both sides of an MPI interface and thus "
+        "maintains conservation and the limiter bounds.");
+
+    multirate_levels_ = 0;
+    add_parameter(
+        "multirate levels",
+        multirate_levels_,
+        "If set to a value larger than zero, group all degrees of freedom "
+        "into the given number of levels according to their locally "
+        "admissible time-step size tau_i in ratios of powers of two of the "
+        "global tau_max and report the potential speedup of a multirate "
+        "(local time stepping) scheme");
+
+    local_time_stepping_ = false;
+    add_parameter(
+        "local time stepping",
+        local_time_stepping_,
+        "Steady state mode: If set to true every degree of freedom advances "
+        "with its own pseudo time-step size tau_i = tau * tau_i,max / "
+        "tau_max, where tau_i,max is the locally admissible time-step size "
+        "derived from d_ii and the lumped mass m_i. Every nodal update "
+        "remains a convex combination, but the solution is neither time "
+        "accurate nor conservative before a steady state is reached");
+
+    frozen_wave_speed_tolerance_ = Number(0.);
+    add_parameter(
+        "frozen wave speed tolerance",
+        frozen_wave_speed_tolerance_,
+        "If set to a value larger than zero, reuse the wave speeds d_ij of "
+        "a previous stage or step for all edges whose endpoint states "
+        "changed by less than the given relative tolerance (in the maximum "
+        "norm) since d_ij was last computed. A step with reused wave "
+        "speeds that violates the invariant domain property triggers the "
+        "usual restart, for which all wave speeds are recomputed. Wave "
+        "speeds are thus only reused if a CFL recovery strategy is "
+        "enabled (and not for the final attempt that only warns).");
+
+    frozen_wave_speed_inflation_ = Number(1.1);
+    add_parameter("frozen wave speed inflation",
+                  frozen_wave_speed_inflation_,
+                  "Safety factor applied to reused wave speeds d_ij in the "
+                  "frozen wave speed mode");
+
+    skip_dry_rows_ = false;
+    add_parameter(
+        "skip dry rows",
+        skip_dry_rows_,
+        "Shallow water only: skip the computation of graph viscosities, "
+        "indicators, fluxes, source terms and limiter bounds in Steps 2 "
+        "and 4 for all rows whose complete stencil consists of dry states "
+        "at rest. The low-order update of such rows is the identity.");
+
+    record_dof_cost_ = false;
+    add_parameter(
+        "record dof cost",
+        record_dof_cost_,
+        "Record the wall time spent per locally owned degree of freedom in "
+        "Steps 2 and 4 of the step() function. The recorded cost is used "
+        "by the MeshAdaptor for weighted repartitioning.");
+
+    cache_stage_fluxes_ = false;
+    add_parameter(
+        "cache stage fluxes",
+        cache_stage_fluxes_,
+        "Store the high-order flux contributions of the old state of every "
+        "step in single precision and reuse them in later stages of a "
+        "Runge-Kutta scheme instead of re-evaluating the fluxes of all "
+        "earlier stages. This trades one sparse matrix of problem "
+        "dimension (in float) per stored stage for the flux evaluations. "
+        "Not supported for hyperbolic systems with source terms.");
+
+    aggregate_ghost_exchanges_ = true;
+    add_parameter(
+        "aggregate ghost exchanges",
+        aggregate_ghost_exchanges_,
+        "Combine ghost exchanges that are ready at the same synchronization "
+        "point into one message per neighboring MPI rank: the state U is "
+        "exchanged together with the values of precomputation cycle 0, "
+        "and r_i together with the limiter bounds in Step 4 (for "
+        "discontinuous ansatz spaces).");
+
+    recompute_ghost_precomputed_values_ = false;
+    add_parameter(
+        "recompute ghost precomputed values",
+        recompute_ghost_precomputed_values_,
+        "Evaluate all precomputation cycles that are a pointwise function "
+        "of the state (as declared by the hyperbolic system) on the ghost "
+        "degrees of freedom once the ghost values of U have arrived, "
+        "instead of exchanging the precomputed values with neighboring "
+        "MPI ranks.");
+
+    compute_interface_edges_once_ = false;
+    add_parameter(
+        "compute interface edges once",
+        compute_interface_edges_once_,
+        "Compute the wave speed d_ij of every edge between a locally owned "
+        "and a ghost degree of freedom on only one MPI rank, namely the "
+        "one owning the endpoint with the smaller global index. The other "
+        "rank receives the value with an additional ghost row exchange of "
+        "d_ij that is overlapped with the symmetrization of the internal "
+        "rows. This saves Riemann solves proportional to the number of "
+        "interface edges.");
+
+    pipelined_symmetrization_ = false;
+    add_parameter(
+        "pipelined symmetrization",
+        pipelined_symmetrization_,
+        "Replace the thread barrier between Step 2 and Step 3 by explicit "
+        "dependencies between chunks of rows: A chunk of d_ij is "
+        "symmetrized as soon as the upper triangular part of all chunks it "
+        "couples to has been computed. Threads that finish Step 2 early "
+        "thus start with Step 3 instead of waiting for the slowest thread. "
+        "Not supported together with \"compute interface edges once\".");
+
+    phase_threads_ = {0, 0, 0, 0};
+    add_parameter(
+        "phase threads",
+        phase_threads_,
+        "Number of threads used for the parallel regions of Steps 2 and 3 "
+        "(wave speeds), Step 4 (low-order update), Step 5 (limiter), and "
+        "Steps 6 and 7 (high-order update). A value of 0 selects the full "
+        "team, larger values are capped at the size of the full team. The "
+        "memory bound Steps 4 and 7 typically saturate the memory "
+        "bandwidth with fewer threads, whereas the compute bound Step 2 "
+        "benefits from all hardware threads.");
+
+    bounds_check_fraction_ = 0.;
+    add_parameter(
+        "bounds check fraction",
+        bounds_check_fraction_,
+        "If set to a value larger than zero, verify the final high-order "
+        "update of the given fraction of locally owned rows against the "
+        "limiter bounds after the last limiter pass. The checked subset "
+        "is a pseudo-random selection that rotates every stage such that "
+        "every row is checked once within 1/fraction stages. Violations "
+        "are counted and reported with the cycle statistics, they do not "
+        "trigger a restart.");
+
+    bounds_check_spike_threshold_ = 1.e-3;
+    add_parameter(
+        "bounds check spike threshold",
+        bounds_check_spike_threshold_,
+        "If the fraction of violations among the sampled bounds checks of "
+        "a stage exceeds this threshold, all rows are verified in the "
+        "subsequent stages until the violation rate of a full check drops "
+        "below the threshold again");
   }
 
 
@@ -68,6 +335,26 @@ namespace ryujin
     bounds_.reinit_with_scalar_partitioner(scalar_partitioner);
 
     r_.reinit(offline_data_->hyperbolic_vector_partitioner());
+
+    /*
+     * The relaxation of the limiter bounds scales with
+     * (m_i / |Omega|) ^ (1.5 / d). This only depends on the mesh, so
+     * precompute it once instead of in every stage:
+     */
+    {
+      const auto &lumped_mass_matrix = offline_data_->lumped_mass_matrix();
+      const Number measure_of_omega_inverse =
+          Number(1.) / offline_data_->measure_of_omega();
+
+      relaxation_powers_.reinit(scalar_partitioner);
+      for (unsigned int i = 0; i < offline_data_->n_locally_owned(); ++i) {
+        const Number hd_i =
+            lumped_mass_matrix.local_element(i) * measure_of_omega_inverse;
+        relaxation_powers_.local_element(i) =
+            std::pow(hd_i, Number(1.5) / Number(dim));
+      }
+    }
+
     using View =
         typename Description::template HyperbolicSystemView<dim, Number>;
 
@@ -75,14 +362,313 @@ namespace ryujin
 
     const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
     dij_matrix_.reinit(sparsity_simd);
-    lij_matrix_.reinit(sparsity_simd);
-    lij_matrix_next_.reinit(sparsity_simd);
+    if (limiter_parameters_.iterations() == 2)
+      lij_matrix_next_.reinit(sparsity_simd);
+    else
+      lij_matrix_next_ = SparseMatrixSIMD<Number>();
     pij_matrix_.reinit(sparsity_simd);
 
+    /*
+     * Set up a simple traffic model for Steps 2 - 4: For every sweep over
+     * the sparsity pattern we count the column indices, all matrix
+     * entries that are read or written, and the state vector gathers.
+     */
+
+    {
+      constexpr double index = sizeof(unsigned int);
+      constexpr double number = sizeof(Number);
+
+      /* Step 2: columns, c_ij, U_j, and d_ij: */
+      const double step_2 = index + (dim + problem_dimension + 1) * number;
+
+      /* Step 3: columns, transposed indices, d_ij, d_ji: */
+      const double step_3 = 2. * index + 3. * number;
+
+      /*
+       * Step 3 (fused): the row of d_ij is still in cache for Step 4. We
+       * only account for the transposed indices and entries:
+       */
+      const double step_3_fused = index + number;
+
+      /* Step 4: columns, c_ij, U_j, alpha_j, d_ij, m_ij, and p_ij: */
+      const double step_4 =
+          index + (dim + 2 * problem_dimension + 3) * number;
+
+      /* Step 5: columns, p_ij (read and write), r_j, m_ij, m_j, l_ij: */
+      const double step_5 = index + (3 * problem_dimension + 3) * number;
+
+      /* Step 6: columns, transposed indices, l_ij, l_ji, and p_ij: */
+      const double step_6 = 2. * index + (problem_dimension + 2) * number;
+
+      const double n_nonzero = sparsity_simd.n_nonzero_elements();
+      const double n_owned = std::max(1u, offline_data_->n_locally_owned());
+
+      streamed_bytes_separate_ =
+          n_nonzero * (step_2 + step_3 + step_4) / n_owned;
+      streamed_bytes_fused_ =
+          n_nonzero * (step_2 + step_3_fused + step_4) / n_owned;
+
+      sweep_bytes_ = {n_nonzero * step_2,
+                      n_nonzero * step_3,
+                      n_nonzero * step_3_fused,
+                      n_nonzero * step_4,
+                      n_nonzero * step_5,
+                      n_nonzero * step_6};
+
+      streamed_bytes_accumulated_ = 0.;
+      n_steps_ = 0;
+    }
+
+    AssertThrow(phase_threads_.size() == 4,
+                dealii::ExcMessage("\"phase threads\" expects four values: "
+                                   "Steps 2-3, Step 4, Step 5, Steps 6-7"));
+
+    thread_busy_time_.assign(max_threads(), 0.);
+
+    frozen_valid_ = false;
+    frozen_edge_statistics_.assign(max_threads(), {0., 0.});
+
+    predicted_tau_ = Number(0.);
+    if (frozen_wave_speed_tolerance_ > Number(0.)) {
+      AssertThrow(frozen_wave_speed_inflation_ >= Number(1.),
+                  dealii::ExcMessage("The frozen wave speed inflation factor "
+                                     "must be at least one"));
+      frozen_U_.reinit(offline_data_->hyperbolic_vector_partitioner());
+      frozen_dij_matrix_.reinit(sparsity_simd);
+      state_changed_.assign(offline_data_->n_locally_relevant(), 1);
+    } else {
+      frozen_U_ = HyperbolicVector();
+      frozen_dij_matrix_ = SparseMatrixSIMD<Number>();
+      state_changed_.clear();
+    }
+
+    if (local_time_stepping_) {
+      AssertThrow(!fused_low_order_update_ && !overlap_tau_reduction_ &&
+                      !predictive_time_step_,
+                  dealii::ExcMessage(
+                      "\"local time stepping\" cannot be combined with a "
+                      "fused low order update, an overlapped tau reduction, "
+                      "or a predictive time step"));
+    }
+
+    if (multirate_levels_ > 0 || local_time_stepping_)
+      local_tau_.resize(offline_data_->n_locally_owned());
+    else
+      local_tau_.clear();
+    multirate_histogram_.assign(multirate_levels_, 0.);
+
+    if (skip_dry_rows_) {
+      AssertThrow(
+          (std::is_same_v<Description, ShallowWater::Description>),
+          dealii::ExcMessage("Skipping dry rows is only supported for the "
+                             "shallow water equations"));
+      AssertThrow(frozen_wave_speed_tolerance_ <= Number(0.),
+                  dealii::ExcMessage("Skipping dry rows cannot be combined "
+                                     "with the frozen wave speed mode"));
+      dry_states_.assign(offline_data_->n_locally_relevant(), 0);
+      dry_rows_.assign(offline_data_->n_locally_owned(), 0);
+    } else {
+      dry_states_.clear();
+      dry_rows_.clear();
+    }
+
+    if (record_dof_cost_)
+      dof_cost_.assign(offline_data_->n_locally_owned(), 0.f);
+    else
+      dof_cost_.clear();
+
+    stage_flux_cache_.clear();
+    n_cached_stage_fluxes_ = 0.;
+    n_recomputed_stage_fluxes_ = 0.;
+
+    bounds_check_offset_ = 0;
+    full_bounds_check_ = false;
+    n_bounds_checks_ = 0.;
+    n_bounds_violations_ = 0.;
+
+    steady_state_change_ = 0.;
+    steady_state_norm_ = 0.;
+
+    if (cache_stage_fluxes_) {
+      AssertThrow(!have_nodal_sources(),
+                  dealii::ExcMessage("The stage flux cache is not supported "
+                                     "for hyperbolic systems with source "
+                                     "terms"));
+    }
+
+    /*
+     * Only coupling boundary pairs "i < j" pointing to the upper
+     * triangular part of d_ij have to be processed in Step 3. Filter
+     * them once and sort them by row so that every thread of the
+     * (static) OpenMP loop works on a contiguous set of rows:
+     */
+
+    upper_coupling_boundary_pairs_.clear();
+    for (const auto &coupling : offline_data_->coupling_boundary_pairs()) {
+      const auto &[i, col_idx, j] = coupling;
+      if (i < j)
+        upper_coupling_boundary_pairs_.push_back(coupling);
+    }
+    std::sort(upper_coupling_boundary_pairs_.begin(),
+              upper_coupling_boundary_pairs_.end());
+
+    /*
+     * The ghost range of the scalar partitioner is sorted by global
+     * index, and the locally owned ranges of the MPI ranks are
+     * contiguous. All ghost indices with a global index smaller than the
+     * first locally owned index thus form the first part of the ghost
+     * range. If interface edges are only computed once, the wave speeds
+     * of edges into this range are computed on the owning MPI rank:
+     */
+
+    const unsigned int n_owned = offline_data_->n_locally_owned();
+    const unsigned int n_relevant = offline_data_->n_locally_relevant();
+    lower_ghost_range_end_ = n_owned;
+    if (compute_interface_edges_once_) {
+      const auto first_owned = scalar_partitioner->local_range().first;
+      while (lower_ghost_range_end_ < n_relevant &&
+             scalar_partitioner->local_to_global(lower_ghost_range_end_) <
+                 first_owned)
+        ++lower_ghost_range_end_;
+
+      upper_coupling_boundary_pairs_.erase(
+          std::remove_if(upper_coupling_boundary_pairs_.begin(),
+                         upper_coupling_boundary_pairs_.end(),
+                         [&](const auto &coupling) {
+                           const auto j = std::get<2>(coupling);
+                           return j >= n_owned && j < lower_ghost_range_end_;
+                         }),
+          upper_coupling_boundary_pairs_.end());
+    }
+
+    chunk_dependency_offsets_.clear();
+    chunk_dependencies_.clear();
+    chunk_pair_offsets_.clear();
+    chunk_rows_pending_.clear();
+    chunk_upper_part_final_.clear();
+
+    if (pipelined_symmetrization_) {
+      AssertThrow(!compute_interface_edges_once_,
+                  dealii::ExcMessage("\"pipelined symmetrization\" cannot "
+                                     "be combined with \"compute interface "
+                                     "edges once\""));
+
+      constexpr auto simd_length = VectorizedArray<Number>::size();
+      const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
+      const unsigned int n_internal = offline_data_->n_locally_internal();
+      const unsigned int n_chunks =
+          (n_owned + pipeline_chunk_size - 1) / pipeline_chunk_size;
+
+      chunk_dependency_offsets_.assign(1, 0);
+      chunk_pair_offsets_.assign(1, 0);
+      auto pair = upper_coupling_boundary_pairs_.begin();
+
+      std::vector<unsigned int> dependencies;
+      for (unsigned int c = 0; c < n_chunks; ++c) {
+        const unsigned int left = c * pipeline_chunk_size;
+        const unsigned int right =
+            std::min(n_owned, left + pipeline_chunk_size);
+
+        dependencies.clear();
+        for (unsigned int i = left; i < right; ++i) {
+          const unsigned int row_length = sparsity_simd.row_length(i);
+          const unsigned int *js = sparsity_simd.columns(i);
+          for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
+            const auto j = *(i < n_internal ? js + col_idx * simd_length
+                                            : js + col_idx);
+            if (j < left)
+              dependencies.push_back(j / pipeline_chunk_size);
+          }
+        }
+
+        std::sort(dependencies.begin(), dependencies.end());
+        dependencies.erase(
+            std::unique(dependencies.begin(), dependencies.end()),
+            dependencies.end());
+        chunk_dependencies_.insert(chunk_dependencies_.end(),
+                                   dependencies.begin(),
+                                   dependencies.end());
+        chunk_dependency_offsets_.push_back(chunk_dependencies_.size());
+
+        while (pair != upper_coupling_boundary_pairs_.end() &&
+               std::get<0>(*pair) < right)
+          ++pair;
+        chunk_pair_offsets_.push_back(
+            std::distance(upper_coupling_boundary_pairs_.begin(), pair));
+      }
+
+      chunk_rows_pending_ = std::vector<std::atomic<unsigned int>>(n_chunks);
+      chunk_upper_part_final_ = std::vector<std::atomic<bool>>(n_chunks);
+    }
+
     /* Set up initial precomputed vector: */
 
     initial_precomputed_ =
         initial_values_->interpolate_initial_precomputed_vector();
+
+    /*
+     * Precompute Dirichlet boundary values if the initial state is time
+     * independent. The cache follows the layout of the boundary table and
+     * is thus rebuilt whenever prepare() is called after mesh adaptation.
+     */
+
+    boundary_cache_.clear();
+    if (initial_values_->time_independent())
+      dirichlet_data(Number(0.));
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  auto HyperbolicModule<Description, dim, Number>::dirichlet_data(
+      const Number t) -> std::vector<state_type> &
+  {
+    const auto &boundary_table = offline_data_->boundary_table();
+    const unsigned int size = boundary_table.ids.size();
+
+    if (boundary_cache_.size() == size)
+      return boundary_cache_;
+
+    boundary_cache_.resize(size);
+    for (unsigned int k = 0; k < size; ++k) {
+      dealii::Point<dim> position;
+      for (unsigned int d = 0; d < dim; ++d)
+        position[d] = boundary_table.positions[d][k];
+      boundary_cache_[k] = initial_values_->initial_state(position, t);
+    }
+
+    return boundary_cache_;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  std::size_t
+  HyperbolicModule<Description, dim, Number>::memory_consumption() const
+  {
+    std::size_t result = alpha_.memory_consumption();
+
+    result += relaxation_powers_.memory_consumption();
+    result += bounds_.memory_consumption();
+    result += r_.memory_consumption();
+    result += initial_precomputed_.memory_consumption();
+
+    result += dij_matrix_.memory_consumption();
+    result += lij_matrix_next_.memory_consumption();
+    result += pij_matrix_.memory_consumption();
+
+    result += frozen_U_.memory_consumption();
+    result += frozen_dij_matrix_.memory_consumption();
+
+    using CouplingDescription =
+        typename OfflineData<dim, Number>::CouplingDescription;
+    result += upper_coupling_boundary_pairs_.capacity() *
+              sizeof(CouplingDescription);
+    result += (chunk_dependency_offsets_.capacity() +
+               chunk_dependencies_.capacity() +
+               chunk_pair_offsets_.capacity()) *
+              sizeof(unsigned int);
+    result += stage_flux_cache_memory_consumption();
+
+    return result;
   }
 
 
@@ -93,6 +679,34 @@ namespace ryujin
    */
 
 
+  template <typename Description, int dim, typename Number>
+  auto HyperbolicModule<Description, dim, Number>::timer_slot(
+      const unsigned int slot,
+      const char *label,
+      const int step_no,
+      const bool track_bytes) const -> TimerSlot
+  {
+    if (slot >= timer_slots_.size())
+      timer_slots_.resize(slot + 1);
+
+    auto &entry = timer_slots_[slot];
+    if (entry.step_no == step_no && entry.label == label)
+      return entry;
+
+    const auto name =
+        "time step [H] " +
+        (step_no > 0 ? std::to_string(step_no) : std::string("_")) + " - " +
+        std::string(label);
+
+    entry.step_no = step_no;
+    entry.label = label;
+    entry.timer = &Scope::register_timer(computing_timer_, name);
+    entry.bytes_streamed =
+        track_bytes ? &kernel_bytes_streamed_[name] : nullptr;
+    return entry;
+  }
+
+
   template <typename Description, int dim, typename Number>
   void HyperbolicModule<Description, dim, Number>::prepare_state_vector(
       StateVector &state_vector, Number t) const
@@ -109,43 +723,134 @@ namespace ryujin
     const unsigned int n_export_indices = offline_data_->n_export_indices();
     const unsigned int n_internal = offline_data_->n_locally_internal();
     const unsigned int n_owned = offline_data_->n_locally_owned();
+    const unsigned int n_active = offline_data_->n_locally_active();
+    const unsigned int n_relevant = offline_data_->n_locally_relevant();
     const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
-    const auto &boundary_map = offline_data_->boundary_map();
+    const auto &boundary_table = offline_data_->boundary_table();
     unsigned int channel = 10;
     using VA = VectorizedArray<Number>;
 
-    Scope scope(computing_timer_,
-                "time step [H] 1 - update boundary values, precompute values");
+    /* Split point of the vectorized loops, see "export rows first": */
+    const unsigned int n_export_split =
+        export_rows_first_ ? n_export_indices : 0;
 
-    LIKWID_MARKER_START("time_step_1a");
+    Scope scope(*timer_slot(
+        0, "update boundary values, precompute values", 1, false).timer);
 
-    /* FIXME: not thread parallel... */
-    for (const auto &entry : boundary_map) {
-      const auto &[i, normal, normal_mass, boundary_mass, id, position] = entry;
+    /*
+     * Most initial states are not thread safe. If the Dirichlet data is
+     * not cached we thus evaluate it serially into a scratch vector
+     * (following the layout of the boundary table) unless the initial
+     * state allows concurrent evaluation:
+     */
 
-      /*
-       * Relay the task of applying appropriate boundary conditions to the
-       * Problem Description.
-       */
+    const bool evaluate_concurrently =
+        !boundary_cache_.empty() || initial_values_->thread_safe();
 
-      if (id == Boundary::do_nothing)
-        continue;
+    if (!evaluate_concurrently) {
+      const unsigned int size = boundary_table.ids.size();
+      boundary_scratch_.resize(size);
+      for (unsigned int k = 0; k < size; ++k) {
+        if (boundary_table.ids[k] == Boundary::do_nothing)
+          continue;
+        dealii::Point<dim> position;
+        for (unsigned int d = 0; d < dim; ++d)
+          position[d] = boundary_table.positions[d][k];
+        boundary_scratch_[k] = initial_values_->initial_state(position, t);
+      }
+    }
 
+    /*
+     * Apply boundary conditions. We iterate over the boundary table that
+     * groups all boundary map entries of the same degree of freedom
+     * together, so that different groups can be processed concurrently.
+     */
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+    LIKWID_MARKER_START("time_step_1a");
+
+    const auto view = hyperbolic_system_->template view<dim, Number>();
+
+    RYUJIN_OMP_FOR
+    for (unsigned int g = 0; g < boundary_table.n_groups(); ++g) {
+      const auto group_begin = boundary_table.group_starts[g];
+      const auto group_end = boundary_table.group_starts[g + 1];
+
+      const auto i = boundary_table.indices[group_begin];
       auto U_i = U.get_tensor(i);
 
-      /* Use a lambda to avoid computing unnecessary state values */
-      auto get_dirichlet_data = [position = position, t = t, this]() {
-        return initial_values_->initial_state(position, t);
-      };
+      for (unsigned int k = group_begin; k < group_end; ++k) {
+        const auto id = boundary_table.ids[k];
+
+        /*
+         * Relay the task of applying appropriate boundary conditions to
+         * the Problem Description.
+         */
+
+        if (id == Boundary::do_nothing)
+          continue;
+
+        dealii::Tensor<1, dim, Number> normal;
+        dealii::Point<dim> position;
+        for (unsigned int d = 0; d < dim; ++d) {
+          normal[d] = boundary_table.normals[d][k];
+          position[d] = boundary_table.positions[d][k];
+        }
+
+        /* Use a lambda to avoid computing unnecessary state values */
+        auto get_dirichlet_data =
+            [&position, k, t = t, evaluate_concurrently, this]() {
+              if (!boundary_cache_.empty())
+                return boundary_cache_[k];
+              if (!evaluate_concurrently)
+                return boundary_scratch_[k];
+              return initial_values_->initial_state(position, t);
+            };
+
+        U_i =
+            view.apply_boundary_conditions(id, U_i, normal, get_dirichlet_data);
+      }
 
-      const auto view = hyperbolic_system_->template view<dim, Number>();
-      U_i = view.apply_boundary_conditions(id, U_i, normal, get_dirichlet_data);
       U.write_tensor(U_i, i);
     }
 
     LIKWID_MARKER_STOP("time_step_1a");
+    RYUJIN_PARALLEL_REGION_END
 
-    U.update_ghost_values();
+    /*
+     * Start the ghost exchange of U. Precomputation cycle 0 only reads
+     * the states of locally owned rows, so that we can overlap the
+     * exchange with it and complete it in the synchronization payload of
+     * cycle 0, i.e., before the precomputed values are exchanged. When
+     * aggregating ghost exchanges we instead send U together with the
+     * precomputed values of cycle 0 in a single message:
+     */
+
+    /*
+     * Precomputation cycles that are a pointwise function of the state
+     * can be evaluated on the ghost range (after the ghost exchange of U
+     * has completed) instead of exchanging the precomputed values:
+     */
+
+    const auto recompute_ghosts = [&]([[maybe_unused]] unsigned int cycle) {
+      if constexpr (requires { View::pointwise_precomputation(0); })
+        return recompute_ghost_precomputed_values_ &&
+               View::pointwise_precomputation(cycle);
+      else
+        return false;
+    };
+
+    bool aggregate_U = false;
+    if constexpr (n_precomputation_cycles != 0 &&
+                  !requires { View::precomputed_ghost_components(0); })
+      aggregate_U = aggregate_ghost_exchanges_ && !recompute_ghosts(0) &&
+                    !U.use_shared_memory_exchange() &&
+                    !precomputed.use_shared_memory_exchange();
+
+    if (!aggregate_U)
+      U.update_ghost_values_start(channel++);
+    if constexpr (n_precomputation_cycles == 0)
+      U.update_ghost_values_finish();
 
     /*
      * Precompute values
@@ -153,41 +858,87 @@ namespace ryujin
 
     if constexpr (n_precomputation_cycles != 0) {
       for (unsigned int cycle = 0; cycle < n_precomputation_cycles; ++cycle) {
+        {
+          SynchronizationDispatch synchronization_dispatch([&]() {
+            if (cycle == 0 && aggregate_U) {
+              precompute_ghost_exchange_.update_ghost_values_start(
+                  {&U, &precomputed}, channel++);
+              precompute_ghost_exchange_.update_ghost_values_finish();
+              return;
+            }
 
-        SynchronizationDispatch synchronization_dispatch([&]() {
-          precomputed.update_ghost_values_start(channel++);
-          precomputed.update_ghost_values_finish();
-        });
-
-        RYUJIN_PARALLEL_REGION_BEGIN
-        LIKWID_MARKER_START(("time_step_1b"));
+            if (cycle == 0)
+              U.update_ghost_values_finish();
 
-        auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
-          using T = decltype(sentinel);
+            /* The ghost values are recomputed below: */
+            if (recompute_ghosts(cycle))
+              return;
 
-          /* Stored thread locally: */
-          bool thread_ready = false;
+            /*
+             * Only exchange the precomputed values needed by neighboring
+             * MPI ranks if the hyperbolic system tells us which ones:
+             */
+            if constexpr (requires {
+                            View::precomputed_ghost_components(0);
+                          }) {
+              precomputed.update_ghost_components_start(
+                  View::precomputed_ghost_components(cycle), channel++);
+              precomputed.update_ghost_components_finish();
+            } else {
+              precomputed.update_ghost_values_start(channel++);
+              precomputed.update_ghost_values_finish();
+            }
+          });
+
+          RYUJIN_PARALLEL_REGION_BEGIN
+          LIKWID_MARKER_START(("time_step_1b"));
+
+          auto loop = [&](auto sentinel,
+                          unsigned int left,
+                          unsigned int right) {
+            using T = decltype(sentinel);
+
+            /* Stored thread locally: */
+            bool thread_ready = false;
+
+            const auto view = hyperbolic_system_->template view<dim, T>();
+            view.precomputation_loop(
+                cycle,
+                [&](const unsigned int i) {
+                  synchronization_dispatch.check(
+                      thread_ready, i >= n_export_indices && i < n_internal);
+                },
+                sparsity_simd,
+                state_vector,
+                left,
+                right);
+          };
+
+          /* Parallel non-vectorized loop: */
+          loop(Number(), n_internal, n_active);
+          /* Parallel vectorized SIMD loop (export rows first): */
+          if (n_export_split != 0)
+            loop(VA(), 0, n_export_split);
+          loop(VA(), n_export_split, n_internal);
+
+          LIKWID_MARKER_STOP("time_step_1b");
+          RYUJIN_PARALLEL_REGION_END
+        }
 
-          const auto view = hyperbolic_system_->template view<dim, T>();
+        if (recompute_ghosts(cycle)) {
+          RYUJIN_PARALLEL_REGION_BEGIN
+          const auto view = hyperbolic_system_->template view<dim, Number>();
           view.precomputation_loop(
               cycle,
-              [&](const unsigned int i) {
-                synchronization_dispatch.check(
-                    thread_ready, i >= n_export_indices && i < n_internal);
-              },
+              [](const unsigned int) {},
               sparsity_simd,
               state_vector,
-              left,
-              right);
-        };
-
-        /* Parallel non-vectorized loop: */
-        loop(Number(), n_internal, n_owned);
-        /* Parallel vectorized SIMD loop: */
-        loop(VA(), 0, n_internal);
+              n_owned,
+              n_relevant);
+          RYUJIN_PARALLEL_REGION_END
 
-        LIKWID_MARKER_STOP("time_step_1b");
-        RYUJIN_PARALLEL_REGION_END
+          precomputed.set_ghost_state(true);
+        }
       }
     }
   }
@@ -203,30 +954,79 @@ namespace ryujin
   namespace
   {
     /**
-     * Internally used: returns true if all indices are on the lower
-     * triangular part of the matrix.
+     * Internally used: returns true if the d_ij entries of all indices
+     * are computed elsewhere, i.e., if @p computed_elsewhere(i, j) is
+     * true for all (row, column) pairs. These are the entries on the
+     * lower triangular part of the matrix and (optionally) interface
+     * edges computed on a neighboring MPI rank.
      */
-    template <typename T>
-    bool all_below_diagonal(unsigned int i, const unsigned int *js)
+    template <typename T, typename Predicate>
+    bool all_computed_elsewhere(unsigned int i,
+                                const unsigned int *js,
+                                const Predicate &computed_elsewhere)
     {
       if constexpr (std::is_same_v<T, typename get_value_type<T>::type>) {
         /* Non-vectorized sequential access. */
-        const auto j = *js;
-        return j < i;
+        return computed_elsewhere(i, *js);
 
       } else {
         /* Vectorized fast access. index must be divisible by simd_length */
 
         constexpr auto simd_length = T::size();
 
-        bool all_below_diagonal = true;
         for (unsigned int k = 0; k < simd_length; ++k)
-          if (js[k] >= i + k) {
-            all_below_diagonal = false;
-            break;
-          }
-        return all_below_diagonal;
+          if (!computed_elsewhere(i + k, js[k]))
+            return false;
+        return true;
+      }
+    }
+
+
+    /**
+     * Internally used: returns true if the state of the row index (or
+     * any row index of the SIMD stride) or of any column index is flagged
+     * as changed.
+     */
+    template <typename T>
+    bool any_state_changed(const std::vector<std::uint8_t> &state_changed,
+                           unsigned int i,
+                           const unsigned int *js)
+    {
+      if constexpr (std::is_same_v<T, typename get_value_type<T>::type>) {
+        return state_changed[i] || state_changed[*js];
+
+      } else {
+        constexpr auto simd_length = T::size();
+
+        for (unsigned int k = 0; k < simd_length; ++k)
+          if (state_changed[i + k] || state_changed[js[k]])
+            return true;
+        return false;
+      }
+    }
+
+
+    /**
+     * Internally used: calls @p column_loop with the number of columns
+     * of the current row. For vectorized access and a row length equal
+     * to @p regular_row_length the number of columns is passed as a
+     * compile-time constant (a std::integral_constant) which allows the
+     * compiler to fully unroll the column loop. All other rows take the
+     * generic code path with a run-time loop bound.
+     */
+    template <typename T, unsigned int regular_row_length, typename F>
+    DEAL_II_ALWAYS_INLINE inline void
+    dispatch_row_length(const unsigned int row_length, const F &column_loop)
+    {
+      if constexpr (!std::is_same_v<T, typename get_value_type<T>::type>) {
+        if (row_length == regular_row_length) {
+          using n_columns =
+              std::integral_constant<unsigned int, regular_row_length>;
+          column_loop(n_columns());
+          return;
+        }
       }
+      column_loop(row_length);
     }
   } // namespace
 
@@ -278,6 +1078,17 @@ namespace ryujin
     const unsigned int n_export_indices = offline_data_->n_export_indices();
     const unsigned int n_internal = offline_data_->n_locally_internal();
     const unsigned int n_owned = offline_data_->n_locally_owned();
+    const unsigned int n_active = offline_data_->n_locally_active();
+
+    /*
+     * Export rows first: The vectorized loops of all steps that start an
+     * asynchronous ghost exchange are split at n_export_indices. All
+     * threads first process the export rows cooperatively, so that the
+     * exchange is dispatched once the last thread has finished its share
+     * of these rows.
+     */
+    const unsigned int n_export_split =
+        export_rows_first_ ? n_export_indices : 0;
 
     /* References to precomputed matrices and the stencil: */
 
@@ -292,26 +1103,238 @@ namespace ryujin
     const auto &cij_matrix = offline_data_->cij_matrix();
     const auto &incidence_matrix = offline_data_->incidence_matrix();
 
-    const auto &coupling_boundary_pairs =
-        offline_data_->coupling_boundary_pairs();
+    const auto &coupling_boundary_pairs = upper_coupling_boundary_pairs_;
+
+    /*
+     * Only the upper triangular part of d_ij is computed in Step 2. If
+     * interface edges are only computed once, the entries of all ghost
+     * columns [n_owned, lower_ghost_range_end_) owned by an MPI rank with
+     * smaller global indices are received from that rank instead:
+     */
+    const unsigned int lower_ghost_range_end = lower_ghost_range_end_;
+    const auto computed_elsewhere = [n_owned, lower_ghost_range_end](
+                                        const unsigned int i,
+                                        const unsigned int j) {
+      return j < i || (j >= n_owned && j < lower_ghost_range_end);
+    };
 
     const Number measure_of_omega_inverse =
         Number(1.) / offline_data_->measure_of_omega();
 
+    /* Per dof cost recorded in Steps 2 and 4 (if enabled): */
+    float *const dof_cost = dof_cost_.empty() ? nullptr : dof_cost_.data();
+
+    /*
+     * The row length of a regular interior row of a Q1 discretization.
+     * Steps 2 and 4 dispatch vectorized rows of this length to a column
+     * loop with a compile-time trip count, see dispatch_row_length().
+     */
+    constexpr unsigned int regular_row_length = dealii::Utilities::pow(3u, dim);
+
+    /*
+     * Software prefetch for the vectorized row loops of Steps 2 and 4:
+     * While processing the SIMD row group starting at row i we prefetch
+     * the column indices and c_ij entries of the row group
+     * PREFETCH_DISTANCE strides ahead (bounded by the end of the loop
+     * range) so that the stencil of the next row groups is already in
+     * cache when we get there. Disabled for PREFETCH_DISTANCE == 0.
+     */
+    const auto prefetch_row_group = [&](const unsigned int i,
+                                        const unsigned int stride_size,
+                                        const unsigned int right) {
+      const unsigned int next = i + PREFETCH_DISTANCE * stride_size;
+      if (PREFETCH_DISTANCE > 0 && stride_size > 1 && next < right) {
+        sparsity_simd.prefetch_row(next);
+        cij_matrix.prefetch_row(next);
+      }
+    };
+
     /* A monotonically increasing "channel" variable for mpi_tags: */
     unsigned int channel = 10;
 
-    /* Lambda for creating the computing timer string: */
+    /*
+     * Lambda returning the registered timer slot for a section of this
+     * function. Sections that do not advance the step number are
+     * auxiliary passes without a traffic model and do not record
+     * streamed bytes:
+     */
     int step_no = 1;
-    const auto scoped_name = [&step_no](const auto &name,
-                                        const bool advance = true) {
+    const auto scoped_slot = [&](const unsigned int slot,
+                                 const char *label,
+                                 const bool advance = true) {
       advance || step_no--;
-      return "time step [H] " + std::to_string(++step_no) + " - " + name;
+      return timer_slot(slot, label, ++step_no, advance);
     };
 
     /* A boolean signalling that a restart is necessary: */
     std::atomic<bool> restart_needed = false;
 
+    /*
+     * Predictive time-step mode: For the first stage (with tau not
+     * prescribed) we use the tau_max predicted from the previous step.
+     * The stage then proceeds as if tau was prescribed, see below.
+     */
+    const bool first_stage = (tau == Number(0.));
+    const bool predict_tau =
+        predictive_time_step_ && first_stage &&
+        predicted_tau_ > Number(0.) &&
+        id_violation_strategy_ == IDViolationStrategy::raise_exception;
+    if (predict_tau)
+      tau = std::min(predicted_tau_, tau_max.load());
+
+    /*
+     * Fused mode: If the time-step size is prescribed we do not need to
+     * know tau_max prior to the low-order update. In this case we skip
+     * the separate sweep over the sparsity pattern in Step 3 and
+     * symmetrize each row of d_ij directly in Step 4 while the row is
+     * still in cache.
+     */
+    const bool fuse_step_3 = fused_low_order_update_ && (tau != Number(0.));
+
+    streamed_bytes_accumulated_ +=
+        fuse_step_3 ? streamed_bytes_fused_ : streamed_bytes_separate_;
+    n_steps_++;
+
+    /*
+     * Overlapped tau reduction: The (global) minimum of tau_max is
+     * reduced with a non-blocking MPI_Iallreduce that completes after
+     * Step 4. The low-order update depends linearly on tau (in the
+     * absence of source terms and affine shifts), so if tau is not
+     * prescribed we defer the scaling: Step 4 computes the increment
+     * with tau = 1, which is rescaled once the reduction completed.
+     */
+    const bool nodal_sources = have_nodal_sources();
+    const bool overlap_tau_reduction = overlap_tau_reduction_ &&
+                                       !fuse_step_3 && !shallow_water &&
+                                       !nodal_sources;
+    const bool defer_tau = overlap_tau_reduction && (tau == Number(0.));
+    const Number tau_low_order = defer_tau ? Number(1.) : tau;
+
+    /*
+     * Stage flux cache: Every step stores the high-order flux
+     * contributions of old_U in a cache entry keyed by old_U. Later
+     * stages look up the contributions of all stage state vectors
+     * instead of re-evaluating them. A forward Euler step (stages == 0)
+     * begins a new sequence of stages and invalidates all entries.
+     *
+     * This relies on stage state vectors not being modified after they
+     * have been used as old state since the last forward Euler step,
+     * which holds for all schemes implemented in the TimeIntegrator.
+     */
+    StageFluxMatrix *stage_flux_output = nullptr;
+    std::array<const StageFluxMatrix *, stages> stage_flux_input{};
+    bool use_cached_stage_fluxes = false;
+
+    if (cache_stage_fluxes_ && !nodal_sources) {
+      auto &cache = stage_flux_cache_;
+
+      if constexpr (stages == 0)
+        for (auto &entry : cache)
+          entry.key = nullptr;
+
+      const auto find_entry = [&](const void *key) {
+        return std::find_if(cache.begin(), cache.end(), [key](auto &entry) {
+          return entry.key == key;
+        });
+      };
+
+      /* The contributions of new_U are about to become stale: */
+      if (auto it = find_entry(&new_U); it != cache.end())
+        it->key = nullptr;
+
+      auto it = find_entry(&old_U);
+      if (it == cache.end())
+        it = find_entry(nullptr);
+      if (it == cache.end()) {
+        cache.emplace_back();
+        it = std::prev(cache.end());
+        it->fluxes.reinit(sparsity_simd);
+      }
+      it->key = &old_U;
+      stage_flux_output = &it->fluxes;
+
+      use_cached_stage_fluxes = true;
+      for (int s = 0; s < stages; ++s) {
+        const auto &U_s = std::get<0>(stage_state_vectors[s].get());
+        const auto entry = find_entry(&U_s);
+        if (entry == cache.end())
+          use_cached_stage_fluxes = false;
+        else
+          stage_flux_input[s] = &entry->fluxes;
+      }
+
+      if (use_cached_stage_fluxes)
+        n_cached_stage_fluxes_ += stages;
+      else
+        n_recomputed_stage_fluxes_ += stages;
+    }
+
+    /*
+     * Lambda for completing row i of the d_ij matrix: We fill the lower
+     * triangular part of the row with the transposed entries computed in
+     * Step 2, compute the diagonal entry d_ii, and return the maximal
+     * admissible time-step size for the row.
+     */
+    const auto symmetrize_row = [&]([[maybe_unused]] const auto &riemann_solver,
+                                    const unsigned int i) -> Number {
+      /* Skip constrained degrees of freedom: */
+      const unsigned int row_length = sparsity_simd.row_length(i);
+      if (row_length == 1)
+        return std::numeric_limits<Number>::max();
+
+      Number d_sum = Number(0.);
+
+      /* skip diagonal: */
+      const unsigned int *js = sparsity_simd.columns(i);
+      for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
+        const auto j =
+            *(i < n_internal ? js + col_idx * simd_length : js + col_idx);
+
+        // fill lower triangular part of dij_matrix missing from step 1
+        if (computed_elsewhere(i, j)) {
+          const auto d_ji = dij_matrix_.get_transposed_entry(i, col_idx);
+
+#ifdef DEBUG
+          /* Verify that d_ji == std::max(d_ij, d_ji): */
+
+          const auto U_i = old_U.get_tensor(i);
+          const auto U_j = old_U.get_tensor(j);
+
+          const auto c_ij = cij_matrix.template get_tensor<Number>(i, col_idx);
+          Assert(c_ij.norm() > 1.e-12, ExcInternalError());
+          const auto norm_ij = c_ij.norm();
+          const auto n_ij = c_ij / norm_ij;
+
+          const auto lambda_max = riemann_solver.compute(U_i, U_j, i, &j, n_ij);
+          const auto d_ij = norm_ij * lambda_max;
+
+          Assert(frozen_wave_speed_tolerance_ > Number(0.) ||
+                     d_ij <= d_ji + 1.0e-12,
+                 dealii::ExcMessage("d_ij not symmetrized correctly on "
+                                    "boundary degrees of freedom."));
+#endif
+
+          dij_matrix_.write_entry(d_ji, i, col_idx);
+        }
+
+        d_sum -= dij_matrix_.get_entry(i, col_idx);
+      }
+
+      /*
+       * Make sure that we do not accidentally divide by zero. (Yes, this
+       * can happen for some (admittedly, rather esoteric) scalar
+       * conservation equations...).
+       */
+      d_sum =
+          std::min(d_sum, Number(-1.e6) * std::numeric_limits<Number>::min());
+
+      /* write diagonal element */
+      dij_matrix_.write_entry(d_sum, i, 0);
+
+      const Number mass = lumped_mass_matrix.local_element(i);
+      return cfl_ * mass / (Number(-2.) * d_sum);
+    };
+
     /*
      * -------------------------------------------------------------------------
      * Step 2: Compute off-diagonal d_ij, and alpha_i
@@ -338,21 +1361,200 @@ namespace ryujin
      * -------------------------------------------------------------------------
      */
 
+    /*
+     * Dry row skipping (shallow water only): Flag all locally relevant
+     * degrees of freedom that are dry and at rest in the old state and
+     * all stage states. Then flag all rows whose complete stencil is dry.
+     * For vectorized rows the flag at the beginning of a SIMD stride
+     * indicates that all rows of the stride are dry.
+     */
+
+    const bool skip_dry_rows = shallow_water && skip_dry_rows_;
+
+    if constexpr (shallow_water) {
+      if (skip_dry_rows) {
+        Scope scope(*scoped_slot(2, "flag dry rows", false).timer);
+
+        const auto view = hyperbolic_system_->template view<dim, Number>();
+        constexpr Number eps = std::numeric_limits<Number>::epsilon();
+        const Number h_cutoff = view.reference_water_depth() *
+                                view.dry_state_relaxation_large() * eps;
+        const Number q_cutoff =
+            h_cutoff * std::sqrt(view.gravity() * view.reference_water_depth());
+
+        const auto is_dry = [&](const auto &U) {
+          return std::abs(view.water_depth(U)) < h_cutoff &&
+                 view.momentum(U).norm() < q_cutoff;
+        };
+
+        const unsigned int n_relevant = dry_states_.size();
+
+        RYUJIN_PARALLEL_REGION_BEGIN
+
+        RYUJIN_OMP_FOR
+        for (unsigned int i = 0; i < n_relevant; ++i) {
+          bool dry = is_dry(old_U.get_tensor(i));
+          for (int s = 0; s < stages; ++s) {
+            const auto &U_s = std::get<0>(stage_state_vectors[s].get());
+            dry = dry && is_dry(U_s.get_tensor(i));
+          }
+          dry_states_[i] = dry;
+        }
+
+        RYUJIN_OMP_FOR
+        for (unsigned int i = 0; i < n_owned; ++i) {
+          const unsigned int row_length = sparsity_simd.row_length(i);
+          const unsigned int stride = sparsity_simd.stride_of_row(i);
+          const unsigned int *js = sparsity_simd.columns(i);
+          bool dry = true;
+          for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx)
+            dry = dry && dry_states_[js[col_idx * stride]];
+          dry_rows_[i] = dry;
+        }
+
+        RYUJIN_OMP_FOR
+        for (unsigned int i = 0; i < n_internal; i += simd_length) {
+          bool dry = true;
+          for (unsigned int k = 0; k < simd_length; ++k)
+            dry = dry && dry_rows_[i + k];
+          dry_rows_[i] = dry;
+        }
+
+        RYUJIN_PARALLEL_REGION_END
+      }
+    }
+
+    /*
+     * Frozen wave speed mode: Flag all locally relevant degrees of freedom
+     * whose state moved by more than the relative tolerance since the
+     * wave speeds of their stencil were last computed. Only edges with a
+     * flagged endpoint are recomputed in Step 2.
+     *
+     * Reused wave speeds are only safe if a violation of the invariant
+     * domain property triggers a restart (with all wave speeds
+     * recomputed). We thus fall back to computing all wave speeds if the
+     * strategy is to merely warn, and invalidate the frozen wave speeds
+     * because they are not updated in this case.
+     */
+
+    const bool freeze_wave_speeds =
+        frozen_wave_speed_tolerance_ > Number(0.) &&
+        id_violation_strategy_ == IDViolationStrategy::raise_exception;
+
+    if (!freeze_wave_speeds)
+      frozen_valid_ = false;
+
+    if (freeze_wave_speeds) {
+      Scope scope(*scoped_slot(3, "flag changed states", false).timer);
+
+      const unsigned int n_relevant = state_changed_.size();
+      const Number tolerance = frozen_wave_speed_tolerance_;
+      const bool frozen_valid = frozen_valid_;
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+      RYUJIN_OMP_FOR
+      for (unsigned int i = 0; i < n_relevant; ++i) {
+        const auto U_i = old_U.get_tensor(i);
+        const auto U_frozen = frozen_U_.get_tensor(i);
+
+        Number delta = Number(0.);
+        Number norm = Number(0.);
+        for (unsigned int k = 0; k < problem_dimension; ++k) {
+          delta = std::max(delta, std::abs(U_i[k] - U_frozen[k]));
+          norm = std::max(norm, std::abs(U_frozen[k]));
+        }
+
+        const bool changed = !frozen_valid || delta > tolerance * norm;
+        state_changed_[i] = changed;
+        if (changed)
+          frozen_U_.write_tensor(U_i, i);
+      }
+      RYUJIN_PARALLEL_REGION_END
+
+      frozen_valid_ = true;
+    }
+
     {
-      Scope scope(computing_timer_, scoped_name("compute d_ij, and alpha_i"));
+      const auto slot =
+          scoped_slot(4, "compute d_ij, alpha_i, diag d_ii, and tau_max");
+      Scope scope(*slot.timer);
+      *slot.bytes_streamed +=
+          sweep_bytes_[0] + (fuse_step_3 ? 0. : sweep_bytes_[1]);
+
+      /*
+       * If interface edges are only computed once, the exchange of
+       * alpha_i is deferred and combined with the ghost row exchange of
+       * d_ij started in Step 3. (A separately dispatched exchange of
+       * alpha_i might only be issued after the parallel region on some
+       * MPI ranks, which would deadlock with the exchange of d_ij.)
+       */
+
+      std::future<void> dij_exchange_status;
+
+      /*
+       * Pipelined symmetrization: Every Step 2 thread block decrements
+       * the pending row counters of the chunks it covers; Step 3 then
+       * hands out chunks in increasing order, see below.
+       */
+
+      const bool pipeline_step_3 = pipelined_symmetrization_ && !fuse_step_3;
+      std::atomic<unsigned int> next_chunk = 0;
+
+      if (pipeline_step_3) {
+        for (unsigned int c = 0; c < chunk_rows_pending_.size(); ++c) {
+          const unsigned int n_rows =
+              std::min(n_owned - c * pipeline_chunk_size, pipeline_chunk_size);
+          chunk_rows_pending_[c].store(n_rows, std::memory_order_relaxed);
+          chunk_upper_part_final_[c].store(false, std::memory_order_relaxed);
+        }
+      }
+
+      const auto mark_rows_computed = [&](unsigned int left,
+                                          const unsigned int right) {
+        if (!pipeline_step_3)
+          return;
+        while (left < right) {
+          const unsigned int c = left / pipeline_chunk_size;
+          const unsigned int end =
+              std::min(right, (c + 1) * pipeline_chunk_size);
+          chunk_rows_pending_[c].fetch_sub(end - left,
+                                           std::memory_order_release);
+          left = end;
+        }
+      };
+
+      const auto exchange_interface_edges = [&]() {
+        alpha_.update_ghost_values_start(channel++);
+        dij_matrix_.update_ghost_rows_start(channel++);
+        alpha_.update_ghost_values_finish();
+        dij_matrix_.update_ghost_rows_finish();
+      };
 
       SynchronizationDispatch synchronization_dispatch([&]() {
+        if (compute_interface_edges_once_)
+          return;
         alpha_.update_ghost_values_start(channel++);
         alpha_.update_ghost_values_finish();
       });
 
-      RYUJIN_PARALLEL_REGION_BEGIN
+      RYUJIN_PARALLEL_REGION_BEGIN_NUM_THREADS(phase_threads(0))
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
       auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
         using T = decltype(sentinel);
         unsigned int stride_size = get_stride_size<T>;
 
+        /*
+         * Vectorized rows are processed in logical batches of n_batch SIMD
+         * row groups of uniform row length (see
+         * OfflineData::simd_batch_length). The column loop handles all row
+         * groups of a batch in one iteration, which gives the compiler
+         * independent chains of the Riemann solver to interleave.
+         */
+        constexpr unsigned int n_batch =
+            std::is_same_v<T, VA> ? SIMD_BATCH_MULTIPLIER : 1;
+        const unsigned int batch_size = n_batch * stride_size;
+
         /* Stored thread locally: */
 
         using RiemannSolver =
@@ -361,81 +1563,345 @@ namespace ryujin
             *hyperbolic_system_, riemann_solver_parameters_, old_precomputed);
 
         using Indicator = typename Description::template Indicator<dim, T>;
-        Indicator indicator(
-            *hyperbolic_system_, indicator_parameters_, old_precomputed);
+        std::vector<Indicator> indicators;
+        indicators.reserve(n_batch);
+        for (unsigned int s = 0; s < n_batch; ++s)
+          indicators.emplace_back(
+              *hyperbolic_system_, indicator_parameters_, old_precomputed);
+
+        std::array<std::vector<unsigned int>, n_batch> column_buffers;
+        for (auto &column_buffer : column_buffers)
+          column_buffer.resize(sparsity_simd.column_buffer_size());
+
+        using state_type = decltype(old_U.template get_tensor<T>(0));
+        std::array<state_type, n_batch> U_is;
+        std::array<const unsigned int *, n_batch> columns;
+        std::array<unsigned int, n_batch> lower_prefix_lengths;
+        std::array<bool, n_batch> contiguous;
+        std::array<bool, n_batch> active;
 
         bool thread_ready = false;
 
-        RYUJIN_OMP_FOR
-        for (unsigned int i = left; i < right; i += stride_size) {
+        double n_reused = 0.;
+        double n_computed = 0.;
 
-          /* Skip constrained degrees of freedom: */
-          const unsigned int row_length = sparsity_simd.row_length(i);
-          if (row_length == 1)
-            continue;
+        const auto blocks =
+            offline_data_->thread_blocks(left, right, batch_size);
 
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
+        /*
+         * Both loops operate on disjoint rows, we can thus skip the
+         * implicit barrier. This way the time measured below only
+         * accounts for the actual work performed by each thread.
+         */
+        RYUJIN_OMP_FOR_NOWAIT
+        for (unsigned int b = 0; b < blocks.size(); ++b) {
+          for (unsigned int i = blocks.begin(b); i < blocks.end(b);
+               i += batch_size) {
+            const CostScope cost_scope(dof_cost, i, batch_size);
 
-          const auto U_i = old_U.template get_tensor<T>(i);
+            prefetch_row_group(i, batch_size, right);
 
-          indicator.reset(i, U_i);
+            /* Skip constrained degrees of freedom: */
+            const unsigned int row_length = sparsity_simd.row_length(i);
+            if (row_length == 1)
+              continue;
 
-          const unsigned int *js = sparsity_simd.columns(i);
-          for (unsigned int col_idx = 0; col_idx < row_length;
-               ++col_idx, js += stride_size) {
+            synchronization_dispatch.check(
+                thread_ready, i >= n_export_indices && i < n_internal);
 
-            const auto U_j = old_U.template get_tensor<T>(js);
+            for (unsigned int s = 0; s < n_batch; ++s) {
+              const unsigned int i_s = i + s * stride_size;
 
-            const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
+              /* All wave speeds and the indicator vanish on dry stencils: */
+              active[s] = !(skip_dry_rows && dry_rows_[i_s]);
+              if (!active[s]) {
+                for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx)
+                  dij_matrix_.write_entry(T(0.), i_s, col_idx, true);
+                write_entry<T>(alpha_, T(0.), i_s);
+                continue;
+              }
 
-            indicator.accumulate(js, U_j, c_ij);
+              U_is[s] = old_U.template get_tensor<T>(i_s);
+              indicators[s].reset(i_s, U_is[s]);
+              columns[s] = sparsity_simd.columns(i_s, column_buffers[s].data());
+              lower_prefix_lengths[s] = sparsity_simd.lower_prefix_length(i_s);
+              contiguous[s] = sparsity_simd.contiguous_columns(i_s);
+            }
 
-            /* Skip diagonal. */
-            if (col_idx == 0)
-              continue;
+            const auto column_loop = [&](const auto n_columns) {
+              for (unsigned int col_idx = 0; col_idx < n_columns; ++col_idx) {
+                for (unsigned int s = 0; s < n_batch; ++s) {
+                  if (!active[s])
+                    continue;
+
+                  const unsigned int i_s = i + s * stride_size;
+                  const auto &U_i = U_is[s];
+                  const unsigned int *js = columns[s] + col_idx * stride_size;
+
+                  /* Lane contiguous stencils need no gather: */
+                  const auto U_j =
+                      contiguous[s]
+                          ? old_U.template get_contiguous_tensor<T>(js[0])
+                          : old_U.template get_tensor<T>(js);
+
+                  const auto c_ij =
+                      cij_matrix.template get_tensor<T>(i_s, col_idx);
+
+                  indicators[s].accumulate(js, U_j, c_ij);
+
+                  /* Skip diagonal. */
+                  if (col_idx == 0)
+                    continue;
+
+                  /*
+                   * Only iterate over the upper triangular portion of
+                   * d_ij. The leading columns that are lower triangular
+                   * for all lanes are skipped without a lane-wise check:
+                   */
+                  if (col_idx < lower_prefix_lengths[s] ||
+                      all_computed_elsewhere<T>(i_s, js, computed_elsewhere))
+                    continue;
+
+                  /* Reuse (inflated) frozen wave speeds if nothing changed: */
+                  if (freeze_wave_speeds &&
+                      !any_state_changed<T>(state_changed_, i_s, js)) {
+                    const auto d_ij =
+                        frozen_dij_matrix_.template get_entry<T>(i_s, col_idx);
+                    dij_matrix_.write_entry(T(frozen_wave_speed_inflation_) *
+                                                d_ij,
+                                            i_s,
+                                            col_idx,
+                                            true);
+                    n_reused += stride_size;
+                    continue;
+                  }
+
+                  const auto norm = c_ij.norm();
+                  const auto n_ij = c_ij / norm;
+                  const auto lambda_max =
+                      riemann_solver.compute(U_i, U_j, i_s, js, n_ij);
+                  const auto d_ij = norm * lambda_max;
+
+                  dij_matrix_.write_entry(d_ij, i_s, col_idx, true);
+
+                  if (freeze_wave_speeds) {
+                    frozen_dij_matrix_.write_entry(d_ij, i_s, col_idx);
+                    n_computed += stride_size;
+                  }
+                }
+              }
+            };
+            dispatch_row_length<T, regular_row_length>(row_length, column_loop);
 
-            /* Only iterate over the upper triangular portion of d_ij */
-            if (all_below_diagonal<T>(i, js))
+            for (unsigned int s = 0; s < n_batch; ++s) {
+              if (!active[s])
+                continue;
+
+              const unsigned int i_s = i + s * stride_size;
+              const auto mass = get_entry<T>(lumped_mass_matrix, i_s);
+              const auto hd_i = mass * measure_of_omega_inverse;
+              write_entry<T>(alpha_, indicators[s].alpha(hd_i), i_s);
+            }
+          }
+
+          mark_rows_computed(blocks.begin(b), blocks.end(b));
+        }
+
+        if (freeze_wave_speeds) {
+          auto &[reused, computed] = frozen_edge_statistics_[thread_number()];
+          reused += n_reused;
+          computed += n_computed;
+        }
+      };
+
+      /*
+       * A masked variant of above loop for the non-internal rows [left,
+       * right) that vectorizes over simd_length consecutive rows of
+       * differing row length: every lane gathers the entries of its own
+       * row. Lanes that have exhausted their row (or belong to a
+       * constrained degree of freedom) point to their own diagonal with a
+       * vanishing c_ij. This leaves the indicator unchanged and the
+       * resulting d_ij are simply not written back.
+       */
+      auto masked_loop = [&](unsigned int left, unsigned int right) {
+        constexpr unsigned int simd_length = VA::size();
+
+        /* Stored thread locally: */
+
+        using RiemannSolver =
+            typename Description::template RiemannSolver<dim, VA>;
+        RiemannSolver riemann_solver(
+            *hyperbolic_system_, riemann_solver_parameters_, old_precomputed);
+
+        using Indicator = typename Description::template Indicator<dim, VA>;
+        Indicator indicator(
+            *hyperbolic_system_, indicator_parameters_, old_precomputed);
+
+        double n_reused = 0.;
+        double n_computed = 0.;
+
+        const auto blocks =
+            offline_data_->thread_blocks(left, right, simd_length);
+
+        RYUJIN_OMP_FOR_NOWAIT
+        for (unsigned int b = 0; b < blocks.size(); ++b) {
+          for (unsigned int i = blocks.begin(b); i < blocks.end(b);
+               i += simd_length) {
+            const CostScope cost_scope(dof_cost, i, simd_length);
+
+            std::array<unsigned int, simd_length> row_lengths;
+            unsigned int max_row_length = 0;
+            for (unsigned int k = 0; k < simd_length; ++k) {
+              row_lengths[k] = sparsity_simd.row_length(i + k);
+              /* Mask constrained degrees of freedom entirely: */
+              if (row_lengths[k] == 1)
+                row_lengths[k] = 0;
+              max_row_length = std::max(max_row_length, row_lengths[k]);
+            }
+
+            if (max_row_length == 0)
               continue;
 
-            const auto norm = c_ij.norm();
-            const auto n_ij = c_ij / norm;
-            const auto lambda_max =
-                riemann_solver.compute(U_i, U_j, i, js, n_ij);
-            const auto d_ij = norm * lambda_max;
+            const auto U_i = old_U.template get_tensor<VA>(i);
+
+            indicator.reset(i, U_i);
+
+            std::array<unsigned int, simd_length> js;
+            for (unsigned int col_idx = 0; col_idx < max_row_length;
+                 ++col_idx) {
+
+              Tensor<1, dim, VA> c_ij;
+              bool all_computed_elsewhere = true;
+              for (unsigned int k = 0; k < simd_length; ++k) {
+                if (col_idx < row_lengths[k]) {
+                  js[k] = sparsity_simd.columns(i + k)[col_idx];
+                  const auto c = cij_matrix.template get_tensor<Number>(
+                      i + k, col_idx);
+                  for (unsigned int d = 0; d < dim; ++d)
+                    c_ij[d][k] = c[d];
+                  all_computed_elsewhere = all_computed_elsewhere &&
+                                           computed_elsewhere(i + k, js[k]);
+                } else {
+                  js[k] = i + k;
+                }
+              }
 
-            dij_matrix_.write_entry(d_ij, i, col_idx, true);
+              const auto U_j = old_U.template get_tensor<VA>(js.data());
+
+              indicator.accumulate(js.data(), U_j, c_ij);
+
+              /* Skip diagonal. */
+              if (col_idx == 0)
+                continue;
+
+              /* Only iterate over the upper triangular portion of d_ij */
+              if (all_computed_elsewhere)
+                continue;
+
+              /* Reuse (inflated) frozen wave speeds if nothing changed: */
+              if (freeze_wave_speeds) {
+                bool changed = false;
+                for (unsigned int k = 0; k < simd_length; ++k)
+                  if (col_idx < row_lengths[k] &&
+                      (state_changed_[i + k] || state_changed_[js[k]]))
+                    changed = true;
+
+                if (!changed) {
+                  for (unsigned int k = 0; k < simd_length; ++k)
+                    if (col_idx < row_lengths[k] && js[k] > i + k &&
+                        !computed_elsewhere(i + k, js[k])) {
+                      const auto d_ij =
+                          frozen_dij_matrix_.get_entry(i + k, col_idx);
+                      dij_matrix_.write_entry(
+                          frozen_wave_speed_inflation_ * d_ij,
+                          i + k,
+                          col_idx,
+                          true);
+                      n_reused += 1.;
+                    }
+                  continue;
+                }
+              }
+
+              /* Use a unit normal for masked lanes: */
+              const auto norm = c_ij.norm();
+              const auto safe_norm =
+                  compare_and_apply_mask<SIMDComparison::equal>(
+                      norm, VA(0.), VA(1.), norm);
+              auto n_ij = c_ij / safe_norm;
+              n_ij[0] = compare_and_apply_mask<SIMDComparison::equal>(
+                  norm, VA(0.), VA(1.), n_ij[0]);
+
+              const auto lambda_max =
+                  riemann_solver.compute(U_i, U_j, i, js.data(), n_ij);
+              const auto d_ij = norm * lambda_max;
+
+              for (unsigned int k = 0; k < simd_length; ++k)
+                if (col_idx < row_lengths[k] && js[k] > i + k &&
+                    !computed_elsewhere(i + k, js[k])) {
+                  dij_matrix_.write_entry(d_ij[k], i + k, col_idx, true);
+                  if (freeze_wave_speeds) {
+                    frozen_dij_matrix_.write_entry(d_ij[k], i + k, col_idx);
+                    n_computed += 1.;
+                  }
+                }
+            }
+
+            const auto mass = get_entry<VA>(lumped_mass_matrix, i);
+            const auto hd_i = mass * measure_of_omega_inverse;
+            const auto alpha_i = indicator.alpha(hd_i);
+            for (unsigned int k = 0; k < simd_length; ++k)
+              if (row_lengths[k] != 0)
+                write_entry<Number>(alpha_, alpha_i[k], i + k);
           }
 
-          const auto mass = get_entry<T>(lumped_mass_matrix, i);
-          const auto hd_i = mass * measure_of_omega_inverse;
-          write_entry<T>(alpha_, indicator.alpha(hd_i), i);
+          mark_rows_computed(blocks.begin(b), blocks.end(b));
+        }
+
+        if (freeze_wave_speeds) {
+          auto &[reused, computed] = frozen_edge_statistics_[thread_number()];
+          reused += n_reused;
+          computed += n_computed;
         }
       };
 
-      /* Parallel non-vectorized loop: */
-      loop(Number(), n_internal, n_owned);
-      /* Parallel vectorized SIMD loop: */
-      loop(VA(), 0, n_internal);
+      const auto thread_start = std::chrono::steady_clock::now();
 
-      LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
-      RYUJIN_PARALLEL_REGION_END
-    }
+      if (vectorize_noninternal_rows_) {
+        /* Masked vectorized loop over full strides, rest non-vectorized: */
+        const unsigned int n_masked =
+            n_internal + (n_owned - n_internal) / VA::size() * VA::size();
+        masked_loop(n_internal, n_masked);
+        loop(Number(), n_masked, n_owned);
+      } else {
+        /* Parallel non-vectorized loop: */
+        loop(Number(), n_internal, n_owned);
+      }
+      /* Parallel vectorized SIMD loop (export rows first): */
+      if (n_export_split != 0)
+        loop(VA(), 0, n_export_split);
+      loop(VA(), n_export_split, n_internal);
 
-    /*
-     * -------------------------------------------------------------------------
-     * Step 3: Compute diagonal of d_ij, and maximal time-step size.
-     * -------------------------------------------------------------------------
-     */
+      const std::chrono::duration<double> thread_time =
+          std::chrono::steady_clock::now() - thread_start;
+      thread_busy_time_[thread_number()] += thread_time.count();
 
-    {
-      Scope scope(computing_timer_,
-                  scoped_name("compute bdry d_ij, diag d_ii, and tau_max"));
+      /*
+       * -----------------------------------------------------------------------
+       * Step 3: Compute diagonal of d_ij, and maximal time-step size.
+       *
+       * Step 3 only accesses locally owned rows of d_ij that have been
+       * computed in Step 2. We thus stay in the same parallel region and
+       * only issue a thread barrier instead of paying for another
+       * fork/join. The ghost exchange of alpha_i started in Step 2
+       * continues in the background. With pipelined symmetrization even
+       * the barrier is replaced by chunk dependencies.
+       * -----------------------------------------------------------------------
+       */
 
-      /* Parallel region */
-      RYUJIN_PARALLEL_REGION_BEGIN
-      LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
+      if (!pipeline_step_3) {
+        RYUJIN_OMP_BARRIER
+      }
 
       /*
        * Complete d_ij at boundary:
@@ -453,30 +1919,23 @@ namespace ryujin
 
       Number local_tau_max = std::numeric_limits<Number>::max();
 
-      /*
-       * Note: we need this dance of iterating over an integer and then
-       * accessing the element to make Apple's OpenMP implementation
-       * happy.
-       */
-      RYUJIN_OMP_FOR
-      for (std::size_t k = 0; k < coupling_boundary_pairs.size(); ++k) {
+      const auto fix_up_coupling_pair = [&](const std::size_t k) {
         const auto &[i, col_idx, j] = coupling_boundary_pairs[k];
 
         /*
-         * Only work on index pairs "i < j" that point to the upper
-         * triangular portion of the d_ij matrix. For all of these index
-         * pairs we compute the corresponding d_ji entry and fix up the
-         * d_ij entry (from step 2) by taking the maximum. Note that we
-         * actually do not store anything in the d_ji entry itself because
-         * we symmetrize the matrix later on anyway.
+         * We only work on index pairs "i < j" that point to the upper
+         * triangular portion of the d_ij matrix (see prepare()). For all
+         * of these index pairs we compute the corresponding d_ji entry and
+         * fix up the d_ij entry (from step 2) by taking the maximum. Note
+         * that we actually do not store anything in the d_ji entry itself
+         * because we symmetrize the matrix later on anyway.
          */
-        if (j < i)
-          continue;
 
         const auto U_i = old_U.get_tensor(i);
         const auto U_j = old_U.get_tensor(j);
 
-        const auto c_ji = cij_matrix.get_transposed_tensor(i, col_idx);
+        const auto c_ji =
+            cij_matrix.template get_transposed_tensor<Number>(i, col_idx);
         Assert(c_ji.norm() > 1.e-12, ExcInternalError());
         const auto norm_ji = c_ji.norm();
         const auto n_ji = c_ji / norm_ji;
@@ -487,70 +1946,109 @@ namespace ryujin
         const auto d_ji = norm_ji * lambda_max;
 
         dij_matrix_.write_entry(std::max(d_ij, d_ji), i, col_idx);
-      }
-
-      /* Symmetrize d_ij: */
-
-      RYUJIN_OMP_FOR
-      for (unsigned int i = 0; i < n_owned; ++i) {
-
-        /* Skip constrained degrees of freedom: */
-        const unsigned int row_length = sparsity_simd.row_length(i);
-        if (row_length == 1)
-          continue;
-
-        Number d_sum = Number(0.);
-
-        /* skip diagonal: */
-        const unsigned int *js = sparsity_simd.columns(i);
-        for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
-          const auto j =
-              *(i < n_internal ? js + col_idx * simd_length : js + col_idx);
+      };
 
-          // fill lower triangular part of dij_matrix missing from step 1
-          if (j < i) {
-            const auto d_ji = dij_matrix_.get_transposed_entry(i, col_idx);
+      /*
+       * Note: we need this dance of iterating over an integer and then
+       * accessing the element to make Apple's OpenMP implementation
+       * happy.
+       */
+      if (!pipeline_step_3) {
+        RYUJIN_OMP_FOR
+        for (std::size_t k = 0; k < coupling_boundary_pairs.size(); ++k)
+          fix_up_coupling_pair(k);
+      }
 
-#ifdef DEBUG
-            /* Verify that d_ji == std::max(d_ij, d_ji): */
+      /*
+       * If interface edges are only computed once, all rows with ghost
+       * columns (the export rows and the non-internal rows) can only be
+       * symmetrized after the exported rows of d_ij have been received
+       * from our neighbors. The exchange is handed over to the
+       * communication thread and overlapped with the symmetrization of
+       * the remaining internal rows.
+       */
 
-            const auto U_i = old_U.get_tensor(i);
-            const auto U_j = old_U.get_tensor(j);
+      if (compute_interface_edges_once_) {
+        RYUJIN_OMP_SINGLE
+        {
+#ifdef ASYNC_MPI_EXCHANGE
+          dij_exchange_status =
+              CommunicationThread::instance().post(exchange_interface_edges);
+#else
+          exchange_interface_edges();
+#endif
+        }
+      }
 
-            const auto c_ij = cij_matrix.get_tensor(i, col_idx);
-            Assert(c_ij.norm() > 1.e-12, ExcInternalError());
-            const auto norm_ij = c_ij.norm();
-            const auto n_ij = c_ij / norm_ij;
+      /* Symmetrize d_ij: */
 
-            const auto lambda_max =
-                riemann_solver.compute(U_i, U_j, i, &j, n_ij);
-            const auto d_ij = norm_ij * lambda_max;
+      const auto symmetrize_rows = [&](unsigned int left, unsigned int right) {
+        const bool record_local_tau = !local_tau_.empty();
+        RYUJIN_OMP_FOR_NOWAIT
+        for (unsigned int i = left; i < right; ++i) {
+          const auto tau_i = symmetrize_row(riemann_solver, i);
+          local_tau_max = std::min(local_tau_max, tau_i);
+          if (record_local_tau)
+            local_tau_[i] = tau_i;
+        }
+      };
 
-            Assert(d_ij <= d_ji + 1.0e-12,
-                   dealii::ExcMessage("d_ij not symmetrized correctly on "
-                                      "boundary degrees of freedom."));
-#endif
+      if (compute_interface_edges_once_) {
+        if (!fuse_step_3)
+          symmetrize_rows(n_export_indices, n_internal);
 
-            dij_matrix_.write_entry(d_ji, i, col_idx);
-          }
+        RYUJIN_OMP_SINGLE
+        {
+          if (dij_exchange_status.valid())
+            dij_exchange_status.wait();
+        }
 
-          d_sum -= dij_matrix_.get_entry(i, col_idx);
+        if (!fuse_step_3) {
+          symmetrize_rows(0, n_export_indices);
+          symmetrize_rows(n_internal, n_owned);
         }
 
+      } else if (pipeline_step_3) {
         /*
-         * Make sure that we do not accidentally divide by zero. (Yes, this
-         * can happen for some (admittedly, rather esoteric) scalar
-         * conservation equations...).
+         * Chunks are handed out in increasing order with an atomic
+         * counter. A thread therefore only ever waits on chunks that have
+         * already been claimed by a running thread, or on Step 2 thread
+         * blocks (that have no barrier), which rules out a deadlock.
          */
-        d_sum =
-            std::min(d_sum, Number(-1.e6) * std::numeric_limits<Number>::min());
+        const bool record_local_tau = !local_tau_.empty();
+        const unsigned int n_chunks = chunk_rows_pending_.size();
+
+        for (unsigned int c = next_chunk++; c < n_chunks; c = next_chunk++) {
+          spin_wait([&]() {
+            return chunk_rows_pending_[c].load(std::memory_order_acquire) == 0;
+          });
+
+          for (unsigned int k = chunk_pair_offsets_[c];
+               k < chunk_pair_offsets_[c + 1];
+               ++k)
+            fix_up_coupling_pair(k);
+          chunk_upper_part_final_[c].store(true, std::memory_order_release);
+
+          for (unsigned int k = chunk_dependency_offsets_[c];
+               k < chunk_dependency_offsets_[c + 1];
+               ++k) {
+            const auto &flag = chunk_upper_part_final_[chunk_dependencies_[k]];
+            spin_wait([&]() { return flag.load(std::memory_order_acquire); });
+          }
 
-        /* write diagonal element */
-        dij_matrix_.write_entry(d_sum, i, 0);
+          const unsigned int left = c * pipeline_chunk_size;
+          const unsigned int right =
+              std::min(n_owned, left + pipeline_chunk_size);
+          for (unsigned int i = left; i < right; ++i) {
+            const auto tau_i = symmetrize_row(riemann_solver, i);
+            local_tau_max = std::min(local_tau_max, tau_i);
+            if (record_local_tau)
+              local_tau_[i] = tau_i;
+          }
+        }
 
-        const Number mass = lumped_mass_matrix.local_element(i);
-        const Number tau = cfl_ * mass / (Number(-2.) * d_sum);
-        local_tau_max = std::min(local_tau_max, tau);
+      } else if (!fuse_step_3) {
+        symmetrize_rows(0, n_owned);
       }
 
       /* Synchronize tau max over all threads: */
@@ -563,13 +2061,11 @@ namespace ryujin
       RYUJIN_PARALLEL_REGION_END
     }
 
-    {
-      Scope scope(computing_timer_,
-                  "time step [H] _ - synchronization barriers");
-
-      /* MPI Barrier: */
-      tau_max.store(Utilities::MPI::min(tau_max.load(), mpi_communicator_));
-
+    /*
+     * A small lambda checking the reduced tau_max, choosing tau, and
+     * recording the multirate histogram:
+     */
+    const auto finalize_tau_max = [&]() {
       AssertThrow(
           !std::isnan(tau_max) && !std::isinf(tau_max) && tau_max > 0.,
           ExcMessage(
@@ -577,15 +2073,79 @@ namespace ryujin
 
       tau = (tau == Number(0.) ? tau_max.load() : tau);
 
+      if (multirate_levels_ > 0 && !fuse_step_3) {
+        /*
+         * Sort all degrees of freedom into multirate levels l such that
+         * 2^l tau_max <= tau_i < 2^(l+1) tau_max:
+         */
+        std::vector<double> histogram(multirate_levels_, 0.);
+        for (unsigned int i = 0; i < n_owned; ++i) {
+          if (sparsity_simd.row_length(i) == 1)
+            continue;
+          Number ratio = local_tau_[i] / tau_max.load();
+          unsigned int level = 0;
+          while (level + 1 < multirate_levels_ && ratio >= Number(2.)) {
+            ratio /= Number(2.);
+            ++level;
+          }
+          histogram[level] += 1.;
+        }
+        Utilities::MPI::sum(histogram, mpi_communicator_, histogram);
+        for (unsigned int l = 0; l < multirate_levels_; ++l)
+          multirate_histogram_[l] += histogram[l];
+      }
+
 #ifdef DEBUG_OUTPUT
       std::cout << "        computed tau_max = " << tau_max << std::endl;
       std::cout << "        perform time-step with tau = " << tau << std::endl;
 #endif
+    };
+
+    Number global_tau_max = Number(0.);
+    MPI_Request tau_max_request = MPI_REQUEST_NULL;
+
+    const auto start_tau_max_reduction = [&]() {
+      global_tau_max = tau_max.load();
+      const int ierr =
+          MPI_Iallreduce(MPI_IN_PLACE,
+                         &global_tau_max,
+                         1,
+                         Utilities::MPI::mpi_type_id_for_type<Number>,
+                         MPI_MIN,
+                         mpi_communicator_,
+                         &tau_max_request);
+      AssertThrowMPI(ierr);
+    };
+
+    /*
+     * In the predictive time-step mode a (locally detected) violation of
+     * the CFL condition merely signals a restart that is communicated
+     * with the final logical_or reduction:
+     */
+    const auto check_predicted_tau = [&]() {
+      if (tau > tau_max.load())
+        restart_needed = true;
+    };
+
+    if (!fuse_step_3) {
+      Scope scope(*timer_slot(1, "synchronization barriers", 0, false).timer);
+
+      if (predict_tau) {
+        check_predicted_tau();
+        start_tau_max_reduction();
+      } else if (overlap_tau_reduction) {
+        start_tau_max_reduction();
+      } else {
+        /* MPI Barrier: */
+        tau_max.store(Utilities::MPI::min(tau_max.load(), mpi_communicator_));
+        finalize_tau_max();
+      }
     }
 
 #ifdef DEBUG
     /*  Exchange d_ij so that we can check for symmetry: */
-    dij_matrix_.update_ghost_rows();
+    if (!fuse_step_3)
+      dij_matrix_.update_ghost_rows();
 #endif
 
     /*
@@ -595,10 +2155,21 @@ namespace ryujin
      */
 
     {
-      Scope scope(computing_timer_,
-                  scoped_name("l.-o. update, compute bounds, r_i, and p_ij"));
+      const auto slot =
+          scoped_slot(5, "l.-o. update, compute bounds, r_i, and p_ij");
+      Scope scope(*slot.timer);
+      *slot.bytes_streamed +=
+          sweep_bytes_[3] + (fuse_step_3 ? sweep_bytes_[2] : 0.);
 
       SynchronizationDispatch synchronization_dispatch([&]() {
+        if (offline_data_->discretization().have_discontinuous_ansatz() &&
+            aggregate_ghost_exchanges_) {
+          bounds_ghost_exchange_.update_ghost_values_start({&r_, &bounds_},
+                                                           channel++);
+          bounds_ghost_exchange_.update_ghost_values_finish();
+          return;
+        }
+
         r_.update_ghost_values_start(channel++);
         r_.update_ghost_values_finish();
         if (offline_data_->discretization().have_discontinuous_ansatz()) {
@@ -616,9 +2187,17 @@ namespace ryujin
           -std::accumulate(stage_weights.begin(), stage_weights.end(), -1.);
 
       /* Parallel region */
-      RYUJIN_PARALLEL_REGION_BEGIN
+      RYUJIN_PARALLEL_REGION_BEGIN_NUM_THREADS(phase_threads(1))
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
+      /* Only used in fused mode, see Step 3: */
+      using RiemannSolver =
+          typename Description::template RiemannSolver<dim, Number>;
+      RiemannSolver riemann_solver(
+          *hyperbolic_system_, riemann_solver_parameters_, old_precomputed);
+
+      Number local_tau_max = std::numeric_limits<Number>::max();
+
       auto loop = [&](auto sentinel,
                       auto have_discontinuous_ansatz,
                       unsigned int left,
@@ -637,10 +2216,15 @@ namespace ryujin
         /* Stored thread locally: */
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
+        std::vector<unsigned int> column_buffer(
+            sparsity_simd.column_buffer_size());
         bool thread_ready = false;
 
         RYUJIN_OMP_FOR
         for (unsigned int i = left; i < right; i += stride_size) {
+          const CostScope cost_scope(dof_cost, i, stride_size);
+
+          prefetch_row_group(i, stride_size, right);
 
           /* Skip constrained degrees of freedom: */
           const unsigned int row_length = sparsity_simd.row_length(i);
@@ -650,20 +2234,63 @@ namespace ryujin
           synchronization_dispatch.check(
               thread_ready, i >= n_export_indices && i < n_internal);
 
+          if (fuse_step_3) {
+            for (unsigned int k = 0; k < stride_size; ++k) {
+              const auto tau_i = symmetrize_row(riemann_solver, i + k);
+              local_tau_max = std::min(local_tau_max, tau_i);
+            }
+          }
+
           const auto U_i = old_U.template get_tensor<T>(i);
-          auto U_i_new = U_i;
+          auto U_i_new = defer_tau ? state_type() : U_i;
 
           const auto alpha_i = get_entry<T>(alpha_, i);
           const auto m_i = get_entry<T>(lumped_mass_matrix, i);
           const auto m_i_inv = get_entry<T>(lumped_mass_matrix_inverse, i);
 
+          /*
+           * Local time stepping: Every row advances with its own pseudo
+           * time step that is proportional to its admissible tau_i:
+           */
+          const auto tau_scale =
+              local_time_stepping_
+                  ? get_entry<T>(local_tau_, i) / T(tau_max.load())
+                  : T(1.);
+          const auto tau_i = tau * tau_scale;
+          const auto tau_i_low_order = tau_low_order * tau_scale;
+
           const auto flux_i = view.flux_contribution(
               old_precomputed, initial_precomputed_, i, U_i);
 
+          /*
+           * On dry stencils all fluxes and source terms vanish: The state
+           * remains unchanged, and the high-order flux and the antidiffusive
+           * fluxes P_ij are zero. The limiter bounds collapse to (the
+           * relaxation of) the state U_i itself.
+           */
+          if constexpr (shallow_water) {
+            if (skip_dry_rows && dry_rows_[i]) {
+              for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx)
+                pij_matrix_.write_entry(state_type(), i, col_idx, true);
+
+              new_U.template write_tensor<T>(U_i, i);
+              r_.template write_tensor<T>(state_type(), i);
+
+              limiter.reset(i, U_i, flux_i);
+              limiter.accumulate(
+                  U_i, U_i, U_i, dealii::Tensor<1, dim, T>(), state_type());
+              const auto hd_i = m_i * measure_of_omega_inverse;
+              const auto hd_i_power = get_entry<T>(relaxation_powers_, i);
+              bounds_.template write_tensor<T>(
+                  limiter.bounds(hd_i, hd_i_power), i);
+              continue;
+            }
+          }
+
           std::array<flux_contribution_type, stages> flux_iHs;
           [[maybe_unused]] state_type S_iH;
 
-          for (int s = 0; s < stages; ++s) {
+          for (int s = 0; s < stages && !use_cached_stage_fluxes; ++s) {
             const auto &[U_s, prec_s, V_s] = stage_state_vectors[s].get();
 
             const auto U_iHs = U_s.template get_tensor<T>(i);
@@ -671,8 +2298,9 @@ namespace ryujin
                 view.flux_contribution(prec_s, initial_precomputed_, i, U_iHs);
 
             if constexpr (View::have_source_terms) {
-              S_iH +=
-                  stage_weights[s] * view.nodal_source(prec_s, i, U_iHs, tau);
+              if (nodal_sources)
+                S_iH += stage_weights[s] *
+                        view.nodal_source(prec_s, i, U_iHs, tau);
             }
           }
 
@@ -680,10 +2308,12 @@ namespace ryujin
           state_type F_iH;
 
           if constexpr (View::have_source_terms) {
-            S_i = view.nodal_source(old_precomputed, i, U_i, tau);
-            S_iH += weight * S_i;
-            U_i_new += tau * /* m_i_inv * m_i */ S_i;
-            F_iH += m_i * S_iH;
+            if (nodal_sources) {
+              S_i = view.nodal_source(old_precomputed, i, U_i, tau);
+              S_iH += weight * S_i;
+              U_i_new += tau_i * /* m_i_inv * m_i */ S_i;
+              F_iH += m_i * S_iH;
+            }
           }
 
           limiter.reset(i, U_i, flux_i);
@@ -696,8 +2326,11 @@ namespace ryujin
            * before we can compute limiter bounds.
            */
 
-          const unsigned int *js = sparsity_simd.columns(i);
+          const unsigned int *columns =
+              sparsity_simd.columns(i, column_buffer.data());
+          const bool contiguous = sparsity_simd.contiguous_columns(i);
           if constexpr (shallow_water) {
+            const unsigned int *js = columns;
             for (unsigned int col_idx = 0; col_idx < row_length;
                  ++col_idx, js += stride_size) {
 
@@ -712,144 +2345,188 @@ namespace ryujin
               affine_shift += B_ij;
             }
 
-            affine_shift *= tau * m_i_inv;
+            affine_shift *= tau_i * m_i_inv;
           }
 
           if constexpr (View::have_source_terms) {
-            affine_shift += tau * /* m_i_inv * m_i */ S_i;
+            affine_shift += tau_i * /* m_i_inv * m_i */ S_i;
           }
 
-          js = sparsity_simd.columns(i);
-          for (unsigned int col_idx = 0; col_idx < row_length;
-               ++col_idx, js += stride_size) {
+          const auto column_loop = [&](const auto n_columns) {
+            for (unsigned int col_idx = 0; col_idx < n_columns; ++col_idx) {
+              const unsigned int *js = columns + col_idx * stride_size;
 
-            const auto U_j = old_U.template get_tensor<T>(js);
+              /* Lane contiguous stencils need no gather: */
+              const auto U_j =
+                  contiguous ? old_U.template get_contiguous_tensor<T>(js[0])
+                             : old_U.template get_tensor<T>(js);
 
-            const auto alpha_j = get_entry<T>(alpha_, js);
+              const auto alpha_j = get_entry<T>(alpha_, js);
 
-            const auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
-            auto factor = (alpha_i + alpha_j) * Number(.5);
+              const auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
+              auto factor = (alpha_i + alpha_j) * Number(.5);
 
-            if constexpr (have_discontinuous_ansatz) {
-              const auto incidence_ij =
-                  incidence_matrix.template get_entry<T>(i, col_idx);
-              factor = std::max(factor, incidence_ij);
-            }
+              if constexpr (have_discontinuous_ansatz) {
+                const auto incidence_ij =
+                    incidence_matrix.template get_entry<T>(i, col_idx);
+                factor = std::max(factor, incidence_ij);
+              }
 
-            const auto d_ijH = d_ij * factor;
+              const auto d_ijH = d_ij * factor;
 
 #ifdef DEBUG
-            /*
-             * Verify that all local chunks of the d_ij matrix have been
-             * computed consistently over all MPI ranks. For that we import
-             * all ghost rows from neighboring MPI ranks and simply check
-             * that the (local) values of d_ij and d_ji match.
-             */
-            const auto d_ji =
-                dij_matrix_.template get_transposed_entry<T>(i, col_idx);
-            Assert(std::max(std::abs(d_ij - d_ji), T(1.0e-12)) == T(1.0e-12),
-                   dealii::ExcMessage(
-                       "d_ij not symmetrized correctly over MPI ranks"));
+              /*
+               * Verify that all local chunks of the d_ij matrix have been
+               * computed consistently over all MPI ranks. For that we import
+               * all ghost rows from neighboring MPI ranks and simply check
+               * that the (local) values of d_ij and d_ji match.
+               *
+               * In fused mode the transposed row might not have been
+               * symmetrized yet, so we cannot perform this check.
+               */
+              if (!fuse_step_3) {
+                const auto d_ji =
+                    dij_matrix_.template get_transposed_entry<T>(i, col_idx);
+                Assert(std::max(std::abs(d_ij - d_ji), T(1.0e-12)) ==
+                           T(1.0e-12),
+                       dealii::ExcMessage(
+                           "d_ij not symmetrized correctly over MPI ranks"));
+              }
 #endif
 
-            const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
-            const auto regularization =
-                T(100. * std::numeric_limits<Number>::min());
-            const auto scaled_c_ij = c_ij / std::max(d_ij, regularization);
-
-            const auto flux_j = view.flux_contribution(
-                old_precomputed, initial_precomputed_, js, U_j);
-
-            const auto m_ij = mass_matrix.template get_entry<T>(i, col_idx);
+              const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
+              const auto regularization =
+                  T(100. * std::numeric_limits<Number>::min());
+              const auto scaled_c_ij = c_ij / std::max(d_ij, regularization);
 
-            /*
-             * Compute low-order flux and limiter bounds:
-             */
+              const auto flux_j = view.flux_contribution(
+                  old_precomputed, initial_precomputed_, js, U_j);
 
-            const auto flux_ij = view.flux_divergence(flux_i, flux_j, c_ij);
-            U_i_new += tau * m_i_inv * flux_ij;
-            auto P_ij = -flux_ij;
+              const auto m_ij = mass_matrix.template get_entry<T>(i, col_idx);
 
-            if constexpr (shallow_water) {
               /*
-               * Workaround: Shallow water (and related) are special:
+               * Compute low-order flux and limiter bounds. For shallow
+               * water the equilibrated states of the edge are formed only
+               * once and are reused for the low-order flux, the low-order
+               * update and the limiter bounds:
                */
 
-              const auto &[U_star_ij, U_star_ji] =
-                  view.equilibrated_states(flux_i, flux_j);
-
-              U_i_new += tau * m_i_inv * d_ij * (U_star_ji - U_star_ij);
-              F_iH += d_ijH * (U_star_ji - U_star_ij);
-              P_ij += (d_ijH - d_ij) * (U_star_ji - U_star_ij);
+              [[maybe_unused]] std::array<state_type, 2> U_star;
+              if constexpr (shallow_water)
+                U_star = view.equilibrated_states(flux_i, flux_j);
 
-              limiter.accumulate(
-                  U_j, U_star_ij, U_star_ji, scaled_c_ij, affine_shift);
+              const auto flux_ij = [&]() {
+                if constexpr (shallow_water)
+                  return view.flux_divergence(flux_i, U_star, c_ij);
+                else
+                  return view.flux_divergence(flux_i, flux_j, c_ij);
+              }();
+              U_i_new += tau_i_low_order * m_i_inv * flux_ij;
+              auto P_ij = -flux_ij;
 
-            } else {
+              if constexpr (shallow_water) {
+                /*
+                 * Workaround: Shallow water (and related) are special:
+                 */
 
-              U_i_new += tau * m_i_inv * d_ij * (U_j - U_i);
-              F_iH += d_ijH * (U_j - U_i);
-              P_ij += (d_ijH - d_ij) * (U_j - U_i);
+                const auto &[U_star_ij, U_star_ji] = U_star;
 
-              limiter.accumulate(js, U_j, flux_j, scaled_c_ij, affine_shift);
-            }
+                U_i_new += tau_i * m_i_inv * d_ij * (U_star_ji - U_star_ij);
+                F_iH += d_ijH * (U_star_ji - U_star_ij);
+                P_ij += (d_ijH - d_ij) * (U_star_ji - U_star_ij);
 
-            if constexpr (View::have_source_terms) {
-              F_iH -= m_ij * S_iH;
-              P_ij -= m_ij * /*sic!*/ S_i;
-            }
+                limiter.accumulate(
+                    U_j, U_star_ij, U_star_ji, scaled_c_ij, affine_shift);
 
-            /*
-             * Compute high-order fluxes and source terms:
-             */
+              } else {
 
-            if constexpr (View::have_high_order_flux) {
-              const auto high_order_flux_ij =
-                  view.high_order_flux_divergence(flux_i, flux_j, c_ij);
-              F_iH += weight * high_order_flux_ij;
-              P_ij += weight * high_order_flux_ij;
-            } else {
-              F_iH += weight * flux_ij;
-              P_ij += weight * flux_ij;
-            }
+                U_i_new += tau_i_low_order * m_i_inv * d_ij * (U_j - U_i);
+                F_iH += d_ijH * (U_j - U_i);
+                P_ij += (d_ijH - d_ij) * (U_j - U_i);
 
-            if constexpr (View::have_source_terms) {
-              const auto S_j = view.nodal_source(old_precomputed, js, U_j, tau);
-              F_iH += weight * m_ij * S_j;
-              P_ij += weight * m_ij * S_j;
-            }
+                limiter.accumulate(js, U_j, flux_j, scaled_c_ij, affine_shift);
+              }
 
-            for (int s = 0; s < stages; ++s) {
-              const auto &[U_s, prec_s, V_s] = stage_state_vectors[s].get();
+              if constexpr (View::have_source_terms) {
+                if (nodal_sources) {
+                  F_iH -= m_ij * S_iH;
+                  P_ij -= m_ij * /*sic!*/ S_i;
+                }
+              }
 
-              const auto U_jHs = U_s.template get_tensor<T>(js);
-              const auto flux_jHs = view.flux_contribution(
-                  prec_s, initial_precomputed_, js, U_jHs);
+              /*
+               * Compute high-order fluxes and source terms:
+               */
 
               if constexpr (View::have_high_order_flux) {
-                const auto high_order_flux_ij = view.high_order_flux_divergence(
-                    flux_iHs[s], flux_jHs, c_ij);
-                F_iH += stage_weights[s] * high_order_flux_ij;
-                P_ij += stage_weights[s] * high_order_flux_ij;
+                const auto high_order_flux_ij =
+                    view.high_order_flux_divergence(flux_i, flux_j, c_ij);
+                F_iH += weight * high_order_flux_ij;
+                P_ij += weight * high_order_flux_ij;
+                if (stage_flux_output != nullptr)
+                  stage_flux_output->write_entry(
+                      high_order_flux_ij, i, col_idx);
               } else {
-                const auto flux_ij =
-                    view.flux_divergence(flux_iHs[s], flux_jHs, c_ij);
-                F_iH += stage_weights[s] * flux_ij;
-                P_ij += stage_weights[s] * flux_ij;
+                F_iH += weight * flux_ij;
+                P_ij += weight * flux_ij;
+                if (stage_flux_output != nullptr)
+                  stage_flux_output->write_entry(flux_ij, i, col_idx);
               }
 
               if constexpr (View::have_source_terms) {
-                const auto S_js = view.nodal_source(prec_s, js, U_jHs, tau);
-                F_iH += stage_weights[s] * m_ij * S_js;
-                P_ij += stage_weights[s] * m_ij * S_js;
+                if (nodal_sources) {
+                  const auto S_j =
+                      view.nodal_source(old_precomputed, js, U_j, tau);
+                  F_iH += weight * m_ij * S_j;
+                  P_ij += weight * m_ij * S_j;
+                }
               }
-            }
 
-            pij_matrix_.write_entry(P_ij, i, col_idx, true);
-          }
+              for (int s = 0; s < stages; ++s) {
+                if (use_cached_stage_fluxes) {
+                  const auto flux_ijHs =
+                      stage_flux_input[s]->template get_tensor<T>(i, col_idx);
+                  F_iH += stage_weights[s] * flux_ijHs;
+                  P_ij += stage_weights[s] * flux_ijHs;
+                  continue;
+                }
+
+                const auto &[U_s, prec_s, V_s] = stage_state_vectors[s].get();
+
+                const auto U_jHs = U_s.template get_tensor<T>(js);
+                const auto flux_jHs = view.flux_contribution(
+                    prec_s, initial_precomputed_, js, U_jHs);
+
+                if constexpr (View::have_high_order_flux) {
+                  const auto high_order_flux_ij =
+                      view.high_order_flux_divergence(
+                          flux_iHs[s], flux_jHs, c_ij);
+                  F_iH += stage_weights[s] * high_order_flux_ij;
+                  P_ij += stage_weights[s] * high_order_flux_ij;
+                } else {
+                  const auto flux_ij =
+                      view.flux_divergence(flux_iHs[s], flux_jHs, c_ij);
+                  F_iH += stage_weights[s] * flux_ij;
+                  P_ij += stage_weights[s] * flux_ij;
+                }
+
+                if constexpr (View::have_source_terms) {
+                  if (nodal_sources) {
+                    const auto S_js =
+                        view.nodal_source(prec_s, js, U_jHs, tau);
+                    F_iH += stage_weights[s] * m_ij * S_js;
+                    P_ij += stage_weights[s] * m_ij * S_js;
+                  }
+                }
+              }
+
+              pij_matrix_.write_entry(P_ij, i, col_idx, true);
+            }
+          };
+          dispatch_row_length<T, regular_row_length>(row_length, column_loop);
 
 #ifdef EXPENSIVE_BOUNDS_CHECK
-          if (!view.is_admissible(U_i_new)) {
+          if (!defer_tau && !view.is_admissible(U_i_new)) {
             restart_needed = true;
           }
 #endif
@@ -858,7 +2535,8 @@ namespace ryujin
           r_.template write_tensor<T>(F_iH, i);
 
           const auto hd_i = m_i * measure_of_omega_inverse;
-          const auto relaxed_bounds = limiter.bounds(hd_i);
+          const auto hd_i_power = get_entry<T>(relaxation_powers_, i);
+          const auto relaxed_bounds = limiter.bounds(hd_i, hd_i_power);
           bounds_.template write_tensor<T>(relaxed_bounds, i);
         }
       };
@@ -871,18 +2549,86 @@ namespace ryujin
        */
       if (offline_data_->discretization().have_discontinuous_ansatz()) {
         /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::true_type{}, n_internal, n_owned);
-        loop(VA(), std::true_type{}, 0, n_internal);
+        loop(Number(), std::true_type{}, n_internal, n_active);
+        if (n_export_split != 0)
+          loop(VA(), std::true_type{}, 0, n_export_split);
+        loop(VA(), std::true_type{}, n_export_split, n_internal);
       } else {
         /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::false_type{}, n_internal, n_owned);
-        loop(VA(), std::false_type{}, 0, n_internal);
+        loop(Number(), std::false_type{}, n_internal, n_active);
+        if (n_export_split != 0)
+          loop(VA(), std::false_type{}, 0, n_export_split);
+        loop(VA(), std::false_type{}, n_export_split, n_internal);
       }
 
+      /* Synchronize tau max over all threads: */
+      Number current_tau_max = tau_max.load();
+      while (current_tau_max > local_tau_max &&
+             !tau_max.compare_exchange_weak(current_tau_max, local_tau_max))
+        ;
+
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
       RYUJIN_PARALLEL_REGION_END
     }
 
+    if (overlap_tau_reduction && !predict_tau) {
+      Scope scope(*timer_slot(1, "synchronization barriers", 0, false).timer);
+
+      const int ierr = MPI_Wait(&tau_max_request, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+      tau_max.store(global_tau_max);
+      finalize_tau_max();
+    }
+
+    if (defer_tau) {
+      Scope scope(*scoped_slot(6, "rescale l.-o. update", false).timer);
+
+      /*
+       * Step 4 stored the low-order increment in new_U. Rescale with the
+       * now known tau and add the old state:
+       */
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      [[maybe_unused]] const auto view =
+          hyperbolic_system_->template view<dim, Number>();
+
+      RYUJIN_OMP_FOR
+      for (unsigned int i = 0; i < n_owned; ++i) {
+        /* Skip constrained degrees of freedom: */
+        if (sparsity_simd.row_length(i) == 1)
+          continue;
+
+        const auto U_i_new =
+            old_U.get_tensor(i) + tau * new_U.get_tensor(i);
+        new_U.write_tensor(U_i_new, i);
+
+#ifdef EXPENSIVE_BOUNDS_CHECK
+        if (!view.is_admissible(U_i_new))
+          restart_needed = true;
+#endif
+      }
+
+      RYUJIN_PARALLEL_REGION_END
+    }
+
+    if (fuse_step_3) {
+      Scope scope(*timer_slot(1, "synchronization barriers", 0, false).timer);
+
+      if (predict_tau) {
+        check_predicted_tau();
+        start_tau_max_reduction();
+      } else {
+        /* MPI Barrier: */
+        tau_max.store(Utilities::MPI::min(tau_max.load(), mpi_communicator_));
+
+        AssertThrow(
+            !std::isnan(tau_max) && !std::isinf(tau_max) && tau_max > 0.,
+            ExcMessage(
+                "I'm sorry, Dave. I'm afraid I can't do that.\nWe crashed."));
+      }
+    }
+
     /*
      * -------------------------------------------------------------------------
      * Step 5: Compute second part of P_ij, and l_ij (first round):
@@ -890,14 +2636,18 @@ namespace ryujin
      */
 
     if (limiter_parameters_.iterations() != 0) {
-      Scope scope(computing_timer_, scoped_name("compute p_ij, and l_ij"));
+      const auto slot = scoped_slot(7, "compute p_ij, and l_ij");
+      Scope scope(*slot.timer);
+      *slot.bytes_streamed += sweep_bytes_[4];
 
       SynchronizationDispatch synchronization_dispatch([&]() {
-        lij_matrix_.update_ghost_rows_start(channel++);
+        lij_matrix_.update_ghost_rows_start(channel++,
+                                            /*skip zero rows*/ false,
+                                            quantize_limiter_exchange_);
         lij_matrix_.update_ghost_rows_finish();
       });
 
-      RYUJIN_PARALLEL_REGION_BEGIN
+      RYUJIN_PARALLEL_REGION_BEGIN_NUM_THREADS(phase_threads(2))
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
       auto loop = [&](auto sentinel,
@@ -914,6 +2664,8 @@ namespace ryujin
         /* Stored thread locally: */
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
+        std::vector<unsigned int> column_buffer(
+            sparsity_simd.column_buffer_size());
         bool thread_ready = false;
 
         RYUJIN_OMP_FOR
@@ -930,6 +2682,9 @@ namespace ryujin
           auto bounds =
               bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
 
+          const unsigned int *columns =
+              sparsity_simd.columns(i, column_buffer.data());
+
           /*
            * In case of a discontinuous finite element ansatz we need to
            * extend bounds over the stencil. We do this by looping over the
@@ -937,7 +2692,7 @@ namespace ryujin
            */
           if constexpr (have_discontinuous_ansatz) {
             /* Skip diagonal. */
-            const unsigned int *js = sparsity_simd.columns(i) + stride_size;
+            const unsigned int *js = columns + stride_size;
             for (unsigned int col_idx = 1; col_idx < row_length;
                  ++col_idx, js += stride_size) {
               bounds = Limiter::combine_bounds(
@@ -957,10 +2712,12 @@ namespace ryujin
           const auto F_iH = r_.template get_tensor<T>(i);
 
           const auto lambda_inv = Number(row_length - 1);
-          const auto factor = tau * m_i_inv * lambda_inv;
+          auto factor = tau * m_i_inv * lambda_inv;
+          if (local_time_stepping_)
+            factor *= get_entry<T>(local_tau_, i) / T(tau_max.load());
 
           /* Skip diagonal. */
-          const unsigned int *js = sparsity_simd.columns(i) + stride_size;
+          const unsigned int *js = columns + stride_size;
           for (unsigned int col_idx = 1; col_idx < row_length;
                ++col_idx, js += stride_size) {
 
@@ -998,6 +2755,10 @@ namespace ryujin
             P_ij *= factor;
             pij_matrix_.write_entry(P_ij, i, col_idx);
 
+            /* Limit the (rounded) flux that is applied in Step 6: */
+            if constexpr (!std::is_same_v<PijNumber, Number>)
+              P_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
+
             /*
              * Compute limiter coefficients:
              */
@@ -1028,12 +2789,16 @@ namespace ryujin
        */
       if (offline_data_->discretization().have_discontinuous_ansatz()) {
         /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::true_type{}, n_internal, n_owned);
-        loop(VA(), std::true_type{}, 0, n_internal);
+        loop(Number(), std::true_type{}, n_internal, n_active);
+        if (n_export_split != 0)
+          loop(VA(), std::true_type{}, 0, n_export_split);
+        loop(VA(), std::true_type{}, n_export_split, n_internal);
       } else {
         /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::false_type{}, n_internal, n_owned);
-        loop(VA(), std::false_type{}, 0, n_internal);
+        loop(Number(), std::false_type{}, n_internal, n_active);
+        if (n_export_split != 0)
+          loop(VA(), std::false_type{}, 0, n_export_split);
+        loop(VA(), std::false_type{}, n_export_split, n_internal);
       }
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
@@ -1053,24 +2818,40 @@ namespace ryujin
     const auto n_iterations = limiter_parameters_.iterations();
     for (unsigned int pass = 0; pass < n_iterations; ++pass) {
       bool last_round = (pass + 1 == n_iterations);
+      const bool monitor = last_round && monitor_steady_state_;
+
+      /* Fused steady state reduction, see monitor_steady_state(): */
+      std::atomic<double> steady_state_change = 0.;
+      std::atomic<double> steady_state_norm = 0.;
 
-      std::string additional_step = (last_round ? "" : ", next l_ij");
-      Scope scope(
-          computing_timer_,
-          scoped_name("symmetrize l_ij, h.-o. update" + additional_step));
+      const char *label = last_round
+                              ? "symmetrize l_ij, h.-o. update"
+                              : "symmetrize l_ij, h.-o. update, next l_ij";
+      const auto slot = scoped_slot(8 + pass, label);
+      Scope scope(*slot.timer);
+      *slot.bytes_streamed += sweep_bytes_[5];
 
       if ((n_iterations == 2) && last_round) {
         std::swap(lij_matrix_, lij_matrix_next_);
       }
 
+      /*
+       * The next l_ij are only nonzero in rows where the current pass
+       * actually limited the high-order update. We thus only exchange
+       * ghost rows with nonzero entries; all other ghost rows are zeroed
+       * out on the receiving side.
+       */
       SynchronizationDispatch synchronization_dispatch([&]() {
         if (!last_round) {
-          lij_matrix_next_.update_ghost_rows_start(channel++);
+          lij_matrix_next_.update_ghost_rows_start(
+              channel++,
+              /*skip zero rows*/ true,
+              quantize_limiter_exchange_);
           lij_matrix_next_.update_ghost_rows_finish();
         }
       });
 
-      RYUJIN_PARALLEL_REGION_BEGIN
+      RYUJIN_PARALLEL_REGION_BEGIN_NUM_THREADS(phase_threads(3))
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
       auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
@@ -1086,6 +2867,8 @@ namespace ryujin
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
         bool thread_ready = false;
+        T thread_change = T(0.);
+        T thread_norm = T(0.);
 
         RYUJIN_OMP_FOR
         for (unsigned int i = left; i < right; i += stride_size) {
@@ -1103,6 +2886,9 @@ namespace ryujin
           const Number lambda = Number(1.) / Number(row_length - 1);
           lij_row.resize_fast(row_length);
 
+          /* Set to false if any (symmetrized) l_ij of the row is below one: */
+          bool row_unlimited = true;
+
           /* Skip diagonal. */
           for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
 
@@ -1114,8 +2900,10 @@ namespace ryujin
 
             U_i_new += l_ij * lambda * p_ij;
 
-            if (!last_round)
+            if (!last_round) {
               lij_row[col_idx] = l_ij;
+              row_unlimited = row_unlimited && (l_ij == T(1.));
+            }
           }
 
 #ifdef EXPENSIVE_BOUNDS_CHECK
@@ -1127,10 +2915,39 @@ namespace ryujin
 
           new_U.template write_tensor<T>(U_i_new, i);
 
+          if (monitor) {
+            const auto m_i = get_entry<T>(lumped_mass_matrix, i);
+            const auto U_i_old = old_U.template get_tensor<T>(i);
+            for (unsigned int k = 0; k < problem_dimension; ++k) {
+              thread_change += m_i * std::abs(U_i_new[k] - U_i_old[k]);
+              thread_norm += m_i * std::abs(U_i_new[k]);
+            }
+          }
+
           /* Skip computating l_ij and updating p_ij in the last round */
           if (last_round)
             continue;
 
+#ifndef EXPENSIVE_BOUNDS_CHECK
+          /*
+           * Shortcut: An edge with l_ij = 1 leaves no remaining update
+           * direction (1 - l_ij) P_ij for the next pass, and we write
+           * (1 - l_ij^(1)) * l_ij^(2) = 0 irrespective of l_ij^(2). If
+           * this holds for the whole row, the limiter is not invoked at all
+           * and the bounds are not loaded. Every edge with l_ij = 1 is
+           * skipped individually further down below.
+           *
+           * In smooth regions this is the case for most rows. We skip the
+           * shortcut if `EXPENSIVE_BOUNDS_CHECK` is set so that the second
+           * pass still verifies all high-order updates.
+           */
+          if (row_unlimited) {
+            for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx)
+              lij_matrix_next_.write_entry(T(0.), i, col_idx, true);
+            continue;
+          }
+#endif
+
           const auto bounds =
               bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
           /* Skip diagonal. */
@@ -1138,6 +2955,13 @@ namespace ryujin
 
             const auto old_l_ij = lij_row[col_idx];
 
+#ifndef EXPENSIVE_BOUNDS_CHECK
+            if (old_l_ij == T(1.)) {
+              lij_matrix_next_.write_entry(T(0.), i, col_idx, true);
+              continue;
+            }
+#endif
+
             const auto new_p_ij =
                 (T(1.) - old_l_ij) *
                 pij_matrix_.template get_tensor<T>(i, col_idx);
@@ -1170,31 +2994,146 @@ namespace ryujin
             lij_matrix_next_.write_entry(entry, i, col_idx, true);
           }
         }
+
+        if (monitor) {
+          double change = 0.;
+          double norm = 0.;
+          if constexpr (std::is_same_v<T, Number>) {
+            change = thread_change;
+            norm = thread_norm;
+          } else {
+            for (unsigned int k = 0; k < T::size(); ++k) {
+              change += thread_change[k];
+              norm += thread_norm[k];
+            }
+          }
+          steady_state_change += change;
+          steady_state_norm += norm;
+        }
       };
 
       /* Parallel non-vectorized loop: */
-      loop(Number(), n_internal, n_owned);
-      /* Parallel vectorized SIMD loop: */
-      loop(VA(), 0, n_internal);
+      loop(Number(), n_internal, n_active);
+      /* Parallel vectorized SIMD loop (export rows first): */
+      if (n_export_split != 0)
+        loop(VA(), 0, n_export_split);
+      loop(VA(), n_export_split, n_internal);
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
       RYUJIN_PARALLEL_REGION_END
+
+      if (monitor) {
+        steady_state_change_ = steady_state_change / double(tau);
+        steady_state_norm_ = steady_state_norm;
+      }
     } /* limiter_iter_ */
 
     CALLGRIND_STOP_INSTRUMENTATION;
 
+    /*
+     * Sampled bounds check: Verify the final high-order update of a
+     * rotating, pseudo-random subset of rows against the bounds computed
+     * in Step 4. A zero update direction P leaves the state unchanged and
+     * the limiter merely reports whether the state is within bounds.
+     */
+
+    if (bounds_check_fraction_ > 0.) {
+      Scope scope(*timer_slot(16, "sampled bounds check", 0, false).timer);
+
+      const unsigned int period =
+          full_bounds_check_
+              ? 1
+              : std::max(1u,
+                         static_cast<unsigned int>(
+                             std::round(1. / bounds_check_fraction_)));
+      const unsigned int offset = bounds_check_offset_++;
+
+      std::atomic<unsigned int> n_checks = 0;
+      std::atomic<unsigned int> n_violations = 0;
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
+        using T = decltype(sentinel);
+        using Limiter = typename Description::template Limiter<dim, T>;
+        using state_type = typename Limiter::state_type;
+
+        unsigned int stride_size = get_stride_size<T>;
+
+        /* Stored thread locally: */
+        Limiter limiter(
+            *hyperbolic_system_, limiter_parameters_, old_precomputed);
+        unsigned int thread_checks = 0;
+        unsigned int thread_violations = 0;
+
+        RYUJIN_OMP_FOR_NOWAIT
+        for (unsigned int i = left; i < right; i += stride_size) {
+
+          /*
+           * Multiplicative hashing of the stride index: Every stride is
+           * selected exactly once in period consecutive stages:
+           */
+          if ((i / stride_size * 2654435761u + offset) % period != 0)
+            continue;
+
+          /* Skip constrained degrees of freedom: */
+          const unsigned int row_length = sparsity_simd.row_length(i);
+          if (row_length == 1)
+            continue;
+
+          const auto U_i_new = new_U.template get_tensor<T>(i);
+          const auto bounds =
+              bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
+
+          const auto success =
+              std::get<1>(limiter.limit(bounds, U_i_new, state_type()));
+
+          thread_checks++;
+          if (!success)
+            thread_violations++;
+        }
+
+        n_checks += thread_checks;
+        n_violations += thread_violations;
+      };
+
+      /* Parallel non-vectorized loop: */
+      loop(Number(), n_internal, n_active);
+      /* Parallel vectorized SIMD loop: */
+      loop(VA(), 0, n_internal);
+
+      RYUJIN_PARALLEL_REGION_END
+
+      n_bounds_checks_ += n_checks;
+      n_bounds_violations_ += n_violations;
+
+      /* Fall back to a full check as long as the violation rate spikes: */
+      full_bounds_check_ =
+          n_violations > bounds_check_spike_threshold_ * n_checks;
+    }
+
     /*
      * Do we have to restart?
      */
 
     {
-      Scope scope(computing_timer_,
-                  "time step [H] _ - synchronization barriers");
+      Scope scope(*timer_slot(1, "synchronization barriers", 0, false).timer);
+
+      if (tau_max_request != MPI_REQUEST_NULL) {
+        const int ierr = MPI_Wait(&tau_max_request, MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+        tau_max.store(global_tau_max);
+        finalize_tau_max();
+      }
 
       restart_needed.store(
           Utilities::MPI::logical_or(restart_needed.load(), mpi_communicator_));
     }
 
+    /* Predict the time-step size of the first stage of the next step: */
+    if (predictive_time_step_ && first_stage)
+      predicted_tau_ = predictive_time_step_safety_ * tau_max.load();
+
     if (restart_needed) {
       switch (id_violation_strategy_) {
       case IDViolationStrategy::warn:
@@ -1202,6 +3141,9 @@ namespace ryujin
         break;
       case IDViolationStrategy::raise_exception:
         n_restarts_++;
+        /* Recompute all wave speeds and tau_max in the repeated step: */
+        frozen_valid_ = false;
+        predicted_tau_ = Number(0.);
         throw Restart();
       }
     }
@@ -1210,4 +3152,67 @@ namespace ryujin
     return tau;
   }
 
+
+  template <typename Description, int dim, typename Number>
+  void HyperbolicModule<Description, dim, Number>::apply_split_source_terms(
+      StateVector &state_vector, Number tau) const
+  {
+    using View =
+        typename Description::template HyperbolicSystemView<dim, Number>;
+    using VA = VectorizedArray<Number>;
+
+    if constexpr (View::have_split_source_terms) {
+      if (!hyperbolic_system_->template view<dim, Number>()
+               .split_source_terms())
+        return;
+
+#ifdef DEBUG_OUTPUT
+      std::cout << "HyperbolicModule<Description, dim, "
+                   "Number>::apply_split_source_terms()"
+                << std::endl;
+#endif
+
+      auto &U = std::get<0>(state_vector);
+
+      const unsigned int n_internal = offline_data_->n_locally_internal();
+      const unsigned int n_owned = offline_data_->n_locally_owned();
+      const unsigned int n_active = offline_data_->n_locally_active();
+      const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
+
+      Scope scope(computing_timer_, "time step [H] 8 - split source terms");
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
+        using T = decltype(sentinel);
+        unsigned int stride_size = get_stride_size<T>;
+
+        const auto view = hyperbolic_system_->template view<dim, T>();
+
+        RYUJIN_OMP_FOR
+        for (unsigned int i = left; i < right; i += stride_size) {
+
+          /* Skip constrained degrees of freedom: */
+          const unsigned int row_length = sparsity_simd.row_length(i);
+          if (row_length == 1)
+            continue;
+
+          const auto U_i = U.template get_tensor<T>(i);
+          const auto U_i_new = view.split_source_update(U_i, tau);
+          U.template write_tensor<T>(U_i_new, i);
+        }
+      };
+
+      /* Parallel non-vectorized loop and vectorized SIMD loop: */
+      loop(Number(), n_internal, n_active);
+      loop(VA(), 0, n_internal);
+
+      RYUJIN_PARALLEL_REGION_END
+
+    } else {
+      (void)state_vector;
+      (void)tau;
+    }
+  }
+
 } /* namespace ryujin */
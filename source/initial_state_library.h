@@ -9,11 +9,14 @@
 
 #include "convenience_macros.h"
 
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/tensor.h>
 
 #include <set>
 #include <string>
+#include <vector>
 
 namespace ryujin
 {
@@ -60,6 +63,44 @@ namespace ryujin
      */
     virtual state_type compute(const dealii::Point<dim> &point, Number t) = 0;
 
+    /**
+     * Batched variant of compute(): Evaluate the initial state at all
+     * points @p points for time @p t and store the results in @p states
+     * (which has the same size as @p points). The default implementation
+     * simply calls compute() for every point. Derived classes can
+     * override this function to vectorize the evaluation.
+     */
+    virtual void compute_batch(const std::vector<dealii::Point<dim>> &points,
+                               Number t,
+                               std::vector<state_type> &states)
+    {
+      for (std::size_t k = 0; k < points.size(); ++k)
+        states[k] = compute(points[k], t);
+    }
+
+    /**
+     * Return true if compute(), compute_batch() and
+     * initial_precomputations() can be called concurrently from multiple
+     * threads. In this case InitialValues interpolates initial values
+     * thread parallel. The default implementation conservatively returns
+     * false.
+     */
+    virtual bool is_thread_safe() const
+    {
+      return false;
+    }
+
+    /**
+     * Return true if the state returned by compute() does not depend on
+     * the time @p t. In this case Dirichlet and inflow boundary values
+     * can be precomputed once and cached by the HyperbolicModule. The
+     * default implementation conservatively returns false.
+     */
+    virtual bool is_time_independent() const
+    {
+      return false;
+    }
+
     /**
      * Given a position @p point returns a precomputed value used for the
      * flux computation via HyperbolicSystem::flux_contribution().
@@ -75,6 +116,22 @@ namespace ryujin
       return initial_precomputed_type{};
     }
 
+    /**
+     * Announce the region of interest @p box (in the coordinate system of
+     * compute()) of the current MPI rank. The function is called
+     * collectively on @p mpi_communicator by InitialValues prior to every
+     * interpolation with a bounding box of all locally relevant cells.
+     * Initial states that are backed by large data sets can use this
+     * information to only load the data needed on the current rank.
+     *
+     * The default implementation does nothing.
+     */
+    virtual void
+    set_region_of_interest(const dealii::BoundingBox<dim> & /*box*/,
+                           const MPI_Comm & /*mpi_communicator*/)
+    {
+    }
+
     /**
      * Return the name of the initial state as (const reference) std::string
      */
@@ -13,4 +13,10 @@ namespace ryujin
   template class InitialValues<Description, 2, NUMBER>;
   template class InitialValues<Description, 3, NUMBER>;
 
+#ifdef RUNTIME_PRECISION
+  template class InitialValues<Description, 1, ALTERNATIVE_NUMBER>;
+  template class InitialValues<Description, 2, ALTERNATIVE_NUMBER>;
+  template class InitialValues<Description, 3, ALTERNATIVE_NUMBER>;
+#endif
+
 } /* namespace ryujin */
@@ -7,6 +7,7 @@
 
 #include <compile_time_options.h>
 
+#include "convenience_macros.h"
 #include "initial_state_library.h"
 #include "offline_data.h"
 
@@ -111,6 +112,23 @@ namespace ryujin
     }
 
 
+    /**
+     * Returns true if the selected initial state configuration is time
+     * independent, i.e., initial_state() returns the same value for all
+     * times @p t. This is the case if the InitialState object declares
+     * itself time independent and no random perturbation is applied.
+     */
+    ACCESSOR_READ_ONLY(time_independent)
+
+
+    /**
+     * Returns true if initial_state() can be called concurrently from
+     * several threads. This is the case if the InitialState object
+     * declares itself thread safe and no random perturbation is applied.
+     */
+    ACCESSOR_READ_ONLY(thread_safe)
+
+
     /**
      * This routine computes and returns a state vector populated with
      * initial values for a specified time @p t.
@@ -124,6 +142,13 @@ namespace ryujin
      */
     InitialPrecomputedVector interpolate_initial_precomputed_vector() const;
 
+
+    /**
+     * Return the support points of all locally owned degrees of freedom
+     * indexed by their local index.
+     */
+    std::vector<dealii::Point<dim>> locally_owned_support_points() const;
+
   private:
     //@}
     /**
@@ -154,9 +179,23 @@ namespace ryujin
     std::function<state_type(const dealii::Point<dim> &, Number)>
         initial_state_;
 
+    std::function<void(const std::vector<dealii::Point<dim>> &,
+                       Number,
+                       std::vector<state_type> &)>
+        initial_state_batch_;
+
+    bool time_independent_;
+
+    bool thread_safe_;
+
     std::function<initial_precomputed_type(const dealii::Point<dim> &)>
         initial_precomputed_;
 
+    std::function<void(const dealii::BoundingBox<dim> &, const MPI_Comm &)>
+        set_region_of_interest_;
+
+    void update_region_of_interest() const;
+
     //@}
   };
 
@@ -1,13 +1,16 @@
 //
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
-// Copyright (C) 2020 - 2023 by the ryujin authors
+// Copyright (C) 2020 - 2024 by the ryujin authors
 //
 
 #pragma once
 
 #include "initial_values.h"
+#include "openmp.h"
 #include "simd.h"
 
+#include <deal.II/base/quadrature.h>
+#include <deal.II/fe/fe_values.h>
 #include <deal.II/numerics/vector_tools.h>
 #include <deal.II/numerics/vector_tools.templates.h>
 
@@ -25,6 +28,8 @@ namespace ryujin
       : ParameterAcceptor(subsection)
       , hyperbolic_system_(&hyperbolic_system)
       , offline_data_(&offline_data)
+      , time_independent_(false)
+      , thread_safe_(false)
   {
     ParameterAcceptor::parse_parameters_call_back.connect(std::bind(
         &InitialValues<Description, dim, Number>::parse_parameters_callback,
@@ -178,12 +183,43 @@ namespace ryujin
             return state;
           };
 
+          initial_state_batch_ = [this, &it](const auto &points,
+                                             Number t,
+                                             auto &states) {
+            std::vector<dealii::Point<dim>> transformed_points(points.size());
+            for (std::size_t k = 0; k < points.size(); ++k)
+              transformed_points[k] = affine_transform(
+                  initial_direction_, initial_position_, points[k]);
+            it->compute_batch(transformed_points, t, states);
+            const auto view = hyperbolic_system_->template view<dim, Number>();
+            for (auto &state : states)
+              state = view.apply_galilei_transform(
+                  state, [&](const auto &momentum) {
+                    return affine_transform_vector(initial_direction_,
+                                                   momentum);
+                  });
+          };
+
           initial_precomputed_ = [this, &it](const dealii::Point<dim> &point) {
             const auto transformed_point =
                 affine_transform(initial_direction_, initial_position_, point);
             return it->initial_precomputations(transformed_point);
           };
 
+          set_region_of_interest_ = [this, &it](const auto &box,
+                                                const auto &mpi_communicator) {
+            /* Transform all corners of the bounding box: */
+            std::vector<dealii::Point<dim>> corners;
+            for (unsigned int v = 0; v < (1u << dim); ++v)
+              corners.push_back(affine_transform(
+                  initial_direction_, initial_position_, box.vertex(v)));
+            it->set_region_of_interest(dealii::BoundingBox<dim>(corners),
+                                       mpi_communicator);
+          };
+
+          time_independent_ = it->is_time_independent();
+          thread_safe_ = it->is_thread_safe();
+
           initialized = true;
           break;
         }
@@ -198,6 +234,8 @@ namespace ryujin
     /* Add a random perturbation to the original function object: */
 
     if (perturbation_ != 0.) {
+      time_independent_ = false;
+
       initial_state_ = [old_state = this->initial_state_,
                         perturbation = this->perturbation_](
                            const dealii::Point<dim> &point, Number t) {
@@ -215,10 +253,84 @@ namespace ryujin
 
         return state;
       };
+
+      /* The random number generator is not thread safe: */
+      thread_safe_ = false;
+
+      initial_state_batch_ = [this](const auto &points,
+                                    Number t,
+                                    auto &states) {
+        for (std::size_t k = 0; k < points.size(); ++k)
+          states[k] = initial_state_(points[k], t);
+      };
     }
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void
+  InitialValues<Description, dim, Number>::update_region_of_interest() const
+  {
+    const auto &dof_handler = offline_data_->dof_handler();
+
+    std::vector<dealii::Point<dim>> vertices;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (!cell->is_artificial())
+        for (const auto v : cell->vertex_indices())
+          vertices.push_back(cell->vertex(v));
+
+    /* Ranks without cells announce a degenerate bounding box: */
+    if (vertices.empty())
+      vertices.push_back(dealii::Point<dim>());
+
+    set_region_of_interest_(dealii::BoundingBox<dim>(vertices),
+                            dof_handler.get_communicator());
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  std::vector<dealii::Point<dim>>
+  InitialValues<Description, dim, Number>::locally_owned_support_points() const
+  {
+    const auto &discretization = offline_data_->discretization();
+    const auto &dof_handler = offline_data_->dof_handler();
+    const auto &scalar_partitioner = offline_data_->scalar_partitioner();
+    const unsigned int n_owned = offline_data_->n_locally_owned();
+
+    const auto &fe = dof_handler.get_fe();
+    const dealii::Quadrature<dim> quadrature(fe.get_unit_support_points());
+    dealii::FEValues<dim> fe_values(discretization.mapping(),
+                                    fe,
+                                    quadrature,
+                                    dealii::update_quadrature_points);
+
+    std::vector<dealii::Point<dim>> points(n_owned);
+    std::vector<dealii::types::global_dof_index> local_dof_indices(
+        fe.dofs_per_cell);
+
+    /*
+     * Every locally owned degree of freedom is located on at least one
+     * locally owned cell:
+     */
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+      if (!cell->is_locally_owned())
+        continue;
+
+      fe_values.reinit(cell);
+      cell->get_dof_indices(local_dof_indices);
+
+      for (unsigned int j = 0; j < fe.dofs_per_cell; ++j) {
+        const auto index =
+            scalar_partitioner->global_to_local(local_dof_indices[j]);
+        if (index < n_owned)
+          points[index] = fe_values.quadrature_point(j);
+      }
+    }
+
+    return points;
+  }
+
+
   template <typename Description, int dim, typename Number>
   auto InitialValues<Description, dim, Number>::interpolate_hyperbolic_vector(
       Number t) const -> HyperbolicVector
@@ -228,22 +340,54 @@ namespace ryujin
               << "interpolate_hyperbolic_vector(t = " << t << ")" << std::endl;
 #endif
 
+    update_region_of_interest();
+
     HyperbolicVector U;
     U.reinit(offline_data_->hyperbolic_vector_partitioner());
 
-    using ScalarVector = typename OfflineData<dim, Number>::ScalarVector;
+    const auto points = locally_owned_support_points();
+    const unsigned int n_owned = points.size();
+
+    /*
+     * We evaluate the initial state in batches of batch_size points. If
+     * the initial state is thread safe the batches are distributed over
+     * all threads.
+     */
 
-    const auto callable = [&](const auto &p) { return initial_state(p, t); };
+    constexpr unsigned int batch_size = 64;
+    const unsigned int n_batches = (n_owned + batch_size - 1) / batch_size;
 
-    ScalarVector temp;
-    const auto scalar_partitioner = offline_data_->scalar_partitioner();
-    temp.reinit(scalar_partitioner);
+    const auto evaluate_batch = [&](const unsigned int batch,
+                                    auto &batch_points,
+                                    auto &states) {
+      const unsigned int first = batch * batch_size;
+      const unsigned int last = std::min(first + batch_size, n_owned);
+
+      batch_points.assign(points.begin() + first, points.begin() + last);
+      states.resize(last - first);
+      initial_state_batch_(batch_points, t, states);
+
+      for (unsigned int i = first; i < last; ++i)
+        U.write_tensor(states[i - first], i);
+    };
 
-    for (unsigned int d = 0; d < problem_dimension; ++d) {
-      VectorTools::interpolate(offline_data_->dof_handler(),
-                               to_function<dim, Number>(callable, d),
-                               temp);
-      U.insert_component(temp, d);
+    if (thread_safe_) {
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      std::vector<dealii::Point<dim>> batch_points;
+      std::vector<state_type> states;
+
+      RYUJIN_OMP_FOR
+      for (unsigned int batch = 0; batch < n_batches; ++batch)
+        evaluate_batch(batch, batch_points, states);
+
+      RYUJIN_PARALLEL_REGION_END
+    } else {
+      std::vector<dealii::Point<dim>> batch_points;
+      std::vector<state_type> states;
+
+      for (unsigned int batch = 0; batch < n_batches; ++batch)
+        evaluate_batch(batch, batch_points, states);
     }
 
     U.update_ghost_values();
@@ -251,7 +395,6 @@ namespace ryujin
 #ifdef DEBUG
     /* Poison constrained degrees of freedom: */
     {
-      const unsigned int n_owned = offline_data_->n_locally_owned();
       const auto &partitioner = offline_data_->scalar_partitioner();
       for (unsigned int i = 0; i < n_owned; ++i) {
         if (offline_data_->affine_constraints().is_constrained(
@@ -284,18 +427,22 @@ namespace ryujin
     if constexpr (n_initial_precomputed_values == 0)
       return precomputed;
 
-    using ScalarVector = typename OfflineData<dim, Number>::ScalarVector;
+    update_region_of_interest();
+
+    const auto points = locally_owned_support_points();
+    const unsigned int n_owned = points.size();
 
-    const auto callable = [&](const auto &p) { return initial_precomputed(p); };
+    if (thread_safe_) {
+      RYUJIN_PARALLEL_REGION_BEGIN
 
-    ScalarVector temp;
-    temp.reinit(scalar_partitioner);
+      RYUJIN_OMP_FOR
+      for (unsigned int i = 0; i < n_owned; ++i)
+        precomputed.write_tensor(initial_precomputed(points[i]), i);
 
-    for (unsigned int d = 0; d < n_initial_precomputed_values; ++d) {
-      VectorTools::interpolate(offline_data_->dof_handler(),
-                               to_function<dim, Number>(callable, d),
-                               temp);
-      precomputed.insert_component(temp, d);
+      RYUJIN_PARALLEL_REGION_END
+    } else {
+      for (unsigned int i = 0; i < n_owned; ++i)
+        precomputed.write_tensor(initial_precomputed(points[i]), i);
     }
 
     precomputed.update_ghost_values();
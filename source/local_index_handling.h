@@ -13,6 +13,11 @@
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/sparsity_tools.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
 namespace ryujin
 {
   /**
@@ -88,6 +93,112 @@ namespace ryujin
      */
     using dealii::DoFRenumbering::Cuthill_McKee;
 
+    /**
+     * Import the hierarchical (Z-order cell traversal) reordering from
+     * deal.II into the current namespace.
+     */
+    using dealii::DoFRenumbering::hierarchical;
+
+    /**
+     * Reorder all locally owned degrees of freedom along a Morton
+     * (Z-order) space filling curve.
+     *
+     * Every degree of freedom is assigned the barycenter of the first
+     * locally owned cell it is encountered on. These positions are
+     * quantized on the bounding box of the local subdomain, and indices
+     * are sorted by the interleaved bits of the quantized coordinates.
+     * Degrees of freedom with identical keys keep their relative order.
+     * This creates a numbering where consecutive index ranges correspond
+     * to compact, cache-sized spatial blocks.
+     *
+     * @ingroup FiniteElement
+     */
+    template <int dim>
+    void morton(dealii::DoFHandler<dim> &dof_handler)
+    {
+      using namespace dealii;
+
+      const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+      const auto n_locally_owned = locally_owned.n_elements();
+
+      /* The locally owned index range has to be contiguous */
+      Assert(locally_owned.is_contiguous() == true,
+             dealii::ExcMessage(
+                 "Need a contiguous set of locally owned indices."));
+
+      /* Offset to translate from global to local index range */
+      const auto offset = n_locally_owned != 0 ? *locally_owned.begin() : 0;
+
+      /* Assign a position to every locally owned degree of freedom: */
+
+      std::vector<Point<dim>> positions(n_locally_owned);
+      std::vector<bool> visited(n_locally_owned, false);
+
+      Point<dim> lower, upper;
+      for (unsigned int d = 0; d < dim; ++d) {
+        lower[d] = std::numeric_limits<double>::max();
+        upper[d] = std::numeric_limits<double>::lowest();
+      }
+
+      std::vector<types::global_dof_index> dof_indices;
+      for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned())
+          continue;
+
+        const auto center = cell->center();
+        for (unsigned int d = 0; d < dim; ++d) {
+          lower[d] = std::min(lower[d], center[d]);
+          upper[d] = std::max(upper[d], center[d]);
+        }
+
+        dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dof_indices);
+        for (const auto index : dof_indices) {
+          if (!locally_owned.is_element(index))
+            continue;
+          const auto i = index - offset;
+          if (visited[i])
+            continue;
+          visited[i] = true;
+          positions[i] = center;
+        }
+      }
+
+      /* Compute Morton keys: */
+
+      constexpr unsigned int n_bits = (dim == 1 ? 32 : (dim == 2 ? 31 : 21));
+      constexpr double n_cells = double((std::uint64_t(1) << n_bits) - 1);
+
+      std::vector<std::uint64_t> keys(n_locally_owned);
+      for (unsigned int i = 0; i < n_locally_owned; ++i) {
+        std::uint64_t key = 0;
+        for (unsigned int d = 0; d < dim; ++d) {
+          const double extent = upper[d] - lower[d];
+          const double relative =
+              extent > 0. ? (positions[i][d] - lower[d]) / extent : 0.;
+          const auto q = std::uint64_t(
+              std::min(std::max(relative, 0.), 1.) * n_cells);
+          for (unsigned int b = 0; b < n_bits; ++b)
+            key |= ((q >> b) & std::uint64_t(1)) << (b * dim + d);
+        }
+        keys[i] = key;
+      }
+
+      std::vector<unsigned int> permutation(n_locally_owned);
+      std::iota(permutation.begin(), permutation.end(), 0);
+      std::stable_sort(permutation.begin(),
+                       permutation.end(),
+                       [&](const auto left, const auto right) {
+                         return keys[left] < keys[right];
+                       });
+
+      std::vector<dealii::types::global_dof_index> new_order(n_locally_owned);
+      for (unsigned int k = 0; k < n_locally_owned; ++k)
+        new_order[permutation[k]] = offset + k;
+
+      dof_handler.renumber_dofs(new_order);
+    }
+
     /**
      * Reorder all (strides of) locally internal indices that contain
      * export indices to the start of the index range.
@@ -306,6 +417,17 @@ namespace ryujin
      * \text{n_locally_owned})\f$ is available that groups dofs with same
      * stencil size in groups of multiples of @p group_size
      *
+     * If @p n_first is nonzero the (already grouped) index range [0,
+     * n_first) is left untouched and only the remaining locally owned
+     * indices are regrouped and appended. This is used to recover full
+     * strides from the scalar tail after constraint elimination changed
+     * the stencil sizes.
+     *
+     * Constrained degrees of freedom (with a stencil consisting of the
+     * diagonal only) are not grouped but moved to the very end of the
+     * locally owned index range. This way they occupy neither SIMD strides
+     * nor lanes of the (masked) loops over the remaining rows.
+     *
      * Returns the right boundary n_internal of the internal index range.
      *
      * @ingroup FiniteElement
@@ -313,7 +435,8 @@ namespace ryujin
     template <int dim>
     unsigned int internal_range(dealii::DoFHandler<dim> &dof_handler,
                                 const dealii::DynamicSparsityPattern &sparsity,
-                                const std::size_t group_size)
+                                const std::size_t group_size,
+                                const unsigned int n_first = 0)
     {
       using namespace dealii;
 
@@ -329,10 +452,16 @@ namespace ryujin
       /* Offset to translate from global to local index range */
       const auto offset = n_locally_owned != 0 ? *locally_owned.begin() : 0;
 
+      Assert(n_first <= n_locally_owned, dealii::ExcInternalError());
+      Assert(n_first % group_size == 0, dealii::ExcInternalError());
+
       using dof_type = dealii::types::global_dof_index;
       std::vector<dof_type> new_order(n_locally_owned);
       dof_type current_index = offset;
 
+      for (unsigned int i = 0; i < n_first; ++i)
+        new_order[i] = current_index++;
+
       /*
        * Sort degrees of freedom into a map grouped by stencil size. Write
        * out dof indices into the new_order vector in groups of group_size
@@ -340,10 +469,16 @@ namespace ryujin
        */
 
       std::map<unsigned int, std::set<dof_type>> bins;
+      std::vector<dof_type> constrained;
 
-      for (unsigned int i = 0; i < n_locally_owned; ++i) {
+      for (unsigned int i = n_first; i < n_locally_owned; ++i) {
         const dof_type index = i;
         const unsigned int row_length = sparsity.row_length(offset + index);
+        if (row_length == 1) {
+          constrained.push_back(index);
+          continue;
+        }
+
         bins[row_length].insert(index);
 
         if (bins[row_length].size() == group_size) {
@@ -362,6 +497,8 @@ namespace ryujin
         for (const auto &index : entries.second)
           new_order[index] = current_index++;
       }
+      for (const auto &index : constrained)
+        new_order[index] = current_index++;
       Assert(current_index == offset + n_locally_owned, ExcInternalError());
 
       dof_handler.renumber_dofs(new_order);
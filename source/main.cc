@@ -1,6 +1,6 @@
 //
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
-// Copyright (C) 2020 - 2023 by the ryujin authors
+// Copyright (C) 2020 - 2024 by the ryujin authors
 //
 
 #include <compile_time_options.h>
@@ -16,7 +16,10 @@
 #include <omp.h>
 #endif
 
+#include <algorithm>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 /**
  * Change rounding mode on X86-64 architecture: Denormals are flushed to
@@ -53,8 +56,70 @@ void set_thread_limit(const MPI_Comm &mpi_communicator [[maybe_unused]])
 }
 
 
+/**
+ * Batch mode: Run a (possibly large) number of independent small
+ * computations in a single process. The parameter files are distributed
+ * round-robin over all MPI ranks and every rank runs its share one after
+ * another on MPI_COMM_SELF. This removes the process startup cost of MPI
+ * and deal.II for every single computation.
+ */
+int run_batch(const std::vector<std::string> &parameter_files,
+              const MPI_Comm &mpi_communicator,
+              const bool dry_run)
+{
+  const auto mpi_rank =
+      dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+  const auto n_mpi_processes =
+      dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+  if (mpi_rank == 0) {
+    std::cout << "[INFO] batch mode: running " << parameter_files.size()
+              << " computations on " << n_mpi_processes << " ranks"
+              << std::endl;
+  }
+
+  int n_failed = 0;
+
+  for (std::size_t i = mpi_rank; i < parameter_files.size();
+       i += n_mpi_processes) {
+    const auto &parameter_file = parameter_files[i];
+
+    /*
+     * Start from a clean slate: Remove all entries (and their values)
+     * of the previous computation from the global parameter handler.
+     */
+    dealii::ParameterAcceptor::prm.clear();
+
+    try {
+      ryujin::EquationDispatch equation_dispatch;
+      equation_dispatch.dispatch(parameter_file, MPI_COMM_SELF, dry_run);
+    } catch (std::exception &exc) {
+      std::cerr << "[ERROR] batch mode: computation »" << parameter_file
+                << "« failed:\n"
+                << exc.what() << std::endl;
+      ++n_failed;
+    }
+  }
+
+  n_failed = dealii::Utilities::MPI::sum(n_failed, mpi_communicator);
+
+  if (mpi_rank == 0 && n_failed > 0) {
+    std::cout << "[ERROR] batch mode: " << n_failed << " of "
+              << parameter_files.size() << " computations failed."
+              << std::endl;
+  }
+
+  return n_failed == 0 ? 0 : 1;
+}
+
+
 /**
  * The main function
+ *
+ * If the command line contains the option "--dry-run" no computation is
+ * performed. Instead, the discretization is set up on a coarse proxy of
+ * the requested mesh refinement and memory consumption and time to
+ * solution are extrapolated, see TimeLoop::dry_run().
  */
 int main(int argc, char *argv[])
 {
@@ -72,22 +137,40 @@ int main(int argc, char *argv[])
     std::cout << "[INFO] initiating flux capacitor" << std::endl;
   }
 
-  if (argc > 2) {
-    if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
-      std::cout << "[ERROR] Invalid number of parameters. At most one argument "
-                << "supported which has to be a parameter file." << std::endl;
+  std::vector<std::string> arguments(argv + 1, argv + argc);
+  const auto dry_run_option =
+      std::remove(arguments.begin(), arguments.end(), "--dry-run");
+  const bool dry_run = dry_run_option != arguments.end();
+  arguments.erase(dry_run_option, arguments.end());
+
+  if (arguments.size() > 1) {
+    const auto &parameter_files = arguments;
+
+    for (const auto &parameter_file : parameter_files) {
+      if (!std::filesystem::exists(parameter_file)) {
+        if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
+          std::cout << "[ERROR] The specified parameter file »"
+                    << parameter_file << "« does not exist." << std::endl;
+        }
+
+        LIKWID_CLOSE;
+        LSAN_DISABLE;
+        return 1;
+      }
     }
 
+    const int status = run_batch(parameter_files, mpi_communicator, dry_run);
+
     LIKWID_CLOSE;
     LSAN_DISABLE;
-    return 1;
+    return status;
   }
 
   const auto executable_name = std::filesystem::path(argv[0]).filename();
   std::string parameter_file = executable_name.string() + ".prm";
 
-  if (argc == 2) {
-    parameter_file = argv[1];
+  if (arguments.size() == 1) {
+    parameter_file = arguments.front();
 
     if (!std::filesystem::exists(parameter_file)) {
       if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
@@ -119,7 +202,7 @@ int main(int argc, char *argv[])
 
   {
     ryujin::EquationDispatch equation_dispatch;
-    equation_dispatch.dispatch(parameter_file, mpi_communicator);
+    equation_dispatch.dispatch(parameter_file, mpi_communicator, dry_run);
   }
 
   LIKWID_CLOSE;
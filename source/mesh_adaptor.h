@@ -9,6 +9,10 @@
 
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/smartpointer.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/vector.h>
+
+#include <boost/signals2/connection.hpp>
 
 #include <random>
 
@@ -31,6 +35,19 @@ namespace ryujin
      * useful for debugging and testing.
      */
     random_adaptation,
+
+    /**
+     * Refine and coarsen based on a feature indicator that is computed
+     * from the gradient of a selected component q of the state vector:
+     * For every cell K we set
+     * \f[
+     *   \eta_K = h_K \max_{i\in K} \frac{1}{m_i}
+     *   \Big|\sum_{j\in\mathcal{I}(i)} \boldsymbol c_{ij} q_j\Big|,
+     * \f]
+     * i.e., the local variation of q over the cell. The indicator is of
+     * order one at discontinuities and decays with h in smooth regions.
+     */
+    feature_based,
   };
 
   /**
@@ -45,6 +62,13 @@ namespace ryujin
      * Refine and coarsen a configurable selected percentage of cells.
      */
     fixed_number,
+
+    /**
+     * Refine (and coarsen) the cells with the largest (smallest) indicator
+     * values that together make up a configurable fraction of the sum
+     * over all indicator values.
+     */
+    fixed_fraction,
   };
 
   /**
@@ -57,6 +81,41 @@ namespace ryujin
      * Perform a mesh adaptation cycle at preselected fixed time points.
      */
     fixed_adaptation_time_points,
+
+    /**
+     * Perform a mesh adaptation cycle whenever the features of the
+     * solution have drifted out of the refined regions of the mesh. Every
+     * "check interval" cycles the feature indicator (see
+     * AdaptationStrategy::feature_based) is evaluated and all cells with
+     * an indicator larger than a given fraction of the global maximum are
+     * classified as feature cells. The drift is the fraction of feature
+     * cells that are not on the finest level of the mesh. A mesh
+     * adaptation cycle is performed once the drift exceeds a threshold.
+     * In addition, mesh adaptation cycles are performed at the
+     * preselected fixed time points, which is used to schedule the
+     * initial adaptation of a uniform mesh (where the drift is zero).
+     *
+     * This strategy requires the feature based adaptation strategy.
+     */
+    indicator_drift,
+
+    /**
+     * Grid sequencing for steady state problems: Start on a coarse mesh
+     * and perform a mesh adaptation cycle whenever the solution has
+     * reached a steady state on the current mesh. Every "check interval"
+     * cycles the relative steady state residual
+     * \f[
+     *   r = \frac{1}{t - t_p}\frac{\sum_i m_i |\boldsymbol U_i(t) -
+     *   \boldsymbol U_i(t_p)|_{\ell^1}}{\sum_i m_i |\boldsymbol
+     *   U_i(t)|_{\ell^1}}
+     * \f]
+     * is computed with respect to the state at the previous check t_p. A
+     * mesh adaptation cycle is performed once r drops below a tolerance,
+     * until a given number of refinement steps has been performed.
+     *
+     * This strategy requires the global refinement adaptation strategy.
+     */
+    steady_state,
   };
 } // namespace ryujin
 
@@ -65,15 +124,23 @@ DECLARE_ENUM(ryujin::AdaptationStrategy,
              LIST({ryujin::AdaptationStrategy::global_refinement,
                    "global refinement"},
                   {ryujin::AdaptationStrategy::random_adaptation,
-                   "random adaptation"}, ));
+                   "random adaptation"},
+                  {ryujin::AdaptationStrategy::feature_based,
+                   "feature based"}, ));
 
 DECLARE_ENUM(ryujin::MarkingStrategy,
-             LIST({ryujin::MarkingStrategy::fixed_number, "fixed number"}, ));
+             LIST({ryujin::MarkingStrategy::fixed_number, "fixed number"},
+                  {ryujin::MarkingStrategy::fixed_fraction,
+                   "fixed fraction"}, ));
 
 DECLARE_ENUM(
     ryujin::TimePointSelectionStrategy,
     LIST({ryujin::TimePointSelectionStrategy::fixed_adaptation_time_points,
-          "fixed adaptation time points"}, ));
+          "fixed adaptation time points"},
+         {ryujin::TimePointSelectionStrategy::indicator_drift,
+          "indicator drift"},
+         {ryujin::TimePointSelectionStrategy::steady_state,
+          "steady state"}, ));
 #endif
 
 namespace ryujin
@@ -103,6 +170,8 @@ namespace ryujin
 
     using StateVector = typename View::StateVector;
 
+    using HyperbolicVector = typename View::HyperbolicVector;
+
     using ScalarVector = Vectors::ScalarVector<Number>;
 
     //@}
@@ -129,10 +198,12 @@ namespace ryujin
     /**
      * Analyze the given StateVector with the configured adaptation strategy
      * and decide whether a mesh adaptation cycle should be performed.
+     *
+     * For the indicator drift time point selection strategy the ghost
+     * values of the hyperbolic state are updated prior to evaluating the
+     * feature indicator.
      */
-    void analyze(const StateVector &state_vector,
-                 const Number t,
-                 unsigned int cycle);
+    void analyze(StateVector &state_vector, const Number t, unsigned int cycle);
 
     /**
      * A boolean indicating whether we should perform a mesh adapation step
@@ -142,14 +213,96 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(need_mesh_adaptation)
 
+    /**
+     * The indicator drift computed in the last evaluation of the
+     * indicator drift time point selection strategy. The value is
+     * negative if the drift has not been evaluated yet.
+     */
+    ACCESSOR_READ_ONLY(indicator_drift)
+
+    /**
+     * The relative residual computed in the last evaluation of the
+     * steady state time point selection strategy. The value is negative
+     * if the residual has not been evaluated on the current mesh yet.
+     */
+    ACCESSOR_READ_ONLY(steady_state_residual)
+
     /**
      * Mark cells for coarsening and refinement with the configured marking
-     * strategy.
+     * strategy. The feature based adaptation strategy computes its
+     * indicator from the given @p state_vector, whose ghost values have
+     * to be up to date.
      */
     void mark_cells_for_coarsening_and_refinement(
-        dealii::Triangulation<dim> &triangulation) const;
+        dealii::Triangulation<dim> &triangulation,
+        const StateVector &state_vector) const;
+
+    /**
+     * A boolean indicating whether we should repartition the mesh in the
+     * current cycle without refining or coarsening. The analyze() method
+     * sets this boolean to true every "rebalance interval" cycles.
+     */
+    ACCESSOR_READ_ONLY(need_mesh_rebalance)
+
+    /**
+     * Returns true if the mesh should be periodically rebalanced, i.e.,
+     * if the "rebalance interval" is nonzero.
+     */
+    bool periodic_rebalance() const
+    {
+      return rebalance_interval_ != 0;
+    }
+
+    /**
+     * Translate the recorded per-dof cost @p dof_cost (see
+     * HyperbolicModule::dof_cost()) into relative per-cell weights, and
+     * attach a weight callback to the signals of the @p triangulation
+     * that is used for the next repartitioning. The caller is
+     * responsible for disconnecting the returned connection after the
+     * repartitioning has been performed.
+     *
+     * An empty connection is returned if weighted repartitioning is
+     * disabled or if the triangulation is not a
+     * parallel::distributed::Triangulation.
+     */
+    boost::signals2::connection
+    connect_cell_weights(dealii::Triangulation<dim> &triangulation,
+                         const std::vector<float> &dof_cost) const;
 
   private:
+    /**
+     * Compute the feature indicator for all locally owned cells of the
+     * triangulation, see AdaptationStrategy::feature_based.
+     */
+    void compute_feature_indicator(dealii::Vector<float> &indicators,
+                                   const StateVector &state_vector) const;
+
+    /**
+     * Compute the fraction of feature cells that are not on the finest
+     * level of the mesh, see TimePointSelectionStrategy::indicator_drift.
+     */
+    double compute_indicator_drift(const StateVector &state_vector) const;
+
+    /**
+     * Compute the relative steady state residual with respect to the
+     * state stored at the last call and store the current state, see
+     * TimePointSelectionStrategy::steady_state. Returns a negative value
+     * if no state of the current mesh has been stored yet.
+     */
+    double compute_steady_state_residual(const StateVector &state_vector,
+                                         const Number t);
+
+    /**
+     * Return the weight of a given cell for the next repartitioning. For
+     * a cell that is going to be refined the weight is distributed evenly
+     * over all of its children. For a cell whose children are going to be
+     * coarsened the weights of the children are summed up.
+     */
+    unsigned int
+    cell_weight(const typename dealii::Triangulation<dim>::cell_iterator &cell,
+                const bool children_will_be_coarsened,
+                const bool cell_will_be_refined) const;
+
     /**
      * @name Run time options
      */
@@ -157,13 +310,26 @@ namespace ryujin
 
     AdaptationStrategy adaptation_strategy_;
     std::uint_fast64_t random_adaptation_mersenne_twister_seed_;
+    unsigned int feature_based_component_;
 
     MarkingStrategy marking_strategy_;
     double fixed_number_refinement_fraction_;
     double fixed_number_coarsening_fraction_;
+    double fixed_fraction_refinement_fraction_;
+    double fixed_fraction_coarsening_fraction_;
 
     TimePointSelectionStrategy time_point_selection_strategy_;
     std::vector<Number> adaptation_time_points_;
+    unsigned int indicator_drift_interval_;
+    double indicator_drift_feature_fraction_;
+    double indicator_drift_threshold_;
+    unsigned int steady_state_interval_;
+    double steady_state_tolerance_;
+    unsigned int steady_state_refinement_steps_;
+
+    bool weighted_repartitioning_;
+    unsigned int base_cell_weight_;
+    unsigned int rebalance_interval_;
 
     //@}
     /**
@@ -178,8 +344,19 @@ namespace ryujin
     dealii::SmartPointer<const ParabolicSystem> parabolic_system_;
 
     bool need_mesh_adaptation_;
+    bool need_mesh_rebalance_;
+
+    double indicator_drift_;
+
+    double steady_state_residual_;
+    unsigned int n_steady_state_refinements_;
+    HyperbolicVector steady_state_snapshot_;
+    Number steady_state_snapshot_t_;
 
     mutable std::mt19937_64 mersenne_twister_;
+
+    /* Relative cost of every active cell normalized to an average of 1: */
+    mutable dealii::Vector<float> cell_cost_;
     //@}
   };
 
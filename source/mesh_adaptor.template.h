@@ -6,9 +6,14 @@
 #pragma once
 
 #include "mesh_adaptor.h"
+#include "openmp.h"
 
+#include <deal.II/distributed/grid_refinement.h>
+#include <deal.II/distributed/tria.h>
 #include <deal.II/grid/grid_refinement.h>
 
+#include <cmath>
+
 namespace ryujin
 {
   template <typename Description, int dim, typename Number>
@@ -24,25 +29,51 @@ namespace ryujin
       , hyperbolic_system_(&hyperbolic_system)
       , parabolic_system_(&parabolic_system)
       , need_mesh_adaptation_(false)
+      , need_mesh_rebalance_(false)
+      , indicator_drift_(-1.)
+      , steady_state_residual_(-1.)
+      , n_steady_state_refinements_(0)
+      , steady_state_snapshot_t_(0.)
   {
     adaptation_strategy_ = AdaptationStrategy::global_refinement;
     add_parameter("adaptation strategy",
                   adaptation_strategy_,
                   "The chosen adaptation strategy. Possible values are: global "
-                  "refinement, random adaptation");
+                  "refinement, random adaptation, feature based");
 
     marking_strategy_ = MarkingStrategy::fixed_number;
     add_parameter(
         "marking strategy",
         marking_strategy_,
-        "The chosen marking strategy. Possible values are: fixed number");
+        "The chosen marking strategy. Possible values are: fixed number, "
+        "fixed fraction");
 
     time_point_selection_strategy_ =
         TimePointSelectionStrategy::fixed_adaptation_time_points;
     add_parameter("time point selection strategy",
                   time_point_selection_strategy_,
                   "The chosen time point selection strategy. Possible values "
-                  "are: fixed adaptation time points");
+                  "are: fixed adaptation time points, indicator drift, "
+                  "steady state");
+
+    weighted_repartitioning_ = false;
+    add_parameter("weighted repartitioning",
+                  weighted_repartitioning_,
+                  "Weight cells by their measured cost when repartitioning "
+                  "the mesh. This requires the \"record dof cost\" option "
+                  "of the HyperbolicModule to be enabled.");
+
+    base_cell_weight_ = 1000;
+    add_parameter("base cell weight",
+                  base_cell_weight_,
+                  "The weight assigned to a cell of average measured cost in "
+                  "weighted repartitioning");
+
+    rebalance_interval_ = 0;
+    add_parameter("rebalance interval",
+                  rebalance_interval_,
+                  "If set to a nonzero value, repartition the mesh every given "
+                  "number of cycles (without refinement or coarsening)");
 
     /* Options for various adaptation strategies: */
     enter_subsection("adaptation strategies");
@@ -50,6 +81,13 @@ namespace ryujin
     add_parameter("random adaptation: mersenne_twister_seed",
                   random_adaptation_mersenne_twister_seed_,
                   "Seed for 64bit Mersenne Twister used for random refinement");
+
+    feature_based_component_ = 0;
+    add_parameter("feature based: component",
+                  feature_based_component_,
+                  "Index of the (conserved) state component whose gradient is "
+                  "used for computing the feature indicator, for example 0 "
+                  "for the density");
     leave_subsection();
 
     /* Options for various marking strategies: */
@@ -66,6 +104,20 @@ namespace ryujin
         "fixed number: coarsening fraction",
         fixed_number_coarsening_fraction_,
         "Fixed number strategy: fraction of cells selected for coarsening.");
+
+    fixed_fraction_refinement_fraction_ = 0.3;
+    add_parameter("fixed fraction: refinement fraction",
+                  fixed_fraction_refinement_fraction_,
+                  "Fixed fraction strategy: cells with the largest indicator "
+                  "values making up this fraction of the total indicator are "
+                  "selected for refinement.");
+
+    fixed_fraction_coarsening_fraction_ = 0.05;
+    add_parameter("fixed fraction: coarsening fraction",
+                  fixed_fraction_coarsening_fraction_,
+                  "Fixed fraction strategy: cells with the smallest indicator "
+                  "values making up this fraction of the total indicator are "
+                  "selected for coarsening.");
     leave_subsection();
 
     /* Options for various time point selection strategies: */
@@ -76,6 +128,46 @@ namespace ryujin
                   adaptation_time_points_,
                   "List of time points in (simulation) time at which we will "
                   "perform a mesh adaptation cycle.");
+
+    indicator_drift_interval_ = 10;
+    add_parameter("indicator drift: check interval",
+                  indicator_drift_interval_,
+                  "Indicator drift strategy: number of cycles between two "
+                  "evaluations of the indicator drift");
+
+    indicator_drift_feature_fraction_ = 0.5;
+    add_parameter("indicator drift: feature fraction",
+                  indicator_drift_feature_fraction_,
+                  "Indicator drift strategy: cells with a feature indicator "
+                  "larger than this fraction of the global maximum are "
+                  "classified as feature cells");
+
+    indicator_drift_threshold_ = 0.1;
+    add_parameter("indicator drift: threshold",
+                  indicator_drift_threshold_,
+                  "Indicator drift strategy: perform a mesh adaptation cycle "
+                  "once the fraction of feature cells outside of the finest "
+                  "mesh level exceeds this threshold");
+
+    steady_state_interval_ = 10;
+    add_parameter("steady state: check interval",
+                  steady_state_interval_,
+                  "Steady state strategy: number of cycles between two "
+                  "evaluations of the steady state residual");
+
+    steady_state_tolerance_ = 1.e-4;
+    add_parameter("steady state: tolerance",
+                  steady_state_tolerance_,
+                  "Steady state strategy: perform a mesh adaptation cycle "
+                  "once the relative steady state residual drops below this "
+                  "tolerance");
+
+    steady_state_refinement_steps_ = 2;
+    add_parameter("steady state: refinement steps",
+                  steady_state_refinement_steps_,
+                  "Steady state strategy: maximal number of mesh adaptation "
+                  "cycles, i.e., the number of levels between the initial "
+                  "and the target mesh for a global refinement");
     leave_subsection();
 
     const auto call_back = [this] {
@@ -96,6 +188,16 @@ namespace ryujin
 #endif
 
     switch (time_point_selection_strategy_) {
+    case TimePointSelectionStrategy::indicator_drift:
+      AssertThrow(adaptation_strategy_ == AdaptationStrategy::feature_based,
+                  dealii::ExcMessage(
+                      "The indicator drift time point selection strategy "
+                      "requires the feature based adaptation strategy"));
+      AssertThrow(indicator_drift_interval_ != 0,
+                  dealii::ExcMessage("The indicator drift check interval "
+                                     "must be nonzero"));
+      [[fallthrough]];
+
     case TimePointSelectionStrategy::fixed_adaptation_time_points: {
       /* Remove outdated refinement timestamps: */
       const auto new_end = std::remove_if(
@@ -105,26 +207,46 @@ namespace ryujin
       adaptation_time_points_.erase(new_end, adaptation_time_points_.end());
     } break;
 
+    case TimePointSelectionStrategy::steady_state:
+      AssertThrow(
+          adaptation_strategy_ == AdaptationStrategy::global_refinement,
+          dealii::ExcMessage("The steady state time point selection "
+                             "strategy requires the global refinement "
+                             "adaptation strategy"));
+      AssertThrow(steady_state_interval_ != 0,
+                  dealii::ExcMessage("The steady state check interval "
+                                     "must be nonzero"));
+
+      /* The stored state belongs to the previous mesh: */
+      {
+        HyperbolicVector empty;
+        steady_state_snapshot_.swap(empty);
+      }
+      steady_state_residual_ = -1.;
+      break;
+
     default:
       // do nothing
       break;
     }
 
-    /* toggle mesh adaptation flag to off. */
+    /* toggle mesh adaptation and rebalance flags to off. */
     need_mesh_adaptation_ = false;
+    need_mesh_rebalance_ = false;
   }
 
 
   template <typename Description, int dim, typename Number>
   void MeshAdaptor<Description, dim, Number>::analyze(
-      const StateVector & /*state_vector*/,
-      const Number t,
-      unsigned int /*cycle*/)
+      StateVector &state_vector, const Number t, unsigned int cycle)
   {
 #ifdef DEBUG_OUTPUT
     std::cout << "MeshAdaptor<dim, Number>::analyze()" << std::endl;
 #endif
 
+    need_mesh_rebalance_ = rebalance_interval_ != 0 && cycle != 0 &&
+                           cycle % rebalance_interval_ == 0;
+
     switch (time_point_selection_strategy_) {
     case TimePointSelectionStrategy::fixed_adaptation_time_points: {
       /* Remove all refinement points from the vector that lie in the past: */
@@ -140,6 +262,42 @@ namespace ryujin
       adaptation_time_points_.erase(new_end, adaptation_time_points_.end());
     } break;
 
+    case TimePointSelectionStrategy::indicator_drift: {
+      const auto new_end = std::remove_if( //
+          adaptation_time_points_.begin(),
+          adaptation_time_points_.end(),
+          [&](const Number &t_refinement) {
+            if (t < t_refinement)
+              return false;
+            need_mesh_adaptation_ = true;
+            return true;
+          });
+      adaptation_time_points_.erase(new_end, adaptation_time_points_.end());
+
+      if (need_mesh_adaptation_ || cycle == 0 ||
+          cycle % indicator_drift_interval_ != 0)
+        break;
+
+      /* The feature indicator reads the states of the ghost range: */
+      std::get<0>(state_vector).update_ghost_values();
+
+      indicator_drift_ = compute_indicator_drift(state_vector);
+      need_mesh_adaptation_ = indicator_drift_ > indicator_drift_threshold_;
+    } break;
+
+    case TimePointSelectionStrategy::steady_state: {
+      if (n_steady_state_refinements_ >= steady_state_refinement_steps_ ||
+          cycle == 0 || cycle % steady_state_interval_ != 0)
+        break;
+
+      steady_state_residual_ = compute_steady_state_residual(state_vector, t);
+      if (steady_state_residual_ >= 0. &&
+          steady_state_residual_ < steady_state_tolerance_) {
+        need_mesh_adaptation_ = true;
+        ++n_steady_state_refinements_;
+      }
+    } break;
+
     default:
       AssertThrow(false, dealii::ExcInternalError());
       __builtin_trap();
@@ -147,10 +305,215 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void MeshAdaptor<Description, dim, Number>::compute_feature_indicator(
+      dealii::Vector<float> &indicators, const StateVector &state_vector) const
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "MeshAdaptor<dim, Number>::compute_feature_indicator()"
+              << std::endl;
+#endif
+
+    AssertThrow(feature_based_component_ < problem_dimension,
+                dealii::ExcMessage("The selected component for the feature "
+                                   "based adaptation strategy is out of "
+                                   "range"));
+
+    const auto &U = std::get<0>(state_vector);
+
+    const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
+    const auto &cij_matrix = offline_data_->cij_matrix();
+    const auto &lumped_mass_matrix = offline_data_->lumped_mass_matrix();
+    const unsigned int n_owned = offline_data_->n_locally_owned();
+    const unsigned int k = feature_based_component_;
+
+    /*
+     * Compute the nodal gradient norm |sum_j c_ij q_j| / m_i for all
+     * locally owned degrees of freedom and distribute it to the ghost
+     * range:
+     */
+
+    ScalarVector gradient(offline_data_->scalar_partitioner());
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+    RYUJIN_OMP_FOR
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      /* Skip constrained degrees of freedom: */
+      const unsigned int row_length = sparsity_simd.row_length(i);
+      if (row_length == 1)
+        continue;
+
+      const unsigned int stride = sparsity_simd.stride_of_row(i);
+      const unsigned int *js = sparsity_simd.columns(i);
+
+      dealii::Tensor<1, dim, Number> grad_i;
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        const auto q_j = U.get_tensor(js[col_idx * stride])[k];
+        grad_i += q_j * cij_matrix.template get_tensor<Number>(i, col_idx);
+      }
+
+      gradient.local_element(i) =
+          grad_i.norm() / lumped_mass_matrix.local_element(i);
+    }
+    RYUJIN_PARALLEL_REGION_END
+
+    gradient.update_ghost_values();
+
+    /*
+     * Scale the maximal gradient over each cell by the cell diameter:
+     */
+
+    const auto &dof_handler = offline_data_->dof_handler();
+    const unsigned int dofs_per_cell = dof_handler.get_fe().dofs_per_cell;
+    std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+      if (!cell->is_locally_owned())
+        continue;
+
+      cell->get_dof_indices(dof_indices);
+
+      Number eta = 0.;
+      for (const auto index : dof_indices)
+        eta = std::max(eta, gradient(index));
+
+      indicators[cell->active_cell_index()] = cell->diameter() * eta;
+    }
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  double MeshAdaptor<Description, dim, Number>::compute_indicator_drift(
+      const StateVector &state_vector) const
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "MeshAdaptor<dim, Number>::compute_indicator_drift()"
+              << std::endl;
+#endif
+
+    const auto &dof_handler = offline_data_->dof_handler();
+
+    dealii::Vector<float> indicators(
+        dof_handler.get_triangulation().n_active_cells());
+    compute_feature_indicator(indicators, state_vector);
+
+    float local_eta_max = 0.f;
+    unsigned int local_max_level = 0;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+      if (!cell->is_locally_owned())
+        continue;
+      local_eta_max =
+          std::max(local_eta_max, indicators[cell->active_cell_index()]);
+      local_max_level =
+          std::max(local_max_level, static_cast<unsigned int>(cell->level()));
+    }
+
+    const auto eta_max =
+        dealii::Utilities::MPI::max(local_eta_max, mpi_communicator_);
+    const auto max_level =
+        dealii::Utilities::MPI::max(local_max_level, mpi_communicator_);
+
+    /* A constant state has no features: */
+    if (eta_max == 0.f)
+      return 0.;
+
+    /*
+     * Count the feature cells and the feature cells that are not on the
+     * finest level of the mesh:
+     */
+
+    const float eta_threshold = indicator_drift_feature_fraction_ * eta_max;
+
+    double n_features = 0.;
+    double n_drifted = 0.;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+      if (!cell->is_locally_owned())
+        continue;
+      if (indicators[cell->active_cell_index()] < eta_threshold)
+        continue;
+      n_features += 1.;
+      if (static_cast<unsigned int>(cell->level()) < max_level)
+        n_drifted += 1.;
+    }
+
+    n_features = dealii::Utilities::MPI::sum(n_features, mpi_communicator_);
+    n_drifted = dealii::Utilities::MPI::sum(n_drifted, mpi_communicator_);
+
+    return n_features == 0. ? 0. : n_drifted / n_features;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  double MeshAdaptor<Description, dim, Number>::compute_steady_state_residual(
+      const StateVector &state_vector, const Number t)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "MeshAdaptor<dim, Number>::compute_steady_state_residual()"
+              << std::endl;
+#endif
+
+    const auto &U = std::get<0>(state_vector);
+    auto &snapshot = steady_state_snapshot_;
+
+    double residual = -1.;
+
+    if (snapshot.get_partitioner() == U.get_partitioner() &&
+        t > steady_state_snapshot_t_) {
+      const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
+      const auto &lumped_mass_matrix = offline_data_->lumped_mass_matrix();
+      const unsigned int n_owned = offline_data_->n_locally_owned();
+
+      double difference = 0.;
+      double norm = 0.;
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+      double thread_difference = 0.;
+      double thread_norm = 0.;
+
+      RYUJIN_OMP_FOR
+      for (unsigned int i = 0; i < n_owned; ++i) {
+        /* Skip constrained degrees of freedom: */
+        if (sparsity_simd.row_length(i) == 1)
+          continue;
+
+        const auto U_i = U.get_tensor(i);
+        const auto S_i = snapshot.get_tensor(i);
+        const Number m_i = lumped_mass_matrix.local_element(i);
+        for (unsigned int k = 0; k < problem_dimension; ++k) {
+          thread_difference += m_i * std::abs(U_i[k] - S_i[k]);
+          thread_norm += m_i * std::abs(U_i[k]);
+        }
+      }
+
+      RYUJIN_OMP_CRITICAL
+      {
+        difference += thread_difference;
+        norm += thread_norm;
+      }
+      RYUJIN_PARALLEL_REGION_END
+
+      difference = dealii::Utilities::MPI::sum(difference, mpi_communicator_);
+      norm = dealii::Utilities::MPI::sum(norm, mpi_communicator_);
+
+      residual = norm == 0. ? 0.
+                            : difference / norm /
+                                  double(t - steady_state_snapshot_t_);
+    }
+
+    if (snapshot.get_partitioner() != U.get_partitioner())
+      snapshot.reinit(U, /*omit_zeroing_entries*/ true);
+    snapshot = U;
+    steady_state_snapshot_t_ = t;
+
+    return residual;
+  }
+
+
   template <typename Description, int dim, typename Number>
   void MeshAdaptor<Description, dim, Number>::
       mark_cells_for_coarsening_and_refinement(
-          dealii::Triangulation<dim> &triangulation) const
+          dealii::Triangulation<dim> &triangulation,
+          const StateVector &state_vector) const
   {
     auto &discretization [[maybe_unused]] = offline_data_->discretization();
     Assert(&triangulation == &discretization.triangulation(),
@@ -178,17 +541,46 @@ namespace ryujin
       });
     } break;
 
+    case AdaptationStrategy::feature_based: {
+      indicators.reinit(triangulation.n_active_cells());
+      compute_feature_indicator(indicators, state_vector);
+    } break;
+
     default:
       AssertThrow(false, dealii::ExcInternalError());
       __builtin_trap();
     }
 
     /*
-     * Mark cells with chosen marking strategy:
+     * Mark cells with chosen marking strategy. For a distributed
+     * triangulation we select cells globally over all MPI ranks. The only
+     * exception is the random adaptation strategy that is meant for
+     * testing and marks cells rank-locally.
      */
 
+    using DistributedTriangulation =
+        dealii::parallel::distributed::Triangulation<dim>;
+    DistributedTriangulation *distributed_triangulation [[maybe_unused]] =
+        nullptr;
+    if constexpr (have_distributed_triangulation<dim>) {
+      if (adaptation_strategy_ != AdaptationStrategy::random_adaptation)
+        distributed_triangulation =
+            dynamic_cast<DistributedTriangulation *>(&triangulation);
+    }
+
     switch (marking_strategy_) {
     case MarkingStrategy::fixed_number: {
+      if constexpr (have_distributed_triangulation<dim>) {
+        if (distributed_triangulation != nullptr) {
+          dealii::parallel::distributed::GridRefinement::
+              refine_and_coarsen_fixed_number(
+                  *distributed_triangulation,
+                  indicators,
+                  fixed_number_refinement_fraction_,
+                  fixed_number_coarsening_fraction_);
+          break;
+        }
+      }
       dealii::GridRefinement::refine_and_coarsen_fixed_number(
           triangulation,
           indicators,
@@ -196,9 +588,148 @@ namespace ryujin
           fixed_number_coarsening_fraction_);
     } break;
 
+    case MarkingStrategy::fixed_fraction: {
+      if constexpr (have_distributed_triangulation<dim>) {
+        if (distributed_triangulation != nullptr) {
+          dealii::parallel::distributed::GridRefinement::
+              refine_and_coarsen_fixed_fraction(
+                  *distributed_triangulation,
+                  indicators,
+                  fixed_fraction_refinement_fraction_,
+                  fixed_fraction_coarsening_fraction_);
+          break;
+        }
+      }
+      dealii::GridRefinement::refine_and_coarsen_fixed_fraction(
+          triangulation,
+          indicators,
+          fixed_fraction_refinement_fraction_,
+          fixed_fraction_coarsening_fraction_);
+    } break;
+
     default:
       AssertThrow(false, dealii::ExcInternalError());
       __builtin_trap();
     }
   }
+
+
+  template <typename Description, int dim, typename Number>
+  boost::signals2::connection
+  MeshAdaptor<Description, dim, Number>::connect_cell_weights(
+      dealii::Triangulation<dim> &triangulation,
+      const std::vector<float> &dof_cost) const
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "MeshAdaptor<dim, Number>::connect_cell_weights()"
+              << std::endl;
+#endif
+
+    if (!weighted_repartitioning_ || !have_distributed_triangulation<dim>)
+      return boost::signals2::connection();
+
+    AssertThrow(dof_cost.size() == offline_data_->n_locally_owned(),
+                dealii::ExcMessage(
+                    "Weighted repartitioning requires the \"record dof "
+                    "cost\" option of the HyperbolicModule to be enabled"));
+
+    /*
+     * Compute the cost of every locally owned cell as the average cost
+     * of its locally owned degrees of freedom times the number of degrees
+     * of freedom per cell:
+     */
+
+    const auto &dof_handler = offline_data_->dof_handler();
+    const auto &scalar_partitioner = offline_data_->scalar_partitioner();
+    const unsigned int dofs_per_cell = dof_handler.get_fe().dofs_per_cell;
+
+    cell_cost_.reinit(triangulation.n_active_cells());
+
+    double local_cost = 0.;
+    double local_n_cells = 0.;
+
+    std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+      if (!cell->is_locally_owned())
+        continue;
+
+      cell->get_dof_indices(dof_indices);
+
+      float cost = 0.f;
+      unsigned int n = 0;
+      for (const auto index : dof_indices) {
+        if (!scalar_partitioner->in_local_range(index))
+          continue;
+        cost += dof_cost[scalar_partitioner->global_to_local(index)];
+        ++n;
+      }
+      if (n != 0)
+        cost *= float(dofs_per_cell) / n;
+
+      cell_cost_[cell->active_cell_index()] = cost;
+      local_cost += cost;
+      local_n_cells += 1.;
+    }
+
+    /* Normalize to an average cost of one over all MPI ranks: */
+
+    const double total_cost =
+        dealii::Utilities::MPI::sum(local_cost, mpi_communicator_);
+    const double n_cells =
+        dealii::Utilities::MPI::sum(local_n_cells, mpi_communicator_);
+
+    if (total_cost > 0.)
+      cell_cost_ *= float(n_cells / total_cost);
+    else
+      cell_cost_ = 1.f;
+
+#if DEAL_II_VERSION_GTE(9, 6, 0)
+    return triangulation.signals.weight.connect(
+        [this](const typename dealii::Triangulation<dim>::cell_iterator &cell,
+               const dealii::CellStatus status) -> unsigned int {
+          return cell_weight(
+              cell,
+              status == dealii::CellStatus::children_will_be_coarsened,
+              status == dealii::CellStatus::cell_will_be_refined);
+        });
+#else
+    /*
+     * Note that deal.II prior to version 9.6 adds an implicit weight of
+     * 1000 to every cell.
+     */
+    using Triangulation = dealii::Triangulation<dim>;
+    return triangulation.signals.cell_weight.connect(
+        [this](const typename Triangulation::cell_iterator &cell,
+               const typename Triangulation::CellStatus status)
+            -> unsigned int {
+          return cell_weight(cell,
+                             status == Triangulation::CELL_COARSEN,
+                             status == Triangulation::CELL_REFINE);
+        });
+#endif
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  unsigned int MeshAdaptor<Description, dim, Number>::cell_weight(
+      const typename dealii::Triangulation<dim>::cell_iterator &cell,
+      const bool children_will_be_coarsened,
+      const bool cell_will_be_refined) const
+  {
+    float cost = 0.f;
+
+    if (children_will_be_coarsened) {
+      for (const auto &child : cell->child_iterators())
+        cost += cell_cost_[child->active_cell_index()];
+
+    } else if (cell_will_be_refined) {
+      cost = cell_cost_[cell->active_cell_index()] /
+             dealii::GeometryInfo<dim>::max_children_per_cell;
+
+    } else {
+      cost = cell_cost_[cell->active_cell_index()];
+    }
+
+    return static_cast<unsigned int>(std::round(base_cell_weight_ * cost));
+  }
 } // namespace ryujin
@@ -5,13 +5,23 @@
 
 #pragma once
 
+#include <compile_time_options.h>
+
 #include "simd.h"
+#include "simd_transpose.h"
+#include "trace.h"
 
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/vectorization.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <memory>
+#include <vector>
+
 namespace ryujin
 {
   namespace Vectors
@@ -42,6 +52,50 @@ namespace ryujin
         const unsigned int n_components);
 
 
+    /**
+     * Storage layout of the locally owned part of a MultiComponentVector.
+     *
+     * @ingroup SIMD
+     */
+    enum class VectorLayout {
+      /**
+       * Store all components of an entry consecutively (array of
+       * structs):
+       * \f{align}
+       *  (U_0)_0, (U_0)_1, \ldots, (U_1)_0, (U_1)_1, \ldots
+       * \f}
+       */
+      interleaved,
+
+      /**
+       * Store blocks of @p simd_length entries component by component
+       * (array of structs of arrays):
+       * \f{align}
+       *  (U_0)_0, (U_1)_0, \ldots, (U_{L-1})_0, (U_0)_1, (U_1)_1, \ldots
+       * \f}
+       * This allows to access a SIMD row i, i+1, ..., i+simd_length-1
+       * with plain vector loads and stores. The blocking is only applied
+       * to the part of the locally owned index range that follows the last
+       * index exported to other MPI ranks. All exported and ghost entries
+       * remain interleaved so that MPI synchronization through the
+       * "vector" partitioner is unaffected.
+       */
+      blocked,
+    };
+
+    /**
+     * The default VectorLayout selected at compile time with the
+     * BLOCKED_VECTOR_LAYOUT configuration option.
+     *
+     * @ingroup SIMD
+     */
+#ifdef BLOCKED_VECTOR_LAYOUT
+    constexpr VectorLayout default_vector_layout = VectorLayout::blocked;
+#else
+    constexpr VectorLayout default_vector_layout = VectorLayout::interleaved;
+#endif
+
+
     /**
      * A wrapper around dealii::LinearAlgebra::distributed::Vector<Number>
      * that stores a vector element of @p n_comp components per entry
@@ -50,11 +104,18 @@ namespace ryujin
      * @note reinit() has to be called with an appropriate "vector" MPI
      * partitioner created by create_vector_partitioner().
      *
+     * @note Depending on the chosen @p layout the locally owned part of the
+     * vector might not be stored in the interleaved order described in
+     * create_vector_partitioner(). Individual entries must thus only be
+     * accessed by the MultiComponentVector accessor functions and not
+     * through local_element() or raw pointers.
+     *
      * @ingroup SIMD
      */
     template <typename Number,
               int n_comp,
-              int simd_length = dealii::VectorizedArray<Number>::size()>
+              int simd_length = VectorizedArray<Number>::size(),
+              VectorLayout layout = default_vector_layout>
     class MultiComponentVector
         : public dealii::LinearAlgebra::distributed::Vector<Number>
     {
@@ -79,6 +140,43 @@ namespace ryujin
        */
       using ScalarVector::operator=;
 
+      /**
+       * Reinitializes the MultiComponentVector with a "vector" MPI
+       * partitioner created by create_vector_partitioner() and sets up the
+       * storage layout.
+       */
+      void reinit(
+          const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+              &vector_partitioner);
+
+      /**
+       * Variant of above function that allocates the locally owned part
+       * of the vector in an MPI-3 shared memory window of all MPI ranks in
+       * the (node local) communicator @p comm_sm. Ghost values owned by a
+       * rank in @p comm_sm are then updated by update_ghost_values() with
+       * a direct load from the shared memory window of the owning rank.
+       * Only ghost values owned by off-node ranks are sent via MPI.
+       *
+       * @note All MPI ranks have to call this function with a
+       * communicator different from MPI_COMM_SELF, or none of them.
+       */
+      void reinit(
+          const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+              &vector_partitioner,
+          const MPI_Comm comm_sm);
+
+      /**
+       * Reinitializes the MultiComponentVector with the partitioner and
+       * storage layout of @p other.
+       */
+      void reinit(const MultiComponentVector &other,
+                  const bool omit_zeroing_entries = false);
+
+      /**
+       * Swap the contents (including the storage layout) with @p other.
+       */
+      void swap(MultiComponentVector &other);
+
       /**
        * Reinitializes the MultiComponentVector with a scalar MPI
        * partitioner. The function calls create_vector_partitioner()
@@ -147,6 +245,19 @@ namespace ryujin
                 typename Tensor = dealii::Tensor<1, n_comp, Number2>>
       Tensor get_tensor(const unsigned int *js) const;
 
+      /**
+       * Variant of above function for lane contiguous indices @p j, @p j
+       * + 1, ..., @p j + simd_length - 1 (see
+       * SparsityPatternSIMD::contiguous_columns()). In contrast to
+       * get_tensor(i) the index @p j does not have to be divisible by
+       * simd_length, and in contrast to get_tensor(js) no index array is
+       * read and all offsets of the transposed load are compile-time
+       * constants.
+       */
+      template <typename Number2 = Number,
+                typename Tensor = dealii::Tensor<1, n_comp, Number2>>
+      Tensor get_contiguous_tensor(const unsigned int j) const;
+
       /**
        * Update the values of the @p n_comp component vector at index @p i
        * with the values supplied by @p tensor.
@@ -180,14 +291,202 @@ namespace ryujin
       template <typename Number2 = Number,
                 typename Tensor = dealii::Tensor<1, n_comp, Number2>>
       void add_tensor(const Tensor &tensor, const unsigned int i);
+
+      /**
+       * Return the position of component @p component of entry @p i in the
+       * local storage of the vector.
+       */
+      unsigned int storage_index(const unsigned int i,
+                                 const unsigned int component) const;
+
+      /**
+       * Return true if the SIMD row starting at index @p i is stored in
+       * blocked (component by component) order. The index must be
+       * divisible by simd_length.
+       */
+      bool is_blocked(const unsigned int i) const;
+
+      /**
+       * Start a ghost exchange that only communicates the components
+       * flagged in @p components. In contrast to update_ghost_values_start()
+       * no contiguous send buffer is used: MPI derived datatypes describe
+       * the selected components within the strided storage of exported and
+       * ghost entries such that MPI packs and unpacks them in place. The
+       * datatypes are created on first use for a given component mask and
+       * reused afterwards.
+       *
+       * @note Ghost values of components not flagged in @p components keep
+       * their previous values. Exported entries must not be modified until
+       * update_ghost_components_finish() returns.
+       */
+      void update_ghost_components_start(
+          const std::bitset<n_comp> &components,
+          const unsigned int communication_channel = 0) const;
+
+      /**
+       * Wait for the exchange started by update_ghost_components_start()
+       * to complete.
+       */
+      void update_ghost_components_finish() const;
+
+      /**
+       * Update all ghost values. If the vector was set up with
+       * reinit(vector_partitioner, comm_sm) then ghost values owned by MPI
+       * ranks on the same node are copied directly out of the shared
+       * memory window and only the remaining ghost values are
+       * communicated. Otherwise, the function of the underlying
+       * dealii::LinearAlgebra::distributed::Vector is called.
+       */
+      void update_ghost_values() const;
+
+      /**
+       * Start a ghost update. See update_ghost_values() for details.
+       *
+       * @note Locally owned values must not be modified until
+       * update_ghost_values_finish() returns.
+       */
+      void update_ghost_values_start(
+          const unsigned int communication_channel = 0) const;
+
+      /**
+       * Finish a ghost update started by update_ghost_values_start().
+       */
+      void update_ghost_values_finish() const;
+
+      /**
+       * Return true if update_ghost_values() uses the shared memory plan.
+       * The decision only depends on how the vector was reinitialized and
+       * is thus consistent over all MPI ranks.
+       */
+      bool use_shared_memory_exchange() const;
+
+    private:
+      /**
+       * Compute the blocked index range from the import indices of the
+       * current partitioner.
+       */
+      void setup_layout();
+
+      /**
+       * Half open range of locally owned indices that are stored in
+       * blocked order. Both values are divisible by simd_length. The range
+       * is empty for the interleaved layout.
+       */
+      unsigned int blocked_begin_ = 0;
+      unsigned int blocked_end_ = 0;
+
+      /**
+       * MPI derived datatypes for exchanging a subset of components with
+       * every send and receive target of a given partitioner.
+       */
+      struct GhostComponentExchange {
+        GhostComponentExchange(
+            const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+                &partitioner,
+            const std::bitset<n_comp> &components);
+
+        ~GhostComponentExchange();
+
+        std::shared_ptr<const dealii::Utilities::MPI::Partitioner> partitioner;
+        std::bitset<n_comp> components;
+
+#ifdef DEAL_II_WITH_MPI
+        std::vector<std::pair<int, MPI_Datatype>> send_types;
+        std::vector<std::pair<int, MPI_Datatype>> receive_types;
+#endif
+      };
+
+      mutable std::shared_ptr<GhostComponentExchange> ghost_component_exchange_;
+
+#ifdef DEAL_II_WITH_MPI
+      mutable std::vector<MPI_Request> ghost_component_requests_;
+#endif
+
+      /**
+       * Communication plan for a ghost update through a shared memory
+       * window: Ghost values owned by a rank in @p comm_sm are recorded
+       * as a tuple (ghost position, rank in comm_sm, index local to the
+       * owner); all other ghost values are exchanged with an auxiliary
+       * partitioner that only contains off-node ghost indices (embedded
+       * into the full ghost index set).
+       */
+      struct SharedMemoryExchange {
+        SharedMemoryExchange(
+            const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+                &partitioner,
+            const MPI_Comm comm_sm);
+
+        std::shared_ptr<const dealii::Utilities::MPI::Partitioner> partitioner;
+        std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+            off_node_partitioner;
+
+        MPI_Comm comm_sm;
+        unsigned int n_sm_ranks;
+        std::vector<std::array<unsigned int, 3>> on_node_ghosts;
+      };
+
+      std::shared_ptr<const SharedMemoryExchange> shared_memory_exchange_;
+
+#ifdef DEAL_II_WITH_MPI
+      mutable std::vector<Number> shared_memory_import_buffer_;
+      mutable std::vector<MPI_Request> shared_memory_requests_;
+#endif
     };
 
 
 #ifndef DOXYGEN
     /* Template definitions: */
 
-    template <typename Number, int n_comp, int simd_length>
-    void MultiComponentVector<Number, n_comp, simd_length>::
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::reinit(
+        const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+            &vector_partitioner)
+    {
+      ScalarVector::reinit(vector_partitioner);
+      setup_layout();
+      shared_memory_exchange_.reset();
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::reinit(
+        const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+            &vector_partitioner,
+        const MPI_Comm comm_sm)
+    {
+      ScalarVector::reinit(vector_partitioner, comm_sm);
+      setup_layout();
+      shared_memory_exchange_.reset();
+      if (comm_sm != MPI_COMM_SELF)
+        shared_memory_exchange_ =
+            std::make_shared<SharedMemoryExchange>(vector_partitioner, comm_sm);
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::reinit(
+        const MultiComponentVector &other, const bool omit_zeroing_entries)
+    {
+      ScalarVector::reinit(other, omit_zeroing_entries);
+      blocked_begin_ = other.blocked_begin_;
+      blocked_end_ = other.blocked_end_;
+      shared_memory_exchange_ = other.shared_memory_exchange_;
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::swap(
+        MultiComponentVector &other)
+    {
+      ScalarVector::swap(other);
+      std::swap(blocked_begin_, other.blocked_begin_);
+      std::swap(blocked_end_, other.blocked_end_);
+      std::swap(shared_memory_exchange_, other.shared_memory_exchange_);
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
         reinit_with_scalar_partitioner(
             const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
                 &scalar_partitioner)
@@ -199,14 +498,48 @@ namespace ryujin
       auto vector_partitioner =
           create_vector_partitioner(scalar_partitioner, n_comp);
 
-      dealii::LinearAlgebra::distributed::Vector<Number>::reinit(
-          vector_partitioner);
+      reinit(vector_partitioner);
     }
 
 
-    template <typename Number, int n_comp, int simd_length>
-    void MultiComponentVector<Number, n_comp, simd_length>::extract_component(
-        ScalarVector &scalar_vector, unsigned int component) const
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
+        setup_layout()
+    {
+      blocked_begin_ = 0;
+      blocked_end_ = 0;
+
+      if constexpr (layout == VectorLayout::blocked && n_comp > 0) {
+        const auto &partitioner = this->get_partitioner();
+
+        /*
+         * All indices that are exported to other MPI ranks have to remain
+         * interleaved. Note that the import indices are given in terms of
+         * the "vector" partitioner:
+         */
+        unsigned int n_export = 0;
+        for (const auto &[first, last] : partitioner->import_indices())
+          n_export = std::max(n_export, last);
+        n_export = (n_export + n_comp - 1) / n_comp;
+
+        const unsigned int n_owned =
+            partitioner->locally_owned_size() / n_comp;
+
+        const unsigned int begin =
+            (n_export + simd_length - 1) / simd_length * simd_length;
+        if (begin >= n_owned)
+          return;
+
+        blocked_begin_ = begin;
+        blocked_end_ = begin + (n_owned - begin) / simd_length * simd_length;
+      }
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
+        extract_component(ScalarVector &scalar_vector,
+                          unsigned int component) const
     {
       Assert(n_comp > 0,
              dealii::ExcMessage(
@@ -220,14 +553,15 @@ namespace ryujin
           scalar_vector.get_partitioner()->locally_owned_size();
       for (unsigned int i = 0; i < local_size; ++i)
         scalar_vector.local_element(i) =
-            this->local_element(i * n_comp + component);
+            this->local_element(storage_index(i, component));
       scalar_vector.update_ghost_values();
     }
 
 
-    template <typename Number, int n_comp, int simd_length>
-    void MultiComponentVector<Number, n_comp, simd_length>::insert_component(
-        const ScalarVector &scalar_vector, unsigned int component)
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
+        insert_component(const ScalarVector &scalar_vector,
+                         unsigned int component)
     {
       Assert(n_comp > 0,
              dealii::ExcMessage(
@@ -240,16 +574,393 @@ namespace ryujin
       const auto local_size =
           scalar_vector.get_partitioner()->locally_owned_size();
       for (unsigned int i = 0; i < local_size; ++i)
-        this->local_element(i * n_comp + component) =
+        this->local_element(storage_index(i, component)) =
             scalar_vector.local_element(i);
     }
 
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    MultiComponentVector<Number, n_comp, simd_length, layout>::
+        GhostComponentExchange::GhostComponentExchange(
+            const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+                &partitioner,
+            const std::bitset<n_comp> &components)
+        : partitioner(partitioner)
+        , components(components)
+    {
+#ifdef DEAL_II_WITH_MPI
+      /*
+       * Create an indexed datatype for the given (sorted) local indices
+       * by merging consecutive indices into blocks:
+       */
+      const auto create_type = [](const std::vector<unsigned int> &indices) {
+        std::vector<int> lengths;
+        std::vector<int> displacements;
+        for (const auto index : indices) {
+          if (!displacements.empty() &&
+              displacements.back() + lengths.back() == int(index)) {
+            ++lengths.back();
+          } else {
+            displacements.push_back(index);
+            lengths.push_back(1);
+          }
+        }
+
+        MPI_Datatype element;
+        int ierr = MPI_Type_contiguous(sizeof(Number), MPI_BYTE, &element);
+        AssertThrowMPI(ierr);
+
+        MPI_Datatype type;
+        ierr = MPI_Type_indexed(lengths.size(),
+                                lengths.data(),
+                                displacements.data(),
+                                element,
+                                &type);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Type_commit(&type);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Type_free(&element);
+        AssertThrowMPI(ierr);
+        return type;
+      };
+
+      std::vector<unsigned int> indices;
+
+      /*
+       * Exported entries: The import indices are a list of half open
+       * ranges that are traversed in the order of the import targets:
+       */
+      const auto &import_indices = partitioner->import_indices();
+      auto range = import_indices.begin();
+      unsigned int index = range != import_indices.end() ? range->first : 0;
+      for (const auto &[rank, n_entries] : partitioner->import_targets()) {
+        indices.clear();
+        for (unsigned int k = 0; k < n_entries; ++k, ++index) {
+          while (index == range->second) {
+            ++range;
+            index = range->first;
+          }
+          if (components[index % n_comp])
+            indices.push_back(index);
+        }
+        if (!indices.empty())
+          send_types.emplace_back(rank, create_type(indices));
+      }
+
+      /*
+       * Ghost entries: Stored contiguously after the locally owned range
+       * in the order of the ghost targets:
+       */
+      unsigned int offset = partitioner->locally_owned_size();
+      for (const auto &[rank, n_entries] : partitioner->ghost_targets()) {
+        indices.clear();
+        for (unsigned int k = offset; k < offset + n_entries; ++k)
+          if (components[k % n_comp])
+            indices.push_back(k);
+        offset += n_entries;
+        if (!indices.empty())
+          receive_types.emplace_back(rank, create_type(indices));
+      }
+#endif
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    MultiComponentVector<Number, n_comp, simd_length, layout>::
+        GhostComponentExchange::~GhostComponentExchange()
+    {
+#ifdef DEAL_II_WITH_MPI
+      int finalized;
+      MPI_Finalized(&finalized);
+      if (finalized)
+        return;
+      for (auto &[rank, type] : send_types)
+        MPI_Type_free(&type);
+      for (auto &[rank, type] : receive_types)
+        MPI_Type_free(&type);
+#endif
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
+        update_ghost_components_start(
+            const std::bitset<n_comp> &components,
+            const unsigned int communication_channel) const
+    {
+#ifdef DEAL_II_WITH_MPI
+      /* Special case of a zero component vector */
+      if constexpr (n_comp > 0) {
+        AssertIndexRange(communication_channel, 200);
+        Assert(ghost_component_requests_.empty(),
+               dealii::ExcMessage("A ghost exchange is already in progress"));
+
+        using dealii::Utilities::MPI::internal::Tags::partitioner_export_end;
+        using dealii::Utilities::MPI::internal::Tags::
+            partitioner_export_start;
+        const int mpi_tag = partitioner_export_start + communication_channel;
+        Assert(mpi_tag <= partitioner_export_end, dealii::ExcInternalError());
+
+        const auto &partitioner = this->get_partitioner();
+        if (!ghost_component_exchange_ ||
+            ghost_component_exchange_->partitioner != partitioner ||
+            ghost_component_exchange_->components != components)
+          ghost_component_exchange_ =
+              std::make_shared<GhostComponentExchange>(partitioner, components);
+
+        const auto &send_types = ghost_component_exchange_->send_types;
+        const auto &receive_types = ghost_component_exchange_->receive_types;
+        const auto &mpi_communicator = partitioner->get_mpi_communicator();
+
+        /*
+         * All datatypes are relative to the beginning of the local storage.
+         * The const_cast is the usual idiom for updating (mutable) ghost
+         * values of a const vector:
+         */
+        auto data = const_cast<Number *>(this->begin());
+
+        ghost_component_requests_.resize(receive_types.size() +
+                                         send_types.size());
+
+        for (unsigned int p = 0; p < receive_types.size(); ++p) {
+          const int ierr = MPI_Irecv(data,
+                                     1,
+                                     receive_types[p].second,
+                                     receive_types[p].first,
+                                     mpi_tag,
+                                     mpi_communicator,
+                                     &ghost_component_requests_[p]);
+          AssertThrowMPI(ierr);
+        }
+
+        for (unsigned int p = 0; p < send_types.size(); ++p) {
+          const int ierr = MPI_Isend(
+              data,
+              1,
+              send_types[p].second,
+              send_types[p].first,
+              mpi_tag,
+              mpi_communicator,
+              &ghost_component_requests_[receive_types.size() + p]);
+          AssertThrowMPI(ierr);
+        }
+      }
+#endif
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
+        update_ghost_components_finish() const
+    {
+#ifdef DEAL_II_WITH_MPI
+      const int ierr = MPI_Waitall(ghost_component_requests_.size(),
+                                   ghost_component_requests_.data(),
+                                   MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+      ghost_component_requests_.clear();
+#endif
+      this->set_ghost_state(true);
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    MultiComponentVector<Number, n_comp, simd_length, layout>::
+        SharedMemoryExchange::SharedMemoryExchange(
+            const std::shared_ptr<const dealii::Utilities::MPI::Partitioner>
+                &partitioner,
+            const MPI_Comm comm_sm)
+        : partitioner(partitioner)
+        , off_node_partitioner(partitioner)
+        , comm_sm(comm_sm)
+        , n_sm_ranks(dealii::Utilities::MPI::n_mpi_processes(comm_sm))
+    {
+#ifdef DEAL_II_WITH_MPI
+      const auto &mpi_communicator = partitioner->get_mpi_communicator();
+
+      /*
+       * Gather the rank and the first locally owned index of all MPI ranks
+       * on the node:
+       */
+      const std::array<unsigned long long, 2> local_data{
+          dealii::Utilities::MPI::this_mpi_process(mpi_communicator),
+          partitioner->local_range().first};
+      std::vector<std::array<unsigned long long, 2>> node_data(n_sm_ranks);
+      const int ierr = MPI_Allgather(local_data.data(),
+                                     2,
+                                     MPI_UNSIGNED_LONG_LONG,
+                                     node_data.data(),
+                                     2,
+                                     MPI_UNSIGNED_LONG_LONG,
+                                     comm_sm);
+      AssertThrowMPI(ierr);
+
+      /*
+       * Ghost indices are stored in the order of the ghost targets. Split
+       * them into on-node and off-node ghost indices:
+       */
+      const auto &ghost_indices = partitioner->ghost_indices();
+      dealii::IndexSet off_node_ghosts(ghost_indices.size());
+
+      unsigned int k = 0;
+      auto ghost = ghost_indices.begin();
+      for (const auto &[owner, n_entries] : partitioner->ghost_targets()) {
+        const auto it = std::find_if(
+            node_data.begin(), node_data.end(), [owner = owner](auto &entry) {
+              return entry[0] == owner;
+            });
+        for (unsigned int j = 0; j < n_entries; ++j, ++k, ++ghost) {
+          if (it == node_data.end()) {
+            off_node_ghosts.add_index(*ghost);
+            continue;
+          }
+          on_node_ghosts.push_back({k,
+                                    unsigned(it - node_data.begin()),
+                                    unsigned(*ghost - (*it)[1])});
+        }
+      }
+      off_node_ghosts.compress();
+
+      const auto off_node =
+          std::make_shared<dealii::Utilities::MPI::Partitioner>(
+              partitioner->locally_owned_range(),
+              off_node_ghosts,
+              mpi_communicator);
+      off_node->set_ghost_indices(off_node_ghosts, ghost_indices);
+      off_node_partitioner = off_node;
+#endif
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    bool MultiComponentVector<Number, n_comp, simd_length, layout>::
+        use_shared_memory_exchange() const
+    {
+      return shared_memory_exchange_ &&
+             shared_memory_exchange_->partitioner == this->get_partitioner();
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
+        update_ghost_values() const
+    {
+      update_ghost_values_start();
+      update_ghost_values_finish();
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
+        update_ghost_values_start(
+            const unsigned int communication_channel) const
+    {
+      TraceScope trace("ghost exchange start");
+#ifdef DEAL_II_WITH_MPI
+      if (use_shared_memory_exchange()) {
+        const auto &exchange = *shared_memory_exchange_;
+        const auto &off_node = *exchange.off_node_partitioner;
+
+        /*
+         * Make sure that all MPI ranks on the node have finished writing
+         * to their locally owned part before ghost values are read:
+         */
+        const int ierr = MPI_Barrier(exchange.comm_sm);
+        AssertThrowMPI(ierr);
+
+        const unsigned int n_owned = this->locally_owned_size();
+        const unsigned int n_ghosts = exchange.partitioner->n_ghost_indices();
+        auto data = const_cast<Number *>(this->begin());
+
+        shared_memory_import_buffer_.resize(off_node.n_import_indices());
+        off_node.export_to_ghosted_array_start(
+            communication_channel,
+            dealii::ArrayView<const Number>(data, n_owned),
+            dealii::make_array_view(shared_memory_import_buffer_),
+            dealii::ArrayView<Number>(data + n_owned, n_ghosts),
+            shared_memory_requests_);
+        return;
+      }
+#endif
+      ScalarVector::update_ghost_values_start(communication_channel);
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    void MultiComponentVector<Number, n_comp, simd_length, layout>::
+        update_ghost_values_finish() const
+    {
+      TraceScope trace("ghost exchange wait");
+#ifdef DEAL_II_WITH_MPI
+      if (use_shared_memory_exchange()) {
+        const auto &exchange = *shared_memory_exchange_;
+        const auto &shared_data = this->shared_vector_data();
+        Assert(shared_data.size() == exchange.n_sm_ranks,
+               dealii::ExcInternalError());
+
+        const unsigned int n_owned = this->locally_owned_size();
+        const unsigned int n_ghosts = exchange.partitioner->n_ghost_indices();
+        auto ghosts = const_cast<Number *>(this->begin()) + n_owned;
+
+        /*
+         * The off-node exchange zeroes all on-node ghost positions of the
+         * (larger) ghost array, so copy on-node values afterwards. Note
+         * that exported entries are always stored interleaved:
+         */
+        exchange.off_node_partitioner->export_to_ghosted_array_finish(
+            dealii::ArrayView<Number>(ghosts, n_ghosts),
+            shared_memory_requests_);
+
+        for (const auto &[k, q, j] : exchange.on_node_ghosts)
+          ghosts[k] = shared_data[q][j];
+
+        /*
+         * Make sure that all MPI ranks on the node have finished reading
+         * before locally owned values are modified again:
+         */
+        const int ierr = MPI_Barrier(exchange.comm_sm);
+        AssertThrowMPI(ierr);
+
+        this->set_ghost_state(true);
+        return;
+      }
+#endif
+      ScalarVector::update_ghost_values_finish();
+    }
+
     /* Inline function  definitions: */
 
-    template <typename Number, int n_comp, int simd_length>
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    DEAL_II_ALWAYS_INLINE inline unsigned int
+    MultiComponentVector<Number, n_comp, simd_length, layout>::storage_index(
+        const unsigned int i, const unsigned int component) const
+    {
+      if constexpr (layout == VectorLayout::blocked) {
+        if (i >= blocked_begin_ && i < blocked_end_) {
+          const unsigned int lane = i % simd_length;
+          return (i - lane) * n_comp + component * simd_length + lane;
+        }
+      }
+
+      return i * n_comp + component;
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    DEAL_II_ALWAYS_INLINE inline bool
+    MultiComponentVector<Number, n_comp, simd_length, layout>::is_blocked(
+        const unsigned int i) const
+    {
+      if constexpr (layout == VectorLayout::blocked)
+        return i >= blocked_begin_ && i < blocked_end_;
+      else
+        return false;
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
     template <typename Number2, typename Tensor>
     DEAL_II_ALWAYS_INLINE inline Tensor
-    MultiComponentVector<Number, n_comp, simd_length>::get_tensor(
+    MultiComponentVector<Number, n_comp, simd_length, layout>::get_tensor(
         const unsigned int i) const
     {
       static_assert(std::is_same<Number2, typename Tensor::value_type>::value,
@@ -264,17 +975,24 @@ namespace ryujin
         /* Non-vectorized sequential access. */
 
         for (unsigned int d = 0; d < n_comp; ++d)
-          tensor[d] = this->local_element(i * n_comp + d);
+          tensor[d] = this->local_element(storage_index(i, d));
 
       } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
-
         /* Vectorized fast access. index must be divisible by simd_length */
+
+        if (is_blocked(i)) {
+          const Number *data = this->begin() + i * n_comp;
+          for (unsigned int d = 0; d < n_comp; ++d)
+            tensor[d].load(data + d * simd_length);
+          return tensor;
+        }
+
         std::array<unsigned int, VectorizedArray::size()> indices;
         for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
           indices[k] = k * n_comp;
 
-        dealii::vectorized_load_and_transpose(
-            n_comp, this->begin() + i * n_comp, indices.data(), &tensor[0]);
+        load_and_transpose<n_comp>(
+            this->begin() + i * n_comp, indices.data(), &tensor[0]);
 
       } else {
         /* not implemented */
@@ -285,10 +1003,10 @@ namespace ryujin
     }
 
 
-    template <typename Number, int n_comp, int simd_length>
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
     template <typename Number2, typename Tensor>
     DEAL_II_ALWAYS_INLINE inline Tensor
-    MultiComponentVector<Number, n_comp, simd_length>::get_tensor(
+    MultiComponentVector<Number, n_comp, simd_length, layout>::get_tensor(
         const unsigned int *js) const
     {
       static_assert(std::is_same<Number2, typename Tensor::value_type>::value,
@@ -303,17 +1021,29 @@ namespace ryujin
         /* Non-vectorized sequential access. */
 
         for (unsigned int d = 0; d < n_comp; ++d)
-          tensor[d] = this->local_element(js[0] * n_comp + d);
+          tensor[d] = this->local_element(storage_index(js[0], d));
 
       } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
         /* Vectorized fast access. index must be divisible by simd_length */
 
+        if constexpr (layout == VectorLayout::blocked) {
+          bool interleaved = true;
+          for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
+            interleaved = interleaved && !is_blocked(js[k]);
+
+          if (!interleaved) {
+            for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
+              for (unsigned int d = 0; d < n_comp; ++d)
+                tensor[d][k] = this->local_element(storage_index(js[k], d));
+            return tensor;
+          }
+        }
+
         std::array<unsigned int, VectorizedArray::size()> indices;
         for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
           indices[k] = js[k] * n_comp;
 
-        dealii::vectorized_load_and_transpose(
-            n_comp, this->begin(), indices.data(), &tensor[0]);
+        load_and_transpose<n_comp>(this->begin(), indices.data(), &tensor[0]);
 
       } else {
         /* not implemented */
@@ -324,10 +1054,61 @@ namespace ryujin
     }
 
 
-    template <typename Number, int n_comp, int simd_length>
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
+    template <typename Number2, typename Tensor>
+    DEAL_II_ALWAYS_INLINE inline Tensor
+    MultiComponentVector<Number, n_comp, simd_length, layout>::
+        get_contiguous_tensor(const unsigned int j) const
+    {
+      static_assert(std::is_same<Number2, typename Tensor::value_type>::value,
+                    "dummy type mismatch");
+      Tensor tensor;
+
+      /* Special case of a zero component vector */
+      if constexpr (n_comp == 0)
+        return tensor;
+
+      if constexpr (std::is_same<Number, Number2>::value) {
+        /* Non-vectorized sequential access. */
+
+        for (unsigned int d = 0; d < n_comp; ++d)
+          tensor[d] = this->local_element(storage_index(j, d));
+
+      } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+        /* Vectorized access of the lanes j, j+1, ..., j+simd_length-1 */
+
+        if constexpr (layout == VectorLayout::blocked) {
+          if (j % simd_length == 0 && is_blocked(j))
+            return get_tensor<Number2, Tensor>(j);
+
+          if (j + simd_length > blocked_begin_ && j < blocked_end_) {
+            for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
+              for (unsigned int d = 0; d < n_comp; ++d)
+                tensor[d][k] = this->local_element(storage_index(j + k, d));
+            return tensor;
+          }
+        }
+
+        std::array<unsigned int, VectorizedArray::size()> indices;
+        for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
+          indices[k] = k * n_comp;
+
+        load_and_transpose<n_comp>(
+            this->begin() + j * n_comp, indices.data(), &tensor[0]);
+
+      } else {
+        /* not implemented */
+        __builtin_trap();
+      }
+
+      return tensor;
+    }
+
+
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
     template <typename Number2, typename Tensor>
     DEAL_II_ALWAYS_INLINE inline void
-    MultiComponentVector<Number, n_comp, simd_length>::write_tensor(
+    MultiComponentVector<Number, n_comp, simd_length, layout>::write_tensor(
         const Tensor &tensor, const unsigned int i)
     {
       static_assert(std::is_same<Number2, typename Tensor::value_type>::value,
@@ -341,20 +1122,24 @@ namespace ryujin
         /* Non-vectorized sequential access. */
 
         for (unsigned int d = 0; d < n_comp; ++d)
-          this->local_element(i * n_comp + d) = tensor[d];
+          this->local_element(storage_index(i, d)) = tensor[d];
 
       } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
         /* Vectorized fast access. index must be divisible by simd_length */
 
+        if (is_blocked(i)) {
+          Number *data = this->begin() + i * n_comp;
+          for (unsigned int d = 0; d < n_comp; ++d)
+            tensor[d].store(data + d * simd_length);
+          return;
+        }
+
         std::array<unsigned int, VectorizedArray::size()> indices;
         for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
           indices[k] = k * n_comp;
 
-        dealii::vectorized_transpose_and_store(/*add into*/ false,
-                                               n_comp,
-                                               &tensor[0],
-                                               indices.data(),
-                                               this->begin() + i * n_comp);
+        transpose_and_store<n_comp, /*add into*/ false>(
+            &tensor[0], indices.data(), this->begin() + i * n_comp);
 
       } else {
         /* not implemented */
@@ -363,10 +1148,10 @@ namespace ryujin
     }
 
 
-    template <typename Number, int n_comp, int simd_length>
+    template <typename Number, int n_comp, int simd_length, VectorLayout layout>
     template <typename Number2, typename Tensor>
     DEAL_II_ALWAYS_INLINE inline void
-    MultiComponentVector<Number, n_comp, simd_length>::add_tensor(
+    MultiComponentVector<Number, n_comp, simd_length, layout>::add_tensor(
         const Tensor &tensor, const unsigned int i)
     {
       static_assert(std::is_same<Number2, typename Tensor::value_type>::value,
@@ -380,20 +1165,28 @@ namespace ryujin
         /* Non-vectorized sequential access. */
 
         for (unsigned int d = 0; d < n_comp; ++d)
-          this->local_element(i * n_comp + d) += tensor[d];
+          this->local_element(storage_index(i, d)) += tensor[d];
 
       } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
         /* Vectorized fast access. index must be divisible by simd_length */
 
+        if (is_blocked(i)) {
+          Number *data = this->begin() + i * n_comp;
+          for (unsigned int d = 0; d < n_comp; ++d) {
+            VectorizedArray temp;
+            temp.load(data + d * simd_length);
+            temp += tensor[d];
+            temp.store(data + d * simd_length);
+          }
+          return;
+        }
+
         std::array<unsigned int, VectorizedArray::size()> indices;
         for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
           indices[k] = k * n_comp;
 
-        dealii::vectorized_transpose_and_store(/*add into*/ true,
-                                               n_comp,
-                                               &tensor[0],
-                                               indices.data(),
-                                               this->begin() + i * n_comp);
+        transpose_and_store<n_comp, /*add into*/ true>(
+            &tensor[0], indices.data(), this->begin() + i * n_comp);
 
       } else {
         /* not implemented */
@@ -13,5 +13,9 @@ namespace ryujin
   namespace NavierStokes
   {
     Dispatch<Description, NUMBER> dispatch_instance("navier stokes");
+#ifdef RUNTIME_PRECISION
+    Dispatch<Description, ALTERNATIVE_NUMBER>
+        alternative_dispatch_instance("navier stokes");
+#endif
   } // namespace NavierStokes
 } // namespace ryujin
@@ -10,4 +10,10 @@ namespace ryujin
   template class InitialStateLibrary<Description, 1, NUMBER>;
   template class InitialStateLibrary<Description, 2, NUMBER>;
   template class InitialStateLibrary<Description, 3, NUMBER>;
+
+#ifdef RUNTIME_PRECISION
+  template class InitialStateLibrary<Description, 1, ALTERNATIVE_NUMBER>;
+  template class InitialStateLibrary<Description, 2, ALTERNATIVE_NUMBER>;
+  template class InitialStateLibrary<Description, 3, ALTERNATIVE_NUMBER>;
+#endif
 } // namespace ryujin
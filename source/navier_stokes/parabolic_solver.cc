@@ -13,5 +13,11 @@ namespace ryujin
     template class ParabolicSolver<Description, 1, NUMBER>;
     template class ParabolicSolver<Description, 2, NUMBER>;
     template class ParabolicSolver<Description, 3, NUMBER>;
+
+#ifdef RUNTIME_PRECISION
+    template class ParabolicSolver<Description, 1, ALTERNATIVE_NUMBER>;
+    template class ParabolicSolver<Description, 2, ALTERNATIVE_NUMBER>;
+    template class ParabolicSolver<Description, 3, ALTERNATIVE_NUMBER>;
+#endif
   } // namespace NavierStokes
 } // namespace ryujin
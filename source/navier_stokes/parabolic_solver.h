@@ -12,6 +12,7 @@
 #include <convenience_macros.h>
 #include <initial_values.h>
 #include <offline_data.h>
+#include <scope.h>
 #include <simd.h>
 #include <sparse_matrix_simd.h>
 
@@ -30,6 +31,8 @@
 #include <deal.II/multigrid/mg_smoother.h>
 #include <deal.II/multigrid/mg_transfer_matrix_free.h>
 
+#include <array>
+
 namespace ryujin
 {
   namespace NavierStokes
@@ -148,7 +151,7 @@ namespace ryujin
        */
       ParabolicSolver(
           const MPI_Comm &mpi_communicator,
-          std::map<std::string, dealii::Timer> &computing_timer,
+          std::map<std::string, SectionTimer> &computing_timer,
           const HyperbolicSystem &hyperbolic_system,
           const ParabolicSystem &parabolic_system,
           const OfflineData<dim, Number> &offline_data,
@@ -187,6 +190,13 @@ namespace ryujin
        */
       void print_solver_statistics(std::ostream &output) const;
 
+      /**
+       * Return an estimate of the (rank-local) memory consumption in
+       * bytes of the matrix-free data structures, all temporary vectors,
+       * and the multigrid level data.
+       */
+      std::size_t memory_consumption() const;
+
       //@}
       /**
        * @name Accessors
@@ -212,6 +222,15 @@ namespace ryujin
 
       Number tolerance_;
       bool tolerance_linfty_norm_;
+      double adaptive_tolerance_factor_;
+      unsigned int adaptive_tolerance_order_;
+
+      bool explicit_super_time_stepping_;
+      unsigned int super_time_stepping_max_stages_;
+
+      unsigned int extrapolation_order_;
+      bool fused_energy_rhs_;
+      bool thread_parallel_cell_loops_;
 
       unsigned int gmg_max_iter_vel_;
       unsigned int gmg_max_iter_en_;
@@ -221,7 +240,12 @@ namespace ryujin
       double gmg_smoother_max_eig_en_;
       unsigned int gmg_smoother_degree_;
       unsigned int gmg_smoother_n_cg_iter_;
+      double gmg_eigenvalue_reuse_tolerance_;
+      bool gmg_reuse_levels_;
       unsigned int gmg_min_level_;
+      bool gmg_amg_coarse_solver_;
+      bool gmg_flexible_cg_;
+      bool gmg_level_timings_;
 
       //@}
       /**
@@ -234,7 +258,7 @@ namespace ryujin
       static constexpr unsigned int order_quad = 2;
 
       const MPI_Comm &mpi_communicator_;
-      std::map<std::string, dealii::Timer> &computing_timer_;
+      std::map<std::string, SectionTimer> &computing_timer_;
 
       dealii::SmartPointer<const HyperbolicSystem> hyperbolic_system_;
       dealii::SmartPointer<const ParabolicSystem> parabolic_system_;
@@ -248,6 +272,11 @@ namespace ryujin
       mutable unsigned int n_warnings_;
       mutable double n_iterations_velocity_;
       mutable double n_iterations_internal_energy_;
+      mutable double n_saved_iterations_velocity_;
+      mutable double n_saved_iterations_internal_energy_;
+
+      mutable std::vector<double> level_times_velocity_;
+      mutable std::vector<double> level_times_energy_;
 
       mutable dealii::MatrixFree<dim, Number> matrix_free_;
 
@@ -257,8 +286,13 @@ namespace ryujin
       mutable ScalarVector internal_energy_rhs_;
       mutable ScalarVector density_;
 
+      mutable std::array<BlockVector, 2> velocity_rates_;
+      mutable std::array<ScalarVector, 2> internal_energy_rates_;
+      mutable unsigned int n_rates_;
+
       mutable dealii::MGLevelObject<dealii::MatrixFree<dim, float>>
           level_matrix_free_;
+      std::vector<std::size_t> level_fingerprints_;
       mutable dealii::MGConstrainedDoFs mg_constrained_dofs_;
       mutable dealii::MGLevelObject<
           dealii::LinearAlgebra::distributed::Vector<float>>
@@ -285,6 +319,65 @@ namespace ryujin
           dealii::LinearAlgebra::distributed::Vector<float>>
           mg_smoother_energy_;
 
+#ifdef DEAL_II_WITH_TRILINOS
+      mutable dealii::TrilinosWrappers::SparseMatrix coarse_matrix_velocity_;
+      mutable dealii::TrilinosWrappers::SparseMatrix coarse_matrix_energy_;
+      mutable MGCoarseGridAMG<
+          dealii::LinearAlgebra::distributed::BlockVector<float>,
+          dim>
+          mg_coarse_amg_velocity_;
+      mutable MGCoarseGridAMG<dealii::LinearAlgebra::distributed::Vector<float>,
+                              1>
+          mg_coarse_amg_energy_;
+#endif
+
+      /**
+       * Eigenvalue estimates of the Chebyshev smoothers on all levels
+       * (except the coarsest) together with the scaling of the operator
+       * they were computed for.
+       */
+      struct EigenvalueCache {
+        double scaling = 0.;
+        std::vector<double> max_eigenvalues;
+      };
+
+      mutable EigenvalueCache eigenvalue_cache_velocity_;
+      mutable EigenvalueCache eigenvalue_cache_energy_;
+
+      /**
+       * Return true if the eigenvalue estimates stored in @p cache can
+       * be reused for an operator with scaling @p scaling.
+       */
+      bool reuse_eigenvalue_estimates(const EigenvalueCache &cache,
+                                      const double scaling) const;
+
+      /**
+       * Largest eigenvalue estimates (divided by tau) of the scaled
+       * velocity and internal energy operators used for choosing the
+       * number of stages of the explicit super time stepping scheme.
+       */
+      mutable Number explicit_eigenvalue_velocity_;
+      mutable Number explicit_eigenvalue_energy_;
+
+      /**
+       * Advance @p solution (holding x^n on entry) with the RKL2 super
+       * time stepping scheme over a step of size @p tau for the ODE
+       * system associated with the implicit system @p op x = @p rhs.
+       * The callable @p constrain sets all strongly enforced boundary
+       * values of a vector to zero. Returns the number of stages, or 0
+       * if more than the maximal number of stages would have been
+       * necessary (in which case @p solution is left unchanged).
+       */
+      template <typename Operator, typename VectorType, typename Constrain>
+      unsigned int super_time_step(const Operator &op,
+                                   const DiagonalMatrix<dim, Number> &diagonal,
+                                   const VectorType &rhs,
+                                   VectorType &solution,
+                                   const Number tau,
+                                   const Constrain &constrain,
+                                   Number &eigenvalue,
+                                   const bool update_eigenvalue) const;
+
       //@}
     };
 
@@ -23,6 +23,8 @@
 #include <deal.II/multigrid/multigrid.h>
 
 #include <atomic>
+#include <chrono>
+#include <functional>
 
 namespace ryujin
 {
@@ -30,10 +32,78 @@ namespace ryujin
   {
     using namespace dealii;
 
+    namespace
+    {
+      /**
+       * A small helper class that accumulates the wall time spent on
+       * every level of a multigrid V-cycle (smoothing, residual
+       * computation, transfer, coarse solve) in a vector @p level_times.
+       */
+      class LevelTimer
+      {
+      public:
+        LevelTimer(std::vector<double> &level_times)
+            : level_times_(level_times)
+        {
+        }
+
+        template <typename MG>
+        void connect(MG &mg, const unsigned int min_level)
+        {
+          using clock = std::chrono::steady_clock;
+          start_times_.resize(level_times_.size());
+
+          const auto timer = [this](const bool start,
+                                    const unsigned int level) {
+            if (start) {
+              start_times_[level] = clock::now();
+            } else {
+              const std::chrono::duration<double> elapsed =
+                  clock::now() - start_times_[level];
+              level_times_[level] += elapsed.count();
+            }
+          };
+
+          mg.connect_pre_smoother_step(timer);
+          mg.connect_post_smoother_step(timer);
+          mg.connect_residual_step(timer);
+          mg.connect_restriction(timer);
+          mg.connect_prolongation(timer);
+          mg.connect_coarse_solve([timer, min_level](const bool start) {
+            timer(start, min_level);
+          });
+        }
+
+      private:
+        std::vector<double> &level_times_;
+        std::vector<std::chrono::steady_clock::time_point> start_times_;
+      };
+
+
+      /**
+       * Estimate the number of (Krylov) iterations saved by solving to
+       * the relative tolerance @p tolerance instead of @p
+       * reference_tolerance. The estimate assumes a constant convergence
+       * rate over all @p n_iterations performed.
+       */
+      double saved_iterations(const unsigned int n_iterations,
+                              const double tolerance,
+                              const double reference_tolerance)
+      {
+        if (n_iterations == 0 || tolerance <= reference_tolerance ||
+            tolerance >= 1.)
+          return 0.;
+
+        return n_iterations * (std::log(reference_tolerance) /
+                                   std::log(tolerance) -
+                               1.);
+      }
+    } // namespace
+
     template <typename Description, int dim, typename Number>
     ParabolicSolver<Description, dim, Number>::ParabolicSolver(
         const MPI_Comm &mpi_communicator,
-        std::map<std::string, dealii::Timer> &computing_timer,
+        std::map<std::string, SectionTimer> &computing_timer,
         const HyperbolicSystem &hyperbolic_system,
         const ParabolicSystem &parabolic_system,
         const OfflineData<dim, Number> &offline_data,
@@ -50,6 +120,9 @@ namespace ryujin
         , n_warnings_(0)
         , n_iterations_velocity_(0.)
         , n_iterations_internal_energy_(0.)
+        , n_saved_iterations_velocity_(0.)
+        , n_saved_iterations_internal_energy_(0.)
+        , n_rates_(0)
     {
       use_gmg_velocity_ = false;
       add_parameter("multigrid velocity",
@@ -103,6 +176,25 @@ namespace ryujin
           "Chebyshev smoother: number of CG iterations to approximate "
           "eigenvalue");
 
+      gmg_eigenvalue_reuse_tolerance_ = 0.;
+      add_parameter(
+          "multigrid - eigenvalue reuse tolerance",
+          gmg_eigenvalue_reuse_tolerance_,
+          "Reuse the eigenvalue estimates of the Chebyshev smoothers when "
+          "reinitializing the multigrid levels as long as the relative "
+          "change of the scaling of the viscous operators (tau times the "
+          "viscosity coefficients) since the last estimate stays below this "
+          "tolerance. A value of 0 recomputes the estimates every time");
+
+      gmg_reuse_levels_ = false;
+      add_parameter(
+          "multigrid - reuse unchanged levels",
+          gmg_reuse_levels_,
+          "Keep the matrix-free data of all multigrid levels that were not "
+          "modified by a mesh adaptation cycle (identical cells, partition "
+          "and level degree of freedom numbering) instead of rebuilding "
+          "all levels from scratch");
+
       gmg_min_level_ = 0;
       add_parameter(
           "multigrid - min level",
@@ -110,9 +202,94 @@ namespace ryujin
           "Minimal mesh level to be visited in the geometric multigrid "
           "cycle where the coarse grid solver (Chebyshev) is called");
 
+      gmg_amg_coarse_solver_ = false;
+      add_parameter(
+          "multigrid - amg coarse solver",
+          gmg_amg_coarse_solver_,
+          "Use one cycle of an algebraic multigrid preconditioner (Trilinos "
+          "ML) applied to the assembled coarse level matrix as coarse grid "
+          "solver instead of a Chebyshev iteration. The coarse level matrix "
+          "and the AMG hierarchy are recomputed whenever the multigrid "
+          "levels are reinitialized, reusing the sparsity pattern");
+
+      gmg_flexible_cg_ = false;
+      add_parameter(
+          "multigrid - flexible cg",
+          gmg_flexible_cg_,
+          "Use a flexible conjugate gradient method as outer (double "
+          "precision) Krylov solver for the (single precision) multigrid "
+          "preconditioner. This makes the outer iteration robust against a "
+          "preconditioner that is not exactly a fixed linear symmetric "
+          "operator due to round-off in single precision");
+
+      gmg_level_timings_ = false;
+      add_parameter("multigrid - level timings",
+                    gmg_level_timings_,
+                    "Record and report the accumulated wall time spent on "
+                    "every level of the multigrid V-cycle");
+
       tolerance_ = Number(1.0e-12);
       add_parameter("tolerance", tolerance_, "Tolerance for linear solvers");
 
+      adaptive_tolerance_factor_ = 0.;
+      add_parameter(
+          "adaptive tolerance factor",
+          adaptive_tolerance_factor_,
+          "If set to a positive value the linear solvers only solve to the "
+          "relative tolerance max(tolerance, factor * tau^order) matching "
+          "the local truncation error of the time step. A value of 0 "
+          "always solves to the given tolerance");
+
+      adaptive_tolerance_order_ = 3;
+      add_parameter("adaptive tolerance order",
+                    adaptive_tolerance_order_,
+                    "Power of the time step size tau used for the adaptive "
+                    "tolerance");
+
+      extrapolation_order_ = 0;
+      add_parameter(
+          "initial guess extrapolation order",
+          extrapolation_order_,
+          "Order of the polynomial extrapolation in time of the initial "
+          "guess for the velocity and internal energy solves: 0 starts from "
+          "the current state, 1 reuses the rate of change of the previous "
+          "step, 2 linearly extrapolates the rates of the previous two "
+          "steps");
+
+      fused_energy_rhs_ = false;
+      add_parameter(
+          "fused energy right hand side",
+          fused_energy_rhs_,
+          "Perform the nodal update of the internal energy right hand side "
+          "directly within the matrix-free cell loop computing m_i K_i "
+          "instead of a separate (thread parallel) sweep over all vectors");
+
+      thread_parallel_cell_loops_ = false;
+      add_parameter(
+          "thread parallel cell loops",
+          thread_parallel_cell_loops_,
+          "Run the matrix-free cell loops of the velocity and internal "
+          "energy operators (and of all multigrid levels) thread parallel "
+          "by partitioning the cells into independent tasks");
+
+      explicit_super_time_stepping_ = false;
+      add_parameter(
+          "explicit super time stepping",
+          explicit_super_time_stepping_,
+          "Advance the velocity and internal energy over the time step with "
+          "an explicit second order Runge-Kutta-Legendre (RKL2) super time "
+          "stepping scheme instead of solving the implicit backward Euler "
+          "systems. The number of stages is chosen from the ratio of the "
+          "(hyperbolic) time step size and the explicit stability limit of "
+          "the parabolic operator. If more than the maximal number of "
+          "stages would be necessary the implicit solver is used instead");
+
+      super_time_stepping_max_stages_ = 50;
+      add_parameter("super time stepping max stages",
+                    super_time_stepping_max_stages_,
+                    "Maximal number of stages of the explicit super time "
+                    "stepping scheme");
+
       tolerance_linfty_norm_ = false;
       add_parameter("tolerance linfty norm",
                     tolerance_linfty_norm_,
@@ -128,6 +305,10 @@ namespace ryujin
       std::cout << "ParabolicSolver<dim, Number>::prepare()" << std::endl;
 #endif
 
+      AssertThrow(adaptive_tolerance_factor_ >= 0.,
+                  ExcMessage("The adaptive tolerance factor must be "
+                             "non-negative"));
+
       const auto &discretization = offline_data_->discretization();
       AssertThrow(discretization.ansatz() == Ansatz::cg_q1,
                   dealii::ExcMessage("The NavierStokes module currently only "
@@ -137,7 +318,9 @@ namespace ryujin
 
       typename MatrixFree<dim, Number>::AdditionalData additional_data;
       additional_data.tasks_parallel_scheme =
-          MatrixFree<dim, Number>::AdditionalData::none;
+          thread_parallel_cell_loops_
+              ? MatrixFree<dim, Number>::AdditionalData::partition_partition
+              : MatrixFree<dim, Number>::AdditionalData::none;
 
       matrix_free_.reinit(discretization.mapping(),
                           offline_data_->dof_handler(),
@@ -160,11 +343,29 @@ namespace ryujin
 
       density_.reinit(scalar_partitioner);
 
+      AssertThrow(extrapolation_order_ <= 2,
+                  dealii::ExcMessage("The initial guess extrapolation order "
+                                     "must be 0, 1, or 2"));
+
+      n_rates_ = 0;
+      for (unsigned int k = 0; k < extrapolation_order_; ++k) {
+        velocity_rates_[k].reinit(dim);
+        for (unsigned int i = 0; i < dim; ++i)
+          velocity_rates_[k].block(i).reinit(scalar_partitioner);
+        internal_energy_rates_[k].reinit(scalar_partitioner);
+      }
+
+      explicit_eigenvalue_velocity_ = Number(0.);
+      explicit_eigenvalue_energy_ = Number(0.);
+
       /* Initialize multigrid: */
 
       if (!use_gmg_velocity_ && !use_gmg_internal_energy_)
         return;
 
+      /* Distributes level degrees of freedom on first call: */
+      offline_data_->prepare_multigrid_data();
+
       const unsigned int n_levels =
           offline_data_->dof_handler().get_triangulation().n_global_levels();
       const unsigned int min_level = std::min(gmg_min_level_, n_levels - 1);
@@ -182,11 +383,63 @@ namespace ryujin
 
       typename MatrixFree<dim, float>::AdditionalData additional_data_level;
       additional_data_level.tasks_parallel_scheme =
-          MatrixFree<dim, float>::AdditionalData::none;
+          thread_parallel_cell_loops_
+              ? MatrixFree<dim, float>::AdditionalData::partition_partition
+              : MatrixFree<dim, float>::AdditionalData::none;
+
+      /*
+       * Compute a fingerprint of all (non-artificial) cells, their level
+       * subdomain ids and the level degree of freedom numbering on every
+       * level. The matrix-free data of a level is kept if its fingerprint
+       * agrees with the one recorded in the previous call to prepare() on
+       * all ranks, i.e., if the level was not modified by mesh adaptation
+       * or repartitioning:
+       */
+
+      std::vector<std::size_t> level_fingerprints(n_levels, 0);
+      if (gmg_reuse_levels_) {
+        const auto &dof_handler = offline_data_->dof_handler();
+        std::vector<types::global_dof_index> dof_indices(
+            dof_handler.get_fe().n_dofs_per_cell());
+
+        for (unsigned int level = min_level; level < n_levels; ++level) {
+          auto &hash = level_fingerprints[level];
+          const auto combine = [&hash](const std::size_t value) {
+            hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+          };
+
+          for (const auto &cell :
+               dof_handler.mg_cell_iterators_on_level(level)) {
+            if (cell->level_subdomain_id() ==
+                numbers::artificial_subdomain_id)
+              continue;
+            combine(std::hash<std::string>()(cell->id().to_string()));
+            combine(cell->level_subdomain_id());
+            cell->get_mg_dof_indices(dof_indices);
+            for (const auto index : dof_indices)
+              combine(index);
+          }
+        }
+      }
+
+      const bool same_level_range =
+          gmg_reuse_levels_ && level_fingerprints_.size() == n_levels &&
+          level_matrix_free_.min_level() == min_level &&
+          level_matrix_free_.max_level() == n_levels - 1;
+
+      if (!same_level_range) {
+        level_matrix_free_.resize(min_level, n_levels - 1);
+        level_density_.resize(min_level, n_levels - 1);
+      }
 
-      level_matrix_free_.resize(min_level, n_levels - 1);
-      level_density_.resize(min_level, n_levels - 1);
       for (unsigned int level = min_level; level < n_levels; ++level) {
+        if (same_level_range) {
+          const unsigned int unchanged =
+              level_fingerprints[level] == level_fingerprints_[level];
+          if (Utilities::MPI::min(unchanged, mpi_communicator_) == 1)
+            continue;
+        }
+
         additional_data_level.mg_level = level;
         AffineConstraints<double> constraints(relevant_sets[level]);
         // constraints.add_lines(mg_constrained_dofs_.get_boundary_indices(level));
@@ -200,11 +453,33 @@ namespace ryujin
         level_matrix_free_[level].initialize_dof_vector(level_density_[level]);
       }
 
+      level_fingerprints_ = std::move(level_fingerprints);
+
+      /* Invalidate all cached eigenvalue estimates: */
+      eigenvalue_cache_velocity_ = {};
+      eigenvalue_cache_energy_ = {};
+
+#ifdef DEAL_II_WITH_TRILINOS
+      /* Invalidate the coarse level matrices and AMG hierarchies: */
+      mg_coarse_amg_velocity_.clear();
+      mg_coarse_amg_energy_.clear();
+      coarse_matrix_velocity_.clear();
+      coarse_matrix_energy_.clear();
+#else
+      AssertThrow(!gmg_amg_coarse_solver_,
+                  dealii::ExcMessage("The algebraic multigrid coarse solver "
+                                     "requires deal.II to be configured with "
+                                     "Trilinos"));
+#endif
+
       mg_transfer_velocity_.build(offline_data_->dof_handler(),
                                   mg_constrained_dofs_,
                                   level_matrix_free_);
       mg_transfer_energy_.build(offline_data_->dof_handler(),
                                 level_matrix_free_);
+
+      level_times_velocity_.assign(n_levels, 0.);
+      level_times_energy_.assign(n_levels, 0.);
     }
 
 
@@ -243,9 +518,35 @@ namespace ryujin
       std::cout << "        perform time-step with tau = " << tau << std::endl;
 #endif
 
+      /*
+       * The relative tolerance of the velocity and internal energy solves.
+       * With an adaptive tolerance there is no point in solving far below
+       * the local truncation error O(tau^order) of the time step:
+       */
+      const Number relative_tolerance =
+          adaptive_tolerance_factor_ > 0.
+              ? std::max(tolerance_,
+                         Number(adaptive_tolerance_factor_ *
+                                std::pow(double(tau),
+                                         adaptive_tolerance_order_)))
+              : tolerance_;
+
       /* A boolean signalling that a restart is necessary: */
       std::atomic<bool> restart_needed = false;
 
+      /*
+       * Extrapolate the initial guess of the velocity and internal energy
+       * solves with the rates of change (V^{n+1} - V^n) / tau of the
+       * previous steps:
+       */
+
+      const unsigned int order =
+          explicit_super_time_stepping_
+              ? 0u
+              : std::min(extrapolation_order_, n_rates_);
+      const Number w_0 = (order == 2 ? Number(2.) : Number(1.)) * tau;
+      const Number w_1 = Number(-1.) * tau;
+
       /*
        * Step 1:
        *
@@ -275,7 +576,12 @@ namespace ryujin
             write_entry<T>(density_, rho_i, i);
             /* (5.4a) */
             for (unsigned int d = 0; d < dim; ++d) {
-              write_entry<T>(velocity_.block(d), M_i[d] / rho_i, i);
+              auto V_i = M_i[d] / rho_i;
+              if (order >= 1)
+                V_i += w_0 * get_entry<T>(velocity_rates_[0].block(d), i);
+              if (order == 2)
+                V_i += w_1 * get_entry<T>(velocity_rates_[1].block(d), i);
+              write_entry<T>(velocity_.block(d), V_i, i);
               write_entry<T>(velocity_rhs_.block(d), m_i * (M_i[d]), i);
             }
             write_entry<T>(internal_energy_, rho_e_i / rho_i, i);
@@ -386,6 +692,10 @@ namespace ryujin
           mg_transfer_velocity_.interpolate_to_mg(
               offline_data_->dof_handler(), level_density_, density_);
 
+          const double scaling = tau * parabolic_system_->mu();
+          const bool reuse_eigenvalues =
+              reuse_eigenvalue_estimates(eigenvalue_cache_velocity_, scaling);
+
           for (unsigned int level = level_matrix_free_.min_level();
                level <= level_matrix_free_.max_level();
                ++level) {
@@ -409,10 +719,48 @@ namespace ryujin
               smoother_data[level].smoothing_range = gmg_smoother_range_vel_;
               if (gmg_smoother_n_cg_iter_ == 0)
                 smoother_data[level].max_eigenvalue = gmg_smoother_max_eig_vel_;
+              if (reuse_eigenvalues) {
+                smoother_data[level].eig_cg_n_iterations = 0;
+                smoother_data[level].max_eigenvalue =
+                    eigenvalue_cache_velocity_.max_eigenvalues[level];
+              }
             }
           }
           mg_smoother_velocity_.initialize(level_velocity_matrices_,
                                            smoother_data);
+
+#ifdef DEAL_II_WITH_TRILINOS
+          if (gmg_amg_coarse_solver_) {
+            const bool reuse = coarse_matrix_velocity_.m() != 0;
+            level_velocity_matrices_[level_matrix_free_.min_level()]
+                .compute_sparse_matrix(coarse_matrix_velocity_);
+            mg_coarse_amg_velocity_.initialize(coarse_matrix_velocity_, reuse);
+          }
+#endif
+
+          if (!reuse_eigenvalues && gmg_eigenvalue_reuse_tolerance_ > 0. &&
+              gmg_smoother_n_cg_iter_ > 0) {
+            /*
+             * Estimate the eigenvalues right away (instead of in the
+             * first application of the smoother) and record them:
+             */
+            auto &cache = eigenvalue_cache_velocity_;
+            cache.scaling = scaling;
+            cache.max_eigenvalues.assign(level_matrix_free_.max_level() + 1,
+                                         0.);
+            for (unsigned int level = level_matrix_free_.min_level() + 1;
+                 level <= level_matrix_free_.max_level();
+                 ++level) {
+              LinearAlgebra::distributed::BlockVector<float> vector(dim);
+              for (unsigned int d = 0; d < dim; ++d)
+                level_matrix_free_[level].initialize_dof_vector(
+                    vector.block(d));
+              vector.collect_sizes();
+              const auto info =
+                  mg_smoother_velocity_[level].estimate_eigenvalues(vector);
+              cache.max_eigenvalues[level] = info.max_eigenvalue_estimate;
+            }
+          }
         }
 
         LIKWID_MARKER_STOP("time_step_parabolic_1");
@@ -451,57 +799,127 @@ namespace ryujin
         const auto tolerance_velocity =
             (tolerance_linfty_norm_ ? velocity_rhs_.linfty_norm()
                                     : velocity_rhs_.l2_norm()) *
-            tolerance_;
+            relative_tolerance;
 
         /*
-         * Multigrid might lack robustness for some cases, so in case it takes
-         * too many iterations we better switch to the more robust plain
-         * conjugate gradient method.
+         * Apply the explicit super time stepping scheme. Strongly enforced
+         * boundary values (and constrained degrees of freedom due to
+         * periodic boundary conditions) are left unchanged:
          */
-        try {
-          if (!use_gmg_velocity_)
-            throw SolverControl::NoConvergence(0, 0.);
-
-          using bvt_float = LinearAlgebra::distributed::BlockVector<float>;
-
-          MGCoarseGridApplySmoother<bvt_float> mg_coarse;
-          mg_coarse.initialize(mg_smoother_velocity_);
-
-          mg::Matrix<bvt_float> mg_matrix(level_velocity_matrices_);
-
-          Multigrid<bvt_float> mg(mg_matrix,
-                                  mg_coarse,
-                                  mg_transfer_velocity_,
-                                  mg_smoother_velocity_,
-                                  mg_smoother_velocity_,
-                                  level_velocity_matrices_.min_level(),
-                                  level_velocity_matrices_.max_level());
-
-          const auto &dof_handler = offline_data_->dof_handler();
-          PreconditionMG<dim, bvt_float, MGTransferVelocity<dim, float>>
-              preconditioner(dof_handler, mg, mg_transfer_velocity_);
-
-          SolverControl solver_control(gmg_max_iter_vel_, tolerance_velocity);
-          SolverCG<BlockVector> solver(solver_control);
-          solver.solve(
-              velocity_operator, velocity_, velocity_rhs_, preconditioner);
+        const auto constrain_velocity = [&](BlockVector &vector) {
+          for (auto entry : offline_data_->boundary_map()) {
+            // [i, normal, normal_mass, boundary_mass, id, position] = entry
+            const auto i = std::get<0>(entry);
+            if (i >= n_owned)
+              continue;
+
+            const auto normal = std::get<1>(entry);
+            const auto id = std::get<4>(entry);
+
+            if (id == Boundary::slip) {
+              Tensor<1, dim, Number> V_i;
+              for (unsigned int d = 0; d < dim; ++d)
+                V_i[d] = vector.block(d).local_element(i);
+              V_i -= 1. * (V_i * normal) * normal;
+              for (unsigned int d = 0; d < dim; ++d)
+                vector.block(d).local_element(i) = V_i[d];
+
+            } else if (id == Boundary::no_slip || id == Boundary::dirichlet) {
+              for (unsigned int d = 0; d < dim; ++d)
+                vector.block(d).local_element(i) = Number(0.);
+            }
+          }
+          for (unsigned int d = 0; d < dim; ++d)
+            affine_constraints.set_zero(vector.block(d));
+        };
 
+        const unsigned int n_stages =
+            explicit_super_time_stepping_
+                ? super_time_step(velocity_operator,
+                                  diagonal_matrix,
+                                  velocity_rhs_,
+                                  velocity_,
+                                  tau,
+                                  constrain_velocity,
+                                  explicit_eigenvalue_velocity_,
+                                  reinitialize_gmg)
+                : 0;
+
+        if (n_stages != 0) {
           /* update exponential moving average */
           n_iterations_velocity_ =
-              0.9 * n_iterations_velocity_ + 0.1 * solver_control.last_step();
-
-        } catch (SolverControl::NoConvergence &) {
-
-          SolverControl solver_control(1000, tolerance_velocity);
-          SolverCG<BlockVector> solver(solver_control);
-          solver.solve(
-              velocity_operator, velocity_, velocity_rhs_, diagonal_matrix);
+              0.9 * n_iterations_velocity_ + 0.1 * n_stages;
+
+        } else {
+          /*
+           * Multigrid might lack robustness for some cases, so in case it takes
+           * too many iterations we better switch to the more robust plain
+           * conjugate gradient method.
+           */
+          try {
+            if (!use_gmg_velocity_)
+              throw SolverControl::NoConvergence(0, 0.);
+
+            using bvt_float = LinearAlgebra::distributed::BlockVector<float>;
+
+            MGCoarseGridApplySmoother<bvt_float> mg_coarse;
+            mg_coarse.initialize(mg_smoother_velocity_);
+            const MGCoarseGridBase<bvt_float> *coarse_solver = &mg_coarse;
+#ifdef DEAL_II_WITH_TRILINOS
+            if (gmg_amg_coarse_solver_)
+              coarse_solver = &mg_coarse_amg_velocity_;
+#endif
 
-          /* update exponential moving average, counting also GMG iterations */
-          n_iterations_velocity_ *= 0.9;
-          n_iterations_velocity_ +=
-              0.1 * (use_gmg_velocity_ ? gmg_max_iter_vel_ : 0) +
-              0.1 * solver_control.last_step();
+            mg::Matrix<bvt_float> mg_matrix(level_velocity_matrices_);
+
+            Multigrid<bvt_float> mg(mg_matrix,
+                                    *coarse_solver,
+                                    mg_transfer_velocity_,
+                                    mg_smoother_velocity_,
+                                    mg_smoother_velocity_,
+                                    level_velocity_matrices_.min_level(),
+                                    level_velocity_matrices_.max_level());
+
+            const auto &dof_handler = offline_data_->dof_handler();
+            PreconditionMG<dim, bvt_float, MGTransferVelocity<dim, float>>
+                preconditioner(dof_handler, mg, mg_transfer_velocity_);
+
+            LevelTimer level_timer(level_times_velocity_);
+            if (gmg_level_timings_)
+              level_timer.connect(mg, level_velocity_matrices_.min_level());
+
+            SolverControl solver_control(gmg_max_iter_vel_, tolerance_velocity);
+            const auto solve = [&](auto &&solver) {
+              solver.solve(
+                  velocity_operator, velocity_, velocity_rhs_, preconditioner);
+            };
+            if (gmg_flexible_cg_)
+              solve(SolverFlexibleCG<BlockVector>(solver_control));
+            else
+              solve(SolverCG<BlockVector>(solver_control));
+
+            /* update exponential moving average */
+            n_iterations_velocity_ =
+                0.9 * n_iterations_velocity_ + 0.1 * solver_control.last_step();
+            n_saved_iterations_velocity_ =
+                0.9 * n_saved_iterations_velocity_ +
+                0.1 * saved_iterations(solver_control.last_step(),
+                                       relative_tolerance,
+                                       tolerance_);
+
+          } catch (SolverControl::NoConvergence &) {
+
+            SolverControl solver_control(1000, tolerance_velocity);
+            SolverCG<BlockVector> solver(solver_control);
+            solver.solve(
+                velocity_operator, velocity_, velocity_rhs_, diagonal_matrix);
+
+            /* update exponential moving average, counting GMG iterations */
+            n_iterations_velocity_ *= 0.9;
+            n_iterations_velocity_ +=
+                0.1 * (use_gmg_velocity_ ? gmg_max_iter_vel_ : 0) +
+                0.1 * solver_control.last_step();
+          }
         }
 
         LIKWID_MARKER_STOP("time_step_parabolic_1");
@@ -517,93 +935,148 @@ namespace ryujin
         LIKWID_MARKER_START("time_step_parabolic_2");
 
         /* Compute m_i K_i^{n+1/2}:  (5.5) */
-        matrix_free_.template cell_loop<ScalarVector, BlockVector>(
-            [this](const auto &data,
-                   auto &dst,
-                   const auto &src,
-                   const auto cell_range) {
-              FEEvaluation<dim, order_fe, order_quad, dim, Number> velocity(
-                  data);
-              FEEvaluation<dim, order_fe, order_quad, 1, Number> energy(data);
-
-              const auto mu = parabolic_system_->mu();
-              const auto lambda = parabolic_system_->lambda();
-
-              for (unsigned int cell = cell_range.first;
-                   cell < cell_range.second;
-                   ++cell) {
-                velocity.reinit(cell);
-                energy.reinit(cell);
-                velocity.gather_evaluate(src, EvaluationFlags::gradients);
-
-                for (unsigned int q = 0; q < velocity.n_q_points; ++q) {
-                  if constexpr (dim == 1) {
-                    /* Workaround: no symmetric gradient for dim == 1: */
-                    const auto gradient = velocity.get_gradient(q);
-                    auto S = (4. / 3. * mu + lambda) * gradient;
-                    energy.submit_value(gradient * S, q);
-
-                  } else {
-
-                    const auto symmetric_gradient =
-                        velocity.get_symmetric_gradient(q);
-                    const auto divergence = trace(symmetric_gradient);
-                    auto S = 2. * mu * symmetric_gradient;
-                    for (unsigned int d = 0; d < dim; ++d)
-                      S[d][d] += (lambda - 2. / 3. * mu) * divergence;
-                    energy.submit_value(symmetric_gradient * S, q);
-                  }
-                }
-                energy.integrate_scatter(EvaluationFlags::values, dst);
+        const auto cell_operation = [this](const auto &data,
+                                           auto &dst,
+                                           const auto &src,
+                                           const auto cell_range) {
+          FEEvaluation<dim, order_fe, order_quad, dim, Number> velocity(data);
+          FEEvaluation<dim, order_fe, order_quad, 1, Number> energy(data);
+
+          const auto mu = parabolic_system_->mu();
+          const auto lambda = parabolic_system_->lambda();
+
+          for (unsigned int cell = cell_range.first;
+               cell < cell_range.second;
+               ++cell) {
+            velocity.reinit(cell);
+            energy.reinit(cell);
+            velocity.gather_evaluate(src, EvaluationFlags::gradients);
+
+            for (unsigned int q = 0; q < velocity.n_q_points; ++q) {
+              if constexpr (dim == 1) {
+                /* Workaround: no symmetric gradient for dim == 1: */
+                const auto gradient = velocity.get_gradient(q);
+                auto S = (4. / 3. * mu + lambda) * gradient;
+                energy.submit_value(gradient * S, q);
+
+              } else {
+
+                const auto symmetric_gradient =
+                    velocity.get_symmetric_gradient(q);
+                const auto divergence = trace(symmetric_gradient);
+                auto S = 2. * mu * symmetric_gradient;
+                for (unsigned int d = 0; d < dim; ++d)
+                  S[d][d] += (lambda - 2. / 3. * mu) * divergence;
+                energy.submit_value(symmetric_gradient * S, q);
               }
-            },
-            internal_energy_rhs_,
-            velocity_,
-            /* zero destination */ true);
+            }
+            energy.integrate_scatter(EvaluationFlags::values, dst);
+          }
+        };
 
         const auto &lumped_mass_matrix = offline_data_->lumped_mass_matrix();
 
-        RYUJIN_PARALLEL_REGION_BEGIN
-
-        auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
+        /* Nodal update of the right hand side and the initial guess: */
+        const auto nodal_update = [&](auto sentinel, const unsigned int i) {
           using T = decltype(sentinel);
-          unsigned int stride_size = get_stride_size<T>;
 
           const auto view = hyperbolic_system_->template view<dim, T>();
 
-          RYUJIN_OMP_FOR
-          for (unsigned int i = left; i < right; i += stride_size) {
-            const auto rhs_i = get_entry<T>(internal_energy_rhs_, i);
-            const auto m_i = get_entry<T>(lumped_mass_matrix, i);
-            const auto rho_i = get_entry<T>(density_, i);
-            const auto e_i = get_entry<T>(internal_energy_, i);
-
-            const auto U_i = old_U.template get_tensor<T>(i);
-            const auto V_i = view.momentum(U_i) / rho_i;
+          const auto rhs_i = get_entry<T>(internal_energy_rhs_, i);
+          const auto m_i = get_entry<T>(lumped_mass_matrix, i);
+          const auto rho_i = get_entry<T>(density_, i);
+          const auto e_i = get_entry<T>(internal_energy_, i);
 
-            dealii::Tensor<1, dim, T> V_i_new;
-            for (unsigned int d = 0; d < dim; ++d) {
-              V_i_new[d] = get_entry<T>(velocity_.block(d), i);
-            }
+          const auto U_i = old_U.template get_tensor<T>(i);
+          const auto V_i = view.momentum(U_i) / rho_i;
 
-            /*
-             * For backward Euler we have to add this algebraic correction
-             * to ensure conservation of total energy.
-             */
-            const auto correction = Number(0.5) * (V_i - V_i_new).norm_square();
-
-            /* rhs_i contains already m_i K_i^{n+1/2} */
-            const auto result = m_i * rho_i * (e_i + correction) + tau * rhs_i;
-            write_entry<T>(internal_energy_rhs_, result, i);
+          dealii::Tensor<1, dim, T> V_i_new;
+          for (unsigned int d = 0; d < dim; ++d) {
+            V_i_new[d] = get_entry<T>(velocity_.block(d), i);
           }
-        };
 
-        /* Parallel non-vectorized loop: */
-        loop(Number(), n_regular, n_owned);
-        /* Parallel vectorized SIMD loop: */
-        loop(VA(), 0, n_regular);
+          /*
+           * For backward Euler we have to add this algebraic correction
+           * to ensure conservation of total energy.
+           */
+          const auto correction = Number(0.5) * (V_i - V_i_new).norm_square();
+
+          /* rhs_i contains already m_i K_i^{n+1/2} */
+          const auto result = m_i * rho_i * (e_i + correction) + tau * rhs_i;
+          write_entry<T>(internal_energy_rhs_, result, i);
+
+          /* Extrapolated initial guess: */
+          auto e_i_guess = e_i;
+          if (order >= 1)
+            e_i_guess += w_0 * get_entry<T>(internal_energy_rates_[0], i);
+          if (order == 2)
+            e_i_guess += w_1 * get_entry<T>(internal_energy_rates_[1], i);
+          write_entry<T>(internal_energy_, e_i_guess, i);
+        };
 
-        RYUJIN_PARALLEL_REGION_END
+        if (fused_energy_rhs_) {
+          /*
+           * Perform the nodal update within the cell loop on all index
+           * ranges of locally owned degrees of freedom as soon as all
+           * cell contributions to them have been computed. This avoids a
+           * second sweep over all vectors:
+           */
+          const auto before_loop = [&](const unsigned int begin,
+                                       const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              internal_energy_rhs_.local_element(i) = Number(0.);
+          };
+
+          const auto after_loop = [&](const unsigned int begin,
+                                      const unsigned int end) {
+            const unsigned int simd_begin = std::min(
+                end, (begin + simd_length - 1) / simd_length * simd_length);
+            const unsigned int simd_end =
+                std::max(simd_begin,
+                         std::min(end, n_regular) / simd_length * simd_length);
+
+            for (unsigned int i = begin; i < simd_begin; ++i)
+              nodal_update(Number(), i);
+            for (unsigned int i = simd_begin; i < simd_end; i += simd_length)
+              nodal_update(VA(), i);
+            for (unsigned int i = simd_end; i < end; ++i)
+              nodal_update(Number(), i);
+          };
+
+          matrix_free_.template cell_loop<ScalarVector, BlockVector>(
+              cell_operation,
+              internal_energy_rhs_,
+              velocity_,
+              before_loop,
+              after_loop);
+
+        } else {
+          matrix_free_.template cell_loop<ScalarVector, BlockVector>(
+              cell_operation,
+              internal_energy_rhs_,
+              velocity_,
+              /* zero destination */ true);
+
+          RYUJIN_PARALLEL_REGION_BEGIN
+
+          auto loop = [&](auto sentinel,
+                          unsigned int left,
+                          unsigned int right) {
+            using T = decltype(sentinel);
+            unsigned int stride_size = get_stride_size<T>;
+
+            RYUJIN_OMP_FOR
+            for (unsigned int i = left; i < right; i += stride_size)
+              nodal_update(sentinel, i);
+          };
+
+          /* Parallel non-vectorized loop: */
+          loop(Number(), n_regular, n_owned);
+          /* Parallel vectorized SIMD loop: */
+          loop(VA(), 0, n_regular);
+
+          RYUJIN_PARALLEL_REGION_END
+        }
 
         /*
          * Set up "strongly enforced" boundary conditions that are not stored
@@ -640,6 +1113,8 @@ namespace ryujin
          * the linear system.
          */
         affine_constraints.set_zero(internal_energy_rhs_);
+        if (order >= 1)
+          affine_constraints.set_zero(internal_energy_);
 
         /*
          * Update MG matrices all 4 time steps; this is a balance because more
@@ -656,6 +1131,10 @@ namespace ryujin
           level_energy_matrices_.resize(level_matrix_free_.min_level(),
                                         level_matrix_free_.max_level());
 
+          const double scaling = tau * parabolic_system_->cv_inverse_kappa();
+          const bool reuse_eigenvalues =
+              reuse_eigenvalue_estimates(eigenvalue_cache_energy_, scaling);
+
           for (unsigned int level = level_matrix_free_.min_level();
                level <= level_matrix_free_.max_level();
                ++level) {
@@ -678,9 +1157,40 @@ namespace ryujin
               smoother_data[level].smoothing_range = gmg_smoother_range_en_;
               if (gmg_smoother_n_cg_iter_ == 0)
                 smoother_data[level].max_eigenvalue = gmg_smoother_max_eig_en_;
+              if (reuse_eigenvalues) {
+                smoother_data[level].eig_cg_n_iterations = 0;
+                smoother_data[level].max_eigenvalue =
+                    eigenvalue_cache_energy_.max_eigenvalues[level];
+              }
             }
           }
           mg_smoother_energy_.initialize(level_energy_matrices_, smoother_data);
+
+#ifdef DEAL_II_WITH_TRILINOS
+          if (gmg_amg_coarse_solver_) {
+            const bool reuse = coarse_matrix_energy_.m() != 0;
+            level_energy_matrices_[level_matrix_free_.min_level()]
+                .compute_sparse_matrix(coarse_matrix_energy_);
+            mg_coarse_amg_energy_.initialize(coarse_matrix_energy_, reuse);
+          }
+#endif
+
+          if (!reuse_eigenvalues && gmg_eigenvalue_reuse_tolerance_ > 0. &&
+              gmg_smoother_n_cg_iter_ > 0) {
+            auto &cache = eigenvalue_cache_energy_;
+            cache.scaling = scaling;
+            cache.max_eigenvalues.assign(level_matrix_free_.max_level() + 1,
+                                         0.);
+            for (unsigned int level = level_matrix_free_.min_level() + 1;
+                 level <= level_matrix_free_.max_level();
+                 ++level) {
+              LinearAlgebra::distributed::Vector<float> vector;
+              level_matrix_free_[level].initialize_dof_vector(vector);
+              const auto info =
+                  mg_smoother_energy_[level].estimate_eigenvalues(vector);
+              cache.max_eigenvalues[level] = info.max_eigenvalue_estimate;
+            }
+          }
         }
 
         LIKWID_MARKER_STOP("time_step_parabolic_2");
@@ -703,55 +1213,103 @@ namespace ryujin
         const auto tolerance_internal_energy =
             (tolerance_linfty_norm_ ? internal_energy_rhs_.linfty_norm()
                                     : internal_energy_rhs_.l2_norm()) *
-            tolerance_;
-
-        try {
-          if (!use_gmg_internal_energy_)
-            throw SolverControl::NoConvergence(0, 0.);
-
-          using vt_float = LinearAlgebra::distributed::Vector<float>;
-          MGCoarseGridApplySmoother<vt_float> mg_coarse;
-          mg_coarse.initialize(mg_smoother_energy_);
-          mg::Matrix<vt_float> mg_matrix(level_energy_matrices_);
-
-          Multigrid<vt_float> mg(mg_matrix,
-                                 mg_coarse,
-                                 mg_transfer_energy_,
-                                 mg_smoother_energy_,
-                                 mg_smoother_energy_,
-                                 level_energy_matrices_.min_level(),
-                                 level_energy_matrices_.max_level());
-
-          const auto &dof_handler = offline_data_->dof_handler();
-          PreconditionMG<dim, vt_float, MGTransferEnergy<dim, float>>
-              preconditioner(dof_handler, mg, mg_transfer_energy_);
-
-          SolverControl solver_control(gmg_max_iter_en_,
-                                       tolerance_internal_energy);
-          SolverCG<ScalarVector> solver(solver_control);
-          solver.solve(energy_operator,
-                       internal_energy_,
-                       internal_energy_rhs_,
-                       preconditioner);
+            relative_tolerance;
 
+        const auto constrain_energy = [&](ScalarVector &vector) {
+          for (auto entry : offline_data_->boundary_map()) {
+            const auto i = std::get<0>(entry);
+            if (i < n_owned && std::get<4>(entry) == Boundary::dirichlet)
+              vector.local_element(i) = Number(0.);
+          }
+          affine_constraints.set_zero(vector);
+        };
+
+        const unsigned int n_stages =
+            explicit_super_time_stepping_
+                ? super_time_step(energy_operator,
+                                  diagonal_matrix,
+                                  internal_energy_rhs_,
+                                  internal_energy_,
+                                  tau,
+                                  constrain_energy,
+                                  explicit_eigenvalue_energy_,
+                                  reinitialize_gmg)
+                : 0;
+
+        if (n_stages != 0) {
           /* update exponential moving average */
-          n_iterations_internal_energy_ = 0.9 * n_iterations_internal_energy_ +
-                                          0.1 * solver_control.last_step();
-
-        } catch (SolverControl::NoConvergence &) {
-
-          SolverControl solver_control(1000, tolerance_internal_energy);
-          SolverCG<ScalarVector> solver(solver_control);
-          solver.solve(energy_operator,
-                       internal_energy_,
-                       internal_energy_rhs_,
-                       diagonal_matrix);
-
-          /* update exponential moving average, counting also GMG iterations */
-          n_iterations_internal_energy_ *= 0.9;
-          n_iterations_internal_energy_ +=
-              0.1 * (use_gmg_internal_energy_ ? gmg_max_iter_en_ : 0) +
-              0.1 * solver_control.last_step();
+          n_iterations_internal_energy_ =
+              0.9 * n_iterations_internal_energy_ + 0.1 * n_stages;
+
+        } else {
+          try {
+            if (!use_gmg_internal_energy_)
+              throw SolverControl::NoConvergence(0, 0.);
+
+            using vt_float = LinearAlgebra::distributed::Vector<float>;
+            MGCoarseGridApplySmoother<vt_float> mg_coarse;
+            mg_coarse.initialize(mg_smoother_energy_);
+            const MGCoarseGridBase<vt_float> *coarse_solver = &mg_coarse;
+#ifdef DEAL_II_WITH_TRILINOS
+            if (gmg_amg_coarse_solver_)
+              coarse_solver = &mg_coarse_amg_energy_;
+#endif
+            mg::Matrix<vt_float> mg_matrix(level_energy_matrices_);
+
+            Multigrid<vt_float> mg(mg_matrix,
+                                   *coarse_solver,
+                                   mg_transfer_energy_,
+                                   mg_smoother_energy_,
+                                   mg_smoother_energy_,
+                                   level_energy_matrices_.min_level(),
+                                   level_energy_matrices_.max_level());
+
+            const auto &dof_handler = offline_data_->dof_handler();
+            PreconditionMG<dim, vt_float, MGTransferEnergy<dim, float>>
+                preconditioner(dof_handler, mg, mg_transfer_energy_);
+
+            LevelTimer level_timer(level_times_energy_);
+            if (gmg_level_timings_)
+              level_timer.connect(mg, level_energy_matrices_.min_level());
+
+            SolverControl solver_control(gmg_max_iter_en_,
+                                         tolerance_internal_energy);
+            const auto solve = [&](auto &&solver) {
+              solver.solve(energy_operator,
+                           internal_energy_,
+                           internal_energy_rhs_,
+                           preconditioner);
+            };
+            if (gmg_flexible_cg_)
+              solve(SolverFlexibleCG<ScalarVector>(solver_control));
+            else
+              solve(SolverCG<ScalarVector>(solver_control));
+
+            /* update exponential moving average */
+            n_iterations_internal_energy_ =
+                0.9 * n_iterations_internal_energy_ +
+                0.1 * solver_control.last_step();
+            n_saved_iterations_internal_energy_ =
+                0.9 * n_saved_iterations_internal_energy_ +
+                0.1 * saved_iterations(solver_control.last_step(),
+                                       relative_tolerance,
+                                       tolerance_);
+
+          } catch (SolverControl::NoConvergence &) {
+
+            SolverControl solver_control(1000, tolerance_internal_energy);
+            SolverCG<ScalarVector> solver(solver_control);
+            solver.solve(energy_operator,
+                         internal_energy_,
+                         internal_energy_rhs_,
+                         diagonal_matrix);
+
+            /* update exponential moving average, counting GMG iterations */
+            n_iterations_internal_energy_ *= 0.9;
+            n_iterations_internal_energy_ +=
+                0.1 * (use_gmg_internal_energy_ ? gmg_max_iter_en_ : 0) +
+                0.1 * solver_control.last_step();
+          }
         }
 
         /*
@@ -791,6 +1349,19 @@ namespace ryujin
       {
         Scope scope(computing_timer_, "time step [P] 3 - write back vectors");
 
+        /*
+         * Record the rates of change for the extrapolation of the initial
+         * guess, but only if the step is accepted:
+         */
+        const bool record_rates = extrapolation_order_ > 0 && !restart_needed;
+        if (record_rates) {
+          if (extrapolation_order_ == 2) {
+            velocity_rates_[1].swap(velocity_rates_[0]);
+            internal_energy_rates_[1].swap(internal_energy_rates_[0]);
+          }
+          n_rates_ = std::min(n_rates_ + 1, extrapolation_order_);
+        }
+
         RYUJIN_PARALLEL_REGION_BEGIN
         LIKWID_MARKER_START("time_step_parabolic_3");
 
@@ -814,6 +1385,20 @@ namespace ryujin
 
             const auto E_i_new = rho_e_i_new + 0.5 * m_i_new * m_i_new / rho_i;
 
+            if (record_rates) {
+              const auto tau_inverse = Number(1.) / tau;
+              for (unsigned int d = 0; d < dim; ++d) {
+                const auto rate = (m_i_new[d] - U_i[1 + d]) / rho_i;
+                write_entry<T>(
+                    velocity_rates_[0].block(d), tau_inverse * rate, i);
+              }
+              const auto e_i = view.internal_energy(U_i) / rho_i;
+              const auto e_i_new = get_entry<T>(internal_energy_, i);
+              write_entry<T>(internal_energy_rates_[0],
+                             tau_inverse * (e_i_new - e_i),
+                             i);
+            }
+
             for (unsigned int d = 0; d < dim; ++d)
               U_i[1 + d] = m_i_new[d];
             U_i[1 + dim] = E_i_new;
@@ -848,6 +1433,146 @@ namespace ryujin
     }
 
 
+    template <typename Description, int dim, typename Number>
+    template <typename Operator, typename VectorType, typename Constrain>
+    unsigned int ParabolicSolver<Description, dim, Number>::super_time_step(
+        const Operator &op,
+        const DiagonalMatrix<dim, Number> &diagonal,
+        const VectorType &rhs,
+        VectorType &solution,
+        const Number tau,
+        const Constrain &constrain,
+        Number &eigenvalue,
+        const bool update_eigenvalue) const
+    {
+      /*
+       * The implicit system A x^{n+1} = b, with A = M rho + tau B and
+       * b = M rho x^n + tau g, is the backward Euler discretization of the
+       * ODE system M rho x' = g - B x. Its (scaled) right hand side can be
+       * expressed with the residual of the implicit system:
+       *
+       *   tau L(y) = D (b - A y) + y - x^n,  D = (M rho)^{-1}.
+       *
+       * As A y = y for all strongly enforced boundary values this leaves
+       * the boundary values of x^n unchanged.
+       */
+
+      const VectorType x_n(solution);
+      VectorType temp(solution);
+
+      const auto apply_L = [&](VectorType &dst, const VectorType &y) {
+        op.vmult(temp, y);
+        temp.sadd(-1., 1., rhs);
+        diagonal.vmult(dst, temp);
+        dst.add(1., y, -1., x_n);
+      };
+
+      /*
+       * Estimate the largest eigenvalue of tau D B = 1 - D A with a few
+       * steps of a power iteration on the subspace of vectors with
+       * vanishing boundary values. The estimate is stored normalized by
+       * tau and only updated if requested:
+       */
+
+      if (update_eigenvalue || eigenvalue == Number(0.)) {
+        VectorType v(solution);
+        const auto pseudo_random = [](const unsigned int i) {
+          return Number((i * 2654435761u) % 1024u) / Number(512.) - Number(1.);
+        };
+        if constexpr (std::is_same_v<VectorType, BlockVector>) {
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int i = 0; i < v.block(d).locally_owned_size(); ++i)
+              v.block(d).local_element(i) = pseudo_random(dim * i + d);
+        } else {
+          for (unsigned int i = 0; i < v.locally_owned_size(); ++i)
+            v.local_element(i) = pseudo_random(i);
+        }
+        constrain(v);
+        v /= v.l2_norm();
+
+        double lambda = 0.;
+        for (unsigned int k = 0; k < 10; ++k) {
+          op.vmult(temp, v);
+          VectorType z(v);
+          diagonal.vmult(z, temp);
+          z.sadd(-1., 1., v);
+          constrain(z);
+          lambda = z.l2_norm();
+          v.equ(1. / lambda, z);
+        }
+
+        /* Include a safety factor since the iteration is not converged: */
+        eigenvalue = Number(1.2 * lambda / tau);
+      }
+
+      /*
+       * The RKL2 scheme with s stages is stable for tau <= tau_fe (s^2 + s
+       * - 2) / 4 where tau_fe = 2 / lambda_max is the stability limit of
+       * the explicit Euler scheme:
+       */
+
+      const double ratio = 0.5 * eigenvalue * tau;
+      const unsigned int n_stages = std::max(
+          2u,
+          static_cast<unsigned int>(
+              std::ceil(0.5 * (std::sqrt(9. + 16. * ratio) - 1.))));
+
+      if (n_stages > super_time_stepping_max_stages_)
+        return 0;
+
+      /*
+       * Perform the RKL2 stages, see Meyer, Balsara, Aslam, J. Comput.
+       * Phys. 257 (2014), Eq. 16 and following:
+       */
+
+      const double s = n_stages;
+      const double w_1 = 4. / (s * s + s - 2.);
+      const auto b = [](const double j) {
+        return j < 2. ? 1. / 3. : (j * j + j - 2.) / (2. * j * (j + 1.));
+      };
+
+      VectorType L_0(solution);
+      apply_L(L_0, x_n);
+
+      VectorType y_jm2(x_n);
+      VectorType y_jm1(x_n);
+      y_jm1.add(b(1.) * w_1, L_0);
+
+      VectorType L_jm1(solution);
+      for (unsigned int k = 2; k <= n_stages; ++k) {
+        const double j = k;
+        const double mu = (2. * j - 1.) / j * b(j) / b(j - 1.);
+        const double nu = -(j - 1.) / j * b(j) / b(j - 2.);
+        const double mu_tilde = mu * w_1;
+        const double gamma_tilde = -(1. - b(j - 1.)) * mu_tilde;
+
+        apply_L(L_jm1, y_jm1);
+        y_jm2.sadd(nu, mu, y_jm1);
+        y_jm2.add(1. - mu - nu, x_n, mu_tilde, L_jm1);
+        y_jm2.add(gamma_tilde, L_0);
+        y_jm2.swap(y_jm1);
+      }
+
+      solution.swap(y_jm1);
+      return n_stages;
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    bool ParabolicSolver<Description, dim, Number>::reuse_eigenvalue_estimates(
+        const EigenvalueCache &cache, const double scaling) const
+    {
+      if (gmg_eigenvalue_reuse_tolerance_ <= 0. || gmg_smoother_n_cg_iter_ == 0)
+        return false;
+
+      if (cache.max_eigenvalues.size() != level_matrix_free_.max_level() + 1)
+        return false;
+
+      return std::abs(scaling - cache.scaling) <=
+             gmg_eigenvalue_reuse_tolerance_ * std::abs(cache.scaling);
+    }
+
+
     template <typename Description, int dim, typename Number>
     void ParabolicSolver<Description, dim, Number>::print_solver_statistics(
         std::ostream &output) const
@@ -858,6 +1583,54 @@ namespace ryujin
              << n_iterations_internal_energy_
              << (use_gmg_internal_energy_ ? " GMG int ]" : " CG int ]")
              << std::endl;
+
+      if (adaptive_tolerance_factor_ > 0.)
+        output << "        [ " << std::setprecision(2) << std::fixed
+               << n_saved_iterations_velocity_ << " vel -- "
+               << n_saved_iterations_internal_energy_
+               << " int iterations saved by adaptive tolerance (est.) ]"
+               << std::endl;
+
+      if (!gmg_level_timings_)
+        return;
+
+      const auto print_level_times = [&](const std::string &name,
+                                         const std::vector<double> &times) {
+        output << "        [ " << name << " level times [s]:";
+        for (unsigned int level = 0; level < times.size(); ++level)
+          if (times[level] > 0.)
+            output << " L" << level << " " << std::setprecision(2)
+                   << std::scientific << times[level];
+        output << " ]" << std::endl;
+      };
+
+      if (use_gmg_velocity_)
+        print_level_times("GMG vel", level_times_velocity_);
+      if (use_gmg_internal_energy_)
+        print_level_times("GMG int", level_times_energy_);
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    std::size_t
+    ParabolicSolver<Description, dim, Number>::memory_consumption() const
+    {
+      std::size_t result = matrix_free_.memory_consumption();
+
+      result += velocity_.memory_consumption();
+      result += velocity_rhs_.memory_consumption();
+      result += internal_energy_.memory_consumption();
+      result += internal_energy_rhs_.memory_consumption();
+      result += density_.memory_consumption();
+      for (const auto &it : velocity_rates_)
+        result += it.memory_consumption();
+      for (const auto &it : internal_energy_rates_)
+        result += it.memory_consumption();
+
+      result += level_matrix_free_.memory_consumption();
+      result += level_density_.memory_consumption();
+
+      return result;
     }
 
   } // namespace NavierStokes
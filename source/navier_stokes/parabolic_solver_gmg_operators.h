@@ -17,6 +17,12 @@
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/multigrid/mg_base.h>
 #include <deal.II/multigrid/mg_transfer_matrix_free.h>
+#ifdef DEAL_II_WITH_TRILINOS
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/trilinos_precondition.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/lac/trilinos_sparsity_pattern.h>
+#endif
 
 /*
  * FIXME: generalize and make these operators equation independent and
@@ -29,6 +35,245 @@ namespace ryujin
   {
     using HyperbolicSystem = Euler::HyperbolicSystem;
 
+#ifdef DEAL_II_WITH_TRILINOS
+    /**
+     * Assemble the level operator \f$m_i\rho_i\delta_{ij} + B_{ij}\f$
+     * described by the local (cell) operator @p apply_local_operator into
+     * a (double precision) Trilinos sparse matrix. The @p n_components
+     * components of every degree of freedom are numbered consecutively,
+     * i.e., component c of degree of freedom i is stored in row
+     * n_components * i + c.
+     *
+     * The local matrices are computed column by column by applying the
+     * local operator to unit vectors (similarly to the computation of
+     * the diagonal in VelocityMatrix::compute_diagonal()). If @p matrix
+     * is already initialized its sparsity pattern is reused and only the
+     * matrix entries are recomputed.
+     *
+     * @ingroup NavierStokesEquations
+     */
+    template <int n_components,
+              int dim,
+              typename Number,
+              typename LocalOperator>
+    void assemble_level_matrix(
+        const dealii::MatrixFree<dim, Number> &matrix_free,
+        const dealii::LinearAlgebra::distributed::Vector<Number>
+            &lumped_mass_matrix,
+        const dealii::LinearAlgebra::distributed::Vector<Number> &density,
+        const LocalOperator &apply_local_operator,
+        dealii::TrilinosWrappers::SparseMatrix &matrix)
+    {
+      using size_type = dealii::types::global_dof_index;
+      constexpr unsigned int order_fe = 1;
+      constexpr unsigned int order_quad = 2;
+
+      const unsigned int level = matrix_free.get_mg_level();
+      Assert(level != dealii::numbers::invalid_unsigned_int,
+             dealii::ExcNotImplemented());
+
+      const auto &partitioner = matrix_free.get_dof_info(0).vector_partitioner;
+      const auto &lexicographic =
+          matrix_free.get_shape_info().lexicographic_numbering;
+      const unsigned int n_dofs_scalar = lexicographic.size();
+
+      /*
+       * Return the (interleaved) global indices of all local degrees of
+       * freedom of a given lane of a cell batch in the order used by
+       * FEEvaluation:
+       */
+      std::vector<size_type> dof_indices(n_dofs_scalar);
+      std::vector<size_type> indices(n_components * n_dofs_scalar);
+      const auto get_indices = [&](const unsigned int cell,
+                                   const unsigned int lane) {
+        const auto it = matrix_free.get_cell_iterator(cell, lane);
+        it->get_mg_dof_indices(dof_indices);
+        for (unsigned int c = 0; c < n_components; ++c)
+          for (unsigned int i = 0; i < n_dofs_scalar; ++i)
+            indices[c * n_dofs_scalar + i] =
+                n_components * dof_indices[lexicographic[i]] + c;
+      };
+
+      if (matrix.m() == 0) {
+        const auto interleave = [](const dealii::IndexSet &index_set) {
+          dealii::IndexSet result(n_components * index_set.size());
+          for (const auto i : index_set)
+            for (unsigned int c = 0; c < n_components; ++c)
+              result.add_index(n_components * i + c);
+          result.compress();
+          return result;
+        };
+
+        dealii::IndexSet relevant = partitioner->locally_owned_range();
+        relevant.add_indices(partitioner->ghost_indices());
+        const auto owned = interleave(partitioner->locally_owned_range());
+
+        dealii::TrilinosWrappers::SparsityPattern sparsity(
+            owned,
+            owned,
+            interleave(relevant),
+            partitioner->get_mpi_communicator());
+
+        for (unsigned int cell = 0; cell < matrix_free.n_cell_batches();
+             ++cell)
+          for (unsigned int lane = 0;
+               lane < matrix_free.n_active_entries_per_cell_batch(cell);
+               ++lane) {
+            get_indices(cell, lane);
+            for (const auto row : indices)
+              sparsity.add_entries(row, indices.begin(), indices.end());
+          }
+
+        sparsity.compress();
+        matrix.reinit(sparsity);
+
+      } else {
+        matrix = 0.;
+      }
+
+      /* Add the cell contributions: */
+
+      using VA = dealii::VectorizedArray<Number>;
+
+      dealii::FEEvaluation<dim, order_fe, order_quad, n_components, Number>
+          phi(matrix_free);
+      const unsigned int dofs_per_cell = phi.dofs_per_cell;
+
+      std::array<dealii::FullMatrix<double>, VA::size()> local_matrices;
+      for (auto &local_matrix : local_matrices)
+        local_matrix.reinit(dofs_per_cell, dofs_per_cell);
+      std::vector<double> row_values(dofs_per_cell);
+
+      for (unsigned int cell = 0; cell < matrix_free.n_cell_batches();
+           ++cell) {
+        phi.reinit(cell);
+        const unsigned int n_lanes =
+            matrix_free.n_active_entries_per_cell_batch(cell);
+
+        for (unsigned int j = 0; j < dofs_per_cell; ++j) {
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            phi.begin_dof_values()[i] = VA();
+          phi.begin_dof_values()[j] = dealii::make_vectorized_array<Number>(1.);
+          apply_local_operator(phi);
+          for (unsigned int lane = 0; lane < n_lanes; ++lane)
+            for (unsigned int i = 0; i < dofs_per_cell; ++i)
+              local_matrices[lane](i, j) = phi.begin_dof_values()[i][lane];
+        }
+
+        for (unsigned int lane = 0; lane < n_lanes; ++lane) {
+          get_indices(cell, lane);
+          for (unsigned int i = 0; i < dofs_per_cell; ++i) {
+            for (unsigned int j = 0; j < dofs_per_cell; ++j)
+              row_values[j] = local_matrices[lane](i, j);
+            matrix.add(indices[i], indices, row_values);
+          }
+        }
+      }
+
+      /* Add the lumped mass matrix contribution m_i rho_i: */
+
+      const unsigned int n_owned = partitioner->locally_owned_size();
+      for (unsigned int i = 0; i < n_owned; ++i) {
+        const auto global_i = partitioner->local_to_global(i);
+        const double value =
+            lumped_mass_matrix.local_element(i) * density.local_element(i);
+        for (unsigned int c = 0; c < n_components; ++c)
+          matrix.add(n_components * global_i + c,
+                     n_components * global_i + c,
+                     value);
+      }
+
+      matrix.compress(dealii::VectorOperation::add);
+    }
+
+
+    /**
+     * A coarse grid solver for the GMG V-cycle that applies one cycle of
+     * an algebraic multigrid preconditioner (Trilinos ML) to an assembled
+     * level matrix as created by assemble_level_matrix().
+     *
+     * The AMG hierarchy is set up in initialize(). If @p reuse is set to
+     * true and the preconditioner was already set up for the same matrix
+     * object (with an unchanged sparsity pattern), only the numerical
+     * values of the hierarchy are recomputed.
+     *
+     * @ingroup NavierStokesEquations
+     */
+    template <typename VectorType, int n_components>
+    class MGCoarseGridAMG : public dealii::MGCoarseGridBase<VectorType>
+    {
+    public:
+      void initialize(const dealii::TrilinosWrappers::SparseMatrix &matrix,
+                      const bool reuse)
+      {
+        if (reuse && initialized_) {
+          preconditioner_.reinit();
+          return;
+        }
+
+        const auto &owned = matrix.locally_owned_range_indices();
+
+        dealii::TrilinosWrappers::PreconditionAMG::AdditionalData data;
+        data.elliptic = true;
+        data.higher_order_elements = false;
+        data.smoother_sweeps = 2;
+        data.aggregation_threshold = 0.02;
+        data.constant_modes.assign(
+            n_components, std::vector<bool>(owned.n_elements(), false));
+        for (unsigned int k = 0; k < owned.n_elements(); ++k)
+          data.constant_modes[owned.nth_index_in_set(k) % n_components][k] =
+              true;
+
+        preconditioner_.initialize(matrix, data);
+        initialized_ = true;
+
+        src_.reinit(owned, matrix.get_mpi_communicator());
+        dst_.reinit(owned, matrix.get_mpi_communicator());
+      }
+
+      void clear()
+      {
+        preconditioner_.clear();
+        initialized_ = false;
+      }
+
+      void operator()(const unsigned int /*level*/,
+                      VectorType &dst,
+                      const VectorType &src) const override
+      {
+        const auto component = [](auto &vector,
+                                  const unsigned int c) -> auto & {
+          if constexpr (n_components == 1)
+            return vector;
+          else
+            return vector.block(c);
+        };
+
+        const unsigned int n_owned =
+            component(src, 0).get_partitioner()->locally_owned_size();
+
+        for (unsigned int i = 0; i < n_owned; ++i)
+          for (unsigned int c = 0; c < n_components; ++c)
+            src_.local_element(n_components * i + c) =
+                component(src, c).local_element(i);
+
+        preconditioner_.vmult(dst_, src_);
+
+        for (unsigned int i = 0; i < n_owned; ++i)
+          for (unsigned int c = 0; c < n_components; ++c)
+            component(dst, c).local_element(i) =
+                dst_.local_element(n_components * i + c);
+      }
+
+    private:
+      dealii::TrilinosWrappers::PreconditionAMG preconditioner_;
+      bool initialized_ = false;
+
+      mutable dealii::LinearAlgebra::distributed::Vector<double> src_;
+      mutable dealii::LinearAlgebra::distributed::Vector<double> dst_;
+    };
+#endif
+
     /**
      * A diagonal matrix used as a preconditioner for the non-multigrid CG
      * iteration. The diagonal matrix is constructed by computing
@@ -393,6 +638,84 @@ namespace ryujin
         }
       }
 
+#ifdef DEAL_II_WITH_TRILINOS
+      /**
+       * Assemble the level operator into a Trilinos sparse matrix (with
+       * interleaved velocity components, see assemble_level_matrix())
+       * including the modifications for slip, no slip and Dirichlet
+       * boundary conditions performed in vmult().
+       */
+      void compute_sparse_matrix(
+          dealii::TrilinosWrappers::SparseMatrix &matrix) const
+      {
+        Assert(level_ != dealii::numbers::invalid_unsigned_int,
+               dealii::ExcNotImplemented());
+
+        assemble_level_matrix<dim>(
+            *matrix_free_,
+            offline_data_->level_lumped_mass_matrix()[level_],
+            *density_,
+            [this](auto &velocity) { apply_local_operator(velocity); },
+            matrix);
+
+        const auto &partitioner =
+            matrix_free_->get_dof_info(0).vector_partitioner;
+        const unsigned int n_owned = partitioner->locally_owned_size();
+
+        const auto &boundary_map = offline_data_->level_boundary_map()[level_];
+
+        for (auto entry : boundary_map) {
+          // [i, normal, normal_mass, boundary_mass, id, position] = entry
+          const auto i = std::get<0>(entry);
+          if (i >= n_owned)
+            continue;
+
+          const auto global_i = partitioner->local_to_global(i);
+          const dealii::Tensor<1, dim, double> normal = std::get<1>(entry);
+          const auto id = std::get<4>(entry);
+
+          if (id == Boundary::slip) {
+            /*
+             * Replace the normal component of the rows associated with
+             * i by the normal component of the identity:
+             */
+            std::vector<dealii::types::global_dof_index> columns;
+            for (auto it = matrix.begin(dim * global_i);
+                 it != matrix.end(dim * global_i);
+                 ++it)
+              columns.push_back(it->column());
+
+            std::array<std::vector<double>, dim> rows;
+            for (unsigned int d = 0; d < dim; ++d) {
+              rows[d].resize(columns.size());
+              for (unsigned int k = 0; k < columns.size(); ++k)
+                rows[d][k] = matrix.el(dim * global_i + d, columns[k]);
+            }
+
+            for (unsigned int d = 0; d < dim; ++d) {
+              std::vector<double> values(columns.size());
+              for (unsigned int k = 0; k < columns.size(); ++k) {
+                for (unsigned int e = 0; e < dim; ++e) {
+                  values[k] += ((d == e ? 1. : 0.) - normal[d] * normal[e]) *
+                               rows[e][k];
+                  if (columns[k] == dim * global_i + e)
+                    values[k] += normal[d] * normal[e];
+                }
+              }
+              matrix.set(dim * global_i + d, columns, values);
+            }
+
+          } else if (id == Boundary::no_slip || id == Boundary::dirichlet) {
+
+            for (unsigned int d = 0; d < dim; ++d)
+              matrix.clear_row(dim * global_i + d, 1.);
+          }
+        }
+
+        matrix.compress(dealii::VectorOperation::insert);
+      }
+#endif
+
     private:
       const ParabolicSystem *parabolic_system_;
       const OfflineData<dim, Number2> *offline_data_;
@@ -739,6 +1062,45 @@ namespace ryujin
         }
       }
 
+#ifdef DEAL_II_WITH_TRILINOS
+      /**
+       * Assemble the level operator into a Trilinos sparse matrix (see
+       * assemble_level_matrix()) including the modification for
+       * Dirichlet boundary conditions performed in vmult().
+       */
+      void compute_sparse_matrix(
+          dealii::TrilinosWrappers::SparseMatrix &matrix) const
+      {
+        Assert(level_ != dealii::numbers::invalid_unsigned_int,
+               dealii::ExcNotImplemented());
+
+        assemble_level_matrix<1>(
+            *matrix_free_,
+            offline_data_->level_lumped_mass_matrix()[level_],
+            *density_,
+            [this](auto &energy) { apply_local_operator(energy); },
+            matrix);
+
+        const auto &partitioner =
+            matrix_free_->get_dof_info(0).vector_partitioner;
+        const unsigned int n_owned = partitioner->locally_owned_size();
+
+        const auto &boundary_map = offline_data_->level_boundary_map()[level_];
+
+        for (auto entry : boundary_map) {
+          const auto i = std::get<0>(entry);
+          if (i >= n_owned)
+            continue;
+
+          const auto id = std::get<4>(entry);
+          if (id == Boundary::dirichlet)
+            matrix.clear_row(partitioner->local_to_global(i), 1.);
+        }
+
+        matrix.compress(dealii::VectorOperation::insert);
+      }
+#endif
+
     private:
       const OfflineData<dim, Number2> *offline_data_;
       const dealii::MatrixFree<dim, Number> *matrix_free_;
@@ -10,6 +10,7 @@
 #include "simd.h"
 
 #include <array>
+#include <atomic>
 
 namespace ryujin
 {
@@ -102,4 +103,56 @@ namespace ryujin
 
   //@}
 
+
+  /**
+   * A thread-safe histogram of the number of (Newton and bisection)
+   * iterations that an iterative solver needed. Bin k counts the solves
+   * that took k iterations; the last bin collects all solves that took
+   * at least n_bins - 1 iterations.
+   *
+   * Solvers are expected to accumulate their counts locally and only
+   * record() them once, for example in their destructor.
+   *
+   * @ingroup Miscellenaous
+   */
+  class IterationHistogram
+  {
+  public:
+    static constexpr unsigned int n_bins = 8;
+
+    using Counts = std::array<unsigned long, n_bins>;
+
+    /**
+     * Return the bin for a solve that took @p n_iterations iterations.
+     */
+    static unsigned int bin(unsigned int n_iterations)
+    {
+      return n_iterations < n_bins ? n_iterations : n_bins - 1;
+    }
+
+    /**
+     * Add locally accumulated @p counts to the histogram.
+     */
+    void record(const Counts &counts) const
+    {
+      for (unsigned int k = 0; k < n_bins; ++k)
+        if (counts[k] != 0)
+          counts_[k] += counts[k];
+    }
+
+    /**
+     * Return the current counts of all bins.
+     */
+    Counts counts() const
+    {
+      Counts result;
+      for (unsigned int k = 0; k < n_bins; ++k)
+        result[k] = counts_[k];
+      return result;
+    }
+
+  private:
+    mutable std::array<std::atomic<unsigned long>, n_bins> counts_{};
+  };
+
 } /* namespace ryujin */
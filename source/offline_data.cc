@@ -12,4 +12,10 @@ namespace ryujin
   template class OfflineData<2, NUMBER>;
   template class OfflineData<3, NUMBER>;
 
+#ifdef RUNTIME_PRECISION
+  template class OfflineData<1, ALTERNATIVE_NUMBER>;
+  template class OfflineData<2, ALTERNATIVE_NUMBER>;
+  template class OfflineData<3, ALTERNATIVE_NUMBER>;
+#endif
+
 } /* namespace ryujin */
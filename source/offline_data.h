@@ -9,6 +9,8 @@
 
 #include "convenience_macros.h"
 #include "discretization.h"
+#include "lazy.h"
+#include "patterns_conversion.h"
 #include "sparse_matrix_simd.h"
 #include "state_vector.h"
 
@@ -22,8 +24,39 @@
 
 #include <deal.II/numerics/data_out.h>
 
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace ryujin
 {
+  /**
+   * Strategy used for renumbering the locally owned degrees of freedom
+   * before the export and SIMD-stride grouping is applied.
+   *
+   * @ingroup Mesh
+   */
+  enum class DoFRenumberingStrategy {
+    /**
+     * Reverse bandwidth minimization with the Cuthill-McKee algorithm.
+     */
+    cuthill_mckee,
+
+    /**
+     * Number degrees of freedom by a hierarchical (Z-order) traversal of
+     * the locally owned cells.
+     */
+    hierarchical,
+
+    /**
+     * Sort degrees of freedom along a Morton space filling curve of their
+     * support cells.
+     */
+    morton,
+  };
+
   /**
    * A class to store all data that can be precomputed offline.
    *
@@ -58,6 +91,42 @@ namespace ryujin
      */
     using ScalarVectorFloat = Vectors::ScalarVector<float>;
 
+    /**
+     * The floating point type used for storing the precomputed matrices
+     * (mass matrix, inverse mass matrix, \f$(c_{ij})\f$ matrix, and the
+     * incidence matrix). If the compile-time option
+     * SINGLE_PRECISION_OFFLINE_MATRICES is set then matrices are stored in
+     * single precision and converted to @p Number on access.
+     */
+#ifdef SINGLE_PRECISION_OFFLINE_MATRICES
+    using MatrixNumber = float;
+#else
+    using MatrixNumber = Number;
+#endif
+
+    /**
+     * The logical SIMD batch width: The locally internal index range is
+     * grouped (and split into thread blocks) in batches of
+     * SIMD_BATCH_MULTIPLIER consecutive SIMD row groups of uniform
+     * stencil size. The hyperbolic module processes such a batch as an
+     * unrolled array of VectorizedArray row groups. The storage layout of
+     * the SIMD matrices is not affected and follows the hardware width
+     * VectorizedArray<Number>::size().
+     */
+    static constexpr unsigned int simd_batch_length =
+        SIMD_BATCH_MULTIPLIER * VectorizedArray<Number>::size();
+    static_assert(SIMD_BATCH_MULTIPLIER >= 1,
+                  "SIMD_BATCH_MULTIPLIER has to be a positive integer");
+
+    /**
+     * The SIMD sparse matrix type for precomputed offline matrices.
+     */
+    template <int n_components = 1>
+    using OfflineMatrix =
+        SparseMatrixSIMD<MatrixNumber,
+                         n_components,
+                         VectorizedArray<Number>::size()>;
+
     /**
      * A tuple describing (local) dof index, boundary normal, normal mass,
      * boundary mass, boundary id, and position of the boundary degree of
@@ -79,6 +148,32 @@ namespace ryujin
                                            unsigned int /*col_idx*/,
                                            unsigned int /*j*/>;
 
+    /**
+     * A flat "struct of arrays" representation of the boundary map that
+     * is used for a thread-parallel application of boundary conditions.
+     *
+     * All entries of the boundary map referring to the same degree of
+     * freedom are grouped together: The entries with index in
+     * [group_starts[g], group_starts[g + 1]) all belong to the same
+     * (local) degree of freedom.
+     */
+    struct BoundaryTable {
+      std::vector<unsigned int> group_starts;
+      std::vector<unsigned int> indices;
+      std::array<std::vector<Number>, dim> normals;
+      std::array<std::vector<double>, dim> positions;
+      std::vector<dealii::types::boundary_id> ids;
+
+      /**
+       * Return the number of groups, i.e., the number of distinct
+       * boundary degrees of freedom.
+       */
+      unsigned int n_groups() const
+      {
+        return group_starts.empty() ? 0 : group_starts.size() - 1;
+      }
+    };
+
     /**
      * Constructor
      */
@@ -86,20 +181,82 @@ namespace ryujin
                 const Discretization<dim> &discretization,
                 const std::string &subsection = "/OfflineData");
 
+    /**
+     * Destructor.
+     */
+    ~OfflineData();
+
     /**
      * Prepare offline data. A call to prepare() internally calls setup()
      * and assemble().
      *
+     * If a "cache directory" is set, the assembled matrices are read from
+     * a matching cache file instead of calling assemble(), or written to
+     * the cache directory after assembly. Similarly, the final degree of
+     * freedom renumbering is cached and reused in setup(). This speeds up
+     * restarts from a checkpoint and repeated runs on an identical mesh
+     * and partitioning.
+     *
      * The problem_dimension and n_precomputed_values parameters is used to
      * set up appropriately sized vector partitioners for the state and
      * precomputed MultiComponentVector.
+     *
+     * Rarely used data, i.e., the coupling boundary pairs and the
+     * multigrid level data, is not created by prepare() but on first
+     * access, see prepare_multigrid_data().
      */
     void prepare(const unsigned int problem_dimension,
                  const unsigned int n_precomputed_values)
     {
+      coupling_boundary_pairs_.reset();
+      multigrid_data_.reset();
+      setup_timings_.clear();
+
+      /*
+       * Record the wall time of a phase since the last call, excluding
+       * the time of all phases recorded separately in between:
+       */
+      using clock = std::chrono::steady_clock;
+      auto start = clock::now();
+      std::size_t n_recorded = 0;
+      const auto record = [&](const std::string &phase) {
+        const auto now = clock::now();
+        double time = std::chrono::duration<double>(now - start).count();
+        for (auto k = n_recorded; k < setup_timings_.size(); ++k)
+          time -= setup_timings_[k].second;
+        setup_timings_.emplace_back(phase, time);
+        n_recorded = setup_timings_.size();
+        start = now;
+      };
+
       setup(problem_dimension, n_precomputed_values);
-      assemble();
-      create_multigrid_data();
+      record("setup");
+      if (!read_cache()) {
+        assemble();
+        write_cache();
+        record("assemble");
+      } else {
+        record("read cache");
+      }
+      finalize_assembly();
+      record("finalize assembly");
+    }
+
+    /**
+     * Create the multigrid level data (level degrees of freedom, level
+     * boundary maps and level lumped mass matrices) unless it has already
+     * been created for the current mesh. The multigrid level data is only
+     * needed by the geometric multigrid preconditioners of a parabolic
+     * solver.
+     *
+     * @note The function is called by the level accessors below. It is a
+     * collective operation: the first call after prepare() has to happen
+     * on all MPI ranks at the same time.
+     */
+    void prepare_multigrid_data() const
+    {
+      multigrid_data_.ensure_initialized(
+          [&]() { return create_multigrid_data(); });
     }
 
     /**
@@ -132,6 +289,14 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY_NO_DEREFERENCE(precomputed_vector_partitioner)
 
+    /**
+     * A communicator of all MPI ranks on the same node that is used for
+     * allocating state vectors in MPI-3 shared memory windows, see
+     * MultiComponentVector::reinit(). Set to MPI_COMM_SELF if the "shared
+     * memory ghost exchange" option is disabled.
+     */
+    ACCESSOR_READ_ONLY_NO_DEREFERENCE(shared_memory_communicator)
+
     /**
      * The subinterval \f$[0,\texttt{n_export_indices()})\f$ contains all
      * (SIMD-vectorized) indices of the interval
@@ -153,6 +318,17 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(n_locally_internal)
 
+    /**
+     * Right boundary of the locally owned rows with a nontrivial stencil:
+     * All indices in the half open interval [n_locally_active_,
+     * n_locally_owned_) are constrained degrees of freedom (hanging
+     * nodes, periodicity) that are skipped by all kernels. The
+     * renumbering moves (almost) all constrained degrees of freedom into
+     * this trailing range, so that loops over the non-vectorized rows can
+     * stop at n_locally_active_.
+     */
+    ACCESSOR_READ_ONLY(n_locally_active)
+
     /**
      * Number of locally owned degrees of freedom: In (MPI rank) local
      * numbering all indices in the half open interval [0,
@@ -168,6 +344,36 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(n_locally_relevant)
 
+    /**
+     * Return a partition of the row range [@p left, @p right) into
+     * per-thread blocks for a loop with the given @p stride, see
+     * ThreadBlocks. If the "thread blocks" option is enabled the locally
+     * internal range and the remaining locally owned range are split
+     * separately into one block per thread of (approximately) equal work
+     * measured by the number of nonzero entries. Otherwise every block
+     * consists of a single stride.
+     *
+     * The export rows [0, n_export_indices) and the remaining internal
+     * rows [n_export_indices, n_locally_internal) are split separately as
+     * well, so that loops that process the export rows first (see
+     * HyperbolicModule) are balanced in both phases.
+     */
+    ThreadBlocks thread_blocks(const unsigned int left,
+                               const unsigned int right,
+                               const unsigned int stride) const
+    {
+      const auto &boundaries = [&]() -> const std::vector<unsigned int> & {
+        if (left >= n_locally_internal_)
+          return noninternal_thread_blocks_;
+        if (right <= n_export_indices_)
+          return export_thread_blocks_;
+        if (left >= n_export_indices_)
+          return nonexport_thread_blocks_;
+        return internal_thread_blocks_;
+      }();
+      return ThreadBlocks(boundaries, left, right, stride);
+    }
+
     /**
      * The boundary map. Local numbering.
      *
@@ -181,19 +387,39 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(boundary_map)
 
+    /**
+     * The boundary map stored as a flat boundary table grouped by degree
+     * of freedom. See BoundaryTable for details.
+     */
+    ACCESSOR_READ_ONLY(boundary_table)
+
     /**
      * A vector of tuples describing coupling degrees of freedom i and j
      * where both degrees of freedom are collocated at the boundary (and
      * hence the d_ij matrix has to be symmetrized). The function returns a
      * reference to a vector of tuples consisting of (i, col_idx, j).
+     *
+     * The coupling boundary pairs are collected on first access.
      */
-    ACCESSOR_READ_ONLY(coupling_boundary_pairs)
+    const auto &coupling_boundary_pairs() const
+    {
+      coupling_boundary_pairs_.ensure_initialized([&]() {
+        return collect_coupling_boundary_pairs(dof_handler_->begin_active(),
+                                               dof_handler_->end(),
+                                               *scalar_partitioner_);
+      });
+      return coupling_boundary_pairs_.value();
+    }
 
     /**
-     * The boundary map on all levels of the grid in case multilevel
-     * support was enabled.
+     * The boundary map on all levels of the grid. Calls
+     * prepare_multigrid_data().
      */
-    ACCESSOR_READ_ONLY(level_boundary_map)
+    const auto &level_boundary_map() const
+    {
+      prepare_multigrid_data();
+      return multigrid_data_.value().level_boundary_map;
+    }
 
     /**
      * A sparsity pattern for (standard deal.II) matrices storing indices
@@ -232,10 +458,14 @@ namespace ryujin
     ACCESSOR_READ_ONLY(lumped_mass_matrix_inverse)
 
     /**
-     * The lumped mass matrix on all levels of the grid in case multilevel
-     * support was enabled.
+     * The lumped mass matrix on all levels of the grid. Calls
+     * prepare_multigrid_data().
      */
-    ACCESSOR_READ_ONLY(level_lumped_mass_matrix)
+    const auto &level_lumped_mass_matrix() const
+    {
+      prepare_multigrid_data();
+      return multigrid_data_.value().level_lumped_mass_matrix;
+    }
 
     /**
      * The \f$(c_{ij})\f$ matrix. (SIMD storage, local numbering)
@@ -263,6 +493,55 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(discretization)
 
+    /**
+     * Return the (rank-local) wall times in seconds of all phases of the
+     * last call to prepare(). The time spent in
+     * SparsityPatternSIMD::reinit() is reported separately and is not
+     * included in the "setup" phase.
+     */
+    ACCESSOR_READ_ONLY(setup_timings)
+
+    /**
+     * Return an estimate of the memory consumption (in bytes) of the
+     * SIMD sparsity pattern and all precomputed matrices and vectors on
+     * this MPI rank. For high-order ansatz spaces the matrices dominate
+     * the overall memory footprint of the solver.
+     */
+    std::size_t memory_consumption() const;
+
+    /**
+     * Return the number of ghost degrees of freedom of an extended halo
+     * with 1, ..., @p n_layers layers, i.e., the number of degrees of
+     * freedom that are not locally owned but have a graph distance of at
+     * most k to a locally owned degree of freedom. The first entry is the
+     * size of the ghost range of the scalar partitioner. Every further
+     * layer is determined by querying the stencils of the current
+     * outermost layer from their owning MPI ranks.
+     *
+     * The numbers quantify the redundant work of a communication scheme
+     * that exchanges a wider halo once per time step instead of one
+     * layer per stage.
+     *
+     * @note This function is collective over all MPI ranks.
+     */
+    std::vector<unsigned int> halo_sizes(const unsigned int n_layers) const;
+
+    /**
+     * Estimate the redundant work of temporal blocking: The locally
+     * owned rows are split into consecutive blocks of @p block_size rows
+     * (in the local, bandwidth reduced numbering). Every block is then
+     * extended by @p n_layers layers of its stencil, which would have to
+     * be recomputed if the block was advanced by @p n_layers dependent
+     * sweeps (for example stages) without any synchronization. The
+     * function returns the total number of rows processed over all
+     * blocks divided by the number of locally owned rows.
+     *
+     * Ghost rows are counted when they are reached but not extended
+     * further; the MPI halo itself is quantified by halo_sizes().
+     */
+    double temporal_blocking_redundancy(const unsigned int block_size,
+                                        const unsigned int n_layers) const;
+
   private:
     /**
      * Private methods used in prepare()
@@ -275,6 +554,13 @@ namespace ryujin
      */
     void create_constraints_and_sparsity_pattern();
 
+    /**
+     * Compute balanced per-thread block boundaries for the locally
+     * internal and the remaining locally owned range. Internally used in
+     * setup().
+     */
+    void create_thread_blocks();
+
     /**
      * Set up DoFHandler, all IndexSet objects and the SparsityPattern.
      * Initialize matrix storage.
@@ -290,10 +576,105 @@ namespace ryujin
      */
     void assemble();
 
+    /**
+     * Assemble the mass and c_ij matrices directly into the
+     * SparseMatrixSIMD objects, bypassing the intermediate (Trilinos or
+     * deal.II) sparse matrices. The scatter of local contributions runs
+     * thread-parallel over a graph coloring of the cells. Internally used
+     * in assemble() for continuous finite elements if no affine
+     * constraints are present.
+     */
+    void assemble_direct();
+
+    /**
+     * Variant of assemble_direct() for continuous finite elements with
+     * hanging node or periodicity constraints. The constraints are
+     * condensed while scattering the cell matrices of all locally owned
+     * cells into the SIMD matrices. Contributions to rows owned by other
+     * MPI ranks are collected and exchanged afterwards. This path does
+     * not require Trilinos.
+     */
+    void assemble_direct_constrained();
+
+    /**
+     * Return the position within the row of the (local) column index @p j
+     * in the (local) row @p i of the SIMD sparsity pattern.
+     */
+    unsigned int position_within_row(const unsigned int i,
+                                     const unsigned int j) const;
+
+    /**
+     * Populate the boundary map, boundary table and coupling boundary
+     * pairs. In debug mode additionally verify the consistency of the
+     * assembled matrices.
+     */
+    void finalize_assembly();
+
+    /**
+     * Compute a hash of the locally relevant mesh, the finite element
+     * ansatz and the MPI partition and sparsity pattern. The hash is used
+     * to identify cache files of assembled offline data.
+     */
+    std::uint64_t compute_cache_hash() const;
+
+    /**
+     * Read all assembled matrices from the cache directory. Returns false
+     * (on all MPI ranks) if caching is disabled or if a matching cache
+     * file does not exist on at least one MPI rank.
+     */
+    bool read_cache();
+
+    /**
+     * Write all assembled matrices to the cache directory (if caching is
+     * enabled).
+     */
+    void write_cache() const;
+
+    /**
+     * Compute a hash of the locally relevant mesh, the finite element
+     * ansatz, the MPI partition and the initial degree of freedom
+     * numbering as returned by DoFHandler::distribute_dofs(). The hash is
+     * used to identify cache files holding the final renumbering.
+     */
+    std::uint64_t compute_renumbering_hash() const;
+
+    /**
+     * Read the final renumbering of locally owned degrees of freedom,
+     * n_locally_internal_ and n_export_indices_ from the cache directory
+     * and apply the renumbering. Returns false (on all MPI ranks) if
+     * caching is disabled or if a matching cache file does not exist on
+     * at least one MPI rank.
+     */
+    bool read_renumbering_cache(const std::uint64_t hash);
+
+    /**
+     * Write the final renumbering to the cache directory (if caching is
+     * enabled). The renumbering is reconstructed from the locally owned
+     * index set @p initial_locally_owned and the cell-wise degrees of
+     * freedom @p initial_dof_indices of the initial numbering.
+     */
+    void write_renumbering_cache(
+        const std::uint64_t hash,
+        const dealii::IndexSet &initial_locally_owned,
+        const std::vector<dealii::types::global_dof_index>
+            &initial_dof_indices) const;
+
+    /**
+     * Return the file name of the cache file for the given @p hash.
+     */
+    std::string
+    cache_file_name(const std::uint64_t hash,
+                    const std::string &prefix = "offline_data") const;
+
+    /**
+     * Multigrid level data, see prepare_multigrid_data().
+     */
+    struct MultigridData;
+
     /**
      * Create multigrid data.
      */
-    void create_multigrid_data();
+    MultigridData create_multigrid_data() const;
 
     std::unique_ptr<dealii::DoFHandler<dim>> dof_handler_;
 
@@ -310,38 +691,51 @@ namespace ryujin
 
     unsigned int n_export_indices_;
     unsigned int n_locally_internal_;
+    unsigned int n_locally_active_;
     unsigned int n_locally_owned_;
     unsigned int n_locally_relevant_;
 
     using BoundaryMap = std::vector<BoundaryDescription>;
     BoundaryMap boundary_map_;
-    std::vector<BoundaryMap> level_boundary_map_;
+    BoundaryTable boundary_table_;
 
     using CouplingBoundaryPairs = std::vector<CouplingDescription>;
-    CouplingBoundaryPairs coupling_boundary_pairs_;
+    Lazy<CouplingBoundaryPairs> coupling_boundary_pairs_;
 
     dealii::DynamicSparsityPattern sparsity_pattern_;
 
-    SparsityPatternSIMD<dealii::VectorizedArray<Number>::size()>
-        sparsity_pattern_simd_;
+    SparsityPatternSIMD<VectorizedArray<Number>::size()> sparsity_pattern_simd_;
 
-    SparseMatrixSIMD<Number> mass_matrix_;
-    SparseMatrixSIMD<Number> mass_matrix_inverse_;
+    OfflineMatrix<> mass_matrix_;
+    OfflineMatrix<> mass_matrix_inverse_;
 
     ScalarVector lumped_mass_matrix_;
     ScalarVector lumped_mass_matrix_inverse_;
 
-    std::vector<ScalarVectorFloat> level_lumped_mass_matrix_;
+    struct MultigridData {
+      std::vector<BoundaryMap> level_boundary_map;
+      std::vector<ScalarVectorFloat> level_lumped_mass_matrix;
+    };
+    Lazy<MultigridData> multigrid_data_;
 
-    SparseMatrixSIMD<Number, dim> cij_matrix_;
-    SparseMatrixSIMD<Number> incidence_matrix_;
+    OfflineMatrix<dim> cij_matrix_;
+    OfflineMatrix<> incidence_matrix_;
 
     Number measure_of_omega_;
 
+    std::vector<std::pair<std::string, double>> setup_timings_;
+
     dealii::SmartPointer<const Discretization<dim>> discretization_;
 
     const MPI_Comm &mpi_communicator_;
 
+    MPI_Comm shared_memory_communicator_ = MPI_COMM_SELF;
+
+    std::vector<unsigned int> internal_thread_blocks_;
+    std::vector<unsigned int> noninternal_thread_blocks_;
+    std::vector<unsigned int> export_thread_blocks_;
+    std::vector<unsigned int> nonexport_thread_blocks_;
+
     /**
      * Construct a boundary map for a given set of DoFHandler iterators.
      */
@@ -351,6 +745,12 @@ namespace ryujin
         const ITERATOR2 &end,
         const dealii::Utilities::MPI::Partitioner &partitioner) const;
 
+    /**
+     * Construct a flat boundary table from a given boundary map.
+     */
+    BoundaryTable
+    construct_boundary_table(const BoundaryMap &boundary_map) const;
+
     /**
      * Collect coupling pairs of locally owned (and locally relevant)
      * boundary degrees of freedom.
@@ -370,7 +770,33 @@ namespace ryujin
     double incidence_relaxation_even_;
     double incidence_relaxation_odd_;
 
+    GhostRowExchange ghost_row_exchange_;
+    bool shared_memory_ghost_exchange_;
+    bool compressed_columns_;
+    bool balanced_thread_blocks_;
+
+    DoFRenumberingStrategy dof_renumbering_;
+    unsigned int regrouping_passes_;
+
+    bool direct_assembly_;
+    std::string cache_directory_;
+
     //@}
   };
 
 } /* namespace ryujin */
+
+#ifndef DOXYGEN
+DECLARE_ENUM(
+    ryujin::GhostRowExchange,
+    LIST({ryujin::GhostRowExchange::point_to_point, "point to point"},
+         {ryujin::GhostRowExchange::persistent, "persistent"},
+         {ryujin::GhostRowExchange::neighborhood_collective,
+          "neighborhood collective"}));
+
+DECLARE_ENUM(
+    ryujin::DoFRenumberingStrategy,
+    LIST({ryujin::DoFRenumberingStrategy::cuthill_mckee, "cuthill mckee"},
+         {ryujin::DoFRenumberingStrategy::hierarchical, "hierarchical"},
+         {ryujin::DoFRenumberingStrategy::morton, "morton"}));
+#endif
@@ -13,6 +13,7 @@
 #include "sparse_matrix_simd.template.h" /* instantiate read_in */
 
 #include <deal.II/base/graph_coloring.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/parallel.h>
 #include <deal.II/base/work_stream.h>
 #include <deal.II/dofs/dof_renumbering.h>
@@ -25,6 +26,20 @@
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #endif
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <sstream>
+
 #ifdef FORCE_DEAL_II_SPARSE_MATRIX
 #undef DEAL_II_WITH_TRILINOS
 #endif
@@ -33,6 +48,63 @@ namespace ryujin
 {
   using namespace dealii;
 
+  namespace
+  {
+    /**
+     * A minimal 64 bit FNV-1a hash used for fingerprinting the mesh,
+     * finite element and partition an offline data cache was created
+     * for.
+     */
+    class FNV1aHash
+    {
+    public:
+      template <typename T>
+      void add(const T &value)
+      {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto bytes = reinterpret_cast<const unsigned char *>(&value);
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+          hash_ ^= bytes[i];
+          hash_ *= 0x100000001b3ull;
+        }
+      }
+
+      void add(const std::string &value)
+      {
+        for (const auto c : value)
+          add(c);
+        add(value.size());
+      }
+
+      std::uint64_t value() const
+      {
+        return hash_;
+      }
+
+    private:
+      std::uint64_t hash_ = 0xcbf29ce484222325ull;
+    };
+
+
+    /**
+     * A (globally indexed) entry of the condensed mass matrix (first
+     * value) and c_ij matrix (remaining dim values) that is sent to the
+     * MPI rank owning the row.
+     */
+    template <int dim, typename Number>
+    struct CondensedEntry {
+      types::global_dof_index row;
+      types::global_dof_index column;
+      Number values[dim + 1];
+
+      template <class Archive>
+      void serialize(Archive &archive, const unsigned int /*version*/)
+      {
+        archive &row &column &values;
+      }
+    };
+  } // namespace
+
 
   template <int dim, typename Number>
   OfflineData<dim, Number>::OfflineData(
@@ -56,6 +128,90 @@ namespace ryujin
                   "Scaling exponent for incidence matrix used for "
                   "discontinuous finite elements with even degree. The default "
                   "value of 0.0 sets the jump penalization to a constant 1.");
+
+    ghost_row_exchange_ = GhostRowExchange::point_to_point;
+    add_parameter("ghost row exchange",
+                  ghost_row_exchange_,
+                  "MPI communication backend used for exchanging ghost rows of "
+                  "sparse matrices. Valid choices are \"point to point\", "
+                  "\"persistent\" (persistent MPI requests that are set up "
+                  "once per mesh), and \"neighborhood collective\"");
+
+    shared_memory_ghost_exchange_ = false;
+    add_parameter("shared memory ghost exchange",
+                  shared_memory_ghost_exchange_,
+                  "If set to true, state vectors are allocated in MPI-3 "
+                  "shared memory windows of all MPI ranks on a node and "
+                  "ghost values owned by a rank on the same node are read "
+                  "directly from its window instead of being sent with MPI "
+                  "messages");
+
+    compressed_columns_ = false;
+    add_parameter("compressed column indices",
+                  compressed_columns_,
+                  "If set to true, the SIMD sparsity pattern additionally "
+                  "stores column indices as 16 bit differences to the row "
+                  "index. The hot loops of the hyperbolic module decode "
+                  "these compressed indices, which reduces the index memory "
+                  "traffic for a bandwidth reducing dof renumbering");
+
+    balanced_thread_blocks_ = false;
+    add_parameter("thread blocks",
+                  balanced_thread_blocks_,
+                  "If set to true, the locally internal and the remaining "
+                  "locally owned rows are split into one contiguous block "
+                  "per thread with (approximately) the same number of "
+                  "nonzero entries. The edge loop of the hyperbolic module "
+                  "then processes one such sub-block per thread instead of "
+                  "equally sized chunks of rows");
+
+    dof_renumbering_ = DoFRenumberingStrategy::cuthill_mckee;
+    add_parameter("dof renumbering",
+                  dof_renumbering_,
+                  "Strategy for renumbering locally owned degrees of freedom "
+                  "prior to grouping export indices and SIMD strides. Valid "
+                  "choices are \"cuthill mckee\", \"hierarchical\" "
+                  "(Z-order cell traversal), and \"morton\" (Morton space "
+                  "filling curve)");
+
+    regrouping_passes_ = 2;
+    add_parameter("regrouping passes",
+                  regrouping_passes_,
+                  "Maximal number of passes that regroup the rows of the "
+                  "scalar (non-vectorized) tail of the locally owned index "
+                  "range into full SIMD strides after hanging node and "
+                  "periodicity constraints have been eliminated. Every pass "
+                  "requires the construction of two additional sparsity "
+                  "patterns. A value of 0 disables regrouping");
+
+    direct_assembly_ = true;
+    add_parameter("direct assembly",
+                  direct_assembly_,
+                  "If set to true the mass and c_ij matrices are assembled "
+                  "directly into the final SIMD matrices bypassing "
+                  "intermediate sparse matrices. Hanging node and "
+                  "periodicity constraints are condensed during assembly. "
+                  "This is only possible for continuous finite elements; "
+                  "otherwise the regular assembly path is used");
+
+    cache_directory_ = "";
+    add_parameter("cache directory",
+                  cache_directory_,
+                  "If set to a nonempty string, assembled offline data and "
+                  "the final degree of freedom renumbering are cached in "
+                  "this directory and reused for an identical mesh, finite "
+                  "element ansatz and MPI partition, for example when "
+                  "resuming from a checkpoint");
+  }
+
+
+  template <int dim, typename Number>
+  OfflineData<dim, Number>::~OfflineData()
+  {
+#ifdef DEAL_II_WITH_MPI
+    if (shared_memory_communicator_ != MPI_COMM_SELF)
+      MPI_Comm_free(&shared_memory_communicator_);
+#endif
   }
 
 
@@ -77,12 +233,6 @@ namespace ryujin
     affine_constraints_.reinit(locally_relevant);
     DoFTools::make_hanging_node_constraints(dof_handler, affine_constraints_);
 
-#ifndef DEAL_II_WITH_TRILINOS
-    AssertThrow(affine_constraints_.n_constraints() == 0,
-                ExcMessage("ryujin was built without Trilinos support - no "
-                           "hanging node support available"));
-#endif
-
     /*
      * Enforce periodic boundary conditions. We assume that the mesh is in
      * "normal configuration".
@@ -203,57 +353,12 @@ namespace ryujin
 
     n_locally_owned_ = dof_handler.locally_owned_dofs().n_elements();
 
-    /*
-     * Renumbering:
-     */
-
-    DoFRenumbering::Cuthill_McKee(dof_handler);
-
-    /*
-     * Reorder all (individual) export indices at the beginning of the
-     * locally_internal index range to achieve a better packing:
-     *
-     * Note: This function might miss export indices that come from
-     * eliminating hanging node and periodicity constraints (which we do
-     * not know at this point because they depend on the renumbering...).
-     */
-    DoFRenumbering::export_indices_first(
-        dof_handler, mpi_communicator_, n_locally_owned_, 1);
-
-    /*
-     * Group degrees of freedom that have the same stencil size in groups
-     * of multiples of the VectorizedArray<Number>::size().
-     *
-     * In order to determine the stencil size we have to create a first,
-     * temporary sparsity pattern:
-     */
-    create_constraints_and_sparsity_pattern();
-    n_locally_internal_ = DoFRenumbering::internal_range(
-        dof_handler, sparsity_pattern_, VectorizedArray<Number>::size());
-
-    /*
-     * Reorder all (strides of) locally internal indices that contain
-     * export indices to the start of the index range. This reordering
-     * preserves the binning introduced by
-     * DoFRenumbering::internal_range().
-     *
-     * Note: This function might miss export indices that come from
-     * eliminating hanging node and periodicity constraints (which we do
-     * not know at this point because they depend on the renumbering...).
-     * We therefore have to update n_export_indices_ later again.
-     */
-    n_export_indices_ =
-        DoFRenumbering::export_indices_first(dof_handler,
-                                             mpi_communicator_,
-                                             n_locally_internal_,
-                                             VectorizedArray<Number>::size());
-
     /*
      * A small lambda to check for stride-level consistency of the internal
      * index range:
      */
     const auto consistent_stride_range [[maybe_unused]] = [&]() {
-      constexpr auto group_size = VectorizedArray<Number>::size();
+      constexpr auto group_size = simd_batch_length;
       const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
       const auto offset = n_locally_owned_ != 0 ? *locally_owned.begin() : 0;
 
@@ -284,39 +389,167 @@ namespace ryujin
     };
 
     /*
-     * Create final sparsity pattern:
+     * Renumbering is expensive (and involves the creation of several
+     * temporary sparsity patterns). If a cache directory is set we try
+     * to reuse the final numbering of a previous run with identical
+     * mesh, partition and initial numbering:
      */
 
-    create_constraints_and_sparsity_pattern();
+    const auto renumbering_hash = compute_renumbering_hash();
 
-    /*
-     * We have to ensure that the locally internal numbering range is still
-     * consistent, meaning that all strides have the same stencil size.
-     * This property might not hold any more after the elimination
-     * procedure of constrained degrees of freedom (periodicity, or hanging
-     * node constraints). Therefore, the following little dance:
-     */
+    if (read_renumbering_cache(renumbering_hash)) {
+      create_constraints_and_sparsity_pattern();
+
+    } else {
+      const IndexSet initial_locally_owned = dof_handler.locally_owned_dofs();
+      std::vector<types::global_dof_index> initial_dof_indices;
+      if (!cache_directory_.empty()) {
+        const auto dofs_per_cell =
+            discretization_->finite_element().dofs_per_cell;
+        std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+        for (const auto &cell : dof_handler.active_cell_iterators()) {
+          if (!cell->is_locally_owned())
+            continue;
+          cell->get_dof_indices(dof_indices);
+          initial_dof_indices.insert(initial_dof_indices.end(),
+                                     dof_indices.begin(),
+                                     dof_indices.end());
+        }
+      }
+
+      /*
+       * Renumbering:
+       */
+
+      switch (dof_renumbering_) {
+      case DoFRenumberingStrategy::cuthill_mckee:
+        DoFRenumbering::Cuthill_McKee(dof_handler);
+        break;
+      case DoFRenumberingStrategy::hierarchical:
+        DoFRenumbering::hierarchical(dof_handler);
+        break;
+      case DoFRenumberingStrategy::morton:
+        DoFRenumbering::morton(dof_handler);
+        break;
+      }
+
+      /*
+       * Reorder all (individual) export indices at the beginning of the
+       * locally_internal index range to achieve a better packing:
+       *
+       * Note: This function might miss export indices that come from
+       * eliminating hanging node and periodicity constraints (which we do
+       * not know at this point because they depend on the renumbering...).
+       */
+      DoFRenumbering::export_indices_first(
+          dof_handler, mpi_communicator_, n_locally_owned_, 1);
+
+      /*
+       * Group degrees of freedom that have the same stencil size in groups
+       * of multiples of the logical SIMD batch width (simd_batch_length).
+       *
+       * In order to determine the stencil size we have to create a first,
+       * temporary sparsity pattern:
+       */
+      create_constraints_and_sparsity_pattern();
+      n_locally_internal_ = DoFRenumbering::internal_range(
+          dof_handler, sparsity_pattern_, simd_batch_length);
+
+      /*
+       * Reorder all (strides of) locally internal indices that contain
+       * export indices to the start of the index range. This reordering
+       * preserves the binning introduced by
+       * DoFRenumbering::internal_range().
+       *
+       * Note: This function might miss export indices that come from
+       * eliminating hanging node and periodicity constraints (which we do
+       * not know at this point because they depend on the renumbering...).
+       * We therefore have to update n_export_indices_ later again.
+       */
+      n_export_indices_ =
+          DoFRenumbering::export_indices_first(dof_handler,
+                                               mpi_communicator_,
+                                               n_locally_internal_,
+                                               simd_batch_length);
+
+      /*
+       * Create final sparsity pattern:
+       */
+
+      create_constraints_and_sparsity_pattern();
+
+      /*
+       * We have to ensure that the locally internal numbering range is still
+       * consistent, meaning that all strides have the same stencil size.
+       * This property might not hold any more after the elimination
+       * procedure of constrained degrees of freedom (periodicity, or hanging
+       * node constraints). Therefore, the following little dance:
+       */
 
 #if DEAL_II_VERSION_GTE(9, 5, 0)
-    if (mpi_allreduce_logical_or(affine_constraints_.n_constraints() > 0)) {
-      if (mpi_allreduce_logical_or( //
-              consistent_stride_range() != n_locally_internal_)) {
+      if (mpi_allreduce_logical_or(affine_constraints_.n_constraints() > 0)) {
+        if (mpi_allreduce_logical_or( //
+                consistent_stride_range() != n_locally_internal_)) {
+          /*
+           * In this case we try to fix up the numbering by pushing affected
+           * strides to the end and slightly lowering the n_locally_internal_
+           * marker.
+           */
+          n_locally_internal_ = DoFRenumbering::inconsistent_strides_last(
+              dof_handler,
+              sparsity_pattern_,
+              n_locally_internal_,
+              simd_batch_length);
+          create_constraints_and_sparsity_pattern();
+          n_locally_internal_ = consistent_stride_range();
+        }
+
         /*
-         * In this case we try to fix up the numbering by pushing affected
-         * strides to the end and slightly lowering the n_locally_internal_
-         * marker.
+         * Constraint elimination changes the stencil size of rows next to
+         * hanging nodes and periodic boundaries. Such rows end up in the
+         * scalar tail [n_locally_internal_, n_locally_owned_) even if
+         * enough of them share the same stencil size. Regroup the tail
+         * with the updated stencil sizes into full strides, append them to
+         * the internal range and repeat the export index grouping and the
+         * little dance from above. Every pass reduces the number of rows
+         * that have to be processed without vectorization.
          */
-        n_locally_internal_ = DoFRenumbering::inconsistent_strides_last(
-            dof_handler,
-            sparsity_pattern_,
-            n_locally_internal_,
-            VectorizedArray<Number>::size());
-        create_constraints_and_sparsity_pattern();
-        n_locally_internal_ = consistent_stride_range();
+        for (unsigned int pass = 0; pass < regrouping_passes_; ++pass) {
+          const auto n_previous = n_locally_internal_;
+
+          n_locally_internal_ =
+              DoFRenumbering::internal_range(dof_handler,
+                                             sparsity_pattern_,
+                                             simd_batch_length,
+                                             n_locally_internal_);
+          n_export_indices_ =
+              DoFRenumbering::export_indices_first(dof_handler,
+                                                   mpi_communicator_,
+                                                   n_locally_internal_,
+                                                   simd_batch_length);
+          create_constraints_and_sparsity_pattern();
+
+          if (mpi_allreduce_logical_or( //
+                  consistent_stride_range() != n_locally_internal_)) {
+            n_locally_internal_ = DoFRenumbering::inconsistent_strides_last(
+                dof_handler,
+                sparsity_pattern_,
+                n_locally_internal_,
+                simd_batch_length);
+            create_constraints_and_sparsity_pattern();
+            n_locally_internal_ = consistent_stride_range();
+          }
+
+          if (!mpi_allreduce_logical_or(n_locally_internal_ > n_previous))
+            break;
+        }
       }
-    }
 #endif
 
+      write_renumbering_cache(
+          renumbering_hash, initial_locally_owned, initial_dof_indices);
+    }
+
     /*
      * Check that after all the dof manipulation and setup we still end up
      * with indices in [0, locally_internal) that have uniform stencil size
@@ -325,6 +558,19 @@ namespace ryujin
     Assert(consistent_stride_range() == n_locally_internal_,
            dealii::ExcInternalError());
 
+    /*
+     * Determine the trailing range of constrained degrees of freedom:
+     */
+    {
+      const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+      const auto offset = n_locally_owned_ != 0 ? *locally_owned.begin() : 0;
+
+      n_locally_active_ = n_locally_owned_;
+      while (n_locally_active_ > n_locally_internal_ &&
+             sparsity_pattern_.row_length(offset + n_locally_active_ - 1) == 1)
+        --n_locally_active_;
+    }
+
     /*
      * Set up partitioner:
      */
@@ -359,6 +605,29 @@ namespace ryujin
     precomputed_vector_partitioner_ = Vectors::create_vector_partitioner(
         scalar_partitioner_, n_precomputed_values);
 
+    /*
+     * Create a communicator of all MPI ranks on the same node for
+     * allocating state vectors in shared memory windows:
+     */
+
+#ifdef DEAL_II_WITH_MPI
+    if (shared_memory_communicator_ != MPI_COMM_SELF) {
+      const int ierr = MPI_Comm_free(&shared_memory_communicator_);
+      AssertThrowMPI(ierr);
+      shared_memory_communicator_ = MPI_COMM_SELF;
+    }
+
+    if (shared_memory_ghost_exchange_) {
+      const int ierr = MPI_Comm_split_type(
+          mpi_communicator_,
+          MPI_COMM_TYPE_SHARED,
+          Utilities::MPI::this_mpi_process(mpi_communicator_),
+          MPI_INFO_NULL,
+          &shared_memory_communicator_);
+      AssertThrowMPI(ierr);
+    }
+#endif
+
     /*
      * After elminiating periodicity and hanging node constraints we need
      * to update n_export_indices_ again. This happens because we need to
@@ -374,9 +643,9 @@ namespace ryujin
         if (it.second <= n_locally_internal_)
           n_export_indices_ = std::max(n_export_indices_, it.second);
 
-      constexpr auto simd_length = VectorizedArray<Number>::size();
+      constexpr auto batch_length = simd_batch_length;
       n_export_indices_ =
-          (n_export_indices_ + simd_length - 1) / simd_length * simd_length;
+          (n_export_indices_ + batch_length - 1) / batch_length * batch_length;
     }
 
 #ifdef DEBUG
@@ -396,8 +665,20 @@ namespace ryujin
      * from global deal.II (typical) dof indexing to local indices.
      */
 
-    sparsity_pattern_simd_.reinit(
-        n_locally_internal_, sparsity_pattern_, scalar_partitioner_);
+    {
+      const auto start = std::chrono::steady_clock::now();
+
+      sparsity_pattern_simd_.reinit(
+          n_locally_internal_, sparsity_pattern_, scalar_partitioner_);
+      sparsity_pattern_simd_.set_ghost_row_exchange(ghost_row_exchange_);
+      sparsity_pattern_simd_.set_compressed_columns(compressed_columns_);
+
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+      setup_timings_.emplace_back("simd sparsity pattern", elapsed.count());
+    }
+
+    create_thread_blocks();
 
     /*
      * Next we can (re)initialize all local matrices:
@@ -416,6 +697,67 @@ namespace ryujin
   }
 
 
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::create_thread_blocks()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::create_thread_blocks()"
+              << std::endl;
+#endif
+
+    internal_thread_blocks_.clear();
+    noninternal_thread_blocks_.clear();
+    export_thread_blocks_.clear();
+    nonexport_thread_blocks_.clear();
+
+    if (!balanced_thread_blocks_)
+      return;
+
+    constexpr unsigned int simd_length = VectorizedArray<Number>::size();
+    const unsigned int n_threads = max_threads();
+
+    /*
+     * Split [first, last) into n_threads blocks of (approximately) equal
+     * number of nonzero entries. Block boundaries are placed at multiples
+     * of stride away from first so that SIMD loops (over logical SIMD
+     * batches in the internal range) and the masked loop over
+     * non-internal rows never split a stride:
+     */
+    const auto split = [&](const unsigned int first,
+                           const unsigned int last,
+                           const unsigned int stride) {
+      std::vector<double> work;
+      for (unsigned int i = first; i < last; i += stride) {
+        double nonzeros = 0.;
+        for (unsigned int k = i; k < std::min(i + stride, last); ++k)
+          nonzeros += sparsity_pattern_simd_.row_length(k);
+        work.push_back(nonzeros);
+      }
+      const double total = std::accumulate(work.begin(), work.end(), 0.);
+
+      std::vector<unsigned int> boundaries{first};
+      double accumulated = 0.;
+      unsigned int g = 0;
+      for (unsigned int t = 1; t < n_threads; ++t) {
+        while (g < work.size() &&
+               accumulated + 0.5 * work[g] < total * t / n_threads)
+          accumulated += work[g++];
+        boundaries.push_back(std::min(first + g * stride, last));
+      }
+      boundaries.push_back(last);
+
+      return boundaries;
+    };
+
+    internal_thread_blocks_ = split(0, n_locally_internal_, simd_batch_length);
+    noninternal_thread_blocks_ =
+        split(n_locally_internal_, n_locally_owned_, simd_length);
+    export_thread_blocks_ = split(0, n_export_indices_, simd_batch_length);
+    nonexport_thread_blocks_ =
+        split(n_export_indices_, n_locally_internal_, simd_batch_length);
+  }
+
+
   template <int dim, typename Number>
   void OfflineData<dim, Number>::assemble()
   {
@@ -423,6 +765,30 @@ namespace ryujin
     std::cout << "OfflineData<dim, Number>::assemble()" << std::endl;
 #endif
 
+    /*
+     * The direct assembly path can only be used if we do not have to
+     * eliminate any constraints. Note that the decision has to be
+     * consistent over all MPI ranks.
+     */
+    const bool have_constraints = Utilities::MPI::max(
+        affine_constraints_.n_constraints() > 0 ? 1u : 0u, mpi_communicator_);
+
+    if (direct_assembly_ && !discretization_->have_discontinuous_ansatz() &&
+        std::is_same_v<MatrixNumber, Number>) {
+      if (have_constraints == 0)
+        assemble_direct();
+      else
+        assemble_direct_constrained();
+      return;
+    }
+
+#ifndef DEAL_II_WITH_TRILINOS
+    AssertThrow(have_constraints == 0,
+                ExcMessage("ryujin was built without Trilinos support - "
+                           "hanging node and periodicity constraints are "
+                           "only supported with \"direct assembly\""));
+#endif
+
     auto &dof_handler = *dof_handler_;
 
     measure_of_omega_ = 0.;
@@ -988,109 +1354,513 @@ namespace ryujin
       incidence_matrix_.update_ghost_rows();
     }
 
-    /*
-     * Populate boundary map and collect coupling boundary pairs:
-     */
-    {
-      boundary_map_ = construct_boundary_map(
-          dof_handler.begin_active(), dof_handler.end(), *scalar_partitioner_);
+  }
 
-      coupling_boundary_pairs_ = collect_coupling_boundary_pairs(
-          dof_handler.begin_active(), dof_handler.end(), *scalar_partitioner_);
-    }
 
-#ifdef DEBUG
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::assemble_direct()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::assemble_direct()" << std::endl;
+#endif
+
+    auto &dof_handler = *dof_handler_;
+
+    const unsigned int dofs_per_cell =
+        discretization_->finite_element().dofs_per_cell;
+
+    mass_matrix_.set_zero();
+    cij_matrix_.set_zero();
+
     /*
-     * Verify that we have consistent mass:
+     * The local, per-cell assembly routine. As for the deal.II sparse
+     * matrix variant we assemble over all locally relevant (non
+     * artificial) cells. This way all locally owned rows receive all
+     * their contributions.
      */
+    const auto local_assemble_system = [&](const auto &cell,
+                                           auto &scratch,
+                                           auto &copy) {
+      auto &is_locally_owned = copy.is_locally_owned_;
+      auto &local_dof_indices = copy.local_dof_indices_;
+      auto &cell_mass_matrix = copy.cell_mass_matrix_;
+      auto &cell_cij_matrix = copy.cell_cij_matrix_;
+      auto &fe_values = scratch.fe_values_;
 
-    double total_mass = 0.;
-    for (unsigned int i = 0; i < n_locally_owned_; ++i)
-      total_mass += lumped_mass_matrix_.local_element(i);
-    total_mass = Utilities::MPI::sum(total_mass, mpi_communicator_);
+      is_locally_owned = !cell->is_artificial();
+      if (!is_locally_owned)
+        return;
 
-    Assert(std::abs(measure_of_omega_ - total_mass) <
-               1.e-12 * measure_of_omega_,
-           dealii::ExcMessage(
-               "Total mass differs from the measure of the domain."));
+      cell_mass_matrix.reinit(dofs_per_cell, dofs_per_cell);
+      for (auto &matrix : cell_cij_matrix)
+        matrix.reinit(dofs_per_cell, dofs_per_cell);
+
+      fe_values.reinit(cell);
+
+      local_dof_indices.resize(dofs_per_cell);
+      cell->get_dof_indices(local_dof_indices);
+      transform_to_local_range(*scalar_partitioner_, local_dof_indices);
+
+      for (unsigned int q : fe_values.quadrature_point_indices()) {
+        const auto JxW = fe_values.JxW(q);
+
+        for (unsigned int j : fe_values.dof_indices()) {
+          const auto value_JxW = fe_values.shape_value(j, q) * JxW;
+          const auto grad_JxW = fe_values.shape_grad(j, q) * JxW;
+
+          for (unsigned int i : fe_values.dof_indices()) {
+            const auto value = fe_values.shape_value(i, q);
+
+            cell_mass_matrix(i, j) += Number(value * value_JxW);
+            for (unsigned int d = 0; d < dim; ++d)
+              cell_cij_matrix[d](i, j) += Number((value * grad_JxW)[d]);
+          } /* for i */
+        }   /* for j */
+      }     /* for q */
+    };
 
     /*
-     * Verify that the mij_matrix_ object is consistent:
+     * Scatter into all locally owned rows. Cells of the same color do not
+     * share any degrees of freedom, thus the copier is run concurrently
+     * for all cells of a color without the need for any synchronization.
      */
+    const auto copy_local_to_global = [&](const auto &copy) {
+      const auto &local_dof_indices = copy.local_dof_indices_;
 
-    for (unsigned int i = 0; i < n_locally_owned_; ++i) {
-      /* Skip constrained degrees of freedom: */
-      const unsigned int row_length = sparsity_pattern_simd_.row_length(i);
-      if (row_length == 1)
-        continue;
+      if (!copy.is_locally_owned_)
+        return;
 
-      auto sum =
-          mass_matrix_.get_entry(i, 0) - lumped_mass_matrix_.local_element(i);
+      for (unsigned int a = 0; a < dofs_per_cell; ++a) {
+        const unsigned int i = local_dof_indices[a];
+        if (i >= n_locally_owned_)
+          continue;
 
-      /* skip diagonal */
-      constexpr auto simd_length = VectorizedArray<Number>::size();
-      const unsigned int *js = sparsity_pattern_simd_.columns(i);
-      for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
-        const auto j = *(i < n_locally_internal_ ? js + col_idx * simd_length
-                                                 : js + col_idx);
-        Assert(j < n_locally_relevant_, dealii::ExcInternalError());
+        for (unsigned int b = 0; b < dofs_per_cell; ++b) {
+          const auto col_idx = position_within_row(i, local_dof_indices[b]);
 
-        const auto m_ij = mass_matrix_.get_entry(i, col_idx);
-        if (discretization_->have_discontinuous_ansatz()) {
-          // Interfacial coupling terms are present in the stencil but zero
-          // in the mass matrix
-          Assert(std::abs(m_ij) > -1.e-12, dealii::ExcInternalError());
-        } else {
-          Assert(std::abs(m_ij) > 1.e-12, dealii::ExcInternalError());
-        }
-        sum += m_ij;
+          const auto m_ij = mass_matrix_.get_entry(i, col_idx);
+          mass_matrix_.write_entry(
+              m_ij + copy.cell_mass_matrix_(a, b), i, col_idx);
 
-        const auto m_ji = mass_matrix_.get_transposed_entry(i, col_idx);
-        if (std::abs(m_ij - m_ji) >= 1.e-12) {
-          // The m_ij matrix is not symmetric
-          std::stringstream ss;
-          ss << "m_ij matrix is not symmetric: " << m_ij << " <-> " << m_ji;
-          Assert(false, dealii::ExcMessage(ss.str()));
+          auto c_ij = cij_matrix_.get_tensor(i, col_idx);
+          for (unsigned int d = 0; d < dim; ++d)
+            c_ij[d] += copy.cell_cij_matrix_[d](a, b);
+          cij_matrix_.write_entry(c_ij, i, col_idx);
         }
       }
+    };
+
+    using Iterator = typename DoFHandler<dim>::active_cell_iterator;
+    const auto get_conflict_indices = [&](const Iterator &cell) {
+      std::vector<types::global_dof_index> indices;
+      if (!cell->is_artificial()) {
+        indices.resize(dofs_per_cell);
+        cell->get_dof_indices(indices);
+      }
+      return indices;
+    };
 
-      Assert(std::abs(sum) < 1.e-12, dealii::ExcInternalError());
-    }
+    const auto colored_iterators = GraphColoring::make_graph_coloring(
+        dof_handler.begin_active(),
+        Iterator(dof_handler.end()),
+        std::function<std::vector<types::global_dof_index>(const Iterator &)>(
+            get_conflict_indices));
+
+    WorkStream::run(colored_iterators,
+                    local_assemble_system,
+                    copy_local_to_global,
+                    AssemblyScratchData<dim>(*discretization_),
+                    AssemblyCopyData<dim, Number>());
+
+    mass_matrix_.update_ghost_rows();
+    cij_matrix_.update_ghost_rows();
 
     /*
-     * Verify that the cij_matrix_ object is consistent:
+     * Create lumped mass matrix. Without constraints the lumped mass
+     * matrix is simply given by the row sums of the mass matrix, and the
+     * measure of the domain by the sum of the lumped mass matrix.
      */
 
+    double measure_of_omega = 0.;
     for (unsigned int i = 0; i < n_locally_owned_; ++i) {
-      /* Skip constrained degrees of freedom: */
+      Number m_i = 0.;
       const unsigned int row_length = sparsity_pattern_simd_.row_length(i);
-      if (row_length == 1)
-        continue;
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx)
+        m_i += mass_matrix_.get_entry(i, col_idx);
 
-      auto sum = cij_matrix_.get_tensor(i, 0);
+      lumped_mass_matrix_.local_element(i) = m_i;
+      lumped_mass_matrix_inverse_.local_element(i) = Number(1.) / m_i;
+      measure_of_omega += m_i;
+    }
+    lumped_mass_matrix_.update_ghost_values();
+    lumped_mass_matrix_inverse_.update_ghost_values();
 
-      /* skip diagonal */
-      constexpr auto simd_length = VectorizedArray<Number>::size();
-      const unsigned int *js = sparsity_pattern_simd_.columns(i);
-      for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
-        const auto j = *(i < n_locally_internal_ ? js + col_idx * simd_length
-                                                 : js + col_idx);
-        Assert(j < n_locally_relevant_, dealii::ExcInternalError());
+    measure_of_omega_ =
+        Number(Utilities::MPI::sum(measure_of_omega, mpi_communicator_));
+  }
+
+
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::assemble_direct_constrained()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::assemble_direct_constrained()"
+              << std::endl;
+#endif
+
+    auto &dof_handler = *dof_handler_;
+
+    const unsigned int dofs_per_cell =
+        discretization_->finite_element().dofs_per_cell;
+
+    mass_matrix_.set_zero();
+    cij_matrix_.set_zero();
+
+    measure_of_omega_ = 0.;
+
+    /*
+     * Owning MPI rank of every ghost index of the scalar partitioner:
+     */
+    std::vector<unsigned int> ghost_owners;
+    for (const auto &[rank, n_indices] : scalar_partitioner_->ghost_targets())
+      ghost_owners.insert(ghost_owners.end(), n_indices, rank);
+
+    using Entry = CondensedEntry<dim, Number>;
+    std::map<unsigned int, std::vector<Entry>> entries_to_be_sent;
+
+    /*
+     * Add the entry (i, j) in global numbering to the matrices. Entries of
+     * locally owned rows are added directly into the SIMD matrices, all
+     * others are collected for the owning MPI rank.
+     */
+    const auto add_entry = [&](const types::global_dof_index i,
+                               const types::global_dof_index j,
+                               const Number (&values)[dim + 1]) {
+      const unsigned int i_local = scalar_partitioner_->global_to_local(i);
+
+      if (i_local >= n_locally_owned_) {
+        Entry entry{i, j, {}};
+        std::copy(std::begin(values), std::end(values), entry.values);
+        entries_to_be_sent[ghost_owners[i_local - n_locally_owned_]]
+            .push_back(entry);
+        return;
+      }
+
+      const auto col_idx = position_within_row(
+          i_local, scalar_partitioner_->global_to_local(j));
+
+      const auto m_ij = mass_matrix_.get_entry(i_local, col_idx);
+      mass_matrix_.write_entry(m_ij + values[0], i_local, col_idx);
+
+      auto c_ij = cij_matrix_.get_tensor(i_local, col_idx);
+      for (unsigned int d = 0; d < dim; ++d)
+        c_ij[d] += values[d + 1];
+      cij_matrix_.write_entry(c_ij, i_local, col_idx);
+    };
+
+    /*
+     * The local, per-cell assembly routine. In contrast to
+     * assemble_direct() we can only assemble over locally owned cells:
+     * Eliminating a constrained degree of freedom distributes its row to
+     * rows that are not necessarily supported on the ghost layer.
+     */
+    const auto local_assemble_system = [&](const auto &cell,
+                                           auto &scratch,
+                                           auto &copy) {
+      auto &is_locally_owned = copy.is_locally_owned_;
+      auto &local_dof_indices = copy.local_dof_indices_;
+      auto &cell_mass_matrix = copy.cell_mass_matrix_;
+      auto &cell_cij_matrix = copy.cell_cij_matrix_;
+      auto &cell_measure = copy.cell_measure_;
+      auto &fe_values = scratch.fe_values_;
+
+      is_locally_owned = cell->is_locally_owned();
+      if (!is_locally_owned)
+        return;
+
+      cell_mass_matrix.reinit(dofs_per_cell, dofs_per_cell);
+      for (auto &matrix : cell_cij_matrix)
+        matrix.reinit(dofs_per_cell, dofs_per_cell);
+      cell_measure = 0.;
+
+      fe_values.reinit(cell);
+
+      local_dof_indices.resize(dofs_per_cell);
+      cell->get_dof_indices(local_dof_indices);
+
+      for (unsigned int q : fe_values.quadrature_point_indices()) {
+        const auto JxW = fe_values.JxW(q);
+        cell_measure += Number(JxW);
+
+        for (unsigned int j : fe_values.dof_indices()) {
+          const auto value_JxW = fe_values.shape_value(j, q) * JxW;
+          const auto grad_JxW = fe_values.shape_grad(j, q) * JxW;
+
+          for (unsigned int i : fe_values.dof_indices()) {
+            const auto value = fe_values.shape_value(i, q);
+
+            cell_mass_matrix(i, j) += Number(value * value_JxW);
+            for (unsigned int d = 0; d < dim; ++d)
+              cell_cij_matrix[d](i, j) += Number((value * grad_JxW)[d]);
+          } /* for i */
+        }   /* for j */
+      }     /* for q */
+    };
+
+    /*
+     * Condense the cell matrices: A constrained degree of freedom
+     * x_a = sum_k w_ak x_k is replaced by all of its (unconstrained)
+     * constraint entries k with weight w_ak. As in
+     * AffineConstraints::distribute_local_to_global() the (otherwise empty)
+     * row of a constrained degree of freedom receives the average absolute
+     * diagonal entry of the cell matrix on its diagonal.
+     */
+    std::vector<std::vector<std::pair<types::global_dof_index, Number>>>
+        expansions(dofs_per_cell);
+
+    const auto copy_local_to_global = [&](const auto &copy) {
+      const auto &local_dof_indices = copy.local_dof_indices_;
+
+      if (!copy.is_locally_owned_)
+        return;
+
+      bool have_constrained_dofs = false;
+      for (unsigned int a = 0; a < dofs_per_cell; ++a) {
+        const auto i = local_dof_indices[a];
+        expansions[a].clear();
+        if (affine_constraints_.is_constrained(i)) {
+          have_constrained_dofs = true;
+          for (const auto &[k, w] :
+               *affine_constraints_.get_constraint_entries(i))
+            expansions[a].emplace_back(k, w);
+        } else {
+          expansions[a].emplace_back(i, Number(1.));
+        }
+      }
+
+      Number values[dim + 1];
+      for (unsigned int a = 0; a < dofs_per_cell; ++a)
+        for (unsigned int b = 0; b < dofs_per_cell; ++b)
+          for (const auto &[i, w_i] : expansions[a])
+            for (const auto &[j, w_j] : expansions[b]) {
+              const auto w = w_i * w_j;
+              values[0] = w * copy.cell_mass_matrix_(a, b);
+              for (unsigned int d = 0; d < dim; ++d)
+                values[d + 1] = w * copy.cell_cij_matrix_[d](a, b);
+              add_entry(i, j, values);
+            }
+
+      if (have_constrained_dofs) {
+        std::fill(std::begin(values), std::end(values), Number(0.));
+        for (unsigned int a = 0; a < dofs_per_cell; ++a) {
+          values[0] += std::abs(copy.cell_mass_matrix_(a, a));
+          for (unsigned int d = 0; d < dim; ++d)
+            values[d + 1] += std::abs(copy.cell_cij_matrix_[d](a, a));
+        }
+        for (auto &value : values)
+          value /= Number(dofs_per_cell);
+
+        for (unsigned int a = 0; a < dofs_per_cell; ++a) {
+          const auto i = local_dof_indices[a];
+          if (affine_constraints_.is_constrained(i))
+            add_entry(i, i, values);
+        }
+      }
+
+      measure_of_omega_ += copy.cell_measure_;
+    };
+
+    WorkStream::run(dof_handler.begin_active(),
+                    dof_handler.end(),
+                    local_assemble_system,
+                    copy_local_to_global,
+                    AssemblyScratchData<dim>(*discretization_),
+                    AssemblyCopyData<dim, Number>());
 
-        const auto c_ij = cij_matrix_.get_tensor(i, col_idx);
+    /*
+     * Hand the collected entries over to the owning MPI ranks and add the
+     * received entries:
+     */
+
+    const auto received_entries =
+        Utilities::MPI::some_to_some(mpi_communicator_, entries_to_be_sent);
+
+    for (const auto &[rank, entries] : received_entries)
+      for (const auto &entry : entries) {
+        Assert(dof_handler.locally_owned_dofs().is_element(entry.row),
+               dealii::ExcInternalError());
+        add_entry(entry.row, entry.column, entry.values);
+      }
+
+    mass_matrix_.update_ghost_rows();
+    cij_matrix_.update_ghost_rows();
+
+    measure_of_omega_ =
+        Utilities::MPI::sum(measure_of_omega_, mpi_communicator_);
+
+    /*
+     * Create lumped mass matrix. As for the regular assembly path the
+     * lumped mass matrix is given by the row sums over all unconstrained
+     * columns of the mass matrix. This leaves a zero lumped mass on
+     * constrained degrees of freedom.
+     */
+
+    constexpr auto simd_length = VectorizedArray<Number>::size();
+    for (unsigned int i = 0; i < n_locally_owned_; ++i) {
+      Number m_i = 0.;
+      const unsigned int row_length = sparsity_pattern_simd_.row_length(i);
+      const unsigned int *js = sparsity_pattern_simd_.columns(i);
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        const auto j = *(i < n_locally_internal_ ? js + col_idx * simd_length
+                                                 : js + col_idx);
+        if (!affine_constraints_.is_constrained(
+                scalar_partitioner_->local_to_global(j)))
+          m_i += mass_matrix_.get_entry(i, col_idx);
+      }
+
+      lumped_mass_matrix_.local_element(i) = m_i;
+      lumped_mass_matrix_inverse_.local_element(i) = Number(1.) / m_i;
+    }
+    lumped_mass_matrix_.update_ghost_values();
+    lumped_mass_matrix_inverse_.update_ghost_values();
+  }
+
+
+  template <int dim, typename Number>
+  unsigned int
+  OfflineData<dim, Number>::position_within_row(const unsigned int i,
+                                                const unsigned int j) const
+  {
+    const unsigned int row_length = sparsity_pattern_simd_.row_length(i);
+    const unsigned int stride = sparsity_pattern_simd_.stride_of_row(i);
+    const unsigned int *js = sparsity_pattern_simd_.columns(i);
+    for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx)
+      if (js[col_idx * stride] == j)
+        return col_idx;
+    Assert(false, dealii::ExcInternalError());
+    return numbers::invalid_unsigned_int;
+  }
+
+
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::finalize_assembly()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::finalize_assembly()" << std::endl;
+#endif
+
+    auto &dof_handler = *dof_handler_;
+
+    /*
+     * Populate boundary map and collect coupling boundary pairs:
+     */
+    {
+      boundary_map_ = construct_boundary_map(
+          dof_handler.begin_active(), dof_handler.end(), *scalar_partitioner_);
+
+      boundary_table_ = construct_boundary_table(boundary_map_);
+    }
+
+#ifdef DEBUG
+    /*
+     * Tolerance for consistency checks of the (possibly single precision)
+     * matrices:
+     */
+    constexpr double tolerance =
+        std::is_same_v<MatrixNumber, float> ? 1.e-6 : 1.e-12;
+
+    /*
+     * Verify that we have consistent mass:
+     */
+
+    double total_mass = 0.;
+    for (unsigned int i = 0; i < n_locally_owned_; ++i)
+      total_mass += lumped_mass_matrix_.local_element(i);
+    total_mass = Utilities::MPI::sum(total_mass, mpi_communicator_);
+
+    Assert(std::abs(measure_of_omega_ - total_mass) <
+               1.e-12 * measure_of_omega_,
+           dealii::ExcMessage(
+               "Total mass differs from the measure of the domain."));
+
+    /*
+     * Verify that the mij_matrix_ object is consistent:
+     */
+
+    for (unsigned int i = 0; i < n_locally_owned_; ++i) {
+      /* Skip constrained degrees of freedom: */
+      const unsigned int row_length = sparsity_pattern_simd_.row_length(i);
+      if (row_length == 1)
+        continue;
+
+      auto sum = mass_matrix_.template get_entry<Number>(i, 0) -
+                 lumped_mass_matrix_.local_element(i);
+
+      /* skip diagonal */
+      constexpr auto simd_length = VectorizedArray<Number>::size();
+      const unsigned int *js = sparsity_pattern_simd_.columns(i);
+      for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
+        const auto j = *(i < n_locally_internal_ ? js + col_idx * simd_length
+                                                 : js + col_idx);
+        Assert(j < n_locally_relevant_, dealii::ExcInternalError());
+
+        const auto m_ij = mass_matrix_.template get_entry<Number>(i, col_idx);
+        if (discretization_->have_discontinuous_ansatz()) {
+          // Interfacial coupling terms are present in the stencil but zero
+          // in the mass matrix
+          Assert(std::abs(m_ij) > -1.e-12, dealii::ExcInternalError());
+        } else {
+          Assert(std::abs(m_ij) > 1.e-12, dealii::ExcInternalError());
+        }
+        sum += m_ij;
+
+        const auto m_ji =
+            mass_matrix_.template get_transposed_entry<Number>(i, col_idx);
+        if (std::abs(m_ij - m_ji) >= tolerance) {
+          // The m_ij matrix is not symmetric
+          std::stringstream ss;
+          ss << "m_ij matrix is not symmetric: " << m_ij << " <-> " << m_ji;
+          Assert(false, dealii::ExcMessage(ss.str()));
+        }
+      }
+
+      Assert(std::abs(sum) < tolerance, dealii::ExcInternalError());
+    }
+
+    /*
+     * Verify that the cij_matrix_ object is consistent:
+     */
+
+    for (unsigned int i = 0; i < n_locally_owned_; ++i) {
+      /* Skip constrained degrees of freedom: */
+      const unsigned int row_length = sparsity_pattern_simd_.row_length(i);
+      if (row_length == 1)
+        continue;
+
+      auto sum = cij_matrix_.template get_tensor<Number>(i, 0);
+
+      /* skip diagonal */
+      constexpr auto simd_length = VectorizedArray<Number>::size();
+      const unsigned int *js = sparsity_pattern_simd_.columns(i);
+      for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
+        const auto j = *(i < n_locally_internal_ ? js + col_idx * simd_length
+                                                 : js + col_idx);
+        Assert(j < n_locally_relevant_, dealii::ExcInternalError());
+
+        const auto c_ij = cij_matrix_.template get_tensor<Number>(i, col_idx);
         Assert(c_ij.norm() > 1.e-12, dealii::ExcInternalError());
         sum += c_ij;
 
-        const auto c_ji = cij_matrix_.get_transposed_tensor(i, col_idx);
-        if ((c_ij + c_ji).norm() >= 1.e-12) {
+        const auto c_ji =
+            cij_matrix_.template get_transposed_tensor<Number>(i, col_idx);
+        if ((c_ij + c_ji).norm() >= tolerance) {
           // The c_ij matrix is not symmetric, this can only happen if i
           // and j are both located on the boundary.
 
           CouplingDescription coupling{i, col_idx, j};
-          const auto it = std::find(coupling_boundary_pairs_.begin(),
-                                    coupling_boundary_pairs_.end(),
-                                    coupling);
-          if (it == coupling_boundary_pairs_.end()) {
+          const auto &pairs = coupling_boundary_pairs();
+          const auto it = std::find(pairs.begin(), pairs.end(), coupling);
+          if (it == pairs.end()) {
             std::stringstream ss;
             ss << "c_ij matrix is not anti-symmetric: " << c_ij << " <-> "
                << c_ji;
@@ -1099,14 +1869,449 @@ namespace ryujin
         }
       }
 
-      Assert(sum.norm() < 1.e-12, dealii::ExcInternalError());
+      Assert(sum.norm() < tolerance, dealii::ExcInternalError());
     }
 #endif
   }
 
 
   template <int dim, typename Number>
-  void OfflineData<dim, Number>::create_multigrid_data()
+  std::size_t OfflineData<dim, Number>::memory_consumption() const
+  {
+    std::size_t result = sparsity_pattern_simd_.memory_consumption();
+
+    result += mass_matrix_.memory_consumption();
+    result += mass_matrix_inverse_.memory_consumption();
+    result += cij_matrix_.memory_consumption();
+    result += incidence_matrix_.memory_consumption();
+
+    result += lumped_mass_matrix_.memory_consumption();
+    result += lumped_mass_matrix_inverse_.memory_consumption();
+    if (multigrid_data_.has_value())
+      for (const auto &it : multigrid_data_.value().level_lumped_mass_matrix)
+        result += it.memory_consumption();
+
+    return result;
+  }
+
+
+  template <int dim, typename Number>
+  std::vector<unsigned int>
+  OfflineData<dim, Number>::halo_sizes(const unsigned int n_layers) const
+  {
+    const auto &locally_owned = scalar_partitioner_->locally_owned_range();
+    IndexSet halo = scalar_partitioner_->ghost_indices();
+    IndexSet front = halo;
+
+    std::vector<unsigned int> result{(unsigned int)halo.n_elements()};
+
+    for (unsigned int layer = 1; layer < n_layers; ++layer) {
+      /* Ask the owners of the outermost layer for its stencils: */
+
+      const auto owners = Utilities::MPI::compute_index_owner(
+          locally_owned, front, mpi_communicator_);
+
+      std::map<unsigned int, std::vector<types::global_dof_index>> requests;
+      unsigned int k = 0;
+      for (const auto i : front)
+        requests[owners[k++]].push_back(i);
+
+      const auto received =
+          Utilities::MPI::some_to_some(mpi_communicator_, requests);
+
+      std::map<unsigned int, std::vector<types::global_dof_index>> stencils;
+      for (const auto &[rank, indices] : received) {
+        auto &stencil = stencils[rank];
+        for (const auto i : indices)
+          for (auto it = sparsity_pattern_.begin(i);
+               it != sparsity_pattern_.end(i);
+               ++it)
+            stencil.push_back(it->column());
+      }
+
+      const auto answers =
+          Utilities::MPI::some_to_some(mpi_communicator_, stencils);
+
+      /* The next layer consists of all new indices of these stencils: */
+
+      std::vector<types::global_dof_index> next;
+      for (const auto &[rank, columns] : answers)
+        for (const auto j : columns)
+          if (!locally_owned.is_element(j) && !halo.is_element(j))
+            next.push_back(j);
+      std::sort(next.begin(), next.end());
+      next.erase(std::unique(next.begin(), next.end()), next.end());
+
+      front = IndexSet(locally_owned.size());
+      front.add_indices(next.begin(), next.end());
+      front.compress();
+      halo.add_indices(front);
+      halo.compress();
+
+      result.push_back(halo.n_elements());
+    }
+
+    return result;
+  }
+
+
+  template <int dim, typename Number>
+  double OfflineData<dim, Number>::temporal_blocking_redundancy(
+      const unsigned int block_size, const unsigned int n_layers) const
+  {
+    AssertThrow(block_size > 0, ExcMessage("Block size must be positive"));
+
+    constexpr auto simd_length = VectorizedArray<Number>::size();
+    const unsigned int n_owned = n_locally_owned_;
+    const unsigned int n_internal = n_locally_internal_;
+
+    /* The block that reached a row last: */
+    std::vector<unsigned int> visited(n_locally_relevant_,
+                                      numbers::invalid_unsigned_int);
+    std::vector<unsigned int> front;
+    std::vector<unsigned int> next;
+
+    std::size_t n_processed = 0;
+    for (unsigned int left = 0; left < n_owned; left += block_size) {
+      const unsigned int block = left / block_size;
+      const unsigned int right = std::min(n_owned, left + block_size);
+
+      front.clear();
+      for (unsigned int i = left; i < right; ++i) {
+        visited[i] = block;
+        front.push_back(i);
+      }
+      n_processed += right - left;
+
+      for (unsigned int layer = 0; layer < n_layers; ++layer) {
+        next.clear();
+        for (const auto i : front) {
+          if (i >= n_owned)
+            continue;
+          const unsigned int row_length = sparsity_pattern_simd_.row_length(i);
+          const unsigned int *js = sparsity_pattern_simd_.columns(i);
+          for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
+            const auto j = *(i < n_internal ? js + col_idx * simd_length
+                                            : js + col_idx);
+            if (visited[j] != block) {
+              visited[j] = block;
+              next.push_back(j);
+            }
+          }
+        }
+        n_processed += next.size();
+        std::swap(front, next);
+      }
+    }
+
+    return n_owned > 0 ? double(n_processed) / double(n_owned) : 1.;
+  }
+
+
+  template <int dim, typename Number>
+  std::uint64_t OfflineData<dim, Number>::compute_cache_hash() const
+  {
+    FNV1aHash hash;
+
+    hash.add(sizeof(Number));
+    hash.add(sizeof(MatrixNumber));
+    hash.add(dim);
+    hash.add(Utilities::MPI::this_mpi_process(mpi_communicator_));
+    hash.add(Utilities::MPI::n_mpi_processes(mpi_communicator_));
+
+    hash.add(discretization_->ansatz());
+    hash.add(discretization_->finite_element().get_name());
+    const auto &quadrature = discretization_->quadrature();
+    hash.add(quadrature.size());
+    for (const auto &point : quadrature.get_points())
+      for (unsigned int d = 0; d < dim; ++d)
+        hash.add(point[d]);
+    hash.add(incidence_relaxation_even_);
+    hash.add(incidence_relaxation_odd_);
+
+    hash.add(dof_handler_->n_dofs());
+    hash.add(n_locally_owned_);
+    hash.add(n_locally_relevant_);
+    hash.add(n_locally_internal_);
+
+    /* Mesh geometry and degree of freedom numbering: */
+
+    const unsigned int dofs_per_cell =
+        discretization_->finite_element().dofs_per_cell;
+    std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+
+    for (const auto &cell : dof_handler_->active_cell_iterators()) {
+      if (cell->is_artificial())
+        continue;
+
+      for (const auto v : cell->vertex_indices())
+        for (unsigned int d = 0; d < dim; ++d)
+          hash.add(cell->vertex(v)[d]);
+
+      cell->get_dof_indices(dof_indices);
+      for (const auto index : dof_indices)
+        hash.add(index);
+    }
+
+    /* The SIMD sparsity pattern: */
+
+    for (unsigned int i = 0; i < sparsity_pattern_simd_.n_rows(); ++i) {
+      const unsigned int row_length = sparsity_pattern_simd_.row_length(i);
+      const unsigned int stride = sparsity_pattern_simd_.stride_of_row(i);
+      const unsigned int *js = sparsity_pattern_simd_.columns(i);
+      hash.add(row_length);
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx)
+        hash.add(js[col_idx * stride]);
+    }
+
+    return hash.value();
+  }
+
+
+  template <int dim, typename Number>
+  std::string
+  OfflineData<dim, Number>::cache_file_name(const std::uint64_t hash,
+                                            const std::string &prefix) const
+  {
+    std::ostringstream name;
+    name << cache_directory_ << "/" << prefix << "-" << std::hex
+         << std::setfill('0') << std::setw(16) << hash << std::dec << "-"
+         << Utilities::MPI::this_mpi_process(mpi_communicator_) << ".cache";
+    return name.str();
+  }
+
+
+  template <int dim, typename Number>
+  bool OfflineData<dim, Number>::read_cache()
+  {
+    if (cache_directory_.empty())
+      return false;
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::read_cache()" << std::endl;
+#endif
+
+    const auto hash = compute_cache_hash();
+    const auto file_name = cache_file_name(hash);
+
+    /* Only use the cache if it is available on all ranks: */
+    const unsigned int available = std::filesystem::exists(file_name);
+    if (Utilities::MPI::min(available, mpi_communicator_) == 0)
+      return false;
+
+    std::ifstream file(file_name, std::ios::binary);
+    boost::archive::binary_iarchive ia(file);
+
+    std::uint64_t stored_hash;
+    ia >> stored_hash;
+    AssertThrow(stored_hash == hash,
+                dealii::ExcMessage("Offline data cache file \"" + file_name +
+                                   "\" does not match the current "
+                                   "discretization"));
+
+    ia >> mass_matrix_;
+    if (discretization_->have_discontinuous_ansatz())
+      ia >> mass_matrix_inverse_;
+    ia >> cij_matrix_;
+    if (discretization_->have_discontinuous_ansatz())
+      ia >> incidence_matrix_;
+
+    std::vector<Number> lumped_mass_matrix;
+    ia >> lumped_mass_matrix;
+    AssertThrow(lumped_mass_matrix.size() == n_locally_owned_,
+                dealii::ExcMessage("Offline data cache file \"" + file_name +
+                                   "\" is corrupted"));
+
+    for (unsigned int i = 0; i < n_locally_owned_; ++i) {
+      lumped_mass_matrix_.local_element(i) = lumped_mass_matrix[i];
+      lumped_mass_matrix_inverse_.local_element(i) =
+          Number(1.) / lumped_mass_matrix[i];
+    }
+    lumped_mass_matrix_.update_ghost_values();
+    lumped_mass_matrix_inverse_.update_ghost_values();
+
+    ia >> measure_of_omega_;
+
+    return true;
+  }
+
+
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::write_cache() const
+  {
+    if (cache_directory_.empty())
+      return;
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::write_cache()" << std::endl;
+#endif
+
+    const auto hash = compute_cache_hash();
+    const auto file_name = cache_file_name(hash);
+
+    std::filesystem::create_directories(cache_directory_);
+
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+    boost::archive::binary_oarchive oa(file);
+
+    oa << hash;
+
+    oa << mass_matrix_;
+    if (discretization_->have_discontinuous_ansatz())
+      oa << mass_matrix_inverse_;
+    oa << cij_matrix_;
+    if (discretization_->have_discontinuous_ansatz())
+      oa << incidence_matrix_;
+
+    std::vector<Number> lumped_mass_matrix(n_locally_owned_);
+    for (unsigned int i = 0; i < n_locally_owned_; ++i)
+      lumped_mass_matrix[i] = lumped_mass_matrix_.local_element(i);
+    oa << lumped_mass_matrix;
+
+    oa << measure_of_omega_;
+  }
+
+
+  template <int dim, typename Number>
+  std::uint64_t OfflineData<dim, Number>::compute_renumbering_hash() const
+  {
+    FNV1aHash hash;
+
+    hash.add(sizeof(Number));
+    hash.add(simd_batch_length);
+    hash.add(dim);
+    hash.add(Utilities::MPI::this_mpi_process(mpi_communicator_));
+    hash.add(Utilities::MPI::n_mpi_processes(mpi_communicator_));
+
+    hash.add(discretization_->finite_element().get_name());
+    hash.add(dof_renumbering_);
+    hash.add(regrouping_passes_);
+    hash.add(dof_handler_->n_dofs());
+    hash.add(n_locally_owned_);
+
+    const unsigned int dofs_per_cell =
+        discretization_->finite_element().dofs_per_cell;
+    std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+
+    for (const auto &cell : dof_handler_->active_cell_iterators()) {
+      if (cell->is_artificial())
+        continue;
+
+      hash.add(cell->is_locally_owned());
+      for (const auto v : cell->vertex_indices())
+        for (unsigned int d = 0; d < dim; ++d)
+          hash.add(cell->vertex(v)[d]);
+
+      cell->get_dof_indices(dof_indices);
+      for (const auto index : dof_indices)
+        hash.add(index);
+    }
+
+    return hash.value();
+  }
+
+
+  template <int dim, typename Number>
+  bool
+  OfflineData<dim, Number>::read_renumbering_cache(const std::uint64_t hash)
+  {
+    if (cache_directory_.empty())
+      return false;
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::read_renumbering_cache()"
+              << std::endl;
+#endif
+
+    const auto file_name = cache_file_name(hash, "renumbering");
+
+    /* Only use the cache if it is available on all ranks: */
+    const unsigned int available = std::filesystem::exists(file_name);
+    if (Utilities::MPI::min(available, mpi_communicator_) == 0)
+      return false;
+
+    std::ifstream file(file_name, std::ios::binary);
+    boost::archive::binary_iarchive ia(file);
+
+    std::uint64_t stored_hash;
+    ia >> stored_hash;
+    AssertThrow(stored_hash == hash,
+                dealii::ExcMessage("Renumbering cache file \"" + file_name +
+                                   "\" does not match the current "
+                                   "discretization"));
+
+    std::vector<types::global_dof_index> new_numbers;
+    ia >> new_numbers;
+    AssertThrow(new_numbers.size() == n_locally_owned_,
+                dealii::ExcMessage("Renumbering cache file \"" + file_name +
+                                   "\" is corrupted"));
+
+    ia >> n_locally_internal_;
+    ia >> n_export_indices_;
+
+    dof_handler_->renumber_dofs(new_numbers);
+
+    return true;
+  }
+
+
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::write_renumbering_cache(
+      const std::uint64_t hash,
+      const IndexSet &initial_locally_owned,
+      const std::vector<types::global_dof_index> &initial_dof_indices) const
+  {
+    if (cache_directory_.empty())
+      return;
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::write_renumbering_cache()"
+              << std::endl;
+#endif
+
+    /*
+     * Reconstruct the renumbering: locally owned cells are traversed in
+     * the same order, so that we can match the final with the initial
+     * degrees of freedom of every cell:
+     */
+
+    std::vector<types::global_dof_index> new_numbers(n_locally_owned_);
+
+    const unsigned int dofs_per_cell =
+        discretization_->finite_element().dofs_per_cell;
+    std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+
+    std::size_t k = 0;
+    for (const auto &cell : dof_handler_->active_cell_iterators()) {
+      if (!cell->is_locally_owned())
+        continue;
+      cell->get_dof_indices(dof_indices);
+      for (const auto index : dof_indices) {
+        const auto initial_index = initial_dof_indices[k++];
+        if (initial_locally_owned.is_element(initial_index))
+          new_numbers[initial_locally_owned.index_within_set(initial_index)] =
+              index;
+      }
+    }
+    Assert(k == initial_dof_indices.size(), dealii::ExcInternalError());
+
+    const auto file_name = cache_file_name(hash, "renumbering");
+
+    std::filesystem::create_directories(cache_directory_);
+
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+    boost::archive::binary_oarchive oa(file);
+
+    oa << hash;
+    oa << new_numbers;
+    oa << n_locally_internal_;
+    oa << n_export_indices_;
+  }
+
+
+  template <int dim, typename Number>
+  auto OfflineData<dim, Number>::create_multigrid_data() const
+      -> MultigridData
   {
 #ifdef DEBUG_OUTPUT
     std::cout << "OfflineData<dim, Number>::create_multigrid_data()"
@@ -1122,8 +2327,11 @@ namespace ryujin
     AffineConstraints<float> level_constraints;
     // TODO not yet thread-parallel and without periodicity
 
-    level_boundary_map_.resize(n_levels);
-    level_lumped_mass_matrix_.resize(n_levels);
+    MultigridData result;
+    auto &level_boundary_map = result.level_boundary_map;
+    auto &level_lumped_mass_matrix = result.level_lumped_mass_matrix;
+    level_boundary_map.resize(n_levels);
+    level_lumped_mass_matrix.resize(n_levels);
 
     for (unsigned int level = 0; level < n_levels; ++level) {
       /* Assemble lumped mass matrix vector: */
@@ -1135,7 +2343,7 @@ namespace ryujin
           dof_handler.locally_owned_mg_dofs(level),
           relevant_dofs,
           lumped_mass_matrix_.get_mpi_communicator());
-      level_lumped_mass_matrix_[level].reinit(partitioner);
+      level_lumped_mass_matrix[level].reinit(partitioner);
       std::vector<types::global_dof_index> dof_indices(
           dof_handler.get_fe().dofs_per_cell);
       dealii::Vector<Number> mass_values(dof_handler.get_fe().dofs_per_cell);
@@ -1156,15 +2364,17 @@ namespace ryujin
           }
           cell->get_mg_dof_indices(dof_indices);
           level_constraints.distribute_local_to_global(
-              mass_values, dof_indices, level_lumped_mass_matrix_[level]);
+              mass_values, dof_indices, level_lumped_mass_matrix[level]);
         }
-      level_lumped_mass_matrix_[level].compress(VectorOperation::add);
+      level_lumped_mass_matrix[level].compress(VectorOperation::add);
 
       /* Populate boundary map: */
 
-      level_boundary_map_[level] = construct_boundary_map(
+      level_boundary_map[level] = construct_boundary_map(
           dof_handler.begin_mg(level), dof_handler.end_mg(level), *partitioner);
     }
+
+    return result;
   }
 
 
@@ -1364,6 +2574,53 @@ namespace ryujin
   }
 
 
+  template <int dim, typename Number>
+  auto OfflineData<dim, Number>::construct_boundary_table(
+      const BoundaryMap &boundary_map) const -> BoundaryTable
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::construct_boundary_table()"
+              << std::endl;
+#endif
+
+    BoundaryTable boundary_table;
+
+    const auto size = boundary_map.size();
+    boundary_table.indices.reserve(size);
+    boundary_table.ids.reserve(size);
+    for (unsigned int d = 0; d < dim; ++d) {
+      boundary_table.normals[d].reserve(size);
+      boundary_table.positions[d].reserve(size);
+    }
+
+    /*
+     * The boundary map is sorted by (local) degree of freedom index. We
+     * can thus simply start a new group whenever the index changes:
+     */
+
+    boundary_table.group_starts.push_back(0);
+    for (std::size_t k = 0; k < size; ++k) {
+      const auto &[i, normal, normal_mass, boundary_mass, id, position] =
+          boundary_map[k];
+
+      if (k > 0 && i != boundary_table.indices.back())
+        boundary_table.group_starts.push_back(k);
+
+      boundary_table.indices.push_back(i);
+      boundary_table.ids.push_back(id);
+      for (unsigned int d = 0; d < dim; ++d) {
+        boundary_table.normals[d].push_back(normal[d]);
+        boundary_table.positions[d].push_back(position[d]);
+      }
+    }
+
+    if (size > 0)
+      boundary_table.group_starts.push_back(size);
+
+    return boundary_table;
+  }
+
+
   template <int dim, typename Number>
   template <typename ITERATOR1, typename ITERATOR2>
   auto OfflineData<dim, Number>::collect_coupling_boundary_pairs(
@@ -7,14 +7,37 @@
 
 #include <compile_time_options.h>
 
+#include "trace.h"
+
 #include <deal.II/base/config.h>
 
 #ifdef WITH_OPENMP
 #include <omp.h>
 #endif
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <future>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 /**
  * @name OpenMP parallel for macros
@@ -29,12 +52,15 @@
  *
  * RYUJIN_OMP_FOR
  * for (unsigned int i = 0; i < size_internal; i += simd_length) {
- *   // parallel for loop that is statically distributed on all available
- *   // worker threads by slicing the interval [0,size_internal)
+ *   // parallel for loop that is distributed on all available worker
+ *   // threads by slicing the interval [0,size_internal)
  * }
  *
  * RYUJIN_PARALLEL_REGION_END
  * ```
+ *
+ * The loop schedule is selected at run time, see set_thread_schedule().
+ * By default a static schedule is used.
  */
 //@{
 
@@ -55,6 +81,15 @@
   RYUJIN_PRAGMA(omp parallel default(shared))                                  \
   {
 
+/**
+ * Begin an openmp parallel region with a team of @p n threads.
+ *
+ * @ingroup Miscellaneous
+ */
+#define RYUJIN_PARALLEL_REGION_BEGIN_NUM_THREADS(n)                            \
+  RYUJIN_PRAGMA(omp parallel default(shared) num_threads(n))                   \
+  {
+
 /**
  * End an openmp parallel region.
  *
@@ -67,7 +102,7 @@
  *
  * @ingroup Miscellaneous
  */
-#define RYUJIN_OMP_FOR RYUJIN_PRAGMA(omp for)
+#define RYUJIN_OMP_FOR RYUJIN_PRAGMA(omp for schedule(runtime))
 
 /**
  * Enter a parallel for loop with "nowait" declaration, i.e., the end of
@@ -76,7 +111,7 @@
  *
  * @ingroup Miscellaneous
  */
-#define RYUJIN_OMP_FOR_NOWAIT RYUJIN_PRAGMA(omp for nowait)
+#define RYUJIN_OMP_FOR_NOWAIT RYUJIN_PRAGMA(omp for schedule(runtime) nowait)
 
 /**
  * Declare an explicit Thread synchronization barrier.
@@ -134,7 +169,521 @@
 namespace ryujin
 {
   /**
-   * @todo write documentation
+   * The loop schedule used for all RYUJIN_OMP_FOR and
+   * RYUJIN_OMP_FOR_NOWAIT loops.
+   *
+   * @ingroup Miscellaneous
+   */
+  enum class ThreadSchedule {
+    /**
+     * Distribute the iteration space in contiguous chunks of equal size
+     * on all threads. This is the default.
+     */
+    static_schedule,
+
+    /**
+     * Threads grab chunks of the iteration space from a shared work
+     * queue. This compensates for varying row lengths at the cost of an
+     * atomic operation per chunk.
+     */
+    dynamic_schedule,
+
+    /**
+     * Like dynamic_schedule but with exponentially decreasing chunk
+     * sizes.
+     */
+    guided_schedule,
+  };
+
+
+  /**
+   * Set the loop schedule for all subsequently created parallel regions
+   * of the calling thread. A @p chunk_size of 0 selects the default chunk
+   * size of the OpenMP runtime.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline void
+  set_thread_schedule(const ThreadSchedule schedule [[maybe_unused]],
+                      const unsigned int chunk_size [[maybe_unused]])
+  {
+#ifdef WITH_OPENMP
+    omp_sched_t kind = omp_sched_static;
+    if (schedule == ThreadSchedule::dynamic_schedule)
+      kind = omp_sched_dynamic;
+    else if (schedule == ThreadSchedule::guided_schedule)
+      kind = omp_sched_guided;
+    omp_set_schedule(kind, chunk_size);
+#endif
+  }
+
+
+  /**
+   * Return the number of the calling thread within the current thread
+   * team, or 0 if OpenMP support is disabled.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline unsigned int thread_number()
+  {
+#ifdef WITH_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+  }
+
+
+  /**
+   * Return the maximal number of threads of a parallel region, or 1 if
+   * OpenMP support is disabled.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline unsigned int max_threads()
+  {
+#ifdef WITH_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+
+  /**
+   * The thread placement of an MPI rank as returned by pin_threads().
+   *
+   * @ingroup Miscellaneous
+   */
+  struct ThreadAffinity {
+    /**
+     * The CPUs of the affinity mask of the process (as set by the MPI
+     * launcher or the batch system). Empty if unknown.
+     */
+    std::vector<int> cpuset;
+
+    /**
+     * The CPU every OpenMP thread is pinned to, or -1 if the thread has
+     * not been pinned.
+     */
+    std::vector<int> thread_cpus;
+  };
+
+
+  /**
+   * Return the CPUs of the affinity mask of the calling thread. Returns
+   * an empty vector on platforms other than Linux.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline std::vector<int> affinity_cpuset()
+  {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        if (CPU_ISSET(cpu, &mask))
+          cpus.push_back(cpu);
+#endif
+    return cpus;
+  }
+
+
+  /**
+   * Return a compact string representation of a (sorted) list of CPUs,
+   * for example "0-7,16-23".
+   *
+   * @ingroup Miscellaneous
+   */
+  inline std::string cpu_list_string(const std::vector<int> &cpus)
+  {
+    std::string result;
+    for (std::size_t k = 0; k < cpus.size();) {
+      std::size_t l = k;
+      while (l + 1 < cpus.size() && cpus[l + 1] == cpus[l] + 1)
+        ++l;
+      result += (result.empty() ? "" : ",") + std::to_string(cpus[k]);
+      if (l != k)
+        result += "-" + std::to_string(cpus[l]);
+      k = l + 1;
+    }
+    return result.empty() ? "?" : result;
+  }
+
+
+  /**
+   * Limit the number of OpenMP threads to the size of the affinity mask
+   * of the calling process, and if @p pin is set to true pin all OpenMP
+   * threads compactly to the CPUs of the mask: thread k is pinned to the
+   * k-th CPU of the mask.
+   *
+   * The calling (master) thread keeps the complete affinity mask: The
+   * threads of the TBB pool are created by the master thread and inherit
+   * its mask, so that TBB stays confined to the same cpuset. The kernel
+   * keeps the master thread on the one CPU the worker threads leave
+   * free.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline ThreadAffinity pin_threads(const bool pin [[maybe_unused]])
+  {
+    ThreadAffinity affinity;
+    affinity.cpuset = affinity_cpuset();
+    affinity.thread_cpus.assign(max_threads(), -1);
+
+#ifdef WITH_OPENMP
+    const unsigned int n_cpus = affinity.cpuset.size();
+    if (n_cpus != 0 && n_cpus < affinity.thread_cpus.size()) {
+      omp_set_num_threads(n_cpus);
+      affinity.thread_cpus.resize(n_cpus);
+    }
+
+#ifdef __linux__
+    if (pin && n_cpus != 0) {
+#pragma omp parallel default(shared)
+      {
+        const unsigned int k = omp_get_thread_num();
+        if (k != 0 && k < affinity.thread_cpus.size()) {
+          cpu_set_t mask;
+          CPU_ZERO(&mask);
+          CPU_SET(affinity.cpuset[k], &mask);
+          if (sched_setaffinity(0, sizeof(mask), &mask) == 0)
+            affinity.thread_cpus[k] = affinity.cpuset[k];
+        }
+      }
+    }
+#endif
+#endif
+
+    return affinity;
+  }
+
+
+  /**
+   * A partition of the loop range [left, right) with a given stride into
+   * blocks that are distributed over the threads of a RYUJIN_OMP_FOR
+   * loop:
+   * @code
+   * const ThreadBlocks blocks(boundaries, left, right, stride);
+   * RYUJIN_OMP_FOR
+   * for (unsigned int b = 0; b < blocks.size(); ++b) {
+   *   for (unsigned int i = blocks.begin(b); i < blocks.end(b); i += stride)
+   *     ...
+   * }
+   * @endcode
+   * If @p boundaries is empty every block consists of a single stride and
+   * the loop behaves exactly like a RYUJIN_OMP_FOR loop over [left,
+   * right). Otherwise, block b is [boundaries[b], boundaries[b + 1])
+   * intersected with [left, right). With the static schedule and one
+   * block per thread every thread thus processes exactly one
+   * (precomputed, load balanced) block.
+   *
+   * @pre All boundaries within [left, right) have to be an integer
+   * multiple of @p stride away from @p left.
+   *
+   * @ingroup Miscellaneous
+   */
+  class ThreadBlocks
+  {
+  public:
+    ThreadBlocks(const std::vector<unsigned int> &boundaries,
+                 const unsigned int left,
+                 const unsigned int right,
+                 const unsigned int stride)
+        : boundaries_(boundaries)
+        , left_(left)
+        , right_(right)
+        , stride_(stride)
+    {
+    }
+
+    unsigned int size() const
+    {
+      if (boundaries_.empty())
+        return (right_ - left_ + stride_ - 1) / stride_;
+      return boundaries_.size() - 1;
+    }
+
+    unsigned int begin(const unsigned int block) const
+    {
+      if (boundaries_.empty())
+        return left_ + block * stride_;
+      return std::clamp(boundaries_[block], left_, right_);
+    }
+
+    unsigned int end(const unsigned int block) const
+    {
+      if (boundaries_.empty())
+        return std::min(left_ + (block + 1) * stride_, right_);
+      return std::clamp(boundaries_[block + 1], left_, right_);
+    }
+
+  private:
+    const std::vector<unsigned int> &boundaries_;
+    const unsigned int left_;
+    const unsigned int right_;
+    const unsigned int stride_;
+  };
+
+
+  /**
+   * Advise the kernel to back the memory range [@p begin, @p begin +
+   * @p bytes) with transparent huge pages (via madvise). Only the part of
+   * the range covering full pages is advised. The function is a no-op
+   * unless ryujin is configured with TRANSPARENT_HUGE_PAGES on Linux.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline void advise_huge_pages(const void *begin [[maybe_unused]],
+                                const std::size_t bytes [[maybe_unused]])
+  {
+#if defined(TRANSPARENT_HUGE_PAGES) && defined(__linux__)
+    const auto page_size = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto first = (reinterpret_cast<std::uintptr_t>(begin) + page_size -
+                        1) / page_size * page_size;
+    const auto last =
+        (reinterpret_cast<std::uintptr_t>(begin) + bytes) / page_size *
+        page_size;
+    if (first < last)
+      madvise(reinterpret_cast<void *>(first), last - first, MADV_HUGEPAGE);
+#endif
+  }
+
+
+  /**
+   * Zero-initialize the array [@p data, @p data + @p size) with a
+   * RYUJIN_OMP_FOR loop. The first write to a memory page determines the
+   * NUMA node the page is placed on. This function thus distributes the
+   * pages over the NUMA nodes following the static partition used by
+   * RYUJIN_OMP_FOR loops over the same index range, provided that the
+   * pages have not been touched before. The array is additionally
+   * advised to be backed by transparent huge pages, see
+   * advise_huge_pages().
+   *
+   * @note The function has to be called from a serial context.
+   *
+   * @ingroup Miscellaneous
+   */
+  template <typename T>
+  void first_touch(T *data, const std::size_t size)
+  {
+    advise_huge_pages(data, size * sizeof(T));
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+    RYUJIN_OMP_FOR
+    for (std::size_t i = 0; i < size; ++i)
+      data[i] = T(0);
+    RYUJIN_PARALLEL_REGION_END
+  }
+
+
+  /**
+   * Measure the sustainable main memory bandwidth (in bytes per second)
+   * of the calling process with a STREAM-style triad a[i] = b[i] + s *
+   * c[i] over three arrays of @p size doubles each, executed as a
+   * RYUJIN_OMP_FOR loop over all threads. The arrays are placed with
+   * first_touch(), and the best of @p n_repetitions sweeps is reported.
+   * Following the STREAM convention, write-allocate traffic is not
+   * accounted for.
+   *
+   * @note The function has to be called from a serial context.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline double stream_triad_bandwidth(const std::size_t size = 1 << 24,
+                                       const unsigned int n_repetitions = 5)
+  {
+    /* Default initialized, i.e., the pages are not touched yet: */
+    std::unique_ptr<double[]> a(new double[size]);
+    std::unique_ptr<double[]> b(new double[size]);
+    std::unique_ptr<double[]> c(new double[size]);
+    first_touch(a.get(), size);
+    first_touch(b.get(), size);
+    first_touch(c.get(), size);
+
+    double best = std::numeric_limits<double>::max();
+    for (unsigned int n = 0; n < n_repetitions; ++n) {
+      const auto start = std::chrono::steady_clock::now();
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+      RYUJIN_OMP_FOR
+      for (std::size_t i = 0; i < size; ++i)
+        a[i] = b[i] + 3. * c[i];
+      RYUJIN_PARALLEL_REGION_END
+
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+      best = std::min(best, elapsed.count());
+    }
+
+    return 3. * sizeof(double) * size / best;
+  }
+
+
+  /**
+   * Return a histogram of the NUMA nodes the memory pages of the range
+   * [@p begin, @p begin + @p bytes) are located on. At most @p n_samples
+   * evenly spaced pages are queried. The map is empty if the
+   * information is not available (for example, on non-Linux systems).
+   *
+   * @ingroup Miscellaneous
+   */
+  inline std::map<int, unsigned int>
+  numa_page_distribution(const void *begin [[maybe_unused]],
+                         const std::size_t bytes [[maybe_unused]],
+                         const unsigned int n_samples [[maybe_unused]] = 256)
+  {
+    std::map<int, unsigned int> histogram;
+#ifdef __linux__
+    const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const std::size_t n_pages = bytes / page_size;
+    const std::size_t step = std::max<std::size_t>(1, n_pages / n_samples);
+    for (std::size_t page = 0; page < n_pages; page += step) {
+      const char *address = static_cast<const char *>(begin) + page * page_size;
+      int node = -1;
+      if (syscall(SYS_get_mempolicy,
+                  &node,
+                  nullptr,
+                  0,
+                  address,
+                  MPOL_F_NODE | MPOL_F_ADDR) != 0)
+        return {};
+      histogram[node]++;
+    }
+#endif
+    return histogram;
+  }
+
+
+  /**
+   * Busy wait until @p predicate (typically the load of a std::atomic
+   * that is set by another thread of the same parallel region) returns
+   * true. The thread yields its time slice after a short while of
+   * spinning so that an oversubscribed machine still makes progress.
+   *
+   * @ingroup Miscellaneous
+   */
+  template <typename Predicate>
+  DEAL_II_ALWAYS_INLINE inline void spin_wait(const Predicate &predicate)
+  {
+    for (unsigned int n = 0; !predicate(); ++n)
+      if (n >= 1024)
+        std::this_thread::yield();
+  }
+
+
+  /**
+   * A long-lived worker thread executing tasks in the order they were
+   * posted. The thread is started on construction. The destructor
+   * executes all remaining tasks and joins the thread.
+   *
+   * @ingroup Miscellaneous
+   */
+  class WorkerThread
+  {
+  public:
+    WorkerThread()
+        : stop_(false)
+        , thread_([this]() { run(); })
+    {
+    }
+
+    ~WorkerThread()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      condition_.notify_one();
+      thread_.join();
+    }
+
+    /**
+     * Post a task to the queue and return a future that becomes ready
+     * once the task has been executed. Several tasks can be in flight at
+     * the same time.
+     */
+    std::future<void> post(const std::function<void()> &payload)
+    {
+      std::packaged_task<void()> task(payload);
+      auto future = task.get_future();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(task));
+      }
+      condition_.notify_one();
+      return future;
+    }
+
+    WorkerThread(const WorkerThread &) = delete;
+    WorkerThread &operator=(const WorkerThread &) = delete;
+
+  private:
+    void run()
+    {
+      while (true) {
+        std::packaged_task<void()> task;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          condition_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+          if (queue_.empty())
+            return;
+          task = std::move(queue_.front());
+          queue_.pop_front();
+        }
+        task();
+      }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::packaged_task<void()>> queue_;
+    bool stop_;
+    std::thread thread_;
+  };
+
+
+  /**
+   * The worker thread executing (MPI communication) tasks. The thread is
+   * started on first use and joined at program exit.
+   *
+   * Compared to launching a new thread for every task (via std::async)
+   * this avoids the thread creation overhead and guarantees that at most
+   * one thread other than the main thread issues MPI calls at a time.
+   * The latter is compatible with MPI_THREAD_SERIALIZED.
+   *
+   * @ingroup Miscellaneous
+   */
+  class CommunicationThread : public WorkerThread
+  {
+  public:
+    /**
+     * Return a reference to the (sole) communication thread.
+     */
+    static CommunicationThread &instance()
+    {
+      static CommunicationThread communication_thread;
+      return communication_thread;
+    }
+
+  private:
+    CommunicationThread() = default;
+  };
+
+
+  /**
+   * A small helper class for overlapping an MPI ghost exchange with a
+   * thread-parallel loop.
+   *
+   * Every thread signals via check() once it has processed all indices
+   * the exchange depends on. As soon as all threads are ready the
+   * payload is posted to the CommunicationThread. The destructor (that
+   * has to be called in serial context) waits for the payload to
+   * complete, or executes it synchronously if it hasn't been posted.
+   * Both the payload and the wait are recorded in the timeline trace
+   * (see Tracer).
    *
    * @ingroup Miscellaneous
    */
@@ -142,7 +691,10 @@ namespace ryujin
   {
   public:
     SynchronizationDispatch(const std::function<void()> &async_payload)
-        : async_payload_(async_payload)
+        : async_payload_([async_payload]() {
+          TraceScope trace("dispatch payload");
+          async_payload();
+        })
         , n_threads_ready_(0)
     {
     }
@@ -152,6 +704,7 @@ namespace ryujin
       /* Executes in serial, non thread-parallel context: */
 
       if (payload_status_.valid()) {
+        TraceScope trace("dispatch wait");
         payload_status_.wait();
       } else {
         async_payload_();
@@ -168,7 +721,8 @@ namespace ryujin
 #ifdef WITH_OPENMP
         if (++n_threads_ready_ == omp_get_num_threads())
 #endif
-          payload_status_ = std::async(std::launch::async, async_payload_);
+          payload_status_ =
+              CommunicationThread::instance().post(async_payload_);
       }
     }
 #else
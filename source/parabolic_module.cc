@@ -6,14 +6,14 @@
 #include "parabolic_module.template.h"
 #include <instantiate.h>
 
-#define INSTANTIATE(dim, stages)                                               \
-  template void ParabolicModule<Description, dim, NUMBER>::step<stages>(       \
+#define INSTANTIATE(Number, dim, stages)                                       \
+  template void ParabolicModule<Description, dim, Number>::step<stages>(       \
       const StateVector &,                                                     \
-      const NUMBER,                                                            \
+      const Number,                                                            \
       std::array<std::reference_wrapper<const StateVector>, stages>,           \
-      const std::array<NUMBER, stages>,                                        \
+      const std::array<Number, stages>,                                        \
       StateVector &,                                                           \
-      NUMBER) const
+      Number) const
 
 namespace ryujin
 {
@@ -22,19 +22,40 @@ namespace ryujin
   template class ParabolicModule<Description, 2, NUMBER>;
   template class ParabolicModule<Description, 3, NUMBER>;
 
-  INSTANTIATE(1, 0);
-  INSTANTIATE(1, 1);
-  INSTANTIATE(1, 2);
-  INSTANTIATE(1, 3);
+  INSTANTIATE(NUMBER, 1, 0);
+  INSTANTIATE(NUMBER, 1, 1);
+  INSTANTIATE(NUMBER, 1, 2);
+  INSTANTIATE(NUMBER, 1, 3);
 
-  INSTANTIATE(2, 0);
-  INSTANTIATE(2, 1);
-  INSTANTIATE(2, 2);
-  INSTANTIATE(2, 3);
+  INSTANTIATE(NUMBER, 2, 0);
+  INSTANTIATE(NUMBER, 2, 1);
+  INSTANTIATE(NUMBER, 2, 2);
+  INSTANTIATE(NUMBER, 2, 3);
 
-  INSTANTIATE(3, 0);
-  INSTANTIATE(3, 1);
-  INSTANTIATE(3, 2);
-  INSTANTIATE(3, 3);
+  INSTANTIATE(NUMBER, 3, 0);
+  INSTANTIATE(NUMBER, 3, 1);
+  INSTANTIATE(NUMBER, 3, 2);
+  INSTANTIATE(NUMBER, 3, 3);
+
+#ifdef RUNTIME_PRECISION
+  template class ParabolicModule<Description, 1, ALTERNATIVE_NUMBER>;
+  template class ParabolicModule<Description, 2, ALTERNATIVE_NUMBER>;
+  template class ParabolicModule<Description, 3, ALTERNATIVE_NUMBER>;
+
+  INSTANTIATE(ALTERNATIVE_NUMBER, 1, 0);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 1, 1);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 1, 2);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 1, 3);
+
+  INSTANTIATE(ALTERNATIVE_NUMBER, 2, 0);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 2, 1);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 2, 2);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 2, 3);
+
+  INSTANTIATE(ALTERNATIVE_NUMBER, 3, 0);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 3, 1);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 3, 2);
+  INSTANTIATE(ALTERNATIVE_NUMBER, 3, 3);
+#endif
 
 } /* namespace ryujin */
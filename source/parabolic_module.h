@@ -60,7 +60,7 @@ namespace ryujin
      */
     ParabolicModule(
         const MPI_Comm &mpi_communicator,
-        std::map<std::string, dealii::Timer> &computing_timer,
+        std::map<std::string, SectionTimer> &computing_timer,
         const OfflineData<dim, Number> &offline_data,
         const HyperbolicSystem &hyperbolic_system,
         const ParabolicSystem &parabolic_system,
@@ -105,6 +105,13 @@ namespace ryujin
      */
     void print_solver_statistics(std::ostream &output) const;
 
+    /**
+     * Return an estimate of the (rank-local) memory consumption in bytes
+     * of the parabolic solver (including multigrid levels). Returns 0 if
+     * the parabolic system is the identity.
+     */
+    std::size_t memory_consumption() const;
+
     //@}
     /**
      * @name Accessors
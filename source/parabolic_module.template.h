@@ -14,7 +14,7 @@ namespace ryujin
   template <typename Description, int dim, typename Number>
   ParabolicModule<Description, dim, Number>::ParabolicModule(
       const MPI_Comm &mpi_communicator,
-      std::map<std::string, dealii::Timer> &computing_timer,
+      std::map<std::string, SectionTimer> &computing_timer,
       const OfflineData<dim, Number> &offline_data,
       const HyperbolicSystem &hyperbolic_system,
       const ParabolicSystem &parabolic_system,
@@ -95,4 +95,16 @@ namespace ryujin
     }
   }
 
+
+  template <typename Description, int dim, typename Number>
+  std::size_t
+  ParabolicModule<Description, dim, Number>::memory_consumption() const
+  {
+    if constexpr (!ParabolicSystem::is_identity) {
+      return parabolic_solver_.memory_consumption();
+    } else {
+      return 0;
+    }
+  }
+
 } /* namespace ryujin */
@@ -0,0 +1,188 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include "openmp.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#ifdef PERF_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace ryujin
+{
+  /**
+   * Hardware performance counters of all threads of the OpenMP thread
+   * pool, read via the Linux perf_event interface. Contrary to the
+   * LIKWID marker API this neither requires an external library nor a
+   * wrapper program; it only requires the kernel to permit user space
+   * measurements of the calling process (see
+   * /proc/sys/kernel/perf_event_paranoid).
+   *
+   * Every thread of the pool opens one group of the generic hardware
+   * events listed in Event (counting user space only). read() returns
+   * the current counter values summed over all threads. SectionTimer
+   * records the difference between start() and stop(), so that all
+   * Scope regions report counters under their timer names.
+   *
+   * The class is a no-op unless ryujin is configured with
+   * PERF_COUNTERS.
+   *
+   * @note Threads waiting in an OpenMP barrier keep spinning for a while
+   * and thus contribute cycles and instructions.
+   *
+   * @ingroup Miscellaneous
+   */
+  class PerfCounters
+  {
+  public:
+    /**
+     * The recorded (generic) hardware events.
+     */
+    enum Event : unsigned int {
+      cycles = 0,
+      instructions = 1,
+      cache_references = 2,
+      cache_misses = 3,
+      n_events = 4
+    };
+
+    using Values = std::array<std::uint64_t, n_events>;
+
+    /**
+     * Return a reference to the (sole) instance.
+     */
+    static PerfCounters &instance()
+    {
+      static PerfCounters perf_counters;
+      return perf_counters;
+    }
+
+    /**
+     * Open and enable the counters on every thread of the OpenMP thread
+     * pool. This function has to be called in serial context after the
+     * number of threads has been fixed. Returns false (and disables the
+     * counters) if the events cannot be opened on all threads.
+     */
+    bool initialize()
+    {
+#ifdef PERF_COUNTERS
+      close();
+
+      std::vector<int> fds(max_threads() * n_events, -1);
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+      {
+        const unsigned int thread = thread_number();
+        constexpr std::array<std::uint64_t, n_events> configs{
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_REFERENCES,
+            PERF_COUNT_HW_CACHE_MISSES};
+
+        int *thread_fds = fds.data() + thread * n_events;
+        for (unsigned int e = 0; e < n_events; ++e) {
+          perf_event_attr attr;
+          std::memset(&attr, 0, sizeof(attr));
+          attr.type = PERF_TYPE_HARDWARE;
+          attr.size = sizeof(attr);
+          attr.config = configs[e];
+          attr.disabled = (e == 0);
+          attr.exclude_kernel = 1;
+          attr.exclude_hv = 1;
+          attr.read_format = PERF_FORMAT_GROUP;
+
+          /* Monitor the calling thread on any CPU: */
+          const int leader = (e == 0) ? -1 : thread_fds[0];
+          thread_fds[e] =
+              syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+          if (thread_fds[e] < 0)
+            break;
+        }
+
+        if (thread_fds[n_events - 1] >= 0)
+          ioctl(thread_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+      }
+      RYUJIN_PARALLEL_REGION_END
+
+      fds_ = std::move(fds);
+      for (const auto fd : fds_)
+        if (fd < 0) {
+          close();
+          return false;
+        }
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    /**
+     * Return true if counters are recorded.
+     */
+    bool active() const
+    {
+      return !fds_.empty();
+    }
+
+    /**
+     * Return the current counter values summed over all threads, or zero
+     * if the counters are not active.
+     */
+    Values read() const
+    {
+      Values result{};
+#ifdef PERF_COUNTERS
+      struct {
+        std::uint64_t nr;
+        std::uint64_t values[n_events];
+      } group;
+
+      for (std::size_t k = 0; k < fds_.size(); k += n_events) {
+        if (::read(fds_[k], &group, sizeof(group)) != sizeof(group))
+          continue;
+        for (unsigned int e = 0; e < n_events; ++e)
+          result[e] += group.values[e];
+      }
+#endif
+      return result;
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+  private:
+    PerfCounters() = default;
+
+    ~PerfCounters()
+    {
+      close();
+    }
+
+    void close()
+    {
+#ifdef PERF_COUNTERS
+      for (const auto fd : fds_)
+        if (fd >= 0)
+          ::close(fd);
+#endif
+      fds_.clear();
+    }
+
+    /* The file descriptors of all threads, n_events per thread: */
+    std::vector<int> fds_;
+  };
+} // namespace ryujin
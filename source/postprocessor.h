@@ -64,6 +64,8 @@ namespace ryujin
 
     using ScalarVector = Vectors::ScalarVector<Number>;
 
+    using ScalarVectorFloat = Vectors::ScalarVector<float>;
+
     //@}
     /**
      * @name Constructor and setup
@@ -83,8 +85,9 @@ namespace ryujin
      * Prepare Postprocessor. A call to @ref prepare() allocates temporary
      * storage and is necessary before schedule_output() can be called.
      *
-     * Calling prepare() allocates temporary storage for two additional
-     * scalar vectors of type OfflineData::scalar_type.
+     * Calling prepare() allocates storage for one single precision scalar
+     * vector (of type OfflineData::ScalarVectorFloat) per computed
+     * quantity.
      */
     void prepare();
 
@@ -130,10 +133,31 @@ namespace ryujin
 
     /**
      * Returns a reference to the quantities_ vector that has been filled
-     * by the compute() function.
+     * by the compute() function. All quantities are normalized to the
+     * range [-1, 1] and thus stored in single precision, which is
+     * sufficient for visualization.
      */
     ACCESSOR_READ_ONLY(quantities)
 
+    /**
+     * Returns the scalar partitioner used for all computed quantities.
+     * It is equivalent to OfflineData::scalar_partitioner() but
+     * communicates over the communicator passed to the constructor.
+     */
+    ACCESSOR_READ_ONLY(partitioner)
+
+    /**
+     * Return an estimate of the (rank-local) memory consumption in bytes
+     * of all postprocessed quantities.
+     */
+    std::size_t memory_consumption() const
+    {
+      std::size_t result = 0;
+      for (const auto &it : quantities_)
+        result += it.memory_consumption();
+      return result;
+    }
+
 
   private:
     /**
@@ -163,8 +187,10 @@ namespace ryujin
     std::vector<std::pair<bool /*primitive*/, unsigned int>> schlieren_indices_;
     std::vector<std::pair<bool /*primitive*/, unsigned int>> vorticity_indices_;
 
+    std::shared_ptr<const dealii::Utilities::MPI::Partitioner> partitioner_;
+
     mutable std::vector<std::pair<Number, Number>> bounds_;
-    mutable std::vector<ScalarVector> quantities_;
+    mutable std::vector<ScalarVectorFloat> quantities_;
     //@}
   };
 
@@ -10,6 +10,7 @@
 #include <simd.h>
 
 #include <deal.II/base/function_parser.h>
+#include <deal.II/lac/affine_constraints.templates.h>
 #include <deal.II/numerics/data_out.h>
 #include <deal.II/numerics/vector_tools.h>
 
@@ -96,11 +97,21 @@ namespace ryujin
     populate(schlieren_quantities_, schlieren_indices_, "schlieren_");
     populate(vorticity_quantities_, vorticity_indices_, "vorticity_");
 
-    const auto &partitioner = offline_data_->scalar_partitioner();
+    /*
+     * Set up a copy of the scalar partitioner that communicates over our
+     * own (possibly duplicated) communicator. This way ghost updates of
+     * computed quantities never interleave with communication issued on
+     * the main communicator:
+     */
+    const auto &scalar_partitioner = offline_data_->scalar_partitioner();
+    partitioner_ = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+        scalar_partitioner->locally_owned_range(),
+        scalar_partitioner->ghost_indices(),
+        mpi_communicator_);
 
     quantities_.resize(component_names_.size());
     for (auto &it : quantities_)
-      it.reinit(partitioner);
+      it.reinit(partitioner_);
   }
 
 
@@ -114,7 +125,7 @@ namespace ryujin
 
     const auto &U = std::get<0>(state_vector);
 
-    using VA = dealii::VectorizedArray<Number>;
+    using VA = VectorizedArray<Number>;
 
     const auto &affine_constraints = offline_data_->affine_constraints();
 
@@ -135,13 +146,31 @@ namespace ryujin
     Assert(n_quantities == quantities_.size(), dealii::ExcInternalError());
     Assert(n_quantities == component_names_.size(), dealii::ExcInternalError());
 
+    /* Force recomputation of bounds: */
+    if (recompute_bounds_)
+      bounds_.clear();
+
+    const bool compute_bounds = (bounds_.size() != n_quantities);
+
     /*
-     * Step 1: Compute quantities:
+     * Step 1: Compute quantities and local bounds:
+     *
+     * We sweep once over the cij_matrix computing all requested gradients
+     * and curls simultaneously, and record (thread) local bounds of the
+     * computed quantities on the fly.
      */
 
+    std::vector<Number> local_q_max(n_quantities, Number(0.));
+    std::vector<Number> local_q_min(n_quantities,
+                                    std::numeric_limits<Number>::max());
+
     {
       RYUJIN_PARALLEL_REGION_BEGIN
 
+      std::vector<Number> thread_q_max(n_quantities, Number(0.));
+      std::vector<Number> thread_q_min(n_quantities,
+                                       std::numeric_limits<Number>::max());
+
       auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
         using T = decltype(sentinel);
         unsigned int stride_size = get_stride_size<T>;
@@ -149,7 +178,26 @@ namespace ryujin
         std::vector<grad_type<T>> local_schlieren_values(n_schlieren);
         std::vector<curl_type<T>> local_vorticity_values(n_vorticities);
 
-        RYUJIN_OMP_FOR
+        std::vector<T> q_max(n_quantities, T(0.));
+        std::vector<T> q_min(n_quantities,
+                             T(std::numeric_limits<Number>::max()));
+
+        /* Store a value in single precision and record local bounds: */
+        const auto record =
+            [&](const unsigned int k, const T &value_i, const unsigned int i) {
+              if constexpr (std::is_same_v<T, Number>) {
+                quantities_[k].local_element(i) = value_i;
+              } else {
+                for (unsigned int l = 0; l < stride_size; ++l)
+                  quantities_[k].local_element(i + l) = value_i[l];
+              }
+
+              const auto abs_value = std::abs(value_i);
+              q_max[k] = std::max(q_max[k], abs_value);
+              q_min[k] = std::min(q_min[k], abs_value);
+            };
+
+        RYUJIN_OMP_FOR_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           for (auto &it : local_schlieren_values)
@@ -200,15 +248,28 @@ namespace ryujin
 
           for (const auto &schlieren : local_schlieren_values) {
             const auto value_i = schlieren.norm() / m_i;
-            write_entry<T>(quantities_[k++], value_i, i);
+            record(k++, value_i, i);
           }
 
           for (const auto &vorticity : local_vorticity_values) {
             auto value_i =
                 (dim == 2 ? vorticity[0] / m_i : vorticity.norm() / m_i);
-            write_entry<T>(quantities_[k++], value_i, i);
+            record(k++, value_i, i);
           }
         } /* i */
+
+        /* Fold (vectorized) bounds into thread local bounds: */
+        for (unsigned int k = 0; k < n_quantities; ++k) {
+          if constexpr (std::is_same_v<T, Number>) {
+            thread_q_max[k] = std::max(thread_q_max[k], q_max[k]);
+            thread_q_min[k] = std::min(thread_q_min[k], q_min[k]);
+          } else {
+            for (unsigned int l = 0; l < stride_size; ++l) {
+              thread_q_max[k] = std::max(thread_q_max[k], q_max[k][l]);
+              thread_q_min[k] = std::min(thread_q_min[k], q_min[k][l]);
+            }
+          }
+        }
       };
 
       /* Parallel non-vectorized loop: */
@@ -216,33 +277,36 @@ namespace ryujin
       /* Parallel vectorized SIMD loop: */
       loop(VA(), 0, n_internal);
 
+      RYUJIN_OMP_CRITICAL
+      for (unsigned int k = 0; k < n_quantities; ++k) {
+        local_q_max[k] = std::max(local_q_max[k], thread_q_max[k]);
+        local_q_min[k] = std::min(local_q_min[k], thread_q_min[k]);
+      }
+
       RYUJIN_PARALLEL_REGION_END
     }
 
     /*
-     * Step 2: Compute bounds and synchronize over MPI ranks:
+     * Step 2: Synchronize bounds over MPI ranks:
+     *
+     * We pack maxima and (negated) minima into a single buffer and
+     * synchronize all bounds with a single reduction.
      */
 
-    /* Force recomputation of bounds: */
-    if (recompute_bounds_)
-      bounds_.clear();
+    if (compute_bounds) {
+      std::vector<Number> buffer(2 * n_quantities);
+      for (unsigned int k = 0; k < n_quantities; ++k) {
+        buffer[k] = local_q_max[k];
+        buffer[n_quantities + k] = -local_q_min[k];
+      }
 
-    if (bounds_.size() != n_quantities) {
-      bounds_.clear();
-      bounds_.resize(
-          n_quantities,
-          std::make_pair(Number(0.), std::numeric_limits<Number>::max()));
-
-      for (unsigned int d = 0; d < n_quantities; ++d) {
-        auto &[q_max, q_min] = bounds_[d];
-        for (unsigned int i = 0; i < n_owned; ++i) {
-          const auto q = quantities_[d].local_element(i);
-          q_max = std::max(q_max, std::abs(q));
-          q_min = std::min(q_min, std::abs(q));
-        }
-        q_max = dealii::Utilities::MPI::max(q_max, mpi_communicator_);
-        q_min = dealii::Utilities::MPI::min(q_min, mpi_communicator_);
-        Assert(q_max >= q_min, dealii::ExcInternalError());
+      dealii::Utilities::MPI::max(buffer, mpi_communicator_, buffer);
+
+      bounds_.resize(n_quantities);
+      for (unsigned int k = 0; k < n_quantities; ++k) {
+        bounds_[k] = {buffer[k], -buffer[n_quantities + k]};
+        Assert(bounds_[k].first >= bounds_[k].second,
+               dealii::ExcInternalError());
       }
     }
 
@@ -254,18 +318,24 @@ namespace ryujin
       constexpr Number eps = std::numeric_limits<Number>::epsilon();
       constexpr Number floor = std::max(Number(1.0e-10), eps);
 
-      for (unsigned int d = 0; d < n_quantities; ++d) {
-        auto &[q_max, q_min] = bounds_[d];
-        for (unsigned int i = 0; i < n_owned; ++i) {
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      RYUJIN_OMP_FOR
+      for (unsigned int i = 0; i < n_owned; ++i) {
+        for (unsigned int d = 0; d < n_quantities; ++d) {
+          const auto &[q_max, q_min] = bounds_[d];
           auto &q = quantities_[d].local_element(i);
           /* clip off everything that is below the noise "floor": */
-          const auto ratio = std::max(Number(0.), std::abs(q) - q_min - floor) /
-                             std::max(q_max - q_min, eps);
+          const auto ratio =
+              std::max(Number(0.), std::abs(Number(q)) - q_min - floor) /
+              std::max(q_max - q_min, eps);
 
           const auto magnitude = Number(1.) - std::exp(-beta_ * ratio);
-          q = std::copysign(magnitude, q);
+          q = std::copysign(magnitude, Number(q));
         }
       }
+
+      RYUJIN_PARALLEL_REGION_END
     }
 
     /*
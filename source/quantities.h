@@ -8,7 +8,9 @@
 #include <compile_time_options.h>
 
 #include "offline_data.h"
+#include "patterns_conversion.h"
 
+#include <deal.II/base/mpi_remote_point_evaluation.h>
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/base/timer.h>
@@ -16,8 +18,42 @@
 #include <deal.II/lac/sparse_matrix.templates.h>
 #include <deal.II/lac/vector.h>
 
+#include <fstream>
 #include <optional>
 
+namespace ryujin
+{
+  /**
+   * The file format used for time series of space averaged quantities
+   * and point probes.
+   */
+  enum class TimeSeriesFormat {
+    /**
+     * A text file with one line per time point. The file is reopened and
+     * appended to on every write out.
+     */
+    text,
+
+    /**
+     * An append-only binary file that is kept open for the whole run.
+     * The file starts with the magic string "RYUJINTS", followed by the
+     * size of a floating point number in bytes, the number of columns,
+     * and the length of the text header (three unsigned 32 bit
+     * integers), and the text header itself. Then, every time point is
+     * stored with all columns in native byte order. The
+     * scripts/convert_time_series script converts such a file into the
+     * text format.
+     */
+    binary,
+  };
+} // namespace ryujin
+
+#ifndef DOXYGEN
+DECLARE_ENUM(ryujin::TimeSeriesFormat,
+             LIST({ryujin::TimeSeriesFormat::text, "text"},
+                  {ryujin::TimeSeriesFormat::binary, "binary"}, ));
+#endif
+
 namespace ryujin
 {
   /**
@@ -44,6 +80,13 @@ namespace ryujin
 
     using StateVector = typename View::StateVector;
 
+    /**
+     * The values of all components of the conserved state at all point
+     * probes (only populated on rank 0).
+     */
+    using ProbeValues =
+        std::array<std::vector<Number>, View::problem_dimension>;
+
     //@}
     /**
      * @name Constructor and setup
@@ -75,8 +118,23 @@ namespace ryujin
      * Takes a state vector @p U at time t (obtained at the end of a full
      * Strang step) and accumulates statistics for quantities of interests
      * for all defined manifolds.
+     *
+     * If @p probe_values is non-null the point probes are not evaluated
+     * but taken from @p probe_values, see evaluate_point_probes().
+     */
+    void accumulate(const StateVector &state_vector,
+                    const Number t,
+                    const ProbeValues *probe_values = nullptr);
+
+    /**
+     * Interpolate all components of the conserved state @p state_vector
+     * at all point probes. The remote point evaluation communicates over
+     * the communicator of the triangulation (and the ghost update over
+     * the main communicator). With asynchronous postprocessing the
+     * function thus has to be called on the main thread and the result
+     * is handed to accumulate().
      */
-    void accumulate(const StateVector &state_vector, const Number t);
+    ProbeValues evaluate_point_probes(const StateVector &state_vector);
 
     /**
      * Write quantities of interest to designated output files.
@@ -99,6 +157,8 @@ namespace ryujin
     std::vector<std::tuple<std::string, std::string, std::string>>
         boundary_manifolds_;
 
+    std::vector<std::tuple<std::string, std::string>> point_probes_;
+
     bool clear_temporal_statistics_on_writeout_;
 
     //@}
@@ -147,9 +207,9 @@ namespace ryujin
      * Temporal statistics we store for each boundary manifold.
      */
     using boundary_statistic =
-        std::tuple<std::vector<boundary_value> /* values old */,
-                   std::vector<boundary_value> /* values new */,
+        std::tuple<std::vector<boundary_value> /* values new */,
                    std::vector<boundary_value> /* values sum */,
+                   std::vector<boundary_value> /* Kahan compensation */,
                    Number /* t old */,
                    Number /* t new */,
                    Number /* t sum */>;
@@ -187,9 +247,9 @@ namespace ryujin
      * Temporal statistics we store for each interior manifold.
      */
     using interior_statistic =
-        std::tuple<std::vector<interior_value> /* values old */,
-                   std::vector<interior_value> /* values new */,
+        std::tuple<std::vector<interior_value> /* values new */,
                    std::vector<interior_value> /* values sum */,
+                   std::vector<interior_value> /* Kahan compensation */,
                    Number /* t old */,
                    Number /* t new */,
                    Number /* t sum */>;
@@ -201,10 +261,31 @@ namespace ryujin
     std::map<std::string, std::vector<std::tuple<Number, interior_value>>>
         interior_time_series_;
 
+    /**
+     * Remote point evaluation of all point probes. All probe points are
+     * registered on rank 0, the point location is performed by deal.II
+     * with a bounding box tree over all locally owned cells.
+     */
+    dealii::Utilities::MPI::RemotePointEvaluation<dim> point_probe_evaluation_;
+
+    /**
+     * Time series of the primitive state (and its second moment) for
+     * every point probe. Only populated on rank 0.
+     */
+    std::map<std::string, std::vector<std::tuple<Number, interior_value>>>
+        point_probe_time_series_;
+
     std::string base_name_;
     bool first_cycle_;
     std::optional<unsigned int> time_series_cycle_;
 
+    TimeSeriesFormat time_series_format_;
+
+    /**
+     * Open file handles of all binary time series (rank 0 only).
+     */
+    std::map<std::string, std::ofstream> time_series_files_;
+
     //@}
     /**
      * @name Internal methods
@@ -217,12 +298,32 @@ namespace ryujin
 
     void clear_statistics();
 
+    /**
+     * Append the primitive states of the point probe values
+     * @p probe_values (at time @p t) to the corresponding time series.
+     */
+    void accumulate_point_probes(const ProbeValues &probe_values,
+                                 const Number t);
+
     std::string header_;
 
+    /**
+     * Compute the primitive state and its second moment in all points of
+     * @p interior_map and store them in @p new_val. If @p val_sum is
+     * nonzero, the time integral over the last time interval of length
+     * @p tau is added to @p val_sum with the trapezoidal rule using the
+     * previous values stored in @p new_val and Kahan compensated
+     * summation (with compensation @p val_compensation). Returns the
+     * spatial average.
+     */
     template <typename point_type, typename value_type>
-    value_type internal_accumulate(const StateVector &state_vector,
-                                   const std::vector<point_type> &interior_map,
-                                   std::vector<value_type> &new_val);
+    value_type
+    internal_accumulate(const StateVector &state_vector,
+                        const std::vector<point_type> &interior_map,
+                        std::vector<value_type> &new_val,
+                        std::vector<value_type> *val_sum = nullptr,
+                        std::vector<value_type> *val_compensation = nullptr,
+                        const Number tau = Number(0.));
 
     template <typename value_type>
     void internal_write_out(const std::string &file_name,
@@ -230,6 +331,11 @@ namespace ryujin
                             const std::vector<value_type> &values,
                             const Number scale);
 
+    /**
+     * Append the time series @p values to the file with base name
+     * @p file_name (the extension is chosen based on the time series
+     * format). If @p append is false the file is truncated first.
+     */
     template <typename value_type>
     void internal_write_out_time_series(
         const std::string &file_name,
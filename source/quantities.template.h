@@ -12,8 +12,12 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/work_stream.h>
 #include <deal.II/dofs/dof_tools.h>
+#include <deal.II/numerics/vector_tools_evaluate.h>
 
+#include <cstdint>
 #include <fstream>
+#include <limits>
+#include <sstream>
 
 DEAL_II_NAMESPACE_OPEN
 template <int rank, int dim, typename Number>
@@ -44,6 +48,66 @@ namespace ryujin
       Assert(it != manifolds.end(), dealii::ExcInternalError());
       return std::get<2>(*it);
     }
+
+
+    /*
+     * Write the (rank local) string @p content into the file @p file_name
+     * with collective MPI IO. The contributions of all ranks are stored
+     * consecutively ordered by rank. No rank has to receive data from
+     * any other rank.
+     */
+    void write_collectively(const MPI_Comm &mpi_communicator,
+                            const std::string &file_name,
+                            const std::string &content)
+    {
+#ifdef DEAL_II_WITH_MPI
+      AssertThrow(content.size() <=
+                      std::size_t(std::numeric_limits<int>::max()),
+                      dealii::ExcMessage("Local output exceeds 2 GB"));
+
+      MPI_File file;
+      int ierr = MPI_File_open(mpi_communicator,
+                               file_name.c_str(),
+                               MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                               MPI_INFO_NULL,
+                               &file);
+      AssertThrowMPI(ierr);
+
+      /* Truncate an already existing file: */
+      ierr = MPI_File_set_size(file, 0);
+      AssertThrowMPI(ierr);
+
+      /* Compute the offset of the local contribution: */
+      const unsigned long long size = content.size();
+      unsigned long long offset = 0;
+      ierr = MPI_Exscan(&size,
+                        &offset,
+                        1,
+                        MPI_UNSIGNED_LONG_LONG,
+                        MPI_SUM,
+                        mpi_communicator);
+      AssertThrowMPI(ierr);
+
+      /* The result of MPI_Exscan is undefined on rank 0: */
+      if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+        offset = 0;
+
+      ierr = MPI_File_write_at_all(file,
+                                   offset,
+                                   content.data(),
+                                   content.size(),
+                                   MPI_CHAR,
+                                   MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_close(&file);
+      AssertThrowMPI(ierr);
+#else
+      (void)mpi_communicator;
+      std::ofstream output(file_name);
+      output << content << std::flush;
+#endif
+    }
   } // namespace
 
 
@@ -78,12 +142,26 @@ namespace ryujin
                   "Format: '<name> : <level set formula> : <options> , [...] "
                   "(options: time_averaged, space_averaged, instantaneous)");
 
+    add_parameter("point probes",
+                  point_probes_,
+                  "List of points at which the (interpolated) primitive state "
+                  "is recorded as a time series every time quantities are "
+                  "accumulated. Format: '<name> : <x> <y> <z> , [...]'");
+
     clear_temporal_statistics_on_writeout_ = true;
     add_parameter("clear statistics on writeout",
                   clear_temporal_statistics_on_writeout_,
                   "If set to true then all temporal statistics (for "
                   "\"time_averaged\" quantities) accumulated so far are reset "
                   "each time a writeout of quantities is performed");
+
+    time_series_format_ = TimeSeriesFormat::text;
+    add_parameter("time series format",
+                  time_series_format_,
+                  "The file format used for space averaged and point probe "
+                  "time series: \"text\", or an append-only \"binary\" "
+                  "format that keeps the file open and avoids formatting "
+                  "(see scripts/convert_time_series)");
   }
 
 
@@ -98,6 +176,7 @@ namespace ryujin
 
     /* Force to write to a new time series file: */
     time_series_cycle_.reset();
+    time_series_files_.clear();
 
     const unsigned int n_owned = offline_data_->n_locally_owned();
     const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
@@ -105,82 +184,101 @@ namespace ryujin
     /*
      * Create interior maps and allocate statistics.
      *
-     * We have to loop over the cells and populate the std::map interior_maps_.
+     * The positions of all locally owned and unconstrained degrees of
+     * freedom are computed only once in a single loop over all cells and
+     * are then shared by all interior manifolds. We skip support points
+     * that were already visited on a neighboring cell so that every
+     * position is mapped only once.
      */
 
-    interior_maps_.clear();
-    std::transform(
-        interior_manifolds_.begin(),
-        interior_manifolds_.end(),
-        std::inserter(interior_maps_, interior_maps_.end()),
-        [this, n_owned, &sparsity_simd](auto it) {
-          const auto &[name, expression, option] = it;
-          FunctionParser<dim> level_set_function(expression);
+    const auto &discretization = offline_data_->discretization();
 
-          std::vector<interior_point> map;
-          std::map<int, interior_point> preliminary_map;
+    std::vector<interior_point> point_cloud;
+    if (!interior_manifolds_.empty()) {
+      const auto &dof_handler = offline_data_->dof_handler();
 
-          const auto &discretization = offline_data_->discretization();
-          const auto &dof_handler = offline_data_->dof_handler();
+      const unsigned int dofs_per_cell = dof_handler.get_fe().dofs_per_cell;
 
-          const unsigned int dofs_per_cell = dof_handler.get_fe().dofs_per_cell;
+      const auto support_points =
+          dof_handler.get_fe().get_unit_support_points();
 
-          const auto support_points =
-              dof_handler.get_fe().get_unit_support_points();
+      std::vector<dealii::types::global_dof_index> local_dof_indices(
+          dofs_per_cell);
 
-          std::vector<dealii::types::global_dof_index> local_dof_indices(
-              dofs_per_cell);
+      std::vector<Point<dim>> positions(n_owned);
+      std::vector<bool> visited(n_owned, false);
 
-          /* Loop over cells */
-          for (auto cell : dof_handler.active_cell_iterators()) {
-
-            /* skip if not locally owned */
-            if (!cell->is_locally_owned())
-              continue;
+      /* Loop over cells */
+      for (auto cell : dof_handler.active_cell_iterators()) {
 
-            cell->get_active_or_mg_dof_indices(local_dof_indices);
-
-            for (unsigned int j = 0; j < dofs_per_cell; ++j) {
+        /* skip if not locally owned */
+        if (!cell->is_locally_owned())
+          continue;
 
-              Point<dim> position =
-                  discretization.mapping().transform_unit_to_real_cell(
-                      cell, support_points[j]);
+        cell->get_active_or_mg_dof_indices(local_dof_indices);
 
-              /*
-               * Insert index, interior mass value and position into
-               * a preliminary map if we satisfy level set condition.
-               */
+        for (unsigned int j = 0; j < dofs_per_cell; ++j) {
+          const auto global_index = local_dof_indices[j];
+          const auto index =
+              offline_data_->scalar_partitioner()->global_to_local(
+                  global_index);
 
-              if (std::abs(level_set_function.value(position)) > 1.e-12)
-                continue;
+          if (index >= n_owned || visited[index])
+            continue;
 
-              const auto global_index = local_dof_indices[j];
-              const auto index =
-                  offline_data_->scalar_partitioner()->global_to_local(
-                      global_index);
+          /* Skip constrained degrees of freedom: */
+          const unsigned int row_length = sparsity_simd.row_length(index);
+          if (row_length == 1)
+            continue;
 
-              /* Skip constrained degrees of freedom: */
-              const unsigned int row_length = sparsity_simd.row_length(index);
-              if (row_length == 1)
-                continue;
+          visited[index] = true;
+          positions[index] =
+              discretization.mapping().transform_unit_to_real_cell(
+                  cell, support_points[j]);
+        }
+      }
 
-              if (index >= n_owned)
-                continue;
+      for (unsigned int index = 0; index < n_owned; ++index) {
+        if (!visited[index])
+          continue;
+        const Number interior_mass =
+            offline_data_->lumped_mass_matrix().local_element(index);
+        point_cloud.push_back({index, interior_mass, positions[index]});
+      }
+    }
 
-              const Number interior_mass =
-                  offline_data_->lumped_mass_matrix().local_element(index);
-              // FIXME: change to std::set
-              preliminary_map[index] = {index, interior_mass, position};
-            }
-          }
+    interior_maps_.clear();
+    std::transform(
+        interior_manifolds_.begin(),
+        interior_manifolds_.end(),
+        std::inserter(interior_maps_, interior_maps_.end()),
+        [&point_cloud](auto it) {
+          const auto &[name, expression, option] = it;
+          FunctionParser<dim> level_set_function(expression);
 
           /*
-           * Now we populate the std::vector(interior_point) object called map.
+           * Evaluate the level set function thread parallel (the
+           * function parser uses thread local storage internally) and
+           * collect all points that satisfy the level set condition in
+           * the order of their (local) index:
            */
-          // FIXME: use std::copy
-          for (const auto &[index, tuple] : preliminary_map) {
-            map.push_back(tuple);
+
+          const std::size_t n_points = point_cloud.size();
+          std::vector<char> on_manifold(n_points);
+
+          RYUJIN_PARALLEL_REGION_BEGIN
+          RYUJIN_OMP_FOR
+          for (std::size_t k = 0; k < n_points; ++k) {
+            const auto &position = std::get<2>(point_cloud[k]);
+            on_manifold[k] =
+                std::abs(level_set_function.value(position)) <= 1.e-12;
           }
+          RYUJIN_PARALLEL_REGION_END
+
+          std::vector<interior_point> map;
+          for (std::size_t k = 0; k < n_points; ++k)
+            if (on_manifold[k])
+              map.push_back(point_cloud[k]);
 
           return std::make_pair(name, map);
         });
@@ -225,6 +323,36 @@ namespace ryujin
           return std::make_pair(name, map);
         });
 
+    /*
+     * Set up the remote point evaluation for point probes. This replaces
+     * matching probe points to the nearest degree of freedom:
+     */
+
+    if (!point_probes_.empty()) {
+      std::vector<Point<dim>> probe_points;
+      if (Utilities::MPI::this_mpi_process(mpi_communicator_) == 0) {
+        for (const auto &[name, coordinates] : point_probes_) {
+          Point<dim> point;
+          std::istringstream stream(coordinates);
+          for (unsigned int d = 0; d < dim; ++d)
+            stream >> point[d];
+          AssertThrow(!stream.fail(),
+                      dealii::ExcMessage("Could not parse coordinates of "
+                                         "point probe \"" +
+                                         name + "\": \"" + coordinates +
+                                         "\""));
+          probe_points.push_back(point);
+        }
+      }
+
+      point_probe_evaluation_.reinit(probe_points,
+                                     discretization.triangulation(),
+                                     discretization.mapping());
+      AssertThrow(point_probe_evaluation_.all_points_found(),
+                  dealii::ExcMessage("Some point probes lie outside of the "
+                                     "computational domain"));
+    }
+
     /* Clear statistics: */
     clear_statistics();
 
@@ -261,35 +389,24 @@ namespace ryujin
           options.find("time_averaged") == std::string::npos)
         continue;
 
-      /*
-       * FIXME: This currently distributes boundary maps to all MPI ranks.
-       * This is unnecessarily wasteful. Ideally, we should do MPI IO with
-       * only MPI ranks participating who actually have boundary values.
-       */
-
-      const auto received =
-          Utilities::MPI::gather(mpi_communicator_, interior_map);
-
-      if (Utilities::MPI::this_mpi_process(mpi_communicator_) == 0) {
-
-        std::ofstream output(base_name_ + "-" + name + "-R" +
-                             Utilities::to_string(cycle, 4) + "-points.dat");
+      const auto rank = Utilities::MPI::this_mpi_process(mpi_communicator_);
 
-        output << std::scientific << std::setprecision(14);
+      std::stringstream output;
+      output << std::scientific << std::setprecision(14);
 
+      if (rank == 0)
         output << "#\n# position\tinterior mass\n";
 
-        unsigned int rank = 0;
-        for (const auto &entries : received) {
-          output << "# rank " << rank++ << "\n";
-          for (const auto &entry : entries) {
-            const auto &[index, mass_i, x_i] = entry;
-            output << x_i << "\t" << mass_i << "\n";
-          } /*entry*/
-        }   /*entries*/
+      output << "# rank " << rank << "\n";
+      for (const auto &entry : interior_map) {
+        const auto &[index, mass_i, x_i] = entry;
+        output << x_i << "\t" << mass_i << "\n";
+      } /*entry*/
 
-        output << std::flush;
-      }
+      write_collectively(mpi_communicator_,
+                         base_name_ + "-" + name + "-R" +
+                             Utilities::to_string(cycle, 4) + "-points.dat",
+                         output.str());
     }
 
     /*
@@ -303,36 +420,24 @@ namespace ryujin
           options.find("time_averaged") == std::string::npos)
         continue;
 
-      /*
-       * FIXME: This currently distributes boundary maps to all MPI ranks.
-       * This is unnecessarily wasteful. Ideally, we should do MPI IO with
-       * only MPI ranks participating who actually have boundary values.
-       */
-
-      const auto received =
-          Utilities::MPI::gather(mpi_communicator_, boundary_map);
-
-      if (Utilities::MPI::this_mpi_process(mpi_communicator_) == 0) {
+      const auto rank = Utilities::MPI::this_mpi_process(mpi_communicator_);
 
-        std::ofstream output(base_name_ + "-" + name + "-R" +
-                             Utilities::to_string(cycle, 4) + "-points.dat");
-
-        output << std::scientific << std::setprecision(14);
+      std::stringstream output;
+      output << std::scientific << std::setprecision(14);
 
+      if (rank == 0)
         output << "#\n# position\tnormal\tnormal mass\tboundary mass\n";
 
-        unsigned int rank = 0;
-        for (const auto &entries : received) {
-          output << "# rank " << rank++ << "\n";
-          for (const auto &entry : entries) {
-            const auto &[index, n_i, nm_i, bm_i, id, x_i] = entry;
-            output << x_i << "\t" << n_i << "\t" << nm_i << "\t" << bm_i
-                   << "\n";
-          } /*entry*/
-        }   /*entries*/
-
-        output << std::flush;
-      }
+      output << "# rank " << rank << "\n";
+      for (const auto &entry : boundary_map) {
+        const auto &[index, n_i, nm_i, bm_i, id, x_i] = entry;
+        output << x_i << "\t" << n_i << "\t" << nm_i << "\t" << bm_i << "\n";
+      } /*entry*/
+
+      write_collectively(mpi_communicator_,
+                         base_name_ + "-" + name + "-R" +
+                             Utilities::to_string(cycle, 4) + "-points.dat",
+                         output.str());
     }
   }
 
@@ -343,11 +448,11 @@ namespace ryujin
     const auto reset = [](const auto &manifold_map, auto &statistics_map) {
       for (const auto &[name, data_map] : manifold_map) {
         const auto n_entries = data_map.size();
-        auto &[val_old, val_new, val_sum, t_old, t_new, t_sum] =
+        auto &[val_new, val_sum, val_compensation, t_old, t_new, t_sum] =
             statistics_map[name];
-        val_old.resize(n_entries);
         val_new.resize(n_entries);
         val_sum.resize(n_entries);
+        val_compensation.resize(n_entries);
         t_old = t_new = t_sum = 0.;
       }
     };
@@ -361,6 +466,69 @@ namespace ryujin
     boundary_statistics_.clear();
     reset(boundary_maps_, boundary_statistics_);
     boundary_time_series_.clear();
+
+    point_probe_time_series_.clear();
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  auto Quantities<Description, dim, Number>::evaluate_point_probes(
+      const StateVector &state_vector) -> ProbeValues
+  {
+    ProbeValues values;
+    if (point_probes_.empty())
+      return values;
+
+    const auto &U = std::get<0>(state_vector);
+
+    const auto &dof_handler = offline_data_->dof_handler();
+    const auto &affine_constraints = offline_data_->affine_constraints();
+
+    /*
+     * Interpolate every component of the conserved state at all probe
+     * points. The values are returned on rank 0 (where all probe points
+     * were registered):
+     */
+
+    constexpr auto problem_dimension = View::problem_dimension;
+
+    Vectors::ScalarVector<Number> scalar_vector;
+    scalar_vector.reinit(offline_data_->scalar_partitioner());
+
+    for (unsigned int k = 0; k < problem_dimension; ++k) {
+      U.extract_component(scalar_vector, k);
+      affine_constraints.distribute(scalar_vector);
+      scalar_vector.update_ghost_values();
+      values[k] = VectorTools::point_values<1>(
+          point_probe_evaluation_, dof_handler, scalar_vector);
+    }
+
+    return values;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void Quantities<Description, dim, Number>::accumulate_point_probes(
+      const ProbeValues &values, const Number t)
+  {
+    if (point_probes_.empty())
+      return;
+
+    constexpr auto problem_dimension = View::problem_dimension;
+    const auto view = hyperbolic_system_->template view<dim, Number>();
+
+    for (std::size_t q = 0; q < values[0].size(); ++q) {
+      state_type U_q;
+      for (unsigned int k = 0; k < problem_dimension; ++k)
+        U_q[k] = values[k][q];
+
+      const auto primitive_state = view.to_primitive_state(U_q);
+      const interior_value value{
+          primitive_state, schur_product(primitive_state, primitive_state)};
+
+      const auto &name = std::get<0>(point_probes_[q]);
+      point_probe_time_series_[name].push_back({t, value});
+    }
   }
 
 
@@ -369,51 +537,106 @@ namespace ryujin
   value_type Quantities<Description, dim, Number>::internal_accumulate(
       const StateVector &state_vector,
       const std::vector<point_type> &points_vector,
-      std::vector<value_type> &val_new)
+      std::vector<value_type> &val_new,
+      std::vector<value_type> *val_sum,
+      std::vector<value_type> *val_compensation,
+      const Number tau)
   {
     const auto &U = std::get<0>(state_vector);
+    const auto view = hyperbolic_system_->template view<dim, Number>();
+
+    const bool integrate = (val_sum != nullptr) && (tau != Number(0.));
+    Assert(!integrate || val_compensation != nullptr,
+           dealii::ExcInternalError());
+
+    /* Kahan compensated summation, sum += value: */
+    const auto kahan_add =
+        [](auto &sum, auto &compensation, const auto &value) {
+          const auto y = value - compensation;
+          const auto t = sum + y;
+          compensation = (t - sum) - y;
+          sum = t;
+        };
 
     value_type spatial_average;
     Number mass_sum = Number(0.);
 
-    std::transform(
-        points_vector.begin(),
-        points_vector.end(),
-        val_new.begin(),
-        [&](auto point) -> value_type {
-          const auto i = std::get<0>(point);
-          /*
-           * Small trick to get the correct index for retrieving the
-           * boundary mass.
-           */
-          constexpr auto index =
-              std::is_same<point_type, interior_point>::value ? 1 : 3;
-          const auto mass_i = std::get<index>(point);
+    const std::size_t n_points = points_vector.size();
 
-          const auto U_i = U.get_tensor(i);
-          const auto view = hyperbolic_system_->template view<dim, Number>();
-          const auto primitive_state = view.to_primitive_state(U_i);
+    RYUJIN_PARALLEL_REGION_BEGIN
 
-          value_type result;
-          std::get<0>(result) = primitive_state;
-          /* Compute second moments of the primitive state: */
-          std::get<1>(result) = schur_product(primitive_state, primitive_state);
+    value_type local_average;
+    Number local_mass_sum = Number(0.);
 
-          mass_sum += mass_i;
-          std::get<0>(spatial_average) += mass_i * std::get<0>(result);
-          std::get<1>(spatial_average) += mass_i * std::get<1>(result);
+    RYUJIN_OMP_FOR_NOWAIT
+    for (std::size_t k = 0; k < n_points; ++k) {
+      const auto &point = points_vector[k];
+      const auto i = std::get<0>(point);
+      /*
+       * Small trick to get the correct index for retrieving the boundary
+       * mass.
+       */
+      constexpr auto index =
+          std::is_same<point_type, interior_point>::value ? 1 : 3;
+      const auto mass_i = std::get<index>(point);
 
-          return result;
-        });
+      const auto U_i = U.get_tensor(i);
+      const auto primitive_state = view.to_primitive_state(U_i);
 
-    /* synchronize MPI ranks (MPI Barrier): */
+      value_type result;
+      std::get<0>(result) = primitive_state;
+      /* Compute second moments of the primitive state: */
+      std::get<1>(result) = schur_product(primitive_state, primitive_state);
+
+      if (integrate) {
+        /*
+         * Average in time with the trapezoidal rule. The old value is
+         * still stored in val_new and is overwritten right after.
+         */
+        const auto &[old_state, old_square] = val_new[k];
+        auto &[sum_state, sum_square] = (*val_sum)[k];
+        auto &[c_state, c_square] = (*val_compensation)[k];
+        kahan_add(sum_state,
+                  c_state,
+                  Number(0.5) * tau * (old_state + std::get<0>(result)));
+        kahan_add(sum_square,
+                  c_square,
+                  Number(0.5) * tau * (old_square + std::get<1>(result)));
+      }
 
-    mass_sum = Utilities::MPI::sum(mass_sum, mpi_communicator_);
+      val_new[k] = result;
 
-    std::get<0>(spatial_average) =
-        Utilities::MPI::sum(std::get<0>(spatial_average), mpi_communicator_);
-    std::get<1>(spatial_average) =
-        Utilities::MPI::sum(std::get<1>(spatial_average), mpi_communicator_);
+      local_mass_sum += mass_i;
+      std::get<0>(local_average) += mass_i * std::get<0>(result);
+      std::get<1>(local_average) += mass_i * std::get<1>(result);
+    }
+
+    RYUJIN_OMP_CRITICAL
+    {
+      mass_sum += local_mass_sum;
+      std::get<0>(spatial_average) += std::get<0>(local_average);
+      std::get<1>(spatial_average) += std::get<1>(local_average);
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+
+    /* synchronize MPI ranks with a single reduction (MPI Barrier): */
+
+    constexpr unsigned int n = state_type::dimension;
+    std::vector<Number> sums(2 * n + 1);
+    for (unsigned int k = 0; k < n; ++k) {
+      sums[k] = std::get<0>(spatial_average)[k];
+      sums[n + k] = std::get<1>(spatial_average)[k];
+    }
+    sums[2 * n] = mass_sum;
+
+    Utilities::MPI::sum(sums, mpi_communicator_, sums);
+
+    for (unsigned int k = 0; k < n; ++k) {
+      std::get<0>(spatial_average)[k] = sums[k];
+      std::get<1>(spatial_average)[k] = sums[n + k];
+    }
+    mass_sum = sums[2 * n];
 
     /* take average: */
 
@@ -432,31 +655,21 @@ namespace ryujin
       const std::vector<value_type> &values,
       const Number scale)
   {
-    /*
-     * FIXME: This currently distributes interior maps to all MPI ranks.
-     * This is unnecessarily wasteful. Ideally, we should do MPI IO with
-     * only MPI ranks participating who actually have interior values.
-     */
-
-    const auto received = Utilities::MPI::gather(mpi_communicator_, values);
+    const auto rank = Utilities::MPI::this_mpi_process(mpi_communicator_);
 
-    if (Utilities::MPI::this_mpi_process(mpi_communicator_) == 0) {
+    std::stringstream output;
+    output << std::scientific << std::setprecision(14);
 
-      std::ofstream output(file_name);
-      output << std::scientific << std::setprecision(14);
+    if (rank == 0)
       output << time_stamp << "# " << header_;
 
-      unsigned int rank = 0;
-      for (const auto &entries : received) {
-        output << "# rank " << rank++ << "\n";
-        for (const auto &entry : entries) {
-          const auto &[state, state_square] = entry;
-          output << scale * state << "\t" << scale * state_square << "\n";
-        } /*entry*/
-      }   /*entries*/
+    output << "# rank " << rank << "\n";
+    for (const auto &entry : values) {
+      const auto &[state, state_square] = entry;
+      output << scale * state << "\t" << scale * state_square << "\n";
+    } /*entry*/
 
-      output << std::flush;
-    }
+    write_collectively(mpi_communicator_, file_name, output.str());
   }
 
 
@@ -467,33 +680,78 @@ namespace ryujin
       const std::vector<std::tuple<Number, value_type>> &values,
       bool append)
   {
-    if (Utilities::MPI::this_mpi_process(mpi_communicator_) == 0) {
-      std::ofstream output;
-      output << std::scientific << std::setprecision(14);
+    if (Utilities::MPI::this_mpi_process(mpi_communicator_) != 0)
+      return;
+
+    if (time_series_format_ == TimeSeriesFormat::binary) {
+      auto &output = time_series_files_[file_name];
+
+      if (!append || !output.is_open()) {
+        output.close();
+        output.open(file_name + ".bin",
+                    std::ofstream::out | std::ofstream::binary |
+                        (append ? std::ofstream::app : std::ofstream::trunc));
+        AssertThrow(output.good(),
+                    dealii::ExcMessage("Could not open time series file " +
+                                       file_name + ".bin"));
+      }
 
-      if (append) {
-        output.open(file_name, std::ofstream::out | std::ofstream::app);
-      } else {
-        output.open(file_name, std::ofstream::out | std::ofstream::trunc);
-        output << "# time t\t" << header_;
+      constexpr unsigned int n = state_type::dimension;
+
+      if (!append) {
+        const std::string header = "# time t\t" + header_;
+        const std::uint32_t layout[3] = {
+            sizeof(Number), 2 * n + 1, std::uint32_t(header.size())};
+        output.write("RYUJINTS", 8);
+        output.write(reinterpret_cast<const char *>(layout), sizeof(layout));
+        output.write(header.data(), header.size());
       }
 
+      std::vector<Number> record(2 * n + 1);
       for (const auto &entry : values) {
-        const auto t = std::get<0>(entry);
         const auto &[state, state_square] = std::get<1>(entry);
-
-        output << t << "\t" << state << "\t" << state_square << "\n";
+        record[0] = std::get<0>(entry);
+        for (unsigned int k = 0; k < n; ++k) {
+          record[1 + k] = state[k];
+          record[1 + n + k] = state_square[k];
+        }
+        output.write(reinterpret_cast<const char *>(record.data()),
+                     record.size() * sizeof(Number));
       }
 
+      /* Keep the file open but make the written records visible: */
       output << std::flush;
-      output.close();
+      return;
     }
+
+    std::ofstream output;
+    output << std::scientific << std::setprecision(14);
+
+    if (append) {
+      output.open(file_name + ".dat", std::ofstream::out | std::ofstream::app);
+    } else {
+      output.open(file_name + ".dat",
+                  std::ofstream::out | std::ofstream::trunc);
+      output << "# time t\t" << header_;
+    }
+
+    for (const auto &entry : values) {
+      const auto t = std::get<0>(entry);
+      const auto &[state, state_square] = std::get<1>(entry);
+
+      output << t << "\t" << state << "\t" << state_square << "\n";
+    }
+
+    output << std::flush;
+    output.close();
   }
 
 
   template <typename Description, int dim, typename Number>
   void Quantities<Description, dim, Number>::accumulate(
-      const StateVector &state_vector, const Number t)
+      const StateVector &state_vector,
+      const Number t,
+      const ProbeValues *probe_values)
   {
 #ifdef DEBUG_OUTPUT
     std::cout << "Quantities<dim, Number>::accumulate()" << std::endl;
@@ -513,37 +771,24 @@ namespace ryujin
             options.find("space_averaged") == std::string::npos)
           continue;
 
-        auto &[val_old, val_new, val_sum, t_old, t_new, t_sum] =
+        auto &[val_new, val_sum, val_compensation, t_old, t_new, t_sum] =
             statistics[name];
 
-        std::swap(t_old, t_new);
-        std::swap(val_old, val_new);
-
-        /* accumulate new values */
-
-        const auto spatial_average =
-            internal_accumulate(state_vector, point_map, val_new);
-
-        /* Average in time with trapezoidal rule: */
-
-        if (RYUJIN_UNLIKELY(t_old == Number(0.) && t_new == Number(0.))) {
-          /* We have not accumulated any statistics yet: */
-          t_old = t - 1.;
-          t_new = t;
-
-        } else {
+        /*
+         * Accumulate new values and average in time with the trapezoidal
+         * rule. If we have not accumulated any statistics yet we only
+         * record the current values.
+         */
 
-          t_new = t;
-          const Number tau = t_new - t_old;
+        const bool first_accumulation =
+            (t_old == Number(0.) && t_new == Number(0.));
+        const Number tau = first_accumulation ? Number(0.) : t - t_new;
+        t_old = first_accumulation ? t - 1. : t_new;
+        t_new = t;
 
-          for (std::size_t i = 0; i < val_sum.size(); ++i) {
-            std::get<0>(val_sum[i]) += 0.5 * tau * std::get<0>(val_old[i]);
-            std::get<0>(val_sum[i]) += 0.5 * tau * std::get<0>(val_new[i]);
-            std::get<1>(val_sum[i]) += 0.5 * tau * std::get<1>(val_old[i]);
-            std::get<1>(val_sum[i]) += 0.5 * tau * std::get<1>(val_new[i]);
-          }
-          t_sum += tau;
-        }
+        const auto spatial_average = internal_accumulate(
+            state_vector, point_map, val_new, &val_sum, &val_compensation, tau);
+        t_sum += tau;
 
         /* Record average in space: */
         time_series[name].push_back({t, spatial_average});
@@ -559,6 +804,11 @@ namespace ryujin
                boundary_manifolds_,
                boundary_statistics_,
                boundary_time_series_);
+
+    if (probe_values != nullptr)
+      accumulate_point_probes(*probe_values, t);
+    else
+      accumulate_point_probes(evaluate_point_probes(state_vector), t);
   }
 
 
@@ -603,7 +853,7 @@ namespace ryujin
 
           const std::string file_name = prefix + "-instantaneous.dat";
 
-          auto &[val_old, val_new, val_sum, t_old, t_new, t_sum] =
+          auto &[val_new, val_sum, val_compensation, t_old, t_new, t_sum] =
               statistics[name];
 
           std::stringstream time_stamp;
@@ -629,7 +879,7 @@ namespace ryujin
 
           const std::string file_name = prefix + "-time_averaged.dat";
 
-          auto &[val_old, val_new, val_sum, t_old, t_new, t_sum] =
+          auto &[val_new, val_sum, val_compensation, t_old, t_new, t_sum] =
               statistics[name];
 
           /* Check whether we have accumulated any statistics yet: */
@@ -658,7 +908,7 @@ namespace ryujin
           const auto file_name =
               base_name_ + "-" + name + "-R" +
               Utilities::to_string(time_series_cycle_.value(), 4) +
-              "-space_averaged_time_series.dat";
+              "-space_averaged_time_series";
 
           auto &series = time_series[name];
           internal_write_out_time_series(file_name, series, /*append*/ append);
@@ -677,6 +927,26 @@ namespace ryujin
               boundary_statistics_,
               boundary_time_series_);
 
+    /*
+     * Flush point probe time series:
+     */
+
+    for (auto &[name, series] : point_probe_time_series_) {
+      bool append = true;
+      if (!time_series_cycle_.has_value()) {
+        time_series_cycle_ = cycle;
+        append = false;
+      }
+
+      const auto file_name =
+          base_name_ + "-" + name + "-R" +
+          Utilities::to_string(time_series_cycle_.value(), 4) +
+          "-probe_time_series";
+
+      internal_write_out_time_series(file_name, series, /*append*/ append);
+      series.clear();
+    }
+
     if (clear_temporal_statistics_on_writeout_)
       clear_statistics();
   }
@@ -13,5 +13,9 @@ namespace ryujin
   namespace ScalarConservation
   {
     Dispatch<Description, NUMBER> dispatch_instance("scalar conservation");
+#ifdef RUNTIME_PRECISION
+    Dispatch<Description, ALTERNATIVE_NUMBER>
+        alternative_dispatch_instance("scalar conservation");
+#endif
   } // namespace ScalarConservation
 } // namespace ryujin
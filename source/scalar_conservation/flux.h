@@ -8,10 +8,13 @@
 #include <compile_time_options.h>
 
 #include "convenience_macros.h"
+#include "flux_table.h"
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/function.h>
 #include <deal.II/base/parameter_acceptor.h>
 
+#include <algorithm>
 #include <string>
 
 namespace ryujin
@@ -58,6 +61,55 @@ namespace ryujin
        */
       virtual double gradient(double state, unsigned int direction) const = 0;
 
+
+      /**
+       * Variant of above function operating on a contiguous range of
+       * states. The result is stored in the first argument @p result,
+       * overriding previous contents.
+       */
+      virtual void value(const dealii::ArrayView<double> &result,
+                         const dealii::ArrayView<const double> &state,
+                         unsigned int direction) const
+      {
+        Assert(result.size() == state.size(),
+               dealii::ExcMessage("vectors have different size"));
+
+        std::transform(std::begin(state),
+                       std::end(state),
+                       std::begin(result),
+                       [&](double u) { return value(u, direction); });
+      }
+
+
+      /**
+       * Variant of above function operating on a contiguous range of
+       * states. The result is stored in the first argument @p result,
+       * overriding previous contents.
+       */
+      virtual void gradient(const dealii::ArrayView<double> &result,
+                            const dealii::ArrayView<const double> &state,
+                            unsigned int direction) const
+      {
+        Assert(result.size() == state.size(),
+               dealii::ExcMessage("vectors have different size"));
+
+        std::transform(std::begin(state),
+                       std::end(state),
+                       std::begin(result),
+                       [&](double u) { return gradient(u, direction); });
+      }
+
+      /**
+       * Return a pointer to a pre-sampled table of the flux, or a nullptr
+       * if the flux is not tabulated. If a table is returned, callers may
+       * evaluate it instead of value() and gradient() for all states
+       * inside of the table range.
+       */
+      virtual const FluxTable *table() const
+      {
+        return nullptr;
+      }
+
       /**
        * The name of the flux function
        */
@@ -26,18 +26,46 @@ namespace ryujin
       }
 
 
+      using Flux::gradient;
+      using Flux::value;
+
       double value(const double state,
-                   const unsigned int /*direction*/) const override
+                   const unsigned int direction) const override
       {
-        return 0.5 * state * state;
+        return value_impl(state, direction);
       }
 
 
       double gradient(const double state,
-                      const unsigned int /*direction*/) const override
+                      const unsigned int direction) const override
+      {
+        return gradient_impl(state, direction);
+      }
+
+
+      /**
+       * @name Generic implementations for scalar and VectorizedArray
+       * arguments. These are called directly (bypassing the virtual
+       * interface) by the HyperbolicSystemView.
+       */
+      //@{
+
+      template <typename Number>
+      static DEAL_II_ALWAYS_INLINE inline Number
+      value_impl(const Number &state, const unsigned int /*direction*/)
+      {
+        return Number(0.5) * state * state;
+      }
+
+
+      template <typename Number>
+      static DEAL_II_ALWAYS_INLINE inline Number
+      gradient_impl(const Number &state, const unsigned int /*direction*/)
       {
         return state;
       }
+
+      //@}
     };
   } // namespace FluxLibrary
 } // namespace ryujin
@@ -13,6 +13,7 @@
 #include <boost/algorithm/string/split.hpp>
 
 #include <numeric>
+#include <vector>
 
 namespace ryujin
 {
@@ -43,6 +44,24 @@ namespace ryujin
                       "Step size of the central difference quotient to compute "
                       "an approximation of the flux derivative");
 
+        tabulate_ = false;
+        add_parameter("tabulate",
+                      tabulate_,
+                      "Pre-sample the flux and its derivative on a piecewise "
+                      "cubic Hermite table and evaluate the table instead of "
+                      "the muparser object for all states inside of the "
+                      "table range");
+
+        table_range_ = {-10., 10.};
+        add_parameter("table range",
+                      table_range_,
+                      "Minimal and maximal state of the flux table");
+
+        table_resolution_ = 4096;
+        add_parameter("table resolution",
+                      table_resolution_,
+                      "Number of subintervals of the flux table");
+
         /*
          * Set up the muparser object with the final flux description from
          * the parameter file:
@@ -62,6 +81,24 @@ namespace ryujin
           flux_function_->initialize({"u"}, split_expressions, {});
 
           flux_formula_ = "f(u)={" + expression_ + "}";
+
+          /*
+           * Sample the muparser object. The table is cleared first so that
+           * value() and gradient() evaluate the parser during setup:
+           */
+          table_.clear();
+          if (tabulate_) {
+            AssertThrow(table_range_.size() == 2,
+                        dealii::ExcMessage("The table range has to be given "
+                                           "by a minimal and maximal value"));
+            table_.build(
+                [this](double u, unsigned int c) { return value(u, c); },
+                [this](double u, unsigned int c) { return gradient(u, c); },
+                flux_function_->n_components,
+                table_range_[0],
+                table_range_[1],
+                table_resolution_);
+          }
         };
 
         set_up_muparser();
@@ -69,9 +106,15 @@ namespace ryujin
       }
 
 
+      using Flux::gradient;
+      using Flux::value;
+
       double value(const double state,
                    const unsigned int direction) const override
       {
+        if (table_.in_range(state))
+          return table_.value(state, direction);
+
         return flux_function_->value(dealii::Point<1>(state), direction);
       }
 
@@ -79,14 +122,28 @@ namespace ryujin
       double gradient(const double state,
                       const unsigned int direction) const override
       {
+        if (table_.in_range(state))
+          return table_.gradient(state, direction);
+
         return flux_function_->gradient(dealii::Point<1>(state), direction)[0];
       }
 
 
+      const FluxTable *table() const override
+      {
+        return tabulate_ ? &table_ : nullptr;
+      }
+
+
     private:
       std::string expression_;
+      bool tabulate_;
+      std::vector<double> table_range_;
+      unsigned int table_resolution_;
 
       std::unique_ptr<dealii::FunctionParser<1>> flux_function_;
+
+      FluxTable table_;
     };
   } // namespace FluxLibrary
 } // namespace ryujin
@@ -7,6 +7,8 @@
 
 #include "flux.h"
 
+#include <deal.II/base/vectorization.h>
+
 namespace ryujin
 {
   namespace FluxLibrary
@@ -26,8 +28,33 @@ namespace ryujin
       }
 
 
+      using Flux::gradient;
+      using Flux::value;
+
       double value(const double state,
                    const unsigned int direction) const override
+      {
+        return value_impl(state, direction);
+      }
+
+
+      double gradient(const double state,
+                      const unsigned int direction) const override
+      {
+        return gradient_impl(state, direction);
+      }
+
+
+      /**
+       * @name Generic implementations for scalar and VectorizedArray
+       * arguments. These are called directly (bypassing the virtual
+       * interface) by the HyperbolicSystemView.
+       */
+      //@{
+
+      template <typename Number>
+      static DEAL_II_ALWAYS_INLINE inline Number
+      value_impl(const Number &state, const unsigned int direction)
       {
         switch (direction) {
         case 0:
@@ -43,8 +70,9 @@ namespace ryujin
       }
 
 
-      double gradient(const double state,
-                      const unsigned int direction) const override
+      template <typename Number>
+      static DEAL_II_ALWAYS_INLINE inline Number
+      gradient_impl(const Number &state, const unsigned int direction)
       {
         switch (direction) {
         case 0:
@@ -58,6 +86,8 @@ namespace ryujin
           __builtin_trap();
         }
       }
+
+      //@}
     };
   } // namespace FluxLibrary
 } // namespace ryujin
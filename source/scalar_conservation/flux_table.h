@@ -0,0 +1,224 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include "convenience_macros.h"
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/vectorization.h>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <vector>
+
+namespace ryujin
+{
+  namespace FluxLibrary
+  {
+    /**
+     * A pre-sampled table of a scalar flux f(u) and its derivative f'(u)
+     * on a uniform grid of an interval \f$[u_{\text{min}},
+     * u_{\text{max}}]\f$.
+     *
+     * Every subinterval and flux component stores the four coefficients
+     * of the cubic Hermite interpolant of f. A lookup is thus a gather of
+     * four coefficients followed by a Horner evaluation, both of which
+     * vectorize over dealii::VectorizedArray.
+     *
+     * @ingroup ScalarConservation
+     */
+    class FluxTable
+    {
+    public:
+      /**
+       * Sample the flux on @p n equally sized subintervals of the
+       * interval [@p u_min, @p u_max] for @p n_components components.
+       * The callables @p value and @p gradient are invoked as
+       * `value(u, component)` and `gradient(u, component)`.
+       */
+      template <typename Value, typename Gradient>
+      void build(const Value &value,
+                 const Gradient &gradient,
+                 unsigned int n_components,
+                 double u_min,
+                 double u_max,
+                 unsigned int n)
+      {
+        AssertThrow(u_min < u_max && n > 0,
+                    dealii::ExcMessage("The table range has to be given by "
+                                       "a minimal and maximal value"));
+
+        std::vector<double> coefficients(n_components * n * 4);
+        const double h = (u_max - u_min) / n;
+
+        for (unsigned int c = 0; c < n_components; ++c)
+          for (unsigned int i = 0; i < n; ++i) {
+            const double left = u_min + i * h;
+            const double right = u_min + (i + 1) * h;
+
+            const double f_0 = value(left, c);
+            const double f_1 = value(right, c);
+            const double d_0 = h * gradient(left, c);
+            const double d_1 = h * gradient(right, c);
+
+            double *a = &coefficients[(c * n + i) * 4];
+            a[0] = f_0;
+            a[1] = d_0;
+            a[2] = -3. * f_0 + 3. * f_1 - 2. * d_0 - d_1;
+            a[3] = 2. * f_0 - 2. * f_1 + d_0 + d_1;
+          }
+
+        n_ = n;
+        n_components_ = n_components;
+        u_min_ = u_min;
+        u_max_ = u_max;
+        h_inverse_ = 1. / h;
+        coefficients_.swap(coefficients);
+        coefficients_float_.assign(coefficients_.begin(), coefficients_.end());
+      }
+
+      /**
+       * Reset the table to an empty state.
+       */
+      void clear()
+      {
+        coefficients_.clear();
+        coefficients_float_.clear();
+      }
+
+      /**
+       * Return true if the table has been set up and all (lanes of) @p u
+       * lie inside the tabulated range.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline bool in_range(const Number &u) const
+      {
+        if (coefficients_.empty())
+          return false;
+
+        if constexpr (std::is_arithmetic_v<Number>) {
+          return u >= u_min_ && u <= u_max_;
+        } else {
+          for (unsigned int k = 0; k < Number::size(); ++k)
+            if (!(u[k] >= u_min_ && u[k] <= u_max_))
+              return false;
+          return true;
+        }
+      }
+
+      /**
+       * Evaluate the interpolant of the flux for the given (lanes of) @p u
+       * and component @p direction.
+       *
+       * @pre in_range(u) has to be true.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number value(const Number &u,
+                                                unsigned int direction) const
+      {
+        return evaluate<Number, false>(u, direction);
+      }
+
+      /**
+       * Evaluate the derivative of the interpolant of the flux for the
+       * given (lanes of) @p u and component @p direction.
+       *
+       * @pre in_range(u) has to be true.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      gradient(const Number &u, unsigned int direction) const
+      {
+        return evaluate<Number, true>(u, direction);
+      }
+
+      /**
+       * The number of tabulated flux components.
+       */
+      ACCESSOR_READ_ONLY(n_components)
+
+      /**
+       * The lower bound of the tabulated range.
+       */
+      ACCESSOR_READ_ONLY(u_min)
+
+      /**
+       * The upper bound of the tabulated range.
+       */
+      ACCESSOR_READ_ONLY(u_max)
+
+    private:
+      template <typename Number, bool derivative>
+      DEAL_II_ALWAYS_INLINE inline Number
+      evaluate(const Number &u, unsigned int direction) const
+      {
+        Assert(direction < n_components_, dealii::ExcInternalError());
+
+        const Number s_global = (u - Number(u_min_)) * Number(h_inverse_);
+        const auto interval = [&](double s) {
+          return std::min(static_cast<unsigned int>(s), n_ - 1);
+        };
+
+        const auto horner = [&](const Number &t, const auto &a) {
+          if constexpr (derivative) {
+            const Number dp =
+                a(1) + (Number(2.) * a(2) + Number(3.) * a(3) * t) * t;
+            return Number(h_inverse_) * dp;
+          } else {
+            return ((a(3) * t + a(2)) * t + a(1)) * t + a(0);
+          }
+        };
+
+        if constexpr (std::is_arithmetic_v<Number>) {
+          const auto i = interval(s_global);
+          const Number t = s_global - Number(i);
+          const auto *a = &coefficients<Number>()[(direction * n_ + i) * 4];
+          return horner(t, [a](unsigned int m) { return a[m]; });
+
+        } else {
+          using ScalarNumber = typename Number::value_type;
+
+          std::array<unsigned int, Number::size()> offsets;
+          Number t;
+          for (unsigned int k = 0; k < Number::size(); ++k) {
+            const auto i = interval(s_global[k]);
+            t[k] = s_global[k] - ScalarNumber(i);
+            offsets[k] = (direction * n_ + i) * 4;
+          }
+
+          const auto *a = coefficients<ScalarNumber>().data();
+          return horner(t, [&](unsigned int m) {
+            Number result;
+            result.gather(a + m, offsets.data());
+            return result;
+          });
+        }
+      }
+
+      template <typename ScalarNumber>
+      DEAL_II_ALWAYS_INLINE inline const std::vector<ScalarNumber> &
+      coefficients() const
+      {
+        if constexpr (std::is_same_v<ScalarNumber, float>)
+          return coefficients_float_;
+        else
+          return coefficients_;
+      }
+
+      unsigned int n_ = 0;
+      unsigned int n_components_ = 0;
+      double u_min_ = 0.;
+      double u_max_ = 0.;
+      double h_inverse_ = 0.;
+
+      std::vector<double> coefficients_;
+      std::vector<float> coefficients_float_;
+    };
+  } // namespace FluxLibrary
+} // namespace ryujin
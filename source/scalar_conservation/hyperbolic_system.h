@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "flux_burgers.h"
+#include "flux_kpp.h"
 #include "flux_library.h"
 
 #include <convenience_macros.h>
@@ -70,6 +72,20 @@ namespace ryujin
       using Flux = FluxLibrary::Flux;
       std::shared_ptr<Flux> selected_flux_;
 
+      /*
+       * Set if the selected flux is one of the built-in closed-form
+       * fluxes. The HyperbolicSystemView then evaluates the flux inline
+       * instead of calling through the virtual Flux interface.
+       */
+      bool flux_is_burgers_;
+      bool flux_is_kpp_;
+
+      /*
+       * A pre-sampled table of the selected flux, or a nullptr if the
+       * flux is not tabulated.
+       */
+      const FluxLibrary::FluxTable *flux_table_;
+
       template <int dim, typename Number>
       friend class HyperbolicSystemView;
       //@}
@@ -273,6 +289,16 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 1;
 
+      /**
+       * Return true if the precomputed values of precomputation cycle
+       * @p cycle are a pointwise function of the state. This is the case
+       * for the flux and its gradient.
+       */
+      static constexpr bool pointwise_precomputation(const unsigned int cycle)
+      {
+        return cycle == 0;
+      }
+
       /**
        * Step 0: precompute values for hyperbolic update. This routine is
        * called within our usual loop() idiom in HyperbolicModule
@@ -437,6 +463,9 @@ namespace ryujin
       /** We do not have source terms */
       static constexpr bool have_source_terms = false;
 
+      /** We do not have source terms treated with an operator split */
+      static constexpr bool have_split_source_terms = false;
+
       state_type nodal_source(const PrecomputedVector &pv,
                               const unsigned int i,
                               const state_type &U_i,
@@ -532,6 +561,11 @@ namespace ryujin
           if (it->name() == flux_) {
             selected_flux_ = it;
             it->parse_parameters_call_back();
+            flux_is_burgers_ =
+                dynamic_cast<const FluxLibrary::Burgers *>(it.get()) != nullptr;
+            flux_is_kpp_ =
+                dynamic_cast<const FluxLibrary::KPP *>(it.get()) != nullptr;
+            flux_table_ = it->table();
             problem_name = "Scalar conservation equation (" + it->name() +
                            ": " + it->flux_formula() + ")";
             initialized = true;
@@ -556,14 +590,42 @@ namespace ryujin
       const auto &flux = hyperbolic_system_.selected_flux_;
       dealii::Tensor<1, dim, Number> result;
 
-      /* This access by calling into value() repeatedly is terrible: */
-      for (unsigned int k = 0; k < dim; ++k) {
-        if constexpr (std::is_same_v<ScalarNumber, Number>) {
+      if (hyperbolic_system_.flux_is_burgers_) {
+        for (unsigned int k = 0; k < dim; ++k)
+          result[k] = FluxLibrary::Burgers::value_impl(u, k);
+        return result;
+      }
+
+      if (hyperbolic_system_.flux_is_kpp_) {
+        for (unsigned int k = 0; k < dim; ++k)
+          result[k] = FluxLibrary::KPP::value_impl(u, k);
+        return result;
+      }
+
+      if (const auto table = hyperbolic_system_.flux_table_;
+          table != nullptr && table->in_range(u)) {
+        for (unsigned int k = 0; k < dim; ++k)
+          result[k] = table->value(u, k);
+        return result;
+      }
+
+      if constexpr (std::is_same_v<ScalarNumber, Number>) {
+        for (unsigned int k = 0; k < dim; ++k)
           result[k] = flux->value(u, k);
-        } else {
-          for (unsigned int s = 0; s < Number::size(); ++s) {
-            result[k][s] = flux->value(u[s], k);
-          }
+
+      } else {
+        /* Make a single call into the vector interface per component: */
+        constexpr auto width = Number::size();
+        std::array<double, width> states, values;
+        for (unsigned int s = 0; s < width; ++s)
+          states[s] = u[s];
+
+        for (unsigned int k = 0; k < dim; ++k) {
+          flux->value(dealii::ArrayView<double>(values.data(), width),
+                     dealii::ArrayView<const double>(states.data(), width),
+                     k);
+          for (unsigned int s = 0; s < width; ++s)
+            result[k][s] = ScalarNumber(values[s]);
         }
       }
 
@@ -579,14 +641,43 @@ namespace ryujin
       const auto &flux = hyperbolic_system_.selected_flux_;
       dealii::Tensor<1, dim, Number> result;
 
-      /* This access by calling into value() repeatedly is terrible: */
-      for (unsigned int k = 0; k < dim; ++k) {
-        if constexpr (std::is_same_v<ScalarNumber, Number>) {
+      if (hyperbolic_system_.flux_is_burgers_) {
+        for (unsigned int k = 0; k < dim; ++k)
+          result[k] = FluxLibrary::Burgers::gradient_impl(u, k);
+        return result;
+      }
+
+      if (hyperbolic_system_.flux_is_kpp_) {
+        for (unsigned int k = 0; k < dim; ++k)
+          result[k] = FluxLibrary::KPP::gradient_impl(u, k);
+        return result;
+      }
+
+      if (const auto table = hyperbolic_system_.flux_table_;
+          table != nullptr && table->in_range(u)) {
+        for (unsigned int k = 0; k < dim; ++k)
+          result[k] = table->gradient(u, k);
+        return result;
+      }
+
+      if constexpr (std::is_same_v<ScalarNumber, Number>) {
+        for (unsigned int k = 0; k < dim; ++k)
           result[k] = flux->gradient(u, k);
-        } else {
-          for (unsigned int s = 0; s < Number::size(); ++s) {
-            result[k][s] = flux->gradient(u[s], k);
-          }
+
+      } else {
+        /* Make a single call into the vector interface per component: */
+        constexpr auto width = Number::size();
+        std::array<double, width> states, values;
+        for (unsigned int s = 0; s < width; ++s)
+          states[s] = u[s];
+
+        for (unsigned int k = 0; k < dim; ++k) {
+          flux->gradient(
+              dealii::ArrayView<double>(values.data(), width),
+              dealii::ArrayView<const double>(states.data(), width),
+              k);
+          for (unsigned int s = 0; s < width; ++s)
+            result[k][s] = ScalarNumber(values[s]);
         }
       }
 
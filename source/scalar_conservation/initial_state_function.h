@@ -6,10 +6,9 @@
 #pragma once
 
 #include "hyperbolic_system.h"
+#include <expression_function.h>
 #include <initial_state_library.h>
 
-#include <deal.II/base/function_parser.h>
-
 namespace ryujin
 {
   namespace ScalarConservation
@@ -38,29 +37,43 @@ namespace ryujin
                             expression_,
                             "A function expression for the initial state");
 
+        time_independent_ = false;
+        this->add_parameter(
+            "time independent",
+            time_independent_,
+            "Set to true if the function expressions do not depend on time "
+            "t. This allows to cache Dirichlet boundary values.");
+
+        compile_expressions_ = false;
+        this->add_parameter(
+            "compile expressions",
+            compile_expressions_,
+            "Compile the function expressions to native code with SymEngine "
+            "instead of interpreting them with muparser. Requires deal.II to "
+            "be configured with SymEngine");
+
         /*
-         * Set up the muparser object with the final flux description from
-         * the parameter file:
+         * Set up the function object with the final description from the
+         * parameter file:
          */
-        const auto set_up_muparser = [this] {
-          /*
-           * This variant of the constructor initializes the function
-           * parser with support for a time-dependent description involving
-           * a variable »t«:
-           */
-          function_ =
-              std::make_unique<dealii::FunctionParser<dim>>(expression_);
+        const auto set_up_function = [this] {
+          function_ = std::make_unique<ExpressionFunction<dim, 1>>(
+              std::array<std::string, 1>{expression_}, compile_expressions_);
         };
 
-        set_up_muparser();
-        this->parse_parameters_call_back.connect(set_up_muparser);
+        set_up_function();
+        this->parse_parameters_call_back.connect(set_up_function);
+      }
+
+      bool is_time_independent() const final
+      {
+        return time_independent_;
       }
 
       state_type compute(const dealii::Point<dim> &point, Number t) final
       {
-        function_->set_time(t);
         state_type result;
-        result[0] = function_->value(point);
+        result[0] = function_->value(point, t)[0];
         return result;
       }
 
@@ -68,7 +81,11 @@ namespace ryujin
       const HyperbolicSystem &hyperbolic_system;
 
       std::string expression_;
-      std::unique_ptr<dealii::FunctionParser<dim>> function_;
+
+      bool time_independent_;
+      bool compile_expressions_;
+
+      std::unique_ptr<ExpressionFunction<dim, 1>> function_;
     };
   } // namespace ScalarConservation
 } // namespace ryujin
@@ -36,6 +36,11 @@ namespace ryujin
             "primitive state", primitive_, "Initial 1d primitive state");
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> & /*point*/,
                          Number /*t*/) final
       {
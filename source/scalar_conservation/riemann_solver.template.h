@@ -132,6 +132,12 @@ namespace ryujin
        */
 
       const auto enforce_entropy = [&](const Number &k) {
+        /*
+         * If the flux is tabulated, and k lies within the table range,
+         * this is a vectorized table lookup. The state k is a convex
+         * combination of u_i and u_j, so it satisfies the same local
+         * bounds as the states enforced by the limiter:
+         */
         const Number f_k = view.flux_function(k) * n_ij;
 
 #ifdef DEBUG_RIEMANN_SOLVER
@@ -1,19 +1,143 @@
 //
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
-// Copyright (C) 2020 - 2021 by the ryujin authors
+// Copyright (C) 2020 - 2024 by the ryujin authors
 //
 
 #pragma once
 
+#include <compile_time_options.h>
+
+#include "perf_counters.h"
+#include "trace.h"
+
 #include <deal.II/base/timer.h>
 
+#include <chrono>
+#include <ctime>
 #include <map>
 #include <string>
 
+#ifdef DEBUG_OUTPUT
+#include <iostream>
+#endif
+
 namespace ryujin
 {
   /**
-   * A RAII scope for deal.II timer objects.
+   * A lightweight timer that accumulates the wall time and the (process)
+   * CPU time spent between calls to start() and stop().
+   *
+   * In contrast to dealii::Timer, start() and stop() neither allocate
+   * memory nor perform any MPI communication (dealii::Timer computes lap
+   * time statistics with an MPI reduction on every stop()). The wall time
+   * is measured with std::chrono::steady_clock, the CPU time with
+   * std::clock(). If hardware performance counters are active (see
+   * PerfCounters) the counter increments are accumulated as well. If the
+   * timer has a name and the Tracer is enabled, every lap is recorded as
+   * a region of the timeline trace.
+   *
+   * @ingroup Miscellaneous
+   */
+  class SectionTimer
+  {
+  public:
+    /**
+     * Start the timer. Calling start() on a running timer restarts the
+     * current lap.
+     */
+    void start()
+    {
+      running_ = true;
+      traced_ = name_ != nullptr && Tracer::enabled();
+      if (traced_)
+        Tracer::instance().record(name_, 'B');
+      wall_start_ = clock::now();
+      cpu_start_ = std::clock();
+#ifdef PERF_COUNTERS
+      counters_start_ = PerfCounters::instance().read();
+#endif
+    }
+
+    /**
+     * Stop the timer and add the current lap to the accumulated times.
+     */
+    void stop()
+    {
+      if (!running_)
+        return;
+      running_ = false;
+      wall_time_ += std::chrono::duration<double>(clock::now() - wall_start_)
+                        .count();
+      cpu_time_ += double(std::clock() - cpu_start_) / CLOCKS_PER_SEC;
+#ifdef PERF_COUNTERS
+      const auto counters = PerfCounters::instance().read();
+      for (unsigned int e = 0; e < PerfCounters::n_events; ++e)
+        counters_[e] += counters[e] - counters_start_[e];
+#endif
+      if (traced_)
+        Tracer::instance().record(name_, 'E');
+    }
+
+    /**
+     * Return the accumulated wall time (including the current lap if the
+     * timer is running).
+     */
+    double wall_time() const
+    {
+      if (!running_)
+        return wall_time_;
+      return wall_time_ +
+             std::chrono::duration<double>(clock::now() - wall_start_).count();
+    }
+
+    /**
+     * Return the accumulated CPU time (including the current lap if the
+     * timer is running).
+     */
+    double cpu_time() const
+    {
+      if (!running_)
+        return cpu_time_;
+      return cpu_time_ + double(std::clock() - cpu_start_) / CLOCKS_PER_SEC;
+    }
+
+    /**
+     * Return the accumulated hardware performance counters of all
+     * completed laps. All values are zero unless ryujin is configured
+     * with PERF_COUNTERS and PerfCounters::initialize() succeeded.
+     */
+    const PerfCounters::Values &counters() const
+    {
+      return counters_;
+    }
+
+    /**
+     * Set the name under which laps are recorded in the timeline trace.
+     * The string has to outlive the timer, typically it is the key of
+     * the timer map.
+     */
+    void set_name(const char *name)
+    {
+      name_ = name;
+    }
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    const char *name_ = nullptr;
+    bool traced_ = false;
+    bool running_ = false;
+    clock::time_point wall_start_;
+    std::clock_t cpu_start_ = 0;
+    double wall_time_ = 0.;
+    double cpu_time_ = 0.;
+    PerfCounters::Values counters_start_{};
+    PerfCounters::Values counters_{};
+  };
+
+
+  /**
+   * A RAII scope for SectionTimer objects.
    *
    * This class does not perform MPI synchronization in contrast to the
    * deal.II counterpart.
@@ -26,15 +150,34 @@ namespace ryujin
     /**
      * Constructor. Starts a timer for the selected @p section.
      */
-    Scope(std::map<std::string, dealii::Timer> &computing_timer,
+    Scope(std::map<std::string, SectionTimer> &computing_timer,
           const std::string &section)
-        : computing_timer_(computing_timer)
+        : timer_(register_timer(computing_timer, section))
+#ifdef DEBUG_OUTPUT
         , section_(section)
+#endif
     {
-      computing_timer_[section_].start();
 #ifdef DEBUG_OUTPUT
       std::cout << "{scoped timer} \"" << section_ << "\" started" << std::endl;
 #endif
+      timer_.start();
+    }
+
+    /**
+     * Constructor. Starts the (already registered) timer @p timer. This
+     * variant does not construct a string and does not perform a map
+     * lookup and is intended for hot loops.
+     */
+    Scope(SectionTimer &timer)
+        : timer_(timer)
+#ifdef DEBUG_OUTPUT
+        , section_("(registered timer)")
+#endif
+    {
+#ifdef DEBUG_OUTPUT
+      std::cout << "{scoped timer} \"" << section_ << "\" started" << std::endl;
+#endif
+      timer_.start();
     }
 
     /**
@@ -42,14 +185,30 @@ namespace ryujin
      */
     ~Scope()
     {
+      timer_.stop();
 #ifdef DEBUG_OUTPUT
       std::cout << "{scoped timer} \"" << section_ << "\" stopped" << std::endl;
 #endif
-      computing_timer_[section_].stop();
+    }
+
+    /**
+     * Return the timer for @p section of @p computing_timer. A newly
+     * created timer is named after its section.
+     */
+    static SectionTimer &
+    register_timer(std::map<std::string, SectionTimer> &computing_timer,
+                   const std::string &section)
+    {
+      const auto [it, inserted] = computing_timer.try_emplace(section);
+      if (inserted)
+        it->second.set_name(it->first.c_str());
+      return it->second;
     }
 
   private:
-    std::map<std::string, dealii::Timer> &computing_timer_;
+    SectionTimer &timer_;
+#ifdef DEBUG_OUTPUT
     const std::string section_;
+#endif
   };
 } // namespace ryujin
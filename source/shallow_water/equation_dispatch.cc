@@ -13,5 +13,9 @@ namespace ryujin
   namespace ShallowWater
   {
     Dispatch<Description, NUMBER> dispatch_instance("shallow water");
+#ifdef RUNTIME_PRECISION
+    Dispatch<Description, ALTERNATIVE_NUMBER>
+        alternative_dispatch_instance("shallow water");
+#endif
   } // namespace ShallowWater
 } // namespace ryujin
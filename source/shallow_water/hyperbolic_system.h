@@ -69,6 +69,7 @@ namespace ryujin
       //@{
       double gravity_;
       double manning_friction_coefficient_;
+      bool manning_friction_implicit_;
 
       double reference_water_depth_;
       double dry_state_relaxation_factor_;
@@ -140,6 +141,11 @@ namespace ryujin
         return hyperbolic_system_.manning_friction_coefficient_;
       }
 
+      DEAL_II_ALWAYS_INLINE inline bool manning_friction_implicit() const
+      {
+        return hyperbolic_system_.manning_friction_implicit_;
+      }
+
       DEAL_II_ALWAYS_INLINE inline ScalarNumber reference_water_depth() const
       {
         return hyperbolic_system_.reference_water_depth_;
@@ -196,9 +202,10 @@ namespace ryujin
           dealii::Tensor<1, problem_dimension, dealii::Tensor<1, dim, Number>>;
 
       /**
-       * The storage type used for flux contributions.
+       * The storage type used for flux contributions: the state, the
+       * bathymetry, and the precomputed mollified inverse water depth.
        */
-      using flux_contribution_type = std::tuple<state_type, Number>;
+      using flux_contribution_type = std::tuple<state_type, Number, Number>;
 
       /**
        * An array holding all component names of the conserved state as a
@@ -233,7 +240,7 @@ namespace ryujin
       /**
        * The number of precomputed values.
        */
-      static constexpr unsigned int n_precomputed_values = 2;
+      static constexpr unsigned int n_precomputed_values = 3;
 
       /**
        * Array type used for precomputed values.
@@ -244,7 +251,8 @@ namespace ryujin
        * An array holding all component names of the precomputed values.
        */
       static inline const auto precomputed_names =
-          std::array<std::string, n_precomputed_values>{"eta_m", "h_star"};
+          std::array<std::string, n_precomputed_values>{
+              "eta_m", "h_star", "h_inverse_mollified"};
 
       /**
        * The number of precomputed initial values.
@@ -300,6 +308,16 @@ namespace ryujin
        */
       static constexpr unsigned int n_precomputation_cycles = 1;
 
+      /**
+       * Return true if the precomputed values of precomputation cycle
+       * @p cycle are a pointwise function of the state. The entropy and
+       * the (mollified) water depths only depend on the state itself.
+       */
+      static constexpr bool pointwise_precomputation(const unsigned int cycle)
+      {
+        return cycle == 0;
+      }
+
       /**
        * Step 0: precompute values for hyperbolic update. This routine is
        * called within our usual loop() idiom in HyperbolicModule
@@ -472,10 +490,22 @@ namespace ryujin
                             const Number &Z_left,
                             const Number &Z_right) const;
 
+      /**
+       * Variant of above function that takes a precomputed mollified
+       * inverse water depth @p h_inverse of the state <code>U</code>.
+       */
+      state_type star_state(const state_type &U,
+                            const Number &Z_left,
+                            const Number &Z_right,
+                            const Number &h_inverse) const;
+
       /**
        * Given precomputed flux contributions @p prec_i and @p prec_j
        * compute the equilibrated states \f$U_i^{\ast,j}\f$ and
-       * \f$U_j^{\ast,i}\f$.
+       * \f$U_j^{\ast,i}\f$. The mollified inverse water depths are
+       * taken from the flux contributions, so that the hydrostatic
+       * reconstruction only consists of a handful of arithmetic
+       * operations per edge.
        */
       std::array<state_type, 2>
       equilibrated_states(const flux_contribution_type &,
@@ -499,7 +529,8 @@ namespace ryujin
        * ```
        *
        * For the Shallow water equations we simply retrieve the
-       * bathymetry and return, both, state and bathymetry.
+       * bathymetry and the mollified inverse water depth (stored by
+       * precomputation_loop()) and return them together with the state.
        */
       flux_contribution_type
       flux_contribution(const PrecomputedVector &pv,
@@ -523,6 +554,16 @@ namespace ryujin
                       const flux_contribution_type &flux_j,
                       const dealii::Tensor<1, dim, Number> &c_ij) const;
 
+      /**
+       * Variant of above function that takes the equilibrated states
+       * @p U_star (as returned by equilibrated_states()) of the edge
+       * instead of recomputing them.
+       */
+      state_type
+      flux_divergence(const flux_contribution_type &flux_i,
+                      const std::array<state_type, 2> &U_star,
+                      const dealii::Tensor<1, dim, Number> &c_ij) const;
+
       /**
        * The low-order and high-order fluxes differ:
        */
@@ -576,6 +617,37 @@ namespace ryujin
                               const state_type &U_j,
                               const ScalarNumber tau) const;
 
+      /**
+       * We treat the Manning friction with an operator split if requested.
+       */
+      static constexpr bool have_split_source_terms = true;
+
+      /**
+       * Return true if source terms are treated with an operator split,
+       * i.e., if the Manning friction is applied implicitly with
+       * split_source_update() instead of nodal_source().
+       */
+      bool split_source_terms() const
+      {
+        return manning_friction_implicit();
+      }
+
+      /**
+       * Pointwise implicit Manning friction update. For a fixed water
+       * depth the friction ODE
+       * \f$\partial_t\mathbf q = -g\,n^2\,|\mathbf q|\,\mathbf q
+       * /h^{7/3}\f$ has the exact solution
+       * \f{align}
+       *   \mathbf q(\tau) = \frac{\mathbf q_0}{1 + \tau g\,n^2\,
+       *   |\mathbf v_0|/h^{4/3}},
+       * \f}
+       * which we evaluate with the mollified inverse water depth and the
+       * sharp water depth. The update is unconditionally stable and
+       * preserves the invariant domain.
+       */
+      state_type split_source_update(const state_type &U,
+                                     const ScalarNumber tau) const;
+
       //@}
       /**
        * @name State transformations (primitive states, expanding
@@ -651,6 +723,14 @@ namespace ryujin
                     manning_friction_coefficient_,
                     "Roughness coefficient for friction source");
 
+      manning_friction_implicit_ = false;
+      add_parameter("manning friction implicit",
+                    manning_friction_implicit_,
+                    "If set to true the friction source is not part of the "
+                    "explicit hyperbolic update but is applied with an exact "
+                    "pointwise implicit solve after every time step "
+                    "(operator split)");
+
       reference_water_depth_ = 1.;
       add_parameter("reference water depth",
                     reference_water_depth_,
@@ -710,7 +790,9 @@ namespace ryujin
         const auto h_sharp = water_depth_sharp(U_i);
         const auto h_star = ryujin::pow(h_sharp, ScalarNumber(4. / 3.));
 
-        const precomputed_type prec_i{eta_m, h_star};
+        const auto h_inverse = inverse_water_depth_mollified(U_i);
+
+        const precomputed_type prec_i{eta_m, h_star, h_inverse};
         precomputed.template write_tensor<Number>(prec_i, i);
       }
     }
@@ -1061,12 +1143,24 @@ namespace ryujin
                                                   const Number &Z_left,
                                                   const Number &Z_right) const
         -> state_type
+    {
+      return star_state(U, Z_left, Z_right, inverse_water_depth_mollified(U));
+    }
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::star_state(const state_type &U,
+                                                  const Number &Z_left,
+                                                  const Number &Z_right,
+                                                  const Number &h_inverse) const
+        -> state_type
     {
       const Number Z_max = std::max(Z_left, Z_right);
       const Number h = water_depth(U);
       const Number H_star = std::max(Number(0.), h + Z_left - Z_max);
 
-      return U * H_star * inverse_water_depth_mollified(U);
+      return U * H_star * h_inverse;
     }
 
 
@@ -1076,11 +1170,11 @@ namespace ryujin
         const flux_contribution_type &flux_i,
         const flux_contribution_type &flux_j) const -> std::array<state_type, 2>
     {
-      const auto &[U_i, Z_i] = flux_i;
-      const auto &[U_j, Z_j] = flux_j;
+      const auto &[U_i, Z_i, h_inverse_i] = flux_i;
+      const auto &[U_j, Z_j, h_inverse_j] = flux_j;
 
-      const auto U_star_ij = star_state(U_i, Z_i, Z_j);
-      const auto U_star_ji = star_state(U_j, Z_j, Z_i);
+      const auto U_star_ij = star_state(U_i, Z_i, Z_j, h_inverse_i);
+      const auto U_star_ji = star_state(U_j, Z_j, Z_i, h_inverse_j);
 
       return {U_star_ij, U_star_ji};
     }
@@ -1089,26 +1183,28 @@ namespace ryujin
     template <int dim, typename Number>
     DEAL_II_ALWAYS_INLINE inline auto
     HyperbolicSystemView<dim, Number>::flux_contribution(
-        const PrecomputedVector & /*pv*/,
+        const PrecomputedVector &pv,
         const InitialPrecomputedVector &piv,
         const unsigned int i,
         const state_type &U_i) const -> flux_contribution_type
     {
       const auto Z_i = piv.template get_tensor<Number>(i)[0];
-      return {U_i, Z_i};
+      const auto h_inverse_i = pv.template get_tensor<Number>(i)[2];
+      return {U_i, Z_i, h_inverse_i};
     }
 
 
     template <int dim, typename Number>
     DEAL_II_ALWAYS_INLINE inline auto
     HyperbolicSystemView<dim, Number>::flux_contribution(
-        const PrecomputedVector & /*pv*/,
+        const PrecomputedVector &pv,
         const InitialPrecomputedVector &piv,
         const unsigned int *js,
         const state_type &U_j) const -> flux_contribution_type
     {
       const auto Z_j = piv.template get_tensor<Number>(js)[0];
-      return {U_j, Z_j};
+      const auto h_inverse_j = pv.template get_tensor<Number>(js)[2];
+      return {U_j, Z_j, h_inverse_j};
     }
 
 
@@ -1119,8 +1215,19 @@ namespace ryujin
         const flux_contribution_type &flux_j,
         const dealii::Tensor<1, dim, Number> &c_ij) const -> state_type
     {
-      const auto &[U_i, Z_i] = flux_i;
-      const auto &[U_star_ij, U_star_ji] = equilibrated_states(flux_i, flux_j);
+      return flux_divergence(flux_i, equilibrated_states(flux_i, flux_j), c_ij);
+    }
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::flux_divergence(
+        const flux_contribution_type &flux_i,
+        const std::array<state_type, 2> &U_star,
+        const dealii::Tensor<1, dim, Number> &c_ij) const -> state_type
+    {
+      const auto &U_i = std::get<0>(flux_i);
+      const auto &[U_star_ij, U_star_ji] = U_star;
 
       const auto H_i = water_depth(U_i);
       const auto H_star_ij = water_depth(U_star_ij);
@@ -1151,8 +1258,8 @@ namespace ryujin
         const flux_contribution_type &flux_j,
         const dealii::Tensor<1, dim, Number> &c_ij) const -> state_type
     {
-      const auto &[U_i, Z_i] = flux_i;
-      const auto &[U_j, Z_j] = flux_j;
+      const auto &[U_i, Z_i, h_inverse_i] = flux_i;
+      const auto &[U_j, Z_j, h_inverse_j] = flux_j;
 
       const auto H_i = water_depth(U_i);
       const auto H_j = water_depth(U_j);
@@ -1179,9 +1286,9 @@ namespace ryujin
         const dealii::Tensor<1, dim, Number> &c_ij,
         const Number &d_ij) const -> state_type
     {
-      const auto &[U_i, Z_i] = flux_i;
-      const auto &[U_j, Z_j] = flux_j;
-      const auto U_star_ij = star_state(U_i, Z_i, Z_j);
+      const auto &[U_i, Z_i, h_inverse_i] = flux_i;
+      const auto Z_j = std::get<1>(flux_j);
+      const auto U_star_ij = star_state(U_i, Z_i, Z_j, h_inverse_i);
 
       const auto h_inverse = inverse_water_depth_sharp(U_i);
       const auto m = momentum(U_i);
@@ -1226,7 +1333,10 @@ namespace ryujin
         const state_type &U_i,
         const ScalarNumber tau) const -> state_type
     {
-      const auto &[eta_m, h_star] =
+      if (manning_friction_implicit())
+        return state_type();
+
+      const auto &[eta_m, h_star, h_inverse] =
           pv.template get_tensor<Number, precomputed_type>(i);
 
       return manning_friction(U_i, h_star, tau);
@@ -1241,13 +1351,46 @@ namespace ryujin
         const state_type &U_j,
         const ScalarNumber tau) const -> state_type
     {
-      const auto &[eta_m, h_star] =
+      if (manning_friction_implicit())
+        return state_type();
+
+      const auto &[eta_m, h_star, h_inverse] =
           pv.template get_tensor<Number, precomputed_type>(js);
 
       return manning_friction(U_j, h_star, tau);
     }
 
 
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystemView<dim, Number>::split_source_update(
+        const state_type &U, const ScalarNumber tau) const -> state_type
+    {
+      const auto g = gravity();
+      const auto n = manning_friction_coefficient();
+
+      const auto h_sharp = water_depth_sharp(U);
+      const auto h_star = ryujin::pow(h_sharp, ScalarNumber(4. / 3.));
+      const auto h_inverse = inverse_water_depth_mollified(U);
+
+      const auto m = momentum(U);
+      const auto v_norm = (m * h_inverse).norm();
+      const auto factor = g * n * n * v_norm;
+
+      /* Avoid a division by zero for dry states at rest: */
+      const auto denominator =
+          std::max(h_star + tau * factor,
+                   Number(std::numeric_limits<ScalarNumber>::min()));
+      const auto ratio = h_star / denominator;
+
+      auto result = U;
+      for (unsigned int d = 0; d < dim; ++d)
+        result[d + 1] = ratio * m[d];
+
+      return result;
+    }
+
+
     template <int dim, typename Number>
     template <typename ST>
     DEAL_II_ALWAYS_INLINE inline auto
@@ -160,7 +160,7 @@ namespace ryujin
 
       const auto view = hyperbolic_system.view<dim, Number>();
 
-      const auto &[eta_m, h_star] =
+      const auto &[eta_m, h_star, h_inverse] =
           precomputed_values.template get_tensor<Number, precomputed_type>(i);
 
       h_i = view.water_depth(U_i);
@@ -184,7 +184,7 @@ namespace ryujin
 
       const auto view = hyperbolic_system.view<dim, Number>();
 
-      const auto &[eta_j, h_star_j] =
+      const auto &[eta_j, h_star_j, h_inverse_j] =
           precomputed_values.template get_tensor<Number, precomputed_type>(js);
 
       const auto velocity_j =
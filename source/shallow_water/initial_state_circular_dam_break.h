@@ -45,6 +45,11 @@ namespace ryujin
             "dam amplitude", dam_amplitude_, "Amplitude of circular dam");
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number /*t*/) final
       {
         const Number r = point.norm_square();
@@ -46,6 +46,11 @@ namespace ryujin
                             "Initial 1d primitive state (h, u) on the right");
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number /*t*/) final
       {
         const auto view = hyperbolic_system_.template view<dim, Number>();
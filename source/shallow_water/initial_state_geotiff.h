@@ -10,6 +10,8 @@
 
 #include <deal.II/base/function_parser.h>
 
+#include <algorithm>
+
 
 #ifdef WITH_GDAL
 #include <cpl_conv.h>
@@ -26,6 +28,12 @@ namespace ryujin
      * file. For this we link against GDAL, see https://gdal.org/index.html
      * for details on GDAL and what image formats it supports.
      *
+     * Every MPI rank only reads in the window of the raster that overlaps
+     * with its locally relevant cells (see
+     * InitialState::set_region_of_interest()), optionally downsampled by
+     * an integer factor. Downsampled reads can be served from a cache of
+     * GDAL overviews that is built on first use.
+     *
      * @ingroup ShallowWaterEquations
      */
     template <typename Description, int dim, typename Number>
@@ -75,6 +83,31 @@ namespace ryujin
             "the affine transformation. If set to false the origin specified "
             "in the transformation parameter will be used instead.");
 
+        windowed_read_ = true;
+        this->add_parameter(
+            "windowed read",
+            windowed_read_,
+            "GeoTIFF: only read in the window of the raster that overlaps "
+            "with the locally relevant cells of the current MPI rank instead "
+            "of the entire image");
+
+        downsampling_factor_ = 1;
+        this->add_parameter(
+            "downsampling factor",
+            downsampling_factor_,
+            "GeoTIFF: read in the raster downsampled by the given integer "
+            "factor (by averaging). A value of 1 reads in the raster at full "
+            "resolution");
+
+        build_overviews_ = false;
+        this->add_parameter(
+            "build overviews",
+            build_overviews_,
+            "GeoTIFF: if the downsampling factor is larger than one, build a "
+            "cache of (power of two) downsampled overviews next to the image "
+            "file if none is present. Subsequent (downsampled) reads are then "
+            "served from the overview cache");
+
         height_expression_ = "1.4";
         this->add_parameter(
             "water height expression",
@@ -95,10 +128,14 @@ namespace ryujin
           driver_projection = "";
           affine_transformation = {0, 0, 0, 0, 0, 0};
           inverse_affine_transformation = {0, 0, 0, 0, 0, 0};
+          image_size = {0, 0};
           raster_offset = {0, 0};
           raster_size = {0, 0};
           raster.clear();
 #endif
+          window_ = {0, 0, 0, 0};
+          have_window_ = false;
+          geotiff_guard_.reset();
 
           using FP = dealii::FunctionParser<dim>;
           /*
@@ -138,9 +175,84 @@ namespace ryujin
         return {compute_bathymetry(point)};
       }
 
+      void set_region_of_interest(const dealii::BoundingBox<dim> &box,
+                                  const MPI_Comm &mpi_communicator) final
+      {
+#ifdef WITH_GDAL
+        if (build_overviews_ && downsampling_factor_ > 1) {
+          if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+            build_overviews();
+          const int ierr = MPI_Barrier(mpi_communicator);
+          AssertThrowMPI(ierr);
+        }
+#else
+        (void)mpi_communicator;
+#endif
+
+        if (!windowed_read_)
+          return;
+
+        /*
+         * Store the bounding box in real coordinates. We only have to read
+         * in a new raster window if the region of interest is not entirely
+         * contained in the current window:
+         */
+
+        const auto &[p_min, p_max] = box.get_boundary_points();
+        std::array<double, 4> window{p_min[0], p_max[0], 0., 0.};
+        if constexpr (dim >= 2) {
+          window[2] = p_min[1];
+          window[3] = p_max[1];
+        }
+
+        const bool contained = have_window_ && window_[0] <= window[0] &&
+                               window[1] <= window_[1] &&
+                               window_[2] <= window[2] &&
+                               window[3] <= window_[3];
+        if (contained)
+          return;
+
+        window_ = window;
+        have_window_ = true;
+        geotiff_guard_.reset();
+      }
+
     private:
       const HyperbolicSystem &hyperbolic_system_;
 
+#ifdef WITH_GDAL
+      void build_overviews() const
+      {
+        auto dataset_handle = GDALOpen(filename_.c_str(), GA_ReadOnly);
+        AssertThrow(dataset_handle,
+                    dealii::ExcMessage("GDAL error: file not found"));
+
+        auto dataset = GDALDataset::FromHandle(dataset_handle);
+        Assert(dataset, dealii::ExcInternalError());
+
+        if (dataset->GetRasterBand(1)->GetOverviewCount() == 0) {
+          std::vector<int> levels;
+          for (unsigned int l = 2; l <= downsampling_factor_; l *= 2)
+            levels.push_back(l);
+
+          /* For a read-only dataset GDAL writes an external .ovr file: */
+          const auto error_code = GDALBuildOverviews(dataset_handle,
+                                                     "AVERAGE",
+                                                     levels.size(),
+                                                     levels.data(),
+                                                     0,
+                                                     nullptr,
+                                                     GDALDummyProgress,
+                                                     nullptr);
+          AssertThrow(error_code == CE_None,
+                      dealii::ExcMessage(
+                          "GDAL driver error: error building overviews"));
+        }
+
+        GDALClose(dataset_handle);
+      }
+#endif
+
 
       void read_in_raster() const
       {
@@ -174,34 +286,7 @@ namespace ryujin
                         "dimension than the (global) raster dimension of the "
                         "geotiff image. This is not supported."));
 
-        /*
-         * FIXME: For now, we simply read in the entire geotiff file on
-         * each rank. In order to save memory for very large files it would
-         * be possible to create a bounding box for the all active cells of
-         * the triangulation and then only read in a small region for which
-         * we actually need data.
-         */
-
-        raster_offset = {0, 0};
-        raster_size = {dataset->GetRasterXSize(), dataset->GetRasterYSize()};
-
-        raster.resize(raster_size[0] * raster_size[1]);
-        const auto error_code = raster_band->RasterIO(
-            GF_Read,
-            raster_offset[0], /* x-offset of image region */
-            raster_offset[1], /* y-offset of image region */
-            raster_size[0],   /* x-size of image region */
-            raster_size[1],   /* y-size of image region */
-            raster.data(),
-            raster_size[0], /* x-size of target buffer */
-            raster_size[1], /* y-size of target buffer */
-            GDT_Float32,
-            0,
-            0);
-
-        AssertThrow(error_code == 0,
-                    dealii::ExcMessage(
-                        "GDAL driver error: error reading in geotiff file"));
+        image_size = {dataset->GetRasterXSize(), dataset->GetRasterYSize()};
 
         /*
          * Read in the affine transformation from the geotiff image.
@@ -232,7 +317,7 @@ namespace ryujin
          */
         if (transformation_use_geotiff_ == false ||
             transformation_use_geotiff_origin_ == false) {
-          const auto j_max = raster_size[1] - 1;
+          const auto j_max = image_size[1] - 1;
           affine_transformation[0] =
               transformation_[0] - j_max * affine_transformation[2];
           affine_transformation[3] =
@@ -261,6 +346,75 @@ namespace ryujin
         inverse_affine_transformation[4] = inv * (-affine_transformation[4]);
         inverse_affine_transformation[5] = inv * affine_transformation[1];
 
+        /*
+         * Determine the (padded) window in image space that covers the
+         * region of interest. Otherwise, read in the entire image:
+         */
+
+        raster_offset = {0, 0};
+        raster_size = image_size;
+
+        if (have_window_) {
+          double i_min = std::numeric_limits<double>::max();
+          double i_max = std::numeric_limits<double>::lowest();
+          double j_min = std::numeric_limits<double>::max();
+          double j_max = std::numeric_limits<double>::lowest();
+          for (const double x : {window_[0], window_[1]})
+            for (const double y : {window_[2], window_[3]}) {
+              const auto &[di, dj] = apply_inverse_transformation(x, y);
+              i_min = std::min(i_min, di);
+              i_max = std::max(i_max, di);
+              j_min = std::min(j_min, dj);
+              j_max = std::max(j_max, dj);
+            }
+
+          const int padding = 2 * downsampling_factor_;
+          const auto clamp = [](double value, int size) {
+            return std::clamp(static_cast<int>(value), 0, size - 1);
+          };
+          const int i_left = clamp(std::floor(i_min) - padding, image_size[0]);
+          const int i_right = clamp(std::ceil(i_max) + padding, image_size[0]);
+          const int j_left = clamp(std::floor(j_min) - padding, image_size[1]);
+          const int j_right = clamp(std::ceil(j_max) + padding, image_size[1]);
+
+          raster_offset = {i_left, j_left};
+          raster_size = {i_right - i_left + 1, j_right - j_left + 1};
+        }
+
+        /*
+         * Read in the raster window. GDAL reads in all (internal) tiles
+         * overlapping with the window and - for a downsampling factor
+         * larger than one - averages into the smaller target buffer, using
+         * overviews if present:
+         */
+
+        const int factor = downsampling_factor_;
+        buffer_size = {(raster_size[0] + factor - 1) / factor,
+                       (raster_size[1] + factor - 1) / factor};
+
+        GDALRasterIOExtraArg extra_arguments;
+        INIT_RASTERIO_EXTRA_ARG(extra_arguments);
+        extra_arguments.eResampleAlg = GRIORA_Average;
+
+        raster.resize(std::size_t(buffer_size[0]) * buffer_size[1]);
+        const auto error_code = raster_band->RasterIO(
+            GF_Read,
+            raster_offset[0], /* x-offset of image region */
+            raster_offset[1], /* y-offset of image region */
+            raster_size[0],   /* x-size of image region */
+            raster_size[1],   /* y-size of image region */
+            raster.data(),
+            buffer_size[0], /* x-size of target buffer */
+            buffer_size[1], /* y-size of target buffer */
+            GDT_Float32,
+            0,
+            0,
+            &extra_arguments);
+
+        AssertThrow(error_code == 0,
+                    dealii::ExcMessage(
+                        "GDAL driver error: error reading in geotiff file"));
+
         GDALClose(dataset_handle);
 
 #ifdef DEBUG_OUTPUT
@@ -279,6 +433,9 @@ namespace ryujin
         std::cout << "\nGDAL: raster size    =";
         for (const auto &it : raster_size)
           std::cout << " " << it;
+        std::cout << "\nGDAL: buffer size    =";
+        for (const auto &it : buffer_size)
+          std::cout << " " << it;
         std::cout << std::endl;
 #endif
 
@@ -327,33 +484,38 @@ namespace ryujin
         const auto &[di, dj] = apply_inverse_transformation(x, y);
 
         /*
-         * Use a simple bilinear interpolation:
+         * Translate into (downsampled) buffer coordinates and use a simple
+         * bilinear interpolation:
          */
 
-        const auto i_left = static_cast<unsigned int>(std::floor(di));
-        const auto i_right = static_cast<unsigned int>(std::ceil(di));
-        const auto j_left = static_cast<unsigned int>(std::floor(dj));
-        const auto j_right = static_cast<unsigned int>(std::ceil(dj));
+        const double factor = downsampling_factor_;
+        const double bi = (di - raster_offset[0]) / factor;
+        const double bj = (dj - raster_offset[1]) / factor;
 
-        const bool in_bounds =
-            i_left <= i_right &&
-            i_right < static_cast<unsigned int>(raster_size[0]) &&
-            j_left <= j_right &&
-            j_right < static_cast<unsigned int>(raster_size[1]);
+        const bool in_bounds = bi >= 0. && bj >= 0. &&
+                               std::ceil(bi) < buffer_size[0] &&
+                               std::ceil(bj) < buffer_size[1];
 
         AssertThrow(
             in_bounds,
             dealii::ExcMessage("Raster error: The requested point is outside "
-                               "the image boundary of the geotiff file"));
+                               "the image boundary of the geotiff file (or "
+                               "the raster window of the current rank)"));
+
+        const auto i_left = static_cast<unsigned int>(std::floor(bi));
+        const auto i_right = static_cast<unsigned int>(std::ceil(bi));
+        const auto j_left = static_cast<unsigned int>(std::floor(bj));
+        const auto j_right = static_cast<unsigned int>(std::ceil(bj));
 
-        const double i_ratio = std::fmod(di, 1.);
-        const double j_ratio = std::fmod(dj, 1.);
+        const double i_ratio = std::fmod(bi, 1.);
+        const double j_ratio = std::fmod(bj, 1.);
 
-        const auto v_iljl = raster[i_left + j_left * raster_size[0]];
-        const auto v_irjl = raster[i_right + j_left * raster_size[0]];
+        const std::size_t stride = buffer_size[0];
+        const auto v_iljl = raster[i_left + j_left * stride];
+        const auto v_irjl = raster[i_right + j_left * stride];
 
-        const auto v_iljr = raster[i_left + j_right * raster_size[0]];
-        const auto v_irjr = raster[i_right + j_right * raster_size[0]];
+        const auto v_iljr = raster[i_left + j_right * stride];
+        const auto v_irjr = raster[i_right + j_right * stride];
 
         const auto v_jl = v_iljl * (1. - i_ratio) + v_irjl * i_ratio;
         const auto v_jr = v_iljr * (1. - i_ratio) + v_irjr * i_ratio;
@@ -370,6 +532,10 @@ namespace ryujin
       bool transformation_use_geotiff_;
       bool transformation_use_geotiff_origin_;
 
+      bool windowed_read_;
+      unsigned int downsampling_factor_;
+      bool build_overviews_;
+
       std::string height_expression_;
       std::string velocity_expression_;
 
@@ -384,10 +550,16 @@ namespace ryujin
       mutable std::string driver_projection;
       mutable std::array<double, 6> affine_transformation;
       mutable std::array<double, 6> inverse_affine_transformation;
+      mutable std::array<int, 2> image_size;
       mutable std::array<int, 2> raster_offset;
       mutable std::array<int, 2> raster_size;
+      mutable std::array<int, 2> buffer_size;
       mutable std::vector<float> raster;
 
+      /* Region of interest (x_min, x_max, y_min, y_max): */
+      std::array<double, 4> window_;
+      bool have_window_;
+
       /* Fields for muparser support for water height and velocity: */
 
       std::unique_ptr<dealii::FunctionParser<dim>> height_function_;
@@ -39,6 +39,11 @@ namespace ryujin
                             "Depth of water in reservoir behind dam");
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number /*t*/) final
       {
         if constexpr (dim == 1) {
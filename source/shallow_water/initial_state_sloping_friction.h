@@ -50,6 +50,11 @@ namespace ryujin
                             "The initial (unit) discharge in [m^2 / s]");
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> & /*point*/,
                          Number /*t*/) final
       {
@@ -63,6 +63,11 @@ namespace ryujin
             dealii::ExcMessage("Case must be 'G1', 'G2', 'G3' or 'none'"));
       }
 
+      bool is_time_independent() const final
+      {
+        return true;
+      }
+
       state_type compute(const dealii::Point<dim> &point, Number /* t */) final
       {
         const auto view = hyperbolic_system_.template view<dim, Number>();
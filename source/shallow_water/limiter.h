@@ -122,7 +122,7 @@ namespace ryujin
        *     // ...
        *     limiter.accumulate(js, U_j, flux_j, scaled_c_ij, affine_shift);
        *   }
-       *   limiter.bounds(hd_i);
+       *   limiter.bounds(hd_i, hd_i_power);
        * }
        * ```
        */
@@ -168,9 +168,11 @@ namespace ryujin
                       const state_type &affine_shift);
 
       /**
-       * Return the computed bounds (with relaxation applied).
+       * Return the computed bounds (with relaxation applied). Here, hd_i
+       * is the relative lumped mass m_i / |Omega| and hd_i_power the
+       * precomputed power (m_i / |Omega|) ^ (1.5 / d).
        */
-      Bounds bounds(const Number hd_i) const;
+      Bounds bounds(const Number hd_i, const Number hd_i_power) const;
 
       /**
        * Given two bounds bounds_left, bounds_right, this function computes
@@ -331,7 +333,8 @@ namespace ryujin
 
     template <int dim, typename Number>
     DEAL_II_ALWAYS_INLINE inline auto
-    Limiter<dim, Number>::bounds(const Number hd_i) const -> Bounds
+    Limiter<dim, Number>::bounds(const Number hd_i,
+                                 const Number hd_i_power) const -> Bounds
     {
       const auto view = hyperbolic_system.view<dim, Number>();
 
@@ -340,12 +343,7 @@ namespace ryujin
 
       /* Use r_i = factor * (m_i / |Omega|) ^ (1.5 / d): */
 
-      Number r_i = std::sqrt(hd_i);                              // in 3D: ^ 3/6
-      if constexpr (dim == 2)                                    //
-        r_i = dealii::Utilities::fixed_power<3>(std::sqrt(r_i)); // in 2D: ^ 3/4
-      else if constexpr (dim == 1)                               //
-        r_i = dealii::Utilities::fixed_power<3>(r_i);            // in 1D: ^ 3/2
-      r_i *= parameters.relaxation_factor();
+      const Number r_i = parameters.relaxation_factor() * hd_i_power;
 
       constexpr ScalarNumber eps = std::numeric_limits<ScalarNumber>::epsilon();
 
@@ -370,12 +368,12 @@ namespace ryujin
 
       /* Use r_i = 0.2 * (m_i / |Omega|) ^ (1 / d): */
 
-      r_i = hd_i;
+      Number r_small = hd_i;
       if constexpr (dim == 2)
-        r_i = std::sqrt(hd_i);
-      r_i *= view.dry_state_relaxation_factor();
+        r_small = std::sqrt(hd_i);
+      r_small *= view.dry_state_relaxation_factor();
 
-      h_small = view.reference_water_depth() * r_i;
+      h_small = view.reference_water_depth() * r_small;
 
       return relaxed_bounds;
     }
@@ -19,8 +19,18 @@ namespace ryujin
     template class RiemannSolver<2, NUMBER>;
     template class RiemannSolver<3, NUMBER>;
 
-    template class RiemannSolver<1, dealii::VectorizedArray<NUMBER>>;
-    template class RiemannSolver<2, dealii::VectorizedArray<NUMBER>>;
-    template class RiemannSolver<3, dealii::VectorizedArray<NUMBER>>;
+    template class RiemannSolver<1, VectorizedArray<NUMBER>>;
+    template class RiemannSolver<2, VectorizedArray<NUMBER>>;
+    template class RiemannSolver<3, VectorizedArray<NUMBER>>;
+
+#ifdef RUNTIME_PRECISION
+    template class RiemannSolver<1, ALTERNATIVE_NUMBER>;
+    template class RiemannSolver<2, ALTERNATIVE_NUMBER>;
+    template class RiemannSolver<3, ALTERNATIVE_NUMBER>;
+
+    template class RiemannSolver<1, VectorizedArray<ALTERNATIVE_NUMBER>>;
+    template class RiemannSolver<2, VectorizedArray<ALTERNATIVE_NUMBER>>;
+    template class RiemannSolver<3, VectorizedArray<ALTERNATIVE_NUMBER>>;
+#endif
   } // namespace ShallowWater
 } // namespace ryujin
@@ -7,6 +7,37 @@
 
 namespace ryujin
 {
+#if SVE_VECTOR_BITS > 128
+  /* Fixed-length SVE, the width is given by the SVE_VECTOR_BITS option: */
+
+  template VectorizedArray<double>
+  pow(const VectorizedArray<double>, const double);
+
+  template VectorizedArray<double>
+  pow(const VectorizedArray<double>, const VectorizedArray<double>);
+
+  template VectorizedArray<float> pow(const VectorizedArray<float>, const float);
+
+  template VectorizedArray<float>
+  pow(const VectorizedArray<float>, const VectorizedArray<float>);
+
+  template VectorizedArray<double>
+  fast_pow(const VectorizedArray<double>, const double, const Bias);
+
+  template VectorizedArray<double>
+  fast_pow(const VectorizedArray<double>,
+           const VectorizedArray<double>,
+           const Bias);
+
+  template VectorizedArray<float>
+  fast_pow(const VectorizedArray<float>, const float, const Bias);
+
+  template VectorizedArray<float>
+  fast_pow(const VectorizedArray<float>,
+           const VectorizedArray<float>,
+           const Bias);
+#endif
+
 #if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 3
   template dealii::VectorizedArray<double, 8>
   pow(const dealii::VectorizedArray<double, 8>, const double);
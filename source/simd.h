@@ -7,10 +7,14 @@
 
 #include <compile_time_options.h>
 
+#include "simd_sve.h"
+
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/utilities.h>
 #include <deal.II/base/vectorization.h>
 
+#include <type_traits>
+
 namespace ryujin
 {
   /**
@@ -18,6 +22,34 @@ namespace ryujin
    */
   //@{
 
+  /**
+   * The SIMD width used for the principal floating point types. This is
+   * the width of dealii::VectorizedArray<Number> unless ryujin is
+   * configured with fixed-length SVE vectors of more than 128 bits
+   * (SVE_VECTOR_BITS), in which case one SVE register is used.
+   *
+   * @ingroup SIMD
+   */
+  template <typename Number>
+  constexpr std::size_t simd_width =
+#if SVE_VECTOR_BITS > 128
+      std::is_floating_point_v<Number>
+          ? std::size_t(SVE_VECTOR_BITS / (8 * sizeof(Number)))
+          :
+#endif
+          dealii::VectorizedArray<Number>::size();
+
+
+  /**
+   * The VectorizedArray type of width simd_width<Number>. All kernels
+   * and SIMD data structures of ryujin use this type (unqualified, as
+   * VectorizedArray<Number>) instead of the deal.II default.
+   *
+   * @ingroup SIMD
+   */
+  template <typename Number>
+  using VectorizedArray = dealii::VectorizedArray<Number, simd_width<Number>>;
+
 
   /**
    * Small helper class to extract the underlying scalar type of a
@@ -183,13 +215,13 @@ namespace ryujin
 
     /**
      * Guarantee an upper bound, i.e., fast_pow(x,b) >= pow(x,b) provided
-     * that FIXME
+     * that x > 0 and that the result neither overflows nor underflows.
      */
     max,
 
     /**
-     * Guarantee a lower bound, i.e., fast_pow(x,b) >= pow(x,b) provided
-     * that FIXME
+     * Guarantee a lower bound, i.e., fast_pow(x,b) <= pow(x,b) provided
+     * that x > 0 and that the result neither overflows nor underflows.
      */
     min
   };
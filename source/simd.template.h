@@ -323,29 +323,28 @@ namespace ryujin
 
   template <>
   // DEAL_II_ALWAYS_INLINE inline
-  float fast_pow(const float x, const float b, const Bias)
+  float fast_pow(const float x, const float b, const Bias bias)
   {
-    // Call generic std::pow() implementation
-    return std::pow(x, b);
+    /* Use the portable fast_pow kernel: */
+    return fast_pow_impl(x, b, bias);
   }
 
 
   template <>
   // DEAL_II_ALWAYS_INLINE inline
-  double fast_pow(const double x, const double b, const Bias)
+  double fast_pow(const double x, const double b, const Bias bias)
   {
-    // Call generic std::pow() implementation
-    return std::pow(static_cast<float>(x), static_cast<float>(b));
+    /* Use the portable fast_pow kernel: */
+    return fast_pow_impl(x, b, bias);
   }
 
 
   template <typename T, std::size_t width>
   // DEAL_II_ALWAYS_INLINE inline
-  dealii::VectorizedArray<T, width>
-  fast_pow(const dealii::VectorizedArray<T, width> x, const T b, const Bias)
+  dealii::VectorizedArray<T, width> fast_pow(
+      const dealii::VectorizedArray<T, width> x, const T b, const Bias bias)
   {
-    // Call generic deal.II implementation
-    return std::pow(x, b);
+    return fast_pow_impl(x, dealii::VectorizedArray<T, width>(b), bias);
   }
 
 
@@ -354,10 +353,9 @@ namespace ryujin
   dealii::VectorizedArray<T, width>
   fast_pow(const dealii::VectorizedArray<T, width> x,
            const dealii::VectorizedArray<T, width> b,
-           const Bias)
+           const Bias bias)
   {
-    // Call generic deal.II implementation
-    return std::pow(x, b);
+    return fast_pow_impl(x, b, bias);
   }
 #endif
 
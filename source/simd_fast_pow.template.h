@@ -8,7 +8,11 @@
 
 #include "simd.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 
 #if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 1 && defined(__SSE2__)
 #define VCL_NAMESPACE vcl
@@ -21,10 +25,205 @@ DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #else
 namespace ryujin
 {
+  /*
+   * Portable fast_log(), fast_exp() and fast_pow() kernels used on
+   * platforms without SSE2, for example for ARM NEON or SVE. All
+   * transcendental functions are reduced to log2 and exp2. The exponent
+   * of floating point numbers is extracted and inserted through integer
+   * bit manipulation such that, after inlining, loops over all lanes of
+   * a dealii::VectorizedArray consist of elementary arithmetic and can
+   * be vectorized by the compiler.
+   *
+   * In double precision fast_pow(x, b) reaches a relative accuracy of
+   * about 1.0e-9 * (1 + |b|) for normal numbers. The kernels assume
+   * x > 0 for fast_log and x >= 0 for fast_pow.
+   */
+
+  namespace
+  {
+    template <typename T>
+    struct FastPowTraits {
+    };
+
+    template <>
+    struct FastPowTraits<float> {
+      using integer_type = std::uint32_t;
+      static constexpr int mantissa_bits = 23;
+      static constexpr int exponent_bias = 127;
+
+      /*
+       * An estimate of the relative error of fast_pow(x, b) = 2^y, with
+       * y = b log2(x), including a safety margin. We account for the
+       * roundoff in computing y in single precision.
+       */
+      static DEAL_II_ALWAYS_INLINE inline float relative_error(const float b,
+                                                               const float y)
+      {
+        return 1.0e-6f * (1.f + std::abs(y)) + 1.0e-9f * std::abs(b);
+      }
+    };
+
+    template <>
+    struct FastPowTraits<double> {
+      using integer_type = std::uint64_t;
+      static constexpr int mantissa_bits = 52;
+      static constexpr int exponent_bias = 1023;
+
+      static DEAL_II_ALWAYS_INLINE inline double relative_error(const double b,
+                                                                const double)
+      {
+        return 1.0e-8 + 1.0e-9 * std::abs(b);
+      }
+    };
+
+
+    template <typename T>
+    DEAL_II_ALWAYS_INLINE inline T fast_log2_lane(const T x)
+    {
+      using Traits = FastPowTraits<T>;
+      using I = typename Traits::integer_type;
+      constexpr I mantissa_mask = (I(1) << Traits::mantissa_bits) - 1;
+
+      /* Split x = m * 2^exponent with m in [1, 2): */
+      I bits;
+      std::memcpy(&bits, &x, sizeof(T));
+      int exponent =
+          int(bits >> Traits::mantissa_bits) - Traits::exponent_bias;
+      bits = (bits & mantissa_mask) |
+             (I(Traits::exponent_bias) << Traits::mantissa_bits);
+      T m;
+      std::memcpy(&m, &bits, sizeof(T));
+
+      /* Shift m into [sqrt(1/2), sqrt(2)): */
+      const bool shift = m > T(1.4142135623730951);
+      m = shift ? T(0.5) * m : m;
+      exponent += shift ? 1 : 0;
+
+      /* log(m) = 2 atanh(t) with t = (m - 1) / (m + 1), |t| < 0.1716: */
+      const T t = (m - T(1.)) / (m + T(1.));
+      const T t2 = t * t;
+      const T series =
+          T(2.) * t *
+          (T(1.) +
+           t2 * (T(1. / 3.) +
+                 t2 * (T(1. / 5.) + t2 * (T(1. / 7.) + t2 * T(1. / 9.)))));
+
+      return T(exponent) + series * T(1.4426950408889634);
+    }
+
+
+    template <typename T>
+    DEAL_II_ALWAYS_INLINE inline T fast_exp2_lane(const T y)
+    {
+      using Traits = FastPowTraits<T>;
+      using I = typename Traits::integer_type;
+      constexpr T min_exponent = T(1 - Traits::exponent_bias);
+      constexpr T max_exponent = T(Traits::exponent_bias);
+
+      /* Split y = n + f with integer n and |f| <= 1/2: */
+      const T y_clamped = std::min(std::max(y, min_exponent), max_exponent);
+      const T n = std::floor(y_clamped + T(0.5));
+      const T f = (y_clamped - n) * T(0.6931471805599453);
+
+      /* Taylor expansion of exp(f) for |f| <= log(2) / 2: */
+      const T q = T(1. / 24.) +
+                  f * (T(1. / 120.) +
+                       f * (T(1. / 720.) +
+                            f * (T(1. / 5040.) + f * T(1. / 40320.))));
+      const T p =
+          T(1.) + f * (T(1.) + f * (T(1. / 2.) + f * (T(1. / 6.) + f * q)));
+
+      /* Construct 2^n by inserting the biased exponent: */
+      const I bits = I(static_cast<std::int64_t>(n) + Traits::exponent_bias)
+                     << Traits::mantissa_bits;
+      T scale;
+      std::memcpy(&scale, &bits, sizeof(T));
+
+      T result = p * scale;
+      result = y < min_exponent ? T(0.) : result;
+      result = y > max_exponent ? std::numeric_limits<T>::infinity() : result;
+      return result;
+    }
+
+
+    template <typename T>
+    DEAL_II_ALWAYS_INLINE inline T
+    fast_pow_lane(const T x, const T b, const Bias bias)
+    {
+      const T y = b * fast_log2_lane(x);
+      T z = fast_exp2_lane(y);
+
+      /* We have pow(0, b) = 0 for b > 0: */
+      z = x == T(0.) ? T(0.) : z;
+
+      /*
+       * Round outwards by the estimated relative error to guarantee an
+       * upper (or lower) bound on the exact result:
+       */
+      if (bias != Bias::none) {
+        const T delta = FastPowTraits<T>::relative_error(b, y);
+        z *= (bias == Bias::max ? T(1.) + delta : T(1.) - delta);
+      }
+
+      return z;
+    }
+  } // namespace
+
+
   template <typename T>
-  T fast_pow_impl(const T x, const T b, const Bias)
+  DEAL_II_ALWAYS_INLINE inline T fast_log_impl(const T x)
   {
-    return std::pow(x, b);
+    return fast_log2_lane(x) * T(0.6931471805599453);
+  }
+
+
+  template <typename T, std::size_t width>
+  DEAL_II_ALWAYS_INLINE inline dealii::VectorizedArray<T, width>
+  fast_log_impl(const dealii::VectorizedArray<T, width> x)
+  {
+    dealii::VectorizedArray<T, width> result;
+    for (unsigned int k = 0; k < width; ++k)
+      result[k] = fast_log_impl(x[k]);
+    return result;
+  }
+
+
+  template <typename T>
+  DEAL_II_ALWAYS_INLINE inline T fast_exp_impl(const T x)
+  {
+    return fast_exp2_lane(x * T(1.4426950408889634));
+  }
+
+
+  template <typename T, std::size_t width>
+  DEAL_II_ALWAYS_INLINE inline dealii::VectorizedArray<T, width>
+  fast_exp_impl(const dealii::VectorizedArray<T, width> x)
+  {
+    dealii::VectorizedArray<T, width> result;
+    for (unsigned int k = 0; k < width; ++k)
+      result[k] = fast_exp_impl(x[k]);
+    return result;
+  }
+
+
+  template <typename T>
+  DEAL_II_ALWAYS_INLINE inline T
+  fast_pow_impl(const T x, const T b, const Bias bias)
+  {
+    return fast_pow_lane(x, b, bias);
+  }
+
+
+  template <typename T, std::size_t width>
+  DEAL_II_ALWAYS_INLINE inline dealii::VectorizedArray<T, width>
+  fast_pow_impl(const dealii::VectorizedArray<T, width> x,
+                const dealii::VectorizedArray<T, width> b,
+                const Bias bias)
+  {
+    dealii::VectorizedArray<T, width> result;
+    for (unsigned int k = 0; k < width; ++k)
+      result[k] = fast_pow_lane(x[k], b[k], bias);
+    return result;
   }
 } // namespace ryujin
 #endif
@@ -36,7 +235,7 @@ namespace ryujin
   template <typename VTYPE>
   inline DEAL_II_ALWAYS_INLINE VTYPE fast_pow_impl(VTYPE const x0,
                                                    VTYPE const y,
-                                                   Bias)
+                                                   Bias bias)
   {
     /* clang-format off */
     using namespace vcl;
@@ -157,6 +356,18 @@ namespace ryujin
     xzero = is_zero_or_subnormal(x0);
     z = wm_pow_case_x0(xzero, y, z);
 
+    /*
+     * Round outwards to guarantee an upper (or lower) bound on the exact
+     * result. The kernel is accurate to a few ulp (in single precision)
+     * times the magnitude of the exponent ee of the result. In addition,
+     * double precision arguments x have been rounded to single
+     * precision, which amplifies by the exponent y:
+     */
+    if (bias != Bias::none) {
+      const VTYPE delta = 1.0e-6f * (2.f + abs(ee)) + 1.2e-7f * abs(y);
+      z = bias == Bias::max ? z * (1.f + delta) : z * (1.f - delta);
+    }
+
     return z;
 
     /* clang-format on */
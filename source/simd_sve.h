@@ -0,0 +1,389 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include <deal.II/base/vectorization.h>
+
+#if SVE_VECTOR_BITS > 0
+#if !defined(__ARM_FEATURE_SVE) || !defined(__ARM_FEATURE_SVE_BITS) ||        \
+    __ARM_FEATURE_SVE_BITS != SVE_VECTOR_BITS
+#error "SVE_VECTOR_BITS must match the -msve-vector-bits compiler flag"
+#endif
+#endif
+
+/*
+ * deal.II vectorizes ARM platforms with 128 bit NEON. For fixed-length SVE
+ * with 256 bit or more we provide our own specializations:
+ */
+#if SVE_VECTOR_BITS > 128
+
+#include <arm_sve.h>
+
+namespace ryujin
+{
+  namespace sve
+  {
+    /**
+     * Fixed-length SVE register types. Contrary to the sizeless svfloat64_t
+     * and svfloat32_t these types can be stored as class members.
+     *
+     * @ingroup SIMD
+     */
+    //@{
+    typedef svfloat64_t float64_vector_type
+        __attribute__((arm_sve_vector_bits(SVE_VECTOR_BITS)));
+
+    typedef svfloat32_t float32_vector_type
+        __attribute__((arm_sve_vector_bits(SVE_VECTOR_BITS)));
+    //@}
+
+    /**
+     * Number of double and float lanes of a fixed-length SVE register.
+     *
+     * @ingroup SIMD
+     */
+    //@{
+    constexpr std::size_t double_width = SVE_VECTOR_BITS / 64;
+    constexpr std::size_t float_width = SVE_VECTOR_BITS / 32;
+    //@}
+  } // namespace sve
+} // namespace ryujin
+
+
+namespace dealii
+{
+  /**
+   * Specialization of VectorizedArray for double and fixed-length SVE
+   * registers of SVE_VECTOR_BITS bits. Because the register width is
+   * fixed at compile time all operations use an all-true predicate.
+   *
+   * @ingroup SIMD
+   */
+  template <>
+  class VectorizedArray<double, ryujin::sve::double_width>
+      : public VectorizedArrayBase<
+            VectorizedArray<double, ryujin::sve::double_width>,
+            ryujin::sve::double_width>
+  {
+  public:
+    using value_type = double;
+
+    static constexpr std::size_t width = ryujin::sve::double_width;
+
+    VectorizedArray() = default;
+
+    VectorizedArray(const double scalar)
+    {
+      this->operator=(scalar);
+    }
+
+    VectorizedArray(const std::initializer_list<double> &list)
+        : VectorizedArrayBase<VectorizedArray<double, width>, width>(list)
+    {
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator=(const double x) &
+    {
+      data = svdup_n_f64(x);
+      return *this;
+    }
+
+    VectorizedArray &operator=(const double scalar) && = delete;
+
+    DEAL_II_ALWAYS_INLINE
+    double &operator[](const unsigned int comp)
+    {
+      AssertIndexRange(comp, width);
+      return *(reinterpret_cast<double *>(&data) + comp);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    const double &operator[](const unsigned int comp) const
+    {
+      AssertIndexRange(comp, width);
+      return *(reinterpret_cast<const double *>(&data) + comp);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator+=(const VectorizedArray &vec)
+    {
+      data = svadd_f64_x(svptrue_b64(), data, vec.data);
+      return *this;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator-=(const VectorizedArray &vec)
+    {
+      data = svsub_f64_x(svptrue_b64(), data, vec.data);
+      return *this;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator*=(const VectorizedArray &vec)
+    {
+      data = svmul_f64_x(svptrue_b64(), data, vec.data);
+      return *this;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator/=(const VectorizedArray &vec)
+    {
+      data = svdiv_f64_x(svptrue_b64(), data, vec.data);
+      return *this;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void load(const double *ptr)
+    {
+      data = svld1_f64(svptrue_b64(), ptr);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void load(const double *base_ptr, const unsigned int *offsets)
+    {
+      gather(base_ptr, offsets);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void store(double *ptr) const
+    {
+      svst1_f64(svptrue_b64(), ptr, data);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void store(double *base_ptr, const unsigned int *offsets) const
+    {
+      scatter(offsets, base_ptr);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void streaming_store(double *ptr) const
+    {
+      svstnt1_f64(svptrue_b64(), ptr, data);
+    }
+
+    /*
+     * The 32 bit offsets are zero extended to 64 bit lanes while loading
+     * them, so that a single gather instruction suffices.
+     */
+    DEAL_II_ALWAYS_INLINE
+    void gather(const double *base_ptr, const unsigned int *offsets)
+    {
+      const auto predicate = svptrue_b64();
+      const auto indices = svld1uw_u64(predicate, offsets);
+      data = svld1_gather_u64index_f64(predicate, base_ptr, indices);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void scatter(const unsigned int *offsets, double *base_ptr) const
+    {
+      const auto predicate = svptrue_b64();
+      const auto indices = svld1uw_u64(predicate, offsets);
+      svst1_scatter_u64index_f64(predicate, base_ptr, indices, data);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray get_sqrt() const
+    {
+      VectorizedArray res;
+      res.data = svsqrt_f64_x(svptrue_b64(), data);
+      return res;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray get_abs() const
+    {
+      VectorizedArray res;
+      res.data = svabs_f64_x(svptrue_b64(), data);
+      return res;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray get_max(const VectorizedArray &other) const
+    {
+      VectorizedArray res;
+      res.data = svmax_f64_x(svptrue_b64(), data, other.data);
+      return res;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray get_min(const VectorizedArray &other) const
+    {
+      VectorizedArray res;
+      res.data = svmin_f64_x(svptrue_b64(), data, other.data);
+      return res;
+    }
+
+    ryujin::sve::float64_vector_type data;
+  };
+
+
+  /**
+   * Specialization of VectorizedArray for float and fixed-length SVE
+   * registers of SVE_VECTOR_BITS bits.
+   *
+   * @ingroup SIMD
+   */
+  template <>
+  class VectorizedArray<float, ryujin::sve::float_width>
+      : public VectorizedArrayBase<
+            VectorizedArray<float, ryujin::sve::float_width>,
+            ryujin::sve::float_width>
+  {
+  public:
+    using value_type = float;
+
+    static constexpr std::size_t width = ryujin::sve::float_width;
+
+    VectorizedArray() = default;
+
+    VectorizedArray(const float scalar)
+    {
+      this->operator=(scalar);
+    }
+
+    VectorizedArray(const std::initializer_list<float> &list)
+        : VectorizedArrayBase<VectorizedArray<float, width>, width>(list)
+    {
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator=(const float x) &
+    {
+      data = svdup_n_f32(x);
+      return *this;
+    }
+
+    VectorizedArray &operator=(const float scalar) && = delete;
+
+    DEAL_II_ALWAYS_INLINE
+    float &operator[](const unsigned int comp)
+    {
+      AssertIndexRange(comp, width);
+      return *(reinterpret_cast<float *>(&data) + comp);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    const float &operator[](const unsigned int comp) const
+    {
+      AssertIndexRange(comp, width);
+      return *(reinterpret_cast<const float *>(&data) + comp);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator+=(const VectorizedArray &vec)
+    {
+      data = svadd_f32_x(svptrue_b32(), data, vec.data);
+      return *this;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator-=(const VectorizedArray &vec)
+    {
+      data = svsub_f32_x(svptrue_b32(), data, vec.data);
+      return *this;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator*=(const VectorizedArray &vec)
+    {
+      data = svmul_f32_x(svptrue_b32(), data, vec.data);
+      return *this;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray &operator/=(const VectorizedArray &vec)
+    {
+      data = svdiv_f32_x(svptrue_b32(), data, vec.data);
+      return *this;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void load(const float *ptr)
+    {
+      data = svld1_f32(svptrue_b32(), ptr);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void load(const float *base_ptr, const unsigned int *offsets)
+    {
+      gather(base_ptr, offsets);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void store(float *ptr) const
+    {
+      svst1_f32(svptrue_b32(), ptr, data);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void store(float *base_ptr, const unsigned int *offsets) const
+    {
+      scatter(offsets, base_ptr);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void streaming_store(float *ptr) const
+    {
+      svstnt1_f32(svptrue_b32(), ptr, data);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void gather(const float *base_ptr, const unsigned int *offsets)
+    {
+      const auto predicate = svptrue_b32();
+      const auto indices = svld1_u32(predicate, offsets);
+      data = svld1_gather_u32index_f32(predicate, base_ptr, indices);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    void scatter(const unsigned int *offsets, float *base_ptr) const
+    {
+      const auto predicate = svptrue_b32();
+      const auto indices = svld1_u32(predicate, offsets);
+      svst1_scatter_u32index_f32(predicate, base_ptr, indices, data);
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray get_sqrt() const
+    {
+      VectorizedArray res;
+      res.data = svsqrt_f32_x(svptrue_b32(), data);
+      return res;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray get_abs() const
+    {
+      VectorizedArray res;
+      res.data = svabs_f32_x(svptrue_b32(), data);
+      return res;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray get_max(const VectorizedArray &other) const
+    {
+      VectorizedArray res;
+      res.data = svmax_f32_x(svptrue_b32(), data, other.data);
+      return res;
+    }
+
+    DEAL_II_ALWAYS_INLINE
+    VectorizedArray get_min(const VectorizedArray &other) const
+    {
+      VectorizedArray res;
+      res.data = svmin_f32_x(svptrue_b32(), data, other.data);
+      return res;
+    }
+
+    ryujin::sve::float32_vector_type data;
+  };
+} // namespace dealii
+
+#endif
@@ -0,0 +1,271 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include "simd.h"
+
+#include <deal.II/base/vectorization.h>
+
+#include <algorithm>
+
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 2 && defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace ryujin
+{
+  /**
+   * @name In-register transposition of small multi-component tensors
+   */
+  //@{
+
+  /**
+   * Load the @p n_comp consecutive values starting at base + offsets[k]
+   * for all lanes k and transpose them, i.e., out[d][k] is set to
+   * base[offsets[k] + d]. This is the interleaved (array of structs) to
+   * SIMD (struct of arrays) conversion used by
+   * MultiComponentVector::get_tensor().
+   *
+   * The generic variant calls dealii::vectorized_load_and_transpose(). For
+   * double precision and AVX/AVX-512 the function is overloaded with a
+   * kernel that loads chunks of four components per lane (with masked
+   * loads for a partial last chunk, so that n_comp = 3 and n_comp = 5 do
+   * not fall back to scalar loads) and transposes them in registers. For
+   * SVE one hardware gather per component is used.
+   *
+   * @ingroup SIMD
+   */
+  template <unsigned int n_comp, typename Number, std::size_t width>
+  DEAL_II_ALWAYS_INLINE inline void
+  load_and_transpose(const Number *base,
+                     const unsigned int *offsets,
+                     dealii::VectorizedArray<Number, width> *out)
+  {
+#if SVE_VECTOR_BITS > 128
+    if constexpr (width == simd_width<Number>) {
+      for (unsigned int d = 0; d < n_comp; ++d)
+        out[d].gather(base + d, offsets);
+      return;
+    }
+#endif
+    dealii::vectorized_load_and_transpose(n_comp, base, offsets, out);
+  }
+
+
+  /**
+   * The inverse operation of load_and_transpose(): store (or add if
+   * @p add_into is true) in[d][k] to base[offsets[k] + d] for all
+   * components d < n_comp and lanes k. The offsets must be distinct and
+   * the memory regions of different lanes must not overlap.
+   *
+   * @ingroup SIMD
+   */
+  template <unsigned int n_comp,
+            bool add_into,
+            typename Number,
+            std::size_t width>
+  DEAL_II_ALWAYS_INLINE inline void
+  transpose_and_store(const dealii::VectorizedArray<Number, width> *in,
+                      const unsigned int *offsets,
+                      Number *base)
+  {
+#if SVE_VECTOR_BITS > 128
+    if constexpr (width == simd_width<Number>) {
+      for (unsigned int d = 0; d < n_comp; ++d) {
+        if constexpr (add_into) {
+          dealii::VectorizedArray<Number, width> temp;
+          temp.gather(base + d, offsets);
+          temp += in[d];
+          temp.scatter(offsets, base + d);
+        } else {
+          in[d].scatter(offsets, base + d);
+        }
+      }
+      return;
+    }
+#endif
+    dealii::vectorized_transpose_and_store(add_into, n_comp, in, offsets, base);
+  }
+
+
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 2 && defined(__AVX__)
+#ifndef DOXYGEN
+  namespace
+  {
+    /*
+     * Return a mask for _mm256_maskload_pd / _mm256_maskstore_pd that
+     * selects the first n_active (< 4) entries.
+     */
+    DEAL_II_ALWAYS_INLINE inline __m256i
+    partial_mask_pd(const unsigned int n_active)
+    {
+      return _mm256_set_epi64x(0,
+                               n_active > 2 ? -1 : 0,
+                               n_active > 1 ? -1 : 0,
+                               n_active > 0 ? -1 : 0);
+    }
+
+
+    /*
+     * Transpose the 4x4 matrix given by the rows u0, ..., u3 in place.
+     */
+    DEAL_II_ALWAYS_INLINE inline void
+    transpose_4x4_pd(__m256d &u0, __m256d &u1, __m256d &u2, __m256d &u3)
+    {
+      const __m256d t0 = _mm256_permute2f128_pd(u0, u2, 0x20);
+      const __m256d t1 = _mm256_permute2f128_pd(u1, u3, 0x20);
+      const __m256d t2 = _mm256_permute2f128_pd(u0, u2, 0x31);
+      const __m256d t3 = _mm256_permute2f128_pd(u1, u3, 0x31);
+      u0 = _mm256_unpacklo_pd(t0, t1);
+      u1 = _mm256_unpackhi_pd(t0, t1);
+      u2 = _mm256_unpacklo_pd(t2, t3);
+      u3 = _mm256_unpackhi_pd(t2, t3);
+    }
+
+
+    /*
+     * Load components [c, c + 4) of four lanes (masked if the chunk
+     * extends past n_comp) and transpose them.
+     */
+    template <unsigned int n_comp>
+    DEAL_II_ALWAYS_INLINE inline void load_transpose_chunk_pd(
+        const double *const *in, const unsigned int c, __m256d *u)
+    {
+      if (c + 4 <= n_comp) {
+        for (unsigned int k = 0; k < 4; ++k)
+          u[k] = _mm256_loadu_pd(in[k] + c);
+      } else {
+        const __m256i mask = partial_mask_pd(n_comp - c);
+        for (unsigned int k = 0; k < 4; ++k)
+          u[k] = _mm256_maskload_pd(in[k] + c, mask);
+      }
+      transpose_4x4_pd(u[0], u[1], u[2], u[3]);
+    }
+
+
+    /*
+     * Transpose the four component rows u (which are modified) and store
+     * (or add) components [c, c + 4) of four lanes.
+     */
+    template <unsigned int n_comp, bool add_into>
+    DEAL_II_ALWAYS_INLINE inline void store_transpose_chunk_pd(
+        __m256d *u, const unsigned int c, double *const *out)
+    {
+      transpose_4x4_pd(u[0], u[1], u[2], u[3]);
+      if (c + 4 <= n_comp) {
+        for (unsigned int k = 0; k < 4; ++k) {
+          if constexpr (add_into)
+            u[k] = _mm256_add_pd(u[k], _mm256_loadu_pd(out[k] + c));
+          _mm256_storeu_pd(out[k] + c, u[k]);
+        }
+      } else {
+        const __m256i mask = partial_mask_pd(n_comp - c);
+        for (unsigned int k = 0; k < 4; ++k) {
+          if constexpr (add_into)
+            u[k] = _mm256_add_pd(u[k], _mm256_maskload_pd(out[k] + c, mask));
+          _mm256_maskstore_pd(out[k] + c, mask, u[k]);
+        }
+      }
+    }
+  } // namespace
+#endif
+
+
+  template <unsigned int n_comp>
+  DEAL_II_ALWAYS_INLINE inline void
+  load_and_transpose(const double *base,
+                     const unsigned int *offsets,
+                     dealii::VectorizedArray<double, 4> *out)
+  {
+    const double *in[4] = {base + offsets[0],
+                           base + offsets[1],
+                           base + offsets[2],
+                           base + offsets[3]};
+
+    for (unsigned int c = 0; c < n_comp; c += 4) {
+      __m256d u[4];
+      load_transpose_chunk_pd<n_comp>(in, c, u);
+      for (unsigned int d = c; d < std::min(c + 4, n_comp); ++d)
+        out[d].data = u[d - c];
+    }
+  }
+
+
+  template <unsigned int n_comp, bool add_into>
+  DEAL_II_ALWAYS_INLINE inline void
+  transpose_and_store(const dealii::VectorizedArray<double, 4> *in,
+                      const unsigned int *offsets,
+                      double *base)
+  {
+    double *out[4] = {base + offsets[0],
+                      base + offsets[1],
+                      base + offsets[2],
+                      base + offsets[3]};
+
+    for (unsigned int c = 0; c < n_comp; c += 4) {
+      __m256d u[4];
+      for (unsigned int d = c; d < c + 4; ++d)
+        u[d - c] = d < n_comp ? in[d].data : _mm256_setzero_pd();
+      store_transpose_chunk_pd<n_comp, add_into>(u, c, out);
+    }
+  }
+#endif
+
+
+#if DEAL_II_COMPILER_VECTORIZATION_LEVEL >= 3 && defined(__AVX512F__)
+  /*
+   * For AVX-512 the lanes are processed in two groups of four with the
+   * AVX kernels from above, and the two halves are combined.
+   */
+
+  template <unsigned int n_comp>
+  DEAL_II_ALWAYS_INLINE inline void
+  load_and_transpose(const double *base,
+                     const unsigned int *offsets,
+                     dealii::VectorizedArray<double, 8> *out)
+  {
+    const double *in[8];
+    for (unsigned int k = 0; k < 8; ++k)
+      in[k] = base + offsets[k];
+
+    for (unsigned int c = 0; c < n_comp; c += 4) {
+      __m256d lo[4], hi[4];
+      load_transpose_chunk_pd<n_comp>(in, c, lo);
+      load_transpose_chunk_pd<n_comp>(in + 4, c, hi);
+      for (unsigned int d = c; d < std::min(c + 4, n_comp); ++d)
+        out[d].data = _mm512_insertf64x4(
+            _mm512_castpd256_pd512(lo[d - c]), hi[d - c], 1);
+    }
+  }
+
+
+  template <unsigned int n_comp, bool add_into>
+  DEAL_II_ALWAYS_INLINE inline void
+  transpose_and_store(const dealii::VectorizedArray<double, 8> *in,
+                      const unsigned int *offsets,
+                      double *base)
+  {
+    double *out[8];
+    for (unsigned int k = 0; k < 8; ++k)
+      out[k] = base + offsets[k];
+
+    for (unsigned int c = 0; c < n_comp; c += 4) {
+      __m256d lo[4], hi[4];
+      for (unsigned int d = c; d < c + 4; ++d) {
+        const __m512d temp = d < n_comp ? in[d].data : _mm512_setzero_pd();
+        lo[d - c] = _mm512_castpd512_pd256(temp);
+        hi[d - c] = _mm512_extractf64x4_pd(temp, 1);
+      }
+      store_transpose_chunk_pd<n_comp, add_into>(lo, c, out);
+      store_transpose_chunk_pd<n_comp, add_into>(hi, c, out + 4);
+    }
+  }
+#endif
+
+  //@}
+} // namespace ryujin
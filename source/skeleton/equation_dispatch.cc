@@ -13,5 +13,9 @@ namespace ryujin
   namespace Skeleton
   {
     Dispatch<Description, NUMBER> dispatch_instance("skeleton");
+#ifdef RUNTIME_PRECISION
+    Dispatch<Description, ALTERNATIVE_NUMBER>
+        alternative_dispatch_instance("skeleton");
+#endif
   } // namespace Skeleton
 } // namespace ryujin
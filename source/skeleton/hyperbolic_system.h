@@ -232,6 +232,10 @@ namespace ryujin
       /**
        * Precompute values for hyperbolic update. This routine is called
        * within our usual loop() idiom in HyperbolicModule
+       *
+       * @note The ghost exchange of the state vector is still in flight
+       * during cycle 0. Cycle 0 must thus only access the state U_i of
+       * the (locally owned) row i under consideration.
        */
       template <typename DISPATCH, typename SPARSITY>
       void precomputation_loop(unsigned int /*cycle*/,
@@ -350,6 +354,9 @@ namespace ryujin
       /** We do not have source terms */
       static constexpr bool have_source_terms = false;
 
+      /** We do not have source terms treated with an operator split */
+      static constexpr bool have_split_source_terms = false;
+
       state_type nodal_source(const PrecomputedVector & /*pv*/,
                               const unsigned int /*i*/,
                               const state_type & /*U_i*/,
@@ -75,7 +75,7 @@ namespace ryujin
        *     // ...
        *     limiter.accumulate(js, U_j, flux_j, scaled_c_ij, affine_shift);
        *   }
-       *   limiter.bounds(hd_i);
+       *   limiter.bounds(hd_i, hd_i_power);
        * }
        * ```
        */
@@ -127,9 +127,11 @@ namespace ryujin
       }
 
       /**
-       * Return the computed bounds (with relaxation applied).
+       * Return the computed bounds (with relaxation applied). Here, hd_i
+       * is the relative lumped mass m_i / |Omega| and hd_i_power the
+       * precomputed power (m_i / |Omega|) ^ (1.5 / d).
        */
-      Bounds bounds(const Number /*hd_i*/) const
+      Bounds bounds(const Number /*hd_i*/, const Number /*hd_i_power*/) const
       {
         auto relaxed_bounds = bounds_;
 
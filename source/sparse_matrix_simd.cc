@@ -11,9 +11,28 @@ namespace ryujin
 {
   /* instantiations */
 
-  template class SparsityPatternSIMD<dealii::VectorizedArray<NUMBER>::size()>;
+  template class SparsityPatternSIMD<VectorizedArray<NUMBER>::size()>;
 
   template class SparseMatrixSIMD<NUMBER, 1>;
   template class SparseMatrixSIMD<NUMBER, 2>;
   template class SparseMatrixSIMD<NUMBER, 3>;
+
+#ifdef SINGLE_PRECISION_OFFLINE_MATRICES
+  template class SparseMatrixSIMD<float, 1, VectorizedArray<NUMBER>::size()>;
+  template class SparseMatrixSIMD<float, 2, VectorizedArray<NUMBER>::size()>;
+  template class SparseMatrixSIMD<float, 3, VectorizedArray<NUMBER>::size()>;
+#endif
+
+#ifdef RUNTIME_PRECISION
+  /*
+   * Note: For a float ALTERNATIVE_NUMBER the single precision offline
+   * matrices use the float SIMD width and are covered below.
+   */
+  template class SparsityPatternSIMD<
+      VectorizedArray<ALTERNATIVE_NUMBER>::size()>;
+
+  template class SparseMatrixSIMD<ALTERNATIVE_NUMBER, 1>;
+  template class SparseMatrixSIMD<ALTERNATIVE_NUMBER, 2>;
+  template class SparseMatrixSIMD<ALTERNATIVE_NUMBER, 3>;
+#endif
 } /* namespace ryujin */
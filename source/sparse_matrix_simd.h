@@ -6,12 +6,18 @@
 #pragma once
 
 #include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 
 #include "openmp.h"
 #include "simd.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
 namespace ryujin
 {
   namespace
@@ -32,9 +38,37 @@ namespace ryujin
   } // namespace
 
 
+  /**
+   * The MPI communication backend used for exchanging ghost rows in
+   * SparseMatrixSIMD::update_ghost_rows_start() and
+   * SparseMatrixSIMD::update_ghost_rows_finish().
+   */
+  enum class GhostRowExchange {
+    /**
+     * Post fresh MPI_Irecv and MPI_Isend calls for every exchange.
+     */
+    point_to_point,
+
+    /**
+     * Create persistent requests (MPI_Recv_init and MPI_Send_init) once
+     * and only restart them (MPI_Startall) for subsequent exchanges. The
+     * requests are recreated if the communication channel or the matrix
+     * storage changes.
+     */
+    persistent,
+
+    /**
+     * Perform a single nonblocking neighborhood collective
+     * (MPI_Ineighbor_alltoallv) on a distributed graph communicator that
+     * is set up once per sparsity pattern.
+     */
+    neighborhood_collective,
+  };
+
+
   template <typename Number,
             int n_components = 1,
-            int simd_length = dealii::VectorizedArray<Number>::size()>
+            int simd_length = VectorizedArray<Number>::size()>
   class SparseMatrixSIMD;
 
   /**
@@ -99,12 +133,90 @@ namespace ryujin
 
     const unsigned int *columns(const unsigned int row) const;
 
+    /**
+     * Variant of above function for hot loops: If compressed column
+     * indices are enabled (see set_compressed_columns()) the function
+     * decodes the column indices of row @p row (of the whole group of
+     * simd_length rows containing @p row in the vectorized region) into
+     * @p buffer and returns a pointer into @p buffer with the same layout
+     * as columns(). Otherwise it simply returns columns(row).
+     *
+     * @pre @p buffer must hold at least column_buffer_size() elements.
+     */
+    const unsigned int *columns(const unsigned int row,
+                                unsigned int *buffer) const;
+
+    /**
+     * Return the buffer size required by columns(row, buffer).
+     */
+    unsigned int column_buffer_size() const;
+
+    /**
+     * Issue a software prefetch for the column indices of row @p row. In
+     * the vectorized region [0, n_internal_dofs) this covers the column
+     * indices of the whole group of simd_length rows containing @p row.
+     * The function is a hint to the hardware and has no observable
+     * effect.
+     */
+    void prefetch_row(const unsigned int row) const;
+
     unsigned int row_length(const unsigned int row) const;
 
+    /**
+     * Return the length n of the longest prefix of row @p row (of the
+     * whole group of simd_length rows containing @p row in the
+     * vectorized region) such that all columns at positions [1, n) lie
+     * strictly below the diagonal. Hot loops over the upper triangular
+     * part can skip these positions without inspecting the column
+     * indices of every lane.
+     */
+    unsigned int lower_prefix_length(const unsigned int row) const;
+
+    /**
+     * Return true if the columns of the group of simd_length rows
+     * containing @p row are lane contiguous, i.e., if at every position
+     * the column of lane k is the column of lane 0 plus k. This is the
+     * case for one-dimensional problems with a Cuthill-McKee ordering of
+     * the degrees of freedom, where the stencil of row i is a contiguous
+     * index range around i. The state of a column position can then be
+     * loaded with MultiComponentVector::get_contiguous_tensor() instead
+     * of a gather. The function returns false outside of the vectorized
+     * region [0, n_internal_dofs).
+     */
+    bool contiguous_columns(const unsigned int row) const;
+
     unsigned int n_rows() const;
 
     std::size_t n_nonzero_elements() const;
 
+    /**
+     * Return an estimate of the memory consumption (in bytes) of the
+     * sparsity pattern, i.e., the row starts, column indices and
+     * transposed indices.
+     */
+    std::size_t memory_consumption() const;
+
+    /**
+     * Select the MPI communication backend used for exchanging ghost rows
+     * of all SparseMatrixSIMD objects associated with this sparsity
+     * pattern. Selecting GhostRowExchange::neighborhood_collective creates
+     * a distributed graph communicator and is thus a collective operation.
+     * The selection persists over subsequent calls to reinit().
+     */
+    void set_ghost_row_exchange(const GhostRowExchange ghost_row_exchange);
+
+    /**
+     * Enable or disable an additional compressed copy of the column
+     * indices: Every column index is stored as a 16 bit difference to its
+     * row index, which is small for a bandwidth reducing dof renumbering.
+     * Differences that do not fit are marked by an escape value and
+     * stored separately. The compressed copy is used by columns(row,
+     * buffer) and halves the index traffic of hot loops, at the cost of
+     * about 2 additional bytes per matrix entry. The selection persists
+     * over subsequent calls to reinit().
+     */
+    void set_compressed_columns(const bool compressed_columns);
+
   protected:
     unsigned int n_internal_dofs;
     unsigned int n_locally_owned_dofs;
@@ -114,6 +226,36 @@ namespace ryujin
     dealii::AlignedVector<unsigned int> column_indices;
     dealii::AlignedVector<unsigned int> indices_transposed;
 
+    /**
+     * The prefix lengths returned by lower_prefix_length(), indexed like
+     * row_starts.
+     */
+    std::vector<unsigned int> lower_prefix_lengths;
+
+    /**
+     * One flag per group of simd_length rows in the vectorized region,
+     * see contiguous_columns().
+     */
+    std::vector<std::uint8_t> contiguous_row_groups;
+
+    /**
+     * Compressed column indices, see set_compressed_columns(). The arrays
+     * column_deltas and escape_starts are indexed like column_indices and
+     * row_starts. The half open range [escape_starts[r],
+     * escape_starts[r+1]) lists all escaped entries of a row (group) as
+     * a pair {position within the row (group), column index}.
+     */
+    bool compressed_columns;
+    unsigned int max_row_group_size;
+    dealii::AlignedVector<std::int16_t> column_deltas;
+    dealii::AlignedVector<unsigned int> escape_starts;
+    std::vector<std::pair<unsigned int, unsigned int>> escapes;
+
+    /**
+     * (Re)create the compressed column indices from column_indices.
+     */
+    void compress_columns();
+
     /**
      * Array listing all (locally owned) entries as a pair {row,
      * position_within_column}, potentially duplicated, and arranged
@@ -143,6 +285,20 @@ namespace ryujin
 
     MPI_Comm mpi_communicator;
 
+    GhostRowExchange ghost_row_exchange;
+
+    /**
+     * A distributed graph communicator connecting all receive and send
+     * targets. Only set up for GhostRowExchange::neighborhood_collective.
+     */
+    std::shared_ptr<MPI_Comm> neighborhood_communicator;
+
+    /**
+     * (Re)create the neighborhood communicator if
+     * GhostRowExchange::neighborhood_collective is selected.
+     */
+    void create_neighborhood_communicator();
+
     template <typename, int, int>
     friend class SparseMatrixSIMD;
   };
@@ -156,6 +312,13 @@ namespace ryujin
    * SparsityPatternSIMD for details). For the non-vectorized row index
    * region [n_internal_dofs, n_locally_relevant_dofs) we store the matrix in
    * CSR format (equivalent to the static dealii::SparsityPattern).
+   *
+   * The template parameter @p Number determines the storage precision of
+   * the matrix entries. All access functions can be called with a
+   * different (scalar, or vectorized with identical simd_length)
+   * arithmetic type @a Number2 in which case entries are converted on the
+   * fly. This allows to store matrices in single precision while
+   * computing in double precision.
    */
   template <typename Number, int n_components, int simd_length>
   class SparseMatrixSIMD
@@ -175,6 +338,34 @@ namespace ryujin
     void read_in(const SparseMatrix &sparse_matrix,
                  bool locally_indexed = true);
 
+    /**
+     * Set all entries of the matrix (including ghost rows) to zero. The
+     * entries are written in parallel, see first_touch().
+     */
+    void set_zero();
+
+    /**
+     * Write or read all matrix entries (but not the sparsity pattern) to
+     * or from a boost archive. When reading, the matrix has to be
+     * initialized with a sparsity pattern identical to the one used for
+     * writing.
+     */
+    template <class Archive>
+    void serialize(Archive &archive, const unsigned int version);
+
+    /**
+     * Return an estimate of the memory consumption (in bytes) of the
+     * matrix entries and communication buffers. The associated sparsity
+     * pattern is not included.
+     */
+    std::size_t memory_consumption() const;
+
+    /**
+     * Return a histogram of the NUMA nodes the (sampled) memory pages of
+     * the matrix entries are located on, see numa_page_distribution().
+     */
+    std::map<int, unsigned int> numa_page_distribution() const;
+
     using VectorizedArray = dealii::VectorizedArray<Number, simd_length>;
 
     /**
@@ -253,6 +444,15 @@ namespace ryujin
     get_transposed_tensor(const unsigned int row,
                           const unsigned int position_within_column) const;
 
+    /**
+     * Issue a software prefetch for all entries stored for row @p row.
+     * In the vectorized region [0, n_internal_dofs) this covers the
+     * entries of the whole group of simd_length rows containing @p row.
+     * The function is a hint to the hardware and has no observable
+     * effect.
+     */
+    void prefetch_row(const unsigned int row) const;
+
     /* Write scalar or tensor entry: */
 
     /**
@@ -290,17 +490,177 @@ namespace ryujin
 
     /* Synchronize over MPI ranks: */
 
-    void update_ghost_rows_start(const unsigned int communication_channel = 0);
+    /**
+     * Start the exchange of ghost rows with neighboring MPI ranks.
+     *
+     * If @p skip_zero_rows is set to true only those rows are transferred
+     * that have at least one nonzero entry; the entries of all other
+     * (ghost) rows are set to zero by update_ghost_rows_finish(). Every
+     * message is preceded by a small header of one byte per row
+     * indicating whether the row has been sent. This is beneficial for
+     * matrices where most rows vanish identically. The compressed
+     * exchange always uses point-to-point communication regardless of
+     * the selected GhostRowExchange backend.
+     *
+     * If @p quantize is set to true all entries are assumed to lie in the
+     * interval [0, 1] (as it is the case for limiter coefficients). The
+     * compressed exchange is used and the entries are sent as 16 bit
+     * fixed point numbers rounded down. Rows with all entries equal to one
+     * are only marked in the header. The exchanged entries are also
+     * rounded down in place on the sending side, so that both MPI ranks
+     * sharing an entry see the same value.
+     *
+     * @note Quantization is only supported for scalar matrices
+     * (n_components equal to 1).
+     */
+    void update_ghost_rows_start(const unsigned int communication_channel = 0,
+                                 const bool skip_zero_rows = false,
+                                 const bool quantize = false);
 
     void update_ghost_rows_finish();
 
     void update_ghost_rows();
 
   protected:
+    /**
+     * Copy all locally owned entries that have to be sent to other MPI
+     * ranks into the exchange buffer.
+     */
+    void pack_exchange_buffer();
+
+    /**
+     * Variant of pack_exchange_buffer() used for an exchange with
+     * skip_zero_rows or quantize set to true: For every send target we
+     * write one byte per row (padded to a multiple of sizeof(Number))
+     * indicating the RowEncoding of the row, followed by the (possibly
+     * quantized) entries of all rows that are sent. The number of bytes
+     * of every message is stored in compressed_send_sizes.
+     */
+    void pack_compressed_exchange_buffer(const bool quantize);
+
+    /**
+     * Unpack the compressed ghost rows received by an exchange with
+     * skip_zero_rows or quantize set to true.
+     */
+    void unpack_compressed_exchange_buffer();
+
+    /**
+     * The encoding of a row in a compressed message.
+     */
+    enum RowEncoding : char {
+      zero_row = 0,
+      full_row = 1,
+      quantized_row = 2,
+      unit_row = 3,
+    };
+
+    /**
+     * Return the largest 16 bit fixed point number q with
+     * q / 65535 <= @p value, for a value in the interval [0, 1].
+     */
+    static std::uint16_t quantize_entry(const Number value);
+
+    /**
+     * Return the value represented by the fixed point number @p q.
+     */
+    static Number dequantize_entry(const std::uint16_t q);
+
+    /**
+     * Return an upper bound (in bytes) for the size of a compressed
+     * message consisting of @p n_rows rows with a total number of
+     * @p n_entries entries.
+     */
+    static std::size_t compressed_message_size(const std::size_t n_rows,
+                                               const std::size_t n_entries);
+
+    /**
+     * A small RAII wrapper around a set of persistent MPI requests that
+     * remembers the MPI tag and the buffers the requests are bound to.
+     * Copies never share requests with the original object.
+     */
+    class PersistentRequests
+    {
+    public:
+      PersistentRequests() = default;
+
+      PersistentRequests(const PersistentRequests &) {}
+
+      PersistentRequests(PersistentRequests &&other) noexcept
+      {
+        *this = std::move(other);
+      }
+
+      PersistentRequests &operator=(const PersistentRequests &)
+      {
+        clear();
+        return *this;
+      }
+
+      PersistentRequests &operator=(PersistentRequests &&other) noexcept
+      {
+        if (this != &other) {
+          clear();
+          requests = std::move(other.requests);
+          mpi_tag = other.mpi_tag;
+          receive_buffer = other.receive_buffer;
+          send_buffer = other.send_buffer;
+          other.requests.clear();
+        }
+        return *this;
+      }
+
+      ~PersistentRequests()
+      {
+        clear();
+      }
+
+      bool matches(const int tag,
+                   const void *receive,
+                   const void *send) const
+      {
+        return !requests.empty() && tag == mpi_tag &&
+               receive == receive_buffer && send == send_buffer;
+      }
+
+      void clear()
+      {
+#ifdef DEAL_II_WITH_MPI
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (finalized == 0)
+          for (auto &request : requests)
+            if (request != MPI_REQUEST_NULL)
+              MPI_Request_free(&request);
+#endif
+        requests.clear();
+      }
+
+      std::vector<MPI_Request> requests;
+      int mpi_tag = -1;
+      const void *receive_buffer = nullptr;
+      const void *send_buffer = nullptr;
+    };
+
     const SparsityPatternSIMD<simd_length> *sparsity;
     dealii::AlignedVector<Number> data;
     dealii::AlignedVector<Number> exchange_buffer;
     std::vector<MPI_Request> requests;
+
+    PersistentRequests persistent_requests;
+
+    /* Counts and displacements (in bytes) for the neighborhood collective: */
+    std::vector<int> send_counts;
+    std::vector<int> send_displacements;
+    std::vector<int> receive_counts;
+    std::vector<int> receive_displacements;
+
+    /* Buffers and message layout for an exchange skipping zero rows: */
+    std::vector<char> compressed_send_buffer;
+    std::vector<char> compressed_receive_buffer;
+    std::vector<std::size_t> compressed_send_offsets;
+    std::vector<std::size_t> compressed_send_sizes;
+    std::vector<std::size_t> compressed_receive_offsets;
+    bool compressed_exchange_pending = false;
   };
 
   /*
@@ -335,6 +695,86 @@ namespace ryujin
   }
 
 
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline const unsigned int *
+  SparsityPatternSIMD<simd_length>::columns(const unsigned int row,
+                                            unsigned int *buffer) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    if (!compressed_columns)
+      return columns(row);
+
+    const unsigned int r = row < n_internal_dofs ? row / simd_length : row;
+    const std::size_t first = row_starts[r];
+    const unsigned int size = row_starts[r + 1] - first;
+    const std::int16_t *deltas = column_deltas.data() + first;
+
+    /*
+     * Decode all entries of the row (group) into the buffer. The loop
+     * over the simd_length lanes is vectorized by the compiler:
+     */
+    if (row < n_internal_dofs) {
+      const unsigned int base = r * simd_length;
+      for (unsigned int p = 0; p < size; p += simd_length)
+        for (unsigned int k = 0; k < simd_length; ++k)
+          buffer[p + k] = base + k + deltas[p + k];
+    } else {
+      for (unsigned int p = 0; p < size; ++p)
+        buffer[p] = row + deltas[p];
+    }
+
+    for (unsigned int e = escape_starts[r]; e < escape_starts[r + 1]; ++e)
+      buffer[escapes[e].first] = escapes[e].second;
+
+    return row < n_internal_dofs ? buffer + row % simd_length : buffer;
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::column_buffer_size() const
+  {
+    return max_row_group_size;
+  }
+
+
+  namespace
+  {
+    /**
+     * Internally used: Issue a software prefetch (for reading) for all
+     * cache lines covering the half open range [begin, end).
+     */
+    template <typename T>
+    DEAL_II_ALWAYS_INLINE inline void prefetch_range(const T *begin,
+                                                     const T *end)
+    {
+      constexpr std::size_t cache_line_size = 64;
+      const char *first = reinterpret_cast<const char *>(begin);
+      const char *last = reinterpret_cast<const char *>(end);
+      for (; first < last; first += cache_line_size)
+        __builtin_prefetch(first, /*read*/ 0, /*high locality*/ 3);
+    }
+  } // namespace
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline void
+  SparsityPatternSIMD<simd_length>::prefetch_row(const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    const auto data = column_indices.data();
+    if (row < n_internal_dofs) {
+      const unsigned int simd_row = row / simd_length;
+      prefetch_range(data + row_starts[simd_row],
+                     data + row_starts[simd_row + 1]);
+    } else {
+      prefetch_range(data + row_starts[row], data + row_starts[row + 1]);
+    }
+  }
+
+
   template <int simd_length>
   DEAL_II_ALWAYS_INLINE inline unsigned int
   SparsityPatternSIMD<simd_length>::row_length(const unsigned int row) const
@@ -350,6 +790,34 @@ namespace ryujin
   }
 
 
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::lower_prefix_length(
+      const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    if (row < n_internal_dofs)
+      return lower_prefix_lengths[row / simd_length];
+    else
+      return lower_prefix_lengths[row];
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline bool
+  SparsityPatternSIMD<simd_length>::contiguous_columns(
+      const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    if (row < n_internal_dofs)
+      return contiguous_row_groups[row / simd_length];
+    else
+      return false;
+  }
+
+
   template <int simd_length>
   DEAL_II_ALWAYS_INLINE inline unsigned int
   SparsityPatternSIMD<simd_length>::n_rows() const
@@ -368,6 +836,46 @@ namespace ryujin
   }
 
 
+  template <int simd_length>
+  inline std::size_t
+  SparsityPatternSIMD<simd_length>::memory_consumption() const
+  {
+    return dealii::MemoryConsumption::memory_consumption(row_starts) +
+           dealii::MemoryConsumption::memory_consumption(column_indices) +
+           dealii::MemoryConsumption::memory_consumption(indices_transposed) +
+           dealii::MemoryConsumption::memory_consumption(lower_prefix_lengths) +
+           dealii::MemoryConsumption::memory_consumption(
+               contiguous_row_groups) +
+           dealii::MemoryConsumption::memory_consumption(column_deltas) +
+           dealii::MemoryConsumption::memory_consumption(escape_starts) +
+           dealii::MemoryConsumption::memory_consumption(escapes);
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline std::size_t
+  SparseMatrixSIMD<Number, n_components, simd_length>::memory_consumption()
+      const
+  {
+    return dealii::MemoryConsumption::memory_consumption(data) +
+           dealii::MemoryConsumption::memory_consumption(exchange_buffer) +
+           dealii::MemoryConsumption::memory_consumption(
+               compressed_send_buffer) +
+           dealii::MemoryConsumption::memory_consumption(
+               compressed_receive_buffer);
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline std::map<int, unsigned int>
+  SparseMatrixSIMD<Number, n_components, simd_length>::numa_page_distribution()
+      const
+  {
+    return ryujin::numa_page_distribution(data.data(),
+                                          data.size() * sizeof(Number));
+  }
+
+
   template <typename Number, int n_components, int simd_length>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline auto
@@ -439,6 +947,40 @@ namespace ryujin
       for (unsigned int d = 0; d < n_components; ++d)
         result[d].load(load_pos + d * simd_length);
 
+    } else if constexpr (std::is_same<
+                             typename get_value_type<Number2>::type,
+                             Number2>::value) {
+      /*
+       * Non-vectorized slow access with conversion, for example, for
+       * matrix entries stored in single precision.
+       */
+
+      const auto temp = get_tensor<Number>(row, position_within_column);
+      for (unsigned int d = 0; d < n_components; ++d)
+        result[d] = Number2(temp[d]);
+
+    } else if constexpr (Number2::size() == simd_length) {
+      /*
+       * Vectorized access with conversion. Indices must be in the range
+       * [0,n_internal), index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      const Number *load_pos =
+          data.data() + (sparsity->row_starts[row / simd_length] +
+                         position_within_column * simd_length) *
+                            n_components;
+
+      for (unsigned int d = 0; d < n_components; ++d)
+        for (unsigned int k = 0; k < simd_length; ++k)
+          result[d][k] = load_pos[d * simd_length + k];
+
     } else {
       /* not implemented */
       __builtin_trap();
@@ -545,6 +1087,38 @@ namespace ryujin
       result[0].gather(data.data(),
                        sparsity->indices_transposed.data() + offset);
 
+    } else if constexpr (std::is_same<
+                             typename get_value_type<Number2>::type,
+                             Number2>::value) {
+      /*
+       * Non-vectorized slow access with conversion, for example, for
+       * matrix entries stored in single precision.
+       */
+
+      const auto temp =
+          get_transposed_tensor<Number>(row, position_within_column);
+      for (unsigned int d = 0; d < n_components; ++d)
+        result[d] = Number2(temp[d]);
+
+    } else if constexpr (Number2::size() == simd_length &&
+                         (n_components == 1)) {
+      /*
+       * Vectorized access with conversion. Indices must be in the range
+       * [0,n_internal), index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      const unsigned int offset = sparsity->row_starts[row / simd_length] +
+                                  position_within_column * simd_length;
+      for (unsigned int k = 0; k < simd_length; ++k)
+        result[0][k] = data[sparsity->indices_transposed[offset + k]];
+
     } else {
       /* not implemented */
       __builtin_trap();
@@ -554,6 +1128,26 @@ namespace ryujin
   }
 
 
+  template <typename Number, int n_components, int simd_length>
+  DEAL_II_ALWAYS_INLINE inline void
+  SparseMatrixSIMD<Number, n_components, simd_length>::prefetch_row(
+      const unsigned int row) const
+  {
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+    AssertIndexRange(row, sparsity->row_starts.size() - 1);
+
+    const auto &row_starts = sparsity->row_starts;
+    if (row < sparsity->n_internal_dofs) {
+      const unsigned int simd_row = row / simd_length;
+      prefetch_range(data.data() + row_starts[simd_row] * n_components,
+                     data.data() + row_starts[simd_row + 1] * n_components);
+    } else {
+      prefetch_range(data.data() + row_starts[row] * n_components,
+                     data.data() + row_starts[row + 1] * n_components);
+    }
+  }
+
+
   template <typename Number, int n_components, int simd_length>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline void
@@ -639,6 +1233,40 @@ namespace ryujin
         for (unsigned int d = 0; d < n_components; ++d)
           entry[d].store(store_pos + d * simd_length);
 
+    } else if constexpr (std::is_same<
+                             typename get_value_type<Number2>::type,
+                             Number2>::value) {
+      /*
+       * Non-vectorized slow access with conversion, for example, for
+       * matrix entries stored in single precision.
+       */
+
+      dealii::Tensor<1, n_components, Number> temp;
+      for (unsigned int d = 0; d < n_components; ++d)
+        temp[d] = Number(entry[d]);
+      write_entry<Number>(temp, row, position_within_column);
+
+    } else if constexpr (Number2::size() == simd_length) {
+      /*
+       * Vectorized access with conversion. Indices must be in the range
+       * [0,n_internal), index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      Number *store_pos =
+          data.data() + (sparsity->row_starts[row / simd_length] +
+                         position_within_column * simd_length) *
+                            n_components;
+      for (unsigned int d = 0; d < n_components; ++d)
+        for (unsigned int k = 0; k < simd_length; ++k)
+          store_pos[d * simd_length + k] = Number(entry[d][k]);
+
     } else {
       /* not implemented */
       __builtin_trap();
@@ -648,56 +1276,16 @@ namespace ryujin
 
   template <typename Number, int n_components, int simd_length>
   inline void
-  SparseMatrixSIMD<Number, n_components, simd_length>::update_ghost_rows_start(
-      const unsigned int communication_channel)
+  SparseMatrixSIMD<Number, n_components, simd_length>::pack_exchange_buffer()
   {
-#ifdef DEAL_II_WITH_MPI
-    AssertIndexRange(communication_channel, 200);
-
-    const unsigned int mpi_tag =
-        dealii::Utilities::MPI::internal::Tags::partitioner_export_start +
-        communication_channel;
-    Assert(mpi_tag <=
-               dealii::Utilities::MPI::internal::Tags::partitioner_export_end,
-           dealii::ExcInternalError());
-
-    const std::size_t n_indices = sparsity->entries_to_be_sent.size();
-    exchange_buffer.resize_fast(n_components * n_indices);
-
-    requests.resize(sparsity->receive_targets.size() +
-                    sparsity->send_targets.size());
-
-    /*
-     * Set up MPI receive requests. We will always receive data for indices
-     * in the range [n_locally_owned_, n_locally_relevant_), thus the DATA
-     * is stored in non-vectorized CSR format.
-     */
-
-    {
-      const auto &targets = sparsity->receive_targets;
-      for (unsigned int p = 0; p < targets.size(); ++p) {
-        const int ierr = MPI_Irecv(
-            data.data() +
-                n_components *
-                    (sparsity->row_starts[sparsity->n_locally_owned_dofs] +
-                     (p == 0 ? 0 : targets[p - 1].second)),
-            (targets[p].second - (p == 0 ? 0 : targets[p - 1].second)) *
-                n_components * sizeof(Number),
-            MPI_BYTE,
-            targets[p].first,
-            mpi_tag,
-            sparsity->mpi_communicator,
-            &requests[p]);
-        AssertThrowMPI(ierr);
-      }
-    }
-
     /*
      * Copy all entries that we plan to send over to the exchange buffer.
      * Here, we have to be careful with indices falling into the "locally
      * internal" range that are stored in an array-of-struct-of-array type.
      */
 
+    const std::size_t n_indices = sparsity->entries_to_be_sent.size();
+
     for (std::size_t c = 0; c < n_indices; ++c) {
 
       const auto &[row, position_within_column] =
@@ -724,28 +1312,436 @@ namespace ryujin
                    d];
       }
     }
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline std::size_t
+  SparseMatrixSIMD<Number, n_components, simd_length>::compressed_message_size(
+      const std::size_t n_rows, const std::size_t n_entries)
+  {
+    /* Pad the header such that all entries are suitably aligned: */
+    const std::size_t header =
+        (n_rows + sizeof(Number) - 1) / sizeof(Number) * sizeof(Number);
+    return header + n_entries * n_components * sizeof(Number);
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline std::uint16_t
+  SparseMatrixSIMD<Number, n_components, simd_length>::quantize_entry(
+      const Number value)
+  {
+    Assert(value >= Number(0.) && value <= Number(1.),
+           dealii::ExcMessage("Quantized entries must lie in [0, 1]"));
+
+    /* Correct the rounding of the product, the result is idempotent: */
+    long q = static_cast<long>(value * Number(65535.));
+    if (q > 0 && dequantize_entry(q) > value)
+      --q;
+    else if (q < 65535 && dequantize_entry(q + 1) <= value)
+      ++q;
+    return static_cast<std::uint16_t>(q);
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  DEAL_II_ALWAYS_INLINE inline Number
+  SparseMatrixSIMD<Number, n_components, simd_length>::dequantize_entry(
+      const std::uint16_t q)
+  {
+    return Number(q) / Number(65535.);
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline void SparseMatrixSIMD<Number, n_components, simd_length>::
+      pack_compressed_exchange_buffer(const bool quantize)
+  {
+    const auto &entries = sparsity->entries_to_be_sent;
+    const auto &send_targets = sparsity->send_targets;
+
+    const auto entry = [&](const std::size_t c,
+                           const unsigned int d) -> Number & {
+      const auto &[row, position_within_column] = entries[c];
+
+      Assert(row < sparsity->n_locally_owned_dofs, dealii::ExcInternalError());
+
+      if (row < sparsity->n_internal_dofs) {
+        const unsigned int simd_row = row / simd_length;
+        const unsigned int simd_offset = row % simd_length;
+        return data[(sparsity->row_starts[simd_row] +
+                     position_within_column * simd_length) *
+                        n_components +
+                    d * simd_length + simd_offset];
+      } else {
+        return data[(sparsity->row_starts[row] + position_within_column) *
+                        n_components +
+                    d];
+      }
+    };
+
+    /*
+     * Every row starts with its diagonal entry (position_within_column
+     * equal to zero), we can thus identify all rows sent to a given
+     * target.
+     */
+    const auto n_rows = [&](const std::size_t begin, const std::size_t end) {
+      std::size_t result = 0;
+      for (std::size_t c = begin; c < end; ++c)
+        if (entries[c].second == 0)
+          ++result;
+      return result;
+    };
+
+    compressed_send_offsets.resize(send_targets.size() + 1);
+    compressed_send_sizes.resize(send_targets.size());
+    compressed_send_offsets[0] = 0;
+    for (unsigned int p = 0; p < send_targets.size(); ++p) {
+      const std::size_t begin = p == 0 ? 0 : send_targets[p - 1].second;
+      const std::size_t end = send_targets[p].second;
+      compressed_send_offsets[p + 1] =
+          compressed_send_offsets[p] +
+          compressed_message_size(n_rows(begin, end), end - begin);
+    }
+    compressed_send_buffer.resize(compressed_send_offsets.back());
+
+    for (unsigned int p = 0; p < send_targets.size(); ++p) {
+      const std::size_t begin = p == 0 ? 0 : send_targets[p - 1].second;
+      const std::size_t end = send_targets[p].second;
+
+      char *const message =
+          compressed_send_buffer.data() + compressed_send_offsets[p];
+      char *position = message + compressed_message_size(n_rows(begin, end), 0);
+
+      unsigned int k = 0;
+      for (std::size_t c = begin; c < end; ++k) {
+        Assert(entries[c].second == 0, dealii::ExcInternalError());
+
+        std::size_t c_end = c + 1;
+        while (c_end < end && entries[c_end].second != 0)
+          ++c_end;
+
+        bool nonzero = false;
+        bool unit = quantize;
+        for (std::size_t c_2 = c; c_2 < c_end; ++c_2)
+          for (unsigned int d = 0; d < n_components; ++d) {
+            nonzero = nonzero || (entry(c_2, d) != Number(0.));
+            unit = unit && (entry(c_2, d) == Number(1.));
+          }
+
+        if (!nonzero) {
+          message[k] = zero_row;
+
+        } else if (unit) {
+          message[k] = unit_row;
+
+        } else if (quantize) {
+          message[k] = quantized_row;
+          for (std::size_t c_2 = c; c_2 < c_end; ++c_2) {
+            const std::uint16_t q = quantize_entry(entry(c_2, 0));
+            entry(c_2, 0) = dequantize_entry(q);
+            std::memcpy(position, &q, sizeof(std::uint16_t));
+            position += sizeof(std::uint16_t);
+          }
+
+        } else {
+          message[k] = full_row;
+          for (std::size_t c_2 = c; c_2 < c_end; ++c_2)
+            for (unsigned int d = 0; d < n_components; ++d) {
+              const Number value = entry(c_2, d);
+              std::memcpy(position, &value, sizeof(Number));
+              position += sizeof(Number);
+            }
+        }
+
+        c = c_end;
+      }
+
+      compressed_send_sizes[p] = position - message;
+    }
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline void SparseMatrixSIMD<Number, n_components, simd_length>::
+      unpack_compressed_exchange_buffer()
+  {
+    const auto &receive_targets = sparsity->receive_targets;
+    const auto &row_starts = sparsity->row_starts;
+
+    unsigned int row = sparsity->n_locally_owned_dofs;
+    const std::size_t ghost_start = row_starts[row];
+
+    for (unsigned int p = 0; p < receive_targets.size(); ++p) {
+      const std::size_t end = ghost_start + receive_targets[p].second;
+
+      unsigned int row_end = row;
+      while (row_starts[row_end] < end)
+        ++row_end;
+
+      const char *const message =
+          compressed_receive_buffer.data() + compressed_receive_offsets[p];
+      const char *position =
+          message + compressed_message_size(row_end - row, 0);
+
+      for (unsigned int k = 0; row < row_end; ++row, ++k) {
+        Number *const target = data.data() + row_starts[row] * n_components;
+        const std::size_t n_numbers =
+            (row_starts[row + 1] - row_starts[row]) * n_components;
+
+        switch (message[k]) {
+        case zero_row:
+          std::fill(target, target + n_numbers, Number(0.));
+          break;
+        case unit_row:
+          std::fill(target, target + n_numbers, Number(1.));
+          break;
+        case quantized_row:
+          for (std::size_t n = 0; n < n_numbers; ++n) {
+            std::uint16_t q;
+            std::memcpy(&q, position, sizeof(std::uint16_t));
+            position += sizeof(std::uint16_t);
+            target[n] = dequantize_entry(q);
+          }
+          break;
+        default:
+          std::memcpy(target, position, n_numbers * sizeof(Number));
+          position += n_numbers * sizeof(Number);
+        }
+      }
+    }
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline void
+  SparseMatrixSIMD<Number, n_components, simd_length>::update_ghost_rows_start(
+      const unsigned int communication_channel,
+      const bool skip_zero_rows,
+      const bool quantize)
+  {
+    TraceScope trace("ghost row exchange start");
+#ifdef DEAL_II_WITH_MPI
+    AssertIndexRange(communication_channel, 200);
+
+    const unsigned int mpi_tag =
+        dealii::Utilities::MPI::internal::Tags::partitioner_export_start +
+        communication_channel;
+    Assert(mpi_tag <=
+               dealii::Utilities::MPI::internal::Tags::partitioner_export_end,
+           dealii::ExcInternalError());
+
+    const std::size_t n_indices = sparsity->entries_to_be_sent.size();
+    exchange_buffer.resize_fast(n_components * n_indices);
 
     /*
-     * Set up MPI send requests. We have copied everything we intend to
+     * We will always receive data for indices in the range
+     * [n_locally_owned_, n_locally_relevant_), thus the DATA is stored in
+     * non-vectorized CSR format. We have copied everything we intend to
      * send to the exchange_buffer compatible with the CSR storage format
      * of the receiving MPI rank.
      */
 
-    {
-      const auto &targets = sparsity->send_targets;
-      for (unsigned int p = 0; p < targets.size(); ++p) {
+    const auto &receive_targets = sparsity->receive_targets;
+    const auto &send_targets = sparsity->send_targets;
+
+    Number *const receive_data =
+        data.data() +
+        n_components * sparsity->row_starts[sparsity->n_locally_owned_dofs];
+
+    const auto offset = [](const auto &targets, const unsigned int p) {
+      return p == 0 ? 0 : targets[p - 1].second;
+    };
+
+    const auto size = [&](const auto &targets, const unsigned int p) {
+      return (targets[p].second - offset(targets, p)) * n_components *
+             sizeof(Number);
+    };
+
+    Assert(!quantize || n_components == 1,
+           dealii::ExcMessage("Quantization is only supported for scalar "
+                              "matrices"));
+
+    if (skip_zero_rows || quantize) {
+      /*
+       * The size of a compressed message is not known in advance. We
+       * post receives for the largest possible message into a separate
+       * buffer and copy the data into place in update_ghost_rows_finish().
+       */
+
+      const auto &row_starts = sparsity->row_starts;
+      unsigned int row = sparsity->n_locally_owned_dofs;
+      const std::size_t ghost_start = row_starts[row];
+
+      compressed_receive_offsets.resize(receive_targets.size() + 1);
+      compressed_receive_offsets[0] = 0;
+      for (unsigned int p = 0; p < receive_targets.size(); ++p) {
+        const std::size_t end = ghost_start + receive_targets[p].second;
+        const unsigned int row_begin = row;
+        while (row_starts[row] < end)
+          ++row;
+        compressed_receive_offsets[p + 1] =
+            compressed_receive_offsets[p] +
+            compressed_message_size(row - row_begin,
+                                    receive_targets[p].second -
+                                        offset(receive_targets, p));
+      }
+      compressed_receive_buffer.resize(compressed_receive_offsets.back());
+
+      requests.resize(receive_targets.size() + send_targets.size());
+
+      for (unsigned int p = 0; p < receive_targets.size(); ++p) {
+        const int ierr = MPI_Irecv(
+            compressed_receive_buffer.data() + compressed_receive_offsets[p],
+            compressed_receive_offsets[p + 1] - compressed_receive_offsets[p],
+            MPI_BYTE,
+            receive_targets[p].first,
+            mpi_tag,
+            sparsity->mpi_communicator,
+            &requests[p]);
+        AssertThrowMPI(ierr);
+      }
+
+      pack_compressed_exchange_buffer(quantize);
+
+      for (unsigned int p = 0; p < send_targets.size(); ++p) {
         const int ierr = MPI_Isend(
-            exchange_buffer.data() +
-                n_components * (p == 0 ? 0 : targets[p - 1].second),
-            (targets[p].second - (p == 0 ? 0 : targets[p - 1].second)) *
-                n_components * sizeof(Number),
+            compressed_send_buffer.data() + compressed_send_offsets[p],
+            compressed_send_sizes[p],
             MPI_BYTE,
-            targets[p].first,
+            send_targets[p].first,
             mpi_tag,
             sparsity->mpi_communicator,
-            &requests[p + sparsity->receive_targets.size()]);
+            &requests[p + receive_targets.size()]);
         AssertThrowMPI(ierr);
       }
+
+      compressed_exchange_pending = true;
+      return;
+    }
+
+    switch (sparsity->ghost_row_exchange) {
+    case GhostRowExchange::point_to_point: {
+      requests.resize(receive_targets.size() + send_targets.size());
+
+      /* Set up MPI receive requests: */
+
+      for (unsigned int p = 0; p < receive_targets.size(); ++p) {
+        const int ierr =
+            MPI_Irecv(receive_data + n_components * offset(receive_targets, p),
+                      size(receive_targets, p),
+                      MPI_BYTE,
+                      receive_targets[p].first,
+                      mpi_tag,
+                      sparsity->mpi_communicator,
+                      &requests[p]);
+        AssertThrowMPI(ierr);
+      }
+
+      pack_exchange_buffer();
+
+      /* Set up MPI send requests: */
+
+      for (unsigned int p = 0; p < send_targets.size(); ++p) {
+        const int ierr = MPI_Isend(
+            exchange_buffer.data() + n_components * offset(send_targets, p),
+            size(send_targets, p),
+            MPI_BYTE,
+            send_targets[p].first,
+            mpi_tag,
+            sparsity->mpi_communicator,
+            &requests[p + receive_targets.size()]);
+        AssertThrowMPI(ierr);
+      }
+    } break;
+
+    case GhostRowExchange::persistent: {
+      pack_exchange_buffer();
+
+      auto &persistent = persistent_requests;
+      if (!persistent.matches(mpi_tag, receive_data, exchange_buffer.data())) {
+        persistent.clear();
+        persistent.requests.resize(receive_targets.size() +
+                                   send_targets.size());
+
+        for (unsigned int p = 0; p < receive_targets.size(); ++p) {
+          const int ierr = MPI_Recv_init(
+              receive_data + n_components * offset(receive_targets, p),
+              size(receive_targets, p),
+              MPI_BYTE,
+              receive_targets[p].first,
+              mpi_tag,
+              sparsity->mpi_communicator,
+              &persistent.requests[p]);
+          AssertThrowMPI(ierr);
+        }
+
+        for (unsigned int p = 0; p < send_targets.size(); ++p) {
+          const int ierr = MPI_Send_init(
+              exchange_buffer.data() + n_components * offset(send_targets, p),
+              size(send_targets, p),
+              MPI_BYTE,
+              send_targets[p].first,
+              mpi_tag,
+              sparsity->mpi_communicator,
+              &persistent.requests[p + receive_targets.size()]);
+          AssertThrowMPI(ierr);
+        }
+
+        persistent.mpi_tag = mpi_tag;
+        persistent.receive_buffer = receive_data;
+        persistent.send_buffer = exchange_buffer.data();
+      }
+
+      if (!persistent.requests.empty()) {
+        const int ierr = MPI_Startall(persistent.requests.size(),
+                                      persistent.requests.data());
+        AssertThrowMPI(ierr);
+      }
+    } break;
+
+    case GhostRowExchange::neighborhood_collective: {
+      Assert(sparsity->neighborhood_communicator != nullptr,
+             dealii::ExcInternalError());
+
+      pack_exchange_buffer();
+
+      /*
+       * The count and displacement arrays must not be modified until the
+       * nonblocking collective completes, we thus store them as members:
+       */
+
+      receive_counts.resize(receive_targets.size());
+      receive_displacements.resize(receive_targets.size());
+      for (unsigned int p = 0; p < receive_targets.size(); ++p) {
+        receive_counts[p] = size(receive_targets, p);
+        receive_displacements[p] =
+            offset(receive_targets, p) * n_components * sizeof(Number);
+      }
+
+      send_counts.resize(send_targets.size());
+      send_displacements.resize(send_targets.size());
+      for (unsigned int p = 0; p < send_targets.size(); ++p) {
+        send_counts[p] = size(send_targets, p);
+        send_displacements[p] =
+            offset(send_targets, p) * n_components * sizeof(Number);
+      }
+
+      requests.resize(1);
+      const int ierr =
+          MPI_Ineighbor_alltoallv(exchange_buffer.data(),
+                                  send_counts.data(),
+                                  send_displacements.data(),
+                                  MPI_BYTE,
+                                  receive_data,
+                                  receive_counts.data(),
+                                  receive_displacements.data(),
+                                  MPI_BYTE,
+                                  *sparsity->neighborhood_communicator,
+                                  &requests[0]);
+      AssertThrowMPI(ierr);
+    } break;
     }
 #endif
   }
@@ -755,10 +1751,23 @@ namespace ryujin
   inline void SparseMatrixSIMD<Number, n_components, simd_length>::
       update_ghost_rows_finish()
   {
+    TraceScope trace("ghost row exchange wait");
 #ifdef DEAL_II_WITH_MPI
-    const int ierr =
-        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    auto &active_requests =
+        sparsity->ghost_row_exchange == GhostRowExchange::persistent &&
+                !compressed_exchange_pending
+            ? persistent_requests.requests
+            : requests;
+
+    const int ierr = MPI_Waitall(active_requests.size(),
+                                 active_requests.data(),
+                                 MPI_STATUSES_IGNORE);
     AssertThrowMPI(ierr);
+
+    if (compressed_exchange_pending) {
+      unpack_compressed_exchange_buffer();
+      compressed_exchange_pending = false;
+    }
 #endif
   }
 
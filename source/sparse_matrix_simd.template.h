@@ -18,6 +18,9 @@ namespace ryujin
       : n_internal_dofs(0)
       , row_starts(1)
       , mpi_communicator(MPI_COMM_SELF)
+      , ghost_row_exchange(GhostRowExchange::point_to_point)
+      , compressed_columns(false)
+      , max_row_group_size(0)
   {
   }
 
@@ -30,6 +33,9 @@ namespace ryujin
           &partitioner)
       : n_internal_dofs(0)
       , mpi_communicator(MPI_COMM_SELF)
+      , ghost_row_exchange(GhostRowExchange::point_to_point)
+      , compressed_columns(false)
+      , max_row_group_size(0)
   {
     reinit(n_internal_dofs, sparsity, partitioner);
   }
@@ -82,70 +88,100 @@ namespace ryujin
     Assert(n_locally_owned_dofs <= sparsity.n_rows(),
            dealii::ExcInternalError());
 
+    /*
+     * Allocate fresh storage and distribute the pages over NUMA nodes by
+     * a parallel first touch before filling the arrays below:
+     */
+    row_starts.clear();
+    column_indices.clear();
+    indices_transposed.clear();
     row_starts.resize_fast(sparsity.n_rows() + 1);
     column_indices.resize_fast(sparsity.n_nonzero_elements());
     indices_transposed.resize_fast(sparsity.n_nonzero_elements());
+    first_touch(row_starts.data(), row_starts.size());
+    first_touch(column_indices.data(), column_indices.size());
+    first_touch(indices_transposed.data(), indices_transposed.size());
     AssertThrow(sparsity.n_nonzero_elements() <
                     std::numeric_limits<unsigned int>::max(),
                 dealii::ExcMessage("Transposed indices only support up to 4 "
                                    "billion matrix entries per MPI rank. Try to"
                                    " split into smaller problems with MPI"));
 
-    /* Vectorized part: */
+    /*
+     * Compute the row starts with a prefix sum over the row (group)
+     * lengths. The column indices and transposed indices of every row
+     * (group) can then be filled independently, and thus thread
+     * parallel, below. All rows of a SIMD group have the same length.
+     */
+
+    const unsigned int n_groups = n_internal_dofs / simd_length;
+    const unsigned int n_rows = sparsity.n_rows();
 
     row_starts[0] = 0;
+    for (unsigned int r = 0; r < n_groups; ++r)
+      row_starts[r + 1] =
+          row_starts[r] + simd_length * sparsity.row_length(r * simd_length);
+
+    row_starts[n_internal_dofs] = row_starts[n_groups];
+    for (unsigned int i = n_internal_dofs; i < n_rows; ++i)
+      row_starts[i + 1] = row_starts[i] + sparsity.row_length(i);
+
+    Assert(row_starts[n_rows] == column_indices.size(),
+           dealii::ExcInternalError());
+
+    /*
+     * Return the position of the transposed entry (column, row) in our
+     * storage. The search only reads from the (static) sparsity pattern
+     * and is safe to call concurrently:
+     */
+    const auto transposed_index = [&](const unsigned int column,
+                                      const unsigned int row) {
+      const std::size_t position = sparsity(column, row);
+      if (column < n_internal_dofs) {
+        const unsigned int my_row_length = sparsity.row_length(column);
+        const std::size_t position_diag = sparsity(column, column);
+        const std::size_t pos_within_row = position - position_diag;
+        const unsigned int simd_offset = column % simd_length;
+        return static_cast<unsigned int>(
+            position - simd_offset * my_row_length - pos_within_row +
+            simd_offset + pos_within_row * simd_length);
+      }
+      return static_cast<unsigned int>(position);
+    };
 
-    unsigned int *col_ptr = column_indices.data();
-    unsigned int *transposed_ptr = indices_transposed.data();
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    /* Vectorized part: */
+
+    RYUJIN_OMP_FOR_NOWAIT
+    for (unsigned int r = 0; r < n_groups; ++r) {
+      const unsigned int i = r * simd_length;
+      std::size_t p = row_starts[r];
 
-    for (unsigned int i = 0; i < n_internal_dofs; i += simd_length) {
       auto jts = generate_iterators<simd_length>(
           [&](auto k) { return sparsity.begin(i + k); });
 
       for (; jts[0] != sparsity.end(i); increment_iterators(jts))
-        for (unsigned int k = 0; k < simd_length; ++k) {
+        for (unsigned int k = 0; k < simd_length; ++k, ++p) {
           const unsigned int column = jts[k]->column();
-          *col_ptr++ = column;
-          const std::size_t position = sparsity(column, i + k);
-          if (column < n_internal_dofs) {
-            const unsigned int my_row_length = sparsity.row_length(column);
-            const std::size_t position_diag = sparsity(column, column);
-            const std::size_t pos_within_row = position - position_diag;
-            const unsigned int simd_offset = column % simd_length;
-            *transposed_ptr++ = position - simd_offset * my_row_length -
-                                pos_within_row + simd_offset +
-                                pos_within_row * simd_length;
-          } else
-            *transposed_ptr++ = position;
+          column_indices[p] = column;
+          indices_transposed[p] = transposed_index(column, i + k);
         }
-
-      row_starts[i / simd_length + 1] = col_ptr - column_indices.data();
     }
 
     /* Rest: */
 
-    row_starts[n_internal_dofs] = row_starts[n_internal_dofs / simd_length];
-
-    for (unsigned int i = n_internal_dofs; i < sparsity.n_rows(); ++i) {
-      for (auto j = sparsity.begin(i); j != sparsity.end(i); ++j) {
+    RYUJIN_OMP_FOR
+    for (unsigned int i = n_internal_dofs; i < n_rows; ++i) {
+      std::size_t p = row_starts[i];
+      for (auto j = sparsity.begin(i); j != sparsity.end(i); ++j, ++p) {
         const unsigned int column = j->column();
-        *col_ptr++ = column;
-        const std::size_t position = sparsity(column, i);
-        if (column < n_internal_dofs) {
-          const unsigned int my_row_length = sparsity.row_length(column);
-          const std::size_t position_diag = sparsity(column, column);
-          const std::size_t pos_within_row = position - position_diag;
-          const unsigned int simd_offset = column % simd_length;
-          *transposed_ptr++ = position - simd_offset * my_row_length -
-                              pos_within_row + simd_offset +
-                              pos_within_row * simd_length;
-        } else
-          *transposed_ptr++ = position;
+        column_indices[p] = column;
+        indices_transposed[p] = transposed_index(column, i);
       }
-      row_starts[i + 1] = col_ptr - column_indices.data();
     }
 
-    Assert(col_ptr == column_indices.end(), dealii::ExcInternalError());
+    RYUJIN_PARALLEL_REGION_END
 
     /* Compute the data exchange pattern: */
 
@@ -265,6 +301,226 @@ namespace ryujin
         send_targets[p].second = entries_to_be_sent.size();
       }
     }
+
+    create_neighborhood_communicator();
+
+    max_row_group_size = 0;
+    for (unsigned int r = 0; r + 1 < row_starts.size(); ++r)
+      max_row_group_size = std::max<unsigned int>(
+          max_row_group_size, row_starts[r + 1] - row_starts[r]);
+
+    /*
+     * The columns of every row are stored with the diagonal first
+     * followed by all other columns in ascending (local) order. The
+     * columns strictly below the diagonal in all rows of a group thus
+     * form a prefix:
+     */
+    lower_prefix_lengths.assign(row_starts.size() - 1, 1);
+    contiguous_row_groups.assign(n_groups, 0);
+
+    const auto lower_prefix_length = [&](const unsigned int i) {
+      const unsigned int stride = stride_of_row(i);
+      const unsigned int length = row_length(i);
+      const unsigned int *js = columns(i);
+
+      unsigned int n = 1;
+      for (; n < length; ++n) {
+        bool lower = true;
+        for (unsigned int k = 0; k < stride; ++k)
+          lower = lower && js[n * stride + k] < i + k;
+        if (!lower)
+          break;
+      }
+      return n;
+    };
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    RYUJIN_OMP_FOR_NOWAIT
+    for (unsigned int r = 0; r < n_groups; ++r) {
+      const unsigned int i = r * simd_length;
+      lower_prefix_lengths[r] = lower_prefix_length(i);
+
+      const unsigned int length = row_length(i);
+      const unsigned int *js = columns(i);
+
+      bool contiguous = true;
+      for (unsigned int n = 0; n < length * simd_length; n += simd_length)
+        for (unsigned int k = 1; k < simd_length; ++k)
+          contiguous = contiguous && js[n + k] == js[n] + k;
+
+      contiguous_row_groups[r] = contiguous;
+    }
+
+    RYUJIN_OMP_FOR
+    for (unsigned int i = n_internal_dofs; i < n_rows; ++i)
+      lower_prefix_lengths[i] = lower_prefix_length(i);
+
+    RYUJIN_PARALLEL_REGION_END
+
+    compress_columns();
+  }
+
+
+  template <int simd_length>
+  void SparsityPatternSIMD<simd_length>::set_ghost_row_exchange(
+      const GhostRowExchange new_ghost_row_exchange)
+  {
+    if (new_ghost_row_exchange == ghost_row_exchange)
+      return;
+
+    ghost_row_exchange = new_ghost_row_exchange;
+    create_neighborhood_communicator();
+  }
+
+
+  template <int simd_length>
+  void SparsityPatternSIMD<simd_length>::set_compressed_columns(
+      const bool new_compressed_columns)
+  {
+    if (new_compressed_columns == compressed_columns)
+      return;
+
+    compressed_columns = new_compressed_columns;
+    compress_columns();
+  }
+
+
+  template <int simd_length>
+  void SparsityPatternSIMD<simd_length>::compress_columns()
+  {
+    column_deltas.clear();
+    escape_starts.clear();
+    escapes.clear();
+
+    if (!compressed_columns)
+      return;
+
+    column_deltas.resize_fast(column_indices.size());
+    escape_starts.resize_fast(row_starts.size());
+    first_touch(column_deltas.data(), column_deltas.size());
+
+    constexpr int escape = std::numeric_limits<std::int16_t>::min();
+    constexpr int max_delta = std::numeric_limits<std::int16_t>::max();
+
+    /*
+     * Encode the row (group) r. The function row_of_position returns the
+     * row index of a given position within the row (group):
+     */
+    const auto encode = [&](const unsigned int r, const auto &row_of_position) {
+      escape_starts[r] = escapes.size();
+      const std::size_t first = row_starts[r];
+      for (std::size_t p = first; p < row_starts[r + 1]; ++p) {
+        const auto delta = static_cast<long long>(column_indices[p]) -
+                           static_cast<long long>(row_of_position(p - first));
+        if (delta >= -max_delta && delta <= max_delta) {
+          column_deltas[p] = delta;
+        } else {
+          column_deltas[p] = escape;
+          escapes.emplace_back(p - first, column_indices[p]);
+        }
+      }
+    };
+
+    /* Vectorized part: */
+
+    const unsigned int n_groups = n_internal_dofs / simd_length;
+    for (unsigned int r = 0; r < n_groups; ++r)
+      encode(r, [&](const std::size_t position) {
+        return r * simd_length + position % simd_length;
+      });
+
+    /* The entries [n_groups, n_internal_dofs) are unused: */
+
+    for (unsigned int r = n_groups; r < n_internal_dofs; ++r)
+      escape_starts[r] = escapes.size();
+
+    /* Rest: */
+
+    for (unsigned int r = n_internal_dofs; r + 1 < row_starts.size(); ++r)
+      encode(r, [&](const std::size_t) { return r; });
+
+    escape_starts.back() = escapes.size();
+  }
+
+
+  template <int simd_length>
+  void SparsityPatternSIMD<simd_length>::create_neighborhood_communicator()
+  {
+    neighborhood_communicator.reset();
+
+#ifdef DEAL_II_WITH_MPI
+    if (ghost_row_exchange != GhostRowExchange::neighborhood_collective)
+      return;
+
+    std::vector<int> sources;
+    for (const auto &[rank, index] : receive_targets)
+      sources.push_back(rank);
+
+    std::vector<int> destinations;
+    for (const auto &[rank, index] : send_targets)
+      destinations.push_back(rank);
+
+    MPI_Comm communicator;
+    const int ierr = MPI_Dist_graph_create_adjacent(mpi_communicator,
+                                                    sources.size(),
+                                                    sources.data(),
+                                                    MPI_UNWEIGHTED,
+                                                    destinations.size(),
+                                                    destinations.data(),
+                                                    MPI_UNWEIGHTED,
+                                                    MPI_INFO_NULL,
+                                                    /*reorder*/ 0,
+                                                    &communicator);
+    AssertThrowMPI(ierr);
+
+    /*
+     * A neighborhood collective requires that the amount of data sent
+     * matches exactly what the receiving rank expects. Verify this once:
+     */
+
+    std::vector<int> send_sizes(send_targets.size());
+    for (unsigned int p = 0; p < send_targets.size(); ++p)
+      send_sizes[p] =
+          send_targets[p].second - (p == 0 ? 0 : send_targets[p - 1].second);
+
+    std::vector<int> announced_sizes(receive_targets.size());
+    const int ierr_sizes = MPI_Neighbor_alltoall(send_sizes.data(),
+                                                 1,
+                                                 MPI_INT,
+                                                 announced_sizes.data(),
+                                                 1,
+                                                 MPI_INT,
+                                                 communicator);
+    AssertThrowMPI(ierr_sizes);
+
+    unsigned int consistent = 1;
+    for (unsigned int p = 0; p < receive_targets.size(); ++p)
+      if (announced_sizes[p] !=
+          int(receive_targets[p].second -
+              (p == 0 ? 0 : receive_targets[p - 1].second)))
+        consistent = 0;
+
+    consistent = dealii::Utilities::MPI::min(consistent, mpi_communicator);
+    if (consistent == 0) {
+      MPI_Comm_free(&communicator);
+      AssertThrow(false,
+                  dealii::ExcMessage(
+                      "The ghost row exchange pattern is not symmetric. The "
+                      "\"neighborhood collective\" backend cannot be used, "
+                      "select \"persistent\" or \"point to point\" "
+                      "instead."));
+    }
+
+    neighborhood_communicator = std::shared_ptr<MPI_Comm>(
+        new MPI_Comm(communicator), [](MPI_Comm *comm) {
+          int finalized = 0;
+          MPI_Finalized(&finalized);
+          if (finalized == 0)
+            MPI_Comm_free(comm);
+          delete comm;
+        });
+#endif
   }
 
 
@@ -280,7 +536,8 @@ namespace ryujin
       const SparsityPatternSIMD<simd_length> &sparsity)
       : sparsity(&sparsity)
   {
-    data.resize(sparsity.n_nonzero_elements() * n_components);
+    data.resize_fast(sparsity.n_nonzero_elements() * n_components);
+    first_touch(data.data(), data.size());
   }
 
 
@@ -289,7 +546,31 @@ namespace ryujin
       const SparsityPatternSIMD<simd_length> &sparsity)
   {
     this->sparsity = &sparsity;
-    data.resize(sparsity.n_nonzero_elements() * n_components);
+    /* Allocate fresh storage so that the first touch places all pages: */
+    data.clear();
+    data.resize_fast(sparsity.n_nonzero_elements() * n_components);
+    first_touch(data.data(), data.size());
+    persistent_requests.clear();
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  void SparseMatrixSIMD<Number, n_components, simd_length>::set_zero()
+  {
+    first_touch(data.data(), data.size());
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  template <class Archive>
+  void SparseMatrixSIMD<Number, n_components, simd_length>::serialize(
+      Archive &archive, const unsigned int /*version*/)
+  {
+    const auto size = data.size();
+    archive &data;
+    AssertThrow(data.size() == size,
+                dealii::ExcMessage("Serialized matrix does not match the "
+                                   "size of the current sparsity pattern"));
   }
 
 
@@ -317,17 +598,24 @@ namespace ryujin
       for (unsigned int col_idx = 0; col_idx < row_length;
            ++col_idx, js += simd_length) {
 
-        dealii::Tensor<1, n_components, VectorizedArray> temp;
-        for (unsigned int k = 0; k < simd_length; ++k)
+        /*
+         * Note: We write entries lane by lane so that the storage type
+         * Number is not required to have a vectorized counterpart of
+         * width simd_length (for example, single precision storage for a
+         * double precision sparsity pattern).
+         */
+        for (unsigned int k = 0; k < simd_length; ++k) {
+          dealii::Tensor<1, n_components, Number> temp;
           for (unsigned int d = 0; d < n_components; ++d)
             if (locally_indexed)
-              temp[d][k] = sparse_matrix[d](i + k, js[k]);
+              temp[d] = sparse_matrix[d](i + k, js[k]);
             else
-              temp[d][k] = sparse_matrix[d].el(
+              temp[d] = sparse_matrix[d].el(
                   sparsity->partitioner->local_to_global(i + k),
                   sparsity->partitioner->local_to_global(js[k]));
 
-        write_entry(temp, i, col_idx, true);
+          write_entry(temp, i + k, col_idx);
+        }
       }
     }
 
@@ -378,16 +666,16 @@ namespace ryujin
       for (unsigned int col_idx = 0; col_idx < row_length;
            ++col_idx, js += simd_length) {
 
-        VectorizedArray temp = {};
-        for (unsigned int k = 0; k < simd_length; ++k)
-          if (locally_indexed)
-            temp[k] = sparse_matrix(i + k, js[k]);
-          else
-            temp[k] =
-                sparse_matrix.el(sparsity->partitioner->local_to_global(i + k),
-                                 sparsity->partitioner->local_to_global(js[k]));
-
-        write_entry(temp, i, col_idx, true);
+        /* Write entries lane by lane, see above: */
+        for (unsigned int k = 0; k < simd_length; ++k) {
+          const Number temp =
+              locally_indexed
+                  ? sparse_matrix(i + k, js[k])
+                  : sparse_matrix.el(
+                        sparsity->partitioner->local_to_global(i + k),
+                        sparsity->partitioner->local_to_global(js[k]));
+          write_entry(temp, i + k, col_idx);
+        }
       }
     }
 
@@ -68,8 +68,10 @@ namespace ryujin
         const OfflineData<dim, Number> &offline_data)
     {
       auto &[U, precomputed, V] = state_vector;
-      U.reinit(offline_data.hyperbolic_vector_partitioner());
-      precomputed.reinit(offline_data.precomputed_vector_partitioner());
+      const auto comm_sm = offline_data.shared_memory_communicator();
+      U.reinit(offline_data.hyperbolic_vector_partitioner(), comm_sm);
+      precomputed.reinit(offline_data.precomputed_vector_partitioner(),
+                         comm_sm);
     }
   } // namespace Vectors
 
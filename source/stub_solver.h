@@ -10,6 +10,7 @@
 
 #include <initial_values.h>
 #include <offline_data.h>
+#include <scope.h>
 
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/timer.h>
@@ -37,7 +38,7 @@ namespace ryujin
      */
     StubSolver(
         const MPI_Comm & /*mpi_communicator*/,
-        std::map<std::string, dealii::Timer> & /*computing_timer*/,
+        std::map<std::string, SectionTimer> & /*computing_timer*/,
         const HyperbolicSystem & /*hyperbolic_system*/,
         const ParabolicSystem & /*parabolic_system*/,
         const OfflineData<dim, Number> & /*offline_data*/,
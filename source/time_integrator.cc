@@ -13,4 +13,10 @@ namespace ryujin
   template class TimeIntegrator<Description, 2, NUMBER>;
   template class TimeIntegrator<Description, 3, NUMBER>;
 
+#ifdef RUNTIME_PRECISION
+  template class TimeIntegrator<Description, 1, ALTERNATIVE_NUMBER>;
+  template class TimeIntegrator<Description, 2, ALTERNATIVE_NUMBER>;
+  template class TimeIntegrator<Description, 3, ALTERNATIVE_NUMBER>;
+#endif
+
 } /* namespace ryujin */
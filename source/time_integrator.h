@@ -36,6 +36,17 @@ namespace ryujin
      * warning is emitted.
      */
     bang_bang_control,
+
+    /**
+     * Additive increase, multiplicative decrease control of the CFL
+     * number: every accepted time step raises the current CFL number by
+     * "cfl increase" (up to "cfl max"). In case an invariant domain and
+     * or CFL condition violation is detected the current CFL number is
+     * multiplied by "cfl decrease" (down to "cfl min") and the time step
+     * is repeated. If the violation persists with "cfl min" a warning is
+     * emitted.
+     */
+    adaptive_control,
   };
 
 
@@ -73,6 +84,39 @@ namespace ryujin
      */
     ssprk_33,
 
+    /**
+     * The ten stage, fourth-order strong stability preserving Runge Kutta
+     * method SSPRK(10,4;1/6) of @cite Ketcheson2008 with an SSP
+     * coefficient of 6. The method is implemented in its low-storage
+     * Shu-Osher form as a sequence of forward Euler steps and convex
+     * combinations and only needs three temporary state vectors
+     * irrespective of the number of stages.
+     */
+    ssprk_104,
+
+    /**
+     * The four stage, third-order strong stability preserving Runge Kutta
+     * method SSPRK(4,3;1/2) of @cite Ketcheson2008 with an SSP
+     * coefficient of 2. This is the member n = 2 of the SSPRK(n^2,3)
+     * family, see step_ssprk_n2_3().
+     */
+    ssprk_43,
+
+    /**
+     * The nine stage, third-order strong stability preserving Runge Kutta
+     * method SSPRK(9,3;1/6) of @cite Ketcheson2008 with an SSP
+     * coefficient of 6, i.e., the member n = 3 of the SSPRK(n^2,3) family.
+     */
+    ssprk_93,
+
+    /**
+     * The sixteen stage, third-order strong stability preserving Runge
+     * Kutta method SSPRK(16,3;1/12) of @cite Ketcheson2008 with an SSP
+     * coefficient of 12, i.e., the member n = 4 of the SSPRK(n^2,3)
+     * family.
+     */
+    ssprk_163,
+
     /**
      * The explicit Runge-Kutta method RK(1,1;1), aka a simple, forward
      * Euler step.
@@ -126,9 +170,19 @@ namespace ryujin
      */
     erk_54,
 
+    /**
+     * The explicit Runge-Kutta method RK(5,4;1) combined with an embedded
+     * third-order error estimate and a PI step-size controller. The
+     * time-step size is chosen as the minimum of the CFL-limited and the
+     * error-controlled step size.
+     */
+    erk_54_adaptive,
+
     /**
      * A Strang split using ssprk 33 for the hyperbolic subproblem and
-     * Crank-Nicolson for the parabolic subproblem
+     * Crank-Nicolson for the parabolic subproblem. All Strang split
+     * schemes perform "strang substeps" explicit hyperbolic steps
+     * before and after every parabolic solve (multirate splitting).
      */
     strang_ssprk_33_cn,
 
@@ -210,17 +264,24 @@ namespace ryujin
 DECLARE_ENUM(ryujin::CFLRecoveryStrategy,
              LIST({ryujin::CFLRecoveryStrategy::none, "none"},
                   {ryujin::CFLRecoveryStrategy::bang_bang_control,
-                   "bang bang control"}));
+                   "bang bang control"},
+                  {ryujin::CFLRecoveryStrategy::adaptive_control,
+                   "adaptive control"}));
 
 DECLARE_ENUM(
     ryujin::TimeSteppingScheme,
     LIST({ryujin::TimeSteppingScheme::ssprk_22, "ssprk 22"},
          {ryujin::TimeSteppingScheme::ssprk_33, "ssprk 33"},
+         {ryujin::TimeSteppingScheme::ssprk_104, "ssprk 104"},
+         {ryujin::TimeSteppingScheme::ssprk_43, "ssprk 43"},
+         {ryujin::TimeSteppingScheme::ssprk_93, "ssprk 93"},
+         {ryujin::TimeSteppingScheme::ssprk_163, "ssprk 163"},
          {ryujin::TimeSteppingScheme::erk_11, "erk 11"},
          {ryujin::TimeSteppingScheme::erk_22, "erk 22"},
          {ryujin::TimeSteppingScheme::erk_33, "erk 33"},
          {ryujin::TimeSteppingScheme::erk_43, "erk 43"},
          {ryujin::TimeSteppingScheme::erk_54, "erk 54"},
+         {ryujin::TimeSteppingScheme::erk_54_adaptive, "erk 54 adaptive"},
          {ryujin::TimeSteppingScheme::strang_ssprk_33_cn, "strang ssprk 33 cn"},
          {ryujin::TimeSteppingScheme::strang_erk_33_cn, "strang erk 33 cn"},
          {ryujin::TimeSteppingScheme::strang_erk_43_cn, "strang erk 43 cn"},
@@ -255,6 +316,8 @@ namespace ryujin
 
     using StateVector = typename View::StateVector;
 
+    using PrecomputedVector = typename View::PrecomputedVector;
+
     //@}
     /**
      * @name Constructor and setup
@@ -278,6 +341,13 @@ namespace ryujin
      */
     void prepare();
 
+    /**
+     * Return an estimate of the (rank-local) memory consumption in bytes
+     * of the temporary state vectors and precomputed values allocated by
+     * prepare().
+     */
+    std::size_t memory_consumption() const;
+
     //@}
     /**
      * @name Functions for performing explicit time steps
@@ -306,15 +376,65 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(time_stepping_scheme);
 
+    /**
+     * The selected CFL recovery strategy.
+     */
+    ACCESSOR_READ_ONLY(cfl_recovery_strategy);
+
     /**
      * The eficiency of the selected time-stepping scheme expressed as the
      * ratio of step size of the combined method to step size of an
      * elementary forward Euler step. For example, SSPRK33 has an
-     * efficiency ratio of 1 whereas ERK33 has an efficiency ratio of 3.
+     * efficiency ratio of 1 whereas ERK33 has an efficiency ratio of 3
+     * and SSPRK104 an efficiency ratio of 6.
      */
     ACCESSOR_READ_ONLY(efficiency);
 
+    /**
+     * The number of time steps that had to be restarted because of an
+     * invariant domain or CFL violation since the last call to prepare().
+     */
+    ACCESSOR_READ_ONLY(n_restarts);
+
+    /**
+     * The number of hyperbolic stage evaluations that have been discarded
+     * due to restarts since the last call to prepare().
+     */
+    ACCESSOR_READ_ONLY(n_wasted_stages);
+
+    /**
+     * The CFL number the next time step starts with. This is "cfl max"
+     * for all recovery strategies except adaptive control.
+     */
+    ACCESSOR_READ_ONLY(cfl_current);
+
   protected:
+    /**
+     * Calls HyperbolicModule::prepare_state_vector() on the old state
+     * vector at the beginning of a time step. When repeating a time step
+     * after a restart the call is skipped because the old state vector has
+     * already been prepared for the same time t.
+     */
+    void prepare_old_state_vector(StateVector &state_vector, Number t);
+
+    /**
+     * Calls HyperbolicModule::prepare_state_vector() on the temporary
+     * stage vector @p stage_vector. The precomputed values of the
+     * temporary stage vectors are only attached on demand: If
+     * @p stage_vector has currently no precomputed block a vector is
+     * taken from the pool of released blocks (or newly allocated).
+     */
+    void prepare_stage_state_vector(StateVector &stage_vector, Number t);
+
+    /**
+     * Detaches the precomputed block from the temporary stage vector
+     * @p stage_vector and returns it to the pool. This must only be called
+     * once no later stage refers to the precomputed values of
+     * @p stage_vector, which is the case for all schemes that consist of
+     * forward Euler substeps and convex combinations only.
+     */
+    void release_precomputed_values(StateVector &stage_vector);
+
     /**
      * Given a reference to a previous state vector U performs an explicit
      * second-order strong-stability preserving Runge-Kutta SSPRK(2,2;1/2)
@@ -333,6 +453,29 @@ namespace ryujin
      */
     Number step_ssprk_33(StateVector &state_vector, Number t, Number tau_max);
 
+    /**
+     * Given a reference to a previous state vector U performs an explicit
+     * fourth-order strong-stability preserving Runge-Kutta
+     * SSPRK(10,4;1/6) time step (and store the result in U). The function
+     * returns the chosen time step size tau, which is guaranteed to be
+     * less than or equal to the parameter @p tau_max.
+     */
+    Number step_ssprk_104(StateVector &state_vector, Number t, Number tau_max);
+
+    /**
+     * Given a reference to a previous state vector U performs an explicit
+     * third-order strong-stability preserving Runge-Kutta
+     * SSPRK(n^2,3;1/(n^2-n)) time step (and store the result in U). The
+     * method consists of n^2 forward Euler substeps and has an SSP
+     * coefficient of n^2 - n. The function returns the chosen time step
+     * size tau, which is guaranteed to be less than or equal to the
+     * parameter @p tau_max.
+     */
+    Number step_ssprk_n2_3(StateVector &state_vector,
+                           Number t,
+                           Number tau_max,
+                           const unsigned int n);
+
     /**
      * Given a reference to a previous state vector U performs an explicit
      * first-order Euler step ERK(1,1;1) time step (and store the result
@@ -375,6 +518,21 @@ namespace ryujin
      */
     Number step_erk_54(StateVector &state_vector, Number t, Number tau_max);
 
+    /**
+     * Given a reference to a previous state vector U performs an explicit
+     * ERK(5,4;1) time step with a time-step size bounded by the current
+     * error-controlled step size. Afterwards, an embedded third-order
+     * error estimate is formed from the stored stages and the
+     * error-controlled step size for the next step is updated with a PI
+     * controller. A step with a normalized error larger than one is
+     * rejected and repeated from the old state with a reduced step size
+     * (counted as a restart). The function returns the chosen time step
+     * size tau.
+     */
+    Number step_erk_54_adaptive(StateVector &state_vector,
+                                Number t,
+                                Number tau_max);
+
     /**
      * Given a reference to a previous state vector U performs a combined
      * explicit implicit Strang split using a third-order Runge-Kutta
@@ -442,10 +600,16 @@ namespace ryujin
     Number cfl_max_;
 
     CFLRecoveryStrategy cfl_recovery_strategy_;
+    Number cfl_increase_;
+    Number cfl_decrease_;
 
     TimeSteppingScheme time_stepping_scheme_;
+    unsigned int strang_substeps_;
     double efficiency_;
 
+    Number adaptive_relative_tolerance_;
+    Number adaptive_absolute_tolerance_;
+
     //@}
 
     //@}
@@ -463,6 +627,16 @@ namespace ryujin
         parabolic_module_;
 
     std::vector<StateVector> temp_;
+    std::vector<PrecomputedVector> precomputed_pool_;
+
+    Number tau_error_;
+    Number error_old_;
+
+    bool old_state_prepared_;
+    unsigned int n_restarts_;
+    unsigned int n_wasted_stages_;
+
+    Number cfl_current_;
 
     //@}
   };
@@ -25,6 +25,36 @@ namespace ryujin
   }
 
 
+  /**
+   * Swap the U and parabolic components of @p a and @p b. The precomputed
+   * values stay in place: They are recomputed for the new state anyway,
+   * and the (old) state vector has to keep its precomputed block.
+   */
+  template <typename StateVector>
+  void swap_states(StateVector &a, StateVector &b)
+  {
+    std::get<0>(a).swap(std::get<0>(b));
+    std::get<2>(a).swap(std::get<2>(b));
+  }
+
+
+  /**
+   * Set the U component of @p dst to the linear combination
+   * a * src_a + b * src_b.
+   */
+  template <typename StateVector, typename Number>
+  void equ(StateVector &dst,
+           const Number a,
+           const StateVector &src_a,
+           const Number b,
+           const StateVector &src_b)
+  {
+    auto &dst_U = std::get<0>(dst);
+    dst_U.equ(a, std::get<0>(src_a));
+    dst_U.add(b, std::get<0>(src_b));
+  }
+
+
   template <typename Description, int dim, typename Number>
   TimeIntegrator<Description, dim, Number>::TimeIntegrator(
       const MPI_Comm &mpi_communicator,
@@ -56,7 +86,19 @@ namespace ryujin
     add_parameter("cfl recovery strategy",
                   cfl_recovery_strategy_,
                   "CFL/invariant domain violation recovery strategy: none, "
-                  "bang bang control");
+                  "bang bang control, adaptive control");
+
+    cfl_increase_ = Number(0.01);
+    add_parameter("cfl increase",
+                  cfl_increase_,
+                  "Adaptive control: additive increase of the CFL number "
+                  "after every accepted time step");
+
+    cfl_decrease_ = Number(0.80);
+    add_parameter("cfl decrease",
+                  cfl_decrease_,
+                  "Adaptive control: multiplicative decrease of the CFL "
+                  "number after every detected violation");
 
     if (ParabolicSystem::is_identity)
       time_stepping_scheme_ = TimeSteppingScheme::erk_33;
@@ -64,10 +106,29 @@ namespace ryujin
       time_stepping_scheme_ = TimeSteppingScheme::strang_erk_33_cn;
     add_parameter("time stepping scheme",
                   time_stepping_scheme_,
-                  "Time stepping scheme: ssprk 22, ssprk 33, erk 11, erk 22, "
-                  "erk 33, erk 43, erk "
-                  "54, strang ssprk 33 cn, strang erk 33 cn, strang erk 43 cn, "
-                  "imex 11, imex 22, imex 33");
+                  "Time stepping scheme: ssprk 22, ssprk 33, ssprk 104, ssprk "
+                  "43, ssprk 93, ssprk 163, erk 11, erk 22, erk 33, erk 43, "
+                  "erk 54, erk 54 adaptive, strang ssprk 33 cn, strang erk 33 "
+                  "cn, strang erk 43 cn, imex 11, imex 22, imex 33");
+
+    strang_substeps_ = 1;
+    add_parameter("strang substeps",
+                  strang_substeps_,
+                  "Strang split schemes: number of explicit hyperbolic "
+                  "substeps performed before and after every Crank-Nicolson "
+                  "solve of the parabolic subproblem");
+
+    adaptive_relative_tolerance_ = Number(1.e-4);
+    add_parameter("adaptive relative tolerance",
+                  adaptive_relative_tolerance_,
+                  "Relative tolerance for the embedded error estimate of the "
+                  "\"erk 54 adaptive\" time stepping scheme");
+
+    adaptive_absolute_tolerance_ = Number(1.e-8);
+    add_parameter("adaptive absolute tolerance",
+                  adaptive_absolute_tolerance_,
+                  "Absolute tolerance for the embedded error estimate of the "
+                  "\"erk 54 adaptive\" time stepping scheme");
   }
 
 
@@ -89,6 +150,22 @@ namespace ryujin
       temp_.resize(2);
       efficiency_ = 1.;
       break;
+    case TimeSteppingScheme::ssprk_104:
+      temp_.resize(3);
+      efficiency_ = 6.;
+      break;
+    case TimeSteppingScheme::ssprk_43:
+      temp_.resize(2);
+      efficiency_ = 2.;
+      break;
+    case TimeSteppingScheme::ssprk_93:
+      temp_.resize(3);
+      efficiency_ = 6.;
+      break;
+    case TimeSteppingScheme::ssprk_163:
+      temp_.resize(3);
+      efficiency_ = 12.;
+      break;
     case TimeSteppingScheme::erk_11:
       temp_.resize(1);
       efficiency_ = 1.;
@@ -109,17 +186,21 @@ namespace ryujin
       temp_.resize(5);
       efficiency_ = 5.;
       break;
+    case TimeSteppingScheme::erk_54_adaptive:
+      temp_.resize(6);
+      efficiency_ = 5.;
+      break;
     case TimeSteppingScheme::strang_ssprk_33_cn:
       temp_.resize(3);
-      efficiency_ = 2.;
+      efficiency_ = 2. * strang_substeps_;
       break;
     case TimeSteppingScheme::strang_erk_33_cn:
       temp_.resize(4);
-      efficiency_ = 6.;
+      efficiency_ = 6. * strang_substeps_;
       break;
     case TimeSteppingScheme::strang_erk_43_cn:
       temp_.resize(4);
-      efficiency_ = 8.;
+      efficiency_ = 8. * strang_substeps_;
       break;
     case TimeSteppingScheme::imex_11:
       temp_.resize(2);
@@ -135,10 +216,18 @@ namespace ryujin
       break;
     }
 
-    /* Initialize temporary vectors: */
+    /*
+     * Initialize temporary vectors. The precomputed values are attached
+     * on demand by prepare_stage_state_vector():
+     */
 
+    precomputed_pool_.clear();
     for (auto &it : temp_) {
-      Vectors::reinit_state_vector<Description>(it, *offline_data_);
+      auto &[U, precomputed, V] = it;
+      U.reinit(offline_data_->hyperbolic_vector_partitioner(),
+               offline_data_->shared_memory_communicator());
+      PrecomputedVector empty;
+      precomputed.swap(empty);
     }
 
     /* Reset CFL to canonical starting value: */
@@ -146,9 +235,28 @@ namespace ryujin
     AssertThrow(cfl_min_ > 0., ExcMessage("cfl min must be a positive value"));
     AssertThrow(cfl_max_ >= cfl_min_,
                 ExcMessage("cfl max must be greater than or equal to cfl min"));
+    AssertThrow(strang_substeps_ >= 1,
+                ExcMessage("strang substeps must be at least one"));
+    AssertThrow(cfl_increase_ >= 0.,
+                ExcMessage("cfl increase must be a non-negative value"));
+    AssertThrow(cfl_decrease_ > 0. && cfl_decrease_ < 1.,
+                ExcMessage("cfl decrease must lie in the interval (0, 1)"));
 
     hyperbolic_module_->cfl(cfl_max_);
 
+    /* Reset the step-size controller: */
+
+    tau_error_ = std::numeric_limits<Number>::max();
+    error_old_ = Number(1.);
+
+    /* Reset restart statistics: */
+
+    old_state_prepared_ = false;
+    n_restarts_ = 0;
+    n_wasted_stages_ = 0;
+
+    cfl_current_ = cfl_max_;
+
     const auto check_whether_timestepping_makes_sense = [&]() {
       /*
        * Make sure the user selects an appropriate time-stepping scheme.
@@ -159,6 +267,14 @@ namespace ryujin
         [[fallthrough]];
       case TimeSteppingScheme::ssprk_33:
         [[fallthrough]];
+      case TimeSteppingScheme::ssprk_104:
+        [[fallthrough]];
+      case TimeSteppingScheme::ssprk_43:
+        [[fallthrough]];
+      case TimeSteppingScheme::ssprk_93:
+        [[fallthrough]];
+      case TimeSteppingScheme::ssprk_163:
+        [[fallthrough]];
       case TimeSteppingScheme::erk_11:
         [[fallthrough]];
       case TimeSteppingScheme::erk_22:
@@ -167,7 +283,9 @@ namespace ryujin
         [[fallthrough]];
       case TimeSteppingScheme::erk_43:
         [[fallthrough]];
-      case TimeSteppingScheme::erk_54: {
+      case TimeSteppingScheme::erk_54:
+        [[fallthrough]];
+      case TimeSteppingScheme::erk_54_adaptive: {
         AssertThrow(
             ParabolicSystem::is_identity,
             dealii::ExcMessage(
@@ -220,6 +338,14 @@ namespace ryujin
         return step_ssprk_22(state_vector, t, tau_max);
       case TimeSteppingScheme::ssprk_33:
         return step_ssprk_33(state_vector, t, tau_max);
+      case TimeSteppingScheme::ssprk_104:
+        return step_ssprk_104(state_vector, t, tau_max);
+      case TimeSteppingScheme::ssprk_43:
+        return step_ssprk_n2_3(state_vector, t, tau_max, 2);
+      case TimeSteppingScheme::ssprk_93:
+        return step_ssprk_n2_3(state_vector, t, tau_max, 3);
+      case TimeSteppingScheme::ssprk_163:
+        return step_ssprk_n2_3(state_vector, t, tau_max, 4);
       case TimeSteppingScheme::erk_11:
         return step_erk_11(state_vector, t, tau_max);
       case TimeSteppingScheme::erk_22:
@@ -230,6 +356,8 @@ namespace ryujin
         return step_erk_43(state_vector, t, tau_max);
       case TimeSteppingScheme::erk_54:
         return step_erk_54(state_vector, t, tau_max);
+      case TimeSteppingScheme::erk_54_adaptive:
+        return step_erk_54_adaptive(state_vector, t, tau_max);
       case TimeSteppingScheme::strang_ssprk_33_cn:
         return step_strang_ssprk_33_cn(state_vector, t, tau_max);
       case TimeSteppingScheme::strang_erk_33_cn:
@@ -247,31 +375,155 @@ namespace ryujin
       }
     };
 
-    if (cfl_recovery_strategy_ == CFLRecoveryStrategy::bang_bang_control) {
+    if (cfl_recovery_strategy_ != CFLRecoveryStrategy::none) {
       hyperbolic_module_->id_violation_strategy_ =
           IDViolationStrategy::raise_exception;
       parabolic_module_->id_violation_strategy_ =
           IDViolationStrategy::raise_exception;
-      hyperbolic_module_->cfl(cfl_max_);
     }
 
+    /*
+     * Every step starts with the maximal CFL number (or the current CFL
+     * number of the adaptive controller). The hyperbolic module might be
+     * shared with a second time integrator (for example the coarse
+     * propagator of the parallel in time mode) that uses a different CFL
+     * number:
+     */
+    const bool adaptive_control =
+        cfl_recovery_strategy_ == CFLRecoveryStrategy::adaptive_control;
+    hyperbolic_module_->cfl(adaptive_control ? cfl_current_ : cfl_max_);
+
+    /*
+     * Apply source terms that are treated with an operator split (if
+     * any) with a pointwise implicit update over the full step size:
+     */
+    const auto split_source_terms = [&](const Number tau) {
+      hyperbolic_module_->apply_split_source_terms(state_vector, tau);
+      return tau;
+    };
+
+    auto n_stages_before = hyperbolic_module_->n_steps();
+    old_state_prepared_ = false;
+
     try {
-      return single_step();
+      const Number tau = split_source_terms(single_step());
+      if (adaptive_control)
+        cfl_current_ = std::min(cfl_max_, cfl_current_ + cfl_increase_);
+      return tau;
 
     } catch (Restart) {
 
       AssertThrow(cfl_recovery_strategy_ != CFLRecoveryStrategy::none,
                   dealii::ExcInternalError());
 
+      /*
+       * The restart is raised at the end of the offending stage and the
+       * old state vector is left untouched by all schemes. We can thus
+       * reuse the boundary conditions and precomputed values that have
+       * been set up for it and only recompute the stages with the
+       * smaller time-step size.
+       */
+      n_restarts_++;
+      n_wasted_stages_ += hyperbolic_module_->n_steps() - n_stages_before;
+      old_state_prepared_ = true;
+
       if (cfl_recovery_strategy_ == CFLRecoveryStrategy::bang_bang_control) {
         hyperbolic_module_->id_violation_strategy_ = IDViolationStrategy::warn;
         parabolic_module_->id_violation_strategy_ = IDViolationStrategy::warn;
         hyperbolic_module_->cfl(cfl_min_);
-        return single_step();
+        return split_source_terms(single_step());
+      }
+
+      /*
+       * Adaptive control: decrease the CFL number multiplicatively and
+       * repeat the step until it succeeds. The last attempt with "cfl
+       * min" only emits warnings.
+       */
+      while (true) {
+        cfl_current_ = std::max(cfl_min_, cfl_current_ * cfl_decrease_);
+        if (cfl_current_ == cfl_min_) {
+          hyperbolic_module_->id_violation_strategy_ =
+              IDViolationStrategy::warn;
+          parabolic_module_->id_violation_strategy_ =
+              IDViolationStrategy::warn;
+        }
+        hyperbolic_module_->cfl(cfl_current_);
+
+        n_stages_before = hyperbolic_module_->n_steps();
+        try {
+          return split_source_terms(single_step());
+        } catch (Restart) {
+          n_restarts_++;
+          n_wasted_stages_ += hyperbolic_module_->n_steps() - n_stages_before;
+        }
       }
+    }
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  std::size_t
+  TimeIntegrator<Description, dim, Number>::memory_consumption() const
+  {
+    std::size_t result = 0;
+
+    for (const auto &[U, precomputed, V] : temp_) {
+      result += U.memory_consumption();
+      result += precomputed.memory_consumption();
+      result += V.memory_consumption();
+    }
+
+    for (const auto &it : precomputed_pool_)
+      result += it.memory_consumption();
+
+    return result;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeIntegrator<Description, dim, Number>::prepare_old_state_vector(
+      StateVector &state_vector, Number t)
+  {
+    if (old_state_prepared_)
+      return;
 
-      __builtin_unreachable();
+    hyperbolic_module_->prepare_state_vector(state_vector, t);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeIntegrator<Description, dim, Number>::prepare_stage_state_vector(
+      StateVector &stage_vector, Number t)
+  {
+    auto &precomputed = std::get<1>(stage_vector);
+
+    if constexpr (View::n_precomputed_values > 0) {
+      if (precomputed.size() == 0) {
+        if (precomputed_pool_.empty()) {
+          precomputed.reinit(offline_data_->precomputed_vector_partitioner(),
+                             offline_data_->shared_memory_communicator());
+        } else {
+          precomputed.swap(precomputed_pool_.back());
+          precomputed_pool_.pop_back();
+        }
+      }
     }
+
+    hyperbolic_module_->prepare_state_vector(stage_vector, t);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeIntegrator<Description, dim, Number>::release_precomputed_values(
+      StateVector &stage_vector)
+  {
+    auto &precomputed = std::get<1>(stage_vector);
+
+    if (precomputed.size() == 0)
+      return;
+
+    precomputed_pool_.emplace_back();
+    precomputed_pool_.back().swap(precomputed);
   }
 
 
@@ -282,18 +534,19 @@ namespace ryujin
     /* SSP-RK2, see @cite Shu1988, Eq. 2.15. */
 
     /* Step 1: T0 = U_old + tau * L(U_old) at t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max);
 
     /* Step 2: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+    release_precomputed_values(temp_[0]);
 
     /* Step 2: convex combination: T1 = 1/2 U_old + 1/2 T1 at time t + tau */
     sadd(temp_[1], Number(1.0 / 2.0), Number(1.0 / 2.0), state_vector);
 
-    state_vector.swap(temp_[1]);
+    swap_states(state_vector, temp_[1]);
     return tau;
   }
 
@@ -305,29 +558,158 @@ namespace ryujin
     /* SSP-RK3, see @cite Shu1988, Eq. 2.18. */
 
     /* Step 1: T0 = U_old + tau * L(U_old) at time t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max);
 
     /* Step 2: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+    release_precomputed_values(temp_[0]);
 
     /* Step 2: convex combination T1 = 3/4 U_old + 1/4 T1 at time t + 0.5*tau */
     sadd(temp_[1], Number(1.0 / 4.0), Number(3.0 / 4.0), state_vector);
 
     /* Step 3: T0 = T1 + tau L(T1) at time t + 0.5*tau -> t + 1.5*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 0.5 * tau);
+    prepare_stage_state_vector(temp_[1], t + 0.5 * tau);
     hyperbolic_module_->template step<0>(temp_[1], {}, {}, temp_[0], tau);
+    release_precomputed_values(temp_[1]);
 
     /* Step 3: convex combination: T0 = 1/3 U_old + 2/3 T0 at time t + tau */
     sadd(temp_[0], Number(2.0 / 3.0), Number(1.0 / 3.0), state_vector);
 
-    state_vector.swap(temp_[0]);
+    swap_states(state_vector, temp_[0]);
     return tau;
   }
 
 
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_ssprk_104(
+      StateVector &state_vector, Number t, Number tau_max)
+  {
+    /*
+     * SSP-RK(10,4), see @cite Ketcheson2008. Every stage is a forward
+     * Euler step of size tau = dt / 6 that ping-pongs between T0 and T1.
+     * The combination of the fifth stage and U_old that is
+     * needed for the final stage is kept in T2. Instead of forming
+     * 15 T2 - 5 T0 as in the reference we use the equivalent convex
+     * combination 3/5 U_old + 2/5 T0.
+     */
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_ssprk_104()" << std::endl;
+#endif
+
+    /* Step 1: T0 = U_old + tau * L(U_old) at time t -> t + tau */
+    prepare_old_state_vector(state_vector, t);
+    Number tau = hyperbolic_module_->template step<0>(
+        state_vector, {}, {}, temp_[0], Number(0.), tau_max / 6.);
+
+    /* Steps 2 - 5: forward Euler steps at time t + tau -> t + 5*tau */
+    for (unsigned int s = 1; s < 5; ++s) {
+      auto &src = temp_[(s + 1) % 2];
+      auto &dst = temp_[s % 2];
+      prepare_stage_state_vector(src, t + s * tau);
+      hyperbolic_module_->template step<0>(src, {}, {}, dst, tau);
+      release_precomputed_values(src);
+    }
+
+    /* T2 = 1/25 U_old + 9/25 T0 */
+    equ(temp_[2], Number(9. / 25.), temp_[0], Number(1. / 25.), state_vector);
+
+    /* Convex combination: T0 = 3/5 U_old + 2/5 T0 at time t + 2*tau */
+    sadd(temp_[0], Number(2. / 5.), Number(3. / 5.), state_vector);
+
+    /* Steps 6 - 9: forward Euler steps at time t + 2*tau -> t + 6*tau */
+    for (unsigned int s = 0; s < 4; ++s) {
+      auto &src = temp_[s % 2];
+      auto &dst = temp_[(s + 1) % 2];
+      prepare_stage_state_vector(src, t + (2. + s) * tau);
+      hyperbolic_module_->template step<0>(src, {}, {}, dst, tau);
+      release_precomputed_values(src);
+    }
+
+    /* Step 10: T1 = T0 + tau L(T0) at time t + 6*tau */
+    prepare_stage_state_vector(temp_[0], t + 6. * tau);
+    hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+    release_precomputed_values(temp_[0]);
+
+    /* Convex combination: T1 = T2 + 3/5 T1 at time t + 6*tau */
+    sadd(temp_[1], Number(3. / 5.), Number(1.), temp_[2]);
+
+    swap_states(state_vector, temp_[1]);
+    return 6. * tau;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_ssprk_n2_3(
+      StateVector &state_vector,
+      Number t,
+      Number tau_max,
+      const unsigned int n)
+  {
+    /*
+     * SSP-RK(n^2,3), see @cite Ketcheson2008. All stages are forward
+     * Euler steps of size tau = dt / (n^2 - n) that ping-pong between T0
+     * and T1. After stage (n-1)(n-2)/2 the current stage is saved in T2
+     * (for n = 2 this is U_old itself) and after stage n(n+1)/2 the
+     * current stage is replaced by the convex combination
+     *   (n T2 + (n-1) T) / (2n - 1).
+     */
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_ssprk_n2_3()" << std::endl;
+#endif
+
+    Assert(n >= 2 && temp_.size() >= (n == 2 ? 2 : 3),
+           dealii::ExcInternalError());
+
+    const unsigned int n_stages = n * n;
+    const unsigned int m_1 = (n - 1) * (n - 2) / 2;
+    const unsigned int m_2 = n * (n + 1) / 2;
+
+    /* Stage 1: T0 = U_old + tau * L(U_old) at time t -> t + tau */
+    prepare_old_state_vector(state_vector, t);
+    Number tau = hyperbolic_module_->template step<0>(
+        state_vector, {}, {}, temp_[0], Number(0.), tau_max / (n_stages - n));
+
+    /* The time of the current stage in multiples of tau: */
+    unsigned int k = 1;
+
+    const StateVector *saved_stage = &state_vector;
+
+    for (unsigned int stage = 1; stage <= n_stages; ++stage) {
+      auto &current = temp_[(stage - 1) % 2];
+
+      if (stage > 1) {
+        auto &src = temp_[stage % 2];
+        prepare_stage_state_vector(src, t + k * tau);
+        hyperbolic_module_->template step<0>(src, {}, {}, current, tau);
+        release_precomputed_values(src);
+        ++k;
+      }
+
+      if (stage == m_1) {
+        std::get<0>(temp_[2]) = std::get<0>(current);
+        saved_stage = &temp_[2];
+      }
+
+      if (stage == m_2) {
+        /* Convex combination at time t + (n^2 - n) / 2 * tau */
+        sadd(current,
+             Number(n - 1.) / Number(2. * n - 1.),
+             Number(n) / Number(2. * n - 1.),
+             *saved_stage);
+        k = (n * n - n) / 2;
+      }
+    }
+
+    swap_states(state_vector, temp_[(n_stages - 1) % 2]);
+    return (n_stages - n) * tau;
+  }
+
+
   template <typename Description, int dim, typename Number>
   Number TimeIntegrator<Description, dim, Number>::step_erk_11(
       StateVector &state_vector, Number t, Number tau_max)
@@ -337,11 +719,11 @@ namespace ryujin
 #endif
 
     /* Step 1: T0 <- {U_old, 1} at time t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max);
 
-    state_vector.swap(temp_[0]);
+    swap_states(state_vector, temp_[0]);
     return tau;
   }
 
@@ -355,16 +737,16 @@ namespace ryujin
 #endif
 
     /* Step 1: T0 <- {U_old, 1} at time t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(.0), tau_max / 2.);
 
     /* Step 2: T1 <- {T0, 2} and {U_old, -1} at time t + tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
-    state_vector.swap(temp_[1]);
+    swap_states(state_vector, temp_[1]);
     return 2. * tau;
   }
 
@@ -378,12 +760,12 @@ namespace ryujin
 #endif
 
     /* Step 1: T0 <- {U_old, 1} at time t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max / 3.);
 
     /* Step 2: T1 <- {T0, 2} and {U_old, -1} at time t + 1*tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
@@ -391,14 +773,14 @@ namespace ryujin
      * Step 3: T2 <- {T1, 9/4} and {T0, -2} and {U_old, 3/4}
      * at time t + 2*tau -> t + 3*tau
      */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<2>(temp_[1],
                                          {{state_vector, temp_[0]}},
                                          {{Number(0.75), Number(-2.)}},
                                          temp_[2],
                                          tau);
 
-    state_vector.swap(temp_[2]);
+    swap_states(state_vector, temp_[2]);
     return 3. * tau;
   }
 
@@ -412,17 +794,17 @@ namespace ryujin
 #endif
 
     /* Step 1: T0 <- {U_old, 1} at time t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max / 4.);
 
     /* Step 2: T1 <- {T0, 2} and {U_old, -1} at time t + 1*tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
     /* Step 3: T2 <- {T1, 2} and {T0, -1} at time t + 2*tau -> t + 3*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[1], {{temp_[0]}}, {{Number(-1.)}}, temp_[2], tau);
 
@@ -430,14 +812,14 @@ namespace ryujin
      * Step 4: T3 <- {T2, 8/3} and {T1,-10/3} and {T0, 5/3}
      * at time t + 3*tau -> t + 4*tau
      */
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 3.0 * tau);
+    prepare_stage_state_vector(temp_[2], t + 3.0 * tau);
     hyperbolic_module_->template step<2>(temp_[2],
                                          {{temp_[0], temp_[1]}},
                                          {{Number(5. / 3.), Number(-10. / 3.)}},
                                          temp_[3],
                                          tau);
 
-    state_vector.swap(temp_[3]);
+    swap_states(state_vector, temp_[3]);
     return 4. * tau;
   }
 
@@ -468,17 +850,17 @@ namespace ryujin
     // constexpr Number a_65 = +0.35321654878641495; /* aka b_5 */
 
     /* Step 1: at time t -> t + 1*tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max / 5.);
 
     /* Step 2: at time t + 1*tau -> t + 2*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{state_vector}}, {{(a_31 - a_21) / c}}, temp_[1], tau);
 
     /* Step 3: at time t + 2*tau -> t + 3*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<2>(
         temp_[1],
         {{state_vector, temp_[0]}},
@@ -487,7 +869,7 @@ namespace ryujin
         tau);
 
     /* Step 4: at time t + 3*tau -> t + 4*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 3.0 * tau);
+    prepare_stage_state_vector(temp_[2], t + 3.0 * tau);
     hyperbolic_module_->template step<3>(
         temp_[2],
         {{state_vector, temp_[0], temp_[1]}},
@@ -496,7 +878,7 @@ namespace ryujin
         tau);
 
     /* Step 5: at time t + 4*tau -> t + 5*tau */
-    hyperbolic_module_->prepare_state_vector(temp_[3], t + 4.0 * tau);
+    prepare_stage_state_vector(temp_[3], t + 4.0 * tau);
     hyperbolic_module_->template step<4>(
         temp_[3],
         {{state_vector, temp_[0], temp_[1], temp_[2]}},
@@ -507,11 +889,108 @@ namespace ryujin
         temp_[4],
         tau);
 
-    state_vector.swap(temp_[4]);
+    swap_states(state_vector, temp_[4]);
     return 5. * tau;
   }
 
 
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_erk_54_adaptive(
+      StateVector &state_vector, Number t, Number tau_max)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_erk_54_adaptive()"
+              << std::endl;
+#endif
+
+    /*
+     * PI controller for the (third-order) embedded error estimate with
+     * error ~ tau^4, see @cite Gustafsson1991:
+     */
+    constexpr Number k = 4.;
+    constexpr Number alpha = 0.7 / k;
+    constexpr Number beta = 0.4 / k;
+    constexpr Number safety = 0.9;
+
+    /*
+     * After step_erk_54() the stages U^(1), ..., U^(4) are stored in
+     * temp_[0], ..., temp_[3], the old state U^n in temp_[4] and the new
+     * state U^(5) in state_vector.
+     *
+     * The embedded third-order solution is given by the weights
+     *   b_hat = {+0.31572373492040850, -0.03050453809455900,
+     *            -0.38616212857210735, +1.10094293174625760, 0}.
+     * Because all stages are linear combinations of the stage fluxes the
+     * difference U^(5) - U_hat can be expressed as a linear combination
+     * of the stage increments U^(s) - U^n with the following weights:
+     */
+    constexpr Number e_1 = +110.66523694641208;
+    constexpr Number e_2 = -73.233795555948120;
+    constexpr Number e_3 = +11.926023245126375;
+    constexpr Number e_4 = -1.2439288924737431;
+    constexpr Number e_5 = +1.;
+
+    while (true) {
+      const Number tau =
+          step_erk_54(state_vector, t, std::min(tau_max, tau_error_));
+
+      const auto &old_U = std::get<0>(temp_[4]);
+      const auto &new_U = std::get<0>(state_vector);
+      auto &error = std::get<0>(temp_[5]);
+
+      error.equ(e_5, new_U);
+      error.add(e_1, std::get<0>(temp_[0]), e_2, std::get<0>(temp_[1]));
+      error.add(e_3, std::get<0>(temp_[2]), e_4, std::get<0>(temp_[3]));
+      error.add(-(e_1 + e_2 + e_3 + e_4 + e_5), old_U);
+
+      const Number scale = adaptive_absolute_tolerance_ +
+                           adaptive_relative_tolerance_ * new_U.linfty_norm();
+      const Number normalized_error = error.linfty_norm() / scale;
+
+#ifdef DEBUG_OUTPUT
+      std::cout << "        embedded error = " << normalized_error
+                << std::endl;
+#endif
+
+      if (normalized_error > Number(1.)) {
+        /*
+         * Reject the step: The norms are global, so all ranks agree.
+         * Restore the old state (which keeps its boundary conditions
+         * and precomputed values, see swap_states()) and repeat the step
+         * with a reduced error-controlled step size. The controller
+         * history is left untouched.
+         */
+        const Number factor =
+            std::max(safety * std::pow(normalized_error, -Number(1.) / k),
+                     Number(0.2));
+        tau_error_ = factor * tau;
+
+        swap_states(state_vector, temp_[4]);
+        old_state_prepared_ = true;
+        n_restarts_++;
+        n_wasted_stages_ += 5;
+        continue;
+      }
+
+      Number factor = Number(5.);
+      if (normalized_error > Number(0.))
+        factor = safety * std::pow(normalized_error, -alpha) *
+                 std::pow(error_old_, beta);
+      factor = std::min(std::max(factor, Number(0.2)), Number(5.));
+
+      tau_error_ = factor * tau;
+      error_old_ = std::max(normalized_error, Number(1.e-4));
+
+#ifdef DEBUG_OUTPUT
+      std::cout << "        next error-controlled tau = " << tau_error_
+                << std::endl;
+#endif
+
+      return tau;
+    }
+  }
+
+
   template <typename Description, int dim, typename Number>
   Number TimeIntegrator<Description, dim, Number>::step_strang_ssprk_33_cn(
       StateVector &state_vector, Number t, Number tau_max)
@@ -523,40 +1002,73 @@ namespace ryujin
               << std::endl;
 #endif
 
+    const unsigned int n_substeps = strang_substeps_;
+
     /* First explicit SSPRK 3 step with final result in temp_[0]: */
 
-    hyperbolic_module_->prepare_state_vector(/*!*/ state_vector, t);
+    prepare_old_state_vector(/*!*/ state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
-        /*!*/ state_vector, {}, {}, temp_[0], Number(0.0), tau_max / 2.);
-
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+        /*!*/ state_vector,
+        {},
+        {},
+        temp_[0],
+        Number(0.0),
+        tau_max / (2. * n_substeps));
+
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+    release_precomputed_values(temp_[0]);
     sadd(temp_[1], Number(1.0 / 4.0), Number(3.0 / 4.0), /*!*/ state_vector);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 0.5 * tau);
+    prepare_stage_state_vector(temp_[1], t + 0.5 * tau);
     hyperbolic_module_->template step<0>(temp_[1], {}, {}, temp_[0], tau);
+    release_precomputed_values(temp_[1]);
     sadd(temp_[0], Number(2.0 / 3.0), Number(1.0 / 3.0), /*!*/ state_vector);
 
-    /* Implicit Crank-Nicolson step with final result in temp_[2]: */
+    /*
+     * An SSPRK 3 step with fixed step size tau starting from temp_[2]
+     * with final result in temp_[0]:
+     */
+    const auto ssprk_substep = [&](const Number t_substep) {
+      prepare_stage_state_vector(/*!*/ temp_[2], t_substep);
+      hyperbolic_module_->template step<0>(
+          /*!*/ temp_[2], {}, {}, temp_[0], tau);
+      release_precomputed_values(temp_[2]);
+
+      prepare_stage_state_vector(temp_[0], t_substep + 1.0 * tau);
+      hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+      release_precomputed_values(temp_[0]);
+      sadd(temp_[1], Number(1.0 / 4.0), Number(3.0 / 4.0), /*!*/ temp_[2]);
+
+      prepare_stage_state_vector(temp_[1], t_substep + 0.5 * tau);
+      hyperbolic_module_->template step<0>(temp_[1], {}, {}, temp_[0], tau);
+      release_precomputed_values(temp_[1]);
+      sadd(temp_[0], Number(2.0 / 3.0), Number(1.0 / 3.0), /*!*/ temp_[2]);
+    };
 
-    parabolic_module_->template step<0>(temp_[0], t, {}, {}, temp_[2], tau);
-    sadd(temp_[2], Number(2.), Number(-1.), temp_[0]);
+    /* Remaining explicit SSPRK 3 substeps of the first half: */
 
-    /* Second SSPRK 3 step with final result in temp_[0]: */
+    for (unsigned int k = 1; k < n_substeps; ++k) {
+      swap_states(temp_[0], temp_[2]);
+      ssprk_substep(t + k * tau);
+    }
 
-    hyperbolic_module_->prepare_state_vector(/*!*/ temp_[2], t + 1.0 * tau);
-    hyperbolic_module_->template step<0>(/*!*/ temp_[2], {}, {}, temp_[0], tau);
+    /* Implicit Crank-Nicolson step with final result in temp_[2]: */
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 2.0 * tau);
-    hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
-    sadd(temp_[1], Number(1.0 / 4.0), Number(3.0 / 4.0), /*!*/ temp_[2]);
+    parabolic_module_->template step<0>(
+        temp_[0], t, {}, {}, temp_[2], n_substeps * tau);
+    sadd(temp_[2], Number(2.), Number(-1.), temp_[0]);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 1.5 * tau);
-    hyperbolic_module_->template step<0>(temp_[1], {}, {}, temp_[0], tau);
-    sadd(temp_[0], Number(2.0 / 3.0), Number(1.0 / 3.0), /*!*/ temp_[2]);
+    /* Second SSPRK 3 step(s) with final result in temp_[0]: */
 
-    state_vector.swap(temp_[0]);
-    return 2. * tau;
+    for (unsigned int k = 0; k < n_substeps; ++k) {
+      if (k > 0)
+        swap_states(temp_[0], temp_[2]);
+      ssprk_substep(t + (n_substeps + k) * tau);
+    }
+
+    swap_states(state_vector, temp_[0]);
+    return 2. * n_substeps * tau;
   }
 
 
@@ -571,48 +1083,74 @@ namespace ryujin
               << std::endl;
 #endif
 
+    const unsigned int n_substeps = strang_substeps_;
+
     /* First explicit ERK(3,3,1) step with final result in temp_[2]: */
 
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
-    Number tau = hyperbolic_module_->template step<0>(
-        /*!*/ state_vector, {}, {}, temp_[0], Number(0.), tau_max / 6.);
+    prepare_old_state_vector(state_vector, t);
+    Number tau = hyperbolic_module_->template step<0>(/*!*/ state_vector,
+                                                      {},
+                                                      {},
+                                                      temp_[0],
+                                                      Number(0.),
+                                                      tau_max /
+                                                          (6. * n_substeps));
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{/*!*/ state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<2>(temp_[1],
                                          {{/*!*/ state_vector, temp_[0]}},
                                          {{Number(0.75), Number(-2.)}},
                                          temp_[2],
                                          tau);
 
+    /*
+     * An ERK(3,3,1) step with fixed step size tau starting from temp_[3]
+     * with final result in temp_[2]:
+     */
+    const auto erk_substep = [&](const Number t_substep) {
+      prepare_stage_state_vector(temp_[3], t_substep);
+      hyperbolic_module_->template step<0>(
+          /*!*/ temp_[3], {}, {}, temp_[0], tau);
+
+      prepare_stage_state_vector(temp_[0], t_substep + 1.0 * tau);
+      hyperbolic_module_->template step<1>(
+          temp_[0], {{/*!*/ temp_[3]}}, {{Number(-1.)}}, temp_[1], tau);
+
+      prepare_stage_state_vector(temp_[1], t_substep + 2.0 * tau);
+      hyperbolic_module_->template step<2>(temp_[1],
+                                           {{/*!*/ temp_[3], temp_[0]}},
+                                           {{Number(0.75), Number(-2.)}},
+                                           temp_[2],
+                                           tau);
+    };
+
+    /* Remaining explicit ERK(3,3,1) substeps of the first half: */
+
+    for (unsigned int k = 1; k < n_substeps; ++k) {
+      swap_states(temp_[2], temp_[3]);
+      erk_substep(t + 3.0 * k * tau);
+    }
+
     /* Implicit Crank-Nicolson step with final result in temp_[3]: */
 
     parabolic_module_->template step<0>(
-        temp_[2], t, {}, {}, temp_[3], 3.0 * tau);
+        temp_[2], t, {}, {}, temp_[3], 3.0 * n_substeps * tau);
     sadd(temp_[3], Number(2.), Number(-1.), temp_[2]);
 
-    /* Second explicit ERK(3,3,1) 3 step with final result in temp_[2]: */
+    /* Second explicit ERK(3,3,1) step(s) with final result in temp_[2]: */
 
-    hyperbolic_module_->prepare_state_vector(temp_[3], t + 3.0 * tau);
-    hyperbolic_module_->template step<0>(
-        /*!*/ temp_[3], {}, {}, temp_[0], tau);
-
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 4.0 * tau);
-    hyperbolic_module_->template step<1>(
-        temp_[0], {{/*!*/ temp_[3]}}, {{Number(-1.)}}, temp_[1], tau);
-
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 5.0 * tau);
-    hyperbolic_module_->template step<2>(temp_[1],
-                                         {{/*!*/ temp_[3], temp_[0]}},
-                                         {{Number(0.75), Number(-2.)}},
-                                         temp_[2],
-                                         tau);
+    for (unsigned int k = 0; k < n_substeps; ++k) {
+      if (k > 0)
+        swap_states(temp_[2], temp_[3]);
+      erk_substep(t + 3.0 * (n_substeps + k) * tau);
+    }
 
-    state_vector.swap(temp_[2]);
-    return 6. * tau;
+    swap_states(state_vector, temp_[2]);
+    return 6. * n_substeps * tau;
   }
 
 
@@ -627,56 +1165,83 @@ namespace ryujin
               << std::endl;
 #endif
 
+    const unsigned int n_substeps = strang_substeps_;
+
     /* First explicit ERK(4,3,1) step with final result in temp_[3]: */
 
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
-    Number tau = hyperbolic_module_->template step<0>(
-        /*!*/ state_vector, {}, {}, temp_[0], Number(0.), tau_max / 8.);
+    prepare_old_state_vector(state_vector, t);
+    Number tau = hyperbolic_module_->template step<0>(/*!*/ state_vector,
+                                                      {},
+                                                      {},
+                                                      temp_[0],
+                                                      Number(0.),
+                                                      tau_max /
+                                                          (8. * n_substeps));
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[0], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[0], {{/*!*/ state_vector}}, {{Number(-1.)}}, temp_[1], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    prepare_stage_state_vector(temp_[1], t + 2.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[1], {{temp_[0]}}, {{Number(-1.)}}, temp_[2], tau);
 
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 3.0 * tau);
+    prepare_stage_state_vector(temp_[2], t + 3.0 * tau);
     hyperbolic_module_->template step<2>(temp_[2],
                                          {{temp_[0], temp_[1]}},
                                          {{Number(5. / 3.), Number(-10. / 3.)}},
                                          temp_[3],
                                          tau);
 
-    /* Implicit Crank-Nicolson step with final result in temp_[2]: */
+    /*
+     * An ERK(4,3,1) step with fixed step size tau starting from temp_[2]
+     * with final result in temp_[3]:
+     */
+    const auto erk_substep = [&](const Number t_substep) {
+      prepare_stage_state_vector(temp_[2], t_substep);
+      hyperbolic_module_->template step<0>(
+          /*!*/ temp_[2], {}, {}, temp_[0], tau);
+
+      prepare_stage_state_vector(temp_[0], t_substep + 1.0 * tau);
+      hyperbolic_module_->template step<1>(
+          temp_[0], {{/*!*/ temp_[2]}}, {{Number(-1.)}}, temp_[1], tau);
+
+      prepare_stage_state_vector(temp_[1], t_substep + 2.0 * tau);
+      hyperbolic_module_->template step<1>(
+          temp_[1], {{temp_[0]}}, {{Number(-1.)}}, temp_[2], tau);
+
+      prepare_stage_state_vector(temp_[2], t_substep + 3.0 * tau);
+      hyperbolic_module_->template step<2>(
+          temp_[2],
+          {{temp_[0], temp_[1]}},
+          {{Number(5. / 3.), Number(-10. / 3.)}},
+          temp_[3],
+          tau);
+    };
 
-    parabolic_module_->template step<0>(
-        temp_[3], t, {}, {}, temp_[2], 4.0 * tau);
-    sadd(temp_[2], Number(2.), Number(-1.), temp_[3]);
+    /* Remaining explicit ERK(4,3,1) substeps of the first half: */
 
-    /* Second explicit ERK(4,3,1) step with final result in temp_[3]: */
+    for (unsigned int k = 1; k < n_substeps; ++k) {
+      swap_states(temp_[2], temp_[3]);
+      erk_substep(t + 4.0 * k * tau);
+    }
 
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 4.0 * tau);
-    hyperbolic_module_->template step<0>(
-        /*!*/ temp_[2], {}, {}, temp_[0], tau);
+    /* Implicit Crank-Nicolson step with final result in temp_[2]: */
 
-    hyperbolic_module_->prepare_state_vector(temp_[0], t + 5.0 * tau);
-    hyperbolic_module_->template step<1>(
-        temp_[0], {{/*!*/ temp_[2]}}, {{Number(-1.)}}, temp_[1], tau);
+    parabolic_module_->template step<0>(
+        temp_[3], t, {}, {}, temp_[2], 4.0 * n_substeps * tau);
+    sadd(temp_[2], Number(2.), Number(-1.), temp_[3]);
 
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 6.0 * tau);
-    hyperbolic_module_->template step<1>(
-        temp_[1], {{temp_[0]}}, {{Number(-1.)}}, temp_[2], tau);
+    /* Second explicit ERK(4,3,1) step(s) with final result in temp_[3]: */
 
-    hyperbolic_module_->prepare_state_vector(temp_[2], t + 7.0 * tau);
-    hyperbolic_module_->template step<2>(temp_[2],
-                                         {{temp_[0], temp_[1]}},
-                                         {{Number(5. / 3.), Number(-10. / 3.)}},
-                                         temp_[3],
-                                         tau);
+    for (unsigned int k = 0; k < n_substeps; ++k) {
+      if (k > 0)
+        swap_states(temp_[2], temp_[3]);
+      erk_substep(t + 4.0 * (n_substeps + k) * tau);
+    }
 
-    state_vector.swap(temp_[3]);
-    return 8. * tau;
+    swap_states(state_vector, temp_[3]);
+    return 8. * n_substeps * tau;
   }
 
   template <typename Description, int dim, typename Number>
@@ -688,7 +1253,7 @@ namespace ryujin
 #endif
 
     /* Explicit step 1: T0 <- {U_old, 1} at time t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max);
 
@@ -696,7 +1261,7 @@ namespace ryujin
     parabolic_module_->template step<0>(
         temp_[0], t, {}, {}, temp_[1], 1.0 * tau);
 
-    state_vector.swap(temp_[1]);
+    swap_states(state_vector, temp_[1]);
     return tau;
   }
 
@@ -709,7 +1274,7 @@ namespace ryujin
 #endif
 
     /* Explicit step 1: T0 <- {U_old, 1} at time t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max / 2.);
 
@@ -717,7 +1282,7 @@ namespace ryujin
     parabolic_module_->template step<0>(temp_[0], t, {}, {}, temp_[1], tau);
 
     /* Explicit step 2: T2 <- {T1, 2} and {U_old, -1} at t + tau -> t + 2 tau */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[1], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[1], {{state_vector}}, {{Number(-1.)}}, temp_[2], tau);
 
@@ -729,7 +1294,7 @@ namespace ryujin
                                         temp_[3],
                                         tau);
 
-    state_vector.swap(temp_[3]);
+    swap_states(state_vector, temp_[3]);
     return 2. * tau;
   }
 
@@ -746,7 +1311,7 @@ namespace ryujin
     const Number gamma = 0.5 + 0.5 * (1. / std::sqrt(3.));
 
     /* Explicit step 1: T0 <- {U_old, 1} at time t -> t + tau */
-    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    prepare_old_state_vector(state_vector, t);
     Number tau = hyperbolic_module_->template step<0>(
         state_vector, {}, {}, temp_[0], Number(0.), tau_max / 3.);
 
@@ -759,7 +1324,7 @@ namespace ryujin
                                         tau);
 
     /* Explicit step 2: T2 <- {U_old, -1} and {T1, 2} at time t -> t + 2 tau */
-    hyperbolic_module_->prepare_state_vector(temp_[1], t + 1.0 * tau);
+    prepare_stage_state_vector(temp_[1], t + 1.0 * tau);
     hyperbolic_module_->template step<1>(
         temp_[1], {{state_vector}}, {{Number(-1.)}}, temp_[2], tau);
 
@@ -776,7 +1341,7 @@ namespace ryujin
         tau);
 
     /* Explicit step 3: T4 <- {U_old, 3 / 4} and {T1, -2} at t -> t + 3 tau */
-    hyperbolic_module_->prepare_state_vector(temp_[3], t + 2. * tau);
+    prepare_stage_state_vector(temp_[3], t + 2. * tau);
     hyperbolic_module_->template step<2>(temp_[3],
                                          {{state_vector, temp_[1]}},
                                          {{Number(0.75), Number(-2.)}},
@@ -793,7 +1358,7 @@ namespace ryujin
                                         temp_[5],
                                         tau);
 
-    state_vector.swap(temp_[5]);
+    swap_states(state_vector, temp_[5]);
     return 3. * tau;
   }
 
@@ -13,4 +13,10 @@ namespace ryujin
   template class TimeLoop<Description, 2, NUMBER>;
   template class TimeLoop<Description, 3, NUMBER>;
 
+#ifdef RUNTIME_PRECISION
+  template class TimeLoop<Description, 1, ALTERNATIVE_NUMBER>;
+  template class TimeLoop<Description, 2, ALTERNATIVE_NUMBER>;
+  template class TimeLoop<Description, 3, ALTERNATIVE_NUMBER>;
+#endif
+
 } // namespace ryujin
@@ -12,19 +12,70 @@
 #include "initial_values.h"
 #include "mesh_adaptor.h"
 #include "offline_data.h"
+#include "openmp.h"
 #include "parabolic_module.h"
 #include "postprocessor.h"
 #include "quantities.h"
 #include "time_integrator.h"
+#include "patterns_conversion.h"
 #include "vtu_output.h"
 
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/timer.h>
 
+#include <array>
+#include <cstdint>
+#include <deque>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <optional>
 
 namespace ryujin
 {
+  /**
+   * The file format of the performance report written by TimeLoop.
+   *
+   * @ingroup TimeLoop
+   */
+  enum class PerformanceReportFormat {
+    /**
+     * Write one JSON object per report and line (JSON Lines).
+     */
+    json,
+
+    /**
+     * Write comma separated values with one row per recorded quantity.
+     */
+    csv,
+  };
+
+
+  /**
+   * The file format used for storing the state vector in checkpoints.
+   *
+   * @ingroup TimeLoop
+   */
+  enum class CheckpointFormat {
+    /**
+     * Serialize the state vector with SolutionTransfer together with the
+     * mesh. This format allows to resume with a different number of MPI
+     * ranks.
+     */
+    serialization,
+
+    /**
+     * Write the locally owned part of the state vector as raw binary data
+     * into a single file "<basename>-checkpoint.state" (behind an
+     * alignment-padded header) with collective MPI IO. On resume the data
+     * is read directly into the state vector. This format requires the
+     * same number of MPI ranks (and thus the same partition of the mesh)
+     * unless the state is additionally attached to the mesh ("checkpoint
+     * elastic").
+     */
+    raw,
+  };
+
 
   /**
    * The high-level time loop driving the computation.
@@ -58,8 +109,19 @@ namespace ryujin
 
     using StateVector = typename View::StateVector;
 
+    using state_type = typename View::state_type;
+
     using ScalarVector = Vectors::ScalarVector<Number>;
 
+    /**
+     * Signature of an in-situ consumer, see attach_insitu_consumer().
+     */
+    using InSituConsumer =
+        std::function<void(const StateVector & /*state_vector*/,
+                           const Postprocessor<Description, dim, Number> &,
+                           Number /*t*/,
+                           unsigned int /*cycle*/)>;
+
     //@}
     /**
      * @name Constructor and setup
@@ -67,21 +129,157 @@ namespace ryujin
     //@{
 
     /**
-     * Constructor.
+     * Constructor. The optional @p time_comm connects the ranks of the
+     * different time slices in the parallel in time mode, see
+     * run_parareal(). The rank of @p time_comm is the index of the time
+     * slice computed by this TimeLoop and @p mpi_comm only contains the
+     * ranks of this time slice.
      */
-    TimeLoop(const MPI_Comm &mpi_comm);
+    TimeLoop(const MPI_Comm &mpi_comm,
+             const MPI_Comm &time_comm = MPI_COMM_SELF);
+
+    /**
+     * Destructor. Waits for all postprocessing jobs that are still in
+     * flight, see "asynchronous postprocessing".
+     */
+    ~TimeLoop();
 
     /**
      * Run the high-level time loop.
      */
     void run();
 
+    /**
+     * Dry run mode: Instead of running the high-level time loop, set up
+     * the discretization and all compute kernels on a coarse proxy of the
+     * mesh refinement level requested in the Discretization and perform
+     * a short calibration run with "dry run cycles" cycles. From the
+     * measured memory consumption per degree of freedom, wall time per
+     * cycle, and time step size the memory per rank and the time to
+     * solution of the requested refinement level are extrapolated and
+     * printed. The proxy is the finest refinement level with at most
+     * "dry run cells per rank" cells per rank.
+     *
+     * The extrapolation assumes that the number of degrees of freedom and
+     * the wall time per cycle scale with the number of cells and that the
+     * time step size scales with the mesh size.
+     */
+    void dry_run();
+
+    /**
+     * Register an in-situ (or in-transit) consumer, for example an
+     * adaptor for ParaView Catalyst or an ADIOS2 stream. If "enable
+     * output insitu" is set the consumer is called from output() at the
+     * corresponding timer ticks with the prepared state vector and the
+     * Postprocessor holding freshly computed quantities.
+     *
+     * All data is passed by reference to the internal storage and must
+     * not be accessed after the consumer returned. Component @p d of
+     * locally owned degree of freedom @p i of the hyperbolic state is
+     * stored at local element MultiComponentVector::storage_index(i, d).
+     */
+    void attach_insitu_consumer(const InSituConsumer &consumer);
+
+    //@}
+    /**
+     * @name Library interface for in-process coupling
+     *
+     * Instead of calling run() an external program (for example a solver
+     * of a coupled problem) can drive the computation step by step: After
+     * initialize() the solution is advanced with advance() or
+     * advance_to(). In between, the boundary states can be read directly
+     * from state_vector() (with the degrees of freedom and normals given
+     * by OfflineData::boundary_map() or OfflineData::boundary_table()) and
+     * new boundary data can be injected with boundary_data(). No output,
+     * checkpointing, or mesh adaptation is performed by these functions.
+     */
+    //@{
+
+    /**
+     * Set up the discretization and all compute kernels and interpolate
+     * the initial state (or resume from a checkpoint if "resume" is set).
+     */
+    void initialize();
+
+    /**
+     * Perform @p n_steps time steps and return the new time.
+     */
+    Number advance(const unsigned int n_steps);
+
+    /**
+     * Perform time steps until time @p t is reached and return the new
+     * time. The last time step is shortened to end exactly at @p t.
+     */
+    Number advance_to(const Number t);
+
+    /**
+     * Return the current time of the coupled computation.
+     */
+    Number time() const
+    {
+      return coupling_t_;
+    }
+
+    /**
+     * Return a reference to the current state vector of the coupled
+     * computation. The hyperbolic state of locally relevant degree of
+     * freedom @p i is std::get<0>(state_vector()).get_tensor(i).
+     */
+    const StateVector &state_vector() const
+    {
+      return coupling_state_vector_;
+    }
+
+    /**
+     * Return a reference to the OfflineData object.
+     */
+    const OfflineData<dim, Number> &offline_data() const
+    {
+      return offline_data_;
+    }
+
+    /**
+     * Return a mutable reference to the Dirichlet data for every entry of
+     * OfflineData::boundary_table(), see
+     * HyperbolicModule::dirichlet_data(). Values written into the vector
+     * are used by all subsequent time steps. If the initial state is time
+     * dependent the data is populated with the initial state at the
+     * current time on first access and kept fixed afterwards.
+     */
+    std::vector<state_type> &boundary_data();
+
   protected:
     /**
      * @name Private methods for run()
      */
     //@{
 
+    /**
+     * Attach the log file, record runtime parameters, and set up thread
+     * affinity and scheduling.
+     */
+    void prepare_run();
+
+    /**
+     * Prepare all compute kernels after the discretization has been
+     * (re)created for the current time @p t.
+     */
+    void prepare_kernels(const Number t);
+
+    /**
+     * Ensemble mode: parse the parameter file @p parameter_file of an
+     * ensemble member on top of the current parameters, recreate all
+     * compute kernels (but not the mesh and offline data), and reset the
+     * state vector @p state_vector to initial values, the time @p t and
+     * the output cycle @p output_cycle to zero. Quantities of interest
+     * are written with base name @p base_name.
+     */
+    void prepare_ensemble_member(const std::string &parameter_file,
+                                 const std::string &base_name,
+                                 StateVector &state_vector,
+                                 Number &t,
+                                 unsigned int &output_cycle);
+
     /**
      * Performs a resume operation. Given a @p base_name the function tries
      * to locate correponding checkpoint files and will read in the saved
@@ -98,8 +296,16 @@ namespace ryujin
     /**
      * Write out a checkpoint to disk. Given a @p base_name and a current
      * state @p U at time @p t and output cycle @p output_cycle the
-     * function writes out the state to disk using boost::archive for
-     * serialization.
+     * function writes out the state to disk using the parallel
+     * serialization of SolutionTransfer (or a raw binary file, see
+     * CheckpointFormat) and boost::archive for metadata.
+     *
+     * The state is copied into an internal checkpoint buffer. If
+     * asynchronous checkpointing is enabled the write-out of the raw state
+     * and the metadata is posted to a dedicated checkpoint thread (using
+     * a duplicated communicator) and overlaps with subsequent time steps.
+     * This implies that @p U can again be modified once
+     * write_checkpoint() returned.
      *
      * @pre the state_vector needs to be prepared.
      */
@@ -108,14 +314,152 @@ namespace ryujin
                           const Number &t,
                           const unsigned int &output_cycle);
 
+    /**
+     * Wait for a checkpoint write-out that is still in flight to finish.
+     * This function has to be called before the triangulation is
+     * modified and before the time loop terminates.
+     */
+    void finalize_checkpoint();
+
+    /**
+     * Copy @p state_vector and the current indicator (alpha) into a
+     * snapshot buffer and post @p job operating on the copy to the
+     * postprocessing thread. The indicator copy uses the partitioner of
+     * the Postprocessor so that ghost updates issued by the job
+     * communicate over the output communicator. At most "snapshot
+     * buffers" buffers are allocated: If all of them are in use the
+     * function waits for the oldest job to finish and recycles its
+     * buffer.
+     */
+    void post_snapshot_job(
+        const StateVector &state_vector,
+        const std::function<void(const StateVector &, const ScalarVector &)>
+            &job);
+
+    /**
+     * Wait for all postprocessing jobs to finish. This function has to
+     * be called before the triangulation is modified and before the time
+     * loop terminates.
+     */
+    void finalize_postprocessing();
+
+    /**
+     * Refresh the in-memory buddy checkpoint: The locally owned part of
+     * the state vector @p state_vector at time @p t and output cycle
+     * @p output_cycle is stored in a file in the node-local "buddy
+     * checkpoint directory" (typically a tmpfs such as /dev/shm) and is
+     * sent with non-blocking communication to the buddy rank (mpi_rank +
+     * ranks per node), which stores the copy in its own node-local
+     * directory. This way the state of every rank survives the loss of a
+     * single node.
+     *
+     * @pre the state_vector needs to be prepared.
+     */
+    void write_buddy_checkpoint(const StateVector &state_vector,
+                                const Number &t,
+                                const unsigned int &output_cycle);
+
+    /**
+     * Select the rank offset of the buddy rank: The number of ranks per
+     * node (determined with MPI_Comm_split_type) so that the buddy runs
+     * on another node. Prints a warning if all ranks share a single node
+     * or if the rank placement still puts some buddies on the same node.
+     */
+    void select_buddy_offset();
+
+    /**
+     * Complete a buddy checkpoint exchange that is still in flight and
+     * store the received copy. If @p wait is set to false the function
+     * only tests for completion and returns immediately.
+     */
+    void finalize_buddy_checkpoint(const bool wait = true);
+
+    /**
+     * Try to resume from buddy checkpoints. The mesh is recreated with
+     * Discretization::prepare() and every rank restores its state from
+     * its own node-local copy, or, if that copy is missing, from the copy
+     * stored by its buddy. The function returns false if no consistent
+     * set of buddy checkpoints is available, in which case the caller
+     * falls back to read_checkpoint().
+     */
+    template <typename Callable>
+    bool read_buddy_checkpoint(StateVector &state_vector,
+                               const std::string &base_name,
+                               Number &t,
+                               unsigned int &output_cycle,
+                               const Callable &prepare_compute_kernels);
+
+    /**
+     * Warm start: Read the (serialized) checkpoint of a previous run with
+     * base name @p base_name on its own mesh and interpolate the state
+     * onto the support points of the current mesh with a
+     * RemotePointEvaluation. The previous run must have used the same
+     * coarse mesh (but possibly a different refinement, mesh adaptation,
+     * or number of MPI ranks). Support points outside of the previous
+     * mesh keep the values of @p state_vector.
+     */
+    void read_warm_start(StateVector &state_vector,
+                         const std::string &base_name);
+
+    /**
+     * Run the scaling benchmark mode: For every mesh refinement level
+     * given in "benchmark refinements" the discretization and all compute
+     * kernels are recreated with @p prepare_compute_kernels. Then, for
+     * every thread count given in "benchmark threads" the initial state is
+     * interpolated and a fixed number of "benchmark cycles" is performed
+     * without any output. A consolidated scaling table of the throughput
+     * metrics also reported by print_throughput() is printed at the end.
+     */
+    template <typename Callable>
+    void run_scaling_benchmark(const Callable &prepare_compute_kernels);
+
+    /**
+     * Perform the calibration run of the dry run mode on a proxy
+     * refinement level and print the extrapolated estimates, see
+     * dry_run().
+     */
+    template <typename Callable>
+    void run_dry_run(const Callable &prepare_compute_kernels);
+
+    /**
+     * Run the parallel in time mode (experimental): The interval [0,
+     * final time] is split into one time slice per rank group of the
+     * time communicator. The slices are coupled with the Parareal
+     * algorithm
+     * @f[
+     *   U_{n+1}^{k} = G(U_n^{k}) + F(U_n^{k-1}) - G(U_n^{k-1}),
+     * @f]
+     * where the fine propagator F is the regular time integrator and the
+     * coarse propagator G a second TimeIntegrator configured in the
+     * subsection "H - TimeIntegrator/coarse propagator" (for example erk
+     * 11 with a large CFL number). All fine propagations of an iteration
+     * are computed concurrently, the coarse propagations and corrections
+     * are pipelined from slice to slice. The iteration terminates once
+     * the relative change of all slice end states is below the
+     * "parareal tolerance", after "parareal iterations" iterations, or
+     * after as many iterations as there are slices (at which point the
+     * result equals the serial fine solution). Every slice writes its end
+     * state with output().
+     *
+     * All rank groups must have the same number of ranks so that the
+     * partitions, and thus the locally owned parts of the state vectors,
+     * of all slices coincide.
+     */
+    template <typename Callable>
+    void run_parareal(const Callable &prepare_compute_kernels);
+
     /**
      * Perform a mesh adaptation cycle according to the selected strategy
      * in the MeshAdaptor class. The state vector is transferred to the new
-     * discretization.
+     * discretization. If @p refine is set to false, cells are not marked
+     * for refinement and coarsening and the mesh is merely repartitioned
+     * (with cell weights if weighted repartitioning is enabled).
      */
     template <typename Callable>
     void adapt_mesh_and_transfer_state_vector(
-        StateVector &state_vector, const Callable &prepare_compute_kernels);
+        StateVector &state_vector,
+        const Callable &prepare_compute_kernels,
+        const bool refine = true);
 
     void compute_error(StateVector &state_vector, Number t);
 
@@ -124,6 +468,33 @@ namespace ryujin
                 const Number t,
                 const unsigned int cycle);
 
+    void output(StateVector &state_vector,
+                const std::string &name,
+                const Number t,
+                const unsigned int cycle,
+                const bool do_full_output,
+                const bool do_levelsets,
+                const bool do_region,
+                const bool do_insitu,
+                const bool do_checkpointing);
+
+    /**
+     * Write out all interpolated output streams (full, levelsets, region,
+     * and in-situ output) that are due in the interval (t_old, t]. Every
+     * stream follows its own schedule, the next timer cycle of every
+     * stream is stored in @p next_cycle. The state written out at an
+     * output time t_old <= t_output <= t is the linear interpolation
+     * between @p old_state_vector at t_old and @p state_vector at t,
+     * which is stored in @p interpolated_state_vector.
+     */
+    void output_interpolated(StateVector &interpolated_state_vector,
+                             const StateVector &old_state_vector,
+                             StateVector &state_vector,
+                             const std::string &name,
+                             const Number t_old,
+                             const Number t,
+                             std::array<unsigned int, 4> &next_cycle);
+
     void print_parameters(std::ostream &stream);
     void print_mpi_partition(std::ostream &stream);
     void print_memory_statistics(std::ostream &stream);
@@ -143,6 +514,51 @@ namespace ryujin
                                 unsigned int output_cycle,
                                 bool write_to_logfile = false,
                                 bool final_time = false);
+
+    /**
+     * Reduce the rank local statistic @p value identified by @p key over
+     * all MPI ranks. Depending on statistics_mode_ the reduction is
+     * either performed immediately (blocking), the value is recorded in
+     * the packed statistics buffer (gather), or the result of a
+     * previously completed non-blocking reduction is returned (replay).
+     */
+    dealii::Utilities::MPI::MinMaxAvg
+    reduce_statistic(const std::string &key, const double value);
+
+    /**
+     * Gather all statistics printed by print_cycle_statistics() and start
+     * a single non-blocking reduction.
+     */
+    void start_cycle_statistics(unsigned int cycle,
+                                Number t,
+                                unsigned int timer_cycle,
+                                bool write_to_logfile);
+
+    /**
+     * Wait for a reduction started by start_cycle_statistics() (if any)
+     * and print the cycle statistics.
+     */
+    void finish_cycle_statistics();
+
+    /**
+     * Compute a topology-aware placement of the MPI ranks for the current
+     * partition and write it to the "rank order file". The communication
+     * graph (weighted with the number of exchanged ghost indices) is
+     * handed to MPI_Dist_graph_create_adjacent() with reordering enabled.
+     * The i-th entry of the resulting comma separated list is the rank
+     * that should be placed on the i-th slot of the current allocation
+     * (the format of MPICH_RANK_ORDER files used with
+     * MPICH_RANK_REORDER_METHOD=3). This function is collective.
+     */
+    void write_rank_order();
+
+    /**
+     * Append a machine readable performance report for the current
+     * @p cycle to the file "<basename>-performance.{jsonl,csv}". This
+     * function is collective: The reported minima, maxima and averages
+     * are taken over all MPI ranks.
+     */
+    void write_performance_report(unsigned int cycle, Number t);
     //@}
 
   private:
@@ -153,22 +569,42 @@ namespace ryujin
 
     std::string base_name_;
 
+    std::string rank_order_file_;
+
     std::string debug_filename_;
 
     Number t_final_;
     bool enforce_t_final_;
+    double steady_state_tolerance_;
+    unsigned int steady_state_interval_;
+    unsigned int steady_state_checks_;
     Number timer_granularity_;
+    bool output_interpolation_;
 
     bool enable_checkpointing_;
+    bool asynchronous_checkpointing_;
+    CheckpointFormat checkpoint_format_;
+    bool checkpoint_compression_;
+    unsigned int checkpoint_full_interval_;
+    bool checkpoint_elastic_;
+    unsigned int buddy_checkpoint_interval_;
+    std::string buddy_checkpoint_directory_;
     bool enable_output_full_;
     bool enable_output_levelsets_;
+    bool enable_output_region_;
+    bool enable_output_insitu_;
     bool enable_compute_error_;
     bool enable_compute_quantities_;
     bool enable_mesh_adaptivity_;
+    bool asynchronous_postprocessing_;
+    unsigned int snapshot_buffers_;
 
     unsigned int timer_checkpoint_multiplier_;
+    double checkpoint_mtbf_;
     unsigned int timer_output_full_multiplier_;
     unsigned int timer_output_levelsets_multiplier_;
+    unsigned int timer_output_region_multiplier_;
+    unsigned int timer_output_insitu_multiplier_;
     unsigned int timer_compute_quantities_multiplier_;
 
     std::vector<std::string> error_quantities_;
@@ -176,9 +612,40 @@ namespace ryujin
 
     bool resume_;
     bool resume_at_time_zero_;
+    std::string warm_start_;
 
     Number terminal_update_interval_;
+    bool terminal_nonblocking_statistics_;
     bool terminal_show_rank_throughput_;
+    unsigned int halo_statistics_layers_;
+    unsigned int temporal_blocking_block_size_;
+    unsigned int temporal_blocking_layers_;
+
+    ThreadSchedule thread_schedule_;
+    unsigned int thread_schedule_chunk_size_;
+    bool pin_threads_;
+
+    unsigned int performance_report_interval_;
+    PerformanceReportFormat performance_report_format_;
+
+    unsigned int timeline_trace_interval_;
+
+    bool roofline_probe_;
+
+    unsigned int autotune_cycles_;
+
+    unsigned int benchmark_cycles_;
+    std::vector<unsigned int> benchmark_refinements_;
+    std::vector<unsigned int> benchmark_threads_;
+
+    unsigned int dry_run_cycles_;
+    unsigned int dry_run_cells_per_rank_;
+    double dry_run_memory_budget_;
+
+    std::vector<std::string> ensemble_parameter_files_;
+
+    unsigned int parareal_iterations_;
+    double parareal_tolerance_;
 
     //@}
     /**
@@ -188,7 +655,44 @@ namespace ryujin
 
     const MPI_Comm &mpi_communicator_;
 
-    std::map<std::string, dealii::Timer> computing_timer_;
+    /*
+     * The parallel in time mode: time_communicator_ connects the ranks of
+     * all time slices, time_slice_ is the index of the time slice of this
+     * rank group.
+     */
+    const MPI_Comm &time_communicator_;
+    const unsigned int time_slice_;
+    const unsigned int n_time_slices_;
+
+    /*
+     * A duplicate of mpi_communicator_ that is handed to the
+     * Postprocessor, VTUOutput and Quantities. Their collective
+     * operations can thus be issued from the postprocessing thread
+     * without interfering with the time loop.
+     */
+    MPI_Comm output_communicator_;
+
+    /*
+     * A duplicate of mpi_communicator_ used by the checkpoint thread for
+     * an asynchronous checkpoint write-out.
+     */
+    MPI_Comm checkpoint_communicator_;
+
+    std::map<std::string, SectionTimer> computing_timer_;
+
+    /**
+     * State of the (non-blocking) cycle statistics, see
+     * start_cycle_statistics() and finish_cycle_statistics().
+     */
+    enum class StatisticsMode { blocking, gather, replay };
+    StatisticsMode statistics_mode_;
+    std::map<std::string, std::size_t> statistics_keys_;
+    std::vector<double> statistics_buffer_;
+    MPI_Datatype statistics_datatype_;
+    MPI_Op statistics_operation_;
+    MPI_Request statistics_request_;
+    std::optional<std::tuple<unsigned int, Number, unsigned int, bool>>
+        pending_statistics_;
 
     HyperbolicSystem hyperbolic_system_;
     ParabolicSystem parabolic_system_;
@@ -198,6 +702,7 @@ namespace ryujin
     HyperbolicModule<Description, dim, Number> hyperbolic_module_;
     ParabolicModule<Description, dim, Number> parabolic_module_;
     TimeIntegrator<Description, dim, Number> time_integrator_;
+    TimeIntegrator<Description, dim, Number> coarse_time_integrator_;
     MeshAdaptor<Description, dim, Number> mesh_adaptor_;
     Postprocessor<Description, dim, Number> postprocessor_;
     VTUOutput<Description, dim, Number> vtu_output_;
@@ -206,9 +711,59 @@ namespace ryujin
     const unsigned int mpi_rank_;
     const unsigned int n_mpi_processes_;
 
+    double peak_bandwidth_; /* bytes per second and rank, 0 if unknown */
+
+    ThreadAffinity thread_affinity_;
+
     std::ofstream logfile_; /* log file */
 
+    std::ofstream performance_report_file_;
+
+    std::vector<InSituConsumer> insitu_consumers_;
+
+    std::array<ScalarVector, problem_dimension> checkpoint_states_;
+    std::vector<Number> checkpoint_buffer_;
+    std::vector<Number> checkpoint_reference_;
+    std::uint64_t checkpoint_reference_checksum_;
+    unsigned int n_delta_checkpoints_;
+    std::future<void> checkpoint_status_;
+
+    std::vector<char> buddy_send_buffer_;
+    std::vector<char> buddy_receive_buffer_;
+    std::array<MPI_Request, 2> buddy_requests_;
+    unsigned int buddy_offset_;
+
+    bool dry_run_;
+
+    StateVector coupling_state_vector_;
+    Number coupling_t_;
+
+    using Snapshot = std::pair<StateVector, ScalarVector /*alpha*/>;
+    std::vector<std::shared_ptr<Snapshot>> free_snapshots_;
+    std::deque<std::pair<std::shared_ptr<Snapshot>, std::future<void>>>
+        snapshot_jobs_;
+
+    /* Declared last so that they are joined before all other members die: */
+    WorkerThread postprocessing_thread_;
+    WorkerThread checkpoint_thread_;
+
     //@}
   };
 
 } // namespace ryujin
+
+#ifndef DOXYGEN
+DECLARE_ENUM(
+    ryujin::ThreadSchedule,
+    LIST({ryujin::ThreadSchedule::static_schedule, "static"},
+         {ryujin::ThreadSchedule::dynamic_schedule, "dynamic"},
+         {ryujin::ThreadSchedule::guided_schedule, "guided"}));
+
+DECLARE_ENUM(ryujin::CheckpointFormat,
+             LIST({ryujin::CheckpointFormat::serialization, "serialization"},
+                  {ryujin::CheckpointFormat::raw, "raw"}));
+
+DECLARE_ENUM(ryujin::PerformanceReportFormat,
+             LIST({ryujin::PerformanceReportFormat::json, "json"},
+                  {ryujin::PerformanceReportFormat::csv, "csv"}));
+#endif
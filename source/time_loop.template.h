@@ -5,28 +5,614 @@
 
 #pragma once
 
+#include "energy_counters.h"
+#include "file_staging.h"
 #include "scope.h"
 #include "time_loop.h"
+#include "trace.h"
 #include "version_info.h"
 
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/work_stream.h>
 #include <deal.II/distributed/solution_transfer.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_tools.h>
 #include <deal.II/numerics/vector_tools.h>
 #include <deal.II/numerics/vector_tools.templates.h>
 
+#ifdef WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <map>
+#include <numeric>
 
 using namespace dealii;
 
 namespace ryujin
 {
+  namespace
+  {
+    /*
+     * The header of the raw checkpoint format. The header is padded to
+     * raw_checkpoint_alignment bytes and followed by a table with one
+     * RawCheckpointEntry per rank. The payload (the locally owned parts
+     * of the state vector of all ranks, in rank order) starts at the next
+     * multiple of raw_checkpoint_alignment after the table.
+     */
+    struct RawCheckpointHeader {
+      char magic[8];
+      std::uint64_t n_ranks;
+      std::uint64_t n_components;
+      std::uint64_t number_size;
+      std::uint64_t n_values;
+      std::uint64_t flags;
+    };
+
+    struct RawCheckpointEntry {
+      std::uint64_t offset;
+      std::uint64_t n_bytes;
+      std::uint64_t n_values;
+      std::uint64_t checksum;
+      std::uint64_t reference_checksum;
+    };
+
+    constexpr std::uint64_t raw_checkpoint_alignment = 4096;
+    constexpr char raw_checkpoint_magic[8] = {
+        'r', 'y', 'u', 'j', 'i', 'n', 'c', 'p'};
+
+    /* The payload is byte-shuffled and compressed with zstd: */
+    constexpr std::uint64_t raw_checkpoint_compressed = 1;
+    /* The payload is the XOR difference to a full checkpoint: */
+    constexpr std::uint64_t raw_checkpoint_delta = 2;
+
+
+    /*
+     * A simple 64 bit checksum (FNV-1a over 64 bit words) of the array
+     * [@p data, @p data + @p n_bytes).
+     */
+    inline std::uint64_t raw_checkpoint_checksum(const void *data,
+                                                 const std::size_t n_bytes)
+    {
+      constexpr std::uint64_t prime = 0x100000001b3ull;
+      std::uint64_t hash = 0xcbf29ce484222325ull;
+
+      const auto bytes = static_cast<const char *>(data);
+      std::size_t i = 0;
+      for (; i + 8 <= n_bytes; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        hash = (hash ^ word) * prime;
+      }
+      for (; i < n_bytes; ++i)
+        hash = (hash ^ static_cast<unsigned char>(bytes[i])) * prime;
+
+      return hash;
+    }
+
+
+    /*
+     * Byte shuffle: Group the k-th bytes of all @p n_values values of
+     * size @p value_size together. If a @p reference is given the bytes
+     * are additionally XORed with the bytes of the reference. Both
+     * transformations greatly improve the compression ratio for floating
+     * point data.
+     */
+    inline void raw_checkpoint_shuffle(const char *source,
+                                       const char *reference,
+                                       char *destination,
+                                       const std::size_t n_values,
+                                       const std::size_t value_size)
+    {
+      for (std::size_t i = 0; i < n_values; ++i)
+        for (std::size_t b = 0; b < value_size; ++b) {
+          const auto k = i * value_size + b;
+          destination[b * n_values + i] =
+              reference == nullptr ? source[k] : source[k] ^ reference[k];
+        }
+    }
+
+
+    /*
+     * Inverse of raw_checkpoint_shuffle(). If @p delta is true the bytes
+     * are XORed into @p destination, which has to hold the reference.
+     */
+    inline void raw_checkpoint_unshuffle(const char *source,
+                                         char *destination,
+                                         const bool delta,
+                                         const std::size_t n_values,
+                                         const std::size_t value_size)
+    {
+      for (std::size_t i = 0; i < n_values; ++i)
+        for (std::size_t b = 0; b < value_size; ++b) {
+          const auto k = i * value_size + b;
+          const auto value = source[b * n_values + i];
+          destination[k] = delta ? destination[k] ^ value : value;
+        }
+    }
+
+
+    /*
+     * Write the array [@p data, @p data + @p size) of every rank into
+     * the file @p filename with collective MPI IO. If @p reference is
+     * nonzero a delta checkpoint is written storing the difference to the
+     * (full) checkpoint @p reference with checksum @p reference_checksum.
+     * Returns the checksum of @p data.
+     */
+    template <typename Number>
+    std::uint64_t write_raw_checkpoint(const std::string &filename,
+                                       const Number *data,
+                                       const std::size_t size,
+                                       const unsigned int n_components,
+                                       const bool compress,
+                                       const Number *reference,
+                                       const std::uint64_t reference_checksum,
+                                       const MPI_Comm &mpi_communicator)
+    {
+      const auto rank = Utilities::MPI::this_mpi_process(mpi_communicator);
+      const auto n_ranks = Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+      RawCheckpointEntry entry;
+      entry.n_values = size;
+      entry.checksum = raw_checkpoint_checksum(data, size * sizeof(Number));
+      entry.reference_checksum = reference_checksum;
+
+      const char *payload = reinterpret_cast<const char *>(data);
+      entry.n_bytes = size * sizeof(Number);
+
+      std::vector<char> buffer;
+      if (compress) {
+#ifdef WITH_ZSTD
+        std::vector<char> shuffled(size * sizeof(Number));
+        raw_checkpoint_shuffle(reinterpret_cast<const char *>(data),
+                               reinterpret_cast<const char *>(reference),
+                               shuffled.data(),
+                               size,
+                               sizeof(Number));
+
+        buffer.resize(ZSTD_compressBound(shuffled.size()));
+        const auto n_bytes = ZSTD_compress(buffer.data(),
+                                           buffer.size(),
+                                           shuffled.data(),
+                                           shuffled.size(),
+                                           /*level*/ 1);
+        AssertThrow(!ZSTD_isError(n_bytes),
+                    ExcMessage("Raw checkpoint: compression failed"));
+
+        payload = buffer.data();
+        entry.n_bytes = n_bytes;
+#else
+        AssertThrow(false,
+                    ExcMessage("Compressed checkpoints require ryujin to be "
+                               "configured with zstd support (WITH_ZSTD)"));
+#endif
+      }
+
+      AssertThrow(entry.n_bytes <= std::numeric_limits<int>::max(),
+                  ExcMessage("Raw checkpoint: local state too large"));
+
+      /* Compute the layout of the file: */
+
+      std::uint64_t offset = 0;
+      int ierr = MPI_Exscan(&entry.n_bytes,
+                            &offset,
+                            1,
+                            MPI_UINT64_T,
+                            MPI_SUM,
+                            mpi_communicator);
+      AssertThrowMPI(ierr);
+      if (rank == 0)
+        offset = 0;
+
+      const std::uint64_t payload_start =
+          (raw_checkpoint_alignment + n_ranks * sizeof(RawCheckpointEntry) +
+           raw_checkpoint_alignment - 1) /
+          raw_checkpoint_alignment * raw_checkpoint_alignment;
+      entry.offset = payload_start + offset;
+
+      RawCheckpointHeader header;
+      std::memcpy(header.magic, raw_checkpoint_magic, 8);
+      header.n_ranks = n_ranks;
+      header.n_components = n_components;
+      header.number_size = sizeof(Number);
+      header.n_values = Utilities::MPI::sum<std::uint64_t>(size,
+                                                           mpi_communicator);
+      header.flags = (compress ? raw_checkpoint_compressed : 0) |
+                     (reference != nullptr ? raw_checkpoint_delta : 0);
+
+      /* And write out: */
+
+      MPI_File file;
+      ierr = MPI_File_open(mpi_communicator,
+                           filename.c_str(),
+                           MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                           MPI_INFO_NULL,
+                           &file);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_set_size(file, 0);
+      AssertThrowMPI(ierr);
+
+      if (rank == 0) {
+        ierr = MPI_File_write_at(file,
+                                 0,
+                                 &header,
+                                 sizeof(header),
+                                 MPI_BYTE,
+                                 MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+      }
+
+      ierr = MPI_File_write_at_all(file,
+                                   raw_checkpoint_alignment +
+                                       rank * sizeof(RawCheckpointEntry),
+                                   &entry,
+                                   sizeof(entry),
+                                   MPI_BYTE,
+                                   MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_write_at_all(file,
+                                   entry.offset,
+                                   payload,
+                                   entry.n_bytes,
+                                   MPI_BYTE,
+                                   MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_close(&file);
+      AssertThrowMPI(ierr);
+
+      return entry.checksum;
+    }
+
+
+    /*
+     * Read the array [@p data, @p data + @p size) of every rank from the
+     * file @p filename with collective MPI IO. The header is checked for
+     * consistency with the current number of ranks and local sizes.
+     * Uncompressed checkpoints are read directly into @p data. For a
+     * delta checkpoint @p data has to hold the state of the corresponding
+     * full checkpoint on entry. The checksum of the restored state is
+     * verified and returned.
+     */
+    template <typename Number>
+    std::uint64_t read_raw_checkpoint(const std::string &filename,
+                                      Number *data,
+                                      const std::size_t size,
+                                      const unsigned int n_components,
+                                      const MPI_Comm &mpi_communicator)
+    {
+      const auto rank = Utilities::MPI::this_mpi_process(mpi_communicator);
+      const auto n_ranks = Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+      MPI_File file;
+      int ierr = MPI_File_open(mpi_communicator,
+                               filename.c_str(),
+                               MPI_MODE_RDONLY,
+                               MPI_INFO_NULL,
+                               &file);
+      AssertThrow(ierr == MPI_SUCCESS,
+                  ExcMessage("Raw checkpoint: could not open file " +
+                             filename));
+
+      RawCheckpointHeader header;
+      ierr = MPI_File_read_at_all(
+          file, 0, &header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      AssertThrow(std::memcmp(header.magic, raw_checkpoint_magic, 8) == 0 &&
+                      header.n_components == n_components &&
+                      header.number_size == sizeof(Number),
+                  ExcMessage("Raw checkpoint: file " + filename +
+                             " has an incompatible format"));
+      AssertThrow(header.n_ranks == n_ranks,
+                  ExcMessage("Raw checkpoint: the checkpoint has been "
+                             "written with a different number of MPI ranks"));
+
+      RawCheckpointEntry entry;
+      ierr = MPI_File_read_at_all(file,
+                                  raw_checkpoint_alignment +
+                                      rank * sizeof(RawCheckpointEntry),
+                                  &entry,
+                                  sizeof(entry),
+                                  MPI_BYTE,
+                                  MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      AssertThrow(entry.n_values == size,
+                  ExcMessage("Raw checkpoint: the checkpoint has been "
+                             "written for a different partition"));
+
+      const bool compressed = header.flags & raw_checkpoint_compressed;
+      const bool delta = header.flags & raw_checkpoint_delta;
+
+      if (delta) {
+        AssertThrow(raw_checkpoint_checksum(data, size * sizeof(Number)) ==
+                        entry.reference_checksum,
+                    ExcMessage("Raw checkpoint: the delta checkpoint " +
+                               filename +
+                               " does not match the full checkpoint"));
+      }
+
+      if (!compressed) {
+        ierr = MPI_File_read_at_all(file,
+                                    entry.offset,
+                                    data,
+                                    entry.n_bytes,
+                                    MPI_BYTE,
+                                    MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+      } else {
+#ifdef WITH_ZSTD
+        std::vector<char> buffer(entry.n_bytes);
+        ierr = MPI_File_read_at_all(file,
+                                    entry.offset,
+                                    buffer.data(),
+                                    entry.n_bytes,
+                                    MPI_BYTE,
+                                    MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+        std::vector<char> shuffled(size * sizeof(Number));
+        const auto n_bytes = ZSTD_decompress(
+            shuffled.data(), shuffled.size(), buffer.data(), buffer.size());
+        AssertThrow(!ZSTD_isError(n_bytes) && n_bytes == shuffled.size(),
+                    ExcMessage("Raw checkpoint: decompression failed"));
+
+        raw_checkpoint_unshuffle(shuffled.data(),
+                                 reinterpret_cast<char *>(data),
+                                 delta,
+                                 size,
+                                 sizeof(Number));
+#else
+        AssertThrow(false,
+                    ExcMessage("Compressed checkpoints require ryujin to be "
+                               "configured with zstd support (WITH_ZSTD)"));
+#endif
+      }
+
+      ierr = MPI_File_close(&file);
+      AssertThrowMPI(ierr);
+
+      AssertThrow(raw_checkpoint_checksum(data, size * sizeof(Number)) ==
+                      entry.checksum,
+                  ExcMessage("Raw checkpoint: checksum mismatch in file " +
+                             filename));
+
+      return entry.checksum;
+    }
+
+
+    /*
+     * Return the number of ranks the raw checkpoint @p filename has been
+     * written with (or zero if the file cannot be read). The header is
+     * read on rank 0 and broadcast.
+     */
+    inline std::uint64_t
+    raw_checkpoint_n_ranks(const std::string &filename,
+                           const MPI_Comm &mpi_communicator)
+    {
+      std::uint64_t n_ranks = 0;
+
+      if (Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
+        RawCheckpointHeader header;
+        std::ifstream file(filename, std::ios::binary);
+        if (file.read(reinterpret_cast<char *>(&header), sizeof(header)) &&
+            std::memcmp(header.magic, raw_checkpoint_magic, 8) == 0)
+          n_ranks = header.n_ranks;
+      }
+
+      const int ierr =
+          MPI_Bcast(&n_ranks, 1, MPI_UINT64_T, 0, mpi_communicator);
+      AssertThrowMPI(ierr);
+
+      return n_ranks;
+    }
+
+
+    /*
+     * A buddy checkpoint is a single contiguous buffer consisting of a
+     * BuddyCheckpointHeader followed by the locally owned part of the
+     * state vector. The very same buffer is written to the node-local
+     * file and sent to the buddy rank.
+     */
+    struct BuddyCheckpointHeader {
+      char magic[8];
+      std::uint64_t n_ranks;
+      std::uint64_t number_size;
+      std::uint64_t n_values;
+      std::uint64_t output_cycle;
+      double t;
+      std::uint64_t checksum;
+    };
+
+    constexpr char buddy_checkpoint_magic[8] = {
+        'r', 'y', 'u', 'j', 'i', 'n', 'b', 'c'};
+
+    constexpr int buddy_checkpoint_tag = 8107;
+
+
+    /*
+     * Write @p buffer to @p filename. The buffer is written to a temporary
+     * file first that is then renamed, so that an existing (older) copy is
+     * only replaced by a complete new one.
+     */
+    inline void write_buddy_file(const std::string &filename,
+                                 const std::vector<char> &buffer)
+    {
+      const auto temporary = filename + ".part";
+      {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(buffer.data(), buffer.size());
+        AssertThrow(file.good(),
+                    ExcMessage("Buddy checkpoint: could not write file " +
+                               temporary));
+      }
+      std::filesystem::rename(temporary, filename);
+    }
+
+
+    /*
+     * The common prefix of all buddy checkpoint files, the rank whose
+     * state is stored and the suffix ".own" or ".copy" are appended.
+     */
+    inline std::string buddy_checkpoint_prefix(const std::string &directory,
+                                               const std::string &base_name)
+    {
+      return directory + "/" +
+             std::filesystem::path(base_name).filename().string() + "-buddy-";
+    }
+
+
+    /*
+     * Read the complete file @p filename into a buffer. An empty buffer is
+     * returned if the file does not exist or cannot be read.
+     */
+    inline std::vector<char> read_buddy_file(const std::string &filename)
+    {
+      std::vector<char> buffer;
+      std::ifstream file(filename, std::ios::binary | std::ios::ate);
+      if (!file)
+        return buffer;
+
+      buffer.resize(file.tellg());
+      file.seekg(0);
+      file.read(buffer.data(), buffer.size());
+      if (!file)
+        buffer.clear();
+      return buffer;
+    }
+
+
+    /*
+     * Return true if @p buffer holds a valid buddy checkpoint with @p
+     * n_values values of type Number for a run with @p n_ranks ranks.
+     */
+    template <typename Number>
+    bool valid_buddy_checkpoint(const std::vector<char> &buffer,
+                                const std::size_t n_values,
+                                const unsigned int n_ranks)
+    {
+      BuddyCheckpointHeader header;
+      if (buffer.size() != sizeof(header) + n_values * sizeof(Number))
+        return false;
+
+      std::memcpy(&header, buffer.data(), sizeof(header));
+      return std::memcmp(header.magic, buddy_checkpoint_magic, 8) == 0 &&
+             header.n_ranks == n_ranks &&
+             header.number_size == sizeof(Number) &&
+             header.n_values == n_values &&
+             raw_checkpoint_checksum(buffer.data() + sizeof(header),
+                                     n_values * sizeof(Number)) ==
+                 header.checksum;
+    }
+
+
+    /*
+     * Return the optimal checkpoint interval (the compute time between
+     * two checkpoints) for a checkpoint cost @p cost and a mean time
+     * between failures @p mtbf, following Daly's higher order
+     * approximation of Young's formula.
+     */
+    inline double daly_checkpoint_interval(const double cost,
+                                           const double mtbf)
+    {
+      if (cost >= 2. * mtbf)
+        return mtbf;
+
+      const double ratio = cost / (2. * mtbf);
+      return std::sqrt(2. * cost * mtbf) *
+                 (1. + std::sqrt(ratio) / 3. + ratio / 9.) -
+             cost;
+    }
+
+
+    /*
+     * A packed cycle statistic consists of five doubles: the sum, the
+     * minimum, the maximum, and the ranks attaining the minimum and
+     * maximum. The user defined MPI operation combines all of them in a
+     * single (non-blocking) reduction.
+     */
+    constexpr int n_packed_statistic = 5;
+
+    void reduce_packed_statistics(void *in,
+                                  void *inout,
+                                  int *length,
+                                  MPI_Datatype * /*datatype*/)
+    {
+      const auto *source = static_cast<const double *>(in);
+      auto *target = static_cast<double *>(inout);
+
+      for (int k = 0; k < *length; ++k) {
+        const double *a = source + n_packed_statistic * k;
+        double *b = target + n_packed_statistic * k;
+
+        b[0] += a[0];
+        if (a[1] < b[1] || (a[1] == b[1] && a[3] < b[3])) {
+          b[1] = a[1];
+          b[3] = a[3];
+        }
+        if (a[2] > b[2] || (a[2] == b[2] && a[4] < b[4])) {
+          b[2] = a[2];
+          b[4] = a[4];
+        }
+      }
+    }
+
+
+    /*
+     * Copy the locally owned and ghost values of @p source into
+     * @p destination (which is reinitialized if the partitioners
+     * differ). Contrary to the assignment operator this does not
+     * communicate.
+     */
+    template <typename Vector>
+    void copy_locally_relevant(Vector &destination, const Vector &source)
+    {
+      if (destination.get_partitioner() != source.get_partitioner())
+        destination.reinit(source, /*omit_zeroing_entries*/ true);
+
+      const auto &partitioner = *source.get_partitioner();
+      std::copy_n(source.begin(),
+                  partitioner.locally_owned_size() +
+                      partitioner.n_ghost_indices(),
+                  destination.begin());
+      destination.set_ghost_state(source.has_ghost_elements());
+    }
+  } // namespace
+
+
   template <typename Description, int dim, typename Number>
-  TimeLoop<Description, dim, Number>::TimeLoop(const MPI_Comm &mpi_comm)
+  TimeLoop<Description, dim, Number>::TimeLoop(const MPI_Comm &mpi_comm,
+                                               const MPI_Comm &time_comm)
       : ParameterAcceptor("/A - TimeLoop")
       , mpi_communicator_(mpi_comm)
+      , time_communicator_(time_comm)
+      , time_slice_(dealii::Utilities::MPI::this_mpi_process(time_comm))
+      , n_time_slices_(dealii::Utilities::MPI::n_mpi_processes(time_comm))
+      , output_communicator_(
+            dealii::Utilities::MPI::duplicate_communicator(mpi_comm))
+      , checkpoint_communicator_(
+            dealii::Utilities::MPI::duplicate_communicator(mpi_comm))
+      , statistics_mode_(StatisticsMode::blocking)
       , hyperbolic_system_("/B - Equation")
       , parabolic_system_("/B - Equation")
       , discretization_(mpi_communicator_, "/C - Discretization")
@@ -50,17 +636,22 @@ namespace ryujin
                          hyperbolic_module_,
                          parabolic_module_,
                          "/H - TimeIntegrator")
+      , coarse_time_integrator_(mpi_communicator_,
+                                offline_data_,
+                                hyperbolic_module_,
+                                parabolic_module_,
+                                "/H - TimeIntegrator/coarse propagator")
       , mesh_adaptor_(mpi_communicator_,
                       offline_data_,
                       hyperbolic_system_,
                       parabolic_system_,
                       "/I - MeshAdaptor")
-      , postprocessor_(mpi_communicator_,
+      , postprocessor_(output_communicator_,
                        offline_data_,
                        hyperbolic_system_,
                        parabolic_system_,
                        "/J - VTUOutput")
-      , vtu_output_(mpi_communicator_,
+      , vtu_output_(output_communicator_,
                     offline_data_,
                     hyperbolic_system_,
                     parabolic_system_,
@@ -68,7 +659,7 @@ namespace ryujin
                     hyperbolic_module_.initial_precomputed(),
                     hyperbolic_module_.alpha(),
                     "/J - VTUOutput")
-      , quantities_(mpi_communicator_,
+      , quantities_(output_communicator_,
                     offline_data_,
                     hyperbolic_system_,
                     parabolic_system_,
@@ -76,6 +667,13 @@ namespace ryujin
       , mpi_rank_(dealii::Utilities::MPI::this_mpi_process(mpi_communicator_))
       , n_mpi_processes_(
             dealii::Utilities::MPI::n_mpi_processes(mpi_communicator_))
+      , peak_bandwidth_(0.)
+      , checkpoint_reference_checksum_(0)
+      , n_delta_checkpoints_(0)
+      , buddy_requests_{{MPI_REQUEST_NULL, MPI_REQUEST_NULL}}
+      , buddy_offset_(1)
+      , dry_run_(false)
+      , coupling_t_(0.)
   {
     base_name_ = "test";
     add_parameter("basename", base_name_, "Base name for all output files");
@@ -90,6 +688,28 @@ namespace ryujin
                   "enforced strictly. If set to true the last time step is "
                   "shortened so that the simulation ends precisely at t_final");
 
+    steady_state_tolerance_ = 0.;
+    add_parameter("steady state tolerance",
+                  steady_state_tolerance_,
+                  "If set to a value larger than zero, the relative steady "
+                  "state residual |U^{n+1} - U^n|_1 / (tau |U^{n+1}|_1) "
+                  "(weighted with the lumped mass matrix) is computed every "
+                  "\"steady state check interval\" cycles. The computation "
+                  "is terminated with a final output once the residual stays "
+                  "below the tolerance for \"steady state checks\" "
+                  "consecutive checks");
+
+    steady_state_interval_ = 10;
+    add_parameter("steady state check interval",
+                  steady_state_interval_,
+                  "Number of cycles between two steady state checks");
+
+    steady_state_checks_ = 3;
+    add_parameter("steady state checks",
+                  steady_state_checks_,
+                  "Number of consecutive steady state checks below the "
+                  "tolerance required for terminating the computation");
+
     timer_granularity_ = Number(0.01);
     add_parameter("timer granularity",
                   timer_granularity_,
@@ -98,6 +718,18 @@ namespace ryujin
                   "routines are run. This \"baseline tick\" is further "
                   "modified by the corresponding \"*_multiplier\" options");
 
+    output_interpolation_ = false;
+    add_parameter(
+        "output interpolation",
+        output_interpolation_,
+        "If set to true, full, levelsets, region, and in-situ output follow "
+        "independent schedules (given by \"timer granularity\" and the "
+        "respective multiplier) and are written at precisely the scheduled "
+        "time by interpolating linearly between the states before and after "
+        "the time step crossing it. Otherwise, output is written for the "
+        "first state reaching a timer tick. Checkpoints and quantities of "
+        "interest are always computed for the unmodified state");
+
     enable_checkpointing_ = false;
     add_parameter(
         "enable checkpointing",
@@ -106,6 +738,77 @@ namespace ryujin
         "granularity intervals. The frequency is determined by \"timer "
         "granularity\" and \"timer checkpoint multiplier\"");
 
+    asynchronous_checkpointing_ = false;
+    add_parameter(
+        "asynchronous checkpointing",
+        asynchronous_checkpointing_,
+        "Copy the state into a checkpoint buffer and write out checkpoints "
+        "on a background thread overlapping with subsequent time steps. The "
+        "mesh (and a serialized state) is written on the main thread, only "
+        "the raw state and the metadata are written in the background. "
+        "Running on more than one MPI rank requires MPI_THREAD_MULTIPLE "
+        "support");
+
+    checkpoint_format_ = CheckpointFormat::serialization;
+    add_parameter(
+        "checkpoint format",
+        checkpoint_format_,
+        "The file format used for storing the state vector in checkpoints. "
+        "Valid choices are \"serialization\" (parallel serialization with "
+        "the mesh, allows to resume with a different number of MPI ranks) "
+        "and \"raw\" (raw binary file written and read with collective "
+        "MPI IO directly from and into the state vector, requires the same "
+        "number of MPI ranks on resume)");
+
+    checkpoint_compression_ = false;
+    add_parameter(
+        "checkpoint compression",
+        checkpoint_compression_,
+        "Raw checkpoint format only: byte-shuffle and compress the state "
+        "vector with zstd (lossless) before writing it out. Requires ryujin "
+        "to be configured with zstd support");
+
+    checkpoint_full_interval_ = 1;
+    add_parameter(
+        "checkpoint full interval",
+        checkpoint_full_interval_,
+        "Raw checkpoint format with compression only: If set to a value N "
+        "larger than one then only every N-th checkpoint stores the full "
+        "state. All other checkpoints store the (compressed) XOR "
+        "difference to the last full checkpoint in a separate file "
+        "\"<basename>-checkpoint.state.delta\" which is verified by a "
+        "checksum and applied on resume. The last full state is kept in "
+        "memory for this purpose");
+
+    checkpoint_elastic_ = false;
+    add_parameter(
+        "checkpoint elastic",
+        checkpoint_elastic_,
+        "Raw checkpoint format only: additionally attach the state vector "
+        "as cell data to the serialized mesh. On resume the raw state is "
+        "used if the number of MPI ranks is unchanged, otherwise the state "
+        "is transferred to the new partition with SolutionTransfer. This "
+        "allows to resume a computation on more or fewer MPI ranks");
+
+    buddy_checkpoint_interval_ = 0;
+    add_parameter(
+        "buddy checkpoint interval",
+        buddy_checkpoint_interval_,
+        "If set to a value N larger than zero then every N cycles each rank "
+        "stores the locally owned part of the state in a file in the "
+        "node-local \"buddy checkpoint directory\" and sends a copy to its "
+        "buddy rank (mpi rank + ranks per node, thus on another node) that "
+        "stores it in its own node-local directory. On "
+        "resume the state is restored from these copies if a consistent "
+        "set is available (same number of ranks, no mesh adaptation), "
+        "otherwise the regular checkpoint is read");
+
+    buddy_checkpoint_directory_ = "/dev/shm";
+    add_parameter("buddy checkpoint directory",
+                  buddy_checkpoint_directory_,
+                  "A node-local (ideally memory backed) directory for "
+                  "storing buddy checkpoints");
+
     enable_output_full_ = false;
     add_parameter("enable output full",
                   enable_output_full_,
@@ -119,6 +822,22 @@ namespace ryujin
         "Write out levelsets pvtu records. The frequency is determined by "
         "\"timer granularity\" and \"timer output levelsets multiplier\"");
 
+    enable_output_region_ = false;
+    add_parameter(
+        "enable output region",
+        enable_output_region_,
+        "Write out pvtu records of a (decimated) region of interest. The "
+        "frequency is determined by \"timer granularity\" and \"timer output "
+        "region multiplier\"");
+
+    enable_output_insitu_ = false;
+    add_parameter(
+        "enable output insitu",
+        enable_output_insitu_,
+        "Hand the state vector and postprocessed quantities to all attached "
+        "in-situ consumers. The frequency is determined by \"timer "
+        "granularity\" and \"timer output insitu multiplier\"");
+
     enable_compute_error_ = false;
     add_parameter("enable compute error",
                   enable_compute_error_,
@@ -143,12 +862,41 @@ namespace ryujin
         "on adapting the mesh is determined by \"timer granularity\" and "
         "\"timer mesh refinement multiplier\"");
 
+    asynchronous_postprocessing_ = false;
+    add_parameter(
+        "asynchronous postprocessing",
+        asynchronous_postprocessing_,
+        "Copy the state vector into a snapshot buffer whenever output or "
+        "quantities of interest are due and run the postprocessor, the vtu "
+        "output, in-situ consumers and the quantities of interest on a "
+        "background thread. The time loop only waits if all \"snapshot "
+        "buffers\" are in use. The snapshot also holds a copy of the "
+        "indicator (alpha). Running on more than one MPI rank requires "
+        "MPI_THREAD_MULTIPLE support");
+
+    snapshot_buffers_ = 2;
+    add_parameter("snapshot buffers",
+                  snapshot_buffers_,
+                  "Asynchronous postprocessing: maximal number of state "
+                  "vector copies held by postprocessing jobs in flight");
+
     timer_checkpoint_multiplier_ = 1;
     add_parameter("timer checkpoint multiplier",
                   timer_checkpoint_multiplier_,
                   "Multiplicative modifier applied to \"timer granularity\" "
                   "that determines the checkpointing granularity");
 
+    checkpoint_mtbf_ = 0.;
+    add_parameter(
+        "checkpoint mtbf",
+        checkpoint_mtbf_,
+        "If set to a value larger than zero then checkpoints are scheduled "
+        "in wall clock time instead of with \"timer checkpoint "
+        "multiplier\": The value is the expected mean time between "
+        "failures (in seconds) of the whole job. The cost of every "
+        "checkpoint is measured and the next checkpoint is scheduled after "
+        "the optimal interval of the Young/Daly model");
+
     timer_output_full_multiplier_ = 1;
     add_parameter("timer output full multiplier",
                   timer_output_full_multiplier_,
@@ -161,6 +909,18 @@ namespace ryujin
                   "Multiplicative modifier applied to \"timer granularity\" "
                   "that determines the levelsets pvtu writeout granularity");
 
+    timer_output_region_multiplier_ = 1;
+    add_parameter("timer output region multiplier",
+                  timer_output_region_multiplier_,
+                  "Multiplicative modifier applied to \"timer granularity\" "
+                  "that determines the region pvtu writeout granularity");
+
+    timer_output_insitu_multiplier_ = 1;
+    add_parameter("timer output insitu multiplier",
+                  timer_output_insitu_multiplier_,
+                  "Multiplicative modifier applied to \"timer granularity\" "
+                  "that determines the in-situ consumer granularity");
+
     timer_compute_quantities_multiplier_ = 1;
     add_parameter(
         "timer compute quantities multiplier",
@@ -191,12 +951,32 @@ namespace ryujin
                   resume_at_time_zero_,
                   "Resume from the latest checkpoint but set the time to t=0.");
 
+    warm_start_ = "";
+    add_parameter(
+        "warm start",
+        warm_start_,
+        "If set to the base name of a previous run on the same coarse mesh "
+        "then the initial state is interpolated from the last checkpoint "
+        "of that run (which may use a different mesh refinement and number "
+        "of MPI ranks). The checkpoint must have been written with the "
+        "\"serialization\" format or with \"checkpoint elastic\"");
+
     terminal_update_interval_ = 5;
     add_parameter("terminal update interval",
                   terminal_update_interval_,
                   "Number of seconds after which output statistics are "
                   "recomputed and printed on the terminal");
 
+    terminal_nonblocking_statistics_ = true;
+    add_parameter("terminal nonblocking statistics",
+                  terminal_nonblocking_statistics_,
+                  "If set to true then all statistics printed on the terminal "
+                  "(and in the log file) are reduced with a single "
+                  "non-blocking collective that is started in one cycle and "
+                  "consumed (and printed) in the next cycle. The decision "
+                  "whether to update the terminal is also communicated "
+                  "without blocking and applied one cycle later");
+
     terminal_show_rank_throughput_ = true;
     add_parameter("terminal show rank throughput",
                   terminal_show_rank_throughput_,
@@ -206,6 +986,188 @@ namespace ryujin
                   "average per thread \"CPU\" throughput value is computed by "
                   "using the umodified total accumulated CPU time.");
 
+    halo_statistics_layers_ = 0;
+    add_parameter("halo statistics layers",
+                  halo_statistics_layers_,
+                  "If set to a value larger than one, report the number of "
+                  "ghost degrees of freedom of an extended halo with up to "
+                  "the given number of layers together with the MPI "
+                  "partition. The ratio to the number of locally owned "
+                  "degrees of freedom estimates the redundant work of "
+                  "exchanging a wider halo once per time step instead of a "
+                  "single layer for every stage.");
+
+    temporal_blocking_block_size_ = 0;
+    add_parameter(
+        "temporal blocking block size",
+        temporal_blocking_block_size_,
+        "If set to a value larger than zero, report the redundant work of "
+        "a temporal blocking scheme with blocks of the given number of "
+        "consecutive rows together with the MPI partition: Every block is "
+        "extended by \"temporal blocking layers\" layers of its stencil "
+        "that would have to be recomputed when advancing the block through "
+        "several sweeps before moving on to the next one");
+
+    temporal_blocking_layers_ = 3;
+    add_parameter("temporal blocking layers",
+                  temporal_blocking_layers_,
+                  "Number of stencil layers a block has to be extended by "
+                  "for the temporal blocking estimate, i.e., the dependency "
+                  "radius of all sweeps that are blocked together");
+
+    thread_schedule_ = ThreadSchedule::static_schedule;
+    add_parameter("thread schedule",
+                  thread_schedule_,
+                  "The OpenMP loop schedule used for all thread-parallel "
+                  "loops. Valid choices are \"static\", \"dynamic\", and "
+                  "\"guided\". A dynamic or guided schedule might improve "
+                  "load balancing for strongly varying row lengths, for "
+                  "example on adaptively refined meshes");
+
+    thread_schedule_chunk_size_ = 0;
+    add_parameter("thread schedule chunk size",
+                  thread_schedule_chunk_size_,
+                  "The chunk size (in loop iterations) used for the thread "
+                  "schedule. A value of 0 selects the default chunk size of "
+                  "the OpenMP runtime");
+
+    pin_threads_ = false;
+    add_parameter("pin threads",
+                  pin_threads_,
+                  "If set to true the OpenMP threads of every rank are pinned "
+                  "compactly to the CPUs of the affinity mask of the rank. "
+                  "Independently of this option the number of OpenMP and TBB "
+                  "threads is limited to the size of the affinity mask, and "
+                  "the resulting core map of all ranks is recorded in the log "
+                  "file");
+
+    performance_report_interval_ = 0;
+    add_parameter("performance report interval",
+                  performance_report_interval_,
+                  "If set to a nonzero value N then a machine readable "
+                  "performance report (per-stage wall times, thread "
+                  "imbalance, streamed bytes estimate, time spent in MPI "
+                  "synchronization, and restart counts) is appended every N "
+                  "cycles to the file \"<basename>-performance.jsonl\" (or "
+                  "\".csv\")");
+
+    performance_report_format_ = PerformanceReportFormat::json;
+    add_parameter("performance report format",
+                  performance_report_format_,
+                  "The file format of the performance report. Valid choices "
+                  "are \"json\" (one JSON object per line) and \"csv\"");
+
+    timeline_trace_interval_ = 0;
+    add_parameter("timeline trace interval",
+                  timeline_trace_interval_,
+                  "If set to a nonzero value N then begin and end events of "
+                  "all timer sections, ghost exchanges, and communication "
+                  "thread payloads are recorded for every thread and "
+                  "written every N cycles in the Chrome trace event format "
+                  "to the file \"<basename>-trace-p<rank>.json\" (the files "
+                  "of all ranks share a common time base and can be merged "
+                  "with \"jq -s add\")");
+
+    roofline_probe_ = false;
+    add_parameter("roofline probe",
+                  roofline_probe_,
+                  "If set to true the sustainable memory bandwidth of every "
+                  "rank is measured with a STREAM-style triad at startup. "
+                  "The timer statistics then report the achieved bandwidth "
+                  "of the individual stages of the hyperbolic update as a "
+                  "percentage of this peak value");
+
+    autotune_cycles_ = 0;
+    add_parameter("autotune cycles",
+                  autotune_cycles_,
+                  "If set to a nonzero value N then the first cycles of the "
+                  "main loop are used to autotune performance options that "
+                  "do not alter the computed solution: The thread schedule, "
+                  "the fused low order update, and the vectorization of "
+                  "non-internal rows are tuned one after the other by "
+                  "running N cycles with every choice. The fastest choice "
+                  "(by the maximal wall time over all ranks spent in the "
+                  "time step timers) is kept, reported, and recorded in "
+                  "the log file and \"<basename>-parameters.prm\"");
+
+    benchmark_cycles_ = 0;
+    add_parameter("benchmark cycles",
+                  benchmark_cycles_,
+                  "If set to a nonzero value N then ryujin runs in scaling "
+                  "benchmark mode: For every combination of mesh refinement "
+                  "and thread count N cycles are performed without any "
+                  "output and a consolidated scaling table is printed");
+
+    add_parameter("benchmark refinements",
+                  benchmark_refinements_,
+                  "Scaling benchmark mode: list of mesh refinement levels to "
+                  "sweep over. If empty the \"mesh refinement\" parameter of "
+                  "the Discretization is used");
+
+    add_parameter("benchmark threads",
+                  benchmark_threads_,
+                  "Scaling benchmark mode: list of thread counts per rank to "
+                  "sweep over. Values exceeding the number of available "
+                  "threads are ignored. If empty all available threads are "
+                  "used");
+
+    dry_run_cycles_ = 10;
+    add_parameter("dry run cycles",
+                  dry_run_cycles_,
+                  "Dry run mode (--dry-run): number of cycles of the "
+                  "calibration run on the proxy refinement level");
+
+    dry_run_cells_per_rank_ = 20000;
+    add_parameter("dry run cells per rank",
+                  dry_run_cells_per_rank_,
+                  "Dry run mode (--dry-run): the proxy refinement level is "
+                  "the finest refinement level with at most this number of "
+                  "active cells per rank");
+
+    dry_run_memory_budget_ = 0.;
+    add_parameter("dry run memory budget",
+                  dry_run_memory_budget_,
+                  "Dry run mode (--dry-run): available memory per rank in "
+                  "GiB. If set to a nonzero value the number of ranks needed "
+                  "for the requested refinement level is estimated");
+
+    add_parameter(
+        "ensemble parameter files",
+        ensemble_parameter_files_,
+        "Ensemble mode: list of parameter files, one per ensemble member. If "
+        "nonempty, the main loop is run once for every member on the same "
+        "mesh and with the same offline data. Every parameter file is parsed "
+        "on top of the current parameters and may only change options that "
+        "do not affect the mesh and offline data, for example initial "
+        "values, equation parameters, or the final time. Output files are "
+        "suffixed with \"-member_<n>\"");
+
+    parareal_iterations_ = 5;
+    add_parameter("parareal iterations",
+                  parareal_iterations_,
+                  "Parallel in time mode (see \"parallel in time slices\" in "
+                  "subsection \"B - Equation\"): maximal number of Parareal "
+                  "iterations");
+
+    parareal_tolerance_ = 1.e-6;
+    add_parameter("parareal tolerance",
+                  parareal_tolerance_,
+                  "Parallel in time mode: the Parareal iteration terminates "
+                  "once the relative change (in the maximum norm) of the end "
+                  "states of all time slices is below this tolerance");
+
+    rank_order_file_ = "";
+    add_parameter(
+        "rank order file",
+        rank_order_file_,
+        "If set to a nonempty string then a topology-aware placement of "
+        "the MPI ranks is computed from the ghost exchange pattern of the "
+        "initial partition and written to this file in the format of "
+        "MPICH_RANK_ORDER files. A subsequent run (for example a resume) "
+        "with the same number of ranks can be launched with this rank "
+        "order so that neighboring partitions are placed onto nearby "
+        "nodes");
+
     debug_filename_ = "";
     add_parameter("debug filename",
                   debug_filename_,
@@ -216,21 +1178,134 @@ namespace ryujin
 
 
   template <typename Description, int dim, typename Number>
-  void TimeLoop<Description, dim, Number>::run()
+  TimeLoop<Description, dim, Number>::~TimeLoop()
   {
-#ifdef DEBUG_OUTPUT
-    std::cout << "TimeLoop<dim, Number>::run()" << std::endl;
-#endif
+    /* Make sure that no exception escapes from the destructor: */
+    for (auto &[snapshot, status] : snapshot_jobs_)
+      if (status.valid())
+        status.wait();
+    snapshot_jobs_.clear();
+    if (checkpoint_status_.valid())
+      checkpoint_status_.wait();
+
+    dealii::Utilities::MPI::free_communicator(output_communicator_);
+    dealii::Utilities::MPI::free_communicator(checkpoint_communicator_);
+  }
 
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::prepare_run()
+  {
     /*
      * Attach log file and record runtime parameters:
      */
 
+    /* Every time slice of the parallel in time mode has its own files: */
+    if (n_time_slices_ > 1)
+      base_name_ += "-slice_" + std::to_string(time_slice_);
+
     if (mpi_rank_ == 0)
       logfile_.open(base_name_ + ".log");
 
     print_parameters(logfile_);
 
+    if constexpr (requires { hyperbolic_system_.pressure_table_report(); }) {
+      const auto report = hyperbolic_system_.pressure_table_report();
+      if (!report.empty())
+        print_info(report);
+    }
+
+    thread_affinity_ = pin_threads(pin_threads_);
+    const unsigned int n_threads = thread_affinity_.thread_cpus.size();
+    if (n_threads < MultithreadInfo::n_threads()) {
+      print_info("limiting the number of threads to the affinity mask of " +
+                 std::to_string(n_threads) + " CPUs");
+      MultithreadInfo::set_thread_limit(n_threads);
+    }
+
+    set_thread_schedule(thread_schedule_, thread_schedule_chunk_size_);
+
+#ifdef PERF_COUNTERS
+    if (!PerfCounters::instance().initialize())
+      print_info("hardware performance counters are not available "
+                 "(check perf_event_paranoid)");
+#endif
+
+    if (timeline_trace_interval_ != 0)
+      Tracer::instance().enable(base_name_, mpi_communicator_);
+
+    if (EnergyCounters::instance().initialize(mpi_communicator_))
+      print_info("recording node energy counters");
+
+#ifdef DEAL_II_WITH_MPI
+    if ((asynchronous_postprocessing_ || asynchronous_checkpointing_) &&
+        n_mpi_processes_ > 1) {
+      int provided;
+      const int ierr = MPI_Query_thread(&provided);
+      AssertThrowMPI(ierr);
+      AssertThrow(provided == MPI_THREAD_MULTIPLE,
+                  dealii::ExcMessage(
+                      "Asynchronous postprocessing and checkpointing issue "
+                      "MPI calls from a background thread and require an MPI "
+                      "library initialized with MPI_THREAD_MULTIPLE"));
+    }
+#endif
+
+    AssertThrow(snapshot_buffers_ > 0,
+                dealii::ExcMessage("\"snapshot buffers\" must be at least 1"));
+    AssertThrow(steady_state_interval_ > 0,
+                dealii::ExcMessage(
+                    "\"steady state check interval\" must be at least 1"));
+
+    if (roofline_probe_) {
+      print_info("measuring memory bandwidth");
+      /* Run the probe on all ranks (and thus all sockets) concurrently: */
+      MPI_Barrier(mpi_communicator_);
+      peak_bandwidth_ = stream_triad_bandwidth();
+    }
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::prepare_kernels(const Number t)
+  {
+    print_info("preparing compute kernels");
+
+    discretization_.update_mapping_cache();
+    offline_data_.prepare(problem_dimension, n_precomputed_values);
+    {
+      /* Report the maximal wall time over all ranks of every phase: */
+      std::ostringstream info;
+      info << "offline data phases:";
+      std::string separator = " ";
+      for (const auto &[phase, time] : offline_data_.setup_timings()) {
+        const auto max_time = Utilities::MPI::max(time, mpi_communicator_);
+        info << separator << phase << " " << std::setprecision(2)
+             << std::fixed << max_time << "s";
+        separator = ", ";
+      }
+      print_info(info.str());
+    }
+    hyperbolic_module_.prepare();
+    parabolic_module_.prepare();
+    time_integrator_.prepare();
+    mesh_adaptor_.prepare(/*needs current timepoint*/ t);
+    postprocessor_.prepare();
+    vtu_output_.prepare();
+    quantities_.prepare(base_name_);
+    print_mpi_partition(logfile_);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::run()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::run()" << std::endl;
+#endif
+
+    prepare_run();
+
     /*
      * Prepare data structures:
      */
@@ -242,29 +1317,68 @@ namespace ryujin
     /*
      * Create a small lambda for preparing compute kernels:
      */
-    const auto prepare_compute_kernels = [&]() {
-      print_info("preparing compute kernels");
-
-      offline_data_.prepare(problem_dimension, n_precomputed_values);
-      hyperbolic_module_.prepare();
-      parabolic_module_.prepare();
-      time_integrator_.prepare();
-      mesh_adaptor_.prepare(/*needs current timepoint*/ t);
-      postprocessor_.prepare();
-      vtu_output_.prepare();
-      quantities_.prepare(base_name_);
-      print_mpi_partition(logfile_);
-    };
+    const auto prepare_compute_kernels = [&]() { prepare_kernels(t); };
+
+    if (dry_run_) {
+      run_dry_run(prepare_compute_kernels);
+      return;
+    }
+
+    if (benchmark_cycles_ != 0) {
+      run_scaling_benchmark(prepare_compute_kernels);
+      return;
+    }
+
+    if (n_time_slices_ > 1) {
+      run_parareal(prepare_compute_kernels);
+      return;
+    }
+
+    /* Make a copy, a member parameter file might override the list: */
+    const auto ensemble_parameter_files = ensemble_parameter_files_;
+    const bool ensemble_mode = !ensemble_parameter_files.empty();
+
+    AssertThrow(!ensemble_mode || !(resume_ || enable_checkpointing_ ||
+                                    enable_mesh_adaptivity_),
+                ExcMessage("The ensemble mode cannot be combined with "
+                           "checkpointing, resuming from a checkpoint, or "
+                           "mesh adaptivity"));
+
+    AssertThrow(buddy_checkpoint_interval_ == 0 ||
+                    !(ensemble_mode || enable_mesh_adaptivity_ ||
+                      mesh_adaptor_.periodic_rebalance()),
+                ExcMessage("Buddy checkpoints cannot be combined with the "
+                           "ensemble mode, mesh adaptivity, or periodic "
+                           "rebalancing"));
+
+    if (buddy_checkpoint_interval_ != 0)
+      select_buddy_offset();
 
     {
       Scope scope(computing_timer_, "(re)initialize data structures");
       print_info("initializing data structures");
 
       if (resume_) {
-        print_info("resume: reading mesh and loading state vector");
+        bool restored = false;
+        if (buddy_checkpoint_interval_ != 0) {
+          print_info("resume: restoring state vector from buddy checkpoints");
+          restored = read_buddy_checkpoint(state_vector,
+                                           base_name_,
+                                           t,
+                                           timer_cycle,
+                                           prepare_compute_kernels);
+        }
 
-        read_checkpoint(
-            state_vector, base_name_, t, timer_cycle, prepare_compute_kernels);
+        if (!restored) {
+          if (buddy_checkpoint_interval_ != 0)
+            print_info("resume: no consistent set of buddy checkpoints");
+          print_info("resume: reading mesh and loading state vector");
+          read_checkpoint(state_vector,
+                          base_name_,
+                          t,
+                          timer_cycle,
+                          prepare_compute_kernels);
+        }
 
         if (resume_at_time_zero_) {
           /* Reset the current time t and the output cycle count to zero: */
@@ -282,146 +1396,516 @@ namespace ryujin
         Vectors::reinit_state_vector<Description>(state_vector, offline_data_);
         std::get<0>(state_vector) =
             initial_values_.interpolate_hyperbolic_vector();
+
+        if (!warm_start_.empty()) {
+          print_info("warm start: interpolating state of \"" + warm_start_ +
+                     "\"");
+          read_warm_start(state_vector, warm_start_);
+        }
       }
     }
 
-    unsigned int cycle = 1;
-    Number last_terminal_output = (terminal_update_interval_ == Number(0.)
-                                       ? std::numeric_limits<Number>::max()
-                                       : std::numeric_limits<Number>::lowest());
+    if (!rank_order_file_.empty()) {
+      print_info("computing topology-aware rank order");
+      write_rank_order();
+    }
 
     /*
-     * The honorable main loop:
+     * In ensemble mode we run the main loop once for every ensemble
+     * member reusing the mesh and all offline data:
      */
 
-    print_info("entering main loop");
-    computing_timer_["time loop"].start();
+    const unsigned int n_members =
+        ensemble_mode ? ensemble_parameter_files.size() : 1;
+    std::string base_name = base_name_;
+
+    /*
+     * Autotuning mode: Every option is represented by the
+     * ParameterAcceptor it belongs to, its name, and the list of
+     * admissible values. Options are set through the ParameterHandler,
+     * which updates the member variable bound via add_parameter() and
+     * records the choice for a later output of the parameter file.
+     */
 
-    for (;; ++cycle) {
+    using AutotuneOption = std::tuple<const ParameterAcceptor *,
+                                      std::string,
+                                      std::vector<std::string>>;
+    const std::vector<AutotuneOption> autotune_options{
+        {this, "thread schedule", {"static", "dynamic", "guided"}},
+        {&hyperbolic_module_, "fused low order update", {"false", "true"}},
+        {&hyperbolic_module_,
+         "vectorize non-internal rows",
+         {"false", "true"}}};
+
+    const auto set_autotune_option = [&](const AutotuneOption &option,
+                                         const std::string &value) {
+      const auto &[acceptor, name, values] = option;
+      const auto section_path = acceptor->get_section_path();
+      for (const auto &section : section_path)
+        ParameterAcceptor::prm.enter_subsection(section);
+      ParameterAcceptor::prm.set(name, value);
+      for (unsigned int i = 0; i < section_path.size(); ++i)
+        ParameterAcceptor::prm.leave_subsection();
+      set_thread_schedule(thread_schedule_, thread_schedule_chunk_size_);
+    };
 
-#ifdef DEBUG_OUTPUT
-      std::cout << "\n\n###   cycle = " << cycle << "   ###\n\n" << std::endl;
-#endif
+    const auto time_step_wall_time = [&]() {
+      double wall_time = 0.;
+      for (auto &[name, timer] : computing_timer_)
+        if (name.rfind("time step [H]", 0) == 0 ||
+            name.rfind("time step [P]", 0) == 0)
+          wall_time += timer.wall_time();
+      return Utilities::MPI::max(wall_time, mpi_communicator_);
+    };
 
-      /* Accumulate quantities of interest: */
+    unsigned int autotune_option = 0;
+    unsigned int autotune_value = 0;
+    unsigned int autotune_best_value = 0;
+    unsigned int autotune_cycle = 0;
+    double autotune_start = 0.;
+    double autotune_best_time = std::numeric_limits<double>::max();
 
-      if (enable_compute_quantities_) {
-        Scope scope(computing_timer_,
-                    "time step [X]   - accumulate quantities");
-        quantities_.accumulate(state_vector, t);
+    /*
+     * A small lambda advancing the autotuner before every cycle: After
+     * autotune_cycles_ cycles with a given value the elapsed wall time is
+     * compared to the best value so far and the next value is selected.
+     * Once all values of an option have been tried, the fastest is
+     * locked in and we continue with the next option.
+     */
+    const auto autotune = [&]() {
+      if (autotune_cycles_ == 0 || autotune_option == autotune_options.size())
+        return;
+
+      if (autotune_cycle == autotune_cycles_) {
+        const auto &[acceptor, name, values] =
+            autotune_options[autotune_option];
+
+        const auto elapsed = time_step_wall_time() - autotune_start;
+        if (mpi_rank_ == 0)
+          logfile_ << "[INFO] autotuning: \"" << name << " = "
+                   << values[autotune_value] << "\" took " << elapsed
+                   << "s for " << autotune_cycles_ << " cycles" << std::endl;
+        if (elapsed < autotune_best_time) {
+          autotune_best_time = elapsed;
+          autotune_best_value = autotune_value;
+        }
+        autotune_cycle = 0;
+
+        if (++autotune_value == values.size()) {
+          set_autotune_option(autotune_options[autotune_option],
+                              values[autotune_best_value]);
+          print_info("autotuning: selected \"" + name + " = " +
+                     values[autotune_best_value] + "\"");
+
+          ++autotune_option;
+          autotune_value = 0;
+          autotune_best_value = 0;
+          autotune_best_time = std::numeric_limits<double>::max();
+
+          if (autotune_option == autotune_options.size()) {
+            /* Record the final choice in the log and parameter file: */
+            print_parameters(logfile_);
+            return;
+          }
+        }
       }
 
-      /* Perform various tasks whenever we reach a timer tick: */
+      if (autotune_cycle == 0) {
+        const auto &option = autotune_options[autotune_option];
+        set_autotune_option(option, std::get<2>(option)[autotune_value]);
+        autotune_start = time_step_wall_time();
+      }
 
-      if (t >= timer_cycle * timer_granularity_) {
-        output(state_vector, base_name_ + "-solution", t, timer_cycle);
+      ++autotune_cycle;
+    };
 
-        if (enable_compute_error_) {
-          StateVector analytic;
-          {
-            /*
-             * FIXME: We interpolate the analytic solution at every timer
-             * tick. If we happen to actually not output anything then this
-             * is terribly inefficient...
-             */
-            Scope scope(computing_timer_,
-                        "time step [X]   - interpolate analytic solution");
-            Vectors::reinit_state_vector<Description>(analytic, offline_data_);
-            std::get<0>(analytic) =
-                initial_values_.interpolate_hyperbolic_vector(t);
-          }
-          output(analytic, base_name_ + "-analytic_solution", t, timer_cycle);
-        }
+    for (unsigned int member = 0; member < n_members; ++member) {
 
-        if (enable_compute_quantities_ &&
-            (timer_cycle % timer_compute_quantities_multiplier_ == 0)) {
-          Scope scope(computing_timer_,
-                      "time step [X]   - write out quantities");
-          quantities_.write_out(state_vector, t, timer_cycle);
-        }
+      if (ensemble_mode) {
+        Scope scope(computing_timer_, "(re)initialize data structures");
+        base_name = base_name_ + "-member_" + std::to_string(member);
+        prepare_ensemble_member(ensemble_parameter_files[member],
+                                base_name,
+                                state_vector,
+                                t,
+                                timer_cycle);
+      }
 
-        ++timer_cycle;
+      /*
+       * The schedules of the interpolated output streams start at the
+       * first timer cycle (that is a multiple of the respective
+       * multiplier) not yet written:
+       */
+      std::array<unsigned int, 4> next_output_cycle;
+      {
+        const std::array<unsigned int, 4> multipliers{
+            timer_output_full_multiplier_,
+            timer_output_levelsets_multiplier_,
+            timer_output_region_multiplier_,
+            timer_output_insitu_multiplier_};
+        for (unsigned int s = 0; s < 4; ++s)
+          next_output_cycle[s] =
+              (timer_cycle + multipliers[s] - 1) / multipliers[s] *
+              multipliers[s];
       }
 
-      /* Break if we have reached the final time. */
+      const bool interpolate_output =
+          output_interpolation_ &&
+          (enable_output_full_ || enable_output_levelsets_ ||
+           enable_output_region_ ||
+           (enable_output_insitu_ && !insitu_consumers_.empty()));
+
+      StateVector old_state_vector;
+      StateVector interpolated_state_vector;
+      if (interpolate_output)
+        output_interpolated(interpolated_state_vector,
+                            state_vector,
+                            state_vector,
+                            base_name,
+                            t,
+                            t,
+                            next_output_cycle);
+
+      unsigned int cycle = 1;
+      Number last_terminal_output =
+          (terminal_update_interval_ == Number(0.)
+               ? std::numeric_limits<Number>::max()
+               : std::numeric_limits<Number>::lowest());
+
+      /* Non-blocking broadcast of the terminal update decision of rank 0: */
+      int update_terminal_flag = 0;
+      MPI_Request update_terminal_request = MPI_REQUEST_NULL;
+
+      /* Consecutive steady state checks below the tolerance: */
+      unsigned int n_steady_state_checks = 0;
+      bool steady_state_reached = false;
 
       /*
-       * Make sure that we do not loop forever due to roundoff errors when
-       * enforce_t_final_ is set to true.
+       * Wall clock checkpointing: The cost of a checkpoint is not known
+       * before the first one, so we checkpoint right away:
        */
-      const auto relax =
-          enforce_t_final_
-              ? Number(1. - 10. * std::numeric_limits<Number>::epsilon())
-              : Number(1.);
+      double next_checkpoint_wall_time = 0.;
 
-      if (t >= relax * t_final_)
-        break;
+      /*
+       * The honorable main loop:
+       */
 
-      /* Peform a mesh adaptation cycle: */
+      print_info("entering main loop");
+      computing_timer_["time loop"].start();
 
-      if (enable_mesh_adaptivity_) {
-        {
+      for (;; ++cycle) {
+
+#ifdef DEBUG_OUTPUT
+        std::cout << "\n\n###   cycle = " << cycle << "   ###\n\n"
+                  << std::endl;
+#endif
+
+        /* Accumulate quantities of interest: */
+
+        if (enable_compute_quantities_) {
           Scope scope(computing_timer_,
-                      "time step [X]   - analyze for mesh adaptation");
+                      "time step [X]   - accumulate quantities");
+          if (asynchronous_postprocessing_) {
+            /*
+             * The point probes communicate over the communicator of the
+             * triangulation, so we evaluate them here on the main thread:
+             */
+            const auto probe_values = std::make_shared<
+                typename Quantities<Description, dim, Number>::ProbeValues>(
+                quantities_.evaluate_point_probes(state_vector));
+            post_snapshot_job(state_vector,
+                              [this, t, probe_values](
+                                  const StateVector &snapshot,
+                                  const ScalarVector & /*alpha*/) {
+                                quantities_.accumulate(
+                                    snapshot, t, probe_values.get());
+                              });
+          } else {
+            quantities_.accumulate(state_vector, t);
+          }
+        }
+
+        /* Perform various tasks whenever we reach a timer tick: */
+
+        if (t >= timer_cycle * timer_granularity_ || steady_state_reached) {
+          output(state_vector, base_name + "-solution", t, timer_cycle);
+
+          if (enable_compute_error_ && !output_interpolation_) {
+            StateVector analytic;
+            {
+              /*
+               * FIXME: We interpolate the analytic solution at every timer
+               * tick. If we happen to actually not output anything then this
+               * is terribly inefficient...
+               */
+              Scope scope(computing_timer_,
+                          "time step [X]   - interpolate analytic solution");
+              Vectors::reinit_state_vector<Description>(analytic,
+                                                        offline_data_);
+              std::get<0>(analytic) =
+                  initial_values_.interpolate_hyperbolic_vector(t);
+            }
+            output(
+                analytic, base_name + "-analytic_solution", t, timer_cycle);
+          }
 
-          mesh_adaptor_.analyze(state_vector, t, cycle);
+          if (enable_compute_quantities_ &&
+              (timer_cycle % timer_compute_quantities_multiplier_ == 0)) {
+            Scope scope(computing_timer_,
+                        "time step [X]   - write out quantities");
+            if (asynchronous_postprocessing_)
+              post_snapshot_job(
+                  state_vector,
+                  [this, t, timer_cycle](const StateVector &snapshot,
+                                         const ScalarVector & /*alpha*/) {
+                    quantities_.write_out(snapshot, t, timer_cycle);
+                  });
+            else
+              quantities_.write_out(state_vector, t, timer_cycle);
+          }
+
+          ++timer_cycle;
         }
 
-        if (mesh_adaptor_.need_mesh_adaptation()) {
-          Scope scope(computing_timer_, "(re)initialize data structures");
-          print_info("performing mesh adaptation");
+        /* Break if we have reached the final time. */
+
+        /*
+         * Make sure that we do not loop forever due to roundoff errors when
+         * enforce_t_final_ is set to true.
+         */
+        const auto relax =
+            enforce_t_final_
+                ? Number(1. - 10. * std::numeric_limits<Number>::epsilon())
+                : Number(1.);
 
-          hyperbolic_module_.prepare_state_vector(state_vector, t);
-          adapt_mesh_and_transfer_state_vector(state_vector,
-                                               prepare_compute_kernels);
+        if (t >= relax * t_final_ || steady_state_reached)
+          break;
+
+        /* Peform a mesh adaptation cycle: */
+
+        if (enable_mesh_adaptivity_ || mesh_adaptor_.periodic_rebalance()) {
+          {
+            Scope scope(computing_timer_,
+                        "time step [X]   - analyze for mesh adaptation");
+
+            mesh_adaptor_.analyze(state_vector, t, cycle);
+          }
+
+          const bool refine =
+              enable_mesh_adaptivity_ && mesh_adaptor_.need_mesh_adaptation();
+
+          if (refine || mesh_adaptor_.need_mesh_rebalance()) {
+            Scope scope(computing_timer_, "(re)initialize data structures");
+            print_info(refine ? "performing mesh adaptation"
+                              : "performing mesh rebalance");
+
+            hyperbolic_module_.prepare_state_vector(state_vector, t);
+            finalize_checkpoint();
+            finalize_postprocessing();
+            vtu_output_.finalize_output();
+            adapt_mesh_and_transfer_state_vector(
+                state_vector, prepare_compute_kernels, refine);
+          }
         }
-      }
 
-      /* Perform a time step: */
+        /* Perform a time step: */
 
-      const auto tau = time_integrator_.step(
-          state_vector,
-          t,
-          enforce_t_final_ ? t_final_ : std::numeric_limits<Number>::max());
+        autotune();
 
-      t += tau;
+        if (interpolate_output) {
+          if (std::get<0>(old_state_vector).get_partitioner() !=
+              std::get<0>(state_vector).get_partitioner())
+            Vectors::reinit_state_vector<Description>(old_state_vector,
+                                                      offline_data_);
+          std::get<0>(old_state_vector)
+              .copy_locally_owned_data_from(std::get<0>(state_vector));
+        }
 
-      /* Print and record cycle statistics: */
-      if (terminal_update_interval_ != Number(0.)) {
-        const bool write_to_log_file = (t >= timer_cycle * timer_granularity_);
+        const bool check_steady_state = steady_state_tolerance_ > 0. &&
+                                        cycle % steady_state_interval_ == 0;
+        hyperbolic_module_.monitor_steady_state() = check_steady_state;
+
+        const auto tau = time_integrator_.step(
+            state_vector,
+            t,
+            enforce_t_final_ ? t_final_ : std::numeric_limits<Number>::max());
+
+        t += tau;
+
+        if (check_steady_state) {
+          const auto [change, norm] =
+              hyperbolic_module_.steady_state_residual();
+          const double global_change =
+              Utilities::MPI::sum(change, mpi_communicator_);
+          const double global_norm =
+              Utilities::MPI::sum(norm, mpi_communicator_);
+          const double residual =
+              global_norm == 0. ? 0. : global_change / global_norm;
+
+          n_steady_state_checks =
+              residual < steady_state_tolerance_ ? n_steady_state_checks + 1
+                                                 : 0;
+          if (n_steady_state_checks >= steady_state_checks_) {
+            std::ostringstream info;
+            info << "steady state reached (residual " << std::scientific
+                 << std::setprecision(2) << residual << ")";
+            print_info(info.str());
+            steady_state_reached = true;
+
+            /* Make sure that the final output writes a full solution: */
+            const auto multiplier =
+                std::max(1u, timer_output_full_multiplier_);
+            timer_cycle =
+                (timer_cycle + multiplier - 1) / multiplier * multiplier;
+          }
+        }
 
-        const auto wall_time = computing_timer_["time loop"].wall_time();
-        int update_terminal =
-            (wall_time >= last_terminal_output + terminal_update_interval_);
+        if (interpolate_output)
+          output_interpolated(interpolated_state_vector,
+                              old_state_vector,
+                              state_vector,
+                              base_name,
+                              t - tau,
+                              t,
+                              next_output_cycle);
 
-        /* Broadcast boolean from rank 0 to all other ranks: */
-        const auto ierr =
-            MPI_Bcast(&update_terminal, 1, MPI_INT, 0, mpi_communicator_);
-        AssertThrowMPI(ierr);
+        if (buddy_checkpoint_interval_ != 0) {
+          Scope scope(computing_timer_,
+                      "time step [X]   - perform buddy checkpointing");
+          if (cycle % buddy_checkpoint_interval_ == 0)
+            write_buddy_checkpoint(state_vector, t, timer_cycle);
+          else
+            finalize_buddy_checkpoint(/*wait*/ false);
+        }
+
+        if (enable_checkpointing_ && checkpoint_mtbf_ > 0.) {
+          /* Broadcast the decision of rank 0 to all other ranks: */
+          int checkpoint_now = computing_timer_["time loop"].wall_time() >=
+                               next_checkpoint_wall_time;
+          auto ierr =
+              MPI_Bcast(&checkpoint_now, 1, MPI_INT, 0, mpi_communicator_);
+          AssertThrowMPI(ierr);
+
+          if (checkpoint_now) {
+            Scope scope(computing_timer_,
+                        "time step [X]   - perform checkpointing");
+            print_info("scheduling checkpointing");
+
+            Timer timer;
+            timer.start();
+            hyperbolic_module_.prepare_state_vector(state_vector, t);
+            write_checkpoint(state_vector, base_name_, t, timer_cycle);
+            timer.stop();
+
+            const double cost =
+                Utilities::MPI::max(timer.wall_time(), mpi_communicator_);
+            const double interval =
+                daly_checkpoint_interval(cost, checkpoint_mtbf_);
+            next_checkpoint_wall_time =
+                computing_timer_["time loop"].wall_time() + interval;
+
+            std::ostringstream info;
+            info << "checkpoint cost " << std::fixed << std::setprecision(2)
+                 << cost << "s, next checkpoint in " << interval << "s";
+            print_info(info.str());
+          }
+        }
+
+        if (performance_report_interval_ != 0 &&
+            cycle % performance_report_interval_ == 0)
+          write_performance_report(cycle, t);
 
-        if (write_to_log_file || update_terminal) {
-          print_cycle_statistics(
-              cycle, t, timer_cycle, /*logfile*/ write_to_log_file);
-          last_terminal_output = wall_time;
+        if (timeline_trace_interval_ != 0 &&
+            cycle % timeline_trace_interval_ == 0)
+          Tracer::instance().flush();
+
+        /* Print and record cycle statistics: */
+        if (terminal_update_interval_ != Number(0.)) {
+          const bool write_to_log_file =
+              (t >= timer_cycle * timer_granularity_);
+
+          const auto wall_time = computing_timer_["time loop"].wall_time();
+
+          if (terminal_nonblocking_statistics_) {
+            /*
+             * Print the statistics whose reduction was started in the
+             * previous cycle, and consume the terminal update decision
+             * that rank 0 broadcast in the previous cycle:
+             */
+            finish_cycle_statistics();
+
+            int update_terminal = 0;
+            if (update_terminal_request != MPI_REQUEST_NULL) {
+              const auto ierr =
+                  MPI_Wait(&update_terminal_request, MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+              update_terminal = update_terminal_flag;
+            }
+
+            if (write_to_log_file || update_terminal) {
+              start_cycle_statistics(
+                  cycle, t, timer_cycle, /*logfile*/ write_to_log_file);
+              last_terminal_output = wall_time;
+            }
+
+            update_terminal_flag =
+                (wall_time >= last_terminal_output + terminal_update_interval_);
+            const auto ierr = MPI_Ibcast(&update_terminal_flag,
+                                         1,
+                                         MPI_INT,
+                                         0,
+                                         mpi_communicator_,
+                                         &update_terminal_request);
+            AssertThrowMPI(ierr);
+
+          } else {
+            int update_terminal =
+                (wall_time >= last_terminal_output + terminal_update_interval_);
+
+            /* Broadcast boolean from rank 0 to all other ranks: */
+            const auto ierr =
+                MPI_Bcast(&update_terminal, 1, MPI_INT, 0, mpi_communicator_);
+            AssertThrowMPI(ierr);
+
+            if (write_to_log_file || update_terminal) {
+              print_cycle_statistics(
+                  cycle, t, timer_cycle, /*logfile*/ write_to_log_file);
+              last_terminal_output = wall_time;
+            }
+          }
         }
+      } /* end of loop */
+
+      /* Flush pending non-blocking statistics: */
+      finish_cycle_statistics();
+      if (update_terminal_request != MPI_REQUEST_NULL) {
+        const auto ierr = MPI_Wait(&update_terminal_request, MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
       }
-    } /* end of loop */
 
-    /* We have actually performed one cycle less. */
-    --cycle;
+      finalize_checkpoint();
+      finalize_buddy_checkpoint();
+      finalize_postprocessing();
+      vtu_output_.finalize_output();
 
-    computing_timer_["time loop"].stop();
+      /* We have actually performed one cycle less. */
+      --cycle;
 
-    if (terminal_update_interval_ != Number(0.)) {
-      /* Write final timing statistics to screen and logfile: */
-      print_cycle_statistics(
-          cycle, t, timer_cycle, /*logfile*/ true, /*final*/ true);
-    }
+      computing_timer_["time loop"].stop();
 
-    if (enable_compute_error_) {
-      /* Output final error: */
-      compute_error(state_vector, t);
-    }
+      if (terminal_update_interval_ != Number(0.)) {
+        /* Write final timing statistics to screen and logfile: */
+        print_cycle_statistics(
+            cycle, t, timer_cycle, /*logfile*/ true, /*final*/ true);
+      }
+
+      if (enable_compute_error_) {
+        /* Output final error: */
+        compute_error(state_vector, t);
+      }
+    } /* end of ensemble loop */
+
+    Tracer::instance().finalize();
 
     if (mpi_rank_ == 0 && debug_filename_ != "") {
       std::ifstream f(debug_filename_);
@@ -435,6 +1919,688 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::prepare_ensemble_member(
+      const std::string &parameter_file,
+      const std::string &base_name,
+      StateVector &state_vector,
+      Number &t,
+      unsigned int &output_cycle)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::prepare_ensemble_member()"
+              << std::endl;
+#endif
+
+    print_info("ensemble mode: preparing member " + base_name);
+
+    /*
+     * Parse the parameter file of the ensemble member on top of the
+     * current parameters and run all parse_parameters_call_back()
+     * signals. The mesh and the offline data are not recreated.
+     */
+    ParameterAcceptor::prm.parse_input(parameter_file,
+                                       "",
+                                       /* skip undefined */ true,
+                                       /* assert entries present */ false);
+    ParameterAcceptor::parse_all_parameters();
+
+    /*
+     * Recreate all compute kernels that might depend on run-time
+     * parameters:
+     */
+    hyperbolic_module_.prepare();
+    parabolic_module_.prepare();
+    time_integrator_.prepare();
+    postprocessor_.prepare();
+    vtu_output_.prepare();
+    quantities_.prepare(base_name);
+
+    t = 0.;
+    output_cycle = 0;
+
+    Vectors::reinit_state_vector<Description>(state_vector, offline_data_);
+    std::get<0>(state_vector) = initial_values_.interpolate_hyperbolic_vector();
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  template <typename Callable>
+  void TimeLoop<Description, dim, Number>::run_scaling_benchmark(
+      const Callable &prepare_compute_kernels)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::run_scaling_benchmark()" << std::endl;
+#endif
+
+    AssertThrow(!resume_,
+                ExcMessage("The scaling benchmark mode cannot be combined "
+                           "with resuming from a checkpoint"));
+
+    const unsigned int available_threads = max_threads();
+
+    auto refinements = benchmark_refinements_;
+    if (refinements.empty())
+      refinements.push_back(discretization_.refinement());
+
+    std::vector<unsigned int> threads;
+    for (const auto n_threads : benchmark_threads_)
+      if (n_threads > 0 && n_threads <= available_threads)
+        threads.push_back(n_threads);
+    if (threads.empty())
+      threads.push_back(available_threads);
+
+    const auto set_num_threads = [](unsigned int n_threads [[maybe_unused]]) {
+#ifdef WITH_OPENMP
+      omp_set_num_threads(n_threads);
+#endif
+    };
+
+    struct Record {
+      unsigned int refinement;
+      unsigned int n_threads;
+      double n_dofs;
+      double wall_time;
+      double wall_m_dofs_per_sec;
+      double rank_m_dofs_per_sec;
+      double cpu_m_dofs_per_sec;
+      double parallel_efficiency;
+    };
+    std::vector<Record> records;
+
+    for (const auto refinement : refinements) {
+      print_info("scaling benchmark: preparing refinement level " +
+                 std::to_string(refinement));
+
+      /* Recreate the discretization and all compute kernels: */
+      set_num_threads(available_threads);
+      discretization_.refinement() = refinement;
+      discretization_.prepare(base_name_);
+      prepare_compute_kernels();
+
+      const auto n_dofs =
+          static_cast<double>(offline_data_.dof_handler().n_dofs());
+
+      /* Reference throughput per core for the parallel efficiency: */
+      double reference = 0.;
+
+      for (const auto n_threads : threads) {
+        set_num_threads(n_threads);
+
+        StateVector state_vector;
+        Vectors::reinit_state_vector<Description>(state_vector, offline_data_);
+        std::get<0>(state_vector) =
+            initial_values_.interpolate_hyperbolic_vector();
+
+        /* A warm-up step that is not measured: */
+        Number t = 0.;
+        t += time_integrator_.step(
+            state_vector, t, std::numeric_limits<Number>::max());
+
+        const auto efficiency = time_integrator_.efficiency();
+
+        MPI_Barrier(mpi_communicator_);
+        Timer timer;
+        for (unsigned int cycle = 0; cycle < benchmark_cycles_; ++cycle)
+          t += time_integrator_.step(
+              state_vector, t, std::numeric_limits<Number>::max());
+        timer.stop();
+
+        const auto wall_time =
+            Utilities::MPI::max(timer.wall_time(), mpi_communicator_);
+        const auto cpu_time_sum =
+            Utilities::MPI::sum(timer.cpu_time(), mpi_communicator_);
+
+        const double work = benchmark_cycles_ * n_dofs / 1.e6 * efficiency;
+
+        Record record;
+        record.refinement = refinement;
+        record.n_threads = n_threads;
+        record.n_dofs = n_dofs;
+        record.wall_time = wall_time;
+        record.wall_m_dofs_per_sec = work / wall_time;
+        record.rank_m_dofs_per_sec = work / wall_time / n_mpi_processes_;
+        record.cpu_m_dofs_per_sec = work / cpu_time_sum;
+
+        const double per_core =
+            record.wall_m_dofs_per_sec / (n_threads * n_mpi_processes_);
+        if (reference == 0.)
+          reference = per_core;
+        record.parallel_efficiency = per_core / reference;
+
+        records.push_back(record);
+      }
+    }
+
+    set_num_threads(available_threads);
+
+    /* Print the consolidated scaling table: */
+
+    if (mpi_rank_ != 0)
+      return;
+
+    std::ostringstream output;
+    print_head("scaling benchmark", "", output);
+
+    /* clang-format off */
+    output << "  " << n_mpi_processes_ << " MPI ranks, " << benchmark_cycles_
+           << " cycles per run, parallel efficiency relative to the first "
+           << "run of every refinement level\n\n";
+
+    output << std::setw(5) << "ref" << std::setw(9) << "threads"
+           << std::setw(13) << "Qdofs" << std::setw(13) << "Qdofs/core"
+           << std::setw(11) << "wall [s]" << std::setw(12) << "WALL MQ/s"
+           << std::setw(12) << "RANK MQ/s" << std::setw(11) << "CPU MQ/s"
+           << std::setw(8) << "eff." << "\n";
+
+    for (const auto &record : records) {
+      const auto n_cores = record.n_threads * n_mpi_processes_;
+      output << std::setw(5) << record.refinement
+             << std::setw(9) << record.n_threads
+             << std::setw(13) << std::setprecision(0) << std::fixed
+             << record.n_dofs
+             << std::setw(13) << std::setprecision(0) << std::fixed
+             << record.n_dofs / n_cores
+             << std::setw(11) << std::setprecision(3) << std::fixed
+             << record.wall_time
+             << std::setw(12) << std::setprecision(2) << std::fixed
+             << record.wall_m_dofs_per_sec
+             << std::setw(12) << std::setprecision(2) << std::fixed
+             << record.rank_m_dofs_per_sec
+             << std::setw(11) << std::setprecision(2) << std::fixed
+             << record.cpu_m_dofs_per_sec
+             << std::setw(7) << std::setprecision(1) << std::fixed
+             << 100. * record.parallel_efficiency << "%\n";
+    }
+    /* clang-format on */
+
+    std::cout << output.str() << std::flush;
+    logfile_ << output.str() << std::flush;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::dry_run()
+  {
+    dry_run_ = true;
+    run();
+    dry_run_ = false;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  template <typename Callable>
+  void TimeLoop<Description, dim, Number>::run_dry_run(
+      const Callable &prepare_compute_kernels)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::run_dry_run()" << std::endl;
+#endif
+
+    AssertThrow(!resume_,
+                ExcMessage("The dry run mode cannot be combined with "
+                           "resuming from a checkpoint"));
+
+    /* Resident set size (in kiB) before any large allocation: */
+    Utilities::System::MemoryStats stats;
+    Utilities::System::get_memory_stats(stats);
+    const double baseline_rss =
+        Utilities::MPI::max(double(stats.VmRSS), mpi_communicator_);
+
+    /*
+     * Choose the proxy refinement level: Every global refinement
+     * multiplies the number of cells by 2^dim, so the coarse mesh
+     * suffices to determine the finest level within the cell budget.
+     */
+    const unsigned int target = discretization_.refinement();
+
+    print_info("dry run: creating coarse mesh");
+    discretization_.refinement() = 0;
+    discretization_.prepare(base_name_);
+
+    const double coarse_cells =
+        discretization_.triangulation().n_global_active_cells();
+    const double cell_budget =
+        double(dry_run_cells_per_rank_) * n_mpi_processes_;
+
+    unsigned int proxy = 0;
+    while (proxy < target &&
+           coarse_cells * std::pow(2., dim * (proxy + 1)) <= cell_budget)
+      ++proxy;
+
+    print_info("dry run: preparing proxy refinement level " +
+               std::to_string(proxy) + " of " + std::to_string(target));
+
+    discretization_.refinement() = proxy;
+    discretization_.prepare(base_name_);
+    prepare_compute_kernels();
+
+    StateVector state_vector;
+    Vectors::reinit_state_vector<Description>(state_vector, offline_data_);
+    std::get<0>(state_vector) = initial_values_.interpolate_hyperbolic_vector();
+
+    /* A warm-up step that is not measured: */
+    Number t = 0.;
+    t += time_integrator_.step(
+        state_vector, t, std::numeric_limits<Number>::max());
+    const Number t_start = t;
+
+    print_info("dry run: calibrating with " + std::to_string(dry_run_cycles_) +
+               " cycles");
+
+    const unsigned int n_cycles = std::max(dry_run_cycles_, 1u);
+
+    MPI_Barrier(mpi_communicator_);
+    Timer timer;
+    for (unsigned int cycle = 0; cycle < n_cycles; ++cycle)
+      t += time_integrator_.step(
+          state_vector, t, std::numeric_limits<Number>::max());
+    timer.stop();
+
+    const double wall_time_per_cycle =
+        Utilities::MPI::max(timer.wall_time(), mpi_communicator_) / n_cycles;
+    const double tau = double(t - t_start) / n_cycles;
+
+    /*
+     * Memory per locally owned degree of freedom (maximum over all
+     * ranks): the estimate of all major subsystems and the measured
+     * growth of the resident set size. The larger of the two is used for
+     * the extrapolation.
+     */
+    Utilities::System::get_memory_stats(stats);
+
+    const double n_owned = std::max(offline_data_.n_locally_owned(), 1u);
+    const double model_bytes =
+        offline_data_.memory_consumption() +
+        hyperbolic_module_.memory_consumption() +
+        parabolic_module_.memory_consumption() +
+        time_integrator_.memory_consumption() +
+        postprocessor_.memory_consumption() +
+        std::get<0>(state_vector).memory_consumption();
+    const double resident_bytes =
+        std::max(0., double(stats.VmRSS) - baseline_rss) * 1024.;
+
+    const double model_bytes_per_dof =
+        Utilities::MPI::max(model_bytes / n_owned, mpi_communicator_);
+    const double resident_bytes_per_dof =
+        Utilities::MPI::max(resident_bytes / n_owned, mpi_communicator_);
+    const double bytes_per_dof =
+        std::max(model_bytes_per_dof, resident_bytes_per_dof);
+
+    /* Extrapolate to the requested refinement level: */
+
+    const unsigned int levels = target - proxy;
+    const double factor = std::pow(2., dim * levels);
+
+    const auto n_dofs =
+        static_cast<double>(offline_data_.dof_handler().n_dofs());
+    const double n_cells =
+        discretization_.triangulation().n_global_active_cells();
+    const double target_n_dofs = n_dofs * factor;
+    const double target_cells = n_cells * factor;
+
+    const double target_tau = tau / std::pow(2., levels);
+    const double target_cycles =
+        target_tau > 0. ? std::ceil(double(t_final_) / target_tau) : 0.;
+    const double target_time_per_cycle = wall_time_per_cycle * factor;
+    const double time_to_solution = target_cycles * target_time_per_cycle;
+
+    constexpr double GiB = 1024. * 1024. * 1024.;
+    const double baseline_bytes = baseline_rss * 1024.;
+    const double memory_per_rank =
+        baseline_bytes + bytes_per_dof * target_n_dofs / n_mpi_processes_;
+
+    /* Restore the requested refinement level: */
+    discretization_.refinement() = target;
+
+    if (mpi_rank_ != 0)
+      return;
+
+    std::ostringstream output;
+    print_head("dry run", "", output);
+
+    const auto line = [&](const std::string &name) -> std::ostream & {
+      output << "  " << std::left << std::setw(34) << name << std::right;
+      return output;
+    };
+
+    const auto hours = [](const double seconds) {
+      std::ostringstream stream;
+      stream << std::fixed << std::setprecision(2) << seconds / 3600. << " h";
+      return stream.str();
+    };
+
+    output << std::fixed;
+
+    line("MPI ranks") << std::setw(16) << n_mpi_processes_ << "\n";
+    line("proxy refinement level") << std::setw(16) << proxy << "\n";
+    line("requested refinement level") << std::setw(16) << target << "\n";
+    line("proxy active cells") << std::setw(16) << std::setprecision(0)
+                               << n_cells << "\n";
+    line("proxy DoFs") << std::setw(16) << n_dofs << "\n";
+    line("proxy wall time per cycle [s]")
+        << std::setw(16) << std::setprecision(4) << wall_time_per_cycle << "\n";
+    line("proxy tau") << std::setw(16) << std::scientific
+                      << std::setprecision(3) << tau << std::fixed << "\n";
+    line("memory [B/DoF] (model/resident)")
+        << std::setw(16) << std::setprecision(0) << model_bytes_per_dof
+        << " / " << resident_bytes_per_dof << "\n\n";
+
+    line("estimated active cells") << std::setw(16) << target_cells << "\n";
+    line("estimated DoFs") << std::setw(16) << target_n_dofs << "\n";
+    line("estimated DoFs per rank")
+        << std::setw(16) << target_n_dofs / n_mpi_processes_ << "\n";
+    line("estimated memory per rank [GiB]")
+        << std::setw(16) << std::setprecision(2) << memory_per_rank / GiB
+        << "\n";
+    line("estimated cycles") << std::setw(16) << std::setprecision(0)
+                             << target_cycles << "\n";
+    line("estimated wall time per cycle [s]")
+        << std::setw(16) << std::setprecision(4) << target_time_per_cycle
+        << "\n";
+    line("estimated time to solution")
+        << std::setw(16) << hours(time_to_solution) << "\n";
+
+    if (dry_run_memory_budget_ > 0.) {
+      const double available = dry_run_memory_budget_ * GiB - baseline_bytes;
+      output << "\n";
+      if (available <= 0.) {
+        line("memory budget [GiB]")
+            << std::setw(16) << std::setprecision(2) << dry_run_memory_budget_
+            << " (exhausted by the runtime alone)\n";
+      } else {
+        /* Assuming perfect strong scaling of the wall time per cycle: */
+        const double n_ranks =
+            std::max(1., std::ceil(bytes_per_dof * target_n_dofs / available));
+        line("memory budget [GiB]") << std::setw(16) << std::setprecision(2)
+                                    << dry_run_memory_budget_ << "\n";
+        line("ranks needed") << std::setw(16) << std::setprecision(0)
+                             << n_ranks << "\n";
+        line("time to solution with ranks needed")
+            << std::setw(16)
+            << hours(time_to_solution * n_mpi_processes_ / n_ranks) << "\n";
+      }
+    }
+
+    std::cout << output.str() << std::flush;
+    logfile_ << output.str() << std::flush;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  template <typename Callable>
+  void TimeLoop<Description, dim, Number>::run_parareal(
+      const Callable &prepare_compute_kernels)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::run_parareal()" << std::endl;
+#endif
+
+    AssertThrow(!resume_ && !enable_checkpointing_ &&
+                    !enable_mesh_adaptivity_ &&
+                    ensemble_parameter_files_.empty(),
+                ExcMessage("The parallel in time mode cannot be combined "
+                           "with checkpointing, resuming from a checkpoint, "
+                           "mesh adaptivity, or the ensemble mode"));
+
+    const unsigned int slice = time_slice_;
+    const Number t_start = t_final_ * Number(slice) / Number(n_time_slices_);
+    const Number t_end =
+        t_final_ * Number(slice + 1) / Number(n_time_slices_);
+
+    {
+      Scope scope(computing_timer_, "(re)initialize data structures");
+      print_info("parallel in time: creating mesh and interpolating initial "
+                 "values");
+
+      discretization_.prepare(base_name_);
+      prepare_compute_kernels();
+      coarse_time_integrator_.prepare();
+    }
+
+    /*
+     * The state at the beginning of the slice (U_n^k), the result of the
+     * fine propagator (F(U_n^{k-1})), the previous and the current coarse
+     * propagation (G(U_n^{k-1}), G(U_n^k)), and the end state of the
+     * slice (U_{n+1}^k):
+     */
+    StateVector start_state, fine_state, coarse_old, coarse_new, end_state;
+    for (auto *it :
+         {&start_state, &fine_state, &coarse_old, &coarse_new, &end_state})
+      Vectors::reinit_state_vector<Description>(*it, offline_data_);
+
+    std::get<0>(start_state) = initial_values_.interpolate_hyperbolic_vector();
+
+    const auto n_owned = std::get<0>(start_state).locally_owned_size();
+    AssertThrow(Utilities::MPI::min(n_owned, time_communicator_) ==
+                    Utilities::MPI::max(n_owned, time_communicator_),
+                ExcMessage("The partitions of the time slices differ"));
+
+    /* Do not loop forever due to roundoff errors in the last step: */
+    const auto relax =
+        Number(1. - 10. * std::numeric_limits<Number>::epsilon());
+
+    const auto propagate = [&](auto &time_integrator, StateVector &state) {
+      Number t = t_start;
+      while (t < relax * t_end)
+        t += time_integrator.step(state, t, t_end);
+    };
+
+    /*
+     * The partitions of all time slices coincide, the locally owned
+     * parts of the state vectors are exchanged point to point between
+     * ranks with the same rank within their group:
+     */
+
+    const auto copy_U = [](StateVector &dst, const StateVector &src) {
+      std::get<0>(dst) = std::get<0>(src);
+      std::get<0>(dst).update_ghost_values();
+    };
+
+    const auto send_end_state = [&]() {
+      if (slice + 1 == n_time_slices_)
+        return;
+      Scope scope(computing_timer_, "parallel in time - communication");
+      const auto &U = std::get<0>(end_state);
+      const int ierr = MPI_Send(U.begin(),
+                                U.locally_owned_size(),
+                                Utilities::MPI::mpi_type_id_for_type<Number>,
+                                slice + 1,
+                                /*tag*/ 0,
+                                time_communicator_);
+      AssertThrowMPI(ierr);
+    };
+
+    const auto receive_start_state = [&]() {
+      if (slice == 0)
+        return;
+      Scope scope(computing_timer_, "parallel in time - communication");
+      auto &U = std::get<0>(start_state);
+      const int ierr = MPI_Recv(U.begin(),
+                                U.locally_owned_size(),
+                                Utilities::MPI::mpi_type_id_for_type<Number>,
+                                slice - 1,
+                                /*tag*/ 0,
+                                time_communicator_,
+                                MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+      U.update_ghost_values();
+    };
+
+    /*
+     * Iteration 0: a serial sweep of the coarse propagator:
+     */
+
+    Timer timer;
+
+    receive_start_state();
+    copy_U(coarse_old, start_state);
+    {
+      Scope scope(computing_timer_, "parallel in time - coarse propagator");
+      propagate(coarse_time_integrator_, coarse_old);
+    }
+    copy_U(end_state, coarse_old);
+    send_end_state();
+
+    /*
+     * After k iterations the first k slices agree with the serial fine
+     * solution, so at most n_time_slices_ iterations are necessary:
+     */
+
+    const unsigned int n_iterations =
+        std::min(parareal_iterations_, n_time_slices_);
+
+    unsigned int iteration = 1;
+    for (; iteration <= n_iterations; ++iteration) {
+      copy_U(fine_state, start_state);
+      {
+        Scope scope(computing_timer_, "parallel in time - fine propagator");
+        propagate(time_integrator_, fine_state);
+      }
+
+      receive_start_state();
+      copy_U(coarse_new, start_state);
+      {
+        Scope scope(computing_timer_, "parallel in time - coarse propagator");
+        propagate(coarse_time_integrator_, coarse_new);
+      }
+
+      /* Correction: U_{n+1}^k = G(U_n^k) + F(U_n^{k-1}) - G(U_n^{k-1}) */
+      auto &U_new = std::get<0>(fine_state);
+      U_new.add(Number(1.),
+                std::get<0>(coarse_new),
+                Number(-1.),
+                std::get<0>(coarse_old));
+
+      auto &U_end = std::get<0>(end_state);
+      U_end.sadd(Number(-1.), Number(1.), U_new);
+      const Number norm = U_new.linfty_norm();
+      const Number change = U_end.linfty_norm() / std::max(norm, Number(1.));
+
+      copy_U(end_state, fine_state);
+      std::get<0>(coarse_old).swap(std::get<0>(coarse_new));
+      send_end_state();
+
+      const auto max_change =
+          Utilities::MPI::max(double(change), time_communicator_);
+      print_info("parallel in time: iteration " + std::to_string(iteration) +
+                 ", relative change " + std::to_string(max_change));
+
+      if (max_change < parareal_tolerance_)
+        break;
+    }
+
+    timer.stop();
+
+    {
+      std::ostringstream output;
+      print_head("parallel in time", "", output);
+      output << "  " << n_time_slices_ << " time slices with "
+             << n_mpi_processes_ << " MPI ranks each, "
+             << std::min(iteration, n_iterations) << " Parareal iterations, "
+             << std::fixed << std::setprecision(3)
+             << Utilities::MPI::max(timer.wall_time(), mpi_communicator_)
+             << " s wall time\n"
+             << "  slice " << slice << ": [" << std::scientific
+             << std::setprecision(4) << t_start << ", " << t_end << "]\n";
+      if (mpi_rank_ == 0) {
+        std::cout << output.str() << std::flush;
+        logfile_ << output.str() << std::flush;
+      }
+    }
+
+    output(end_state,
+           base_name_,
+           t_end,
+           /*cycle*/ 0,
+           enable_output_full_,
+           enable_output_levelsets_,
+           enable_output_region_,
+           enable_output_insitu_,
+           /*checkpointing*/ false);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::attach_insitu_consumer(
+      const InSituConsumer &consumer)
+  {
+    insitu_consumers_.push_back(consumer);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::initialize()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::initialize()" << std::endl;
+#endif
+
+    prepare_run();
+
+    Scope scope(computing_timer_, "(re)initialize data structures");
+    print_info("initializing data structures");
+
+    coupling_t_ = 0.;
+
+    if (resume_) {
+      print_info("resume: reading mesh and loading state vector");
+      unsigned int output_cycle = 0;
+      read_checkpoint(coupling_state_vector_,
+                      base_name_,
+                      coupling_t_,
+                      output_cycle,
+                      [&]() { prepare_kernels(coupling_t_); });
+      if (resume_at_time_zero_)
+        coupling_t_ = 0.;
+
+    } else {
+      print_info("creating mesh and interpolating initial values");
+      discretization_.prepare(base_name_);
+      prepare_kernels(coupling_t_);
+
+      Vectors::reinit_state_vector<Description>(coupling_state_vector_,
+                                                offline_data_);
+      std::get<0>(coupling_state_vector_) =
+          initial_values_.interpolate_hyperbolic_vector();
+    }
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  Number
+  TimeLoop<Description, dim, Number>::advance(const unsigned int n_steps)
+  {
+    for (unsigned int step = 0; step < n_steps; ++step)
+      coupling_t_ += time_integrator_.step(coupling_state_vector_, coupling_t_);
+
+    return coupling_t_;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  Number TimeLoop<Description, dim, Number>::advance_to(const Number t)
+  {
+    /* Do not loop forever due to roundoff errors in the last step: */
+    const auto relax =
+        Number(1. - 10. * std::numeric_limits<Number>::epsilon());
+
+    while (coupling_t_ < relax * t)
+      coupling_t_ +=
+          time_integrator_.step(coupling_state_vector_, coupling_t_, t);
+
+    return coupling_t_;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  auto TimeLoop<Description, dim, Number>::boundary_data()
+      -> std::vector<state_type> &
+  {
+    return hyperbolic_module_.dirichlet_data(coupling_t_);
+  }
+
+
   template <typename Description, int dim, typename Number>
   template <typename Callable>
   void TimeLoop<Description, dim, Number>::read_checkpoint(
@@ -500,6 +2666,44 @@ namespace ryujin
     Vectors::reinit_state_vector<Description>(state_vector, offline_data_);
     auto &U = std::get<0>(state_vector);
 
+    /*
+     * A raw checkpoint written with a different number of ranks can only
+     * be read through the state attached to the mesh (see "checkpoint
+     * elastic"):
+     */
+    const bool read_raw_state =
+        checkpoint_format_ == CheckpointFormat::raw &&
+        !(std::filesystem::exists(name + ".mesh_fixed.data") &&
+          raw_checkpoint_n_ranks(name + ".state", mpi_communicator_) !=
+              n_mpi_processes_);
+
+    if (read_raw_state) {
+      /* Read the locally owned part directly into the state vector: */
+      const auto size = U.locally_owned_size();
+      checkpoint_reference_checksum_ = read_raw_checkpoint(name + ".state",
+                                                           U.begin(),
+                                                           size,
+                                                           problem_dimension,
+                                                           mpi_communicator_);
+
+      /* Keep the full checkpoint as reference for subsequent deltas: */
+      if (checkpoint_full_interval_ > 1)
+        checkpoint_reference_.assign(U.begin(), U.begin() + size);
+      n_delta_checkpoints_ = 0;
+
+      /* Apply the incremental checkpoint (if any): */
+      if (std::filesystem::exists(name + ".state.delta")) {
+        read_raw_checkpoint(name + ".state.delta",
+                            U.begin(),
+                            size,
+                            problem_dimension,
+                            mpi_communicator_);
+      }
+
+      U.update_ghost_values();
+      return;
+    }
+
     const auto &dof_handler = offline_data_.dof_handler();
     const auto &scalar_partitioner = offline_data_.scalar_partitioner();
 
@@ -533,6 +2737,111 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::read_warm_start(
+      StateVector &state_vector, const std::string &base_name)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::read_warm_start()" << std::endl;
+#endif
+
+    if constexpr (!have_distributed_triangulation<dim>) {
+      AssertThrow(false,
+                  dealii::ExcMessage(
+                      "A warm start is not implemented for "
+                      "distributed::shared::Triangulation which we use in 1D"));
+    } else {
+      const std::string name = base_name + "-checkpoint";
+      AssertThrow(std::filesystem::exists(name + ".mesh_fixed.data"),
+                  dealii::ExcMessage("Warm start: The checkpoint \"" + name +
+                                     "\" does not contain a serialized state "
+                                     "vector"));
+
+      /*
+       * Recreate the mesh of the previous run from our coarse mesh and
+       * its refinement forest:
+       */
+
+      const auto &triangulation = discretization_.triangulation();
+      typename Discretization<dim>::Triangulation source_triangulation(
+          mpi_communicator_);
+      for (const auto id : triangulation.get_manifold_ids())
+        if (id != dealii::numbers::flat_manifold_id)
+          source_triangulation.set_manifold(id, triangulation.get_manifold(id));
+
+      {
+        const auto [vertices, cells, subcell_data] =
+            dealii::GridTools::get_coarse_mesh_description(triangulation);
+        source_triangulation.create_triangulation(
+            vertices, cells, subcell_data);
+      }
+      source_triangulation.load(name + ".mesh");
+
+      const auto &fe = discretization_.finite_element();
+      dealii::DoFHandler<dim> source_dof_handler(source_triangulation);
+      source_dof_handler.distribute_dofs(fe);
+
+      const auto locally_relevant =
+          dealii::DoFTools::extract_locally_relevant_dofs(source_dof_handler);
+
+      using ScalarVector = typename Vectors::ScalarVector<Number>;
+      std::array<ScalarVector, problem_dimension> states;
+      for (auto &it : states)
+        it.reinit(source_dof_handler.locally_owned_dofs(),
+                  locally_relevant,
+                  mpi_communicator_);
+
+      dealii::parallel::distributed::SolutionTransfer<dim, ScalarVector>
+          solution_transfer(source_dof_handler);
+
+      std::vector<ScalarVector *> ptr_state;
+      std::transform(states.begin(),
+                     states.end(),
+                     std::back_inserter(ptr_state),
+                     [](auto &it) { return &it; });
+      solution_transfer.deserialize(ptr_state);
+
+      /*
+       * Evaluate the previous state at our locally owned support points.
+       * The RemotePointEvaluation is set up on first use and reused for
+       * all components:
+       */
+
+      const auto points = initial_values_.locally_owned_support_points();
+      const dealii::MappingQ<dim> source_mapping(fe.degree);
+      dealii::Utilities::MPI::RemotePointEvaluation<dim> evaluation;
+
+      std::array<std::vector<Number>, problem_dimension> values;
+      for (unsigned int d = 0; d < problem_dimension; ++d) {
+        states[d].update_ghost_values();
+        values[d] = dealii::VectorTools::point_values<1>(
+            source_mapping, source_dof_handler, states[d], points, evaluation);
+      }
+
+      auto &U = std::get<0>(state_vector);
+
+      unsigned int n_missing = 0;
+      for (unsigned int i = 0; i < points.size(); ++i) {
+        if (!evaluation.point_found(i)) {
+          ++n_missing;
+          continue;
+        }
+        state_type U_i;
+        for (unsigned int d = 0; d < problem_dimension; ++d)
+          U_i[d] = values[d][i];
+        U.write_tensor(U_i, i);
+      }
+      U.update_ghost_values();
+
+      n_missing = Utilities::MPI::sum(n_missing, mpi_communicator_);
+      if (n_missing > 0)
+        print_info("warm start: " + std::to_string(n_missing) +
+                   " support points outside of the previous mesh keep "
+                   "their initial values");
+    }
+  }
+
+
   template <typename Description, int dim, typename Number>
   void TimeLoop<Description, dim, Number>::write_checkpoint(
       const StateVector &state_vector,
@@ -550,71 +2859,580 @@ namespace ryujin
                     "distributed::shared::Triangulation which we use in 1D"));
 
     /*
-     * Create SolutionTransfer object, attach state vector and write out:
+     * Wait for a previous checkpoint to finish and copy the state into the
+     * checkpoint buffer:
      */
 
-    const auto &triangulation = discretization_.triangulation();
-    const auto &dof_handler = offline_data_.dof_handler();
+    finalize_checkpoint();
+
     const auto &scalar_partitioner = offline_data_.scalar_partitioner();
     auto &U = std::get<0>(state_vector);
 
-    using ScalarVector = typename Vectors::ScalarVector<Number>;
-    std::array<ScalarVector, problem_dimension> states;
-    unsigned int d = 0;
-    for (auto &it : states) {
-      it.reinit(scalar_partitioner);
-      U.extract_component(it, d++);
-    }
+    const bool raw_format = (checkpoint_format_ == CheckpointFormat::raw);
 
-    /* Create SolutionTransfer object, attach state vector and write out: */
+    const bool serialize_state = !raw_format || checkpoint_elastic_;
 
-    dealii::parallel::distributed::SolutionTransfer<dim, ScalarVector>
-        solution_transfer(dof_handler);
+    if (raw_format)
+      checkpoint_buffer_.assign(U.begin(), U.begin() + U.locally_owned_size());
 
-    std::vector<const ScalarVector *> ptr_state;
-    std::transform(states.begin(),
-                   states.end(),
-                   std::back_inserter(ptr_state),
-                   [](auto &it) { return &it; });
-    solution_transfer.prepare_for_serialization(ptr_state);
+    if (serialize_state) {
+      unsigned int d = 0;
+      for (auto &it : checkpoint_states_) {
+        if (it.get_partitioner() != scalar_partitioner)
+          it.reinit(scalar_partitioner);
+        U.extract_component(it, d++);
+      }
+    }
 
-    std::string name = base_name + "-checkpoint";
+    AssertThrow(!(checkpoint_compression_ || checkpoint_full_interval_ > 1) ||
+                    raw_format,
+                ExcMessage("Compressed and incremental checkpoints require "
+                           "the raw checkpoint format"));
+    AssertThrow(checkpoint_full_interval_ <= 1 || checkpoint_compression_,
+                ExcMessage("Incremental checkpoints require checkpoint "
+                           "compression"));
+    AssertThrow(!checkpoint_elastic_ || raw_format,
+                ExcMessage("Elastic checkpoints require the raw checkpoint "
+                           "format, the serialization format is always "
+                           "elastic"));
+
+    const std::string name = base_name + "-checkpoint";
+
+    /*
+     * Incremental checkpoints: Write a delta against the last full
+     * checkpoint unless we have none (on this rank), or the full
+     * checkpoint interval has been reached:
+     */
+    const bool delta = Utilities::MPI::logical_and(
+        checkpoint_full_interval_ > 1 &&
+            checkpoint_reference_.size() == checkpoint_buffer_.size() &&
+            n_delta_checkpoints_ + 1 < checkpoint_full_interval_,
+        mpi_communicator_);
 
     if (mpi_rank_ == 0) {
-      for (const std::string suffix :
-           {".mesh", ".mesh_fixed.data", ".mesh.info", ".metadata"})
+      for (const std::string suffix : {".mesh",
+                                       ".mesh_fixed.data",
+                                       ".mesh.info",
+                                       ".metadata",
+                                       ".state",
+                                       ".state.delta"}) {
+        /* A delta checkpoint refers to the last full state: */
+        if (delta && suffix == ".state")
+          continue;
         if (std::filesystem::exists(name + suffix))
           std::filesystem::rename(name + suffix, name + suffix + "~");
+      }
     }
 
+    /*
+     * The mesh (and the serialized state) are written with collective
+     * operations on the communicator of the triangulation. We thus always
+     * write them on the main thread:
+     */
+    {
+      const auto &triangulation = discretization_.triangulation();
+      const auto &dof_handler = offline_data_.dof_handler();
+
+      /* Create SolutionTransfer object, attach state vector and write out: */
+
+      dealii::parallel::distributed::SolutionTransfer<dim, ScalarVector>
+          solution_transfer(dof_handler);
+
+      if (serialize_state) {
+        std::vector<const ScalarVector *> ptr_state;
+        std::transform(checkpoint_states_.begin(),
+                       checkpoint_states_.end(),
+                       std::back_inserter(ptr_state),
+                       [](auto &it) { return &it; });
+        solution_transfer.prepare_for_serialization(ptr_state);
+      }
+
 #if !DEAL_II_VERSION_GTE(9, 6, 0)
-    if constexpr (have_distributed_triangulation<dim>) {
+      if constexpr (have_distributed_triangulation<dim>) {
 #endif
-      triangulation.save(name + ".mesh");
+        triangulation.save(name + ".mesh");
 #if !DEAL_II_VERSION_GTE(9, 6, 0)
+      }
+#endif
     }
+
+    /*
+     * The raw state and the metadata are written by the payload. If
+     * asynchronous checkpointing is enabled the payload runs on the
+     * checkpoint thread and only communicates over the (duplicated)
+     * checkpoint_communicator_:
+     */
+
+    const MPI_Comm communicator = asynchronous_checkpointing_
+                                      ? checkpoint_communicator_
+                                      : mpi_communicator_;
+
+    const auto payload = [this,
+                          name,
+                          t,
+                          output_cycle,
+                          raw_format,
+                          delta,
+                          communicator]() {
+      if (raw_format) {
+        /* Make sure that rank 0 has moved the old state out of the way: */
+        const int ierr = MPI_Barrier(communicator);
+        AssertThrowMPI(ierr);
+
+        if (delta) {
+          write_raw_checkpoint(name + ".state.delta",
+                               checkpoint_buffer_.data(),
+                               checkpoint_buffer_.size(),
+                               problem_dimension,
+                               /*compress*/ true,
+                               checkpoint_reference_.data(),
+                               checkpoint_reference_checksum_,
+                               communicator);
+          n_delta_checkpoints_++;
+
+        } else {
+          checkpoint_reference_checksum_ =
+              write_raw_checkpoint(name + ".state",
+                                   checkpoint_buffer_.data(),
+                                   checkpoint_buffer_.size(),
+                                   problem_dimension,
+                                   checkpoint_compression_,
+                                   static_cast<const Number *>(nullptr),
+                                   0,
+                                   communicator);
+          if (checkpoint_full_interval_ > 1)
+            checkpoint_reference_ = checkpoint_buffer_;
+          n_delta_checkpoints_ = 0;
+        }
+      }
+
+      /*
+       * Now, write out metadata on rank 0:
+       */
+
+      if (mpi_rank_ == 0) {
+        std::string meta = name + ".metadata";
+        std::ofstream file(meta, std::ios::binary | std::ios::trunc);
+        boost::archive::binary_oarchive oa(file);
+        oa << t << output_cycle;
+      }
+
+      const int ierr = MPI_Barrier(communicator);
+      AssertThrowMPI(ierr);
+    };
+
+    if (asynchronous_checkpointing_)
+      checkpoint_status_ = checkpoint_thread_.post(payload);
+    else
+      payload();
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::finalize_checkpoint()
+  {
+    if (!checkpoint_status_.valid())
+      return;
+
+    checkpoint_status_.get();
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::post_snapshot_job(
+      const StateVector &state_vector,
+      const std::function<void(const StateVector &, const ScalarVector &)>
+          &job)
+  {
+    const auto retire_oldest_job = [this]() {
+      auto &[snapshot, status] = snapshot_jobs_.front();
+      status.get();
+      free_snapshots_.push_back(std::move(snapshot));
+      snapshot_jobs_.pop_front();
+    };
+
+    while (!snapshot_jobs_.empty() &&
+           snapshot_jobs_.front().second.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::ready)
+      retire_oldest_job();
+
+    /* Bound the memory footprint by the number of snapshot buffers: */
+    if (free_snapshots_.empty() && snapshot_jobs_.size() >= snapshot_buffers_)
+      retire_oldest_job();
+
+    std::shared_ptr<Snapshot> snapshot;
+    if (free_snapshots_.empty()) {
+      snapshot = std::make_shared<Snapshot>();
+    } else {
+      snapshot = std::move(free_snapshots_.back());
+      free_snapshots_.pop_back();
+    }
+
+    const auto &[U, precomputed, V] = state_vector;
+    auto &[snapshot_U, snapshot_precomputed, snapshot_V] = snapshot->first;
+    copy_locally_relevant(snapshot_U, U);
+    copy_locally_relevant(snapshot_precomputed, precomputed);
+
+    /*
+     * The indicator is overwritten by the next Euler step, so we copy it
+     * as well. Contrary to the state we store it with the partitioner of
+     * the Postprocessor (on the output communicator): All output vectors
+     * derived from it then perform their ghost updates on the output
+     * communicator and never interfere with the main thread.
+     */
+    const auto &alpha = hyperbolic_module_.alpha();
+    auto &snapshot_alpha = snapshot->second;
+    const auto &partitioner = postprocessor_.partitioner();
+    if (snapshot_alpha.get_partitioner() != partitioner)
+      snapshot_alpha.reinit(partitioner);
+    std::copy_n(alpha.begin(),
+                partitioner->locally_owned_size() +
+                    partitioner->n_ghost_indices(),
+                snapshot_alpha.begin());
+    snapshot_alpha.set_ghost_state(alpha.has_ghost_elements());
+
+    snapshot_jobs_.emplace_back(
+        snapshot, postprocessing_thread_.post([snapshot, job]() {
+          job(snapshot->first, snapshot->second);
+        }));
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::finalize_postprocessing()
+  {
+    while (!snapshot_jobs_.empty()) {
+      auto &[snapshot, status] = snapshot_jobs_.front();
+      status.get();
+      free_snapshots_.push_back(std::move(snapshot));
+      snapshot_jobs_.pop_front();
+    }
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::select_buddy_offset()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::select_buddy_offset()" << std::endl;
 #endif
 
+    buddy_offset_ = 1;
+    if (n_mpi_processes_ == 1)
+      return;
+
     /*
-     * Now, write out metadata on rank 0:
+     * Identify every node by the lowest rank running on it:
      */
 
-    if (mpi_rank_ == 0) {
-      std::string meta = name + ".metadata";
-      std::ofstream file(meta, std::ios::binary | std::ios::trunc);
-      boost::archive::binary_oarchive oa(file);
-      oa << t << output_cycle;
+    unsigned int node = mpi_rank_;
+    unsigned int ranks_per_node = 1;
+#ifdef DEAL_II_WITH_MPI
+    MPI_Comm node_communicator;
+    int ierr = MPI_Comm_split_type(mpi_communicator_,
+                                   MPI_COMM_TYPE_SHARED,
+                                   0,
+                                   MPI_INFO_NULL,
+                                   &node_communicator);
+    AssertThrowMPI(ierr);
+    node = Utilities::MPI::min(mpi_rank_, node_communicator);
+    ranks_per_node = Utilities::MPI::n_mpi_processes(node_communicator);
+    ierr = MPI_Comm_free(&node_communicator);
+    AssertThrowMPI(ierr);
+#endif
+
+    const auto nodes = Utilities::MPI::all_gather(mpi_communicator_, node);
+    ranks_per_node = Utilities::MPI::max(ranks_per_node, mpi_communicator_);
+
+    if (ranks_per_node >= n_mpi_processes_) {
+      print_info("warning: all ranks share a single node, buddy checkpoints "
+                 "do not survive the loss of the node");
+      return;
     }
 
-    const int ierr = MPI_Barrier(mpi_communicator_);
+    /*
+     * With ranks placed in contiguous blocks per node an offset of
+     * "ranks per node" moves every buddy to another node. Verify this
+     * for the actual placement:
+     */
+
+    buddy_offset_ = ranks_per_node;
+
+    bool colocated = false;
+    for (unsigned int rank = 0; rank < n_mpi_processes_; ++rank)
+      colocated |=
+          nodes[rank] == nodes[(rank + buddy_offset_) % n_mpi_processes_];
+
+    if (colocated)
+      print_info("warning: the rank placement is not node contiguous, some "
+                 "buddy checkpoints are stored on the same node");
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::write_buddy_checkpoint(
+      const StateVector &state_vector,
+      const Number &t,
+      const unsigned int &output_cycle)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::write_buddy_checkpoint()" << std::endl;
+#endif
+
+    /* Wait for the previous exchange before reusing the buffers: */
+    finalize_buddy_checkpoint();
+
+    const auto &U = std::get<0>(state_vector);
+    const auto size = U.locally_owned_size();
+
+    BuddyCheckpointHeader header;
+    std::memcpy(header.magic, buddy_checkpoint_magic, 8);
+    header.n_ranks = n_mpi_processes_;
+    header.number_size = sizeof(Number);
+    header.n_values = size;
+    header.output_cycle = output_cycle;
+    header.t = t;
+    header.checksum = raw_checkpoint_checksum(U.begin(), size * sizeof(Number));
+
+    buddy_send_buffer_.resize(sizeof(header) + size * sizeof(Number));
+    std::memcpy(buddy_send_buffer_.data(), &header, sizeof(header));
+    std::memcpy(buddy_send_buffer_.data() + sizeof(header),
+                U.begin(),
+                size * sizeof(Number));
+
+    AssertThrow(buddy_send_buffer_.size() <=
+                    std::size_t(std::numeric_limits<int>::max()),
+                ExcMessage("Buddy checkpoint: local state too large"));
+
+    const auto prefix =
+        buddy_checkpoint_prefix(buddy_checkpoint_directory_, base_name_);
+    write_buddy_file(prefix + std::to_string(mpi_rank_) + ".own",
+                     buddy_send_buffer_);
+
+    if (n_mpi_processes_ == 1)
+      return;
+
+    /*
+     * Send our state to the next rank (on another node) and receive the
+     * state of the previous rank. The exchange completes in the background
+     * while we continue with the next time steps:
+     */
+
+    const unsigned int next = (mpi_rank_ + buddy_offset_) % n_mpi_processes_;
+    const unsigned int previous =
+        (mpi_rank_ + n_mpi_processes_ - buddy_offset_) % n_mpi_processes_;
+
+    std::uint64_t send_size = buddy_send_buffer_.size();
+    std::uint64_t receive_size = 0;
+    int ierr = MPI_Sendrecv(&send_size,
+                            1,
+                            MPI_UINT64_T,
+                            next,
+                            buddy_checkpoint_tag,
+                            &receive_size,
+                            1,
+                            MPI_UINT64_T,
+                            previous,
+                            buddy_checkpoint_tag,
+                            mpi_communicator_,
+                            MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+
+    buddy_receive_buffer_.resize(receive_size);
+    ierr = MPI_Irecv(buddy_receive_buffer_.data(),
+                     receive_size,
+                     MPI_CHAR,
+                     previous,
+                     buddy_checkpoint_tag,
+                     mpi_communicator_,
+                     &buddy_requests_[0]);
+    AssertThrowMPI(ierr);
+
+    ierr = MPI_Isend(buddy_send_buffer_.data(),
+                     send_size,
+                     MPI_CHAR,
+                     next,
+                     buddy_checkpoint_tag,
+                     mpi_communicator_,
+                     &buddy_requests_[1]);
     AssertThrowMPI(ierr);
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void
+  TimeLoop<Description, dim, Number>::finalize_buddy_checkpoint(const bool wait)
+  {
+    if (buddy_requests_[0] == MPI_REQUEST_NULL &&
+        buddy_requests_[1] == MPI_REQUEST_NULL)
+      return;
+
+    if (wait) {
+      const auto ierr = MPI_Waitall(
+          2, buddy_requests_.data(), MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+    } else {
+      int flag = 0;
+      const auto ierr = MPI_Testall(
+          2, buddy_requests_.data(), &flag, MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+      if (!flag)
+        return;
+    }
+
+    /* Store the received copy of the state of the previous rank: */
+    const unsigned int previous =
+        (mpi_rank_ + n_mpi_processes_ - buddy_offset_) % n_mpi_processes_;
+    write_buddy_file(
+        buddy_checkpoint_prefix(buddy_checkpoint_directory_, base_name_) +
+            std::to_string(previous) + ".copy",
+        buddy_receive_buffer_);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  template <typename Callable>
+  bool TimeLoop<Description, dim, Number>::read_buddy_checkpoint(
+      StateVector &state_vector,
+      const std::string &base_name,
+      Number &t,
+      unsigned int &output_cycle,
+      const Callable &prepare_compute_kernels)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::read_buddy_checkpoint()" << std::endl;
+#endif
+
+    /*
+     * Buddy checkpoints are only written without mesh adaptation, thus
+     * recreating the mesh reproduces the partitioning of the interrupted
+     * run (provided that the number of ranks is the same):
+     */
+
+    discretization_.prepare(base_name);
+    prepare_compute_kernels();
+
+    Vectors::reinit_state_vector<Description>(state_vector, offline_data_);
+    auto &U = std::get<0>(state_vector);
+    const auto size = U.locally_owned_size();
+
+    const auto prefix =
+        buddy_checkpoint_prefix(buddy_checkpoint_directory_, base_name);
+
+    auto buffer = read_buddy_file(prefix + std::to_string(mpi_rank_) + ".own");
+    int missing =
+        !valid_buddy_checkpoint<Number>(buffer, size, n_mpi_processes_);
+
+    if (n_mpi_processes_ > 1) {
+      /*
+       * A rank without a valid local copy (for example because its node
+       * has been replaced) receives the copy stored by the next rank:
+       */
+
+      const unsigned int next =
+          (mpi_rank_ + buddy_offset_) % n_mpi_processes_;
+      const unsigned int previous =
+          (mpi_rank_ + n_mpi_processes_ - buddy_offset_) % n_mpi_processes_;
+
+      int previous_missing = 0;
+      int ierr = MPI_Sendrecv(&missing,
+                              1,
+                              MPI_INT,
+                              next,
+                              buddy_checkpoint_tag,
+                              &previous_missing,
+                              1,
+                              MPI_INT,
+                              previous,
+                              buddy_checkpoint_tag,
+                              mpi_communicator_,
+                              MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      std::vector<char> copy;
+      if (previous_missing)
+        copy = read_buddy_file(prefix + std::to_string(previous) + ".copy");
+
+      std::uint64_t send_size = copy.size();
+      std::uint64_t receive_size = 0;
+      ierr = MPI_Sendrecv(&send_size,
+                          1,
+                          MPI_UINT64_T,
+                          previous,
+                          buddy_checkpoint_tag,
+                          &receive_size,
+                          1,
+                          MPI_UINT64_T,
+                          next,
+                          buddy_checkpoint_tag,
+                          mpi_communicator_,
+                          MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      std::array<MPI_Request, 2> requests{{MPI_REQUEST_NULL, MPI_REQUEST_NULL}};
+      if (missing) {
+        buffer.resize(receive_size);
+        ierr = MPI_Irecv(buffer.data(),
+                         receive_size,
+                         MPI_CHAR,
+                         next,
+                         buddy_checkpoint_tag,
+                         mpi_communicator_,
+                         &requests[0]);
+        AssertThrowMPI(ierr);
+      }
+      if (previous_missing) {
+        ierr = MPI_Isend(copy.data(),
+                         send_size,
+                         MPI_CHAR,
+                         previous,
+                         buddy_checkpoint_tag,
+                         mpi_communicator_,
+                         &requests[1]);
+        AssertThrowMPI(ierr);
+      }
+      ierr = MPI_Waitall(2, requests.data(), MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+
+      if (missing)
+        missing =
+            !valid_buddy_checkpoint<Number>(buffer, size, n_mpi_processes_);
+    }
+
+    /*
+     * All ranks must have restored a copy of the same cycle. Otherwise
+     * (for example if the interrupted run died in the middle of an
+     * exchange) we fall back to the regular checkpoint:
+     */
+
+    if (Utilities::MPI::max(missing, mpi_communicator_) != 0)
+      return false;
+
+    BuddyCheckpointHeader header;
+    std::memcpy(&header, buffer.data(), sizeof(header));
+
+    if (Utilities::MPI::min(header.t, mpi_communicator_) !=
+            Utilities::MPI::max(header.t, mpi_communicator_) ||
+        Utilities::MPI::min(header.output_cycle, mpi_communicator_) !=
+            Utilities::MPI::max(header.output_cycle, mpi_communicator_))
+      return false;
+
+    std::memcpy(
+        U.begin(), buffer.data() + sizeof(header), size * sizeof(Number));
+    t = header.t;
+    output_cycle = header.output_cycle;
+
+    U.update_ghost_values();
+    return true;
+  }
+
+
   template <typename Description, int dim, typename Number>
   template <typename Callable>
   void TimeLoop<Description, dim, Number>::adapt_mesh_and_transfer_state_vector(
-      StateVector &state_vector, const Callable &prepare_compute_kernels)
+      StateVector &state_vector,
+      const Callable &prepare_compute_kernels,
+      const bool refine /*= true*/)
   {
 #ifdef DEBUG_OUTPUT
     std::cout << "TimeLoop<dim, Number>::adapt_mesh_and_transfer_state_vector()"
@@ -626,10 +3444,19 @@ namespace ryujin
      */
 
     auto &triangulation = discretization_.triangulation();
-    mesh_adaptor_.mark_cells_for_coarsening_and_refinement(triangulation);
+    if (refine)
+      mesh_adaptor_.mark_cells_for_coarsening_and_refinement(triangulation,
+                                                              state_vector);
 
     triangulation.prepare_coarsening_and_refinement();
 
+    /*
+     * Attach cell weights (if enabled) for the repartitioning performed
+     * by execute_coarsening_and_refinement():
+     */
+    auto weight_connection = mesh_adaptor_.connect_cell_weights(
+        triangulation, hyperbolic_module_.dof_cost());
+
     /*
      * Set up SolutionTransfer:
      */
@@ -660,12 +3487,19 @@ namespace ryujin
     solution_transfer.prepare_for_coarsening_and_refinement(ptr_state);
 
     /*
-     * Execute mesh adaptation and project old state to new state vector:
+     * Execute mesh adaptation and project old state to new state vector.
+     * Note that a parallel::distributed::Triangulation repartitions the
+     * mesh even if no cells are flagged:
      */
 
     triangulation.execute_coarsening_and_refinement();
+    weight_connection.disconnect();
     prepare_compute_kernels();
 
+    /* The next (raw) checkpoint has to store the full state again: */
+    checkpoint_reference_.clear();
+    checkpoint_reference_.shrink_to_fit();
+
     Vectors::reinit_state_vector<Description>(state_vector, offline_data_);
 
     std::vector<ScalarVector> interpolated_state;
@@ -686,6 +3520,17 @@ namespace ryujin
       U.insert_component(interpolated_state[k], k);
     }
     U.update_ghost_values();
+
+#ifdef __GLIBC__
+    /*
+     * Every mesh adaptation cycle frees and reallocates all offline data
+     * and temporaries with (slightly) different sizes. Return the freed
+     * heap memory to the operating system to avoid a slow creep of the
+     * resident set size over long adaptive runs:
+     */
+    interpolated_state.clear();
+    malloc_trim(0);
+#endif
   }
 
 
@@ -698,25 +3543,22 @@ namespace ryujin
     std::cout << "TimeLoop<dim, Number>::compute_error()" << std::endl;
 #endif
 
-    hyperbolic_module_.prepare_state_vector(state_vector, t);
-
-    Vector<Number> difference_per_cell(
-        discretization_.triangulation().n_active_cells());
-
-    Number linf_norm = 0.;
-    Number l1_norm = 0;
-    Number l2_norm = 0;
+    hyperbolic_module_.prepare_state_vector(state_vector, t);
 
     const auto analytic_U = initial_values_.interpolate_hyperbolic_vector(t);
     const auto &U = std::get<0>(state_vector);
 
-    ScalarVector analytic_component;
-    ScalarVector error_component;
-    analytic_component.reinit(offline_data_.scalar_partitioner());
-    error_component.reinit(offline_data_.scalar_partitioner());
+    /*
+     * Extract all selected components of the analytic solution and of
+     * the error:
+     */
 
-    /* Loop over all selected components: */
-    for (const auto &entry : error_quantities_) {
+    const unsigned int n_quantities = error_quantities_.size();
+    std::vector<ScalarVector> analytic_components(n_quantities);
+    std::vector<ScalarVector> error_components(n_quantities);
+
+    for (unsigned int q = 0; q < n_quantities; ++q) {
+      const auto &entry = error_quantities_[q];
       const auto &names = View::component_names;
       const auto pos = std::find(std::begin(names), std::end(names), entry);
       if (pos == std::end(names)) {
@@ -728,73 +3570,130 @@ namespace ryujin
 
       const auto index = std::distance(std::begin(names), pos);
 
+      auto &analytic_component = analytic_components[q];
+      analytic_component.reinit(offline_data_.scalar_partitioner());
       analytic_U.extract_component(analytic_component, index);
+      analytic_component.update_ghost_values();
 
-      /* Compute norms of analytic solution: */
-
-      Number linf_norm_analytic = 0.;
-      Number l1_norm_analytic = 0.;
-      Number l2_norm_analytic = 0.;
-
-      if (error_normalize_) {
-        linf_norm_analytic = Utilities::MPI::max(
-            analytic_component.linfty_norm(), mpi_communicator_);
-
-        VectorTools::integrate_difference(
-            offline_data_.dof_handler(),
-            analytic_component,
-            Functions::ZeroFunction<dim, Number>(),
-            difference_per_cell,
-            QGauss<dim>(3),
-            VectorTools::L1_norm);
-
-        l1_norm_analytic = Utilities::MPI::sum(difference_per_cell.l1_norm(),
-                                               mpi_communicator_);
-
-        VectorTools::integrate_difference(
-            offline_data_.dof_handler(),
-            analytic_component,
-            Functions::ZeroFunction<dim, Number>(),
-            difference_per_cell,
-            QGauss<dim>(3),
-            VectorTools::L2_norm);
-
-        l2_norm_analytic = Number(std::sqrt(Utilities::MPI::sum(
-            std::pow(difference_per_cell.l2_norm(), 2), mpi_communicator_)));
-      }
-
-      /* Compute norms of error: */
-
+      auto &error_component = error_components[q];
+      error_component.reinit(offline_data_.scalar_partitioner());
       U.extract_component(error_component, index);
       /* Populate constrained dofs due to periodicity: */
       offline_data_.affine_constraints().distribute(error_component);
       error_component.update_ghost_values();
       error_component -= analytic_component;
+    }
+
+    /*
+     * Accumulate the L1 and L2 norms of the error and of the analytic
+     * solution of all components in a single (thread parallel) sweep over
+     * all locally owned cells. We use the same quadrature and (linear)
+     * mapping as VectorTools::integrate_difference(). The packed array
+     * holds for every component the integrals of |e|, e^2, |u|, and u^2.
+     */
+
+    std::vector<Number> integrals(4 * n_quantities, Number(0.));
+
+    const QGauss<dim> quadrature(3);
+    const auto &dof_handler = offline_data_.dof_handler();
+
+    struct ScratchData {
+      ScratchData(const Mapping<dim> &mapping,
+                  const FiniteElement<dim> &finite_element,
+                  const Quadrature<dim> &quadrature)
+          : fe_values(mapping,
+                      finite_element,
+                      quadrature,
+                      update_values | update_JxW_values)
+          , values(quadrature.size())
+      {
+      }
+
+      ScratchData(const ScratchData &other)
+          : fe_values(other.fe_values.get_mapping(),
+                      other.fe_values.get_fe(),
+                      other.fe_values.get_quadrature(),
+                      other.fe_values.get_update_flags())
+          , values(other.values)
+      {
+      }
+
+      FEValues<dim> fe_values;
+      std::vector<Number> values;
+    };
+
+    const auto local_integrate = [&](const auto &cell,
+                                     ScratchData &scratch,
+                                     std::vector<Number> &local_integrals) {
+      std::fill(local_integrals.begin(), local_integrals.end(), Number(0.));
+      if (!cell->is_locally_owned())
+        return;
+
+      auto &fe_values = scratch.fe_values;
+      auto &values = scratch.values;
+      fe_values.reinit(cell);
+
+      const auto accumulate = [&](const ScalarVector &vector,
+                                  const unsigned int offset) {
+        fe_values.get_function_values(vector, values);
+        for (unsigned int k = 0; k < values.size(); ++k) {
+          const auto JxW = fe_values.JxW(k);
+          local_integrals[offset] += std::abs(values[k]) * JxW;
+          local_integrals[offset + 1] += values[k] * values[k] * JxW;
+        }
+      };
+
+      for (unsigned int q = 0; q < n_quantities; ++q) {
+        accumulate(error_components[q], 4 * q);
+        if (error_normalize_)
+          accumulate(analytic_components[q], 4 * q + 2);
+      }
+    };
+
+    const auto copy_local_to_global =
+        [&](const std::vector<Number> &local_integrals) {
+          for (unsigned int k = 0; k < integrals.size(); ++k)
+            integrals[k] += local_integrals[k];
+        };
 
-      const Number linf_norm_error =
-          Utilities::MPI::max(error_component.linfty_norm(), mpi_communicator_);
+    WorkStream::run(
+        dof_handler.begin_active(),
+        dof_handler.end(),
+        local_integrate,
+        copy_local_to_global,
+        ScratchData(get_default_linear_mapping(dof_handler.get_triangulation()),
+                    dof_handler.get_fe(),
+                    quadrature),
+        std::vector<Number>(4 * n_quantities));
+
+    /* The Linf norms of the error and the analytic solution: */
+
+    std::vector<Number> maxima(2 * n_quantities, Number(0.));
+    for (unsigned int q = 0; q < n_quantities; ++q) {
+      maxima[2 * q] = error_components[q].linfty_norm();
+      if (error_normalize_)
+        maxima[2 * q + 1] = analytic_components[q].linfty_norm();
+    }
 
-      VectorTools::integrate_difference(offline_data_.dof_handler(),
-                                        error_component,
-                                        Functions::ZeroFunction<dim, Number>(),
-                                        difference_per_cell,
-                                        QGauss<dim>(3),
-                                        VectorTools::L1_norm);
+    /* Reduce all norms of all components at once: */
 
-      const Number l1_norm_error =
-          Utilities::MPI::sum(difference_per_cell.l1_norm(), mpi_communicator_);
+    Utilities::MPI::sum(integrals, mpi_communicator_, integrals);
+    Utilities::MPI::max(maxima, mpi_communicator_, maxima);
 
-      VectorTools::integrate_difference(offline_data_.dof_handler(),
-                                        error_component,
-                                        Functions::ZeroFunction<dim, Number>(),
-                                        difference_per_cell,
-                                        QGauss<dim>(3),
-                                        VectorTools::L2_norm);
+    Number linf_norm = 0.;
+    Number l1_norm = 0;
+    Number l2_norm = 0;
 
-      const Number l2_norm_error = Number(std::sqrt(Utilities::MPI::sum(
-          std::pow(difference_per_cell.l2_norm(), 2), mpi_communicator_)));
+    for (unsigned int q = 0; q < n_quantities; ++q) {
+      const Number linf_norm_error = maxima[2 * q];
+      const Number l1_norm_error = integrals[4 * q];
+      const Number l2_norm_error = std::sqrt(integrals[4 * q + 1]);
 
       if (error_normalize_) {
+        const Number linf_norm_analytic = maxima[2 * q + 1];
+        const Number l1_norm_analytic = integrals[4 * q + 2];
+        const Number l2_norm_analytic = std::sqrt(integrals[4 * q + 3]);
+
         linf_norm += linf_norm_error / linf_norm_analytic;
         l1_norm += l1_norm_error / l1_norm_analytic;
         l2_norm += l2_norm_error / l2_norm_analytic;
@@ -843,22 +3742,97 @@ namespace ryujin
     std::cout << "TimeLoop<dim, Number>::output(t = " << t << ")" << std::endl;
 #endif
 
-    const bool do_full_output =
-        (cycle % timer_output_full_multiplier_ == 0) && enable_output_full_;
+    /* Interpolated output streams are handled by output_interpolated(): */
+    const bool tick_output = !output_interpolation_;
+
+    const bool do_full_output = tick_output &&
+                                (cycle % timer_output_full_multiplier_ == 0) &&
+                                enable_output_full_;
     const bool do_levelsets =
-        (cycle % timer_output_levelsets_multiplier_ == 0) &&
+        tick_output && (cycle % timer_output_levelsets_multiplier_ == 0) &&
         enable_output_levelsets_;
-    const bool do_checkpointing =
-        (cycle % timer_checkpoint_multiplier_ == 0) && enable_checkpointing_;
+    const bool do_region = tick_output &&
+                           (cycle % timer_output_region_multiplier_ == 0) &&
+                           enable_output_region_;
+    const bool do_insitu = tick_output &&
+                           (cycle % timer_output_insitu_multiplier_ == 0) &&
+                           enable_output_insitu_ && !insitu_consumers_.empty();
+    /* Checkpoints in wall clock time are scheduled by the main loop: */
+    const bool do_checkpointing = (cycle % timer_checkpoint_multiplier_ == 0) &&
+                                  enable_checkpointing_ &&
+                                  checkpoint_mtbf_ <= 0.;
+
+    output(state_vector,
+           name,
+           t,
+           cycle,
+           do_full_output,
+           do_levelsets,
+           do_region,
+           do_insitu,
+           do_checkpointing);
+  }
 
+
+  template <typename Description, int dim, typename Number>
+  void
+  TimeLoop<Description, dim, Number>::output(StateVector &state_vector,
+                                             const std::string &name,
+                                             const Number t,
+                                             const unsigned int cycle,
+                                             const bool do_full_output,
+                                             const bool do_levelsets,
+                                             const bool do_region,
+                                             const bool do_insitu,
+                                             const bool do_checkpointing)
+  {
     /* There is nothing to do: */
-    if (!(do_full_output || do_levelsets || do_checkpointing))
+    if (!(do_full_output || do_levelsets || do_region || do_insitu ||
+          do_checkpointing))
       return;
 
     hyperbolic_module_.prepare_state_vector(state_vector, t);
 
+    /*
+     * Asynchronous postprocessing: All jobs run in order on the
+     * postprocessing thread, so the Postprocessor, the VTUOutput and the
+     * in-situ consumers are never accessed concurrently:
+     */
+    if (asynchronous_postprocessing_ &&
+        (do_full_output || do_levelsets || do_region || do_insitu)) {
+      Scope scope(computing_timer_,
+                  "time step [X]   - snapshot postprocessing");
+      print_info("scheduling postprocessing");
+
+      const auto job = [=, this](const StateVector &snapshot,
+                                 const ScalarVector &snapshot_alpha) {
+        postprocessor_.compute(snapshot);
+
+        if (do_full_output || do_levelsets || do_region) {
+          if (cycle == 0)
+            postprocessor_.reset_bounds();
+
+          vtu_output_.schedule_output(snapshot,
+                                      name,
+                                      t,
+                                      cycle,
+                                      do_full_output,
+                                      do_levelsets,
+                                      do_region,
+                                      &snapshot_alpha);
+        }
+
+        if (do_insitu)
+          for (const auto &consumer : insitu_consumers_)
+            consumer(snapshot, postprocessor_, t, cycle);
+      };
+
+      post_snapshot_job(state_vector, job);
+    }
+
     /* Data output: */
-    if (do_full_output || do_levelsets) {
+    if (!asynchronous_postprocessing_ &&
+        (do_full_output || do_levelsets || do_region)) {
       Scope scope(computing_timer_, "time step [X]   - perform vtu output");
       print_info("scheduling output");
 
@@ -871,8 +3845,25 @@ namespace ryujin
       if (cycle == 0)
         postprocessor_.reset_bounds();
 
-      vtu_output_.schedule_output(
-          state_vector, name, t, cycle, do_full_output, do_levelsets);
+      vtu_output_.schedule_output(state_vector,
+                                  name,
+                                  t,
+                                  cycle,
+                                  do_full_output,
+                                  do_levelsets,
+                                  do_region);
+    }
+
+    /* In-situ consumers: */
+    if (!asynchronous_postprocessing_ && do_insitu) {
+      Scope scope(computing_timer_, "time step [X]   - perform insitu output");
+      print_info("handing over to in-situ consumers");
+
+      if (!(do_full_output || do_levelsets || do_region))
+        postprocessor_.compute(state_vector);
+
+      for (const auto &consumer : insitu_consumers_)
+        consumer(state_vector, postprocessor_, t, cycle);
     }
 
     /* Checkpointing: */
@@ -884,11 +3875,194 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::output_interpolated(
+      StateVector &interpolated_state_vector,
+      const StateVector &old_state_vector,
+      StateVector &state_vector,
+      const std::string &name,
+      const Number t_old,
+      const Number t,
+      std::array<unsigned int, 4> &next_cycle)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::output_interpolated(t = " << t
+              << ")" << std::endl;
+#endif
+
+    const std::array<unsigned int, 4> multipliers{
+        timer_output_full_multiplier_,
+        timer_output_levelsets_multiplier_,
+        timer_output_region_multiplier_,
+        timer_output_insitu_multiplier_};
+
+    const std::array<bool, 4> enabled{
+        enable_output_full_,
+        enable_output_levelsets_,
+        enable_output_region_,
+        enable_output_insitu_ && !insitu_consumers_.empty()};
+
+    for (;;) {
+      /* Find the earliest output time of all streams: */
+      auto cycle = std::numeric_limits<unsigned int>::max();
+      for (unsigned int s = 0; s < 4; ++s)
+        if (enabled[s])
+          cycle = std::min(cycle, next_cycle[s]);
+
+      if (cycle == std::numeric_limits<unsigned int>::max() ||
+          cycle * timer_granularity_ > t)
+        return;
+
+      const Number t_output = cycle * timer_granularity_;
+
+      std::array<bool, 4> due;
+      for (unsigned int s = 0; s < 4; ++s) {
+        due[s] = enabled[s] && next_cycle[s] == cycle;
+        if (due[s])
+          next_cycle[s] += multipliers[s];
+      }
+
+      /*
+       * The interpolant is a convex combination of the old and new state
+       * and thus stays within the invariant set of the hyperbolic system.
+       * Higher order continuous extensions of the Runge-Kutta stages do
+       * not guarantee this.
+       */
+      const Number tau = t - t_old;
+      const Number theta =
+          tau > Number(0.)
+              ? std::clamp((t_output - t_old) / tau, Number(0.), Number(1.))
+              : Number(1.);
+
+      StateVector *output_state = &state_vector;
+      if (theta < Number(1.)) {
+        auto &U = std::get<0>(interpolated_state_vector);
+        if (U.get_partitioner() != std::get<0>(state_vector).get_partitioner())
+          Vectors::reinit_state_vector<Description>(interpolated_state_vector,
+                                                    offline_data_);
+        U.equ(Number(1.) - theta, std::get<0>(old_state_vector));
+        U.add(theta, std::get<0>(state_vector));
+        output_state = &interpolated_state_vector;
+      }
+
+      output(*output_state,
+             name + "-solution",
+             t_output,
+             cycle,
+             due[0],
+             due[1],
+             due[2],
+             due[3],
+             /*checkpointing*/ false);
+
+      if (enable_compute_error_) {
+        StateVector analytic;
+        {
+          Scope scope(computing_timer_,
+                      "time step [X]   - interpolate analytic solution");
+          Vectors::reinit_state_vector<Description>(analytic, offline_data_);
+          std::get<0>(analytic) =
+              initial_values_.interpolate_hyperbolic_vector(t_output);
+        }
+        output(analytic,
+               name + "-analytic_solution",
+               t_output,
+               cycle,
+               due[0],
+               due[1],
+               due[2],
+               due[3],
+               /*checkpointing*/ false);
+      }
+    }
+  }
+
+
   /*
    * Output and logging related functions:
    */
 
 
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::write_rank_order()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeLoop<dim, Number>::write_rank_order()" << std::endl;
+#endif
+
+    /*
+     * We receive ghost values from the owners listed in ghost_targets()
+     * and send locally owned values to the ranks listed in
+     * import_targets():
+     */
+
+    const auto &partitioner = offline_data_.scalar_partitioner();
+
+    std::vector<int> sources;
+    std::vector<int> source_weights;
+    for (const auto &[rank, n_indices] : partitioner->ghost_targets()) {
+      sources.push_back(rank);
+      source_weights.push_back(n_indices);
+    }
+
+    std::vector<int> destinations;
+    std::vector<int> destination_weights;
+    for (const auto &[rank, n_indices] : partitioner->import_targets()) {
+      destinations.push_back(rank);
+      destination_weights.push_back(n_indices);
+    }
+
+    MPI_Comm communicator;
+    int ierr = MPI_Dist_graph_create_adjacent(mpi_communicator_,
+                                              sources.size(),
+                                              sources.data(),
+                                              source_weights.data(),
+                                              destinations.size(),
+                                              destinations.data(),
+                                              destination_weights.data(),
+                                              MPI_INFO_NULL,
+                                              /*reorder*/ 1,
+                                              &communicator);
+    AssertThrowMPI(ierr);
+
+    int new_rank;
+    ierr = MPI_Comm_rank(communicator, &new_rank);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Comm_free(&communicator);
+    AssertThrowMPI(ierr);
+
+    /*
+     * The process in slot mpi_rank_ has been assigned the role (that is,
+     * the partition) of new_rank:
+     */
+
+    const auto rank_order = Utilities::MPI::gather(mpi_communicator_, new_rank);
+
+    if (mpi_rank_ != 0)
+      return;
+
+    std::ofstream file(rank_order_file_);
+    for (unsigned int p = 0; p < rank_order.size(); ++p)
+      file << (p == 0 ? "" : ",") << rank_order[p];
+    file << std::endl;
+
+    unsigned int n_moved = 0;
+    for (unsigned int p = 0; p < rank_order.size(); ++p)
+      if (rank_order[p] != int(p))
+        n_moved++;
+
+    std::ostringstream output;
+    output << "Rank order:  " << n_moved << " of " << rank_order.size()
+           << " ranks reordered, written to \"" << rank_order_file_ << "\"";
+    if (n_moved == 0)
+      output << " (the MPI implementation does not reorder)";
+
+    logfile_ << output.str() << std::endl;
+    std::cout << output.str() << std::endl;
+  }
+
+
+
   template <typename Description, int dim, typename Number>
   void
   TimeLoop<Description, dim, Number>::print_parameters(std::ostream &stream)
@@ -936,10 +4110,55 @@ namespace ryujin
             (double)offline_data_.n_locally_relevant(),
         (double)offline_data_.n_locally_owned() /
             (double)offline_data_.n_locally_relevant()};
+
+    /*
+     * Vectorized (locally internal) and scalar rows and their ratio to
+     * the number of locally owned degrees of freedom:
+     */
+    {
+      const unsigned int n_internal = offline_data_.n_locally_internal();
+      const unsigned int n_owned = offline_data_.n_locally_owned();
+      const double n_rows = std::max(1u, n_owned);
+      values.push_back((double)(n_owned - n_internal));
+      values.push_back((double)n_internal / n_rows);
+      values.push_back((double)(n_owned - n_internal) / n_rows);
+    }
+
+    /*
+     * Ghost layers of an extended halo (and their ratio to the number of
+     * locally owned degrees of freedom) if requested:
+     */
+    const unsigned int n_layers = halo_statistics_layers_;
+    if (n_layers > 1) {
+      const auto sizes = offline_data_.halo_sizes(n_layers);
+      const double n_owned = std::max(1u, offline_data_.n_locally_owned());
+      for (const auto size : sizes)
+        values.push_back((double)size);
+      for (const auto size : sizes)
+        values.push_back((double)size / n_owned);
+    }
+
+    /* Redundant rows of a temporal blocking scheme if requested: */
+    const unsigned int block_size = temporal_blocking_block_size_;
+    const unsigned int n_temporal = values.size();
+    if (block_size > 0) {
+      const unsigned int n_owned = offline_data_.n_locally_owned();
+      values.push_back((double)((n_owned + block_size - 1) / block_size));
+      values.push_back(offline_data_.temporal_blocking_redundancy(
+                           block_size, temporal_blocking_layers_) -
+                       1.);
+    }
     // NOLINTEND
 
     const auto data = Utilities::MPI::min_max_avg(values, mpi_communicator_);
 
+    const auto hostnames = Utilities::MPI::gather(
+        mpi_communicator_, Utilities::System::get_hostname());
+    const auto cpusets =
+        Utilities::MPI::gather(mpi_communicator_, thread_affinity_.cpuset);
+    const auto thread_cpus =
+        Utilities::MPI::gather(mpi_communicator_, thread_affinity_.thread_cpus);
+
     if (mpi_rank_ != 0)
       return;
 
@@ -987,7 +4206,86 @@ namespace ryujin
     output << std::endl << "             ";
     print_snippet("rel", data[3]);
 
+    output << std::endl << std::endl << "SIMD rows:   ";
+    print_snippet("vec", data[1]);
+    print_percentages(data[8]);
+
+    output << std::endl << "             ";
+    print_snippet("scl", data[7]);
+    print_percentages(data[9]);
+
+    if (n_layers > 1) {
+      output << std::endl << std::endl << "Halo:        ";
+      for (unsigned int k = 0; k < n_layers; ++k) {
+        if (k > 0)
+          output << std::endl << "             ";
+        print_snippet("gh" + std::to_string(k + 1), data[10 + k]);
+        print_percentages(data[10 + n_layers + k]);
+      }
+    }
+
+    if (block_size > 0) {
+      output << std::endl << std::endl << "Blocking:    ";
+      print_snippet("blk", data[n_temporal]);
+      print_percentages(data[n_temporal + 1]);
+    }
+
+    /*
+     * Record the core map of all ranks and check that no two ranks on
+     * the same host share CPUs:
+     */
+
+    output << std::endl << std::endl << "Core map:";
+    std::map<std::string, std::vector<int>> used_cpus;
+    std::vector<std::string> warnings;
+
+    for (unsigned int rank = 0; rank < hostnames.size(); ++rank) {
+      const auto &hostname = hostnames[rank];
+      const auto &cpuset = cpusets[rank];
+      const auto n_threads = thread_cpus[rank].size();
+
+      std::vector<int> pinned;
+      std::copy_if(thread_cpus[rank].begin(),
+                   thread_cpus[rank].end(),
+                   std::back_inserter(pinned),
+                   [](int cpu) { return cpu >= 0; });
+
+      output << std::endl
+             << "  [p" << std::setw(n) << rank << "] " << hostname
+             << ": cpuset " << cpu_list_string(cpuset) << ", " << n_threads
+             << " threads";
+      if (!pinned.empty())
+        output << ", workers pinned to " << cpu_list_string(pinned);
+
+      if (!cpuset.empty() && cpuset.size() < n_threads)
+        warnings.push_back("rank " + std::to_string(rank) + " runs " +
+                           std::to_string(n_threads) + " threads on " +
+                           std::to_string(cpuset.size()) + " CPUs");
+
+      auto &used = used_cpus[hostname];
+      for (const auto cpu : cpuset)
+        if (std::find(used.begin(), used.end(), cpu) != used.end()) {
+          warnings.push_back("rank " + std::to_string(rank) +
+                             " shares CPUs with another rank on host " +
+                             hostname);
+          break;
+        }
+      used.insert(used.end(), cpuset.begin(), cpuset.end());
+    }
+
     stream << output.str() << std::endl;
+
+    /* Only print the first few warnings to the terminal: */
+    constexpr std::size_t max_warnings = 4;
+    for (std::size_t k = 0; k < warnings.size(); ++k) {
+      if (k < max_warnings)
+        std::cout << "[WARNING] oversubscription: " << warnings[k] << std::endl;
+      stream << "[WARNING] oversubscription: " << warnings[k] << std::endl;
+    }
+    if (warnings.size() > max_warnings)
+      std::cout << "[WARNING] oversubscription: "
+                << warnings.size() - max_warnings
+                << " more warnings, see the log file" << std::endl;
   }
 
 
@@ -998,8 +4296,26 @@ namespace ryujin
     Utilities::System::MemoryStats stats;
     Utilities::System::get_memory_stats(stats);
 
-    Utilities::MPI::MinMaxAvg data =
-        Utilities::MPI::min_max_avg(stats.VmRSS / 1024., mpi_communicator_);
+    /*
+     * The resident set size, followed by an estimate of the memory
+     * consumption of all major subsystems (in MiB):
+     */
+    constexpr double MiB = 1024. * 1024.;
+    const std::vector<std::pair<std::string, double>> entries{
+        {"Memory", stats.VmRSS / 1024.},
+        {"- offline data", offline_data_.memory_consumption() / MiB},
+        {"- hyperbolic", hyperbolic_module_.memory_consumption() / MiB},
+        {"- parabolic", parabolic_module_.memory_consumption() / MiB},
+        {"- integrator", time_integrator_.memory_consumption() / MiB},
+        {"- postprocessor", postprocessor_.memory_consumption() / MiB}};
+
+    std::vector<Utilities::MPI::MinMaxAvg> data;
+    std::transform(entries.begin(),
+                   entries.end(),
+                   std::back_inserter(data),
+                   [&](const auto &it) {
+                     return reduce_statistic("memory: " + it.first, it.second);
+                   });
 
     if (mpi_rank_ != 0)
       return;
@@ -1008,12 +4324,33 @@ namespace ryujin
 
     unsigned int n = dealii::Utilities::needed_digits(n_mpi_processes_);
 
-    output << "\nMemory:      [MiB]"                          //
-           << std::setw(8) << data.min                        //
-           << " [p" << std::setw(n) << data.min_index << "] " //
-           << std::setw(8) << data.avg << " "                 //
-           << std::setw(8) << data.max                        //
-           << " [p" << std::setw(n) << data.max_index << "]"; //
+    output << "\n  " << std::left << std::setw(16) << "[MiB]" << std::right
+           << std::setw(9) << "min" << std::string(n + 5, ' ') //
+           << std::setw(8) << "avg" << " "                     //
+           << std::setw(8) << "max" << std::string(n + 4, ' ') //
+           << std::setw(10) << "total";
+
+    for (unsigned int k = 0; k < entries.size(); ++k) {
+      output << "\n  " << std::left << std::setw(16) << entries[k].first //
+             << std::right << std::setw(9) << data[k].min                //
+             << " [p" << std::setw(n) << data[k].min_index << "] "       //
+             << std::setw(8) << data[k].avg << " "                       //
+             << std::setw(8) << data[k].max                              //
+             << " [p" << std::setw(n) << data[k].max_index << "]"        //
+             << std::setw(10) << data[k].sum;                            //
+    }
+
+    /* NUMA placement of the (sampled) pages of the c_ij matrix: */
+    const auto numa_pages = offline_data_.cij_matrix().numa_page_distribution();
+    if (numa_pages.size() > 0) {
+      unsigned int n_pages = 0;
+      for (const auto &[node, count] : numa_pages)
+        n_pages += count;
+      output << "\nNUMA pages:  [p0]  c_ij:";
+      for (const auto &[node, count] : numa_pages)
+        output << "  node " << node << ": " << std::setw(3)
+               << 100 * count / n_pages << "%";
+    }
 
     stream << output.str() << std::endl;
   }
@@ -1036,9 +4373,9 @@ namespace ryujin
         it << std::string(length - it.str().length() + 1, ' ');
     };
 
-    const auto print_wall_time = [&](auto &timer, auto &stream) {
+    const auto print_wall_time = [&](auto &it, auto &stream) {
       const auto wall_time =
-          Utilities::MPI::min_max_avg(timer.wall_time(), mpi_communicator_);
+          reduce_statistic("wall time: " + it.first, it.second.wall_time());
 
       constexpr auto eps = std::numeric_limits<double>::epsilon();
       /*
@@ -1059,14 +4396,14 @@ namespace ryujin
              << wall_time.max_index << "]";
     };
 
-    const auto cpu_time_statistics = Utilities::MPI::min_max_avg(
-        computing_timer_["time loop"].cpu_time(), mpi_communicator_);
+    const auto cpu_time_statistics = reduce_statistic(
+        "cpu time: time loop", computing_timer_["time loop"].cpu_time());
     const double total_cpu_time = cpu_time_statistics.sum;
 
     const auto print_cpu_time =
-        [&](auto &timer, auto &stream, bool percentage) {
+        [&](auto &it, auto &stream, bool percentage) {
           const auto cpu_time =
-              Utilities::MPI::min_max_avg(timer.cpu_time(), mpi_communicator_);
+              reduce_statistic("cpu time: " + it.first, it.second.cpu_time());
 
           stream << std::setprecision(2) << std::fixed << std::setw(9)
                  << cpu_time.sum << "s ";
@@ -1083,18 +4420,84 @@ namespace ryujin
 
     jt = output.begin();
     for (auto &it : computing_timer_)
-      print_wall_time(it.second, *jt++);
+      print_wall_time(it, *jt++);
     equalize();
 
     jt = output.begin();
     bool compute_percentages = false;
     for (auto &it : computing_timer_) {
-      print_cpu_time(it.second, *jt++, compute_percentages);
+      print_cpu_time(it, *jt++, compute_percentages);
       if (it.first.find("time loop") == 0)
         compute_percentages = true;
     }
     equalize();
 
+    /*
+     * Achieved memory bandwidth of all stages with a traffic model, and
+     * the fraction of the measured peak bandwidth (if available):
+     */
+
+    const auto &kernel_bytes = hyperbolic_module_.kernel_bytes_streamed();
+    const auto peak = reduce_statistic("peak bandwidth", peak_bandwidth_);
+
+    jt = output.begin();
+    for (auto &it : computing_timer_) {
+      auto &line = *jt++;
+      const auto bytes = kernel_bytes.find(it.first);
+      if (bytes == kernel_bytes.end())
+        continue;
+
+      const auto wall_time = it.second.wall_time();
+      const auto bandwidth =
+          reduce_statistic("bandwidth: " + it.first,
+                           wall_time > 0. ? bytes->second / wall_time : 0.);
+
+      line << std::setprecision(1) << std::fixed << std::setw(7)
+           << bandwidth.avg / 1.e9 << " GB/s";
+      if (peak.avg > 0.)
+        line << " (" << std::setprecision(1) << std::setw(5)
+             << 100. * bandwidth.avg / peak.avg << "% peak)";
+    }
+
+    /*
+     * Hardware performance counters (summed over all ranks): IPC, cache
+     * miss ratio, and the average memory traffic per rank implied by the
+     * last level cache misses (one cache line per miss):
+     */
+
+    if (PerfCounters::instance().active()) {
+      equalize();
+
+      jt = output.begin();
+      for (auto &it : computing_timer_) {
+        auto &line = *jt++;
+        const auto &counters = it.second.counters();
+        const auto sum = [&](const PerfCounters::Event event) {
+          return reduce_statistic("counter " + std::to_string(event) + ": " +
+                                      it.first,
+                                  double(counters[event]))
+              .sum;
+        };
+
+        const double n_cycles = sum(PerfCounters::cycles);
+        const double n_instructions = sum(PerfCounters::instructions);
+        const double n_references = sum(PerfCounters::cache_references);
+        const double n_misses = sum(PerfCounters::cache_misses);
+        const auto wall_time = reduce_statistic(
+            "wall time: " + it.first, it.second.wall_time());
+
+        line << "[IPC " << std::setprecision(2) << std::fixed << std::setw(5)
+             << (n_cycles > 0. ? n_instructions / n_cycles : 0.) << ", miss "
+             << std::setprecision(1) << std::setw(5)
+             << (n_references > 0. ? 100. * n_misses / n_references : 0.)
+             << "%, " << std::setw(7)
+             << (wall_time.avg > 0. ? 64. * n_misses / n_mpi_processes_ /
+                                          wall_time.avg / 1.e9
+                                    : 0.)
+             << " GB/s]";
+      }
+    }
+
     if (mpi_rank_ != 0)
       return;
 
@@ -1104,6 +4507,115 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::write_performance_report(
+      unsigned int cycle, Number t)
+  {
+    /*
+     * Collect all quantities as a record of name, minimum, average and
+     * maximum over all MPI ranks:
+     */
+
+    std::vector<std::tuple<std::string, double, double, double>> records;
+
+    const auto record = [&](const std::string &name, const double value) {
+      const auto statistics =
+          Utilities::MPI::min_max_avg(value, mpi_communicator_);
+      records.emplace_back(
+          name, statistics.min, statistics.avg, statistics.max);
+    };
+
+    double synchronization_time = 0.;
+    for (auto &[name, timer] : computing_timer_) {
+      record("wall time: " + name, timer.wall_time());
+      if (name.find("synchronization") != std::string::npos)
+        synchronization_time += timer.wall_time();
+    }
+    record("mpi synchronization time", synchronization_time);
+
+    {
+      const auto &busy_time = hyperbolic_module_.thread_busy_time();
+      double min = 0., avg = 0., max = 0.;
+      if (!busy_time.empty()) {
+        min = *std::min_element(busy_time.begin(), busy_time.end());
+        max = *std::max_element(busy_time.begin(), busy_time.end());
+        avg = std::accumulate(busy_time.begin(), busy_time.end(), 0.) /
+              busy_time.size();
+      }
+      /* Report the extreme values over all ranks: */
+      const auto min_statistics =
+          Utilities::MPI::min_max_avg(min, mpi_communicator_);
+      const auto avg_statistics =
+          Utilities::MPI::min_max_avg(avg, mpi_communicator_);
+      const auto max_statistics =
+          Utilities::MPI::min_max_avg(max, mpi_communicator_);
+      records.emplace_back("thread busy time",
+                           min_statistics.min,
+                           avg_statistics.avg,
+                           max_statistics.max);
+    }
+
+    record("streamed bytes per dof (est.)",
+           hyperbolic_module_.streamed_bytes_per_dof());
+
+    for (const auto &[name, bytes] :
+         hyperbolic_module_.kernel_bytes_streamed()) {
+      const auto wall_time = computing_timer_[name].wall_time();
+      record("achieved bandwidth: " + name,
+             wall_time > 0. ? bytes / wall_time : 0.);
+    }
+
+    if (peak_bandwidth_ > 0.)
+      record("peak bandwidth (probe)", peak_bandwidth_);
+    record("locally owned dofs",
+           offline_data_.dof_handler().n_locally_owned_dofs());
+    record("hyperbolic restarts", hyperbolic_module_.n_restarts());
+    record("parabolic restarts", parabolic_module_.n_restarts());
+    record("time integrator restarts", time_integrator_.n_restarts());
+    record("hyperbolic warnings", hyperbolic_module_.n_warnings());
+    record("parabolic warnings", parabolic_module_.n_warnings());
+
+    if (mpi_rank_ != 0)
+      return;
+
+    const bool json =
+        (performance_report_format_ == PerformanceReportFormat::json);
+
+    if (!performance_report_file_.is_open()) {
+      const auto mode = resume_ ? std::ofstream::app : std::ofstream::trunc;
+      performance_report_file_.open(
+          base_name_ + "-performance" + (json ? ".jsonl" : ".csv"),
+          std::ofstream::out | mode);
+      if (!json && !resume_)
+        performance_report_file_ << "cycle,t,name,min,avg,max\n";
+    }
+
+    auto &output = performance_report_file_;
+    output << std::scientific << std::setprecision(8);
+
+    if (json) {
+      output << "{\"cycle\": " << cycle << ", \"t\": " << t
+             << ", \"ranks\": " << n_mpi_processes_
+             << ", \"threads\": " << MultithreadInfo::n_threads()
+             << ", \"records\": {";
+      for (auto it = records.begin(); it != records.end(); ++it) {
+        const auto &[name, min, avg, max] = *it;
+        output << (it == records.begin() ? "" : ", ") << "\"" << name
+               << "\": {\"min\": " << min << ", \"avg\": " << avg
+               << ", \"max\": " << max << "}";
+      }
+      output << "}}\n";
+
+    } else {
+      for (const auto &[name, min, avg, max] : records)
+        output << cycle << "," << t << ",\"" << name << "\"," << min << ","
+               << avg << "," << max << "\n";
+    }
+
+    output << std::flush;
+  }
+
+
   template <typename Description, int dim, typename Number>
   void TimeLoop<Description, dim, Number>::print_throughput(
       unsigned int cycle, Number t, std::ostream &stream, bool final_time)
@@ -1120,10 +4632,33 @@ namespace ryujin
       double cpu_time_min = 0.;
       double cpu_time_max = 0.;
       double wall_time = 0.;
+      double energy = 0.;
     } previous, current;
 
     static double time_per_second_exp = 0.;
 
+    const auto wall_time_statistics = reduce_statistic(
+        "wall time: time loop", computing_timer_["time loop"].wall_time());
+    const auto cpu_time_statistics = reduce_statistic(
+        "cpu time: time loop", computing_timer_["time loop"].cpu_time());
+    const auto cache_memory_statistics = reduce_statistic(
+        "stage flux cache memory",
+        double(hyperbolic_module_.stage_flux_cache_memory_consumption()));
+    const auto staging_backlog_statistics = reduce_statistic(
+        "staging backlog", FileStaging::instance().backlog());
+    const auto [n_bounds_checks, n_bounds_violations] =
+        hyperbolic_module_.sampled_bounds_checks();
+    const auto bounds_checks_statistics =
+        reduce_statistic("sampled bounds checks", n_bounds_checks);
+    const auto bounds_violations_statistics =
+        reduce_statistic("sampled bounds violations", n_bounds_violations);
+    const auto energy_statistics =
+        reduce_statistic("energy", EnergyCounters::instance().energy());
+
+    /* Only gather values, see start_cycle_statistics(): */
+    if (statistics_mode_ == StatisticsMode::gather)
+      return;
+
     /* Update statistics: */
 
     {
@@ -1132,16 +4667,14 @@ namespace ryujin
       current.cycle = cycle;
       current.t = t;
 
-      const auto wall_time_statistics = Utilities::MPI::min_max_avg(
-          computing_timer_["time loop"].wall_time(), mpi_communicator_);
       current.wall_time = wall_time_statistics.max;
 
-      const auto cpu_time_statistics = Utilities::MPI::min_max_avg(
-          computing_timer_["time loop"].cpu_time(), mpi_communicator_);
       current.cpu_time_sum = cpu_time_statistics.sum;
       current.cpu_time_avg = cpu_time_statistics.avg;
       current.cpu_time_min = cpu_time_statistics.min;
       current.cpu_time_max = cpu_time_statistics.max;
+
+      current.energy = energy_statistics.sum;
     }
 
     if (final_time)
@@ -1228,6 +4761,122 @@ namespace ryujin
            << std::setprecision(0) << std::fixed << parabolic_module_.n_warnings()
            << " warn) ]" << std::endl;
 
+    output << "        [ "
+           << std::setprecision(0) << std::fixed
+           << hyperbolic_module_.streamed_bytes_per_dof()
+           << " B/Qdof/substep streamed (est.)"
+           << (hyperbolic_module_.fused_low_order_update() ? " (fused)" : "")
+           << " ]" << std::endl;
+
+    output << "        [ "
+           << std::setprecision(2) << std::fixed
+           << hyperbolic_module_.thread_imbalance()
+           << " thread imbalance (max/avg) ]" << std::endl;
+
+    if (EnergyCounters::instance().active()) {
+      const double delta_energy = current.energy - previous.energy;
+      output << "  ENERGY: "
+             << std::setprecision(4) << std::scientific
+             << delta_energy / (delta_cycles * n_dofs * efficiency)
+             << " J/Qdof/substep  ("
+             << delta_energy / delta_cycles << " J/cycle)  ("
+             << std::setprecision(1) << std::fixed
+             << delta_energy / (current.wall_time - previous.wall_time)
+             << " W)" << std::endl;
+    }
+
+    if (time_integrator_.n_restarts() > 0) {
+      const double n_stages = std::max(1u, hyperbolic_module_.n_steps());
+      const double n_wasted = time_integrator_.n_wasted_stages();
+      output << "        [ " << time_integrator_.n_restarts() << " restarts, "
+             << time_integrator_.n_wasted_stages() << " wasted stages ("
+             << std::setprecision(1) << std::fixed
+             << 100. * n_wasted / n_stages << "%) ]" << std::endl;
+    }
+
+    if (time_integrator_.cfl_recovery_strategy() ==
+        CFLRecoveryStrategy::adaptive_control)
+      output << "        [ adaptive CFL control: next step with CFL = "
+             << std::setprecision(2) << std::fixed
+             << time_integrator_.cfl_current() << " ]" << std::endl;
+
+    /* The output queue is owned by the postprocessing thread otherwise: */
+    if (vtu_output_.asynchronous_output() && !asynchronous_postprocessing_)
+      output << "        [ " << vtu_output_.queue_depth()
+             << " outputs queued, " << std::setprecision(1) << std::fixed
+             << vtu_output_.write_bandwidth() / 1.e6 << " MB/s written (est.), "
+             << vtu_output_.n_skipped_outputs() << " skipped ]" << std::endl;
+
+    if (vtu_output_.staged_output())
+      output << "        [ " << std::setprecision(1) << std::fixed
+             << staging_backlog_statistics.sum / 1.e6
+             << " MB staged output pending drain (max "
+             << staging_backlog_statistics.max / 1.e6 << " MB per rank) ]"
+             << std::endl;
+
+    if (hyperbolic_module_.bounds_check_fraction() > 0.)
+      output << "        [ " << std::setprecision(0) << std::fixed
+             << bounds_violations_statistics.sum
+             << " bounds violations in " << bounds_checks_statistics.sum
+             << " sampled checks (max " << bounds_violations_statistics.max
+             << " per rank) ]" << std::endl;
+
+    if (hyperbolic_module_.multirate_levels() > 0)
+      output << "        [ "
+             << std::setprecision(2) << std::fixed
+             << hyperbolic_module_.multirate_speedup()
+             << " potential multirate speedup ("
+             << hyperbolic_module_.multirate_levels() << " levels) ]"
+             << std::endl;
+
+    if (hyperbolic_module_.reused_wave_speed_fraction() >= 0.)
+      output << "        [ "
+             << std::setprecision(1) << std::fixed
+             << 100. * hyperbolic_module_.reused_wave_speed_fraction()
+             << "% d_ij reused (frozen wave speeds) ]" << std::endl;
+
+    if (hyperbolic_module_.cached_stage_flux_fraction() >= 0.) {
+      const double cache_memory = cache_memory_statistics.sum;
+      output << "        [ "
+             << std::setprecision(1) << std::fixed
+             << 100. * hyperbolic_module_.cached_stage_flux_fraction()
+             << "% stage fluxes reused, " << cache_memory / 1024. / 1024.
+             << " MB stage flux cache ]" << std::endl;
+    }
+
+    const auto &limiter_parameters = hyperbolic_module_.limiter_parameters();
+    if constexpr (requires { limiter_parameters.newton_histogram(); }) {
+      const auto counts = limiter_parameters.newton_histogram().counts();
+      const double total = std::accumulate(counts.begin(), counts.end(), 0.);
+      if (total > 0.) {
+        output << "        [ limiter iterations:";
+        for (unsigned int k = 0; k < counts.size(); ++k)
+          if (counts[k] > 0)
+            output << " " << k << (k + 1 == counts.size() ? "+" : "")
+                   << ": " << std::setprecision(1) << std::fixed
+                   << 100. * counts[k] / total << "%";
+        output << " ]" << std::endl;
+      }
+    }
+
+    const auto &riemann_parameters =
+        hyperbolic_module_.riemann_solver_parameters();
+    if constexpr (requires { riemann_parameters.acoustic_edge_fraction(); }) {
+      const auto fraction = riemann_parameters.acoustic_edge_fraction();
+      if (fraction >= 0.)
+        output << "        [ "
+               << std::setprecision(1) << std::fixed << 100. * fraction
+               << "% edges with acoustic shortcut ]" << std::endl;
+    }
+
+    if constexpr (requires { riemann_parameters.fast_edge_fraction(); }) {
+      const auto fraction = riemann_parameters.fast_edge_fraction();
+      if (fraction >= 0.)
+        output << "        [ "
+               << std::setprecision(1) << std::fixed << 100. * fraction
+               << "% edges with fast pressure bound ]" << std::endl;
+    }
+
     if constexpr (!ParabolicSystem::is_identity)
       parabolic_module_.print_solver_statistics(output);
 
@@ -1371,7 +5020,7 @@ namespace ryujin
     print_timers(output);
     print_throughput(cycle, t, output, final_time);
 
-    if (mpi_rank_ == 0) {
+    if (mpi_rank_ == 0 && statistics_mode_ != StatisticsMode::gather) {
 #ifndef DEBUG_OUTPUT
       std::cout << "\033[2J\033[H";
 #endif
@@ -1383,4 +5032,125 @@ namespace ryujin
     }
   }
 
+
+  template <typename Description, int dim, typename Number>
+  Utilities::MPI::MinMaxAvg
+  TimeLoop<Description, dim, Number>::reduce_statistic(const std::string &key,
+                                                       const double value)
+  {
+    switch (statistics_mode_) {
+    case StatisticsMode::blocking:
+      return Utilities::MPI::min_max_avg(value, mpi_communicator_);
+
+    case StatisticsMode::gather: {
+      const auto [it, inserted] = statistics_keys_.try_emplace(
+          key, statistics_buffer_.size() / n_packed_statistic);
+      if (inserted)
+        statistics_buffer_.resize(statistics_buffer_.size() +
+                                  n_packed_statistic);
+      double *entry =
+          statistics_buffer_.data() + n_packed_statistic * it->second;
+      entry[0] = entry[1] = entry[2] = value;
+      entry[3] = entry[4] = mpi_rank_;
+      break;
+    }
+
+    case StatisticsMode::replay: {
+      const auto it = statistics_keys_.find(key);
+      if (it == statistics_keys_.end())
+        break;
+      const double *entry =
+          statistics_buffer_.data() + n_packed_statistic * it->second;
+      Utilities::MPI::MinMaxAvg result;
+      result.sum = entry[0];
+      result.min = entry[1];
+      result.max = entry[2];
+      result.min_index = static_cast<unsigned int>(entry[3]);
+      result.max_index = static_cast<unsigned int>(entry[4]);
+      result.avg = entry[0] / n_mpi_processes_;
+      return result;
+    }
+    }
+
+    /*
+     * While gathering (or for a statistic that was not gathered) we
+     * return the rank local value:
+     */
+    Utilities::MPI::MinMaxAvg result;
+    result.sum = result.min = result.max = result.avg = value;
+    result.min_index = result.max_index = mpi_rank_;
+    return result;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::start_cycle_statistics(
+      unsigned int cycle,
+      Number t,
+      unsigned int timer_cycle,
+      bool write_to_logfile)
+  {
+    Assert(!pending_statistics_.has_value(), ExcInternalError());
+
+    /*
+     * Run print_cycle_statistics() once in gather mode: All statistics
+     * are recorded (rank locally) in the packed statistics buffer in
+     * place of the individual blocking reductions. Nothing is printed.
+     */
+    statistics_keys_.clear();
+    statistics_buffer_.clear();
+    statistics_mode_ = StatisticsMode::gather;
+    print_cycle_statistics(cycle, t, timer_cycle, write_to_logfile);
+    statistics_mode_ = StatisticsMode::blocking;
+
+    int ierr = MPI_Type_contiguous(
+        n_packed_statistic, MPI_DOUBLE, &statistics_datatype_);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Type_commit(&statistics_datatype_);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Op_create(
+        &reduce_packed_statistics, /*commute*/ 1, &statistics_operation_);
+    AssertThrowMPI(ierr);
+
+    const int n_entries = statistics_buffer_.size() / n_packed_statistic;
+    ierr = MPI_Iallreduce(MPI_IN_PLACE,
+                          statistics_buffer_.data(),
+                          n_entries,
+                          statistics_datatype_,
+                          statistics_operation_,
+                          mpi_communicator_,
+                          &statistics_request_);
+    AssertThrowMPI(ierr);
+
+    pending_statistics_.emplace(cycle, t, timer_cycle, write_to_logfile);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::finish_cycle_statistics()
+  {
+    if (!pending_statistics_.has_value())
+      return;
+
+    int ierr = MPI_Wait(&statistics_request_, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Op_free(&statistics_operation_);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Type_free(&statistics_datatype_);
+    AssertThrowMPI(ierr);
+
+    /*
+     * Print the cycle statistics with the reduced values. Quantities that
+     * are not reduced over all ranks (such as the CFL number) are
+     * reported as of the current cycle.
+     */
+    const auto [cycle, t, timer_cycle, write_to_logfile] =
+        pending_statistics_.value();
+    pending_statistics_.reset();
+
+    statistics_mode_ = StatisticsMode::replay;
+    print_cycle_statistics(cycle, t, timer_cycle, write_to_logfile);
+    statistics_mode_ = StatisticsMode::blocking;
+  }
+
 } // namespace ryujin
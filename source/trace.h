@@ -0,0 +1,241 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * A lightweight timeline tracer recording begin and end events of
+   * named regions on all threads (including the communication thread).
+   *
+   * Every thread appends events to its own fixed size ring buffer
+   * (single producer, single consumer) without locking. The buffers are
+   * drained by flush(), which writes all recorded events in the Chrome
+   * trace event format (a JSON array that can be loaded into Perfetto
+   * or chrome://tracing) to a file per MPI rank. The MPI rank is
+   * recorded as process id, the order in which threads first recorded
+   * an event as thread id. Events are dropped (and counted) if the ring
+   * buffer of a thread is full.
+   *
+   * Time stamps are taken from the system clock relative to the start
+   * time of rank 0, so that the traces of all ranks can be merged, for
+   * example with `jq -s add *-trace-p*.json`.
+   *
+   * Region names must remain valid until the next call to flush(); in
+   * practice they are string literals or the keys of the timer map.
+   *
+   * @ingroup Miscellaneous
+   */
+  class Tracer
+  {
+  public:
+    /**
+     * Return a reference to the (sole) tracer.
+     */
+    static Tracer &instance()
+    {
+      static Tracer tracer;
+      return tracer;
+    }
+
+    /**
+     * Return true if events are recorded.
+     */
+    static bool enabled()
+    {
+      return instance().enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Start recording events and open the trace file "@p base_name
+     * -trace-p<rank>.json". This function is collective over
+     * @p mpi_communicator.
+     */
+    void enable(const std::string &base_name, const MPI_Comm &mpi_communicator)
+    {
+      std::lock_guard<std::mutex> lock(flush_mutex_);
+      if (enabled_.load())
+        return;
+
+      rank_ = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+      start_time_ = dealii::Utilities::MPI::broadcast(
+          mpi_communicator, std::int64_t(now()), 0);
+
+      file_.open(base_name + "-trace-p" + std::to_string(rank_) + ".json");
+      AssertThrow(file_.good(),
+                  dealii::ExcMessage("Could not open the trace file"));
+      file_ << "[";
+      first_event_ = true;
+
+      enabled_.store(true);
+    }
+
+    /**
+     * Write all recorded events to the trace file.
+     */
+    void flush()
+    {
+      std::lock_guard<std::mutex> lock(flush_mutex_);
+      if (!file_.is_open())
+        return;
+
+      std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+      for (const auto &buffer : buffers_) {
+        const auto tail = buffer->tail.load(std::memory_order_relaxed);
+        const auto head = buffer->head.load(std::memory_order_acquire);
+        for (auto k = tail; k < head; ++k) {
+          const auto &event = buffer->events[k % capacity];
+          file_ << (first_event_ ? "\n" : ",\n") << "{\"name\":\""
+                << event.name << "\",\"ph\":\"" << event.phase
+                << "\",\"ts\":" << (event.time - start_time_) / 1000.
+                << ",\"pid\":" << rank_ << ",\"tid\":" << buffer->thread_id
+                << "}";
+          first_event_ = false;
+        }
+        buffer->tail.store(head, std::memory_order_release);
+      }
+      file_.flush();
+    }
+
+    /**
+     * Stop recording, flush all events, and close the trace file.
+     */
+    void finalize()
+    {
+      if (!enabled_.exchange(false))
+        return;
+
+      flush();
+
+      std::lock_guard<std::mutex> lock(flush_mutex_);
+      std::uint64_t n_dropped = 0;
+      {
+        std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+        for (const auto &buffer : buffers_)
+          n_dropped += buffer->n_dropped;
+      }
+      if (n_dropped > 0)
+        file_ << (first_event_ ? "\n" : ",\n")
+              << "{\"name\":\"dropped events: " << n_dropped
+              << "\",\"ph\":\"i\",\"s\":\"p\",\"ts\":0,\"pid\":" << rank_
+              << "}";
+      file_ << "\n]\n";
+      file_.close();
+    }
+
+    /**
+     * Record the begin (@p phase 'B') or end (@p phase 'E') of the
+     * region @p name on the calling thread.
+     */
+    void record(const char *name, const char phase)
+    {
+      thread_local Buffer *buffer = nullptr;
+      if (buffer == nullptr)
+        buffer = register_thread();
+
+      const auto head = buffer->head.load(std::memory_order_relaxed);
+      if (head - buffer->tail.load(std::memory_order_acquire) >= capacity) {
+        ++buffer->n_dropped;
+        return;
+      }
+      buffer->events[head % capacity] = {name, now(), phase};
+      buffer->head.store(head + 1, std::memory_order_release);
+    }
+
+    Tracer(const Tracer &) = delete;
+    Tracer &operator=(const Tracer &) = delete;
+
+  private:
+    Tracer() = default;
+
+    /*
+     * Number of events per thread buffer:
+     */
+    static constexpr std::uint64_t capacity = 1 << 16;
+
+    struct Event {
+      const char *name;
+      std::int64_t time;
+      char phase;
+    };
+
+    struct Buffer {
+      std::vector<Event> events = std::vector<Event>(capacity);
+      std::atomic<std::uint64_t> head = 0;
+      std::atomic<std::uint64_t> tail = 0;
+      std::uint64_t n_dropped = 0;
+      unsigned int thread_id = 0;
+    };
+
+    Buffer *register_thread()
+    {
+      std::lock_guard<std::mutex> lock(buffers_mutex_);
+      buffers_.push_back(std::make_unique<Buffer>());
+      buffers_.back()->thread_id = buffers_.size() - 1;
+      return buffers_.back().get();
+    }
+
+    /* Nanoseconds since epoch: */
+    static std::int64_t now()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::system_clock::now().time_since_epoch())
+          .count();
+    }
+
+    std::atomic<bool> enabled_ = false;
+
+    std::mutex buffers_mutex_;
+    std::vector<std::unique_ptr<Buffer>> buffers_;
+
+    std::mutex flush_mutex_;
+    std::ofstream file_;
+    bool first_event_ = true;
+    unsigned int rank_ = 0;
+    std::int64_t start_time_ = 0;
+  };
+
+
+  /**
+   * A RAII scope recording a region @p name with the Tracer (if
+   * enabled).
+   *
+   * @ingroup Miscellaneous
+   */
+  class TraceScope
+  {
+  public:
+    TraceScope(const char *name)
+        : name_(Tracer::enabled() ? name : nullptr)
+    {
+      if (name_ != nullptr)
+        Tracer::instance().record(name_, 'B');
+    }
+
+    ~TraceScope()
+    {
+      if (name_ != nullptr)
+        Tracer::instance().record(name_, 'E');
+    }
+
+  private:
+    const char *const name_;
+  };
+} // namespace ryujin
@@ -8,8 +8,11 @@
 #pragma once
 
 #include <deal.II/base/config.h>
+#include <deal.II/base/derivative_form.h>
 #include <deal.II/grid/manifold.h>
 
+#include <vector>
+
 namespace ryujin
 {
   using namespace dealii; // FIXME: namespace pollution
@@ -53,6 +56,9 @@ namespace ryujin
         const ArrayView<const Point<spacedim>> &surrounding_points,
         ArrayView<Point<dim>> chart_points) const;
 
+    Point<dim> affine_pull_back(const unsigned int cell_index,
+                                const Point<spacedim> &p) const;
+
     Point<dim>
     pull_back(const typename Triangulation<dim, spacedim>::cell_iterator &cell,
               const Point<spacedim> &p,
@@ -73,6 +79,25 @@ namespace ryujin
 
     std::vector<bool> coarse_cell_is_flat;
 
+    /**
+     * Geometric information about each coarse cell that is needed over
+     * and over again when searching for the cell (and chart) a set of
+     * surrounding points belongs to. We precompute this information in
+     * initialize() instead of recomputing it from the vertices on every
+     * call to get_new_point().
+     */
+    struct CoarseCellData {
+      Point<spacedim> center;
+      double radius_square;
+      double diameter;
+
+      /* inverse of the affine approximation x = A x_hat + b: */
+      DerivativeForm<1, spacedim, dim> inverse_affine_matrix;
+      Tensor<1, spacedim> affine_offset;
+    };
+
+    std::vector<CoarseCellData> coarse_cell_data;
+
     std::unique_ptr<Manifold<dim, spacedim>> chart_manifold;
   };
 
@@ -12,6 +12,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include <deal.II/base/table.h>
+#include <deal.II/grid/grid_tools.h>
 
 namespace ryujin
 {
@@ -72,6 +73,49 @@ namespace ryujin
                        coarse_cell_is_flat.size());
       coarse_cell_is_flat[cell->index()] = cell_is_flat;
     }
+
+    /*
+     * Precompute the bounding circle and the affine approximation of
+     * every coarse cell:
+     */
+    coarse_cell_data.resize(triangulation.n_cells(level_coarse));
+    for (cell = triangulation.begin(level_coarse); cell != endc; ++cell) {
+      auto &data = coarse_cell_data[cell->index()];
+
+      std::array<Point<spacedim>, GeometryInfo<dim>::vertices_per_cell>
+          vertices;
+      for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+        vertices[v] = cell->vertex(v);
+
+      data.center = Point<spacedim>();
+      for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+        data.center += vertices[v];
+      data.center *= 1. / GeometryInfo<dim>::vertices_per_cell;
+
+      data.radius_square = 0.;
+      for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+        data.radius_square = std::max(
+            data.radius_square, (data.center - vertices[v]).norm_square());
+
+      data.diameter = cell->diameter();
+
+      const auto [A, b] = GridTools::affine_cell_approximation<dim>(
+          make_array_view(vertices.begin(), vertices.end()));
+      data.inverse_affine_matrix = A.covariant_form().transpose();
+      data.affine_offset = b;
+    }
+  }
+
+
+  template <int dim, int spacedim>
+  Point<dim> TransfiniteInterpolationManifold<dim, spacedim>::affine_pull_back(
+      const unsigned int cell_index, const Point<spacedim> &point) const
+  {
+    AssertIndexRange(cell_index, coarse_cell_data.size());
+    const auto &data = coarse_cell_data[cell_index];
+    return Point<dim>(
+        apply_transformation(data.inverse_affine_matrix,
+                             Tensor<1, spacedim>(point - data.affine_offset)));
   }
 
 
@@ -431,7 +475,8 @@ namespace ryujin
         point - compute_transfinite_interpolation(
                     *cell, chart_point, coarse_cell_is_flat[cell->index()]);
     const double tolerance =
-        1e-21 * Utilities::fixed_power<2>(cell->diameter());
+        1e-21 *
+        Utilities::fixed_power<2>(coarse_cell_data[cell->index()].diameter);
     double residual_norm_square = residual.norm_square();
     DerivativeForm<1, dim, spacedim> inv_grad;
     bool must_recompute_jacobian = true;
@@ -586,23 +631,12 @@ namespace ryujin
       if (cell->material_id() == 42)
         continue;
 
-      std::array<Point<spacedim>, GeometryInfo<dim>::vertices_per_cell>
-          vertices;
-      for (const unsigned int vertex_n : GeometryInfo<dim>::vertex_indices()) {
-        vertices[vertex_n] = cell->vertex(vertex_n);
-      }
-
       // cheap check: if any of the points is not inside a circle around the
       // center of the loop, we can skip the expensive part below (this assumes
       // that the manifold does not deform the grid too much)
-      Point<spacedim> center;
-      for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
-        center += vertices[v];
-      center *= 1. / GeometryInfo<dim>::vertices_per_cell;
-      double radius_square = 0.;
-      for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
-        radius_square =
-            std::max(radius_square, (center - vertices[v]).norm_square());
+      const auto &data = coarse_cell_data[cell->index()];
+      const auto &center = data.center;
+      const double radius_square = data.radius_square;
       bool inside_circle = true;
       for (unsigned int i = 0; i < points.size(); ++i)
         if ((center - points[i]).norm_square() > radius_square * 1.5) {
@@ -615,8 +649,7 @@ namespace ryujin
       // slightly more expensive search
       double current_distance = 0;
       for (unsigned int i = 0; i < points.size(); ++i) {
-        Point<dim> point =
-            cell->real_to_unit_cell_affine_approximation(points[i]);
+        const Point<dim> point = affine_pull_back(cell->index(), points[i]);
         current_distance += GeometryInfo<dim>::distance_to_unit_cell(point);
       }
       distances_and_cells.push_back(
@@ -801,8 +834,8 @@ namespace ryujin
                           chart_points[GeometryInfo<dim>::face_to_cell_vertices(
                               point_index - 20, 3)]);
           } else {
-            guess = cell->real_to_unit_cell_affine_approximation(
-                surrounding_points[point_index]);
+            guess = affine_pull_back(cell->index(),
+                                     surrounding_points[point_index]);
             used_affine_approximation = true;
           }
           chart_points[point_index] =
@@ -814,8 +847,8 @@ namespace ryujin
           if (chart_points[point_index][0] ==
                   internal::invalid_pull_back_coordinate &&
               !used_affine_approximation) {
-            guess = cell->real_to_unit_cell_affine_approximation(
-                surrounding_points[point_index]);
+            guess = affine_pull_back(cell->index(),
+                                     surrounding_points[point_index]);
             chart_points[point_index] =
                 pull_back(cell, surrounding_points[point_index], guess);
           }
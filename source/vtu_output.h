@@ -7,16 +7,53 @@
 
 #include <compile_time_options.h>
 
+#include "contour_extractor.h"
 #include "offline_data.h"
+#include "openmp.h"
+#include "patterns_conversion.h"
 #include "postprocessor.h"
 
+#include <deal.II/base/data_out_base.h>
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/grid/intergrid_map.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/multigrid/mg_transfer_matrix_free.h>
 
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+
 namespace ryujin
 {
+  /**
+   * The policy applied by VTUOutput::schedule_output() when the
+   * asynchronous output queue is full.
+   *
+   * @ingroup TimeLoop
+   */
+  enum class OutputQueuePolicy {
+    /**
+     * Wait for the oldest queued output to finish.
+     */
+    block,
+
+    /**
+     * Drop the new output.
+     */
+    drop,
+
+    /**
+     * Replace the newest queued output (that has not been started yet)
+     * by the new output. If all queued outputs are already in progress,
+     * wait for the oldest one to finish.
+     */
+    coalesce,
+  };
+
 
   /**
    * the VTUOutput class implements output of the conserved state vector
@@ -52,6 +89,8 @@ namespace ryujin
     using InitialPrecomputedVector = typename View::InitialPrecomputedVector;
     using ScalarVector = Vectors::ScalarVector<Number>;
 
+    using ScalarVectorFloat = Vectors::ScalarVector<float>;
+
     //@}
     /**
      * @name Constructor and setup
@@ -76,9 +115,18 @@ namespace ryujin
      *
      * Calling prepare() allocates temporary storage for additional (dim +
      * 5) scalar vectors of type OfflineData::scalar_type.
+     *
+     * prepare() has to be called again after the mesh has changed. For
+     * HDF5 output this triggers a write-out of the new mesh geometry
+     * during the next call to schedule_output().
      */
     void prepare();
 
+    /**
+     * Destructor. Waits for all queued outputs to finish.
+     */
+    ~VTUOutput();
+
     /**
      * Given a state vector @p U and a file name prefix @p name, the
      * current time @p t, and the current output cycle @p cycle) schedule a
@@ -92,7 +140,14 @@ namespace ryujin
      * The booleans @p output_full controls whether the full vector field
      * is written out. Correspondingly, @p output_cutplanes controls
      * whether cells in the vicinity of predefined cutplanes are written
-     * out.
+     * out (and whether contours of the "contour quantities" are extracted
+     * with the ContourExtractor), and @p output_region controls whether
+     * cells in the region of interest (an axis-aligned box, decimated by
+     * selecting only every Nth cell) are written out.
+     *
+     * If @p alpha is non-null it is used instead of the indicator vector
+     * passed to the constructor. The ghost updates of all output vectors
+     * communicate over the partitioner of the indicator vector.
      *
      * The function requires MPI communication and is not reentrant.
      */
@@ -101,7 +156,53 @@ namespace ryujin
                          Number t,
                          unsigned int cycle,
                          bool output_full = true,
-                         bool output_cutplanes = true);
+                         bool output_cutplanes = true,
+                         bool output_region = false,
+                         const ScalarVector *alpha = nullptr);
+
+    /**
+     * Wait for all queued (asynchronous) outputs to finish. This function
+     * has to be called before the mesh is modified.
+     */
+    void finalize_output();
+
+    /**
+     * @name Statistics of the asynchronous output queue
+     */
+    //@{
+
+    /**
+     * Returns true if asynchronous output is enabled.
+     */
+    ACCESSOR_READ_ONLY(asynchronous_output)
+
+    /**
+     * Return the number of queued outputs that have not finished yet.
+     */
+    unsigned int queue_depth() const;
+
+    /**
+     * Return the number of outputs that have been dropped or coalesced
+     * because the output queue was full.
+     */
+    unsigned int n_skipped_outputs() const;
+
+    /**
+     * Return the average write bandwidth (in bytes per second) of the
+     * current rank. The number of bytes is estimated from the size of
+     * the (uncompressed) patches.
+     */
+    double write_bandwidth() const;
+
+    /**
+     * Returns true if a staging directory is set.
+     */
+    bool staged_output() const
+    {
+      return !staging_directory_.empty();
+    }
+
+    //@}
 
   private:
     /**
@@ -110,9 +211,27 @@ namespace ryujin
     //@{
 
     bool use_mpi_io_;
+    bool use_hdf5_;
+
+    bool asynchronous_output_;
+    unsigned int output_queue_depth_;
+    OutputQueuePolicy output_queue_policy_;
+
+    std::string staging_directory_;
+    unsigned int pieces_per_rank_;
+    int output_groups_;
+    unsigned int n_output_groups_;
+    bool cache_patches_;
 
     std::vector<std::string> manifolds_;
 
+    std::vector<std::string> contour_quantities_;
+    std::vector<double> contour_levels_;
+
+    dealii::Point<dim> region_bottom_left_;
+    dealii::Point<dim> region_top_right_;
+    unsigned int region_cell_stride_;
+
     std::vector<std::string> vtu_output_quantities_;
 
     //@}
@@ -131,7 +250,84 @@ namespace ryujin
 
     const InitialPrecomputedVector &initial_precomputed_;
     const ScalarVector &alpha_;
+
+    std::string rank_staging_directory_;
+
+    ContourExtractor<dim, Number> contour_extractor_;
+
+    std::string hdf5_mesh_filename_;
+    std::map<std::string, std::vector<dealii::XDMFEntry>> xdmf_entries_;
+
+    using Patch = dealii::DataOutBase::Patch<dim, dim>;
+
+    /**
+     * The patches of the full output built on the current mesh, together
+     * with the dof indices of the cells of all patches (in the order of
+     * the patches) and the values of all shape functions in the patch
+     * points. The cache is set up by create_patch_cache() and reset
+     * every time prepare() is called. If the patches do not have the
+     * expected layout the cache is marked as invalid.
+     */
+    struct PatchCache {
+      bool valid = false;
+      std::vector<Patch> patches;
+      std::vector<dealii::types::global_dof_index> dof_indices;
+      dealii::FullMatrix<double> shape_values;
+    };
+    std::unique_ptr<PatchCache> patch_cache_;
+
+    /**
+     * Set up patch_cache_ from the @p patches of a full output built with
+     * @p n_subdivisions subdivisions.
+     */
+    void create_patch_cache(const std::vector<Patch> &patches,
+                            const unsigned int n_subdivisions);
+
+    /**
+     * Return a copy of the cached patches where the first
+     * @p vectors.size() data sets are replaced by the values of the
+     * given vectors.
+     */
+    std::vector<Patch>
+    cached_patches(const std::vector<const ScalarVectorFloat *> &vectors) const;
+
+    /**
+     * A queued output. The write() function object holds all data
+     * necessary for the write-out.
+     */
+    struct OutputJob {
+      std::mutex mutex;
+      bool started = false;
+      bool superseded = false;
+      std::function<void(const MPI_Comm &)> write;
+    };
+
+    std::deque<std::pair<std::shared_ptr<OutputJob>, std::future<void>>>
+        output_queue_;
+
+    MPI_Comm io_communicator_;
+
+    mutable std::mutex statistics_mutex_;
+    unsigned int n_skipped_outputs_;
+    double bytes_written_;
+    double write_time_;
+
+    void post_output_job(const std::shared_ptr<OutputJob> &job);
+
+    /*
+     * Declared last so that it is joined before all other members die.
+     * We do not use the CommunicationThread: A long write-out would
+     * otherwise stall ghost exchanges posted by the main thread.
+     */
+    WorkerThread output_thread_;
     //@}
   };
 
 } /* namespace ryujin */
+
+#ifndef DOXYGEN
+DECLARE_ENUM(ryujin::OutputQueuePolicy,
+             LIST({ryujin::OutputQueuePolicy::block, "block"},
+                  {ryujin::OutputQueuePolicy::drop, "drop"},
+                  {ryujin::OutputQueuePolicy::coalesce, "coalesce"}));
+#endif
@@ -5,18 +5,46 @@
 
 #pragma once
 
+#include "file_staging.h"
 #include "selected_components_extractor.h"
 #include "vtu_output.h"
 
 #include <deal.II/base/function_parser.h>
+#include <deal.II/base/timer.h>
 #include <deal.II/numerics/data_out.h>
 #include <deal.II/numerics/vector_tools.h>
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
 
 namespace ryujin
 {
   using namespace dealii;
 
+  namespace
+  {
+    /*
+     * DataOut with public access to the patches and dataset names, so
+     * that we can write subsets of the patches with DataOutBase directly:
+     */
+    template <int dim>
+    class PatchDataOut : public dealii::DataOut<dim>
+    {
+    public:
+      using dealii::DataOut<dim>::get_patches;
+      using dealii::DataOut<dim>::get_dataset_names;
+      using dealii::DataOut<dim>::get_nonscalar_data_ranges;
+
+      void set_patches(std::vector<dealii::DataOutBase::Patch<dim, dim>> &&p)
+      {
+        this->patches = std::move(p);
+      }
+    };
+  } // namespace
+
 
   template <typename Description, int dim, typename Number>
   VTUOutput<Description, dim, Number>::VTUOutput(
@@ -36,6 +64,10 @@ namespace ryujin
       , postprocessor_(&postprocessor)
       , initial_precomputed_(initial_precomputed)
       , alpha_(alpha)
+      , io_communicator_(MPI_COMM_NULL)
+      , n_skipped_outputs_(0)
+      , bytes_written_(0.)
+      , write_time_(0.)
   {
     use_mpi_io_ = true;
     add_parameter("use mpi io",
@@ -44,11 +76,113 @@ namespace ryujin
                   "write_vtu_in_parallel() instead of independent output files "
                   "via write_vtu_with_pvtu_record()");
 
+    use_hdf5_ = false;
+    add_parameter("use hdf5",
+                  use_hdf5_,
+                  "If enabled write out the full solution into HDF5 files "
+                  "with an accompanying XDMF record via collective parallel "
+                  "IO instead of vtu files. The mesh geometry is written only "
+                  "once per mesh.");
+
+    asynchronous_output_ = false;
+    add_parameter(
+        "asynchronous output",
+        asynchronous_output_,
+        "Build patches and write out files on a background thread "
+        "overlapping with subsequent time steps. The write-out runs on a "
+        "dedicated thread and communicates over a duplicated communicator. "
+        "Running on more than one MPI rank requires MPI_THREAD_MULTIPLE "
+        "support");
+
+    output_queue_depth_ = 2;
+    add_parameter("output queue depth",
+                  output_queue_depth_,
+                  "Maximal number of queued asynchronous outputs");
+
+    output_queue_policy_ = OutputQueuePolicy::block;
+    add_parameter("output queue policy",
+                  output_queue_policy_,
+                  "Policy applied when the asynchronous output queue is full. "
+                  "Valid choices are \"block\" (wait for the oldest output "
+                  "to finish), \"drop\" (drop the new output), and "
+                  "\"coalesce\" (replace the newest queued output by the new "
+                  "one)");
+
+    staging_directory_ = "";
+    add_parameter("staging directory",
+                  staging_directory_,
+                  "If set to a nonempty (node local) directory, independent "
+                  "vtu and pvtu files are first written into this directory "
+                  "and then moved to their final location by a background "
+                  "drainer thread. Only used if \"use mpi io\" and \"use "
+                  "hdf5\" are disabled.");
+
+    pieces_per_rank_ = 1;
+    add_parameter("pieces per rank",
+                  pieces_per_rank_,
+                  "Split the independent vtu output of every rank into the "
+                  "given number of pieces that are compressed and written "
+                  "concurrently on separate threads. All pieces are "
+                  "referenced in the pvtu record. Only used if \"use mpi "
+                  "io\" and \"use hdf5\" are disabled.");
+
+    output_groups_ = 0;
+    add_parameter("output groups",
+                  output_groups_,
+                  "Aggregate the independent vtu output of all ranks into the "
+                  "given number of files, one per group of consecutive ranks, "
+                  "that are written with MPI IO within every group "
+                  "(referenced by a single pvtu record). The value -1 selects "
+                  "one group per compute node, and 0 writes one file per "
+                  "rank. Only used if \"use mpi io\" and \"use hdf5\" are "
+                  "disabled.");
+
+    cache_patches_ = false;
+    add_parameter("cache patches",
+                  cache_patches_,
+                  "Build the patches (geometry and connectivity) of the full "
+                  "output only once per mesh and only refresh the data values "
+                  "of subsequent outputs. This avoids reevaluating the "
+                  "mapping, which is expensive for curved high-order "
+                  "mappings.");
+
     add_parameter("manifolds",
                   manifolds_,
                   "List of level set functions. The description is used to "
                   "only output cells that intersect the given level set.");
 
+    add_parameter("contour quantities",
+                  contour_quantities_,
+                  "List of output quantities (selected with \"vtu output "
+                  "quantities\" or computed by the Postprocessor) for which "
+                  "contours at all \"contour levels\" are extracted and "
+                  "written (as a soup of line segments or triangles) to "
+                  "\"<basename>-contours\" together with the levelset "
+                  "output. This does not require DataOut and is much cheaper "
+                  "than a full output.");
+
+    add_parameter("contour levels",
+                  contour_levels_,
+                  "List of levels for the contours of the contour quantities");
+
+    add_parameter("region position bottom left",
+                  region_bottom_left_,
+                  "Bottom left corner of the axis-aligned box selecting the "
+                  "cells for region output. A degenerate box (with both "
+                  "corners coinciding in a coordinate direction) selects all "
+                  "cells.");
+
+    add_parameter("region position top right",
+                  region_top_right_,
+                  "Top right corner of the axis-aligned box selecting the "
+                  "cells for region output");
+
+    region_cell_stride_ = 1;
+    add_parameter("region cell stride",
+                  region_cell_stride_,
+                  "Decimate region output by writing only every Nth locally "
+                  "owned cell");
+
     std::copy(std::begin(View::component_names),
               std::end(View::component_names),
               std::back_inserter(vtu_output_quantities_));
@@ -73,6 +207,262 @@ namespace ryujin
 
     SelectedComponentsExtractor<Description, dim, Number>::check(
         vtu_output_quantities_);
+
+    AssertThrow(region_cell_stride_ > 0,
+                dealii::ExcMessage("The region cell stride must be positive"));
+
+    if (!contour_quantities_.empty()) {
+      const auto &postprocessed_names = postprocessor_->component_names();
+      for (const auto &quantity : contour_quantities_) {
+        const auto is_output_quantity = [&](const auto &list) {
+          return std::find(list.begin(), list.end(), quantity) != list.end();
+        };
+        AssertThrow(is_output_quantity(vtu_output_quantities_) ||
+                        is_output_quantity(postprocessed_names),
+                    dealii::ExcMessage("The contour quantity »" + quantity +
+                                       "« is neither a vtu output quantity "
+                                       "nor a postprocessed quantity"));
+      }
+
+      contour_extractor_.prepare(*offline_data_);
+    }
+
+#ifndef DEAL_II_WITH_HDF5
+    AssertThrow(!use_hdf5_,
+                dealii::ExcMessage("HDF5 output requires deal.II to be "
+                                   "configured with HDF5 support"));
+#endif
+
+    AssertThrow(output_queue_depth_ > 0,
+                dealii::ExcMessage("The output queue depth must be positive"));
+
+#ifdef DEAL_II_WITH_MPI
+    if (asynchronous_output_ &&
+        Utilities::MPI::n_mpi_processes(mpi_communicator_) > 1) {
+      int provided;
+      const int ierr = MPI_Query_thread(&provided);
+      AssertThrowMPI(ierr);
+      AssertThrow(provided == MPI_THREAD_MULTIPLE,
+                  dealii::ExcMessage(
+                      "Asynchronous output issues MPI calls from a "
+                      "background thread and requires an MPI library "
+                      "initialized with MPI_THREAD_MULTIPLE"));
+    }
+#endif
+
+    AssertThrow(output_groups_ >= -1,
+                dealii::ExcMessage("The number of output groups must be "
+                                   "nonnegative, or -1 for one group per "
+                                   "node"));
+
+    AssertThrow(output_groups_ == 0 ||
+                    (staging_directory_.empty() && pieces_per_rank_ <= 1),
+                dealii::ExcMessage("Output groups cannot be combined with a "
+                                   "staging directory or several pieces per "
+                                   "rank"));
+
+    n_output_groups_ = std::max(output_groups_, 0);
+    if (output_groups_ == -1) {
+      /* Count the nodes by the first rank of every node: */
+      unsigned int node_root = 1;
+#ifdef DEAL_II_WITH_MPI
+      MPI_Comm node_communicator;
+      int ierr = MPI_Comm_split_type(mpi_communicator_,
+                                     MPI_COMM_TYPE_SHARED,
+                                     0,
+                                     MPI_INFO_NULL,
+                                     &node_communicator);
+      AssertThrowMPI(ierr);
+      node_root = Utilities::MPI::this_mpi_process(node_communicator) == 0;
+      ierr = MPI_Comm_free(&node_communicator);
+      AssertThrowMPI(ierr);
+#endif
+      n_output_groups_ = Utilities::MPI::sum(node_root, mpi_communicator_);
+    }
+
+    /* Queued outputs refer to the old mesh: */
+    finalize_output();
+
+    if (!staging_directory_.empty()) {
+      /* Every rank uses its own subdirectory: */
+      const auto rank = Utilities::MPI::this_mpi_process(mpi_communicator_);
+      rank_staging_directory_ =
+          staging_directory_ + "/rank_" + Utilities::to_string(rank) + "/";
+      std::filesystem::create_directories(rank_staging_directory_);
+    }
+
+    /*
+     * The background thread uses a duplicated communicator so that its
+     * collective operations cannot interleave with collective operations
+     * issued by the main thread:
+     */
+    if (asynchronous_output_ && io_communicator_ == MPI_COMM_NULL) {
+      const int ierr = MPI_Comm_dup(mpi_communicator_, &io_communicator_);
+      AssertThrowMPI(ierr);
+    }
+
+    /* The mesh has (possibly) changed, write it out again: */
+    hdf5_mesh_filename_.clear();
+    patch_cache_.reset();
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void VTUOutput<Description, dim, Number>::create_patch_cache(
+      const std::vector<Patch> &patches, const unsigned int n_subdivisions)
+  {
+    const auto &dof_handler = offline_data_->dof_handler();
+    const auto &finite_element = dof_handler.get_fe();
+    const unsigned int dofs_per_cell = finite_element.dofs_per_cell;
+
+    /* DataOut uses the default subdivision of 1 for zero: */
+    const unsigned int n = std::max(1u, n_subdivisions);
+    const unsigned int n_points = Utilities::fixed_power<dim>(n + 1);
+
+    patch_cache_ = std::make_unique<PatchCache>();
+    auto &cache = *patch_cache_;
+
+    /* Patch points are ordered lexicographically on the unit cell: */
+    cache.shape_values.reinit(n_points, dofs_per_cell);
+    for (unsigned int q = 0; q < n_points; ++q) {
+      Point<dim> unit_point;
+      for (unsigned int d = 0, index = q; d < dim; ++d, index /= n + 1)
+        unit_point[d] = double(index % (n + 1)) / double(n);
+      for (unsigned int j = 0; j < dofs_per_cell; ++j)
+        cache.shape_values(q, j) = finite_element.shape_value(j, unit_point);
+    }
+
+    /* DataOut creates one patch per locally owned cell in this order: */
+    std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+      if (!cell->is_locally_owned())
+        continue;
+      cell->get_dof_indices(dof_indices);
+      cache.dof_indices.insert(
+          cache.dof_indices.end(), dof_indices.begin(), dof_indices.end());
+    }
+
+    cache.valid = cache.dof_indices.size() == patches.size() * dofs_per_cell;
+    for (const auto &patch : patches)
+      cache.valid = cache.valid && patch.n_subdivisions == n &&
+                    patch.data.n_cols() == n_points;
+
+    if (cache.valid)
+      cache.patches = patches;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  auto VTUOutput<Description, dim, Number>::cached_patches(
+      const std::vector<const ScalarVectorFloat *> &vectors) const
+      -> std::vector<Patch>
+  {
+    Assert(patch_cache_ && patch_cache_->valid, ExcInternalError());
+    const auto &cache = *patch_cache_;
+
+    const unsigned int n_points = cache.shape_values.m();
+    const unsigned int dofs_per_cell = cache.shape_values.n();
+
+    auto patches = cache.patches;
+    for (std::size_t p = 0; p < patches.size(); ++p) {
+      const auto *dof_indices = cache.dof_indices.data() + p * dofs_per_cell;
+      auto &data = patches[p].data;
+      Assert(data.n_rows() >= vectors.size(), ExcInternalError());
+
+      for (unsigned int d = 0; d < vectors.size(); ++d)
+        for (unsigned int q = 0; q < n_points; ++q) {
+          double value = 0.;
+          for (unsigned int j = 0; j < dofs_per_cell; ++j)
+            value += cache.shape_values(q, j) * (*vectors[d])(dof_indices[j]);
+          data(d, q) = value;
+        }
+    }
+
+    return patches;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  VTUOutput<Description, dim, Number>::~VTUOutput()
+  {
+    /* Make sure that no exception escapes from the destructor: */
+    for (auto &[job, status] : output_queue_)
+      if (status.valid())
+        status.wait();
+    output_queue_.clear();
+
+    if (io_communicator_ != MPI_COMM_NULL)
+      MPI_Comm_free(&io_communicator_);
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void VTUOutput<Description, dim, Number>::finalize_output()
+  {
+    while (!output_queue_.empty()) {
+      output_queue_.front().second.get();
+      output_queue_.pop_front();
+    }
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  unsigned int VTUOutput<Description, dim, Number>::queue_depth() const
+  {
+    unsigned int n = 0;
+    for (const auto &[job, status] : output_queue_)
+      if (status.wait_for(std::chrono::seconds(0)) !=
+          std::future_status::ready)
+        ++n;
+    return n;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  unsigned int VTUOutput<Description, dim, Number>::n_skipped_outputs() const
+  {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    return n_skipped_outputs_;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  double VTUOutput<Description, dim, Number>::write_bandwidth() const
+  {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    return write_time_ > 0. ? bytes_written_ / write_time_ : 0.;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void VTUOutput<Description, dim, Number>::post_output_job(
+      const std::shared_ptr<OutputJob> &job)
+  {
+    const auto payload = [this, job]() {
+      int superseded;
+      {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->started = true;
+        superseded = job->superseded;
+      }
+
+      /*
+       * All ranks have to agree on skipping an output because writing
+       * out involves collective communication:
+       */
+      superseded = Utilities::MPI::max(superseded, io_communicator_);
+
+      if (superseded != 0) {
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        ++n_skipped_outputs_;
+        return;
+      }
+
+      job->write(io_communicator_);
+      job->write = nullptr;
+    };
+
+    output_queue_.emplace_back(job, output_thread_.post(payload));
   }
 
 
@@ -83,11 +473,67 @@ namespace ryujin
       Number t,
       unsigned int cycle,
       bool output_full,
-      bool output_levelsets)
+      bool output_levelsets,
+      bool output_region,
+      const ScalarVector *alpha)
   {
 #ifdef DEBUG_OUTPUT
     std::cout << "VTUOutput<dim, Number>::schedule_output()" << std::endl;
 #endif
+    const auto job = std::make_shared<OutputJob>();
+
+    if (asynchronous_output_) {
+      /* Remove finished outputs from the queue: */
+      while (!output_queue_.empty() &&
+             output_queue_.front().second.wait_for(std::chrono::seconds(0)) ==
+                 std::future_status::ready) {
+        output_queue_.front().second.get();
+        output_queue_.pop_front();
+      }
+
+      /* Superseded (dropped or coalesced) outputs do not count: */
+      const auto n_queued = [&]() {
+        return std::count_if(
+            output_queue_.begin(), output_queue_.end(), [](const auto &it) {
+              return !it.first->superseded;
+            });
+      };
+
+      if (n_queued() >= output_queue_depth_) {
+        if (output_queue_policy_ == OutputQueuePolicy::drop) {
+          /*
+           * We still have to post an (empty) job so that all ranks agree
+           * on which outputs are skipped:
+           */
+          job->superseded = true;
+          post_output_job(job);
+          return;
+        }
+
+        bool coalesced = false;
+        if (output_queue_policy_ == OutputQueuePolicy::coalesce) {
+          for (auto it = output_queue_.rbegin(); it != output_queue_.rend();
+               ++it) {
+            auto &other = *it->first;
+            std::lock_guard<std::mutex> lock(other.mutex);
+            if (other.superseded)
+              continue;
+            if (!other.started) {
+              other.superseded = true;
+              other.write = nullptr;
+              coalesced = true;
+            }
+            break;
+          }
+        }
+
+        while (!coalesced && n_queued() >= output_queue_depth_) {
+          output_queue_.front().second.get();
+          output_queue_.pop_front();
+        }
+      }
+    }
+
     const auto &affine_constraints = offline_data_->affine_constraints();
 
     /*
@@ -100,108 +546,369 @@ namespace ryujin
             *hyperbolic_system_,
             state_vector,
             initial_precomputed_,
-            alpha_,
+            alpha != nullptr ? *alpha : alpha_,
             vtu_output_quantities_);
 
-    /* prepare DataOut: */
+    /*
+     * Distribute constraints and convert to single precision. Patches
+     * are stored in single precision by DataOut anyway, so that we can
+     * immediately release the double precision vectors. For asynchronous
+     * output we also take a copy of the postprocessed quantities:
+     */
+
+    const auto n_quantities = postprocessor_->n_quantities();
 
-    auto data_out = std::make_unique<dealii::DataOut<dim>>();
-    data_out->attach_dof_handler(offline_data_->dof_handler());
+    auto output_components = std::make_shared<std::vector<ScalarVectorFloat>>(
+        selected_components.size() + (asynchronous_output_ ? n_quantities : 0));
+    auto names = vtu_output_quantities_;
 
     for (unsigned int d = 0; d < selected_components.size(); ++d) {
+      auto &it = (*output_components)[d];
       affine_constraints.distribute(selected_components[d]);
-      selected_components[d].update_ghost_values();
-      data_out->add_data_vector(selected_components[d],
-                                vtu_output_quantities_[d],
-                                DataOut<dim>::type_dof_data);
+      it.reinit(selected_components[d].get_partitioner());
+      it = selected_components[d];
+      it.update_ghost_values();
+      selected_components[d].reinit(0);
     }
 
-    const auto n_quantities = postprocessor_->n_quantities();
-    for (unsigned int i = 0; i < n_quantities; ++i)
-      data_out->add_data_vector(postprocessor_->quantities()[i],
-                                postprocessor_->component_names()[i],
-                                DataOut<dim>::type_dof_data);
-
-    DataOutBase::VtkFlags flags(t,
-                                cycle,
-                                true,
-#if DEAL_II_VERSION_GTE(9, 5, 0)
-                                DataOutBase::CompressionLevel::best_speed);
-#else
-                                DataOutBase::VtkFlags::best_speed);
-#endif
-    data_out->set_flags(flags);
-
-    const auto &discretization = offline_data_->discretization();
-    const auto &mapping = discretization.mapping();
-    const auto patch_order =
-        std::max(1u, discretization.finite_element().degree) - 1u;
-
-    /* Perform output: */
+    std::vector<const ScalarVectorFloat *> output_vectors;
+    for (const auto &it : *output_components)
+      output_vectors.push_back(&it);
+
+    for (unsigned int i = 0; i < n_quantities; ++i) {
+      const auto &quantity = postprocessor_->quantities()[i];
+      if (asynchronous_output_) {
+        auto &it = (*output_components)[selected_components.size() + i];
+        it.reinit(quantity.get_partitioner());
+        it = quantity;
+        it.update_ghost_values();
+      } else {
+        output_vectors.push_back(&quantity);
+      }
+      names.push_back(postprocessor_->component_names()[i]);
+    }
 
-    if (output_full) {
-      data_out->build_patches(mapping, patch_order);
+    /*
+     * Extract contours synchronously (and thread parallel) from the
+     * output vectors, only the resulting soup is handed to the writer:
+     */
 
-      if (use_mpi_io_) {
-        /* MPI-based synchronous IO */
-        data_out->write_vtu_in_parallel(
-            name + "_" + Utilities::to_string(cycle, 6) + ".vtu",
-            mpi_communicator_);
-      } else {
-        data_out->write_vtu_with_pvtu_record(
-            "", name, cycle, mpi_communicator_, 6);
+    using ContourSoup = typename ContourExtractor<dim, Number>::Soup;
+    auto contours = std::make_shared<ContourSoup>();
+    const bool output_contours =
+        output_levelsets && !contour_quantities_.empty();
+
+    if (output_contours) {
+      for (unsigned int q = 0; q < contour_quantities_.size(); ++q) {
+        const auto it =
+            std::find(names.begin(), names.end(), contour_quantities_[q]);
+        contour_extractor_.extract(*contours,
+                                   *output_vectors[it - names.begin()],
+                                   contour_levels_,
+                                   q);
       }
     }
 
-    if (output_levelsets && manifolds_.size() != 0) {
+    job->write = [this,
+                  output_components,
+                  output_vectors,
+                  names,
+                  name,
+                  t,
+                  cycle,
+                  output_full,
+                  output_levelsets,
+                  output_region,
+                  contours,
+                  output_contours](const MPI_Comm &communicator) {
+      Timer timer;
+      timer.start();
+
+      /* prepare DataOut: */
+
+      auto data_out = std::make_unique<PatchDataOut<dim>>();
+      data_out->attach_dof_handler(offline_data_->dof_handler());
+
+      for (unsigned int d = 0; d < output_vectors.size(); ++d)
+        data_out->add_data_vector(
+            *output_vectors[d], names[d], DataOut<dim>::type_dof_data);
+
+      /* Estimate the payload by the size of the (uncompressed) patches: */
+      double bytes = 0.;
+      const auto count_bytes = [&]() {
+        for (const auto &patch : data_out->get_patches())
+          bytes += patch.data.n_elements() * sizeof(float);
+      };
+
+      DataOutBase::VtkFlags flags(t,
+                                  cycle,
+                                  true,
+#if DEAL_II_VERSION_GTE(9, 5, 0)
+                                  DataOutBase::CompressionLevel::best_speed);
+#else
+                                  DataOutBase::VtkFlags::best_speed);
+#endif
+      data_out->set_flags(flags);
+
+      const auto &discretization = offline_data_->discretization();
+      const auto &mapping = discretization.mapping();
+      const auto patch_order =
+          std::max(1u, discretization.finite_element().degree) - 1u;
+
       /*
-       * Specify an output filter that selects only cells for output that are
-       * in the viscinity of a specified set of output planes:
+       * Write the patches of this rank into pieces_per_rank_ files
+       * "<file_name>_<cycle>.<rank>.<piece>.vtu" concurrently (deal.II
+       * compresses a file serially), and a pvtu record on rank 0:
        */
+      const auto write_vtu_pieces = [&](const std::string &directory,
+                                        const std::string &file_name) {
+        const auto rank = Utilities::MPI::this_mpi_process(communicator);
+        const auto n_ranks = Utilities::MPI::n_mpi_processes(communicator);
+        const auto n_digits = Utilities::needed_digits(n_ranks);
+        const auto n_pieces = pieces_per_rank_;
+
+        const auto file_base = file_name + "_" + Utilities::to_string(cycle, 6);
+        const auto piece_name = [&](const unsigned int r,
+                                    const unsigned int k) {
+          return file_base + "." + Utilities::to_string(r, n_digits) + "." +
+                 Utilities::to_string(k) + ".vtu";
+        };
+
+        const auto &patches = data_out->get_patches();
+        const auto dataset_names = data_out->get_dataset_names();
+        const auto nonscalar_data_ranges =
+            data_out->get_nonscalar_data_ranges();
+
+        std::vector<std::future<void>> pieces;
+        for (unsigned int k = 0; k < n_pieces; ++k)
+          pieces.push_back(std::async(std::launch::async, [&, k]() {
+            const auto begin = patches.begin() + patches.size() * k / n_pieces;
+            const auto end =
+                patches.begin() + patches.size() * (k + 1) / n_pieces;
+            const std::vector<DataOutBase::Patch<dim, dim>> subset(begin, end);
+
+            std::ofstream output(directory + piece_name(rank, k));
+            DataOutBase::write_vtu(
+                subset, dataset_names, nonscalar_data_ranges, flags, output);
+          }));
+
+        for (auto &piece : pieces)
+          piece.get();
+
+        if (rank == 0) {
+          std::vector<std::string> piece_names;
+          for (unsigned int r = 0; r < n_ranks; ++r)
+            for (unsigned int k = 0; k < n_pieces; ++k)
+              piece_names.push_back(piece_name(r, k));
+
+          std::ofstream record(directory + file_base + ".pvtu");
+          data_out->write_pvtu_record(record, piece_names);
+        }
+      };
 
-      std::vector<std::shared_ptr<FunctionParser<dim>>> level_set_functions;
-      for (const auto &expression : manifolds_)
-        level_set_functions.emplace_back(
-            std::make_shared<FunctionParser<dim>>(expression));
-
-      data_out->set_cell_selection([level_set_functions](const auto &cell) {
-        if (!cell->is_active() || cell->is_artificial())
-          return false;
+      /*
+       * Write independent files and a pvtu record. If a staging directory
+       * is set, write into the staging directory instead and queue all
+       * files of this output for draining:
+       */
+      const auto write_vtu_with_pvtu_record = [&](const std::string &base) {
+        if (staging_directory_.empty()) {
+          if (pieces_per_rank_ > 1) {
+            const std::filesystem::path path(base);
+            write_vtu_pieces(path.parent_path().empty()
+                                 ? std::string()
+                                 : path.parent_path().string() + "/",
+                             path.filename().string());
+          } else {
+            data_out->write_vtu_with_pvtu_record(
+                "", base, cycle, communicator, 6, n_output_groups_);
+          }
+          return;
+        }
 
-        for (const auto &function : level_set_functions) {
+        const std::filesystem::path path(base);
+        const auto file_name = path.filename().string();
+        if (pieces_per_rank_ > 1)
+          write_vtu_pieces(rank_staging_directory_, file_name);
+        else
+          data_out->write_vtu_with_pvtu_record(
+              rank_staging_directory_, file_name, cycle, communicator, 6);
+
+        const auto target = path.parent_path().empty()
+                                ? std::string(".")
+                                : path.parent_path().string();
+        FileStaging::instance().drain(
+            rank_staging_directory_,
+            file_name + "_" + Utilities::to_string(cycle, 6) + ".",
+            target);
+      };
+
+      /* Perform output: */
+
+      if (output_full) {
+        if (cache_patches_ && patch_cache_ && patch_cache_->valid) {
+          data_out->set_patches(cached_patches(output_vectors));
+        } else {
+          data_out->build_patches(mapping, patch_order);
+          if (cache_patches_ && !patch_cache_)
+            create_patch_cache(data_out->get_patches(), patch_order);
+        }
+        count_bytes();
+
+        if (use_hdf5_) {
+#ifdef DEAL_II_WITH_HDF5
+          /* MPI-based synchronous collective IO */
+          DataOutBase::DataOutFilter data_filter(
+              DataOutBase::DataOutFilterFlags(
+                  /*filter_duplicate_vertices*/ true,
+                  /*xdmf_hdf5_output*/ true));
+          data_out->write_filtered_data(data_filter);
+
+          const bool write_mesh = hdf5_mesh_filename_.empty();
+          if (write_mesh)
+            hdf5_mesh_filename_ =
+                name + "-mesh_" + Utilities::to_string(cycle, 6) + ".h5";
+
+          const auto solution_filename =
+              name + "_" + Utilities::to_string(cycle, 6) + ".h5";
+
+          data_out->write_hdf5_parallel(data_filter,
+                                        write_mesh,
+                                        hdf5_mesh_filename_,
+                                        solution_filename,
+                                        communicator);
+
+          auto &entries = xdmf_entries_[name];
+          entries.push_back(data_out->create_xdmf_entry(data_filter,
+                                                        hdf5_mesh_filename_,
+                                                        solution_filename,
+                                                        t,
+                                                        communicator));
+          data_out->write_xdmf_file(entries, name + ".xdmf", communicator);
+#endif
 
-          unsigned int above = 0;
-          unsigned int below = 0;
+        } else if (use_mpi_io_) {
+          /* MPI-based synchronous IO */
+          data_out->write_vtu_in_parallel(
+              name + "_" + Utilities::to_string(cycle, 6) + ".vtu",
+              communicator);
+        } else {
+          write_vtu_with_pvtu_record(name);
+        }
+      }
 
-          for (unsigned int v : cell->vertex_indices()) {
-            const auto vertex = cell->vertex(v);
-            constexpr auto eps = std::numeric_limits<Number>::epsilon();
-            if (function->value(vertex) >= 0. - 100. * eps)
-              above++;
-            if (function->value(vertex) <= 0. + 100. * eps)
-              below++;
-            if (above > 0 && below > 0)
-              return true;
+      if (output_levelsets && manifolds_.size() != 0) {
+        /*
+         * Specify an output filter that selects only cells for output that are
+         * in the viscinity of a specified set of output planes:
+         */
+
+        std::vector<std::shared_ptr<FunctionParser<dim>>> level_set_functions;
+        for (const auto &expression : manifolds_)
+          level_set_functions.emplace_back(
+              std::make_shared<FunctionParser<dim>>(expression));
+
+        data_out->set_cell_selection([level_set_functions](const auto &cell) {
+          if (!cell->is_active() || cell->is_artificial())
+            return false;
+
+          for (const auto &function : level_set_functions) {
+
+            unsigned int above = 0;
+            unsigned int below = 0;
+
+            for (unsigned int v : cell->vertex_indices()) {
+              const auto vertex = cell->vertex(v);
+              constexpr auto eps = std::numeric_limits<Number>::epsilon();
+              if (function->value(vertex) >= 0. - 100. * eps)
+                above++;
+              if (function->value(vertex) <= 0. + 100. * eps)
+                below++;
+              if (above > 0 && below > 0)
+                return true;
+            }
           }
+          return false;
+        });
+
+        data_out->build_patches(mapping, patch_order);
+        count_bytes();
+
+        if (use_mpi_io_) {
+          /* MPI-based synchronous IO */
+          data_out->write_vtu_in_parallel(
+              name + "-levelsets_" + Utilities::to_string(cycle, 6) + ".vtu",
+              communicator);
+        } else {
+          write_vtu_with_pvtu_record(name + "-levelsets");
         }
-        return false;
-      });
+      }
 
-      data_out->build_patches(mapping, patch_order);
+      if (output_contours) {
+        bytes += contours->points.size() * sizeof(contours->points[0]);
+        ContourExtractor<dim, Number>::write_vtu(
+            *contours, name + "-contours", cycle, communicator);
+      }
 
-      if (use_mpi_io_) {
-        /* MPI-based synchronous IO */
-        data_out->write_vtu_in_parallel(
-            name + "-levelsets_" + Utilities::to_string(cycle, 6) + ".vtu",
-            mpi_communicator_);
-      } else {
-        data_out->write_vtu_with_pvtu_record(
-            "", name + "-levelsets", cycle, mpi_communicator_, 6);
+      if (output_region) {
+        /*
+         * Specify an output filter that selects only every Nth locally owned
+         * cell with a cell center inside the region of interest:
+         */
+
+        bool use_box = true;
+        for (unsigned int d = 0; d < dim; ++d)
+          if (region_bottom_left_[d] == region_top_right_[d])
+            use_box = false;
+
+        const auto bottom_left = region_bottom_left_;
+        const auto top_right = region_top_right_;
+        const auto stride = region_cell_stride_;
+
+        data_out->set_cell_selection([=](const auto &cell) {
+          if (!cell->is_active() || !cell->is_locally_owned())
+            return false;
+
+          if (cell->active_cell_index() % stride != 0)
+            return false;
+
+          if (!use_box)
+            return true;
+
+          const auto center = cell->center();
+          for (unsigned int d = 0; d < dim; ++d)
+            if (center[d] < bottom_left[d] || center[d] > top_right[d])
+              return false;
+
+          return true;
+        });
+
+        data_out->build_patches(mapping, patch_order);
+        count_bytes();
+
+        if (use_mpi_io_) {
+          /* MPI-based synchronous IO */
+          data_out->write_vtu_in_parallel(
+              name + "-region_" + Utilities::to_string(cycle, 6) + ".vtu",
+              communicator);
+        } else {
+          write_vtu_with_pvtu_record(name + "-region");
+        }
       }
-    }
 
-    /* Explicitly delete pointer to free up memory early: */
-    data_out.reset();
+      /* Explicitly delete pointer to free up memory early: */
+      data_out.reset();
+
+      timer.stop();
+      std::lock_guard<std::mutex> lock(statistics_mutex_);
+      bytes_written_ += bytes;
+      write_time_ += timer.wall_time();
+    };
+
+    if (asynchronous_output_)
+      post_output_job(job);
+    else
+      job->write(mpi_communicator_);
   }
 
 } /* namespace ryujin */
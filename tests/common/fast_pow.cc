@@ -8,7 +8,7 @@ int main()
   std::cout << std::setprecision(16);
   std::cout << std::scientific;
 
-  using VA = dealii::VectorizedArray<double>;
+  using VA = ryujin::VectorizedArray<double>;
 
   auto test = [&](const VA a, const VA b) {
     std::cout << "a:        " << a << "\n";
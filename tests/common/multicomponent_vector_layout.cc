@@ -0,0 +1,139 @@
+#include <multicomponent_vector.h>
+
+/*
+ * Verify that the blocked and interleaved storage layouts of
+ * MultiComponentVector are indistinguishable through the accessor
+ * functions and MPI ghost synchronization. Two ranks own 16 indices each
+ * and import the first locally owned index of the other rank.
+ */
+
+using namespace ryujin;
+
+constexpr int n_comp = 3;
+using VA = ryujin::VectorizedArray<double>;
+constexpr auto simd_length = VA::size();
+
+using Interleaved =
+    Vectors::MultiComponentVector<double,
+                                  n_comp,
+                                  simd_length,
+                                  Vectors::VectorLayout::interleaved>;
+
+using Blocked = Vectors::MultiComponentVector<double,
+                                              n_comp,
+                                              simd_length,
+                                              Vectors::VectorLayout::blocked>;
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  const auto mpi_rank =
+      dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  const auto n_mpi_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  AssertThrow(n_mpi_processes == 2, dealii::ExcMessage("set up for 2 ranks"));
+
+  constexpr unsigned int n_owned = 16;
+
+  dealii::IndexSet locally_owned(2 * n_owned);
+  dealii::IndexSet ghosts(2 * n_owned);
+  locally_owned.add_range(mpi_rank * n_owned, (mpi_rank + 1) * n_owned);
+  ghosts.add_index((1 - mpi_rank) * n_owned);
+
+  const auto scalar_partitioner =
+      std::make_shared<dealii::Utilities::MPI::Partitioner>(
+          locally_owned, ghosts, MPI_COMM_WORLD);
+
+  const auto vector_partitioner =
+      Vectors::create_vector_partitioner(scalar_partitioner, n_comp);
+
+  Interleaved interleaved;
+  Blocked blocked;
+  interleaved.reinit(vector_partitioner);
+  blocked.reinit(vector_partitioner);
+
+  const auto value = [&](unsigned int i, unsigned int d) {
+    return 1000. * mpi_rank + 10. * i + d;
+  };
+
+  for (unsigned int i = 0; i < n_owned; ++i) {
+    dealii::Tensor<1, n_comp, double> tensor;
+    for (unsigned int d = 0; d < n_comp; ++d)
+      tensor[d] = value(i, d);
+    interleaved.write_tensor(tensor, i);
+    blocked.write_tensor(tensor, i);
+  }
+
+  unsigned int success = 1;
+  const auto check = [&](const std::string &name) {
+    success = dealii::Utilities::MPI::min(success, MPI_COMM_WORLD);
+    if (mpi_rank == 0)
+      std::cout << name << ": " << (success == 1 ? "ok" : "failed")
+                << std::endl;
+    success = 1;
+  };
+
+  for (unsigned int i = 0; i < n_owned; ++i)
+    if (interleaved.get_tensor(i) != blocked.get_tensor(i))
+      success = 0;
+  check("get_tensor<double>");
+
+  for (unsigned int i = 0; i < n_owned; i += simd_length) {
+    const auto a = interleaved.get_tensor<VA>(i);
+    const auto b = blocked.get_tensor<VA>(i);
+    for (unsigned int d = 0; d < n_comp; ++d)
+      for (unsigned int k = 0; k < simd_length; ++k)
+        if (a[d][k] != value(i + k, d) || b[d][k] != value(i + k, d))
+          success = 0;
+  }
+  check("get_tensor<VA>");
+
+  std::array<unsigned int, simd_length> js;
+  for (unsigned int k = 0; k < simd_length; ++k)
+    js[k] = (7 * k + 3) % n_owned;
+  {
+    const auto a = interleaved.get_tensor<VA>(js.data());
+    const auto b = blocked.get_tensor<VA>(js.data());
+    for (unsigned int d = 0; d < n_comp; ++d)
+      for (unsigned int k = 0; k < simd_length; ++k)
+        if (a[d][k] != value(js[k], d) || b[d][k] != value(js[k], d))
+          success = 0;
+  }
+  check("get_tensor<VA>(js)");
+
+  for (unsigned int i = 0; i < n_owned; i += simd_length) {
+    dealii::Tensor<1, n_comp, VA> tensor;
+    for (unsigned int d = 0; d < n_comp; ++d)
+      tensor[d] = 1.;
+    interleaved.add_tensor<VA>(tensor, i);
+    blocked.add_tensor<VA>(tensor, i);
+  }
+  for (unsigned int i = 0; i < n_owned; ++i)
+    for (unsigned int d = 0; d < n_comp; ++d)
+      if (blocked.get_tensor(i)[d] != value(i, d) + 1. ||
+          interleaved.get_tensor(i)[d] != value(i, d) + 1.)
+        success = 0;
+  check("add_tensor<VA>");
+
+  dealii::LinearAlgebra::distributed::Vector<double> scalar_vector(
+      scalar_partitioner);
+  for (unsigned int d = 0; d < n_comp; ++d) {
+    blocked.extract_component(scalar_vector, d);
+    for (unsigned int i = 0; i < n_owned; ++i)
+      if (scalar_vector.local_element(i) != value(i, d) + 1.)
+        success = 0;
+  }
+  check("extract_component");
+
+  blocked.update_ghost_values();
+  {
+    const auto ghost = blocked.get_tensor(n_owned);
+    for (unsigned int d = 0; d < n_comp; ++d)
+      if (ghost[d] != 1000. * (1 - mpi_rank) + d + 1.)
+        success = 0;
+  }
+  check("ghost values");
+}
@@ -0,0 +1,66 @@
+#include <simd_transpose.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Verify that load_and_transpose() and transpose_and_store() agree with
+ * the lane by lane definition for small numbers of components, including
+ * component counts that are not a multiple of four.
+ */
+
+using namespace ryujin;
+
+template <unsigned int n_comp, typename Number>
+void test(const std::string &name)
+{
+  using VA = ryujin::VectorizedArray<Number>;
+  constexpr auto width = VA::size();
+
+  /* Irregular, distinct offsets into an array of n_nodes nodes: */
+  constexpr unsigned int n_nodes = 3 * width + 1;
+  std::vector<Number> data(n_nodes * n_comp);
+  for (unsigned int i = 0; i < data.size(); ++i)
+    data[i] = Number(i);
+
+  unsigned int offsets[width];
+  for (unsigned int k = 0; k < width; ++k)
+    offsets[k] = ((3 * k + 1) % n_nodes) * n_comp;
+  offsets[width - 1] = (n_nodes - 1) * n_comp;
+
+  bool success = true;
+
+  VA tensor[n_comp];
+  load_and_transpose<n_comp>(data.data(), offsets, tensor);
+  for (unsigned int d = 0; d < n_comp; ++d)
+    for (unsigned int k = 0; k < width; ++k)
+      success = success && tensor[d][k] == data[offsets[k] + d];
+
+  std::vector<Number> result(data.size(), Number(-1.));
+  transpose_and_store<n_comp, false>(tensor, offsets, result.data());
+  transpose_and_store<n_comp, true>(tensor, offsets, result.data());
+
+  std::vector<Number> expected(data.size(), Number(-1.));
+  for (unsigned int k = 0; k < width; ++k)
+    for (unsigned int d = 0; d < n_comp; ++d)
+      expected[offsets[k] + d] = Number(2.) * data[offsets[k] + d];
+  success = success && result == expected;
+
+  std::cout << name << " n_comp = " << n_comp << ": "
+            << (success ? "ok" : "failed") << std::endl;
+}
+
+
+int main()
+{
+  test<1, double>("double");
+  test<2, double>("double");
+  test<3, double>("double");
+  test<4, double>("double");
+  test<5, double>("double");
+  test<6, double>("double");
+
+  test<3, float>("float");
+  test<5, float>("float");
+}
@@ -0,0 +1,170 @@
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+/*
+ * Verify that all ghost row exchange backends transfer identical data.
+ * We set up a tridiagonal sparsity pattern distributed over two MPI
+ * ranks, write the value 100 * row + column (in global indices) into all
+ * locally owned rows of the matrix and check whether ghost rows have
+ * been populated correctly after an exchange. Every backend performs
+ * two exchanges to exercise the reuse of persistent requests. Finally,
+ * we zero out every other row and verify that an exchange skipping zero
+ * rows produces the same result, and that a quantized exchange of
+ * entries in [0, 1] rounds down by less than one fixed point unit.
+ */
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  const auto mpi_rank =
+      dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  const auto n_mpi_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  AssertThrow(n_mpi_processes == 2, dealii::ExcMessage("set up for 2 ranks"));
+
+  /* Set up locally owned and relevant index sets. */
+
+  constexpr unsigned int size = 8;
+
+  dealii::IndexSet locally_owned(size);
+  dealii::IndexSet locally_relevant(size);
+
+  if (mpi_rank == 0) {
+    locally_owned.add_range(0, 4);
+    locally_relevant.add_range(0, 5);
+  } else {
+    locally_owned.add_range(4, 8);
+    locally_relevant.add_range(3, 8);
+  }
+
+  const auto partitioner =
+      std::make_shared<dealii::Utilities::MPI::Partitioner>(
+          locally_owned, locally_relevant, MPI_COMM_WORLD);
+
+  /* Set up a (symmetric) tridiagonal sparsity pattern: */
+
+  dealii::DynamicSparsityPattern dsp(size, size, locally_relevant);
+  for (const auto i : locally_relevant) {
+    if (i > 0)
+      dsp.add(i, i - 1);
+    dsp.add(i, i);
+    if (i + 1 < size)
+      dsp.add(i, i + 1);
+  }
+  dsp.compress();
+
+  using VA = ryujin::VectorizedArray<double>;
+  constexpr auto simd_width = VA::size();
+  ryujin::SparsityPatternSIMD<simd_width> sparsity_pattern_simd(
+      /* vectorized internal range */ 0, dsp, partitioner);
+
+  const unsigned int n_owned = partitioner->locally_owned_size();
+
+  const auto value = [&](unsigned int i, unsigned int col_idx, int round) {
+    const auto row = partitioner->local_to_global(i);
+    const auto column = partitioner->local_to_global(
+        sparsity_pattern_simd.columns(i)[col_idx]);
+    return 100. * row + column + 1000. * round;
+  };
+
+  const std::vector<std::pair<ryujin::GhostRowExchange, std::string>> modes{
+      {ryujin::GhostRowExchange::point_to_point, "point to point"},
+      {ryujin::GhostRowExchange::persistent, "persistent"},
+      {ryujin::GhostRowExchange::neighborhood_collective,
+       "neighborhood collective"}};
+
+  for (const auto &[mode, name] : modes) {
+    sparsity_pattern_simd.set_ghost_row_exchange(mode);
+    ryujin::SparseMatrixSIMD<double, 1, simd_width> matrix(
+        sparsity_pattern_simd);
+
+    unsigned int success = 1;
+
+    for (int round = 0; round < 2; ++round) {
+      for (unsigned int i = 0; i < n_owned; ++i)
+        for (unsigned int j = 0; j < sparsity_pattern_simd.row_length(i); ++j)
+          matrix.write_entry(value(i, j, round), i, j);
+
+      matrix.update_ghost_rows_start(round);
+      matrix.update_ghost_rows_finish();
+
+      for (unsigned int i = n_owned; i < sparsity_pattern_simd.n_rows(); ++i)
+        for (unsigned int j = 0; j < sparsity_pattern_simd.row_length(i); ++j)
+          if (matrix.get_entry(i, j) != value(i, j, round))
+            success = 0;
+    }
+
+    success = dealii::Utilities::MPI::min(success, MPI_COMM_WORLD);
+    if (mpi_rank == 0)
+      std::cout << name << ": " << (success == 1 ? "ok" : "failed")
+                << std::endl;
+  }
+
+  {
+    ryujin::SparseMatrixSIMD<double, 1, simd_width> matrix(
+        sparsity_pattern_simd);
+
+    const auto is_zero_row = [&](unsigned int i) {
+      return partitioner->local_to_global(i) % 2 == 0;
+    };
+
+    /* Populate ghost rows with nonzero values first: */
+    for (unsigned int i = 0; i < n_owned; ++i)
+      for (unsigned int j = 0; j < sparsity_pattern_simd.row_length(i); ++j)
+        matrix.write_entry(value(i, j, 0), i, j);
+    matrix.update_ghost_rows();
+
+    for (unsigned int i = 0; i < n_owned; ++i)
+      for (unsigned int j = 0; j < sparsity_pattern_simd.row_length(i); ++j)
+        matrix.write_entry(is_zero_row(i) ? 0. : value(i, j, 1), i, j);
+
+    matrix.update_ghost_rows_start(0, /*skip zero rows*/ true);
+    matrix.update_ghost_rows_finish();
+
+    unsigned int success = 1;
+    for (unsigned int i = n_owned; i < sparsity_pattern_simd.n_rows(); ++i)
+      for (unsigned int j = 0; j < sparsity_pattern_simd.row_length(i); ++j)
+        if (matrix.get_entry(i, j) != (is_zero_row(i) ? 0. : value(i, j, 1)))
+          success = 0;
+
+    success = dealii::Utilities::MPI::min(success, MPI_COMM_WORLD);
+    if (mpi_rank == 0)
+      std::cout << "skip zero rows: " << (success == 1 ? "ok" : "failed")
+                << std::endl;
+  }
+
+  {
+    ryujin::SparseMatrixSIMD<double, 1, simd_width> matrix(
+        sparsity_pattern_simd);
+
+    const auto unit_value = [&](unsigned int i, unsigned int col_idx) {
+      const auto row = partitioner->local_to_global(i);
+      if (row % 3 == 0)
+        return 1.;
+      return 1. / (1. + std::sqrt(value(i, col_idx, 0)));
+    };
+
+    for (unsigned int i = 0; i < n_owned; ++i)
+      for (unsigned int j = 0; j < sparsity_pattern_simd.row_length(i); ++j)
+        matrix.write_entry(unit_value(i, j), i, j);
+
+    matrix.update_ghost_rows_start(0, /*skip zero rows*/ false, true);
+    matrix.update_ghost_rows_finish();
+
+    unsigned int success = 1;
+    for (unsigned int i = 0; i < sparsity_pattern_simd.n_rows(); ++i)
+      for (unsigned int j = 0; j < sparsity_pattern_simd.row_length(i); ++j) {
+        const auto difference = unit_value(i, j) - matrix.get_entry(i, j);
+        if (difference < 0. || difference >= 1. / 65535.)
+          success = 0;
+      }
+
+    success = dealii::Utilities::MPI::min(success, MPI_COMM_WORLD);
+    if (mpi_rank == 0)
+      std::cout << "quantized: " << (success == 1 ? "ok" : "failed")
+                << std::endl;
+  }
+}
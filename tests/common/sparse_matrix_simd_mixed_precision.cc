@@ -0,0 +1,123 @@
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+/*
+ * Verify that a SparseMatrixSIMD storing single-precision entries over a
+ * double-precision sparsity pattern agrees with the full precision
+ * matrix up to single precision round-off.
+ */
+
+int main()
+{
+  using VA = ryujin::VectorizedArray<double>;
+  constexpr auto simd_width = VA::size();
+
+  dealii::DynamicSparsityPattern spars(14, 14);
+  spars.add(0, 0);
+  spars.add(0, 1);
+  spars.add(0, 13);
+  for (unsigned int i = 1; i < 12; ++i) {
+    spars.add(i, i - 1);
+    spars.add(i, i);
+    spars.add(i, i + 1);
+  }
+  spars.add(12, 12);
+  spars.add(12, 11);
+  spars.add(13, 13);
+  spars.add(13, 0);
+  spars.compress();
+
+  dealii::IndexSet locally_owned(14);
+  locally_owned.add_range(0, 14);
+  dealii::IndexSet locally_relevant(14);
+  auto partitioner = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+      locally_owned, locally_relevant, MPI_COMM_SELF);
+
+  constexpr unsigned int n_internal = (12 / simd_width) * simd_width;
+
+  ryujin::SparsityPatternSIMD<simd_width> my_sparsity(
+      n_internal, spars, partitioner);
+
+  ryujin::SparseMatrixSIMD<double, 1, simd_width> full(my_sparsity);
+  ryujin::SparseMatrixSIMD<float, 1, simd_width> mixed(my_sparsity);
+  ryujin::SparseMatrixSIMD<double, 2, simd_width> full_tensor(my_sparsity);
+  ryujin::SparseMatrixSIMD<float, 2, simd_width> mixed_tensor(my_sparsity);
+
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i)
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j) {
+      const double value = 1. / (3. + i + 7. * j);
+      full.write_entry(value, i, j);
+      mixed.write_entry(value, i, j);
+
+      dealii::Tensor<1, 2, double> tensor;
+      tensor[0] = value;
+      tensor[1] = -2. * value;
+      full_tensor.write_entry(tensor, i, j);
+      mixed_tensor.write_entry(tensor, i, j);
+    }
+
+  constexpr double tolerance = 1.e-7;
+  const auto check = [&](const std::string &name, double deviation) {
+    std::cout << name << ": " << (deviation < tolerance ? "ok" : "failed")
+              << std::endl;
+  };
+
+  double deviation = 0.;
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i)
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j) {
+      const auto a = full.get_entry(i, j);
+      const auto b = mixed.template get_entry<double>(i, j);
+      deviation = std::max(deviation, std::abs(a - b) / std::abs(a));
+    }
+  check("get_entry<double>", deviation);
+
+  deviation = 0.;
+  for (unsigned int i = 0; i < n_internal; i += simd_width)
+    for (unsigned int j = 0; j < 3; ++j) {
+      const auto a = full.template get_entry<VA>(i, j);
+      const auto b = mixed.template get_entry<VA>(i, j);
+      for (unsigned int k = 0; k < simd_width; ++k)
+        deviation = std::max(deviation, std::abs(a[k] - b[k]) / std::abs(a[k]));
+    }
+  check("get_entry<VA>", deviation);
+
+  deviation = 0.;
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i)
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j) {
+      const auto a = full.get_transposed_entry(i, j);
+      const auto b = mixed.template get_transposed_entry<double>(i, j);
+      deviation = std::max(deviation, std::abs(a - b) / std::abs(a));
+    }
+  check("get_transposed_entry<double>", deviation);
+
+  deviation = 0.;
+  for (unsigned int i = 0; i < n_internal; i += simd_width)
+    for (unsigned int j = 0; j < 3; ++j) {
+      const auto a = full.template get_transposed_entry<VA>(i, j);
+      const auto b = mixed.template get_transposed_entry<VA>(i, j);
+      for (unsigned int k = 0; k < simd_width; ++k)
+        deviation = std::max(deviation, std::abs(a[k] - b[k]) / std::abs(a[k]));
+    }
+  check("get_transposed_entry<VA>", deviation);
+
+  deviation = 0.;
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i)
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j) {
+      const auto a = full_tensor.get_tensor(i, j);
+      const auto b = mixed_tensor.template get_tensor<double>(i, j);
+      deviation = std::max(deviation, (a - b).norm() / a.norm());
+    }
+  check("get_tensor<double>", deviation);
+
+  deviation = 0.;
+  for (unsigned int i = 0; i < n_internal; i += simd_width)
+    for (unsigned int j = 0; j < 3; ++j) {
+      const auto a = full_tensor.template get_tensor<VA>(i, j);
+      const auto b = mixed_tensor.template get_tensor<VA>(i, j);
+      for (unsigned int k = 0; k < simd_width; ++k)
+        for (unsigned int d = 0; d < 2; ++d)
+          deviation = std::max(deviation,
+                               std::abs(a[d][k] - b[d][k]) / std::abs(a[d][k]));
+    }
+  check("get_tensor<VA>", deviation);
+}
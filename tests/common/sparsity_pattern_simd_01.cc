@@ -153,7 +153,7 @@ int main(int argc, char *argv[])
   }
   dsp.compress();
 
-  using VA = dealii::VectorizedArray<double>;
+  using VA = ryujin::VectorizedArray<double>;
   constexpr auto simd_width = VA::size();
   ryujin::Debug<simd_width> sparsity_pattern_simd(
       /* vectorized internal range */ 0, dsp, partitioner);
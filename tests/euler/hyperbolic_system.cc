@@ -90,14 +90,14 @@ int main()
   test<3, float>();
 
   std::cout << "\nVectorizedArray<double>\n" << std::endl;
-  test<1, VectorizedArray<double>>();
-  test<2, VectorizedArray<double>>();
-  test<3, VectorizedArray<double>>();
+  test<1, ryujin::VectorizedArray<double>>();
+  test<2, ryujin::VectorizedArray<double>>();
+  test<3, ryujin::VectorizedArray<double>>();
 
   std::cout << "\nVectorizedArray<float>\n" << std::endl;
-  test<1, VectorizedArray<float>>();
-  test<2, VectorizedArray<float>>();
-  test<3, VectorizedArray<float>>();
+  test<1, ryujin::VectorizedArray<float>>();
+  test<2, ryujin::VectorizedArray<float>>();
+  test<3, ryujin::VectorizedArray<float>>();
 
   return 0;
 }
@@ -0,0 +1,69 @@
+#include <equation_of_state_polytropic_gas.h>
+#include <equation_of_state_table.h>
+
+#include <deal.II/base/vectorization.h>
+
+#include <iostream>
+
+/*
+ * Tabulate the pressure of a polytropic gas and verify the scalar and
+ * vectorized table lookup against the original equation of state.
+ */
+
+using namespace ryujin::EquationOfStateLibrary;
+
+int main()
+{
+  PolytropicGas eos("/EquationOfState");
+
+  EquationOfStateTable table;
+  table.build(
+      [&](const auto &p, const auto &rho, const auto &e) {
+        eos.pressure(p, rho, e);
+      },
+      /*rho*/ 1.0e-2,
+      1.0e2,
+      /*e*/ 1.0e-1,
+      1.0e3,
+      /*n*/ 64);
+
+  const auto check = [](const std::string &name, bool success) {
+    std::cout << name << ": " << (success ? "ok" : "failed") << std::endl;
+  };
+
+  check("max relative error below 1e-2", table.max_relative_error() < 1.e-2);
+
+  /* The interpolant is exact in the sampling points: */
+  {
+    bool success = true;
+    for (const double rho : {1.0e-2, 1.0, 1.0e2})
+      for (const double e : {1.0e-1, 1.0e1, 1.0e3}) {
+        const auto p = eos.pressure(rho, e);
+        if (std::abs(table.evaluate(rho, e) - p) > 1.e-12 * std::abs(p))
+          success = false;
+      }
+    check("exact in sampling points", success);
+  }
+
+  /* The vectorized lookup agrees with the scalar lookup: */
+  {
+    using VA = dealii::VectorizedArray<double>;
+    VA rho, e;
+    for (unsigned int k = 0; k < VA::size(); ++k) {
+      rho[k] = 0.05 + 7.3 * k;
+      e[k] = 0.3 + 91.7 * k;
+    }
+
+    const auto p = table.evaluate(rho, e);
+    bool success = table.in_range(rho, e);
+    for (unsigned int k = 0; k < VA::size(); ++k) {
+      const auto p_k = table.evaluate(rho[k], e[k]);
+      if (std::abs(p[k] - p_k) > 1.e-12 * std::abs(p_k))
+        success = false;
+    }
+    check("vectorized lookup", success);
+
+    rho[0] = 1.0e3;
+    check("out of range detection", !table.in_range(rho, e));
+  }
+}
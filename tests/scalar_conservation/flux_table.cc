@@ -0,0 +1,87 @@
+#include <flux_table.h>
+
+#include <deal.II/base/vectorization.h>
+
+#include <cmath>
+#include <iostream>
+
+/*
+ * Tabulate two closed-form fluxes and verify the scalar and vectorized
+ * table lookup against the original functions.
+ */
+
+using namespace ryujin::FluxLibrary;
+
+int main()
+{
+  const auto check = [](const std::string &name, bool success) {
+    std::cout << name << ": " << (success ? "ok" : "failed") << std::endl;
+  };
+
+  /* A cubic flux is reproduced exactly by the Hermite interpolant: */
+
+  FluxTable cubic;
+  cubic.build([](double u, unsigned int c) { return (c + 1.) * u * u * u; },
+              [](double u, unsigned int c) { return 3. * (c + 1.) * u * u; },
+              /*n_components*/ 2,
+              /*u_min*/ -2.,
+              /*u_max*/ 3.,
+              /*n*/ 16);
+
+  bool success = true;
+  for (unsigned int k = 0; k <= 100; ++k) {
+    const double u = -2. + 0.05 * k;
+    for (unsigned int c = 0; c < 2; ++c) {
+      success &= std::abs(cubic.value(u, c) - (c + 1.) * u * u * u) < 1.e-10;
+      success &= std::abs(cubic.gradient(u, c) - 3. * (c + 1.) * u * u) <
+                 1.e-10;
+    }
+  }
+  check("exact for cubic fluxes", success);
+
+  /* A smooth flux converges with the table resolution: */
+
+  FluxTable kpp;
+  kpp.build([](double u, unsigned int) { return std::sin(u); },
+            [](double u, unsigned int) { return std::cos(u); },
+            /*n_components*/ 1,
+            /*u_min*/ 0.,
+            /*u_max*/ 12.,
+            /*n*/ 1024);
+
+  double error = 0.;
+  for (unsigned int k = 0; k <= 1000; ++k) {
+    const double u = 0.012 * k;
+    error = std::max(error, std::abs(kpp.value(u, 0) - std::sin(u)));
+    error = std::max(error, std::abs(kpp.gradient(u, 0) - std::cos(u)));
+  }
+  check("error below 1e-6", error < 1.e-6);
+
+  /* Vectorized lookups agree with the scalar lookup lane by lane: */
+
+  using VA = dealii::VectorizedArray<double>;
+  success = true;
+  for (unsigned int k = 0; k < 100; ++k) {
+    VA u;
+    for (unsigned int s = 0; s < VA::size(); ++s)
+      u[s] = 0.1 * k + 0.013 * s;
+
+    const VA f = kpp.value(u, 0);
+    const VA df = kpp.gradient(u, 0);
+    for (unsigned int s = 0; s < VA::size(); ++s)
+      success &= f[s] == kpp.value(u[s], 0) &&
+                 df[s] == kpp.gradient(u[s], 0);
+  }
+  check("vectorized lookup", success);
+
+  /* States outside of the table range are detected: */
+
+  VA u = 1.;
+  success = kpp.in_range(u) && kpp.in_range(12.) && !kpp.in_range(-1.e-3);
+  u[VA::size() - 1] = 12.5;
+  success &= !kpp.in_range(u);
+  success &= !FluxTable().in_range(1.);
+  check("out of range detection", success);
+
+  return 0;
+}